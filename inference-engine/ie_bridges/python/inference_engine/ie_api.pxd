@@ -32,8 +32,16 @@ cdef class InferRequest:
     cpdef async_infer(self, inputs = ?)
     cpdef wait(self, timeout = ?)
     cpdef get_perf_counts(self)
+    cpdef get_perf_counts_arrays(self)
+    cdef C.PerfCountsArrays _perf_arrays
+    cdef object _perf_names
+    cpdef set_blob(self, str blob_name, array)
+    cpdef set_completion_callback(self, py_callback, py_data = ?)
+    cpdef set_images(self, str input_name, images)
+    cdef object _py_callback
+    cdef object _py_data
     cdef public:
-        _inputs, _outputs
+        _inputs, _outputs, _bound_arrays
 
 cdef class IENetwork:
     cdef C.IENetwork impl
@@ -13,11 +13,25 @@ from libcpp.map cimport map
 from libcpp.memory cimport unique_ptr
 from libc.stdint cimport int64_t
 import os
+import traceback
 import numpy as np
 
 cdef extern from "<utility>" namespace "std" nogil:
     cdef unique_ptr[C.IEExecNetwork] move(unique_ptr[C.IEExecNetwork])
 
+cdef extern from "Python.h":
+    void PyEval_InitThreads()
+
+# the completion callbacks take the GIL in the threads of the plugins
+PyEval_InitThreads()
+
+cdef void c_completion_callback(void *args, int status) with gil:
+    cdef InferRequest request = <InferRequest> args
+    try:
+        request._py_callback(status, request._py_data)
+    except Exception:
+        traceback.print_exc()
+
 cdef string to_std_string(str py_string):
     return py_string.encode()
 
@@ -90,6 +104,31 @@ cdef class ExecutableNetwork:
         current_request.async_infer(inputs)
         return current_request
 
+    @property
+    def load_time(self):
+        """The wall time of the network loading in milliseconds"""
+        return deref(self.impl).load_time_ms
+
+    @property
+    def peak_memory(self):
+        """The peak resident memory of the process in kilobytes right after the network loading"""
+        return deref(self.impl).peak_memory_kb
+
+    def get_idle_request_id(self):
+        """The id of a request which is not running or -1 when all of them are busy"""
+        return deref(self.impl).getIdleRequestId()
+
+    def wait_all(self, timeout=None):
+        """Waits until all requests are completed and their callbacks have returned, the timeout is in milliseconds.
+        Returns the status code: 0 (OK) or the code of RESULT_NOT_READY when the timeout has expired"""
+        if timeout is None:
+            timeout = -1
+        cdef int64_t c_timeout = <int64_t> timeout
+        cdef int status
+        with nogil:
+            status = deref(self.impl).waitAll(c_timeout)
+        return status
+
     @property
     def requests(self):
         return self._requests
@@ -98,6 +137,7 @@ cdef class InferRequest:
     def __init__(self):
         self._inputs = {}
         self._outputs = {}
+        self._bound_arrays = {}
 
     cpdef BlobBuffer _get_input_buffer(self, const string & blob_name):
         cdef BlobBuffer buffer = BlobBuffer()
@@ -113,18 +153,24 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     cpdef async_infer(self, inputs=None):
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     cpdef wait(self, timeout=None):
         if timeout is None:
             timeout = -1
-        return deref(self.impl).wait(<int64_t> timeout)
+        cdef int64_t c_timeout = <int64_t> timeout
+        cdef int status
+        with nogil:
+            status = deref(self.impl).wait(c_timeout)
+        return status
 
     cpdef get_perf_counts(self):
         cdef map[string, C.ProfileInfo] c_profile = deref(self.impl).getPerformanceCounts()
@@ -137,6 +183,92 @@ cdef class InferRequest:
                                          "cpu_time": info.cpu_time}
         return profile
 
+    cpdef get_perf_counts_arrays(self):
+        """The performance counters as the numpy arrays indexed by the layer position, which is the same on every
+        call: "real_time" and "cpu_time" in microseconds, "status" (0 - NOT_RUN, 1 - OPTIMIZED_OUT, 2 - EXECUTED)
+        and "execution_index". The list of the layer "names" is built once and shared by the calls"""
+        with_names = self._perf_names is None
+        deref(self.impl).getPerformanceCountsArrays(self._perf_arrays, with_names)
+        cdef size_t size = self._perf_arrays.status.size()
+        if with_names:
+            self._perf_names = [n.decode() for n in self._perf_arrays.names]
+        elif len(self._perf_names) != size:
+            deref(self.impl).getPerformanceCountsArrays(self._perf_arrays, True)
+            self._perf_names = [n.decode() for n in self._perf_arrays.names]
+            size = self._perf_arrays.status.size()
+
+        real_time = np.empty(size, dtype=np.int64)
+        cpu_time = np.empty(size, dtype=np.int64)
+        status = np.empty(size, dtype=np.int32)
+        execution_index = np.empty(size, dtype=np.uint32)
+        cdef int64_t[:] real_time_v = real_time
+        cdef int64_t[:] cpu_time_v = cpu_time
+        cdef int[:] status_v = status
+        cdef unsigned int[:] execution_index_v = execution_index
+        cdef size_t i
+        for i in range(size):
+            real_time_v[i] = self._perf_arrays.real_time[i]
+            cpu_time_v[i] = self._perf_arrays.cpu_time[i]
+            status_v[i] = self._perf_arrays.status[i]
+            execution_index_v[i] = self._perf_arrays.execution_index[i]
+        return {"names": self._perf_names, "real_time": real_time, "cpu_time": cpu_time, "status": status,
+                "execution_index": execution_index}
+
+    cpdef set_completion_callback(self, py_callback, py_data=None):
+        """Sets the callback called as py_callback(status, py_data) when the async inference of the request is
+        completed. It is called from the thread of the plugin with the GIL taken for the call only"""
+        self._py_callback = py_callback
+        self._py_data = py_data
+        if py_callback is None:
+            deref(self.impl).setCyCallback(NULL, NULL)
+        else:
+            deref(self.impl).setCyCallback(c_completion_callback, <void *> self)
+
+    cpdef set_images(self, str input_name, images):
+        """Sets the list of uint8 HWC images as the batch of the input prepared by IENetwork.set_image_input(), the
+        images are resized and converted to the input blob by the plugin in parallel during the inference. The images
+        are kept referenced by the request until the next images are set"""
+        cdef vector[void *] c_images
+        cdef vector[vector[size_t]] c_shapes
+        cdef vector[size_t] c_shape
+        cdef size_t data
+        for image in images:
+            if not isinstance(image, np.ndarray) or image.dtype != np.uint8 or image.ndim != 3 or \
+                    not image.flags['C_CONTIGUOUS']:
+                raise ValueError("Only C-contiguous uint8 numpy arrays of the HWC layout can be set as images")
+            data = image.ctypes.data
+            c_images.push_back(<void *> data)
+            c_shape.clear()
+            for d in image.shape:
+                c_shape.push_back(d)
+            c_shapes.push_back(c_shape)
+        deref(self.impl).setImages(to_std_string(input_name), c_images, c_shapes)
+        self._bound_arrays[input_name] = list(images)
+
+    cpdef set_blob(self, str blob_name, array):
+        """Binds the caller-owned array as the input or output blob of the request, the request reads or writes
+        the array memory directly. The array must be C-contiguous and have the shape and the type of the blob,
+        it is kept referenced by the request until another array is bound to the blob"""
+        is_input = blob_name in self._inputs
+        if not is_input and blob_name not in self._outputs:
+            raise KeyError("There is no blob with name: {}".format(blob_name))
+        current = self._inputs[blob_name] if is_input else self._outputs[blob_name]
+        if not isinstance(array, np.ndarray) or not array.flags['C_CONTIGUOUS'] or not array.flags['WRITEABLE']:
+            raise ValueError("Only writeable C-contiguous numpy arrays can be bound to the blobs")
+        if array.shape != current.shape or array.dtype != current.dtype:
+            raise ValueError("The array of shape {} and type {} doesn't match the blob of shape {} and type {}".format(
+                array.shape, array.dtype, current.shape, current.dtype))
+        if array.ctypes.data % array.dtype.alignment != 0:
+            raise ValueError("The array data is not aligned to its element type")
+
+        cdef size_t data = array.ctypes.data
+        deref(self.impl).setBlob(to_std_string(blob_name), <void *> data)
+        self._bound_arrays[blob_name] = array
+        if is_input:
+            self._inputs[blob_name] = array
+        else:
+            self._outputs[blob_name] = array
+
     @property
     def inputs(self):
         return self._inputs
@@ -147,7 +279,9 @@ cdef class InferRequest:
 
     def _fill_inputs(self, inputs):
         for k, v in inputs.items():
-            self.inputs[k][:] = v
+            # the bound arrays are the blob memory already
+            if self.inputs[k] is not v:
+                self.inputs[k][:] = v
 
 cdef class IENetwork:
     @property
@@ -167,6 +301,11 @@ cdef class IENetwork:
     def batch_size(self):
         return self.impl.batch_size
 
+    def set_image_input(self, input_name: str, resize_algorithm: str = "bilinear"):
+        """Makes the input take the batches of uint8 images of any size set by InferRequest.set_images(), the images
+        are resized with the "bilinear" or "area" algorithm. Should be called before the network is loaded"""
+        self.impl.setImageInput(input_name.encode(), resize_algorithm.encode())
+
     @batch_size.setter
     def batch_size(self, batch: int):
         if batch <= 0:
@@ -251,7 +390,9 @@ cdef class IEPlugin:
             for k, v in config.items():
                 c_config[to_std_string(k)] = to_std_string(v)
 
-        exec_net.impl = move(self.impl.load(network.impl, num_requests, c_config))
+        # the network is compiled without the GIL, so the other Python threads run meanwhile
+        with nogil:
+            exec_net.impl = move(self.impl.load(network.impl, num_requests, c_config))
 
         requests = []
         for i in range(deref(exec_net.impl).infer_requests.size()):
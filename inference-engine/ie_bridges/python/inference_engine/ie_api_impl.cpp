@@ -6,6 +6,10 @@
 #include "ie_api_impl.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "ie_iinfer_request.hpp"
+#include <chrono>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
 #define stringify( name ) # name
 #define IE_CHECK_CALL(expr) {                       \
     auto ret = (expr);                              \
@@ -144,6 +148,25 @@ void InferenceEnginePython::IENetwork::reshape(const std::map<std::string, std::
     }
 
 }
+void InferenceEnginePython::IENetwork::setImageInput(const std::string &input_name, const std::string &resize_algorithm)
+{
+    std::map<std::string, InferenceEngine::ResizeAlgorithm> algorithm_map = {
+            {"bilinear", InferenceEngine::ResizeAlgorithm::RESIZE_BILINEAR},
+            {"area", InferenceEngine::ResizeAlgorithm::RESIZE_AREA}};
+    auto algorithm = algorithm_map.find(resize_algorithm);
+    if (algorithm == algorithm_map.end())
+        THROW_IE_EXCEPTION << "Unknown resize algorithm: " << resize_algorithm;
+
+    InferenceEngine::InputsDataMap inputsInfo = actual.getInputsInfo();
+    auto input = inputsInfo.find(input_name);
+    if (input == inputsInfo.end())
+        THROW_IE_EXCEPTION << "There is no input with name: " << input_name;
+
+    // the U8 images are resized and converted to the input of the network by the preprocessing of the plugin
+    input->second->setPrecision(InferenceEngine::Precision::U8);
+    input->second->getPreProcess().setResizeAlgorithm(algorithm->second);
+}
+
 InferenceEnginePython::IEPlugin::IEPlugin(const std::string &device, const std::vector<std::string> &plugin_dirs)
 {
 
@@ -219,6 +242,37 @@ void InferenceEnginePython::IEPlugin::addCpuExtension(const std::string &extensi
     IE_CHECK_CALL(actual->AddExtension(extension, &response))
 }
 
+// the peak resident memory of the process, it is not measured on Windows
+static size_t getPeakMemoryKb()
+{
+#ifndef _WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        return static_cast<size_t>(usage.ru_maxrss) / 1024;
+#else
+        return static_cast<size_t>(usage.ru_maxrss);
+#endif
+    }
+#endif
+    return 0;
+}
+
+static void completionCallback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code)
+{
+    InferenceEnginePython::InferRequestWrap *wrap = nullptr;
+    InferenceEngine::ResponseDesc response;
+    request->GetUserData(reinterpret_cast<void **>(&wrap), &response);
+    if (wrap == nullptr)
+        return;
+
+    // the request is given out again only after the user callback has taken its outputs
+    size_t start = wrap->request_queue_ptr->getRequestStart(wrap->index);
+    if (wrap->user_callback)
+        wrap->user_callback(wrap->user_args, static_cast<int>(code));
+    wrap->request_queue_ptr->setRequestIdle(wrap->index, start);
+}
+
 std::unique_ptr<InferenceEnginePython::IEExecNetwork>
 InferenceEnginePython::IEPlugin::load(InferenceEnginePython::IENetwork &net,
                                       int num_requests,
@@ -227,7 +281,11 @@ InferenceEnginePython::IEPlugin::load(InferenceEnginePython::IENetwork &net,
     InferenceEngine::ResponseDesc response;
     auto exec_network = InferenceEnginePython::make_unique<InferenceEnginePython::IEExecNetwork>(net.name, num_requests);
 
+    auto load_start = std::chrono::steady_clock::now();
     IE_CHECK_CALL(actual->LoadNetwork(exec_network->actual, net.actual, config, &response))
+    exec_network->load_time_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - load_start).count();
+    exec_network->peak_memory_kb = getPeakMemoryKb();
     const InferenceEngine::InputsDataMap &inputs_info = net.actual.getInputsInfo();
     const InferenceEngine::OutputsDataMap &outputs_info = net.actual.getOutputsInfo();
 
@@ -235,6 +293,8 @@ InferenceEnginePython::IEPlugin::load(InferenceEnginePython::IENetwork &net,
     for (size_t i = 0; i < num_requests; ++i) {
         InferRequestWrap &infer_request = exec_network->infer_requests[i];
         IE_CHECK_CALL(exec_network->actual->CreateInferRequest(infer_request.request_ptr, &response))
+        IE_CHECK_CALL(infer_request.request_ptr->SetUserData(&infer_request, &response))
+        IE_CHECK_CALL(infer_request.request_ptr->SetCompletionCallback(completionCallback))
 
         for (const auto& input : inputs_info) {
             infer_request.inputs[input.first] = nullptr;
@@ -254,8 +314,76 @@ void InferenceEnginePython::IEPlugin::setConfig(const std::map<std::string, std:
 }
 
 InferenceEnginePython::IEExecNetwork::IEExecNetwork(const std::string &name, size_t num_requests) :
-    infer_requests(num_requests), name(name)
+    infer_requests(num_requests), request_queue_ptr(std::make_shared<IdleInferRequestQueue>(num_requests)), name(name)
+{
+    for (size_t i = 0; i < num_requests; ++i) {
+        infer_requests[i].index = i;
+        infer_requests[i].request_queue_ptr = request_queue_ptr;
+    }
+}
+
+int InferenceEnginePython::IEExecNetwork::getIdleRequestId()
+{
+    return request_queue_ptr->getIdleRequestId();
+}
+
+int InferenceEnginePython::IEExecNetwork::waitAll(int64_t timeout)
+{
+    return request_queue_ptr->waitAll(timeout);
+}
+
+InferenceEnginePython::IdleInferRequestQueue::IdleInferRequestQueue(size_t requests_num) : starts(requests_num, 0)
+{
+    for (size_t i = 0; i < requests_num; ++i)
+        idle_ids.push_back(i);
+}
+
+void InferenceEnginePython::IdleInferRequestQueue::setRequestIdle(size_t index, size_t start)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (starts[index] != start || std::find(idle_ids.begin(), idle_ids.end(), index) != idle_ids.end())
+            return;
+        idle_ids.push_back(index);
+    }
+    cv.notify_all();
+}
+
+size_t InferenceEnginePython::IdleInferRequestQueue::setRequestBusy(size_t index)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    idle_ids.remove(index);
+    return ++starts[index];
+}
+
+size_t InferenceEnginePython::IdleInferRequestQueue::getRequestStart(size_t index)
 {
+    std::lock_guard<std::mutex> lock(mutex);
+    return starts[index];
+}
+
+int InferenceEnginePython::IdleInferRequestQueue::getIdleRequestId()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return idle_ids.empty() ? -1 : static_cast<int>(idle_ids.front());
+}
+
+int InferenceEnginePython::IdleInferRequestQueue::waitAll(int64_t timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    auto all_idle = [this] { return idle_ids.size() == starts.size(); };
+    if (timeout < 0) {
+        cv.wait(lock, all_idle);
+    } else if (!cv.wait_for(lock, std::chrono::milliseconds(timeout), all_idle)) {
+        return static_cast<int>(InferenceEngine::StatusCode::RESULT_NOT_READY);
+    }
+    return static_cast<int>(InferenceEngine::StatusCode::OK);
+}
+
+void InferenceEnginePython::InferRequestWrap::setCyCallback(cy_callback callback, void *args)
+{
+    user_callback = callback;
+    user_args = args;
 }
 
 void InferenceEnginePython::IEExecNetwork::infer()
@@ -276,6 +404,69 @@ InferenceEngine::Blob::Ptr &InferenceEnginePython::InferRequestWrap::getOutputBl
     return outputs.at(blob_name);
 }
 
+template <typename T>
+static InferenceEngine::Blob::Ptr wrapMemory(const InferenceEngine::TensorDesc &desc, void *data) {
+    return InferenceEngine::make_shared_blob<T>(desc, reinterpret_cast<T *>(data));
+}
+
+void InferenceEnginePython::InferRequestWrap::setBlob(const std::string &blob_name, void *data)
+{
+    // the caller memory replaces the blob of the request, so it must have the layout and the precision of that blob
+    auto input = inputs.find(blob_name);
+    InferenceEngine::Blob::Ptr &blob = input != inputs.end() ? input->second : outputs.at(blob_name);
+    const InferenceEngine::TensorDesc &desc = blob->getTensorDesc();
+
+    InferenceEngine::Blob::Ptr wrapped;
+    switch (desc.getPrecision()) {
+        case InferenceEngine::Precision::FP32:
+            wrapped = wrapMemory<float>(desc, data);
+            break;
+        case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::Q78:
+        case InferenceEngine::Precision::I16:
+            wrapped = wrapMemory<int16_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::U16:
+            wrapped = wrapMemory<uint16_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::U8:
+            wrapped = wrapMemory<uint8_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::I8:
+            wrapped = wrapMemory<int8_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::I32:
+            wrapped = wrapMemory<int32_t>(desc, data);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported precision of the blob " << blob_name;
+    }
+
+    InferenceEngine::ResponseDesc response;
+    IE_CHECK_CALL(request_ptr->SetBlob(blob_name.c_str(), wrapped, &response))
+    blob = wrapped;
+}
+
+void InferenceEnginePython::InferRequestWrap::setImages(const std::string &blob_name, const std::vector<void *> &images,
+                                                       const std::vector<std::vector<size_t>> &shapes)
+{
+    // every HWC image is the NHWC ROI of its batch slot, the plugin resizes and converts all of them
+    // into the input blob in parallel on the inference
+    std::vector<InferenceEngine::Blob::Ptr> rois;
+    rois.reserve(images.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        const std::vector<size_t> &hwc = shapes.at(i);
+        if (hwc.size() != 3)
+            THROW_IE_EXCEPTION << "The image " << i << " is not the HWC array";
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::U8, {1, hwc[2], hwc[0], hwc[1]},
+                                         InferenceEngine::Layout::NHWC);
+        rois.push_back(InferenceEngine::make_shared_blob<uint8_t>(desc, reinterpret_cast<uint8_t *>(images[i])));
+    }
+
+    InferenceEngine::ResponseDesc response;
+    IE_CHECK_CALL(request_ptr->SetRoiBlobs(blob_name.c_str(), rois, &response))
+}
+
 std::vector<std::string> InferenceEnginePython::InferRequestWrap::getInputsList() {
     std::vector<std::string> inputs_list;
     inputs_list.reserve(inputs.size());
@@ -296,12 +487,20 @@ std::vector<std::string> InferenceEnginePython::InferRequestWrap::getOutputsList
 
 void InferenceEnginePython::InferRequestWrap::infer() {
     InferenceEngine::ResponseDesc responseDesc;
+    size_t start = request_queue_ptr->setRequestBusy(index);
     request_ptr->Infer(&responseDesc);
+    request_queue_ptr->setRequestIdle(index, start);
 }
 
 void InferenceEnginePython::InferRequestWrap::infer_async() {
     InferenceEngine::ResponseDesc responseDesc;
-    request_ptr->StartAsync(&responseDesc);
+    size_t start = request_queue_ptr->setRequestBusy(index);
+    InferenceEngine::StatusCode code = request_ptr->StartAsync(&responseDesc);
+    // the completion callback is not called for the request which has not been started
+    if (code != InferenceEngine::StatusCode::OK && code != InferenceEngine::StatusCode::REQUEST_BUSY) {
+        request_queue_ptr->setRequestIdle(index, start);
+        THROW_IE_EXCEPTION << responseDesc.msg;
+    }
 }
 
 int InferenceEnginePython::InferRequestWrap::wait(int64_t timeout) {
@@ -340,6 +539,33 @@ std::map<std::string, InferenceEnginePython::ProfileInfo> InferenceEnginePython:
     return perf_map;
 }
 
+void InferenceEnginePython::InferRequestWrap::getPerformanceCountsArrays(PerfCountsArrays &arrays, bool with_names)
+{
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perf_counts;
+    InferenceEngine::ResponseDesc response;
+    request_ptr->GetPerformanceCounts(perf_counts, &response);
+
+    // the map is ordered by the names, so a layer keeps its position between the calls
+    const size_t size = perf_counts.size();
+    arrays.names.clear();
+    if (with_names)
+        arrays.names.reserve(size);
+    arrays.status.resize(size);
+    arrays.real_time.resize(size);
+    arrays.cpu_time.resize(size);
+    arrays.execution_index.resize(size);
+    size_t i = 0;
+    for (const auto &it : perf_counts) {
+        if (with_names)
+            arrays.names.push_back(it.first);
+        arrays.status[i] = static_cast<int>(it.second.status);
+        arrays.real_time[i] = it.second.realTime_uSec;
+        arrays.cpu_time[i] = it.second.cpu_uSec;
+        arrays.execution_index[i] = it.second.execution_index;
+        i++;
+    }
+}
+
 std::string InferenceEnginePython::get_version() {
     auto version = InferenceEngine::GetInferenceEngineVersion();
     std::string version_str = std::to_string(version->apiVersion.major) + ".";
@@ -12,6 +12,10 @@
 #include <iostream>
 #include <algorithm>
 #include <sstream>
+#include <list>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
 #include "ie_extension.h"
 
 namespace InferenceEnginePython {
@@ -42,6 +46,17 @@ struct ProfileInfo {
     long long cpu_time;
     unsigned execution_index;
 };
+/**
+ * The performance counters of the layers as arrays indexed by the same layer position on every call,
+ * the names are filled only on request
+ */
+struct PerfCountsArrays {
+    std::vector<std::string> names;
+    std::vector<int> status;
+    std::vector<int64_t> real_time;
+    std::vector<int64_t> cpu_time;
+    std::vector<unsigned> execution_index;
+};
 struct IENetwork {
     InferenceEngine::CNNNetwork actual;
     std::string name;
@@ -56,6 +71,7 @@ struct IENetwork {
     void addOutputs(const std::vector<std::string> &out_layers, const std::string &precision);
     std::map<std::string, InferenceEnginePython::IENetLayer> getLayers();
     void reshape(const std::map<std::string, std::vector<size_t>> & input_shapes);
+    void setImageInput(const std::string &input_name, const std::string &resize_algorithm);
 };
 
 struct IENetReader {
@@ -63,30 +79,71 @@ struct IENetReader {
     std::vector<std::pair<std::string, std::string>> getLayers();
 };
 
+/**
+ * The ids of the requests of the executable network which are not running, the requests are taken by the infer
+ * calls and returned by their completion callbacks. The starts of every request are counted, so the request started
+ * again from its own callback is not returned by that callback
+ */
+struct IdleInferRequestQueue {
+    using Ptr = std::shared_ptr<IdleInferRequestQueue>;
+
+    std::list<size_t> idle_ids;
+    std::vector<size_t> starts;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    explicit IdleInferRequestQueue(size_t requests_num);
+    void setRequestIdle(size_t index, size_t start);
+    size_t setRequestBusy(size_t index);
+    size_t getRequestStart(size_t index);
+    int getIdleRequestId();
+    int waitAll(int64_t timeout);
+};
+
 struct InferRequestWrap {
+    using cy_callback = void (*)(void *, int);
+
     InferenceEngine::IInferRequest::Ptr request_ptr;
     InferenceEngine::BlobMap inputs;
     InferenceEngine::BlobMap outputs;
 
+    size_t index = 0;
+    IdleInferRequestQueue::Ptr request_queue_ptr;
+    // the completion callback of the Python request, it is called from the thread completing the request
+    cy_callback user_callback = nullptr;
+    void *user_args = nullptr;
+
+    void setCyCallback(cy_callback callback, void *args);
     void infer();
     void infer_async();
     int  wait(int64_t timeout);
     InferenceEngine::Blob::Ptr &getInputBlob(const std::string &blob_name);
     InferenceEngine::Blob::Ptr &getOutputBlob(const std::string &blob_name);
+    void setBlob(const std::string &blob_name, void *data);
+    void setImages(const std::string &blob_name, const std::vector<void *> &images,
+                   const std::vector<std::vector<size_t>> &shapes);
     std::vector<std::string> getInputsList();
     std::vector<std::string> getOutputsList();
     std::map<std::string, InferenceEnginePython::ProfileInfo> getPerformanceCounts();
+    void getPerformanceCountsArrays(PerfCountsArrays &arrays, bool with_names);
 };
 
 
 struct IEExecNetwork {
     InferenceEngine::IExecutableNetwork::Ptr actual;
     std::vector<InferRequestWrap> infer_requests;
+    IdleInferRequestQueue::Ptr request_queue_ptr;
     IEExecNetwork(const std::string &name, size_t num_requests);
 
+    int getIdleRequestId();
+    int waitAll(int64_t timeout);
+
     std::string name;
     int next_req_index = 0;
     bool async;
+    // the wall time of LoadNetwork and the peak resident memory of the process after it
+    double load_time_ms = 0;
+    size_t peak_memory_kb = 0;
     void infer();
 };
 
@@ -64,8 +64,19 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         map[string, Blob.Ptr] custom_blobs;
 
 
+    cdef cppclass PerfCountsArrays:
+        vector[string] names
+        vector[int] status
+        vector[int64_t] real_time
+        vector[int64_t] cpu_time
+        vector[unsigned int] execution_index
+
     cdef cppclass IEExecNetwork:
         vector[InferRequestWrap] infer_requests
+        double load_time_ms
+        size_t peak_memory_kb
+        int getIdleRequestId() except +
+        int waitAll(int64_t timeout) nogil except +
 
     cdef cppclass IENetwork:
         string name
@@ -78,11 +89,12 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void setBatch(size_t size) except +
         void setLayerParams(map[string, map[string, string]] params_map) except +
         void reshape(map[string, vector[size_t]] input_shapes) except +
+        void setImageInput(const string &input_name, const string &resize_algorithm) except +
 
     cdef cppclass IEPlugin:
         IEPlugin() except +
         IEPlugin(const string &, const vector[string] &) except +
-        unique_ptr[IEExecNetwork] load(IENetwork & net, int num_requests, const map[string, string]& config) except +
+        unique_ptr[IEExecNetwork] load(IENetwork & net, int num_requests, const map[string, string]& config) nogil except +
         void addCpuExtension(const string &) except +
         void setConfig(const map[string, string]&) except +
         void setInitialAffinity(IENetwork & net) except +
@@ -98,10 +110,14 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         vector[string] getOutputsList() except +
         Blob.Ptr& getOutputBlob(const string &blob_name) except +
         Blob.Ptr& getInputBlob(const string &blob_name) except +
+        void setBlob(const string &blob_name, void *data) except +
+        void setCyCallback(void (*)(void*, int), void *) except +
+        void setImages(const string &blob_name, const vector[void *] &images, const vector[vector[size_t]] &shapes) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        void getPerformanceCountsArrays(PerfCountsArrays &arrays, bool with_names) except +
+        void infer() nogil except +
+        void infer_async() nogil except +
+        int wait(int64_t timeout) nogil except +
 
     cdef T* get_buffer[T](Blob &)
 
@@ -11,7 +11,9 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include "../ie_common.h"
 #include "../ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -30,6 +32,9 @@ namespace CLDNNConfigParams {
 * as defined in https://www.khronos.org/registry/OpenCL/specs/opencl-2.1-extensions.pdf
 * this option should be used with an unsigned integer value (1 is lowest priority)
 * 0 means no priority hint is set and default queue is created.
+* The key can be given to LoadNetwork(), each executable network then infers on its own queue of the priority,
+* so the requests of a latency-critical network preempt the work of the networks with lower priority on the device.
+* The networks of KEY_CLDNN_SHARED_ENGINE run on the queue of the first loaded network.
 */
 DECLARE_CLDNN_CONFIG_KEY(PLUGIN_PRIORITY);
 
@@ -38,6 +43,7 @@ DECLARE_CLDNN_CONFIG_KEY(PLUGIN_PRIORITY);
 * as defined in https://www.khronos.org/registry/OpenCL/specs/opencl-2.1-extensions.pdf,
 * chapter 9.19. This option should be used with an unsigned integer value (1 is lowest energy consumption)
 * 0 means no throttle hint is set and default queue created.
+* As KEY_CLDNN_PLUGIN_PRIORITY, the key can be given to LoadNetwork() for the queue of the executable network.
 */
 DECLARE_CLDNN_CONFIG_KEY(PLUGIN_THROTTLE);
 
@@ -47,6 +53,19 @@ DECLARE_CLDNN_CONFIG_KEY(PLUGIN_THROTTLE);
 */
 DECLARE_CLDNN_CONFIG_KEY(MEM_POOL);
 
+/**
+* @brief This key limits the memory the clDNN memory pool allocates for the intermediate buffers of the network.
+* The value is a number of megabytes, 0 by default (means no limit). Near the limit the pool reuses the buffers
+* more aggressively, the network which does not fit into the limit fails to load. The key requires KEY_CLDNN_MEM_POOL.
+*/
+DECLARE_CLDNN_CONFIG_KEY(MEM_POOL_LIMIT);
+
+/**
+* @brief This key controls the out-of-order execution of the OpenCL queue, the independent branches of the network
+* run concurrently. Turned on by default, the devices and the drivers without the support execute the kernels in order.
+*/
+DECLARE_CLDNN_CONFIG_KEY(OUT_OF_ORDER_QUEUE);
+
 /**
 * @brief This key defines the directory name to which clDNN graph visualization will be dumped.
 */
@@ -57,5 +76,140 @@ DECLARE_CLDNN_CONFIG_KEY(GRAPH_DUMPS_DIR);
 */
 DECLARE_CLDNN_CONFIG_KEY(SOURCES_DUMPS_DIR);
 
+/**
+* @brief This key defines the directory in which the compiled OpenCL programs are cached.
+* The programs found in the cache are loaded instead of being compiled again, so the network loads faster.
+*/
+DECLARE_CLDNN_CONFIG_KEY(KERNELS_CACHE_DIR);
+
+/**
+* @brief This key gives the clDNN plugin the OpenCL context (cl_context) of the application, the networks run in it.
+* The input blobs of type CLBufferBlob which keep their data in the buffers of the context are used without copying.
+* The value is the handle of the context converted by SharedContextConfigValue() from cldnn_remote_blob.hpp.
+*/
+DECLARE_CLDNN_CONFIG_KEY(SHARED_CONTEXT);
+
+/**
+* @brief This key gives the name of the clDNN engine shared by all networks loaded with the same name.
+* The networks of the engine allocate their intermediate buffers from its memory pool and reuse the buffers of each
+* other, so more networks fit into the device memory. The networks of the engine infer the requests one by one on
+* a single executor, KEY_CLDNN_THROUGHPUT_STREAMS is ignored. The engine is configured by the first loaded network.
+* The key requires KEY_CLDNN_MEM_POOL, without the name each network has its own engine.
+*/
+DECLARE_CLDNN_CONFIG_KEY(SHARED_ENGINE);
+
+/**
+* @brief This key defines the number of the streams, the copies of the network which infer the requests concurrently
+* on their own OpenCL queues. The streams share the weights of the network. The value is a positive number, 1 by default.
+* The key is ignored with KEY_EXCLUSIVE_ASYNC_REQUESTS, and it cannot be used with the dynamic batch.
+* With several devices in PluginConfigParams::KEY_DEVICE_ID (the comma separated indices of the GPU devices, e.g. "0,1",
+* "0" by default) the streams are spread over the devices in turn and each device runs one stream at least, the first
+* device runs the network with KEY_EXCLUSIVE_ASYNC_REQUESTS, KEY_CLDNN_SHARED_ENGINE or KEY_CLDNN_SHARED_CONTEXT.
+*/
+DECLARE_CLDNN_CONFIG_KEY(THROUGHPUT_STREAMS);
+
+/**
+* @brief This key defines the stream of a new infer request, the request is inferred by it until it is released.
+* CLDNN_BALANCER_ROUND_ROBIN (default) takes the streams in turn, CLDNN_BALANCER_LEAST_LOADED takes the stream with
+* the fewest requests which are not released yet, so the streams of the released requests are filled first.
+*/
+DECLARE_CLDNN_CONFIG_KEY(BALANCER);
+
+DECLARE_CLDNN_CONFIG_VALUE(BALANCER_ROUND_ROBIN);
+DECLARE_CLDNN_CONFIG_VALUE(BALANCER_LEAST_LOADED);
+
+/**
+* @brief This key moves the copy of the outputs to the blobs of the asynchronous requests out of the inference:
+* the device (padded) data are read right after the network and the next request of the stream starts on the device
+* while the completion thread removes the padding and writes the blobs. The FP32 outputs of the FP16 networks are
+* read in FP16 and converted by the completion thread, so half of the data are read from the device.
+* Turned off by default, the synchronous Infer() always copies the outputs within the inference.
+*/
+DECLARE_CLDNN_CONFIG_KEY(PIPELINED_OUTPUTS);
+
+/**
+* @brief This key defines the batch of the micro batches the batch of the request is inferred by. The network is
+* compiled for the micro batch and its two copies on their own OpenCL queues infer the micro batches in turn, so the
+* transfer of the inputs and the outputs of one micro batch overlaps the execution of the other one, and the device
+* keeps the intermediate buffers of two micro batches. The value divides the batch of the network, 0 (default) infers
+* the whole batch at once. The key is ignored with the dynamic batch and for the networks which mix the images of
+* the batch (e.g. DetectionOutput or Reshape of the batch), the input OpenCL buffer blobs are not supported with it.
+*/
+DECLARE_CLDNN_CONFIG_KEY(MICRO_BATCH);
+
+/**
+* @brief This key makes the device find the top-k features of the outputs (of each pixel of the NCHW outputs), so
+* the indices and the scores of the largest features are read instead of the whole outputs (e.g. of the classification
+* or the segmentation). The value is the comma separated list of the output names with the number of the features,
+* e.g. "prob:5,seg:1". The output of the name is replaced by the FP32 indices of the k features in descending order
+* of the scores, with the C dim equal to k, and the output of the name with the "_top_k_scores" suffix gives the scores.
+*/
+DECLARE_CLDNN_CONFIG_KEY(OUTPUT_TOP_K);
+
+/**
+* @brief This key defines the number of the input shapes the executable network keeps compiled for
+* IExecutableNetwork::Reshape(), the least recently used one is released when a new shape is compiled.
+* The value is a positive number, 4 by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(SHAPE_VARIANTS);
+
+/**
+* @brief This key makes LoadNetwork() return before the kernels of the network are compiled, they are compiled by
+* the background thread. The value is the listener converted by CompilationListenerConfigValue(), the plugin calls it
+* when the network is ready or its compilation fails. The calls of the executable network which need the compiled
+* network (e.g. CreateInferRequest()) wait for the compilation and throw its error.
+*/
+DECLARE_CLDNN_CONFIG_KEY(COMPILATION_LISTENER);
+
+/**
+* @brief This key makes the clDNN engine keep the host copies of the weights reordered to the layouts of the kernels,
+* so the networks loaded later with the same engine (e.g. the streams or KEY_CLDNN_SHARED_ENGINE) take them instead
+* of reordering the weights again, and Export() stores them with the network for the ImportNetwork() on the same
+* device. The copies take host memory of the size of the reordered weights. PluginConfigParams::YES or
+* PluginConfigParams::NO (default).
+*/
+DECLARE_CLDNN_CONFIG_KEY(WEIGHTS_CACHE);
+
+/**
+* @brief This key makes the device pre-process the inputs with a resize algorithm (see PreProcessInfo::setResizeAlgorithm):
+* the frame of the blob given to SetBlob() (e.g. the ROI blob of make_shared_blob(frame, roi)) is copied to the device
+* as it is, and a single kernel at the head of the network crops the ROI, resizes it (RESIZE_BILINEAR or RESIZE_AREA)
+* to the input of the network, subtracts the mean values or the mean image, multiplies by the stdScale of the channels
+* and converts the data to the precision of the network, so the host does not resize. The value is the size of the
+* largest frame "<width>x<height>", e.g. "1920x1080", the device memory of the frame is allocated for it; the blobs are
+* U8 or FP32 of the input precision with the NCHW or NHWC layout. PluginConfigParams::NO (default) resizes by the host.
+* The key is not supported with the dynamic batch, KEY_CLDNN_MICRO_BATCH is ignored for such networks.
+*/
+DECLARE_CLDNN_CONFIG_KEY(DEVICE_PREPROCESSING);
+
+/**
+* @brief The listener of the network compiled in the background, see KEY_CLDNN_COMPILATION_LISTENER.
+* It must be valid until the listener is called.
+*/
+class ICompilationListener {
+public:
+    /**
+    * @brief The plugin calls this method by the thread which compiled the network
+    * @param status OK (0) if the network is ready, GENERAL_ERROR if its compilation failed
+    * @param msg Null terminated error message, empty with OK
+    */
+    virtual void onCompiled(StatusCode status, const char *msg) noexcept = 0;
+};
+
+/**
+* @brief Returns the value of KEY_CLDNN_COMPILATION_LISTENER for the listener
+*/
+inline std::string CompilationListenerConfigValue(ICompilationListener *listener) {
+    return std::to_string(reinterpret_cast<uintptr_t>(listener));
+}
+
+/**
+* @brief The value of PluginConfigParams::KEY_TUNING_MODE which tunes the kernels as PluginConfigParams::TUNING_CREATE
+* and also chooses the layouts of the whole network by executing it with each of them, so the cost of the reorders
+* between the layers is taken into account. The chosen layouts are stored in the tuning file and used with
+* PluginConfigParams::TUNING_USE_EXISTING.
+*/
+DECLARE_CLDNN_CONFIG_VALUE(TUNING_CREATE_NETWORK);
+
 }  // namespace CLDNNConfigParams
 }  // namespace InferenceEngine
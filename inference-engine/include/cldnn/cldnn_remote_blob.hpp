@@ -0,0 +1,172 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header for the blobs which keep their data in the OpenCL buffers shared with the clDNN plugin
+ *
+ * @file cldnn_remote_blob.hpp
+ */
+#pragma once
+
+#include <CL/cl.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include "../ie_blob.h"
+#include "../ie_allocator.hpp"
+
+namespace InferenceEngine {
+
+namespace CLDNNConfigParams {
+
+/**
+ * @brief Returns the value of KEY_CLDNN_SHARED_CONTEXT for the OpenCL context
+ * @param context The OpenCL context the plugin runs the networks in
+ */
+inline std::string SharedContextConfigValue(cl_context context) {
+    return std::to_string(reinterpret_cast<uintptr_t>(context));
+}
+
+}  // namespace CLDNNConfigParams
+
+/**
+ * @brief The allocator which maps the OpenCL buffer of CLBufferBlob to the host memory.
+ * It is used only when the blob data are accessed by the host, the clDNN plugin reads and writes the buffer in place
+ */
+class CLBufferAllocator : public IAllocator {
+public:
+    /**
+     * @param queue The OpenCL queue which maps the buffer, it belongs to the context of the buffer
+     */
+    explicit CLBufferAllocator(cl_command_queue queue) : _queue(queue) {
+        clRetainCommandQueue(_queue);
+    }
+
+    void *lock(void *handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_lockCount == 0) {
+            cl_mem buffer = static_cast<cl_mem>(handle);
+            size_t size = 0;
+            if (clGetMemObjectInfo(buffer, CL_MEM_SIZE, sizeof(size), &size, nullptr) != CL_SUCCESS) {
+                return nullptr;
+            }
+            // the data are always mapped for writing, the lock for reading may be followed by the one for writing
+            cl_int status = CL_SUCCESS;
+            _mapped = clEnqueueMapBuffer(_queue, buffer, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0, size,
+                                         0, nullptr, nullptr, &status);
+            if (status != CL_SUCCESS) {
+                _mapped = nullptr;
+                return nullptr;
+            }
+        }
+        _lockCount++;
+        return _mapped;
+    }
+
+    void unlock(void *handle) noexcept override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_lockCount == 0 || --_lockCount != 0) {
+            return;
+        }
+        // the plugin uses the buffer in its own queue, so the unmapping is finished here
+        clEnqueueUnmapMemObject(_queue, static_cast<cl_mem>(handle), _mapped, 0, nullptr, nullptr);
+        clFinish(_queue);
+        _mapped = nullptr;
+    }
+
+    void *alloc(size_t) noexcept override {
+        return nullptr;  // the buffer is allocated by the user
+    }
+
+    bool free(void *) noexcept override {
+        return false;  // the buffer is released by CLBufferBlob
+    }
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+protected:
+    ~CLBufferAllocator() override {
+        clReleaseCommandQueue(_queue);
+    }
+
+private:
+    cl_command_queue _queue;
+    std::mutex _mutex;
+    unsigned _lockCount = 0;
+    void *_mapped = nullptr;
+};
+
+/**
+ * @brief The blob which keeps its data in an OpenCL buffer of the context given to the clDNN plugin by
+ * KEY_CLDNN_SHARED_CONTEXT. The plugin takes such an input blob in place: the buffer is neither mapped nor copied
+ */
+class CLBufferBlob : public Blob {
+public:
+    /**
+     * @brief A smart pointer to the CLBufferBlob object
+     */
+    using Ptr = std::shared_ptr<CLBufferBlob>;
+
+    /**
+     * @param tensorDesc The description of the data in the buffer
+     * @param buffer The OpenCL buffer of the shared context, the blob retains it
+     * @param queue The OpenCL queue which maps the buffer when the blob data are accessed by the host
+     */
+    CLBufferBlob(const TensorDesc &tensorDesc, cl_mem buffer, cl_command_queue queue)
+            : Blob(tensorDesc), _buffer(buffer),
+              _allocator(new CLBufferAllocator(queue), [](IAllocator *allocator) { allocator->Release(); }) {
+        clRetainMemObject(_buffer);
+    }
+
+    CLBufferBlob(const CLBufferBlob &) = delete;
+    CLBufferBlob &operator=(const CLBufferBlob &) = delete;
+
+    ~CLBufferBlob() override {
+        clReleaseMemObject(_buffer);
+    }
+
+    /**
+     * @brief Returns the OpenCL buffer of the blob
+     */
+    cl_mem getCLBuffer() const noexcept {
+        return _buffer;
+    }
+
+    size_t element_size() const noexcept override {
+        return tensorDesc.getPrecision().size();
+    }
+
+    void allocate() noexcept override {}
+
+    bool deallocate() noexcept override {
+        return false;
+    }
+
+    LockedMemory<void> buffer() noexcept override {
+        return LockedMemory<void>(_allocator.get(), _buffer, 0);
+    }
+
+    LockedMemory<const void> cbuffer() const noexcept override {
+        return LockedMemory<const void>(_allocator.get(), _buffer, 0);
+    }
+
+protected:
+    const std::shared_ptr<IAllocator> &getAllocator() const noexcept override {
+        return _allocator;
+    }
+
+    void *getHandle() const noexcept override {
+        return _buffer;
+    }
+
+private:
+    cl_mem _buffer;
+    std::shared_ptr<IAllocator> _allocator;
+};
+
+}  // namespace InferenceEngine
@@ -100,6 +100,25 @@ public:
         CALL_STATUS_FNC(GetMappedTopology, deployedTopology);
     }
 
+    /**
+    * @brief Changes the shapes of the network inputs without loading the network again
+    * @param inputShapes Map of pairs: name of the input and its new shape
+    */
+    void Reshape(const std::map<std::string, SizeVector> &inputShapes) {
+        CALL_STATUS_FNC(Reshape, inputShapes);
+    }
+
+    /**
+    * @brief Wraps original method
+    * IExecutableNetwork::GetExecutorMetrics
+    * @return Map of pairs: name of the executor and its metrics
+    */
+    std::map<std::string, ExecutorMetrics> GetExecutorMetrics() const {
+        std::map<std::string, ExecutorMetrics> metrics;
+        CALL_STATUS_FNC(GetExecutorMetrics, metrics);
+        return metrics;
+    }
+
     /**
     * cast operator is used when this wrapper initialized by LoadNetwork
     * @return
@@ -12,6 +12,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include "ie_iinfer_request.hpp"
 #include "details/ie_exception_conversion.hpp"
 
@@ -94,6 +95,79 @@ public:
         return data;
     }
 
+    /**
+     * @brief Wraps original method
+     * IInferRequest::SetBlobByIndex
+     * @param index Index of input or output blob: the inputs go first in the order of the names, the outputs follow
+     * @param data Reference to input or output blob.
+     */
+    void SetBlob(size_t index, const Blob::Ptr &data) {
+        CALL_STATUS_FNC(SetBlobByIndex, index, data);
+    }
+
+    /**
+     * @brief Wraps original method
+     * IInferRequest::GetBlobByIndex
+     */
+    Blob::Ptr GetBlob(size_t index) {
+        Blob::Ptr data;
+        CALL_STATUS_FNC(GetBlobByIndex, index, data);
+        std::string error = "Internal error: blob with index " + std::to_string(index) + " is not allocated!";
+        auto blobPtr = data.get();
+        if (blobPtr == nullptr) THROW_IE_EXCEPTION << error;
+        if (blobPtr->buffer() == nullptr) THROW_IE_EXCEPTION << error;
+        return data;
+    }
+
+    /**
+     * @brief Wraps original method
+     * IInferRequest::SetRoiBlobs
+     * @param name Name of the input
+     * @param rois The ROI blobs to be pre-processed into the batch slots of the input.
+     */
+    void SetRoiBlobs(const std::string &name, const std::vector<Blob::Ptr> &rois) {
+        CALL_STATUS_FNC(SetRoiBlobs, name.c_str(), rois);
+    }
+
+    /**
+     * @brief Wraps original method
+     * IInferRequest::SetSkippedOutputs
+     * @param names Names of the outputs which are not computed by the following inferences.
+     */
+    void SetSkippedOutputs(const std::vector<std::string> &names) {
+        CALL_STATUS_FNC(SetSkippedOutputs, names);
+    }
+
+    /**
+     * @brief Wraps original method
+     * IInferRequest::IsZeroCopyBlob
+     * @param name Name of input or output blob.
+     * @param data Blob to check.
+     * @return true if the blob set by SetBlob() is used by the plugin without copying
+     */
+    bool IsZeroCopyBlob(const std::string &name, const Blob::Ptr &data) {
+        bool zeroCopy = false;
+        CALL_STATUS_FNC(IsZeroCopyBlob, name.c_str(), data, zeroCopy);
+        return zeroCopy;
+    }
+
+    /**
+     * @brief Wraps original method
+     * IInferRequest::Cancel
+     */
+    void Cancel() {
+        CALL_STATUS_FNC_NO_ARGS(Cancel);
+    }
+
+    /**
+     * @brief Wraps original method
+     * IInferRequest::SetDeadline
+     * @param millis_timeout The time in milliseconds the following inferences are given, 0 disables the deadline.
+     */
+    void SetDeadline(int64_t millis_timeout) {
+        CALL_STATUS_FNC(SetDeadline, millis_timeout);
+    }
+
     /**
      * @brief Wraps original method
      * IInferRequest::Infer
@@ -112,6 +186,16 @@ public:
         return perfMap;
     }
 
+    /**
+     * @brief Wraps original method
+     * IInferRequest::GetTimings
+     */
+    InferRequestTimings GetTimings() const {
+        InferRequestTimings timings;
+        CALL_STATUS_FNC(GetTimings, timings);
+        return timings;
+    }
+
     /**
      * @brief Sets input data to infer
      * @note: Memory allocation doesn't happen
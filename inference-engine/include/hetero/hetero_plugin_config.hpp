@@ -20,6 +20,7 @@ namespace InferenceEngine {
 namespace HeteroConfigParams {
 
 #define HETERO_CONFIG_KEY(name) InferenceEngine::HeteroConfigParams::_CONFIG_KEY(HETERO_##name)
+#define HETERO_CONFIG_VALUE(name) InferenceEngine::HeteroConfigParams::HETERO_##name
 #define DECLARE_HETERO_CONFIG_KEY(name) DECLARE_CONFIG_KEY(HETERO_##name)
 #define DECLARE_HETERO_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(HETERO_##name)
 
@@ -30,5 +31,65 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for the number of the frames the subgraphs of the network run in a pipeline.
+ * The executable network holds the given number of the sets of the subgraph requests and their intermediate blobs,
+ * so the subgraph of one frame runs on its device while the next subgraph of the previous frame runs on another one.
+ * The requests of the network share the sets, a request waits for a free one when all of them are busy.
+ * This option should be used with an unsigned integer value, 0 (default) disables the pipeline
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_DEPTH);
+
+/**
+ * @brief The key for the policy which sets the affinities of the layers by the devices of TARGET_FALLBACK.
+ * This option should be used with values:
+ * HETERO_CONFIG_VALUE(AFFINITY_FIRST_SUPPORTED) (default) - the layer runs on the first device which supports it
+ * HETERO_CONFIG_VALUE(AFFINITY_MIN_COST) - the devices of the layers minimize the estimated cost of the layers
+ * and of the copies of the blobs between the subgraphs
+ */
+DECLARE_HETERO_CONFIG_KEY(AFFINITY_POLICY);
+DECLARE_HETERO_CONFIG_VALUE(AFFINITY_FIRST_SUPPORTED);
+DECLARE_HETERO_CONFIG_VALUE(AFFINITY_MIN_COST);
+
+/**
+ * @brief The key for the relative speeds of the devices used by HETERO_CONFIG_VALUE(AFFINITY_MIN_COST),
+ * the value is the list of the devices with their speeds, e.g. "GPU:4,CPU:1", the speed of a missing device is 1
+ */
+DECLARE_HETERO_CONFIG_KEY(DEVICE_SPEEDS);
+
+/**
+ * @brief The key for the cost of the element of the blob copied between the subgraphs used by
+ * HETERO_CONFIG_VALUE(AFFINITY_MIN_COST), relative to the cost of a multiply-accumulate on the device of the speed 1.
+ * This option should be used with a non-negative float value, 10 by default
+ */
+DECLARE_HETERO_CONFIG_KEY(TRANSFER_COST);
+
+/**
+ * @brief The key for the minimal number of the layers of a subgraph set by HETERO_CONFIG_VALUE(AFFINITY_MIN_COST),
+ * the layers of a smaller subgraph are moved to the device of an adjacent one which supports all of them.
+ * This option should be used with an unsigned integer value, 1 (default) keeps the subgraphs of any size
+ */
+DECLARE_HETERO_CONFIG_KEY(MIN_SUBGRAPH_SIZE);
+
+/**
+ * @brief The key for the file of the subgraphs the default fallback policy has split the network to.
+ * The file is read when it was written for the same layers, TARGET_FALLBACK and affinity options, so the loading
+ * skips the queries of the devices and the splitting, otherwise the file is written after the splitting.
+ * This option should be used with the path of the file, the subgraphs aren't cached by default
+ */
+DECLARE_HETERO_CONFIG_KEY(SPLIT_CACHE_FILE);
+
+/**
+ * @brief The key for the data-parallel mode: the whole network is loaded on each device of TARGET_FALLBACK
+ * and the batch of the request is split between them in proportion to their speeds, the parts of the outputs
+ * are written to the output blobs of the request in place. Each input and output must have the batch in its first
+ * dimension (NCHW, NHWC or NC layout), otherwise the load fails.
+ * The speeds are given by KEY_HETERO_DEVICE_SPEEDS. Otherwise the loading measures them: it loads the network of
+ * the batch 1 on each device in addition and infers it four times, so the speeds should be given when the time
+ * of the load matters.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(BATCH_SPLIT);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -63,4 +63,12 @@ public:
  */
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateDefaultAllocator() noexcept;
 
+/**
+ * @brief Creates the allocator which aligns the blocks to 64 bytes and keeps the freed blocks for the next
+ * allocations of the same size class. The allocator is thread-safe and may be shared by many blobs.
+ * @param hugePages Whether the blocks of 2MB or larger are advised to be backed by the huge pages
+ * @return The Inference Engine IAllocator* instance
+ */
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreatePooledAllocator(bool hugePages) noexcept;
+
 }  // namespace InferenceEngine
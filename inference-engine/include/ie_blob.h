@@ -299,6 +299,16 @@ public:
         allocate();
     }
 
+    /**
+     * @brief Creates a TBlob object with the specified dimensions and layout and the custom memory allocator
+     * but does not allocate the memory. Please use the allocate() method to allocate memory.
+     * @param tensorDesc Tensor description
+     * @param alloc Allocator to be used
+     */
+    TBlob(const TensorDesc& tensorDesc, const std::shared_ptr<IAllocator>& alloc)
+            : Blob(tensorDesc), _allocator(alloc) {
+    }
+
     /**
      * @deprecated Please use TensorDesc for Blob initialization.
      */
@@ -644,6 +654,19 @@ inline typename InferenceEngine::TBlob<Type>::Ptr make_shared_blob(const TensorD
     return std::make_shared<InferenceEngine::TBlob<Type>>(tensorDesc, ptr, size);
 }
 
+/**
+ * @brief Creates a blob with the given tensor descriptor and the custom memory allocator.
+ * @tparam Type Type of the shared pointer to be created
+ * @param tensorDesc TensorDesc for Blob creation
+ * @param alloc Allocator to be used by allocate()
+ * @return A shared pointer to the newly created blob of the given type
+ */
+template<typename Type>
+inline typename InferenceEngine::TBlob<Type>::Ptr make_shared_blob(const TensorDesc& tensorDesc,
+                                                                   const std::shared_ptr<IAllocator>& alloc) {
+    return std::make_shared<InferenceEngine::TBlob<Type>>(tensorDesc, alloc);
+}
+
 /**
  * @deprecated Use TensorDesc in order to create Blob::Ptr.
  * @brief Gets a shared pointer for the new TBlob instance.
@@ -769,10 +792,23 @@ struct ROI {
 
 /**
  * @brief Creates a blob describing given ROI object based on the given blob with pre-allocated memory.
- * @param inputBlob original blob with pre-allocated memory.
- * @param roi A ROI object inside of the original blob.
+ * The ROI blob shares the memory of the original blob and keeps it alive, the strides of the original blob are
+ * kept, so the ROI blob is not dense. The plugins read such blobs in SetBlob without copying them beforehand.
+ * @param inputBlob original blob with pre-allocated memory, it may be a ROI blob itself.
+ * @param roi A ROI object inside of the original blob, roi.id is the index of the image in the batch.
  * @return A shared pointer to the newly created blob.
  */
 INFERENCE_ENGINE_API_CPP(Blob::Ptr) make_shared_blob(const Blob::Ptr &inputBlob, const ROI &roi);
 
+/**
+ * @brief Creates a blob of the slice of the batch of the given blob with pre-allocated memory.
+ * The blob shares the memory of the original blob and keeps it alive. The slice of a dense blob is dense, so
+ * the plugins can use its memory as is.
+ * @param inputBlob original blob with pre-allocated memory, the batch must be its outermost dimension.
+ * @param batchOffset The index of the first item of the slice in the batch.
+ * @param batchSize The number of the items of the slice.
+ * @return A shared pointer to the newly created blob.
+ */
+INFERENCE_ENGINE_API_CPP(Blob::Ptr) make_shared_blob(const Blob::Ptr &inputBlob, size_t batchOffset, size_t batchSize);
+
 }  // namespace InferenceEngine
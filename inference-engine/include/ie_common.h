@@ -137,6 +137,74 @@ struct InferenceEngineProfileInfo {
     unsigned execution_index;
 };
 
+/**
+ * @struct InferRequestTimings
+ * @brief Represents the timestamps of the stages of the last inference of a request, in microseconds of the monotonic
+ * clock (std::chrono::steady_clock). The differences of the neighbouring stages break the latency of the inference
+ * down: the time in the queue of the executor, the pre-processing, the execution on the device, the copy of the outputs
+ * and the handoff to the callback.
+ * The stage not passed by the inference or not reported by the plugin is 0.
+ */
+struct InferRequestTimings {
+    /**
+     * @brief The request is started by StartAsync() or Infer() and passed to the executor
+     */
+    long long enqueued_uSec = 0;
+    /**
+     * @brief The executor has started the inference (the pre-processing stage of the pipelined request)
+     */
+    long long started_uSec = 0;
+    /**
+     * @brief The inputs are pre-processed and set to the device
+     */
+    long long preprocessed_uSec = 0;
+    /**
+     * @brief The device has completed the network
+     */
+    long long executed_uSec = 0;
+    /**
+     * @brief The outputs are copied to the output blobs
+     */
+    long long outputsCopied_uSec = 0;
+    /**
+     * @brief The completion callback is invoked
+     */
+    long long callback_uSec = 0;
+};
+
+/**
+ * @struct ExecutorMetrics
+ * @brief Represents the utilization of an executor of the requests (e.g. a CPU stream or the queue of a GPU network)
+ * since the executor is created. The utilization over an interval is the difference of the busy time of two reads
+ * divided by the difference of the busy and the idle time.
+ */
+struct ExecutorMetrics {
+    /**
+     * @brief The number of the worker threads of the executor, 0 if the executor does not report the metrics
+     */
+    size_t workers = 0;
+    /**
+     * @brief The number of the tasks waiting for an idle worker
+     */
+    size_t queueDepth = 0;
+    /**
+     * @brief The number of the tasks executed by the workers at the moment
+     */
+    size_t runningTasks = 0;
+    /**
+     * @brief The number of the completed tasks
+     */
+    unsigned long long completedTasks = 0;
+    /**
+     * @brief The time the workers executed the tasks, summed over the workers
+     */
+    long long busy_uSec = 0;
+    /**
+     * @brief The time the workers waited for the tasks, summed over the workers
+     */
+    long long idle_uSec = 0;
+};
+
 
 /**
  * @enum StatusCode
@@ -157,7 +225,11 @@ enum StatusCode : int {
     REQUEST_BUSY = -8,
     RESULT_NOT_READY = -9,
     NOT_ALLOCATED = -10,
-    INFER_NOT_STARTED = -11
+    INFER_NOT_STARTED = -11,
+    /*
+     * @brief the inference was cancelled or has missed its deadline
+     */
+    INFER_CANCELLED = -12
 };
 
 /**
@@ -214,6 +286,10 @@ class NotAllocated : public std::logic_error
 /** @brief This class represents StatusCode::INFER_NOT_STARTED exception */
 class InferNotStarted : public std::logic_error
 { using std::logic_error::logic_error; };
+
+/** @brief This class represents StatusCode::INFER_CANCELLED exception */
+class InferCancelled : public std::logic_error
+{ using std::logic_error::logic_error; };
 }  // namespace InferenceEngine
 
 #if defined(_WIN32)
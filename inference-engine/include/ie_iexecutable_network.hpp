@@ -89,6 +89,31 @@ public:
      * @return Status code of the operation: OK (0) for success, OUT_OF_BOUNDS (-6) no memory state for given index
      */
     virtual StatusCode  QueryState(IMemoryState::Ptr & pState, size_t  idx, ResponseDesc *resp) noexcept = 0;
+
+    /**
+     * @brief Changes the shapes of the network inputs without loading the network again.
+     * The inference requests created after the call use the new shapes, the ones created before keep the old shapes.
+     * @param inputShapes Map of pairs: name of the input and its new shape
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin doesn't support it
+     */
+    virtual StatusCode Reshape(const std::map<std::string, SizeVector> &inputShapes, ResponseDesc *resp) noexcept {
+        return NOT_IMPLEMENTED;
+    }
+
+    /**
+     * @brief Gets the utilization of the executors running the requests of the network: the queue depth and the busy
+     * and the idle time of every executor, e.g. "infer" and "callback" or the CPU streams "stream<N>".
+     * @note: The executor shared with the other networks (e.g. for KEY_EXCLUSIVE_ASYNC_REQUESTS) reports their tasks
+     * as well. The metrics are read without blocking the executors, the time of the running tasks may lag behind.
+     * @param metrics Map of pairs: name of the executor and its metrics
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin doesn't support it
+     */
+    virtual StatusCode GetExecutorMetrics(std::map<std::string, ExecutorMetrics> &metrics,
+                                          ResponseDesc *resp) const noexcept {
+        return NOT_IMPLEMENTED;
+    }
 };
 
 }  // namespace InferenceEngine
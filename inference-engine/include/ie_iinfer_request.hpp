@@ -15,6 +15,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <details/ie_irelease.hpp>
 
 namespace InferenceEngine {
@@ -133,6 +134,112 @@ public:
     * @return Enumeration of the resulted action: OK (0) for success
     */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc *resp) noexcept = 0;
+
+    // the methods added later go below, so the virtual table of the prebuilt plugins and applications is kept
+
+    /**
+     * @brief Sets input/output data to infer by the index of the blob, without looking up its name
+     * @note: Memory allocation does not happen
+     * @param index Index of input or output blob: the inputs of the network go first in the order of their names,
+     * the outputs follow them in the order of their names (the order of InputsDataMap and OutputsDataMap).
+     * @param data Reference to input or output blob. The type of a blob must match the network input precision and size.
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not support it
+     */
+    virtual StatusCode SetBlobByIndex(size_t index, const Blob::Ptr &data, ResponseDesc *resp) noexcept {
+        return NOT_IMPLEMENTED;
+    }
+
+    /**
+     * @brief Gets input/output data for inference by the index of the blob, without looking up its name
+     * @note: Memory allocation does not happen
+     * @param index Index of input or output blob, see SetBlobByIndex()
+     * @param data Reference to input or output blob. The type of Blob must match the network input precision and size.
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not support it
+     */
+    virtual StatusCode GetBlobByIndex(size_t index, Blob::Ptr &data, ResponseDesc *resp) noexcept {
+        return NOT_IMPLEMENTED;
+    }
+
+    /**
+     * @brief Sets the ROI blobs to be pre-processed into the batch of the input: the ROI i is resized (and converted
+     * to the color format of the network) right into the batch slot i of the input blob, e.g. the objects found
+     * by a detector in one frame become the batch of a classifier.
+     * @note: The input should have the resize algorithm or the color format set. The ROIs replace the blob
+     * set by SetBlob() for the input. The slots after the last ROI keep their data, SetBatch() may limit the
+     * inference to the ROIs.
+     * @param name Name of the input
+     * @param rois The ROI blobs with the batch 1 and the precision of the input, not more than the batch of the input
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not support it
+     */
+    virtual StatusCode SetRoiBlobs(const char *name, const std::vector<Blob::Ptr> &rois, ResponseDesc *resp) noexcept {
+        return NOT_IMPLEMENTED;
+    }
+
+    /**
+     * @brief Sets the outputs which are not needed by the following inferences, e.g. the auxiliary heads of the network.
+     * Their blobs are not updated and the layers computing only them are not executed.
+     * @note: The outputs stay skipped until the next call, an empty list brings all the outputs back.
+     * @param names Names of the skipped outputs
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not support it
+     */
+    virtual StatusCode SetSkippedOutputs(const std::vector<std::string> &names, ResponseDesc *resp) noexcept {
+        return NOT_IMPLEMENTED;
+    }
+
+    /**
+     * @brief Checks whether the blob set by SetBlob() for the input or output would be used by the plugin directly,
+     * without copying and conversion, e.g. the precision, the layout and the alignment of the blob are the ones
+     * of the plugin memory. The blob is not set by the call.
+     * @param name Name of input or output blob
+     * @param data Reference to the blob to check
+     * @param zeroCopy The result, true if the blob is bound without copying
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not support it
+     */
+    virtual StatusCode IsZeroCopyBlob(const char *name, const Blob::Ptr &data, bool &zeroCopy,
+                                      ResponseDesc *resp) noexcept {
+        return NOT_IMPLEMENTED;
+    }
+
+    /**
+     * @brief Cancels the ongoing inference, it is stopped at the nearest point the plugin checks the cancellation
+     * (e.g. between the layers) and completes with the INFER_CANCELLED status.
+     * @note: The call does not block and may be done from any thread while the request is running. The cancellation
+     * applies to the ongoing inference only, the next inference started runs as usual.
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not support it
+     */
+    virtual StatusCode Cancel(ResponseDesc *resp) noexcept {
+        return NOT_IMPLEMENTED;
+    }
+
+    /**
+     * @brief Sets the deadline of the following inferences: the inference which is not completed in the given time
+     * after it has been started (the time in the queue of the device included) is cancelled as by Cancel().
+     * @param millis_timeout The time in milliseconds the inference is given, 0 disables the deadline
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not support it
+     */
+    virtual StatusCode SetDeadline(int64_t millis_timeout, ResponseDesc *resp) noexcept {
+        return NOT_IMPLEMENTED;
+    }
+
+    /**
+     * @brief Gets the timestamps of the stages of the last inference, see InferRequestTimings
+     * @note: The timestamps are written by the request at the stage boundaries without any synchronization, so they
+     * are read after Wait() or in the completion callback. They are updated by every inference, the profiling does not
+     * need to be enabled.
+     * @param timings The timestamps of the last inference
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success, NOT_IMPLEMENTED if the plugin does not support it
+     */
+    virtual StatusCode GetTimings(InferRequestTimings &timings, ResponseDesc *resp) const noexcept {
+        return NOT_IMPLEMENTED;
+    }
 };
 
 }  // namespace InferenceEngine
@@ -0,0 +1,255 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Contains the loops of the CPU code parallelized by the threading backend chosen at build time:
+ * the Threading Building Blocks library (IE_THREAD_TBB), OpenMP* (IE_THREAD_OMP, default)
+ * or the sequential execution (IE_THREAD_SEQ).
+ * With TBB the loops run in the task arena of the calling thread, so they compose with the application
+ * thread pool and with the loops started by other threads instead of oversubscribing the cores.
+ * The work is split between the threads statically, in the same way for all the backends.
+ * @file ie_parallel.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#define IE_THREAD_TBB 0
+#define IE_THREAD_OMP 1
+#define IE_THREAD_SEQ 2
+
+#ifndef IE_THREAD
+#define IE_THREAD IE_THREAD_OMP
+#endif
+
+#if IE_THREAD == IE_THREAD_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
+#include <tbb/task_arena.h>
+
+inline int parallel_get_max_threads() { return tbb::this_task_arena::max_concurrency(); }
+inline int parallel_get_num_threads() { return parallel_get_max_threads(); }
+inline int parallel_get_thread_num() {
+    int thread_num = tbb::this_task_arena::current_thread_index();
+    return thread_num == tbb::task_arena::not_initialized ? 0 : thread_num;
+}
+#elif IE_THREAD == IE_THREAD_OMP
+#include <omp.h>
+
+inline int parallel_get_max_threads() { return omp_get_max_threads(); }
+inline int parallel_get_num_threads() { return omp_get_num_threads(); }
+inline int parallel_get_thread_num() { return omp_get_thread_num(); }
+#elif IE_THREAD == IE_THREAD_SEQ
+inline int parallel_get_max_threads() { return 1; }
+inline int parallel_get_num_threads() { return 1; }
+inline int parallel_get_thread_num() { return 0; }
+#else
+#error "Unknown IE_THREAD value, expected IE_THREAD_TBB, IE_THREAD_OMP or IE_THREAD_SEQ"
+#endif
+
+namespace InferenceEngine {
+
+/**
+ * @brief Splits n items between team threads, the first n % team threads get one item more
+ */
+template <typename T, typename Q>
+inline void splitter(T n, Q team, Q tid, T &n_start, T &n_end) {
+    if (team <= 1 || n == 0) {
+        n_start = 0;
+        n_end = n;
+    } else {
+        T n1 = (n + (T)team - 1) / (T)team;
+        T n2 = n1 - 1;
+        T T1 = n - n2 * (T)team;
+        n_end = (T)tid < T1 ? n1 : n2;
+        n_start = (T)tid <= T1 ? tid * n1 : T1 * n1 + ((T)tid - T1) * n2;
+        n_end += n_start;
+    }
+}
+
+/**
+ * @brief Runs func(ithr, nthr) by nthr threads, nthr = 0 means all the threads available
+ */
+template <typename F>
+void parallel_nt(int nthr, const F &func) {
+#if IE_THREAD == IE_THREAD_TBB
+    if (nthr == 0) nthr = parallel_get_max_threads();
+    if (nthr == 1) {
+        func(0, 1);
+        return;
+    }
+    tbb::parallel_for(0, nthr, [&](int ithr) {
+        func(ithr, nthr);
+    }, tbb::static_partitioner());
+#elif IE_THREAD == IE_THREAD_OMP
+    if (nthr == 1) {
+        func(0, 1);
+        return;
+    }
+    if (nthr == 0) nthr = parallel_get_max_threads();
+#   pragma omp parallel num_threads(nthr)
+    func(parallel_get_thread_num(), parallel_get_num_threads());
+#else
+    func(0, 1);
+#endif
+}
+
+template <typename T>
+inline T parallel_it_init(T start) { return start; }
+
+/**
+ * @brief Converts the linear index to the multi-dimensional one, the last dimension changes the fastest
+ */
+template <typename T, typename Q, typename R, typename... Args>
+inline T parallel_it_init(T start, Q &x, const R &X, Args &&... tuple) {
+    start = parallel_it_init(start, std::forward<Args>(tuple)...);
+    x = start % X;
+    return start / X;
+}
+
+inline bool parallel_it_step() { return true; }
+
+/**
+ * @brief Increments the multi-dimensional index, returns true when it wraps around
+ */
+template <typename Q, typename R, typename... Args>
+inline bool parallel_it_step(Q &x, const R &X, Args &&... tuple) {
+    if (parallel_it_step(std::forward<Args>(tuple)...)) {
+        x = ((x + 1) == X) ? 0 : x + 1;
+        return x == 0;
+    }
+    return false;
+}
+
+template <typename T0, typename F>
+void for_1d(const int ithr, const int nthr, const T0 &D0, const F &func) {
+    T0 d0{0}, end{0};
+    splitter(D0, nthr, ithr, d0, end);
+    for (; d0 < end; ++d0) func(d0);
+}
+
+template <typename T0, typename T1, typename F>
+void for_2d(const int ithr, const int nthr, const T0 &D0, const T1 &D1, const F &func) {
+    const size_t work_amount = (size_t)D0 * D1;
+    if (work_amount == 0) return;
+    size_t start{0}, end{0};
+    splitter(work_amount, nthr, ithr, start, end);
+
+    T0 d0{0}; T1 d1{0};
+    parallel_it_init(start, d0, D0, d1, D1);
+    for (size_t iwork = start; iwork < end; ++iwork) {
+        func(d0, d1);
+        parallel_it_step(d0, D0, d1, D1);
+    }
+}
+
+template <typename T0, typename T1, typename T2, typename F>
+void for_3d(const int ithr, const int nthr, const T0 &D0, const T1 &D1, const T2 &D2, const F &func) {
+    const size_t work_amount = (size_t)D0 * D1 * D2;
+    if (work_amount == 0) return;
+    size_t start{0}, end{0};
+    splitter(work_amount, nthr, ithr, start, end);
+
+    T0 d0{0}; T1 d1{0}; T2 d2{0};
+    parallel_it_init(start, d0, D0, d1, D1, d2, D2);
+    for (size_t iwork = start; iwork < end; ++iwork) {
+        func(d0, d1, d2);
+        parallel_it_step(d0, D0, d1, D1, d2, D2);
+    }
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename F>
+void for_4d(const int ithr, const int nthr, const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3, const F &func) {
+    const size_t work_amount = (size_t)D0 * D1 * D2 * D3;
+    if (work_amount == 0) return;
+    size_t start{0}, end{0};
+    splitter(work_amount, nthr, ithr, start, end);
+
+    T0 d0{0}; T1 d1{0}; T2 d2{0}; T3 d3{0};
+    parallel_it_init(start, d0, D0, d1, D1, d2, D2, d3, D3);
+    for (size_t iwork = start; iwork < end; ++iwork) {
+        func(d0, d1, d2, d3);
+        parallel_it_step(d0, D0, d1, D1, d2, D2, d3, D3);
+    }
+}
+
+/**
+ * @brief The loop over [0, D0) with the iterations distributed between the threads,
+ * the equivalent of "omp parallel for schedule(static)"
+ */
+template <typename T0, typename F>
+void parallel_for(const T0 &D0, const F &func) {
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        for_1d(ithr, nthr, D0, func);
+    });
+}
+
+/**
+ * @brief The nested loops over [0, D0) x [0, D1), the equivalent of "omp parallel for collapse(2) schedule(static)"
+ */
+template <typename T0, typename T1, typename F>
+void parallel_for2d(const T0 &D0, const T1 &D1, const F &func) {
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        for_2d(ithr, nthr, D0, D1, func);
+    });
+}
+
+template <typename T0, typename T1, typename T2, typename F>
+void parallel_for3d(const T0 &D0, const T1 &D1, const T2 &D2, const F &func) {
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        for_3d(ithr, nthr, D0, D1, D2, func);
+    });
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename F>
+void parallel_for4d(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3, const F &func) {
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        for_4d(ithr, nthr, D0, D1, D2, D3, func);
+    });
+}
+
+/**
+ * @brief The sum of func(d0) over [0, D0) added to the input value, the equivalent of "omp parallel for reduction(+)"
+ */
+template <typename T0, typename R, typename F>
+R parallel_sum(const T0 &D0, const R &input, const F &func) {
+#if IE_THREAD == IE_THREAD_TBB
+    // the identity is R(0): tbb may start any number of the chunks from it, the input is added once
+    return input + tbb::parallel_reduce(tbb::blocked_range<T0>(0, D0), R(0),
+        [&](const tbb::blocked_range<T0> &r, R init) -> R {
+            R sum = init;
+            for (T0 d0 = r.begin(); d0 < r.end(); ++d0)
+                sum += func(d0);
+            return sum;
+        },
+        [](R x, R y) -> R {
+            return x + y;
+        });
+#else
+    R sum = input;
+#if IE_THREAD == IE_THREAD_OMP
+#   pragma omp parallel for reduction(+ : sum) schedule(static)
+#endif
+    for (int64_t d0 = 0; d0 < (int64_t)D0; d0++)
+        sum += func((T0)d0);
+    return sum;
+#endif
+}
+
+/**
+ * @brief The sum of func(d0, d1) over [0, D0) x [0, D1) added to the input value
+ */
+template <typename T0, typename T1, typename R, typename F>
+R parallel_sum2d(const T0 &D0, const T1 &D1, const R &input, const F &func) {
+    return parallel_sum((size_t)D0 * D1, input, [&](size_t i) -> R {
+        return func((T0)(i / D1), (T1)(i % D1));
+    });
+}
+
+}  // namespace InferenceEngine
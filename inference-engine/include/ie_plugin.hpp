@@ -76,6 +76,8 @@ public:
     /**
      * @brief Creates an executable network from a network object. User can create as many networks as they need and use
      *        them simultaneously (up to the limitation of the hardware resources)
+     *        The CPU and GPU plugins allow to load the different networks by the calls from several threads at the same
+     *        time; the calls must not overlap with SetConfig, AddExtension and the deprecated LoadNetwork.
      * @param ret Reference to a shared ptr of the returned network interface
      * @param network Network object acquired from CNNNetReader
      * @param config Map of pairs: (config parameter name, config parameter value) relevant only for this load operation
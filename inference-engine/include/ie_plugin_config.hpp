@@ -45,6 +45,161 @@ DECLARE_CONFIG_VALUE(NO);
 */
 DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 
+/**
+* @brief Optimize CPU execution to maximize throughput.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* - PluginConfigParams::CPU_THROUGHPUT_AUTO creates bare minimum of streams that evenly divides the available cores
+* - a positive integer value creates the requested number of streams
+* Every stream is an independent copy of the network graph executed by its own set of cores,
+* so the parallel async infer requests are not serialized on a single OpenMP team.
+* With KEY_EXCLUSIVE_ASYNC_REQUESTS the streams are inferred by the workers of the executor shared by the networks,
+* the first network loaded defines the number of its workers.
+*/
+DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
+DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
+
+/**
+* @brief The name for setting the dataflow execution of the independent branches of the network.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+* The ready layers of the different branches are executed simultaneously, each one by its own group of threads.
+* The option is applied on the network loading.
+*/
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+* @brief The key defines the directory where the CPU plugin keeps the results of the network compilation.
+* The choice of the layer implementations and memory formats is stored there on the first load of the network
+* and reused by the next loads of the same network on the same kind of CPU. Empty value (default) disables the cache.
+*/
+DECLARE_CONFIG_KEY(CPU_GRAPH_CACHE_DIR);
+
+/**
+* @brief The key binds the threads of the CPU plugin to the cores of one NUMA node.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* the index of the node (the "physical id" of the socket) or PluginConfigParams::NO (default)
+* The memory of the network is allocated and initialized by the bound threads, so it is placed on the same node.
+* The threads are owned by the network, so the option cannot be combined with the exclusive async requests.
+* The option is applied on the network loading.
+*/
+DECLARE_CONFIG_KEY(CPU_BIND_NUMA_NODE);
+
+/**
+* @brief The key defines the number of the threads which infer the network, the threads are split between the streams.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* a positive integer value or "0" (default) which takes all the available cores.
+* Every executable network has its own team of the threads, so the networks loaded with different values
+* (e.g. a small model on 4 threads and a big one on 24) are inferred in the same process without resizing each other.
+* The threads are not bound to the cores unless CPU_BIND_CORES or CPU_BIND_NUMA_NODE is set (Linux only).
+* The option is applied on the network loading.
+*/
+DECLARE_CONFIG_KEY(CPU_THREADS_NUM);
+
+/**
+* @brief The key binds the threads of the network to the listed cores.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* the comma separated list of the logical cores and the ranges of them, e.g. "0-3,8,10-11",
+* or PluginConfigParams::NO (default). The logical cores are numbered as for CPU_BIND_THREAD, one per physical core.
+* With CPU_THREADS_NUM set the network takes the first cores of the list, the streams split the cores.
+* The option cannot be combined with CPU_BIND_NUMA_NODE and is applied on the network loading.
+*/
+DECLARE_CONFIG_KEY(CPU_BIND_CORES);
+
+/**
+* @brief The key infers the network by the CPU scheduler shared by all the networks of the process loaded with it.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* the number of the groups of threads the scheduler splits the cores into, or PluginConfigParams::NO (default)
+* which gives the network its own threads. The groups are set by the first network loaded with the scheduler,
+* the later networks share them and fail to load with another number of groups or CPU_BIND_THREAD. The idle group infers the request of the network of the highest
+* KEY_CPU_SCHEDULER_PRIORITY, the networks of the same priority share the groups by their KEY_CPU_SCHEDULER_WEIGHT.
+* KEY_CPU_THROUGHPUT_STREAMS of the network limits its requests inferred at the same time by the different groups.
+* The option cannot be combined with CPU_THREADS_NUM, CPU_BIND_CORES, CPU_BIND_NUMA_NODE and the exclusive
+* async requests, and is applied on the network loading.
+*/
+DECLARE_CONFIG_KEY(CPU_SCHEDULER_GROUPS);
+
+/**
+* @brief The priority of the network on the CPU scheduler, an integer value, "0" by default.
+* The waiting requests of the networks of the higher priority are inferred first, the running ones are not preempted.
+*/
+DECLARE_CONFIG_KEY(CPU_SCHEDULER_PRIORITY);
+
+/**
+* @brief The weight of the network on the CPU scheduler, a positive integer value, "1" by default.
+* The networks of the same priority loaded at the same time get the groups in the proportion of their weights.
+*/
+DECLARE_CONFIG_KEY(CPU_SCHEDULER_WEIGHT);
+
+/**
+* @brief The key defines the name of the group of the networks which share the memory of the intermediate data.
+* The networks of the group must never be inferred concurrently (e.g. the models of a pipeline inferred one by one
+* in the same thread), the memory is as big as the one required by the biggest network of the group.
+* The inputs, outputs and constant data of each network are kept in its own memory.
+* Empty value (default) disables the sharing. The option is applied on the network loading.
+*/
+DECLARE_CONFIG_KEY(CPU_WORKSPACE_GROUP);
+
+/**
+* @brief The key chooses the way the intermediate data of the CPU network are packed into its memory.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT (default) or PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY
+* The best-fit packing is never bigger than the greedy one, the greedy one is faster on the networks with
+* many thousands of layers. The option is applied on the network loading.
+*/
+DECLARE_CONFIG_KEY(CPU_MEMORY_SOLVER);
+
+DECLARE_CONFIG_VALUE(CPU_MEMORY_SOLVER_BEST_FIT);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_SOLVER_GREEDY);
+
+/**
+* @brief The key keeps the weights of the fully connected layers in FP16, they are converted to FP32 when read.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+* The weights take half of the memory and the results are accumulated in FP32, it speeds up the small batches
+* which are bound by the memory bandwidth. The option is applied on the network loading.
+*/
+DECLARE_CONFIG_KEY(CPU_FP16_WEIGHTS);
+
+/**
+* @brief The key completes the asynchronous requests on the worker which has inferred them.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+* The completion callback is invoked by the worker right after the inference and InferRequest::Wait() polls
+* the status for a short time before the thread is parked, so the small frequent requests avoid the thread handoffs.
+* The callback blocks the worker, so it must be short. The option is applied to the requests created after it is set.
+*/
+DECLARE_CONFIG_KEY(CPU_INLINE_COMPLETION);
+
+/**
+* @brief The key chooses the allocator of the input and output blobs created by the CPU infer requests.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::CPU_BLOB_ALLOCATOR_SYSTEM (default), PluginConfigParams::CPU_BLOB_ALLOCATOR_POOLED or
+* PluginConfigParams::CPU_BLOB_ALLOCATOR_HUGE_PAGES
+* The pooled allocator is shared by the requests of the network: the memory of the destroyed blobs is reused by
+* the blobs of the requests created later, so the requests created per session avoid the page faults.
+* The HUGE_PAGES value also advises the blocks of 2MB or larger to be backed by the transparent huge pages.
+* The option is applied to the networks loaded after it is set.
+*/
+DECLARE_CONFIG_KEY(CPU_BLOB_ALLOCATOR);
+
+DECLARE_CONFIG_VALUE(CPU_BLOB_ALLOCATOR_SYSTEM);
+DECLARE_CONFIG_VALUE(CPU_BLOB_ALLOCATOR_POOLED);
+DECLARE_CONFIG_VALUE(CPU_BLOB_ALLOCATOR_HUGE_PAGES);
+
+/**
+* @brief The key places the weights and the intermediate data of the CPU graphs on the huge pages, so streaming over
+* the big weights misses the TLB less often.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::NO (default), PluginConfigParams::HUGE_PAGES_2MB or PluginConfigParams::HUGE_PAGES_1GB
+* The pages of the size reserved in the hugetlbfs pool are used first, then the reserved 2MB pages and then the
+* transparent huge pages. The regular memory is used if the huge pages are not available (and on the systems
+* other than Linux). The option is applied to the networks loaded after it is set.
+*/
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+
+DECLARE_CONFIG_VALUE(HUGE_PAGES_2MB);
+DECLARE_CONFIG_VALUE(HUGE_PAGES_1GB);
+
 /**
 * @brief The name for setting performance counters option.
 * It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
@@ -52,6 +207,37 @@ DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 */
 DECLARE_CONFIG_KEY(PERF_COUNT);
 
+/**
+* @brief The key enables the sampled timing of the CPU layers: only every Nth inference is timed.
+* The paired value is the period N, 0 (default) times every inference and reports the average time.
+* With the sampling the time reported by GetPerformanceCounts() is the statistic chosen by
+* KEY_CPU_PERF_COUNT_STATISTIC over all the timed inferences since the network loading.
+*/
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_SAMPLING);
+
+/**
+* @brief The key chooses the statistic of the sampled times reported by GetPerformanceCounts().
+* This option should be used with values: PluginConfigParams::PERF_COUNT_AVG (default),
+* PluginConfigParams::PERF_COUNT_MIN, PluginConfigParams::PERF_COUNT_P50, PluginConfigParams::PERF_COUNT_P99
+* or PluginConfigParams::PERF_COUNT_MAX
+*/
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_STATISTIC);
+
+DECLARE_CONFIG_VALUE(PERF_COUNT_AVG);
+DECLARE_CONFIG_VALUE(PERF_COUNT_MIN);
+DECLARE_CONFIG_VALUE(PERF_COUNT_P50);
+DECLARE_CONFIG_VALUE(PERF_COUNT_P99);
+DECLARE_CONFIG_VALUE(PERF_COUNT_MAX);
+
+/**
+* @brief The key groups the sampled times reported by GetPerformanceCounts() by the layer types.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+* With YES the reported entries are the layer types, the time of an entry is the statistic of the total time
+* spent by the layers of the type in one inference.
+*/
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_BY_LAYER_TYPE);
+
 /**
 * @brief The key defines dynamic limit of batch processing.
 * Specified value is applied to all following Infer() calls. Inference Engine processes
@@ -130,5 +316,48 @@ DECLARE_CONFIG_KEY(DEVICE_ID);
 */
 DECLARE_CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS);
 
+/**
+* @brief The key binds the threads which dispatch the asynchronous requests and run their callbacks to the listed
+* logical processors of the OS, the threads inferring the network on the CPU are not affected.
+* It is passed to IInferencePlugin::SetConfig(), the value is the comma separated list of the processors and the ranges
+* of them, e.g. "0-1,8", or PluginConfigParams::NO (default). The CPU plugin binds the callback threads of the network
+* bound by CPU_BIND_CORES or CPU_BIND_NUMA_NODE to the processors it does not use by default.
+* The binding is supported on Linux and Windows, the option is applied on the network loading.
+*/
+DECLARE_CONFIG_KEY(ASYNC_THREADS_CORES);
+
+/**
+* @brief The priority of the threads of ASYNC_THREADS_CORES relative to the normal one, from "-2" (lowest) to "2"
+* (highest), "0" is the default. The lower priority lets the inference threads preempt them, the higher one may be
+* denied to the unprivileged process. The option is applied on the network loading.
+*/
+DECLARE_CONFIG_KEY(ASYNC_THREADS_PRIORITY);
+
+/**
+* @brief The key makes LoadNetwork() return the network which infers the requests started concurrently by batches.
+* The requests of the network of batch 1 are queued, and up to the value of them are inferred at once by a request
+* of the network loaded with that batch and KEY_DYN_BATCH_ENABLED: the inputs are copied to the images of the batch
+* and the outputs are copied back, so the application keeps using the requests of batch 1.
+* The value is the largest batch, "1" (default) disables the batching. The plugin must support the dynamic batch.
+* The key is a parameter of LoadNetwork() only.
+*/
+DECLARE_CONFIG_KEY(AUTO_BATCH);
+
+/**
+* @brief The time in microseconds that the first queued request waits for the batch of KEY_AUTO_BATCH to be filled,
+* after it a partial batch is inferred. The default is "1000", "0" infers the requests queued at the moment.
+*/
+DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+
+/**
+* @brief The key makes LoadNetwork() return the executable network shared with a network loaded before by the same
+* plugin while that one is alive: the network has the same topology, weights, inputs and outputs, and the config of
+* the loads is the same. The repeated load returns at once, the infer requests created by the loads are independent,
+* and the weights and the compiled graphs are kept by the process once.
+* The value is PluginConfigParams::YES or PluginConfigParams::NO (default). The config set by SetConfig() between
+* the loads is not compared. The key is a parameter of LoadNetwork() only.
+*/
+DECLARE_CONFIG_KEY(SHARE_EXECUTABLE_NETWORK);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
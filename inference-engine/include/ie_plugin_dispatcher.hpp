@@ -17,6 +17,8 @@
 namespace InferenceEngine {
 /**
 * @brief This is a class to load a suitable plugin
+* The dispatcher does not change its state, so it may be used by several threads at the same time. Every lookup
+* creates a new instance of the plugin.
 */
 class PluginDispatcher {
 public:
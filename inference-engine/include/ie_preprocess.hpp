@@ -51,6 +51,20 @@ enum ResizeAlgorithm {
     RESIZE_AREA
 };
 
+/**
+ * @enum ColorFormat
+ * @brief Represents the color format of the blob passed to the input with pre-processing (the ROI blob).
+ * The network is expected to take the channels in the BGR order, so the plugin converts the other color formats
+ * to BGR during the pre-processing.
+ */
+enum ColorFormat {
+    RAW = 0,  /**< the channels are passed to the network as they are */
+    RGB,      /**< U8 image with 3 channels in the RGB order, both planar (NCHW) and interleaved (NHWC) */
+    BGR,      /**< U8 image with 3 channels in the BGR order, both planar (NCHW) and interleaved (NHWC) */
+    NV12,     /**< U8 frame {N, 1, H * 3 / 2, W}: the plane of Y followed by the plane of the interleaved U and V
+                   of the half resolution, as the video decoders give it */
+};
+
 /**
  * @brief This class stores pre-process information for the input
  */
@@ -62,6 +76,9 @@ class PreProcessInfo {
     // Resize Algorithm to be applied for input before inference if needed.
     ResizeAlgorithm _resizeAlg = NO_RESIZE;
 
+    // Color format of the input blob to be converted to the one of the network.
+    ColorFormat _colorFormat = RAW;
+
 public:
     /**
      * @brief Overloaded [] operator to safely get the channel by an index. 
@@ -184,5 +201,22 @@ public:
     ResizeAlgorithm getResizeAlgorithm() const {
         return _resizeAlg;
     }
+
+    /**
+     * @brief Sets the color format of the blob passed to the input. If it is not RAW, the blob is pre-processed
+     * like the ROI blob: it may have the other size than the network input and is converted to the BGR order.
+     * @param fmt Color format of the input blob.
+     */
+    void setColorFormat(const ColorFormat &fmt) {
+        _colorFormat = fmt;
+    }
+
+    /**
+     * @brief Gets the color format of the blob passed to the input.
+     * @return Color format.
+     */
+    ColorFormat getColorFormat() const {
+        return _colorFormat;
+    }
 };
 }  // namespace InferenceEngine
@@ -0,0 +1,77 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides the tiled inference of the fully convolutional networks
+ * @file ie_tiling.hpp
+ */
+#pragma once
+
+#include <string>
+#include <ie_api.h>
+#include <ie_blob.h>
+#include <ie_icnn_network.hpp>
+#include <ie_iinfer_request.hpp>
+
+namespace InferenceEngine {
+
+/**
+ * @brief The geometry of the tiles a fully convolutional network is inferred by.
+ * Every output pixel of the network depends on the input pixels within the halo around it, so the tile of the input
+ * extended by the halo on each side gives the same output as the whole image does. The tiles start at the multiples
+ * of the alignment, the largest stride of the network, so the grids of the strided layers of the tiles match the
+ * grid of the whole image.
+ */
+struct TilingInfo {
+    /** @brief The number of the input columns the tile is extended by on the left and on the right */
+    size_t haloX = 0;
+    /** @brief The number of the input rows the tile is extended by on the top and on the bottom */
+    size_t haloY = 0;
+    /** @brief The tiles and the halo are the multiples of alignX columns */
+    size_t alignX = 1;
+    /** @brief The tiles and the halo are the multiples of alignY rows */
+    size_t alignY = 1;
+};
+
+/**
+ * @brief Computes the halo and the alignment of the tiles from the receptive field of the network.
+ * The layers which mix the whole feature maps (fully connected, reshape, permute, the detection layers and so on)
+ * make the network not fully convolutional, an exception is thrown then.
+ * @param network The network with the single 4D input
+ * @return The geometry of the tiles
+ */
+INFERENCE_ENGINE_API_CPP(TilingInfo) getTilingInfo(const ICNNNetwork &network);
+
+/**
+ * @brief Computes the NCHW dimensions of the input of the network inferring the tiles, they are set to the network
+ * by reshape before it is loaded to the plugin.
+ * @param tiling The geometry of the tiles of the network
+ * @param inputDims The NCHW dimensions of the input of the network
+ * @param batch The number of the tiles inferred at once
+ * @param tileHeight The rows of the tile without the halo, rounded up to the alignment
+ * @param tileWidth The columns of the tile without the halo, rounded up to the alignment
+ * @return The dimensions of the tile with the halo
+ */
+INFERENCE_ENGINE_API_CPP(SizeVector) getTileDims(const TilingInfo &tiling, const SizeVector &inputDims, size_t batch,
+                                                 size_t tileHeight, size_t tileWidth);
+
+/**
+ * @brief Infers the image much larger than the input of the network tile by tile and stitches the outputs of
+ * the tiles to the result, so the memory taken by the activations is bounded by the size of the tile. The tiles fill
+ * the batch of the request, the last tiles of a row or of a column are moved back to stay within the image, so
+ * the borders of the image are inferred as the network does it. The image and the result are dense NCHW blobs of
+ * the precisions of the input and of the output of the request.
+ * @param request The request of the network with the input of getTileDims
+ * @param inputName The name of the input of the network
+ * @param image The image of any height and width
+ * @param outputName The name of the output of the network
+ * @param result The output of the whole image, its size is the size of the image scaled as the tiles are
+ * @param tiling The geometry of the tiles of the network
+ */
+INFERENCE_ENGINE_API_CPP(void) inferTiled(IInferRequest::Ptr request, const std::string &inputName,
+                                          const Blob::Ptr &image, const std::string &outputName,
+                                          const Blob::Ptr &result, const TilingInfo &tiling);
+
+}  // namespace InferenceEngine
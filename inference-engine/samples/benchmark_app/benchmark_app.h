@@ -0,0 +1,161 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message.";
+
+/// @brief message for model argument
+static const char model_message[] = "Required. Path to an .xml file with a trained model.";
+
+/// @brief message for plugin_path argument
+static const char plugin_path_message[] = "Path to a plugin folder.";
+
+/// @brief message for assigning cnn calculation to device
+static const char target_device_message[] = "Specify the target device to infer on; CPU, GPU, FPGA, MYRIAD or HETERO:<devices> " \
+                                            "is acceptable (CPU by default)";
+
+/// @brief message for the execution mode
+static const char api_message[] = "Inference mode: \"sync\" runs one request after another, \"async\" keeps -nireq requests " \
+                                  "running (async by default)";
+
+/// @brief message for the number of infer requests
+static const char ninfer_request_message[] = "Number of infer requests running at the same time in the async mode (default 1)";
+
+/// @brief message for the number of streams
+static const char nstreams_message[] = "Number of CPU throughput streams, a positive number or \"auto\" " \
+                                       "(by default the plugin setting is used)";
+
+/// @brief message for iterations count
+static const char iterations_count_message[] = "Number of inferences to run (default 0, the run is limited by -t)";
+
+/// @brief message for the run time
+static const char run_time_message[] = "Run time in seconds, used when -niter is not set (default 10)";
+
+/// @brief message for the batch size
+static const char batch_size_message[] = "Batch size of the network (by default the batch of the model)";
+
+/// @brief message for performance counters
+static const char performance_counter_message[] = "Reports the per-layer performance counters of the first request";
+
+/// @brief message for the startup mode
+static const char load_only_message[] = "Measures the startup only: the read of the network, its load to the plugin and the creation " \
+                                        "of an infer request, the inference is not run";
+
+/// @brief message for the number of loads
+static const char nload_message[] = "Number of times the startup is repeated, the first one fills the caches of the plugin (default 1)";
+
+/// @brief message for the load phases
+static const char load_phases_message[] = "Reports the phases of the load of the network by the plugin, they are taken from the trace " \
+                                          "of the Inference Engine (IE_TRACE_FILE, a file in the working directory if it is not set)";
+
+/// @brief message for the json report
+static const char json_report_message[] = "Path to the JSON file the results are written to";
+
+/// @brief message for clDNN custom kernels desc
+static const char custom_cldnn_message[] = "Required for clDNN (GPU)-targeted custom kernels."\
+                                            "Absolute path to the xml file with the kernels desc.";
+
+/// @brief message for user library argument
+static const char custom_cpu_library_message[] = "Required for MKLDNN (CPU)-targeted custom layers." \
+                                                 "Absolute path to a shared library with the kernels impl.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Define parameter for set model file <br>
+/// It is a required parameter
+DEFINE_string(m, "", model_message);
+
+/// @brief Define parameter for set path to plugins <br>
+DEFINE_string(pp, "", plugin_path_message);
+
+/// @brief device the target device to infer on <br>
+DEFINE_string(d, "CPU", target_device_message);
+
+/// @brief Inference mode, sync or async <br>
+DEFINE_string(api, "async", api_message);
+
+/// @brief Number of infer requests
+DEFINE_int32(nireq, 1, ninfer_request_message);
+
+/// @brief Number of CPU throughput streams
+DEFINE_string(nstreams, "", nstreams_message);
+
+/// @brief Iterations count (default 0)
+DEFINE_int32(niter, 0, iterations_count_message);
+
+/// @brief Run time in seconds (default 10)
+DEFINE_int32(t, 10, run_time_message);
+
+/// @brief Batch size (default 0, the batch of the model)
+DEFINE_int32(b, 0, batch_size_message);
+
+/// @brief Enable per-layer performance report
+DEFINE_bool(pc, false, performance_counter_message);
+
+/// @brief Measure the startup only
+DEFINE_bool(load_only, false, load_only_message);
+
+/// @brief Number of the startups (default 1)
+DEFINE_int32(nload, 1, nload_message);
+
+/// @brief Report the phases of the load of the network
+DEFINE_bool(load_phases, false, load_phases_message);
+
+/// @brief Path to the JSON report
+DEFINE_string(json, "", json_report_message);
+
+/// @brief Define parameter for clDNN custom kernels path <br>
+DEFINE_string(c, "", custom_cldnn_message);
+
+/// @brief Absolute path to CPU library with user layers <br>
+/// It is a optional parameter
+DEFINE_string(l, "", custom_cpu_library_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "benchmark_app [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                      " << help_message << std::endl;
+    std::cout << "    -m \"<path>\"             " << model_message << std::endl;
+    std::cout << "      -l \"<absolute_path>\"    " << custom_cpu_library_message << std::endl;
+    std::cout << "          Or" << std::endl;
+    std::cout << "      -c \"<absolute_path>\"    " << custom_cldnn_message << std::endl;
+    std::cout << "    -pp \"<path>\"            " << plugin_path_message << std::endl;
+    std::cout << "    -d \"<device>\"           " << target_device_message << std::endl;
+    std::cout << "    -api \"<sync/async>\"     " << api_message << std::endl;
+    std::cout << "    -nireq \"<integer>\"      " << ninfer_request_message << std::endl;
+    std::cout << "    -nstreams \"<integer>\"   " << nstreams_message << std::endl;
+    std::cout << "    -niter \"<integer>\"      " << iterations_count_message << std::endl;
+    std::cout << "    -t \"<integer>\"          " << run_time_message << std::endl;
+    std::cout << "    -b \"<integer>\"          " << batch_size_message << std::endl;
+    std::cout << "    -pc                     " << performance_counter_message << std::endl;
+    std::cout << "    -load_only              " << load_only_message << std::endl;
+    std::cout << "    -nload \"<integer>\"      " << nload_message << std::endl;
+    std::cout << "    -load_phases            " << load_phases_message << std::endl;
+    std::cout << "    -json \"<path>\"          " << json_report_message << std::endl;
+}
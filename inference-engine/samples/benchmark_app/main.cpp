@@ -0,0 +1,600 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+/**
+* @brief The entry point of the Inference Engine benchmark application
+* @file benchmark_app/main.cpp
+* @example benchmark_app/main.cpp
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include <ext_list.hpp>
+
+#include "benchmark_app.h"
+
+using namespace InferenceEngine;
+
+typedef std::chrono::high_resolution_clock Time;
+typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validation of input args--------------------------------------
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+    slog::info << "Parsing input parameters" << slog::endl;
+
+    if (FLAGS_m.empty()) {
+        throw std::logic_error("Parameter -m is not set");
+    }
+    if (FLAGS_api != "sync" && FLAGS_api != "async") {
+        throw std::logic_error("Parameter -api should be \"sync\" or \"async\"");
+    }
+    if (FLAGS_nireq < 1) {
+        throw std::logic_error("Parameter -nireq must be more than 0 ! (default 1)");
+    }
+    if (FLAGS_niter < 0) {
+        throw std::logic_error("Parameter -niter must not be negative ! (default 0)");
+    }
+    if (FLAGS_niter == 0 && FLAGS_t < 1) {
+        throw std::logic_error("Parameter -t must be more than 0 when -niter is not set ! (default 10)");
+    }
+    if (FLAGS_b < 0) {
+        throw std::logic_error("Parameter -b must not be negative ! (default 0)");
+    }
+    if (FLAGS_nload < 1) {
+        throw std::logic_error("Parameter -nload must be more than 0 ! (default 1)");
+    }
+
+    return true;
+}
+
+/**
+* @brief Fills the blob with the random data of its precision, the data does not matter for the timing
+*/
+template <typename T>
+void fillRandom(Blob::Ptr &blob, std::mt19937 &generator, T low, T high) {
+    std::uniform_real_distribution<float> distribution(static_cast<float>(low), static_cast<float>(high));
+    T *data = blob->buffer().as<T *>();
+    for (size_t i = 0; i < blob->size(); i++) {
+        data[i] = static_cast<T>(distribution(generator));
+    }
+}
+
+void fillBlob(Blob::Ptr &blob, std::mt19937 &generator) {
+    switch (blob->getTensorDesc().getPrecision()) {
+        case Precision::FP32:
+            fillRandom<float>(blob, generator, 0.f, 1.f);
+            break;
+        case Precision::U8:
+            fillRandom<uint8_t>(blob, generator, 0, 255);
+            break;
+        case Precision::I32:
+            fillRandom<int32_t>(blob, generator, 0, 255);
+            break;
+        default:
+            // FP16 and the fixed point inputs are filled with zeros
+            std::memset(blob->buffer(), 0, blob->byteSize());
+    }
+}
+
+/**
+* @brief The latency percentile by the nearest rank, the latencies are sorted
+*/
+double percentile(const std::vector<double> &latencies, double p) {
+    if (latencies.empty())
+        return 0.0;
+    size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * latencies.size()));
+    rank = std::min(std::max<size_t>(rank, 1), latencies.size());
+    return latencies[rank - 1];
+}
+
+std::string jsonEscape(const std::string &str) {
+    std::string escaped;
+    for (char c : str) {
+        switch (c) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            default: escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/**
+* @brief The times of a phase of the startup in milliseconds, one per load of the network
+*/
+struct StartupPhase {
+    std::string name;
+    std::vector<double> times;
+};
+
+void addStartupTime(std::vector<StartupPhase> &phases, const std::string &name, size_t load, double time) {
+    auto phase = std::find_if(phases.begin(), phases.end(), [&](const StartupPhase &p) { return p.name == name; });
+    if (phase == phases.end()) {
+        phases.push_back({name, {}});
+        phase = phases.end() - 1;
+    }
+    // the phases skipped by a load, like the ones replaced by a cache, take no time in it
+    if (phase->times.size() <= load) {
+        phase->times.resize(load + 1, 0.0);
+    }
+    phase->times[load] += time;
+}
+
+/**
+* @brief The total duration of the events of the Chrome trace written by the Inference Engine by their names,
+* in milliseconds and in the order of the first events
+*/
+std::vector<std::pair<std::string, double>> readTraceTotals(const std::string &path) {
+    std::vector<std::pair<std::string, double>> totals;
+    std::ifstream file(path);
+    const std::string nameKey = "\"name\":\"";
+    const std::string durationKey = "\"dur\":";
+    for (std::string line; std::getline(file, line);) {
+        size_t pos = line.find(nameKey);
+        if (pos == std::string::npos)
+            continue;
+        std::string name;
+        for (pos += nameKey.size(); pos < line.size() && line[pos] != '"'; pos++) {
+            if (line[pos] == '\\' && pos + 1 < line.size())
+                pos++;
+            name += line[pos];
+        }
+        pos = line.find(durationKey, pos);
+        if (pos == std::string::npos)
+            continue;
+        const double duration = std::atof(line.c_str() + pos + durationKey.size()) / 1000.0;
+        auto total = std::find_if(totals.begin(), totals.end(),
+                                  [&](const std::pair<std::string, double> &t) { return t.first == name; });
+        if (total == totals.end()) {
+            totals.emplace_back(name, duration);
+        } else {
+            total->second += duration;
+        }
+    }
+    return totals;
+}
+
+/**
+* @brief Enables the trace of the Inference Engine before its first use, the trace file of the user is kept
+* @return the path of the trace file
+*/
+std::string enableTrace(bool &created) {
+    const char *userPath = std::getenv("IE_TRACE_FILE");
+    created = userPath == nullptr || *userPath == '\0';
+    if (!created) {
+        return userPath;
+    }
+    const std::string path = "benchmark_app_trace.json";
+#ifdef _WIN32
+    _putenv_s("IE_TRACE_FILE", path.c_str());
+#else
+    setenv("IE_TRACE_FILE", path.c_str(), 1);
+#endif
+    return path;
+}
+
+double average(const std::vector<double> &times) {
+    double sum = 0.0;
+    for (double time : times) sum += time;
+    return times.empty() ? 0.0 : sum / times.size();
+}
+
+void printStartupPhase(const StartupPhase &phase, const std::string &indent) {
+    std::cout << indent << phase.name << ": " << std::string(phase.name.size() + indent.size() < 28 ?
+                                                             28 - phase.name.size() - indent.size() : 1, ' ');
+    if (phase.times.size() == 1) {
+        std::cout << phase.times.front() << " ms" << std::endl;
+        return;
+    }
+    std::vector<double> next(phase.times.begin() + 1, phase.times.end());
+    std::cout << phase.times.front() << " ms the first, " << average(next) << " ms the next on average, "
+              << *std::min_element(next.begin(), next.end()) << " ms at least" << std::endl;
+}
+
+/**
+* @brief Writes the times of the startup phases of every load of the network as the "loads" array of the report
+*/
+void writeStartupJson(std::ostream &report, const std::vector<StartupPhase> &startupPhases,
+                      const std::vector<StartupPhase> &loadPhases, size_t loads) {
+    report << "  \"loads\": [";
+    for (size_t load = 0; load < loads; load++) {
+        report << (load ? ",\n" : "\n") << "    {";
+        for (size_t i = 0; i < startupPhases.size(); i++) {
+            report << (i ? ", " : "") << "\"" << startupPhases[i].name << "_ms\": " << startupPhases[i].times[load];
+        }
+        report << ", \"phases_ms\": {";
+        for (size_t i = 0; i < loadPhases.size(); i++) {
+            report << (i ? ", " : "") << "\"" << jsonEscape(loadPhases[i].name) << "\": " << loadPhases[i].times[load];
+        }
+        report << "}}";
+    }
+    report << "\n  ]";
+}
+
+std::string layerStatus(InferenceEngineProfileInfo::LayerStatus status) {
+    switch (status) {
+        case InferenceEngineProfileInfo::EXECUTED: return "EXECUTED";
+        case InferenceEngineProfileInfo::NOT_RUN: return "NOT_RUN";
+        case InferenceEngineProfileInfo::OPTIMIZED_OUT: return "OPTIMIZED_OUT";
+        default: return "UNKNOWN";
+    }
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        // ------------------------------ Parsing and validation of input args ---------------------------------
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+
+        // the Inference Engine reads the environment at its first profiling scope, so the trace is enabled first
+        bool traceCreated = false;
+        const std::string tracePath = FLAGS_load_phases ? enableTrace(traceCreated) : "";
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 1. Load Plugin for inference engine -------------------------------------
+        slog::info << "Loading plugin" << slog::endl;
+        InferencePlugin plugin = PluginDispatcher({ FLAGS_pp, "../../../lib/intel64" , "" }).getPluginByDevice(FLAGS_d);
+
+        /** Loading default extensions **/
+        if (FLAGS_d.find("CPU") != std::string::npos) {
+            plugin.AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+        }
+        if (!FLAGS_l.empty()) {
+            // CPU(MKLDNN) extensions are loaded as a shared library and passed as a pointer to base extension
+            IExtensionPtr extension_ptr = make_so_pointer<IExtension>(FLAGS_l);
+            plugin.AddExtension(extension_ptr);
+            slog::info << "CPU Extension loaded: " << FLAGS_l << slog::endl;
+        }
+        if (!FLAGS_c.empty()) {
+            // clDNN Extensions are loaded from an .xml description and OpenCL kernel files
+            plugin.SetConfig({{PluginConfigParams::KEY_CONFIG_FILE, FLAGS_c}});
+            slog::info << "GPU Extension loaded: " << FLAGS_c << slog::endl;
+        }
+
+        /** Printing plugin version **/
+        printPluginVersion(plugin, std::cout);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 2. Configure the plugin ------------------------------------------------
+        std::map<std::string, std::string> config;
+        if (FLAGS_pc) {
+            config[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
+        }
+        if (!FLAGS_nstreams.empty()) {
+            if (FLAGS_d.find("CPU") != std::string::npos) {
+                config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] =
+                        FLAGS_nstreams == "auto" ? PluginConfigParams::CPU_THROUGHPUT_AUTO : FLAGS_nstreams;
+            } else {
+                slog::warn << "The streams are supported only by the CPU plugin, -nstreams is ignored" << slog::endl;
+            }
+        }
+
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 3. Read IR, load the model to the plugin and create a request -----------
+        // the startup is repeated from the read of the files, the network of the last one is inferred
+        const size_t loads = static_cast<size_t>(FLAGS_nload);
+        std::vector<StartupPhase> startupPhases;
+        std::vector<StartupPhase> loadPhases;
+        CNNNetwork network;
+        ExecutableNetwork executableNetwork;
+        InferRequest firstRequest;
+        double loadTime = 0.0;
+        for (size_t load = 0; load < loads; load++) {
+            // the previous network is released before the next one is loaded
+            firstRequest = InferRequest();
+            executableNetwork = ExecutableNetwork();
+
+            slog::info << "Loading network files" << slog::endl;
+            CNNNetReader networkReader;
+            auto start = Time::now();
+            networkReader.ReadNetwork(FLAGS_m);
+            addStartupTime(startupPhases, "ReadNetwork", load, std::chrono::duration_cast<ms>(Time::now() - start).count());
+            start = Time::now();
+            networkReader.ReadWeights(fileNameNoExt(FLAGS_m) + ".bin");
+            addStartupTime(startupPhases, "ReadWeights", load, std::chrono::duration_cast<ms>(Time::now() - start).count());
+            network = networkReader.getNetwork();
+            if (FLAGS_b != 0) {
+                network.setBatchSize(FLAGS_b);
+            }
+
+            slog::info << "Loading model to the plugin" << slog::endl;
+            const auto traceBefore = tracePath.empty() ? std::vector<std::pair<std::string, double>>()
+                                                       : readTraceTotals(tracePath);
+            start = Time::now();
+            executableNetwork = plugin.LoadNetwork(network, config);
+            loadTime = std::chrono::duration_cast<ms>(Time::now() - start).count();
+            addStartupTime(startupPhases, "LoadNetwork", load, loadTime);
+            if (!tracePath.empty()) {
+                // the plugin writes the events of the load to the trace before it returns
+                for (const auto &total : readTraceTotals(tracePath)) {
+                    auto before = std::find_if(traceBefore.begin(), traceBefore.end(),
+                                               [&](const std::pair<std::string, double> &t) { return t.first == total.first; });
+                    const double time = total.second - (before != traceBefore.end() ? before->second : 0.0);
+                    // the scope of the whole load is the time of the load itself
+                    if (time > 0.0 && total.first != "LoadNetwork") {
+                        addStartupTime(loadPhases, total.first, load, time);
+                    }
+                }
+            }
+
+            start = Time::now();
+            firstRequest = executableNetwork.CreateInferRequest();
+            addStartupTime(startupPhases, "CreateInferRequest", load,
+                           std::chrono::duration_cast<ms>(Time::now() - start).count());
+        }
+        for (auto &phase : loadPhases) {
+            phase.times.resize(loads, 0.0);
+        }
+        if (FLAGS_load_phases && loadPhases.empty()) {
+            slog::warn << "No phases of the load are found in the trace " << tracePath << slog::endl;
+        }
+
+        const size_t batchSize = network.getBatchSize();
+        slog::info << "Batch size is " << batchSize << slog::endl;
+        slog::info << "Load time: " << loadTime << " ms" << slog::endl;
+
+        std::cout << std::endl << "Startup:" << std::endl;
+        for (const auto &phase : startupPhases) {
+            printStartupPhase(phase, "");
+            if (phase.name == "LoadNetwork") {
+                for (const auto &loadPhase : loadPhases) {
+                    printStartupPhase(loadPhase, "  ");
+                }
+            }
+        }
+        std::cout << std::endl;
+
+        if (FLAGS_load_only) {
+            if (!FLAGS_json.empty()) {
+                std::ofstream report(FLAGS_json, std::ios::out | std::ios::trunc);
+                if (!report.is_open()) {
+                    throw std::logic_error("Cannot open the JSON report file " + FLAGS_json);
+                }
+                report << "{\n"
+                       << "  \"model\": \"" << jsonEscape(FLAGS_m) << "\",\n"
+                       << "  \"device\": \"" << jsonEscape(FLAGS_d) << "\",\n"
+                       << "  \"batch\": " << batchSize << ",\n";
+                writeStartupJson(report, startupPhases, loadPhases, loads);
+                report << "\n}\n";
+                slog::info << "The results are written to " << FLAGS_json << slog::endl;
+            }
+            if (traceCreated) {
+                std::remove(tracePath.c_str());
+            }
+            slog::info << "Execution successful" << slog::endl;
+            return 0;
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 4. Create infer requests and fill the inputs ----------------------------
+        const size_t requestsNum = FLAGS_api == "sync" ? 1 : static_cast<size_t>(FLAGS_nireq);
+        std::vector<InferRequest> inferRequests;
+        std::mt19937 generator(0);
+        for (size_t i = 0; i < requestsNum; i++) {
+            inferRequests.push_back(i == 0 ? firstRequest : executableNetwork.CreateInferRequest());
+            for (auto &input : network.getInputsInfo()) {
+                Blob::Ptr blob = inferRequests.back().GetBlob(input.first);
+                fillBlob(blob, generator);
+            }
+        }
+
+        // the first inference of every request allocates and initializes the data, it is not measured
+        for (auto &request : inferRequests) {
+            request.Infer();
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 5. Do inference ---------------------------------------------------------
+        if (FLAGS_niter > 0) {
+            slog::info << "Start inference " << FLAGS_api << "hronously (" << FLAGS_niter << " iterations, "
+                       << requestsNum << " requests)" << slog::endl;
+        } else {
+            slog::info << "Start inference " << FLAGS_api << "hronously (" << FLAGS_t << " seconds, "
+                       << requestsNum << " requests)" << slog::endl;
+        }
+
+        std::vector<double> latencies;
+        const auto runStart = Time::now();
+        const auto runLimit = std::chrono::seconds(FLAGS_t);
+        const size_t iterationsLimit = static_cast<size_t>(FLAGS_niter);
+        size_t started = 0;
+        auto canStart = [&]() {
+            return iterationsLimit > 0 ? started < iterationsLimit : Time::now() - runStart < runLimit;
+        };
+
+        if (FLAGS_api == "sync") {
+            while (canStart()) {
+                started++;
+                auto start = Time::now();
+                inferRequests[0].Infer();
+                latencies.push_back(std::chrono::duration_cast<ms>(Time::now() - start).count());
+            }
+        } else {
+            // every completed request is restarted by its callback until the limit is reached,
+            // so the requests never wait for the main thread
+            std::mutex mutex;
+            std::condition_variable allDone;
+            size_t running = 0;
+            std::string error;
+            std::vector<Time::time_point> starts(requestsNum);
+
+            for (size_t i = 0; i < requestsNum; i++) {
+                inferRequests[i].SetCompletionCallback(
+                        std::function<void(InferRequest, StatusCode)>([&, i](InferRequest, StatusCode code) {
+                    auto end = Time::now();
+                    bool restart = false;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        latencies.push_back(std::chrono::duration_cast<ms>(end - starts[i]).count());
+                        if (code != StatusCode::OK && error.empty()) {
+                            error = "Inference failed with the status " + std::to_string(code);
+                        }
+                        restart = error.empty() && canStart();
+                        if (restart) {
+                            started++;
+                            starts[i] = Time::now();
+                        }
+                    }
+                    if (restart) {
+                        try {
+                            inferRequests[i].StartAsync();
+                            return;
+                        } catch (const std::exception &ex) {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            error = ex.what();
+                        }
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        running--;
+                    }
+                    allDone.notify_all();
+                }));
+            }
+
+            for (size_t i = 0; i < requestsNum; i++) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!canStart())
+                        break;
+                    started++;
+                    running++;
+                    starts[i] = Time::now();
+                }
+                inferRequests[i].StartAsync();
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            allDone.wait(lock, [&] { return running == 0; });
+            if (!error.empty()) {
+                throw std::logic_error(error);
+            }
+        }
+        const double totalTime = std::chrono::duration_cast<ms>(Time::now() - runStart).count();
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 6. Report the results ---------------------------------------------------
+        std::sort(latencies.begin(), latencies.end());
+        const size_t iterations = latencies.size();
+        double avgLatency = 0.0;
+        for (double latency : latencies) avgLatency += latency;
+        avgLatency = iterations ? avgLatency / iterations : 0.0;
+        const double fps = totalTime > 0 ? 1000.0 * iterations * batchSize / totalTime : 0.0;
+
+        std::cout << std::endl;
+        std::cout << "Iterations:      " << iterations << std::endl;
+        std::cout << "Duration:        " << totalTime << " ms" << std::endl;
+        std::cout << "Load time:       " << loadTime << " ms" << std::endl;
+        std::cout << "Latency average: " << avgLatency << " ms" << std::endl;
+        std::cout << "Latency p50:     " << percentile(latencies, 50) << " ms" << std::endl;
+        std::cout << "Latency p90:     " << percentile(latencies, 90) << " ms" << std::endl;
+        std::cout << "Latency p99:     " << percentile(latencies, 99) << " ms" << std::endl;
+        std::cout << "Throughput:      " << fps << " FPS" << std::endl;
+        std::cout << std::endl;
+
+        std::map<std::string, InferenceEngineProfileInfo> performanceMap;
+        if (FLAGS_pc) {
+            performanceMap = inferRequests[0].GetPerformanceCounts();
+            printPerformanceCounts(performanceMap, std::cout);
+        }
+
+        if (!FLAGS_json.empty()) {
+            std::ofstream report(FLAGS_json, std::ios::out | std::ios::trunc);
+            if (!report.is_open()) {
+                throw std::logic_error("Cannot open the JSON report file " + FLAGS_json);
+            }
+            report << "{\n"
+                   << "  \"model\": \"" << jsonEscape(FLAGS_m) << "\",\n"
+                   << "  \"device\": \"" << jsonEscape(FLAGS_d) << "\",\n"
+                   << "  \"api\": \"" << FLAGS_api << "\",\n"
+                   << "  \"nireq\": " << requestsNum << ",\n"
+                   << "  \"nstreams\": \"" << jsonEscape(FLAGS_nstreams) << "\",\n"
+                   << "  \"batch\": " << batchSize << ",\n"
+                   << "  \"load_time_ms\": " << loadTime << ",\n"
+                   << "  \"iterations\": " << iterations << ",\n"
+                   << "  \"duration_ms\": " << totalTime << ",\n"
+                   << "  \"fps\": " << fps << ",\n"
+                   << "  \"latency_ms\": {\"avg\": " << avgLatency
+                   << ", \"min\": " << (iterations ? latencies.front() : 0.0)
+                   << ", \"p50\": " << percentile(latencies, 50)
+                   << ", \"p90\": " << percentile(latencies, 90)
+                   << ", \"p99\": " << percentile(latencies, 99)
+                   << ", \"max\": " << (iterations ? latencies.back() : 0.0) << "},\n";
+            writeStartupJson(report, startupPhases, loadPhases, loads);
+            report << ",\n  \"layers\": [";
+            bool first = true;
+            for (const auto &layer : performanceMap) {
+                report << (first ? "\n" : ",\n")
+                       << "    {\"name\": \"" << jsonEscape(layer.first) << "\""
+                       << ", \"status\": \"" << layerStatus(layer.second.status) << "\""
+                       << ", \"layer_type\": \"" << jsonEscape(layer.second.layer_type) << "\""
+                       << ", \"exec_type\": \"" << jsonEscape(layer.second.exec_type) << "\""
+                       << ", \"real_time_us\": " << layer.second.realTime_uSec
+                       << ", \"cpu_time_us\": " << layer.second.cpu_uSec << "}";
+                first = false;
+            }
+            report << (first ? "]\n" : "\n  ]\n") << "}\n";
+            slog::info << "The results are written to " << FLAGS_json << slog::endl;
+        }
+        if (traceCreated) {
+            std::remove(tracePath.c_str());
+        }
+        // -----------------------------------------------------------------------------------------------------
+    }
+    catch (const std::exception& error) {
+        slog::err << error.what() << slog::endl;
+        return 1;
+    }
+    catch (...) {
+        slog::err << "Unknown/internal exception happened." << slog::endl;
+        return 1;
+    }
+
+    slog::info << "Execution successful" << slog::endl;
+    return 0;
+}
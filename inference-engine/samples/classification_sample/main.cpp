@@ -15,6 +15,7 @@
 */
 
 #include <fstream>
+#include <algorithm>
 #include <vector>
 #include <chrono>
 #include <memory>
@@ -23,6 +24,7 @@
 #include <inference_engine.hpp>
 #include <ext_list.hpp>
 #include <format_reader_ptr.h>
+#include <batch_reader.h>
 
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
@@ -143,25 +145,8 @@ int main(int argc, char *argv[]) {
         inputInfoItem.second->setPrecision(Precision::U8);
         inputInfoItem.second->setLayout(Layout::NCHW);
 
-        std::vector<std::shared_ptr<unsigned char>> imagesData;
-        for (auto & i : imageNames) {
-            FormatReader::ReaderPtr reader(i.c_str());
-            if (reader.get() == nullptr) {
-                slog::warn << "Image " + i + " cannot be read!" << slog::endl;
-                continue;
-            }
-            /** Store image data **/
-            std::shared_ptr<unsigned char> data(
-                    reader->getData(inputInfoItem.second->getTensorDesc().getDims()[3],
-                                    inputInfoItem.second->getTensorDesc().getDims()[2]));
-            if (data.get() != nullptr) {
-                imagesData.push_back(data);
-            }
-        }
-        if (imagesData.empty()) throw std::logic_error("Valid input images were not found!");
-
-        /** Setting batch size using image count **/
-        network.setBatchSize(imagesData.size());
+        /** Setting batch size using image count, the images are read right to the input blob later **/
+        network.setBatchSize(imageNames.size());
         size_t batchSize = network.getBatchSize();
         slog::info << "Batch size is " << std::to_string(batchSize) << slog::endl;
 
@@ -220,22 +205,20 @@ int main(int argc, char *argv[]) {
             Blob::Ptr input = infer_request.GetBlob(item.first);
 
             /** Filling input tensor with images. First b channel, then g and r channels **/
-            size_t num_channels = input->getTensorDesc().getDims()[1];
-            size_t image_size = input->getTensorDesc().getDims()[2] * input->getTensorDesc().getDims()[3];
-
+            const SizeVector dims = input->getTensorDesc().getDims();
             auto data = input->buffer().as<PrecisionTrait<Precision::U8>::value_type*>();
 
-            /** Iterate over all input images **/
-            for (size_t image_id = 0; image_id < imagesData.size(); ++image_id) {
-                /** Iterate over all pixel in image (b,g,r) **/
-                for (size_t pid = 0; pid < image_size; pid++) {
-                    /** Iterate over all channels **/
-                    for (size_t ch = 0; ch < num_channels; ++ch) {
-                        /**          [images stride + channels stride + pixel id ] all in bytes            **/
-                        data[image_id * image_size * num_channels + ch * image_size + pid ] = imagesData.at(image_id).get()[pid*num_channels + ch];
-                    }
+            /** The images are decoded in parallel, each of them right to its slot of the batch **/
+            const std::vector<bool> isRead = FormatReader::readBatch(imageNames, data, dims[1], dims[2], dims[3],
+                                                                     FormatReader::BatchLayout::NCHW);
+            for (size_t image_id = 0; image_id < imageNames.size(); ++image_id) {
+                if (!isRead[image_id]) {
+                    slog::warn << "Image " + imageNames[image_id] + " cannot be read, its input is filled with zeros!" << slog::endl;
                 }
             }
+            if (std::find(isRead.begin(), isRead.end(), true) == isRead.end()) {
+                throw std::logic_error("Valid input images were not found!");
+            }
         }
         inputInfo = {};
         // -----------------------------------------------------------------------------------------------------
@@ -0,0 +1,95 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * \brief Reading of the batch of images in parallel
+ * \file batch_reader.h
+ */
+#pragma once
+
+#include "format_reader_ptr.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace FormatReader {
+/**
+ * \brief The layout of the images in the batch
+ */
+enum class BatchLayout {
+    NCHW,
+    NHWC
+};
+
+/**
+ * \brief Decodes the images and writes every image to its slot of the batch in the given layout and precision,
+ * so no intermediate copies of the images are kept. The images are decoded by several threads at once.
+ * The slot of the image which cannot be read, has other number of channels or cannot be resized to the size
+ * of the batch (only OpenCV resizes the images) is filled with zeros.
+ * @param files - the images, the i-th image goes to the i-th slot of the batch
+ * @param dst - the batch of files.size() images of channels x height x width
+ * @param threads - the number of the threads, 0 means the number of the cores
+ * @return the images which are read
+ */
+template <typename T>
+std::vector<bool> readBatch(const std::vector<std::string> &files, T *dst, size_t channels, size_t height,
+                            size_t width, BatchLayout layout, size_t threads = 0) {
+    const size_t imageSize = channels * height * width;
+    std::vector<char> isRead(files.size(), 0);
+
+    auto readImage = [&](size_t id) {
+        T *slot = dst + id * imageSize;
+        ReaderPtr reader(files[id].c_str());
+        if (reader.get() != nullptr && reader->width() * reader->height() != 0 &&
+                reader->size() / (reader->width() * reader->height()) == channels) {
+            std::shared_ptr<unsigned char> data = reader->getData(static_cast<int>(width), static_cast<int>(height));
+            if (data.get() != nullptr) {
+                /** The decoded images are interleaved, the channels of a pixel follow each other **/
+                const unsigned char *src = data.get();
+                if (layout == BatchLayout::NHWC) {
+                    for (size_t i = 0; i < imageSize; i++)
+                        slot[i] = static_cast<T>(src[i]);
+                } else {
+                    const size_t planeSize = height * width;
+                    for (size_t ch = 0; ch < channels; ch++) {
+                        T *plane = slot + ch * planeSize;
+                        for (size_t pid = 0; pid < planeSize; pid++)
+                            plane[pid] = static_cast<T>(src[pid * channels + ch]);
+                    }
+                }
+                isRead[id] = 1;
+                return;
+            }
+        }
+        std::memset(slot, 0, imageSize * sizeof(T));
+    };
+
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, files.size());
+
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t id = next++; id < files.size(); id = next++) {
+            try {
+                readImage(id);
+            } catch (...) {
+                std::memset(dst + id * imageSize, 0, imageSize * sizeof(T));
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threads; i++)
+        workers.emplace_back(worker);
+    worker();
+    for (auto &w : workers)
+        w.join();
+
+    return std::vector<bool>(isRead.begin(), isRead.end());
+}
+}  // namespace FormatReader
@@ -0,0 +1,93 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message.";
+
+/// @brief message for model argument
+static const char model_message[] = "Path to an .xml file with a trained model to tune.";
+
+/// @brief message for tuning file argument
+static const char tuning_file_message[] = "Required. Path to the tuning file. The kernels tuned for the model and the merged files " \
+                                          "are appended to it.";
+
+/// @brief message for merged files argument
+static const char merge_message[] = "Comma separated paths to the tuning files, possibly created on other machines, " \
+                                    "which are merged into the tuning file.";
+
+/// @brief message for batch argument
+static const char batch_message[] = "Batch size the model is tuned for (default is the batch of the model).";
+
+/// @brief message for network-level tuning argument
+static const char network_tuning_message[] = "Also tune the layouts of the whole network, including the cost of the reorders between the layers.";
+
+/// @brief message for plugin_path argument
+static const char plugin_path_message[] = "Path to a plugin folder.";
+
+/// @brief message for clDNN custom kernels desc
+static const char custom_cldnn_message[] = "Required for clDNN (GPU)-targeted custom kernels."\
+                                            "Absolute path to the xml file with the kernels desc.";
+
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Define parameter for set model file <br>
+DEFINE_string(m, "", model_message);
+
+/// @brief Define parameter for set tuning file <br>
+/// It is a required parameter
+DEFINE_string(t, "", tuning_file_message);
+
+/// @brief Define parameter for set merged tuning files <br>
+DEFINE_string(merge, "", merge_message);
+
+/// @brief Batch size (default 0 means the batch of the model) <br>
+DEFINE_int32(b, 0, batch_message);
+
+/// @brief Enable network-level tuning of the layouts
+DEFINE_bool(net, false, network_tuning_message);
+
+/// @brief Define parameter for set path to plugins <br>
+DEFINE_string(pp, "", plugin_path_message);
+
+/// @brief Define parameter for clDNN custom kernels path <br>
+DEFINE_string(c, "", custom_cldnn_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "gpu_tuning_tool [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                      " << help_message << std::endl;
+    std::cout << "    -t \"<path>\"             " << tuning_file_message << std::endl;
+    std::cout << "    -m \"<path>\"             " << model_message << std::endl;
+    std::cout << "    -b \"<integer>\"          " << batch_message << std::endl;
+    std::cout << "    -net                    " << network_tuning_message << std::endl;
+    std::cout << "    -merge \"<path1>,<path2>\"" << merge_message << std::endl;
+    std::cout << "    -c \"<absolute_path>\"    " << custom_cldnn_message << std::endl;
+    std::cout << "    -pp \"<path>\"            " << plugin_path_message << std::endl;
+}
@@ -0,0 +1,163 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <string>
+
+#include <inference_engine.hpp>
+#include <cldnn/cldnn_config.hpp>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include "gpu_tuning_tool.h"
+
+using namespace InferenceEngine;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validation of input args--------------------------------------
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+    slog::info << "Parsing input parameters" << slog::endl;
+
+    if (FLAGS_t.empty()) {
+        throw std::logic_error("Parameter -t is not set");
+    }
+
+    if (FLAGS_m.empty() && FLAGS_merge.empty()) {
+        throw std::logic_error("Neither -m nor -merge is set, there is nothing to do");
+    }
+
+    if (FLAGS_b < 0) {
+        throw std::logic_error("Parameter -b should not be negative");
+    }
+
+    return true;
+}
+
+/**
+* @brief Appends the tuning files to the output one.
+* The tuning file consists of the sections of the devices, so the concatenated files are a valid tuning file, and
+* the plugin loads the entries of the sections of the device it runs on
+*/
+void MergeTuningFiles(const std::string &output, const std::string &inputs) {
+    std::stringstream list(inputs);
+    std::string input;
+    while (std::getline(list, input, ',')) {
+        if (input.empty()) {
+            continue;
+        }
+        std::ifstream inputFile(input);
+        if (!inputFile) {
+            throw std::logic_error("Cannot open the tuning file " + input);
+        }
+        std::ofstream outputFile(output, std::ofstream::out | std::ofstream::app);
+        if (!outputFile) {
+            throw std::logic_error("Cannot write the tuning file " + output);
+        }
+        // the last line of the output file may have no line break
+        outputFile << "\n" << inputFile.rdbuf();
+        slog::info << "Merged " << input << slog::endl;
+    }
+}
+
+/**
+* @brief The entry point of the tool which tunes the GPU kernels of the model and merges the tuning files
+* created on the machines with the same GPU
+* @file gpu_tuning_tool/main.cpp
+* @example gpu_tuning_tool/main.cpp
+*/
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        // ------------------------------ Parsing and validation of input args ---------------------------------
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 1. Merge the tuning files -----------------------------------------------
+        if (!FLAGS_merge.empty()) {
+            MergeTuningFiles(FLAGS_t, FLAGS_merge);
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        if (!FLAGS_m.empty()) {
+            // --------------------------- 2. Load Plugin for inference engine ---------------------------------
+            slog::info << "Loading plugin" << slog::endl;
+            InferencePlugin plugin = PluginDispatcher({ FLAGS_pp, "../../../lib/intel64" , "" }).getPluginByDevice("GPU");
+
+            if (!FLAGS_c.empty()) {
+                // clDNN Extensions are loaded from an .xml description and OpenCL kernel files
+                plugin.SetConfig({{PluginConfigParams::KEY_CONFIG_FILE, FLAGS_c}});
+                slog::info << "GPU Extension loaded: " << FLAGS_c << slog::endl;
+            }
+
+            /** Printing plugin version **/
+            printPluginVersion(plugin, std::cout);
+            // -------------------------------------------------------------------------------------------------
+
+            // --------------------------- 3. Read IR Generated by ModelOptimizer (.xml and .bin files) --------
+            std::string binFileName = fileNameNoExt(FLAGS_m) + ".bin";
+            slog::info << "Loading network files:"
+                    "\n\t" << FLAGS_m <<
+                    "\n\t" << binFileName <<
+            slog::endl;
+
+            CNNNetReader networkReader;
+            networkReader.ReadNetwork(FLAGS_m);
+            networkReader.ReadWeights(binFileName);
+            CNNNetwork network = networkReader.getNetwork();
+
+            /** The kernels are tuned for the shapes of the batch the model runs with **/
+            if (FLAGS_b > 0) {
+                network.setBatchSize(FLAGS_b);
+            }
+            slog::info << "Batch size is " << std::to_string(network.getBatchSize()) << slog::endl;
+            // -------------------------------------------------------------------------------------------------
+
+            // --------------------------- 4. Tune the kernels of the model ------------------------------------
+            // the kernels found in the tuning file are taken from it, the rest are tuned and appended to the file
+            slog::info << "Tuning the kernels of the model to " << FLAGS_t << slog::endl;
+            std::map<std::string, std::string> config = {
+                { PluginConfigParams::KEY_TUNING_MODE,
+                  FLAGS_net ? CLDNNConfigParams::CLDNN_TUNING_CREATE_NETWORK : PluginConfigParams::TUNING_CREATE },
+                { PluginConfigParams::KEY_TUNING_FILE, FLAGS_t },
+                { PluginConfigParams::KEY_LOG_LEVEL, PluginConfigParams::LOG_INFO },
+            };
+            ExecutableNetwork executableNetwork = plugin.LoadNetwork(network, config);
+            // -------------------------------------------------------------------------------------------------
+        }
+    }
+    catch (const std::exception& error) {
+        slog::err << "" << error.what() << slog::endl;
+        return 1;
+    }
+    catch (...) {
+        slog::err << "Unknown/internal exception happened." << slog::endl;
+        return 1;
+    }
+
+    slog::info << "Execution successful" << slog::endl;
+    return 0;
+}
@@ -0,0 +1,333 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include "CalibrationStatisticsCollector.hpp"
+#include "classification_set_generator.hpp"
+#include "console_progress.hpp"
+#include "image_decoder.hpp"
+#include "pugixml/pugixml.hpp"
+
+using namespace InferenceEngine;
+
+using InferenceEngine::details::InferenceEngineException;
+
+namespace {
+
+constexpr size_t lanes = 16;
+
+/**
+ * @brief Updates min and max by the count contiguous values. The lanes are reduced independently,
+ *        so the compiler vectorizes the main loop
+ */
+template <typename T>
+void contiguousMinMax(const T* data, size_t count, float& min, float& max) {
+    float laneMin[lanes];
+    float laneMax[lanes];
+    std::fill(laneMin, laneMin + lanes, min);
+    std::fill(laneMax, laneMax + lanes, max);
+
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes) {
+        for (size_t l = 0; l < lanes; l++) {
+            float val = static_cast<float>(data[i + l]);
+            laneMin[l] = val < laneMin[l] ? val : laneMin[l];
+            laneMax[l] = val > laneMax[l] ? val : laneMax[l];
+        }
+    }
+    for (; i < count; i++) {
+        float val = static_cast<float>(data[i]);
+        laneMin[0] = val < laneMin[0] ? val : laneMin[0];
+        laneMax[0] = val > laneMax[0] ? val : laneMax[0];
+    }
+
+    for (size_t l = 0; l < lanes; l++) {
+        min = std::min(min, laneMin[l]);
+        max = std::max(max, laneMax[l]);
+    }
+}
+
+/**
+ * @brief Updates the per-channel min and max by the rows of the channels values (the channels are the contiguous dimension)
+ */
+template <typename T>
+void interleavedMinMax(const T* data, size_t rows, size_t channels, float* min, float* max) {
+    for (size_t r = 0; r < rows; r++) {
+        const T* row = data + r * channels;
+        for (size_t c = 0; c < channels; c++) {
+            float val = static_cast<float>(row[c]);
+            min[c] = val < min[c] ? val : min[c];
+            max[c] = val > max[c] ? val : max[c];
+        }
+    }
+}
+
+/**
+ * @brief Computes the per-channel min and max of an image of the blob
+ */
+template <typename T>
+void imageMinMax(const Blob& blob, size_t image, float* min, float* max) {
+    const TensorDesc& desc = blob.getTensorDesc();
+    const SizeVector& dims = desc.getDims();
+    size_t channels = dims[1];
+    size_t spatial = 1;
+    for (size_t i = 2; i < dims.size(); i++) {
+        spatial *= dims[i];
+    }
+
+    const T* data = blob.cbuffer().as<const T*>() + desc.getBlockingDesc().getOffsetPadding() + image * channels * spatial;
+    if (desc.getLayout() == Layout::NHWC) {
+        interleavedMinMax(data, spatial, channels, min, max);
+    } else {
+        for (size_t c = 0; c < channels; c++) {
+            contiguousMinMax(data + c * spatial, spatial, min[c], max[c]);
+        }
+    }
+}
+
+/**
+ * @brief Takes the percentile of the values, the nearest rank is used
+ */
+float percentileOf(std::vector<float> values, float percentile) {
+    size_t rank = static_cast<size_t>(std::round(percentile / 100.f * (values.size() - 1)));
+    std::nth_element(values.begin(), values.begin() + rank, values.end());
+    return values[rank];
+}
+
+std::string joinCommas(const std::vector<float>& values) {
+    std::string res;
+    for (size_t i = 0; i < values.size(); i++) {
+        res += std::to_string(values[i]);
+        if (i < values.size() - 1) {
+            res += ", ";
+        }
+    }
+    return res;
+}
+
+}  // namespace
+
+CalibrationStatisticsCollector::CalibrationStatisticsCollector(const std::string& flags_m, const std::string& flags_i, int flags_b,
+        InferencePlugin plugin, PreprocessingOptions preprocessingOptions, int requestsNumber, float percentile)
+    : modelFileName(flags_m), imagesPath(flags_i), batch(flags_b), requestsNumber(requestsNumber), percentile(percentile),
+      preprocessingOptions(preprocessingOptions), plugin(plugin) {
+    if (requestsNumber < 1) {
+        THROW_IE_EXCEPTION << "The number of the infer requests should be positive";
+    }
+    if (percentile <= 0.f || percentile > 100.f) {
+        THROW_IE_EXCEPTION << "The percentile should be in (0, 100]";
+    }
+
+    slog::info << "Loading network files" << slog::endl;
+    networkReader.ReadNetwork(modelFileName);
+    if (!networkReader.isParseSuccess()) THROW_IE_EXCEPTION << "cannot load a failed Model";
+    networkReader.ReadWeights(fileNameNoExt(modelFileName) + ".bin");
+
+    CNNNetwork network = networkReader.getNetwork();
+    if (batch == 0) {
+        batch = network.getBatchSize();
+    } else {
+        network.setBatchSize(batch);
+    }
+
+    InputsDataMap inputInfo = network.getInputsInfo();
+    if (inputInfo.size() != 1) {
+        THROW_IE_EXCEPTION << "This app accepts networks having only one input";
+    }
+    inputName = inputInfo.begin()->first;
+
+    // every layer becomes an output of the network, the outputs are added after the traversal of the layers
+    std::vector<std::string> layers;
+    for (const CNNLayerPtr& layer : network) {
+        if (layer->type != "Input" && !layer->outData.empty()) {
+            layers.push_back(layer->name);
+        }
+    }
+    for (const std::string& layer : layers) {
+        network.addOutput(layer);
+    }
+
+    for (auto& output : network.getOutputsInfo()) {
+        output.second->setPrecision(Precision::FP32);
+        CNNLayerPtr creator = output.second->getCreatorLayer().lock();
+        if (creator) {
+            outputLayers[output.first] = creator->name;
+        }
+    }
+}
+
+void CalibrationStatisticsCollector::accumulate(const std::string& layerName, const Blob& blob, size_t images) {
+    const SizeVector& dims = blob.getTensorDesc().getDims();
+    if (dims.size() < 2) {
+        return;
+    }
+    images = std::min(images, dims[0]);
+    size_t channels = dims[1];
+
+    LayerStatistics& layerStats = statistics[layerName];
+    if (layerStats.channels == 0) {
+        layerStats.channels = channels;
+        layerStats.min.assign(channels, std::numeric_limits<float>::max());
+        layerStats.max.assign(channels, std::numeric_limits<float>::lowest());
+    }
+
+    std::vector<float> min(channels);
+    std::vector<float> max(channels);
+    for (size_t image = 0; image < images; image++) {
+        std::fill(min.begin(), min.end(), std::numeric_limits<float>::max());
+        std::fill(max.begin(), max.end(), std::numeric_limits<float>::lowest());
+        switch (blob.precision()) {
+        case Precision::FP32:
+            imageMinMax<float>(blob, image, min.data(), max.data());
+            break;
+        case Precision::U8:
+            imageMinMax<uint8_t>(blob, image, min.data(), max.data());
+            break;
+        case Precision::I16:
+            imageMinMax<int16_t>(blob, image, min.data(), max.data());
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported precision " << blob.precision().name() << " of the blob of the layer " << layerName;
+        }
+
+        for (size_t c = 0; c < channels; c++) {
+            layerStats.min[c] = std::min(layerStats.min[c], min[c]);
+            layerStats.max[c] = std::max(layerStats.max[c], max[c]);
+        }
+        if (percentile < 100.f) {
+            layerStats.imagesMin.insert(layerStats.imagesMin.end(), min.begin(), min.end());
+            layerStats.imagesMax.insert(layerStats.imagesMax.end(), max.begin(), max.end());
+        }
+    }
+}
+
+size_t CalibrationStatisticsCollector::Collect() {
+    ClassificationSetGenerator generator;
+    std::vector<std::string> images = generator.getImagesList(imagesPath);
+    if (images.empty()) {
+        THROW_IE_EXCEPTION << "No images found in " << imagesPath;
+    }
+
+    slog::info << "Loading model to the plugin" << slog::endl;
+    ExecutableNetwork executableNetwork = plugin.LoadNetwork(networkReader.getNetwork(), {});
+    std::vector<InferRequest> requests;
+    for (int r = 0; r < requestsNumber; r++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+    }
+
+    slog::info << "Collecting statistics over " << images.size() << " images with " << requestsNumber
+               << " infer requests" << slog::endl;
+    ImageDecoder decoder;
+    ConsoleProgress progress(images.size());
+    size_t processed = 0;
+
+    // the number of the images in the running requests, the results of a request are accumulated while the others run
+    std::vector<int> inFlight(requests.size(), 0);
+    auto complete = [&](size_t r) {
+        StatusCode status = requests[r].Wait(IInferRequest::WaitMode::RESULT_READY);
+        if (status != StatusCode::OK) {
+            THROW_IE_EXCEPTION << "Infer request failed with status " << status;
+        }
+        for (auto& output : outputLayers) {
+            accumulate(output.second, *requests[r].GetBlob(output.first), inFlight[r]);
+        }
+        progress.addProgress(inFlight[r]);
+        processed += inFlight[r];
+        inFlight[r] = 0;
+    };
+
+    size_t r = 0;
+    auto image = images.begin();
+    while (image != images.end()) {
+        if (inFlight[r] > 0) {
+            complete(r);
+        }
+
+        Blob::Ptr input = requests[r].GetBlob(inputName);
+        int b = 0;
+        for (; b < batch && image != images.end(); image++) {
+            try {
+                decoder.insertIntoBlob(*image, b, *input, preprocessingOptions);
+                b++;
+            } catch (const InferenceEngineException& iex) {
+                // Could be some non-image file in directory
+                slog::warn << "Can't read file " << *image << slog::endl;
+            }
+        }
+        if (b == 0) {
+            continue;
+        }
+
+        accumulate(inputName, *input, b);
+        inFlight[r] = b;
+        requests[r].StartAsync();
+        r = (r + 1) % requests.size();
+    }
+    for (size_t i = 0; i < requests.size(); i++) {
+        if (inFlight[i] > 0) {
+            complete(i);
+        }
+    }
+    progress.finish();
+
+    return processed;
+}
+
+void CalibrationStatisticsCollector::Save(const std::string& xmlPath) const {
+    pugi::xml_document doc;
+
+    auto stats = doc.append_child("stats");
+    stats.append_attribute("version").set_value("1");
+    auto layers = stats.append_child("layers");
+
+    for (auto& item : statistics) {
+        const LayerStatistics& layerStats = item.second;
+        std::vector<float> min = layerStats.min;
+        std::vector<float> max = layerStats.max;
+
+        size_t images = layerStats.imagesMax.size() / layerStats.channels;
+        if (images > 0) {
+            std::vector<float> channelMin(images);
+            std::vector<float> channelMax(images);
+            for (size_t c = 0; c < layerStats.channels; c++) {
+                for (size_t i = 0; i < images; i++) {
+                    channelMin[i] = layerStats.imagesMin[i * layerStats.channels + c];
+                    channelMax[i] = layerStats.imagesMax[i * layerStats.channels + c];
+                }
+                min[c] = percentileOf(channelMin, 100.f - percentile);
+                max[c] = percentileOf(channelMax, percentile);
+            }
+        }
+
+        auto layer = layers.append_child("layer");
+        layer.append_child("name").text().set(item.first.c_str());
+        layer.append_child("min").text().set(joinCommas(min).c_str());
+        layer.append_child("max").text().set(joinCommas(max).c_str());
+    }
+
+    if (!doc.save_file(xmlPath.c_str())) {
+        THROW_IE_EXCEPTION << "Cannot save the statistics to " << xmlPath;
+    }
+}
@@ -0,0 +1,81 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "inference_engine.hpp"
+
+#include "PreprocessingOptions.hpp"
+
+/**
+ * @class CalibrationStatisticsCollector
+ * @brief Collects the per-channel min/max statistics of the activations of every layer of a network over a dataset.
+ * The statistics are written in the format loaded by the int8 calibration of the CPU plugin.
+ */
+class CalibrationStatisticsCollector {
+    struct LayerStatistics {
+        size_t channels = 0;
+        std::vector<float> min;
+        std::vector<float> max;
+        // the per-image statistics, image-major, kept only if a percentile is requested
+        std::vector<float> imagesMin;
+        std::vector<float> imagesMax;
+    };
+
+    std::string modelFileName;
+    std::string imagesPath;
+    int batch;
+    int requestsNumber;
+    float percentile;
+    PreprocessingOptions preprocessingOptions;
+    InferenceEngine::InferencePlugin plugin;
+
+    InferenceEngine::CNNNetReader networkReader;
+    std::string inputName;
+    // the names of the output data of the network mapped to the names of the layers producing them
+    std::map<std::string, std::string> outputLayers;
+    std::map<std::string, LayerStatistics> statistics;
+
+    void accumulate(const std::string& layerName, const InferenceEngine::Blob& blob, size_t images);
+
+public:
+    /**
+     * @param flags_m - the model file
+     * @param flags_i - the dataset, a .txt list of images or a folder
+     * @param flags_b - the batch size, 0 to take it from the IR
+     * @param requestsNumber - the number of the infer requests run asynchronously
+     * @param percentile - the percentile of the per-image maxima (and of the minima from the other end) taken as
+     *                     the range of a channel, 100 takes the absolute min/max over the dataset
+     */
+    CalibrationStatisticsCollector(const std::string& flags_m, const std::string& flags_i, int flags_b,
+            InferenceEngine::InferencePlugin plugin, PreprocessingOptions preprocessingOptions,
+            int requestsNumber, float percentile);
+
+    /**
+     * @brief Runs the network over the dataset and accumulates the statistics
+     * @return The number of the processed images
+     */
+    size_t Collect();
+
+    /**
+     * @brief Saves the statistics to the .xml file read by CNNNetworkStatsImpl::LoadFromFile
+     */
+    void Save(const std::string& xmlPath) const;
+};
@@ -14,18 +14,29 @@
 // limitations under the License.
 */
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
 #include <string>
+#include <thread>
 #include <vector>
 #include <memory>
 
 #include "ClassificationProcessor.hpp"
 #include "Processor.hpp"
+#include "parallel_image_decoder.hpp"
 
 using InferenceEngine::details::InferenceEngineException;
 
 ClassificationProcessor::ClassificationProcessor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, int flags_b,
-        InferencePlugin plugin, CsvDumper& dumper, const std::string& flags_l, PreprocessingOptions preprocessingOptions, bool zeroBackground)
-    : Processor(flags_m, flags_d, flags_i, flags_b, plugin, dumper, "Classification network", preprocessingOptions), zeroBackground(zeroBackground) {
+        InferencePlugin plugin, CsvDumper& dumper, const std::string& flags_l, PreprocessingOptions preprocessingOptions, bool zeroBackground,
+        int requestsNumber, int decoderThreads)
+    : Processor(flags_m, flags_d, flags_i, flags_b, plugin, dumper, "Classification network", preprocessingOptions), zeroBackground(zeroBackground),
+      requestsNumber(requestsNumber), decoderThreads(decoderThreads) {
+    if (requestsNumber < 1) {
+        THROW_IE_EXCEPTION << "The number of the infer requests should be positive";
+    }
 
     // Change path to labels file if necessary
     if (flags_l.empty()) {
@@ -64,6 +75,12 @@ std::shared_ptr<Processor::InferenceMetrics> ClassificationProcessor::Process()
 
      ClassificationInferenceMetrics im;
 
+     if (requestsNumber > 1) {
+         processPipelined(validationMap, progress, im);
+         progress.finish();
+         return std::shared_ptr<Processor::InferenceMetrics>(new ClassificationInferenceMetrics(im));
+     }
+
      std::string firstInputName = this->inputInfo.begin()->first;
      std::string firstOutputName = this->outInfo.begin()->first;
      auto firstInputBlob = inferRequest.GetBlob(firstInputName);
@@ -88,33 +105,129 @@ std::shared_ptr<Processor::InferenceMetrics> ClassificationProcessor::Process()
 
          Infer(progress, filesWatched, im);
 
-         std::vector<unsigned> results;
-         auto firstOutputData = firstOutputBlob->buffer().as<PrecisionTrait<Precision::FP32>::value_type*>();
-         InferenceEngine::TopResults(TOP_COUNT, *firstOutputBlob, results);
-
-         for (int i = 0; i < b; i++) {
-             int expc = expected[i];
-             if (zeroBackground) expc++;
-
-             bool top1Scored = (results[0 + TOP_COUNT * i] == expc);
-             dumper << "\"" + files[i] + "\"" << top1Scored;
-             if (top1Scored) im.top1Result++;
-             for (int j = 0; j < TOP_COUNT; j++) {
-                 unsigned classId = results[j + TOP_COUNT * i];
-                 if (classId == expc) {
-                     im.topCountResult++;
-                 }
-                 dumper << classId << firstOutputData[classId + i * (firstOutputBlob->size() / batch)];
-             }
-             dumper.endLine();
-             im.total++;
-         }
+         accumulateResults(*firstOutputBlob, expected, files, b, im);
      }
      progress.finish();
 
      return std::shared_ptr<Processor::InferenceMetrics>(new ClassificationInferenceMetrics(im));
 }
 
+void ClassificationProcessor::accumulateResults(Blob& output, const std::vector<int>& expected,
+        const std::vector<std::string>& files, int images, ClassificationInferenceMetrics& im) {
+    std::vector<unsigned> results;
+    auto firstOutputData = output.buffer().as<PrecisionTrait<Precision::FP32>::value_type*>();
+    InferenceEngine::TopResults(TOP_COUNT, output, results);
+
+    for (int i = 0; i < images; i++) {
+        int expc = expected[i];
+        if (zeroBackground) expc++;
+
+        bool top1Scored = (results[0 + TOP_COUNT * i] == expc);
+        dumper << "\"" + files[i] + "\"" << top1Scored;
+        if (top1Scored) im.top1Result++;
+        for (int j = 0; j < TOP_COUNT; j++) {
+            unsigned classId = results[j + TOP_COUNT * i];
+            if (classId == expc) {
+                im.topCountResult++;
+            }
+            dumper << classId << firstOutputData[classId + i * (output.size() / batch)];
+        }
+        dumper.endLine();
+        im.total++;
+    }
+}
+
+void ClassificationProcessor::processPipelined(const std::multimap<int, std::string>& validationMap, ConsoleProgress& progress,
+        ClassificationInferenceMetrics& im) {
+    std::vector<int> labels;
+    std::vector<std::string> names;
+    for (auto& item : validationMap) {
+        labels.push_back(item.first);
+        names.push_back(item.second);
+    }
+
+    std::string firstInputName = this->inputInfo.begin()->first;
+    std::string firstOutputName = this->outInfo.begin()->first;
+
+    // the batch of a request keeps the images it runs on until its results are taken
+    struct RequestBatch {
+        InferRequest request;
+        std::vector<int> expected;
+        std::vector<std::string> files;
+        int filesWatched = 0;
+    };
+    std::vector<RequestBatch> requests(requestsNumber);
+    requests[0].request = inferRequest;
+    for (size_t r = 1; r < requests.size(); r++) {
+        requests[r].request = executableNetwork.CreateInferRequest();
+    }
+
+    const size_t threads = decoderThreads > 0 ? static_cast<size_t>(decoderThreads)
+                                              : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    slog::info << "Running " << requests.size() << " infer requests, the images are decoded by " << threads << " threads" << slog::endl;
+    // the images of two rounds of the requests are decoded ahead, so the requests never wait for the decoding of a whole batch
+    ParallelImageDecoder decoder(names, inferRequest.GetBlob(firstInputName)->getTensorDesc(), preprocessingOptions,
+                                 threads, 2 * requests.size() * batch);
+
+    auto complete = [&](RequestBatch& batchOfRequest) {
+        StatusCode status = batchOfRequest.request.Wait(IInferRequest::WaitMode::RESULT_READY);
+        if (status != StatusCode::OK) {
+            THROW_IE_EXCEPTION << "Infer request failed with status " << status;
+        }
+        accumulateResults(*batchOfRequest.request.GetBlob(firstOutputName), batchOfRequest.expected, batchOfRequest.files,
+                          static_cast<int>(batchOfRequest.files.size()), im);
+        progress.addProgress(batchOfRequest.filesWatched);
+        batchOfRequest.expected.clear();
+        batchOfRequest.files.clear();
+        batchOfRequest.filesWatched = 0;
+    };
+
+    // the requests are reused in turn, so the results are taken in the order of the images as in the synchronous mode
+    const auto start = std::chrono::high_resolution_clock::now();
+    size_t r = 0;
+    size_t index = 0;
+    while (index < names.size()) {
+        RequestBatch& current = requests[r];
+        if (!current.files.empty()) {
+            complete(current);
+        }
+
+        Blob::Ptr input = current.request.GetBlob(firstInputName);
+        for (; static_cast<int>(current.files.size()) < batch && index < names.size(); index++) {
+            const ParallelImageDecoder::Image& image = decoder.next();
+            current.filesWatched++;
+            if (!image.decoded) {
+                slog::warn << "Can't read file " << names[index] << slog::endl;
+                continue;
+            }
+            const size_t imageSize = image.blob->byteSize();
+            std::memcpy(input->buffer().as<uint8_t*>() + current.files.size() * imageSize,
+                        image.blob->cbuffer().as<const uint8_t*>(), imageSize);
+            current.expected.push_back(labels[index]);
+            current.files.push_back(names[index]);
+        }
+        if (current.files.empty()) {
+            progress.addProgress(current.filesWatched);
+            current.filesWatched = 0;
+            continue;
+        }
+
+        current.request.StartAsync();
+        im.nRuns++;
+        r = (r + 1) % requests.size();
+    }
+    for (size_t i = 0; i < requests.size(); i++) {
+        RequestBatch& oldest = requests[(r + i) % requests.size()];
+        if (!oldest.files.empty()) {
+            complete(oldest);
+        }
+    }
+
+    // the average time of a batch is the time of the whole run over the batches, so it gives the throughput
+    std::chrono::duration<double, std::ratio<1, 1000>> total = std::chrono::high_resolution_clock::now() - start;
+    im.totalTime = total.count();
+}
+
 void ClassificationProcessor::Report(const Processor::InferenceMetrics& im) {
     Processor::Report(im);
     if (im.nRuns > 0) {
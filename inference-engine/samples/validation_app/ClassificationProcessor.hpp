@@ -18,8 +18,10 @@
 
 #include <iostream>
 #include <limits>
+#include <map>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "classification_set_generator.hpp"
 #include "Processor.hpp"
@@ -36,13 +38,29 @@ class ClassificationProcessor : public Processor {
         int total = 0;
     };
 
+    // scores the images of the batch of the output and dumps their results
+    void accumulateResults(InferenceEngine::Blob& output, const std::vector<int>& expected,
+            const std::vector<std::string>& files, int images, ClassificationInferenceMetrics& im);
+
+    // the images are decoded by a pool of threads while the requests run, the results are taken in the order of the images
+    void processPipelined(const std::multimap<int, std::string>& validationMap, ConsoleProgress& progress,
+            ClassificationInferenceMetrics& im);
+
 protected:
     std::string labelFileName;
     bool zeroBackground;
+    int requestsNumber;
+    int decoderThreads;
 public:
+    /**
+     * @param requestsNumber - the number of the infer requests run asynchronously, 1 decodes and infers the batches
+     *                         one after another
+     * @param decoderThreads - the number of the image decoding threads used with several requests, 0 takes
+     *                         the number of the CPU cores
+     */
     ClassificationProcessor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, int flags_b,
             InferenceEngine::InferencePlugin plugin, CsvDumper& dumper, const std::string& flags_l,
-            PreprocessingOptions preprocessingOptions, bool zeroBackground);
+            PreprocessingOptions preprocessingOptions, bool zeroBackground, int requestsNumber = 1, int decoderThreads = 0);
     ClassificationProcessor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, int flags_b,
             InferenceEngine::InferencePlugin plugin, CsvDumper& dumper, const std::string& flags_l, bool zeroBackground);
 
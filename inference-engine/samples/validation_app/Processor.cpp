@@ -93,8 +93,8 @@ Processor::Processor(const std::string& flags_m, const std::string& flags_d, con
 
     // Load model to plugin and create an inference request
 
-    ExecutableNetwork executable_network = plugin.LoadNetwork(networkReader.getNetwork(), {});
-    inferRequest = executable_network.CreateInferRequest();
+    executableNetwork = plugin.LoadNetwork(networkReader.getNetwork(), {});
+    inferRequest = executableNetwork.CreateInferRequest();
 }
 
 double Processor::Infer(ConsoleProgress& progress, int filesWatched, InferenceMetrics& im) {
@@ -49,6 +49,8 @@ protected:
     std::string targetDevice;
     std::string imagesPath;
     int batch;
+    // the network the requests run on, the processors may create more requests
+    InferenceEngine::ExecutableNetwork executableNetwork;
     InferenceEngine::InferRequest inferRequest;
     InferenceEngine::InputsDataMap inputInfo;
     InferenceEngine::OutputsDataMap outInfo;
@@ -162,3 +162,29 @@ std::multimap<int, std::string> ClassificationSetGenerator::getValidationMap(con
     }
     return{};
 }
+
+std::vector<std::string> ClassificationSetGenerator::getImagesList(const std::string& path) {
+    struct stat sb;
+    if (stat(path.c_str(), &sb) != 0) {
+        THROW_USER_EXCEPTION(3) << "The specified path \"" << path << "\" can not be found or accessed";
+    }
+
+    std::vector<std::string> images;
+    if (!S_ISDIR(sb.st_mode)) {
+        for (auto& item : validationMapFromTxt(path)) {
+            images.push_back(item.second);
+        }
+        return images;
+    }
+
+    for (auto& entry : getDirContents(path)) {
+        if (stat(entry.c_str(), &sb) == 0 && S_ISDIR(sb.st_mode)) {
+            for (auto& image : getDirContents(entry)) {
+                images.push_back(image);
+            }
+        } else {
+            images.push_back(entry);
+        }
+    }
+    return images;
+}
@@ -53,4 +53,12 @@ public:
      *         provided and no class names are known returns empty map
      */
     std::multimap<int, std::string> getValidationMap(const std::string& path);
+
+    /**
+     * @brief Lists the images of a dataset without the class annotations
+     * @param path - can be a .txt file or a folder. The file is parsed as in getValidationMap, in case of folder
+     *               all files of the folder and of its subfolders are taken, so the labels are not required
+     * @return The image paths
+     */
+    std::vector<std::string> getImagesList(const std::string& path);
 };
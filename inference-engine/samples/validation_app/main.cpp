@@ -41,6 +41,7 @@
 #include "ClassificationProcessor.hpp"
 #include "SSDObjectDetectionProcessor.hpp"
 #include "YOLOObjectDetectionProcessor.hpp"
+#include "CalibrationStatisticsCollector.hpp"
 
 using namespace std;
 using namespace InferenceEngine;
@@ -98,6 +99,19 @@ static const char custom_cpu_library_message[] = "Required for MKLDNN (CPU)-targ
 static const char zero_background_message[] = "\"Zero is a background\" flag. Some networks are trained with a modified dataset where the class IDs "
                                               "are enumerated from 1, but 0 is an undefined \"background\" class (which is never detected)";
 
+static const char classification_nireq_message[] = "Number of the infer requests run asynchronously, the images are decoded by a pool of threads "
+                                                   "while the requests run (1 by default, the images are decoded and inferred one batch after another)";
+
+static const char classification_nthreads_message[] = "Number of the image decoding threads used with -Cnireq more than 1 (by default the number of the CPU cores)";
+
+static const char statistics_output_message[] = "Path to the .xml file the activation statistics are saved to. If specified, the app collects "
+                                                "the per-layer statistics for the int8 calibration over the images instead of the validation";
+
+static const char statistics_nireq_message[] = "Number of the infer requests run asynchronously during the statistics collection (2 by default)";
+
+static const char statistics_percentile_message[] = "Percentile of the per-image activation ranges taken as the range of a channel (100 by default, "
+                                                    "i.e. the absolute min/max over the images)";
+
 /// @brief Network type options and their descriptions
 static const char* types_descriptions[][2] = {
     { "C", "classification" },
@@ -143,6 +157,10 @@ DEFINE_int32(ppHeight, 0, preprocessing_height);
 
 DEFINE_bool(Czb, false, zero_background_message);
 
+DEFINE_int32(Cnireq, 1, classification_nireq_message);
+
+DEFINE_int32(Cnthreads, 0, classification_nthreads_message);
+
 DEFINE_string(ODa, "", obj_detection_annotations_message);
 
 DEFINE_string(ODc, "", obj_detection_classes_message);
@@ -152,6 +170,13 @@ DEFINE_string(ODsubdir, "", obj_detection_subdir_message);
 /// @brief kind of an object detection network
 DEFINE_string(ODkind, "SSD", obj_detection_kind_message);
 
+/// @brief Output file of the statistics collection mode
+DEFINE_string(Sout, "", statistics_output_message);
+
+DEFINE_int32(Snireq, 2, statistics_nireq_message);
+
+DEFINE_double(Spercentile, 100.0, statistics_percentile_message);
+
 /// @brief Define parameter for clDNN custom kernels path <br>
 /// Default is ./lib
 DEFINE_string(c, "", custom_cldnn_message);
@@ -188,13 +213,21 @@ static void showUsage() {
     std::cout << std::endl;
     std::cout << "    Classification-specific options:" << std::endl;
     std::cout << "      -Czb true               " << zero_background_message << std::endl;
+    std::cout << "      -Cnireq N               " << classification_nireq_message << std::endl;
+    std::cout << "      -Cnthreads N            " << classification_nthreads_message << std::endl;
 
     std::cout << std::endl;
     std::cout << "    Object detection-specific options:" << std::endl;
     std::cout << "      -ODkind <kind>          " << obj_detection_kind_message << std::endl;
     std::cout << "      -ODa <path>             " << obj_detection_annotations_message << std::endl;
     std::cout << "      -ODc <file>             " << obj_detection_classes_message << std::endl;
-    std::cout << "      -ODsubdir <name>        " << obj_detection_subdir_message << std::endl << std::endl;
+    std::cout << "      -ODsubdir <name>        " << obj_detection_subdir_message << std::endl;
+
+    std::cout << std::endl;
+    std::cout << "    Statistics collection options:" << std::endl;
+    std::cout << "      -Sout <path>            " << statistics_output_message << std::endl;
+    std::cout << "      -Snireq N               " << statistics_nireq_message << std::endl;
+    std::cout << "      -Spercentile P          " << statistics_percentile_message << std::endl << std::endl;
 }
 
 enum NetworkType {
@@ -248,7 +281,15 @@ int main(int argc, char *argv[]) {
         if (FLAGS_d.empty()) ee << UserException(5, "Target device not specified (missing -d option)");
         if (FLAGS_b < 0) ee << UserException(6, "Batch should be positive (invalid -b option value)");
 
-        if (netType == ObjDetection) {
+        if (!FLAGS_Sout.empty()) {
+            if (FLAGS_Snireq < 1) ee << UserException(14, "Number of infer requests should be positive (invalid -Snireq option value)");
+            if (FLAGS_Spercentile <= 0 || FLAGS_Spercentile > 100) {
+                ee << UserException(15, "Percentile should be in (0, 100] (invalid -Spercentile option value)");
+            }
+        } else if (netType == Classification) {
+            if (FLAGS_Cnireq < 1) ee << UserException(16, "Number of infer requests should be positive (invalid -Cnireq option value)");
+            if (FLAGS_Cnthreads < 0) ee << UserException(17, "Number of decoding threads should not be negative (invalid -Cnthreads option value)");
+        } else if (netType == ObjDetection) {
             // Checking required OD-specific options
             if (FLAGS_ODa.empty()) ee << UserException(11, "Annotations folder not specified for object detection (missing -a option)");
             if (FLAGS_ODc.empty()) ee << UserException(12, "Classes file not specified (missing -c option)");
@@ -312,9 +353,19 @@ int main(int argc, char *argv[]) {
             THROW_USER_EXCEPTION(2) << "Unknown preprocessing type: " << FLAGS_ppType;
         }
 
+        if (!FLAGS_Sout.empty()) {
+            CalibrationStatisticsCollector collector(FLAGS_m, FLAGS_i, FLAGS_b, plugin, preprocessingOptions,
+                                                     FLAGS_Snireq, static_cast<float>(FLAGS_Spercentile));
+            size_t images = collector.Collect();
+            collector.Save(FLAGS_Sout);
+            slog::info << "Statistics of " << images << " images saved to " << FLAGS_Sout << slog::endl;
+            return 0;
+        }
+
         if (netType == Classification) {
             processor = std::shared_ptr<Processor>(
-                    new ClassificationProcessor(FLAGS_m, FLAGS_d, FLAGS_i, FLAGS_b, plugin, dumper, FLAGS_l, preprocessingOptions, FLAGS_Czb));
+                    new ClassificationProcessor(FLAGS_m, FLAGS_d, FLAGS_i, FLAGS_b, plugin, dumper, FLAGS_l, preprocessingOptions, FLAGS_Czb,
+                                                FLAGS_Cnireq, FLAGS_Cnthreads));
         } else if (netType == ObjDetection) {
             if (FLAGS_ODkind == "SSD") {
                 processor = std::shared_ptr<Processor>(
@@ -0,0 +1,134 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "parallel_image_decoder.hpp"
+#include "image_decoder.hpp"
+#include "details/ie_exception.hpp"
+
+using namespace InferenceEngine;
+
+using InferenceEngine::details::InferenceEngineException;
+
+namespace {
+
+// the element types are the ones ImageDecoder writes for the precisions
+Blob::Ptr createImageBlob(const TensorDesc& desc) {
+    switch (desc.getPrecision()) {
+    case Precision::FP32:
+        return make_shared_blob<float>(desc);
+    case Precision::FP16:
+    case Precision::Q78:
+    case Precision::I16:
+    case Precision::U16:
+        return make_shared_blob<short>(desc);
+    default:
+        return make_shared_blob<uint8_t>(desc);
+    }
+}
+
+}  // namespace
+
+ParallelImageDecoder::ParallelImageDecoder(const std::vector<std::string>& names, const TensorDesc& inputDesc,
+        PreprocessingOptions preprocessingOptions, size_t threadsNumber, size_t ahead)
+    : names(names), preprocessingOptions(preprocessingOptions), slots(std::max<size_t>(ahead, 1)) {
+    const SizeVector& dims = inputDesc.getDims();
+    if (dims.size() != 4) {
+        THROW_IE_EXCEPTION << "The images are decoded for a 4D input only";
+    }
+    const TensorDesc imageDesc(inputDesc.getPrecision(), { 1, dims[1], dims[2], dims[3] }, Layout::NCHW);
+    for (auto& slot : slots) {
+        slot.image.blob = createImageBlob(imageDesc);
+        slot.image.blob->allocate();
+    }
+
+    threadsNumber = std::min(std::max<size_t>(threadsNumber, 1), std::max<size_t>(names.size(), 1));
+    for (size_t t = 0; t < threadsNumber; t++) {
+        threads.emplace_back(&ParallelImageDecoder::decode, this);
+    }
+}
+
+ParallelImageDecoder::~ParallelImageDecoder() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopped = true;
+    }
+    slotFreed.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void ParallelImageDecoder::decode() {
+    ImageDecoder decoder;
+    while (true) {
+        size_t index = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            // the slot of the image is free when the image which was decoded to it before is consumed
+            slotFreed.wait(lock, [&] {
+                return stopped || nextIndex >= names.size() || nextIndex < consumed + slots.size();
+            });
+            if (stopped || nextIndex >= names.size()) {
+                return;
+            }
+            index = nextIndex++;
+        }
+
+        Slot& slot = slots[index % slots.size()];
+        slot.error = nullptr;
+        try {
+            decoder.insertIntoBlob(names[index], 0, *slot.image.blob, preprocessingOptions);
+            slot.image.decoded = true;
+        } catch (const InferenceEngineException&) {
+            // Could be some non-image file in directory
+            slot.image.decoded = false;
+        } catch (...) {
+            slot.image.decoded = false;
+            slot.error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            slot.ready = true;
+        }
+        imageReady.notify_all();
+    }
+}
+
+const ParallelImageDecoder::Image& ParallelImageDecoder::next() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (taken) {
+        slots[consumed % slots.size()].ready = false;
+        consumed++;
+        taken = false;
+        slotFreed.notify_all();
+    }
+    if (consumed >= names.size()) {
+        THROW_IE_EXCEPTION << "All " << names.size() << " images are already decoded";
+    }
+
+    Slot& slot = slots[consumed % slots.size()];
+    imageReady.wait(lock, [&] { return slot.ready; });
+    taken = true;
+    if (slot.error) {
+        std::rethrow_exception(slot.error);
+    }
+    return slot.image;
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ie_blob.h"
+
+#include "PreprocessingOptions.hpp"
+
+/**
+ * @class ParallelImageDecoder
+ * @brief Decodes the images of a list by a pool of threads ahead of the consumer, which takes them in the order of the list.
+ * Every image is decoded by ImageDecoder into a single image blob of the precision of the input, so the batches
+ * assembled from them are the same as the ones decoded in place
+ */
+class ParallelImageDecoder {
+public:
+    struct Image {
+        // false if the file cannot be read as an image
+        bool decoded = false;
+        // the image in the NCHW layout with the batch of 1
+        InferenceEngine::Blob::Ptr blob;
+    };
+
+    /**
+     * @param names - the image files in the order they are consumed
+     * @param inputDesc - the descriptor of the input the images are decoded for, its batch is ignored
+     * @param threads - the number of the decoding threads
+     * @param ahead - the maximal number of the images decoded and not consumed yet
+     */
+    ParallelImageDecoder(const std::vector<std::string>& names, const InferenceEngine::TensorDesc& inputDesc,
+                         PreprocessingOptions preprocessingOptions, size_t threads, size_t ahead);
+
+    ~ParallelImageDecoder();
+
+    /**
+     * @brief Waits for the next image of the list, the image is valid until the next call.
+     *        The errors of the decoding other than an unreadable file are rethrown
+     */
+    const Image& next();
+
+private:
+    struct Slot {
+        Image image;
+        std::exception_ptr error;
+        bool ready = false;
+    };
+
+    void decode();
+
+    std::vector<std::string> names;
+    PreprocessingOptions preprocessingOptions;
+    // the image of the index is decoded to the slot of the index modulo the number of the slots
+    std::vector<Slot> slots;
+    size_t nextIndex = 0;
+    size_t consumed = 0;
+    bool taken = false;
+    bool stopped = false;
+
+    std::mutex mutex;
+    std::condition_variable imageReady;
+    std::condition_variable slotFreed;
+    std::vector<std::thread> threads;
+};
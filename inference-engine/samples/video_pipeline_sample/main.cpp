@@ -0,0 +1,518 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+/**
+* @brief The entry point of the Inference Engine video pipeline sample application
+* @file video_pipeline_sample/main.cpp
+* @example video_pipeline_sample/main.cpp
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+#include <inference_engine.hpp>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include <ext_list.hpp>
+
+#include "video_pipeline_sample.h"
+
+using namespace InferenceEngine;
+
+typedef std::chrono::high_resolution_clock Time;
+typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validation of input args--------------------------------------
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+    slog::info << "Parsing input parameters" << slog::endl;
+
+    if (FLAGS_i.empty()) {
+        throw std::logic_error("Parameter -i is not set");
+    }
+    if (FLAGS_m.empty()) {
+        throw std::logic_error("Parameter -m is not set");
+    }
+    if (FLAGS_nireq < 1) {
+        throw std::logic_error("Parameter -nireq must be more than 0 ! (default 4)");
+    }
+    if (FLAGS_nf < 0) {
+        throw std::logic_error("Parameter -nf must not be negative ! (default 0)");
+    }
+
+    return true;
+}
+
+/**
+* @brief The queue between two stages of the pipeline. The producer waits while the queue is full, so a slow stage
+* holds back the stages before it instead of piling up the frames. Once the queue is closed nothing is pushed to it,
+* the items left are still popped.
+*/
+template <typename T>
+class BlockingQueue {
+public:
+    explicit BlockingQueue(size_t capacity) : _capacity(capacity) {}
+
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _notFull.wait(lock, [this] { return _closed || _items.size() < _capacity; });
+        if (_closed)
+            return false;
+        _items.push_back(std::move(item));
+        _notEmpty.notify_one();
+        return true;
+    }
+
+    bool pop(T &item) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _notEmpty.wait(lock, [this] { return _closed || !_items.empty(); });
+        if (_items.empty())
+            return false;
+        item = std::move(_items.front());
+        _items.pop_front();
+        _notFull.notify_one();
+        return true;
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+        _notFull.notify_all();
+        _notEmpty.notify_all();
+    }
+
+private:
+    const size_t _capacity;
+    std::deque<T> _items;
+    std::mutex _mutex;
+    std::condition_variable _notFull;
+    std::condition_variable _notEmpty;
+    bool _closed = false;
+};
+
+/** @brief The decoded frame, it's kept alive by the request until the inference is done **/
+struct Frame {
+    size_t id = 0;
+    cv::Mat image;
+    Time::time_point decodeStart;
+    Time::time_point decoded;
+};
+
+/** @brief The frame with the detections copied from the output of its request **/
+struct Result {
+    Frame frame;
+    Time::time_point inferStart;
+    Time::time_point inferred;
+    std::vector<float> detections;
+};
+
+/** @brief The latencies of a stage of the pipeline **/
+struct StageStatistics {
+    void add(double latency) {
+        total += latency;
+        max = std::max(max, latency);
+        count++;
+    }
+
+    void print(const std::string &name) const {
+        std::cout << "    " << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(2)
+                  << "avg " << std::setw(9) << (count ? total / count : 0.0) << " ms, max " << std::setw(9) << max
+                  << " ms" << std::endl;
+    }
+
+    double total = 0.0;
+    double max = 0.0;
+    size_t count = 0;
+};
+
+/**
+* @brief The sample runs the stages of the video processing at the same time: the decode thread reads the frames,
+* the main thread starts the idle requests on them, the completion callbacks of the requests hand the detections
+* to the postprocessing thread, which draws and writes the frames in the order of the video.
+*/
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        // --------------------------- 1. Parsing and validation of input args ---------------------------------
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+
+        ROI roi = {0, 0, 0, 0, 0};
+        const bool hasRoi = !FLAGS_roi.empty();
+        if (hasRoi) {
+            std::istringstream stream(FLAGS_roi);
+            char comma1 = 0, comma2 = 0, comma3 = 0;
+            stream >> roi.posX >> comma1 >> roi.posY >> comma2 >> roi.sizeX >> comma3 >> roi.sizeY;
+            if (stream.fail() || !stream.eof() || comma1 != ',' || comma2 != ',' || comma3 != ',' ||
+                    roi.sizeX == 0 || roi.sizeY == 0) {
+                throw std::logic_error("Parameter -roi should be \"<x>,<y>,<width>,<height>\" with the positive size");
+            }
+        }
+
+        cv::VideoCapture capture;
+        if (FLAGS_i == "cam") {
+            capture.open(0);
+        } else {
+            capture.open(FLAGS_i);
+        }
+        if (!capture.isOpened()) {
+            throw std::logic_error("Cannot open the video " + FLAGS_i);
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 2. Load Plugin for inference engine -------------------------------------
+        slog::info << "Loading plugin" << slog::endl;
+        InferencePlugin plugin = PluginDispatcher({ FLAGS_pp, "../../../lib/intel64" , "" }).getPluginByDevice(FLAGS_d);
+
+        /*If CPU device, load default library with extensions that comes with the product*/
+        if (FLAGS_d.find("CPU") != std::string::npos) {
+            plugin.AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+        }
+
+        if (!FLAGS_l.empty()) {
+            // CPU(MKLDNN) extensions are loaded as a shared library and passed as a pointer to base extension
+            IExtensionPtr extension_ptr = make_so_pointer<IExtension>(FLAGS_l);
+            plugin.AddExtension(extension_ptr);
+            slog::info << "CPU Extension loaded: " << FLAGS_l << slog::endl;
+        }
+
+        if (!FLAGS_c.empty()) {
+            // clDNN Extensions are loaded from an .xml description and OpenCL kernel files
+            plugin.SetConfig({ { PluginConfigParams::KEY_CONFIG_FILE, FLAGS_c } });
+            slog::info << "GPU Extension loaded: " << FLAGS_c << slog::endl;
+        }
+
+        /** Printing plugin version **/
+        printPluginVersion(plugin, std::cout);
+
+        std::map<std::string, std::string> config;
+        if (FLAGS_pc) {
+            config[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
+        }
+        if (!FLAGS_nstreams.empty()) {
+            if (FLAGS_d.find("CPU") != std::string::npos) {
+                config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] =
+                        FLAGS_nstreams == "auto" ? PluginConfigParams::CPU_THROUGHPUT_AUTO : FLAGS_nstreams;
+            } else {
+                slog::warn << "The streams are supported only by the CPU plugin, -nstreams is ignored" << slog::endl;
+            }
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 3. Read IR Generated by ModelOptimizer (.xml and .bin files) ------------
+        std::string binFileName = fileNameNoExt(FLAGS_m) + ".bin";
+        slog::info << "Loading network files:"
+            "\n\t" << FLAGS_m <<
+            "\n\t" << binFileName <<
+            slog::endl;
+
+        CNNNetReader networkReader;
+        networkReader.ReadNetwork(FLAGS_m);
+        networkReader.ReadWeights(binFileName);
+        CNNNetwork network = networkReader.getNetwork();
+        /** Every request infers a single frame, the requests running at the same time make the batch up **/
+        network.setBatchSize(1);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 4. Configure input & output ---------------------------------------------
+        InputsDataMap inputsInfo(network.getInputsInfo());
+        if (inputsInfo.size() != 1) {
+            throw std::logic_error("Sample supports topologies only with 1 input");
+        }
+        const std::string inputName = inputsInfo.begin()->first;
+        InputInfo::Ptr inputInfo = inputsInfo.begin()->second;
+        /** The frames are set to the requests as they are decoded, the Inference Engine crops and resizes them
+         * and converts them to the layout of the network while the input is read **/
+        inputInfo->setPrecision(Precision::U8);
+        inputInfo->setLayout(Layout::NHWC);
+        inputInfo->getPreProcess().setResizeAlgorithm(RESIZE_BILINEAR);
+
+        OutputsDataMap outputsInfo(network.getOutputsInfo());
+        std::string outputName;
+        DataPtr outputInfo;
+        for (const auto& out : outputsInfo) {
+            if (out.second->creatorLayer.lock()->type == "DetectionOutput") {
+                outputName = out.first;
+                outputInfo = out.second;
+            }
+        }
+        if (outputInfo == nullptr) {
+            throw std::logic_error("Can't find a DetectionOutput layer in the topology");
+        }
+
+        const SizeVector outputDims = outputInfo->getTensorDesc().getDims();
+        if (outputDims.size() != 4) {
+            throw std::logic_error("Incorrect output dimensions for SSD model");
+        }
+        const size_t maxProposalCount = outputDims[2];
+        const size_t objectSize = outputDims[3];
+        if (objectSize != 7) {
+            throw std::logic_error("Output item should have 7 as a last dimension");
+        }
+        outputInfo->setPrecision(Precision::FP32);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 5. Loading model to the plugin and creating the requests ----------------
+        slog::info << "Loading model to the plugin" << slog::endl;
+        ExecutableNetwork executableNetwork = plugin.LoadNetwork(network, config);
+
+        const size_t requestsNum = static_cast<size_t>(FLAGS_nireq);
+        std::vector<InferRequest> requests;
+        std::vector<Blob::Ptr> outputs;
+        for (size_t i = 0; i < requestsNum; i++) {
+            requests.push_back(executableNetwork.CreateInferRequest());
+            outputs.push_back(requests.back().GetBlob(outputName));
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 6. Run the pipeline -----------------------------------------------------
+        slog::info << "Processing the video with " << requestsNum << " infer requests" << slog::endl;
+
+        BlockingQueue<Frame> decodedFrames(requestsNum);
+        BlockingQueue<Result> results(requestsNum);
+        BlockingQueue<size_t> idleRequests(requestsNum);
+        for (size_t i = 0; i < requestsNum; i++) {
+            idleRequests.push(i);
+        }
+
+        /** The first error stops all the stages **/
+        std::mutex mutex;
+        std::condition_variable allDone;
+        std::string error;
+        size_t running = 0;
+        auto setError = [&](const std::string &message) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (error.empty())
+                    error = message;
+            }
+            decodedFrames.close();
+            idleRequests.close();
+            results.close();
+        };
+
+        /** The frame and the start of the inference of every request, they are taken by its callback **/
+        std::vector<Result> inferences(requestsNum);
+        for (size_t i = 0; i < requestsNum; i++) {
+            requests[i].SetCompletionCallback(
+                    std::function<void(InferRequest, StatusCode)>([&, i](InferRequest, StatusCode code) {
+                Result result = std::move(inferences[i]);
+                result.inferred = Time::now();
+                if (code == StatusCode::OK) {
+                    const float *detections = outputs[i]->cbuffer().as<const float *>();
+                    result.detections.assign(detections, detections + maxProposalCount * objectSize);
+                    results.push(std::move(result));
+                } else {
+                    setError("Inference failed with the status " + std::to_string(code));
+                }
+                /** The request is free once its output is copied, it does not wait for the postprocessing **/
+                idleRequests.push(i);
+                std::lock_guard<std::mutex> lock(mutex);
+                running--;
+                allDone.notify_all();
+            }));
+        }
+
+        std::thread decoder([&] {
+            try {
+                for (size_t id = 0; FLAGS_nf == 0 || id < static_cast<size_t>(FLAGS_nf); id++) {
+                    Frame frame;
+                    frame.id = id;
+                    frame.decodeStart = Time::now();
+                    if (!capture.read(frame.image) || frame.image.empty())
+                        break;
+                    frame.decoded = Time::now();
+                    if (!decodedFrames.push(std::move(frame)))
+                        break;
+                }
+            } catch (const std::exception &ex) {
+                setError(ex.what());
+            }
+            decodedFrames.close();
+        });
+
+        StageStatistics decodeStatistics, waitStatistics, inferStatistics, postprocessStatistics, totalStatistics;
+        size_t framesProcessed = 0, objectsDetected = 0;
+        const auto runStart = Time::now();
+        auto runEnd = runStart;
+
+        std::thread postprocessor([&] {
+            try {
+                cv::VideoWriter writer;
+                /** The requests complete out of order, the frames are written in the order of the video **/
+                std::map<size_t, Result> pending;
+                size_t nextId = 0;
+                Result result;
+                while (results.pop(result)) {
+                    const size_t id = result.frame.id;
+                    pending[id] = std::move(result);
+                    for (auto it = pending.begin(); it != pending.end() && it->first == nextId; it = pending.erase(it), nextId++) {
+                        const auto start = Time::now();
+                        Result &current = it->second;
+                        cv::Mat &image = current.frame.image;
+                        const float regionX = hasRoi ? static_cast<float>(roi.posX) : 0.0f;
+                        const float regionY = hasRoi ? static_cast<float>(roi.posY) : 0.0f;
+                        const float regionWidth = static_cast<float>(hasRoi ? roi.sizeX : image.cols);
+                        const float regionHeight = static_cast<float>(hasRoi ? roi.sizeY : image.rows);
+
+                        for (size_t proposal = 0; proposal < maxProposalCount; proposal++) {
+                            const float *detection = &current.detections[proposal * objectSize];
+                            /* CPU and GPU plugins have difference in DetectionOutput layer, so we need both checks */
+                            if (detection[0] < 0 || detection[2] == 0) {
+                                continue;
+                            }
+                            if (detection[2] < FLAGS_t) {
+                                continue;
+                            }
+                            objectsDetected++;
+                            if (!FLAGS_o.empty()) {
+                                cv::Point topLeft(static_cast<int>(regionX + detection[3] * regionWidth),
+                                                  static_cast<int>(regionY + detection[4] * regionHeight));
+                                cv::Point bottomRight(static_cast<int>(regionX + detection[5] * regionWidth),
+                                                      static_cast<int>(regionY + detection[6] * regionHeight));
+                                cv::rectangle(image, topLeft, bottomRight, cv::Scalar(0, 255, 0), 2);
+                            }
+                        }
+
+                        if (!FLAGS_o.empty()) {
+                            if (!writer.isOpened()) {
+                                double fps = capture.get(cv::CAP_PROP_FPS);
+                                if (fps <= 0) {
+                                    fps = 25.0;
+                                }
+                                if (!writer.open(FLAGS_o, cv::VideoWriter::fourcc('M', 'J', 'P', 'G'), fps, image.size())) {
+                                    throw std::logic_error("Cannot create the video " + FLAGS_o);
+                                }
+                            }
+                            writer.write(image);
+                        }
+
+                        const auto end = Time::now();
+                        decodeStatistics.add(std::chrono::duration_cast<ms>(current.frame.decoded - current.frame.decodeStart).count());
+                        waitStatistics.add(std::chrono::duration_cast<ms>(current.inferStart - current.frame.decoded).count());
+                        inferStatistics.add(std::chrono::duration_cast<ms>(current.inferred - current.inferStart).count());
+                        postprocessStatistics.add(std::chrono::duration_cast<ms>(end - start).count());
+                        totalStatistics.add(std::chrono::duration_cast<ms>(end - current.frame.decodeStart).count());
+                        framesProcessed++;
+                        runEnd = end;
+                    }
+                }
+            } catch (const std::exception &ex) {
+                setError(ex.what());
+            }
+        });
+
+        /** The dispatcher gives every decoded frame to the first idle request **/
+        try {
+            Frame frame;
+            size_t request = 0;
+            while (decodedFrames.pop(frame) && idleRequests.pop(request)) {
+                Blob::Ptr frameBlob = wrapMat2Blob(frame.image);
+                if (hasRoi) {
+                    if (roi.posX + roi.sizeX > static_cast<size_t>(frame.image.cols) ||
+                            roi.posY + roi.sizeY > static_cast<size_t>(frame.image.rows)) {
+                        throw std::logic_error("Parameter -roi is out of the frame of " + std::to_string(frame.image.cols) +
+                                               "x" + std::to_string(frame.image.rows));
+                    }
+                    frameBlob = make_shared_blob(frameBlob, roi);
+                }
+                requests[request].SetBlob(inputName, frameBlob);
+                inferences[request].frame = std::move(frame);
+                inferences[request].inferStart = Time::now();
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    running++;
+                }
+                try {
+                    requests[request].StartAsync();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    running--;
+                    throw;
+                }
+            }
+        } catch (const std::exception &ex) {
+            setError(ex.what());
+        }
+
+        decodedFrames.close();
+        decoder.join();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            allDone.wait(lock, [&] { return running == 0; });
+        }
+        results.close();
+        postprocessor.join();
+
+        if (!error.empty()) {
+            throw std::logic_error(error);
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 7. Report the results ---------------------------------------------------
+        const double totalTime = std::chrono::duration_cast<ms>(runEnd - runStart).count();
+        std::cout << std::endl << "Frames processed: " << framesProcessed << ", objects detected: " << objectsDetected << std::endl;
+        std::cout << "Latency of the stages:" << std::endl;
+        decodeStatistics.print("decode");
+        waitStatistics.print("wait");
+        inferStatistics.print("infer");
+        postprocessStatistics.print("postprocess");
+        totalStatistics.print("end-to-end");
+        std::cout << std::endl << "Throughput: " << (totalTime > 0 ? 1000.0 * framesProcessed / totalTime : 0.0) << " FPS" << std::endl;
+        std::cout << std::endl;
+
+        if (!FLAGS_o.empty() && framesProcessed > 0) {
+            slog::info << "Video " << FLAGS_o << " created!" << slog::endl;
+        }
+
+        /** Show performance results **/
+        if (FLAGS_pc) {
+            printPerformanceCounts(requests[0], std::cout);
+        }
+    }
+    catch (const std::exception& error) {
+        slog::err << error.what() << slog::endl;
+        return 1;
+    }
+    catch (...) {
+        slog::err << "Unknown/internal exception happened." << slog::endl;
+        return 1;
+    }
+
+    slog::info << "Execution successful" << slog::endl;
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message.";
+
+/// @brief message for video argument
+static const char video_message[] = "Required. Path to a video file or \"cam\" to read the frames from the camera.";
+
+/// @brief message for model argument
+static const char model_message[] = "Required. Path to an .xml file with a trained SSD model.";
+
+/// @brief message for plugin_path argument
+static const char plugin_path_message[] = "Path to a plugin folder.";
+
+/// @brief message for assigning cnn calculation to device
+static const char target_device_message[] = "Specify the target device to infer on; CPU, GPU, FPGA, MYRIAD or HETERO:<devices> " \
+                                            "is acceptable (CPU by default)";
+
+/// @brief message for the number of infer requests
+static const char ninfer_request_message[] = "Number of infer requests running at the same time (default 4)";
+
+/// @brief message for the number of streams
+static const char nstreams_message[] = "Number of CPU throughput streams, a positive number or \"auto\" " \
+                                       "(by default the plugin setting is used)";
+
+/// @brief message for the number of frames
+static const char frames_count_message[] = "Number of frames to process (default 0, the whole video)";
+
+/// @brief message for the region of interest
+static const char roi_message[] = "Region of the frame the detection runs on as \"<x>,<y>,<width>,<height>\", " \
+                                  "it is cropped and resized by the Inference Engine (by default the whole frame)";
+
+/// @brief message for the probability threshold
+static const char threshold_message[] = "Probability threshold of the detections (default 0.5)";
+
+/// @brief message for the output video
+static const char output_message[] = "Path to the video file the frames with the detections are written to";
+
+/// @brief message for performance counters
+static const char performance_counter_message[] = "Reports the per-layer performance counters of the first request";
+
+/// @brief message for clDNN custom kernels desc
+static const char custom_cldnn_message[] = "Required for clDNN (GPU)-targeted custom kernels."\
+                                            "Absolute path to the xml file with the kernels desc.";
+
+/// @brief message for user library argument
+static const char custom_cpu_library_message[] = "Required for MKLDNN (CPU)-targeted custom layers." \
+                                                 "Absolute path to a shared library with the kernels impl.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Define parameter for set video file <br>
+/// It is a required parameter
+DEFINE_string(i, "", video_message);
+
+/// @brief Define parameter for set model file <br>
+/// It is a required parameter
+DEFINE_string(m, "", model_message);
+
+/// @brief Define parameter for set path to plugins <br>
+DEFINE_string(pp, "", plugin_path_message);
+
+/// @brief device the target device to infer on <br>
+DEFINE_string(d, "CPU", target_device_message);
+
+/// @brief Number of infer requests
+DEFINE_int32(nireq, 4, ninfer_request_message);
+
+/// @brief Number of CPU throughput streams
+DEFINE_string(nstreams, "", nstreams_message);
+
+/// @brief Frames count (default 0)
+DEFINE_int32(nf, 0, frames_count_message);
+
+/// @brief Region of interest of the frames
+DEFINE_string(roi, "", roi_message);
+
+/// @brief Probability threshold (default 0.5)
+DEFINE_double(t, 0.5, threshold_message);
+
+/// @brief Path to the output video
+DEFINE_string(o, "", output_message);
+
+/// @brief Enable per-layer performance report
+DEFINE_bool(pc, false, performance_counter_message);
+
+/// @brief Define parameter for clDNN custom kernels path <br>
+DEFINE_string(c, "", custom_cldnn_message);
+
+/// @brief Absolute path to CPU library with user layers <br>
+/// It is a optional parameter
+DEFINE_string(l, "", custom_cpu_library_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "video_pipeline_sample [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                      " << help_message << std::endl;
+    std::cout << "    -i \"<path>\"             " << video_message << std::endl;
+    std::cout << "    -m \"<path>\"             " << model_message << std::endl;
+    std::cout << "      -l \"<absolute_path>\"    " << custom_cpu_library_message << std::endl;
+    std::cout << "          Or" << std::endl;
+    std::cout << "      -c \"<absolute_path>\"    " << custom_cldnn_message << std::endl;
+    std::cout << "    -pp \"<path>\"            " << plugin_path_message << std::endl;
+    std::cout << "    -d \"<device>\"           " << target_device_message << std::endl;
+    std::cout << "    -nireq \"<integer>\"      " << ninfer_request_message << std::endl;
+    std::cout << "    -nstreams \"<integer>\"   " << nstreams_message << std::endl;
+    std::cout << "    -nf \"<integer>\"         " << frames_count_message << std::endl;
+    std::cout << "    -roi \"<x,y,w,h>\"        " << roi_message << std::endl;
+    std::cout << "    -t \"<double>\"           " << threshold_message << std::endl;
+    std::cout << "    -o \"<path>\"             " << output_message << std::endl;
+    std::cout << "    -pc                     " << performance_counter_message << std::endl;
+}
@@ -46,6 +46,7 @@ void CLDNNCustomLayer::ProcessKernelNode(const pugi::xml_node & node) {
     CheckAndReturnError(m_kernelSource.length() > 0, "Multiple definition of Kernel");
     m_kernelEntry = GetStrAttr(node, "entry", "");
     CheckAndReturnError(m_kernelEntry.length() == 0, "No Kernel entry in layer: " << GetStrAttr(node.parent(), "name"));
+    m_mergeSiblings = node.attribute("merge-siblings").as_bool(false);
 
     // Handle Source nodes
     for (auto sourceNode = node.child("Source"); !sourceNode.empty(); sourceNode = sourceNode.next_sibling("Source")) {
@@ -56,6 +56,8 @@ public:
     const std::vector<std::string>& LocalSizeRules()const { return m_localSizeRules; }
     const std::vector<KerenlParam>& KernelParams()const { return m_kernelParams; }
     const int InputDimSourceIndex() { return m_wgDimInputIdx; }
+    // the siblings of the same inputs, parameters and blobs are computed by a single launch of the kernel
+    bool MergeSiblings() const { return m_mergeSiblings; }
 
 protected:
     CLDNNCustomLayer() {}
@@ -74,6 +76,7 @@ protected:
     std::string m_layerName;
     std::string m_kernelSource;
     std::string m_kernelEntry;
+    bool m_mergeSiblings = false;
     std::vector<KernelDefine> m_defines;  // <name , take value from> <x,y> --> #define x value_of
     std::string m_compilerOptions;
     int m_wgDimInputIdx;
@@ -79,8 +79,9 @@ clDNNEngine::~clDNNEngine() {
     }
 }
 
-ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network,
-                                                               const std::map<std::string, std::string> &config) {
+namespace {
+
+void checkNetworkInputs(InferenceEngine::ICNNNetwork &network) {
     auto specifiedDevice = network.getTargetDevice();
     auto supportedDevice = InferenceEngine::TargetDevice::eGPU;
     if (specifiedDevice != InferenceEngine::TargetDevice::eDefault && specifiedDevice != supportedDevice) {
@@ -88,9 +89,6 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(InferenceEngine::
                            "Supported target device: " << getDeviceName(supportedDevice);
     }
 
-    CLDNNGraph::Config conf = this->_impl->m_config;
-    conf.LoadFromMap(config);
-
     // verification of supported input
     InferenceEngine::InputsDataMap _networkInputs;
     network.getInputsInfo(_networkInputs);
@@ -103,6 +101,16 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(InferenceEngine::
         }
     }
     // todo: handle input precision differently - per input and not one per network...
+}
+
+}  // namespace
+
+ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network,
+                                                               const std::map<std::string, std::string> &config) {
+    checkNetworkInputs(network);
+
+    CLDNNGraph::Config conf = this->_impl->m_config;
+    conf.LoadFromMap(config);
 
     int max_batch = -1;
     if (conf.enableDynamicBatch) {
@@ -112,6 +120,40 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(InferenceEngine::
     return std::make_shared<CLDNNGraph>(network, conf, max_batch);
 }
 
+IExecutableNetwork::Ptr clDNNEngine::ImportNetwork(const std::string &modelFileName,
+                                                   const std::map<std::string, std::string> &config) {
+    std::map<std::string, std::string> exportedConfig;
+    std::vector<char> programsBinaries;
+    std::vector<char> constantsData;
+    auto network = CLDNNGraph::ReadExported(modelFileName, exportedConfig, programsBinaries, constantsData);
+
+    CLDNNGraph::Config conf = this->_impl->m_config;
+    conf.LoadFromMap(exportedConfig);
+    conf.LoadFromMap(config);
+
+    checkNetworkInputs(*network);
+
+    int max_batch = -1;
+    if (conf.enableDynamicBatch) {
+        max_batch = network->getBatchSize();
+    }
+
+    auto impl = std::make_shared<CLDNNGraph>(*network, conf, max_batch, programsBinaries, constantsData);
+    InputsDataMap inputs;
+    network->getInputsInfo(inputs);
+    impl->setNetworkInputs(inputs);
+    OutputsDataMap outputs;
+    network->getOutputsInfo(outputs);
+    impl->setNetworkOutputs(outputs);
+    impl->SetPointerToPluginInternal(shared_from_this());
+
+    IExecutableNetwork::Ptr executableNetwork;
+    executableNetwork.reset(new ExecutableNetworkBase<ExecutableNetworkInternal>(impl), [](details::IRelease *p) {
+        p->Release();
+    });
+    return executableNetwork;
+}
+
 INFERENCE_PLUGIN_API(StatusCode) CreatePluginEngine(IInferencePlugin *&plugin, ResponseDesc *resp) noexcept {
     try {
         plugin = make_ie_compatible_plugin(
@@ -131,6 +173,10 @@ INFERENCE_PLUGIN_API(StatusCode) CreatePluginEngine(IInferencePlugin *&plugin, R
 
 void clDNNEngine::SetConfig(const std::map<std::string, std::string> &config) {
     _impl->m_config.LoadFromMap(config);
+    // the networks shared by KEY_SHARE_EXECUTABLE_NETWORK are loaded with the same config of the plugin
+    for (auto &item : config) {
+        _config[item.first] = item.second;
+    }
 }
 
 void clDNNEngine::QueryNetwork(const ICNNNetwork& network, QueryNetworkResult& res) const {
@@ -152,6 +198,9 @@ void clDNNEngine::QueryNetwork(const ICNNNetwork& network, const std::map<std::s
             concats.push_back(layer);
         } else if (CaselessEq<std::string>()(layer->type, "Const")) {
             constantBlobs.push_back(layer);
+        } else if (CaselessEq<std::string>()(layer->type, "RNN")) {
+            if (CLDNNGraph::IsRNNLayerSupported(layer))
+                res.supportedLayers.insert(layer->name);
         } else if (CLDNNGraph::IsLayerSupported(layer->type)) {
             res.supportedLayers.insert((*i)->name);
         }
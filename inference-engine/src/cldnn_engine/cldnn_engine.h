@@ -27,6 +27,13 @@ public:
     InferenceEngine::ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network,
                                                                        const std::map<std::string, std::string> &config) override;
 
+    /**
+     * @brief Loads the network exported by CLDNNGraph::Export, the configuration of the export is applied
+     * before the given one and the OpenCL programs are loaded from the stored binaries if the device matches
+     */
+    InferenceEngine::IExecutableNetwork::Ptr ImportNetwork(const std::string &modelFileName,
+                                                          const std::map<std::string, std::string> &config) override;
+
     void SetConfig(const std::map<std::string, std::string> &config) override;
     /**
      * @depricated Use the version with config parameter
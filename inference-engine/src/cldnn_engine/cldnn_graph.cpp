@@ -39,10 +39,14 @@
 #include <CPP/mutable_data.hpp>
 #include <CPP/max_unpooling.hpp>
 #include <CPP/arg_max_min.hpp>
+#include <CPP/lookup_table.hpp>
 #include <CPP/mvn.hpp>
+#include <CPP/lstm.hpp>
 #include <chrono>
 #include <cmath>
+#include <cstring>
 #include <algorithm>
+#include <limits>
 #include "cldnn_graph.h"
 #include "simple_math.h"
 #include <description_buffer.hpp>
@@ -51,8 +55,15 @@
 #include "cldnn_infer_request.h"
 #include <cpp_interfaces/ie_executor_manager.hpp>
 #include <caseless.hpp>
+#include <ie_binary_ir.hpp>
+#include <file_utils.h>
+#include <ie_util_internal.hpp>
+#include <ie_profiling.hpp>
 #include <fstream>
 #include <utility>
+#include <mutex>
+#include <iostream>
+#include <iomanip>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -60,8 +71,6 @@ using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
 #ifndef NDEBUG
-#include <iostream>
-#include <iomanip>
 #define THROW_CLDNN_EXCEPTION(desc)\
 do { \
 InferenceEngineException ex(__FILE__, __LINE__);\
@@ -74,6 +83,50 @@ __LINE__ << " (" << __FUNCTION__ << ")\n---\n" << std::endl; THROW_IE_EXCEPTION
 
 namespace CLDNNPlugin {
 
+namespace {
+
+// the engines of the networks loaded with KEY_CLDNN_SHARED_ENGINE, they live while any of their networks does
+std::mutex sharedEnginesMutex;
+std::map<std::string, std::weak_ptr<const cldnn::engine>> sharedEngines;
+
+// the scores of the top-k of the features of an output are the output of its name with the suffix
+const char topKScoresSuffix[] = "_top_k_scores";
+
+// the output of the indices or the scores of the top-k features of the output
+DataPtr CreateTopKOutputData(const DataPtr& output, const std::string& name, uint32_t k, Precision precision) {
+    auto dims = output->getTensorDesc().getDims();
+    if (dims.size() != 2 && dims.size() != 4) {
+        THROW_IE_EXCEPTION << "The top-k of the output " << output->getName() << " needs the N, C, H, W or N, C dims";
+    }
+    if (dims[1] < k) {
+        THROW_IE_EXCEPTION << "The output " << output->getName() << " has less than " << k << " features";
+    }
+    dims[1] = k;
+    return std::make_shared<Data>(name, TensorDesc(precision, dims, output->getTensorDesc().getLayout()));
+}
+
+// the phases of the build of a program run one after another in the constructor of its network, so they are traced
+// from the build statistics of the engine as consecutive events since the begin of the build
+void TraceBuildPhases(TraceCollector::Clock::time_point begin, const cldnn::build_statistics& before,
+                      const cldnn::build_statistics& after) {
+    if (!TraceCollector::isEnabled()) {
+        return;
+    }
+    auto phase = [&begin](const char* name, uint64_t microseconds) {
+        const auto end = begin + std::chrono::microseconds(microseconds);
+        TraceCollector::add(name, begin, end);
+        begin = end;
+    };
+    phase("CLDNN_OptimizeGraph", after.graph_optimization_time - before.graph_optimization_time);
+    // the lookups of the tuning caches are made by the selection of the kernels
+    TraceCollector::add("CLDNN_TuningLookup", begin,
+                        begin + std::chrono::microseconds(after.tuning_lookup_time - before.tuning_lookup_time));
+    phase("CLDNN_SelectKernels", after.kernels_selection_time - before.kernels_selection_time);
+    phase("CLDNN_CompileKernels", after.kernels_compilation_time - before.kernels_compilation_time);
+}
+
+}  // namespace
+
 const cldnn::primitive_id CLDNNGraph::m_preProcessTag("_cldnn_input_preprocess");
 const cldnn::primitive_id CLDNNGraph::m_weightsTag("_cldnn_weights");
 const cldnn::primitive_id CLDNNGraph::m_biasesTag("_cldnn_biases");
@@ -83,6 +136,11 @@ const cldnn::primitive_id CLDNNGraph::m_scalesTag("_cldnn_scales");
 const cldnn::primitive_id CLDNNGraph::m_workaroundTag("_cldnn_workaround");
 const cldnn::primitive_id CLDNNGraph::m_preCustomLayerTag("_cldnn_custom_preprocess");
 const cldnn::primitive_id CLDNNGraph::m_postCustomLayerTag("_cldnn_custom_postprocess");
+const cldnn::primitive_id CLDNNGraph::m_quantizeTag("_cldnn_quantize");
+const cldnn::primitive_id CLDNNGraph::m_dequantizeTag("_cldnn_dequantize");
+const cldnn::primitive_id CLDNNGraph::m_topKTag("_cldnn_top_k");
+const cldnn::primitive_id CLDNNGraph::m_frameParamsTag("_cldnn_frame_params");
+const cldnn::primitive_id CLDNNGraph::m_frameConstantsTag("_cldnn_frame_constants");
 
 static void ValidateLayer(const InferenceEngine::CNNLayerPtr& layer, unsigned inputs) {  // todo: add more checks
     if (inputs && layer->insData.size() != inputs) {
@@ -198,6 +256,8 @@ void CLDNNGraph::Config::LoadFromMap(const std::map<std::string, std::string>& c
                 tuningConfig.mode = cldnn::tuning_mode::tuning_disabled;
             } else if (val.compare(PluginConfigParams::TUNING_CREATE) == 0) {
                 tuningConfig.mode = cldnn::tuning_mode::tuning_tune_and_cache;
+            } else if (val.compare(CLDNNConfigParams::CLDNN_TUNING_CREATE_NETWORK) == 0) {
+                tuningConfig.mode = cldnn::tuning_mode::tuning_tune_network_and_cache;
             } else if (val.compare(PluginConfigParams::TUNING_USE_EXISTING) == 0) {
                 tuningConfig.mode = cldnn::tuning_mode::tuning_use_cache;
             } else {
@@ -213,6 +273,67 @@ void CLDNNGraph::Config::LoadFromMap(const std::map<std::string, std::string>& c
             } else {
                 THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported memory pool flag value: " << val;
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_MEM_POOL_LIMIT) == 0) {
+            int limit = -1;
+            try {
+                limit = std::stoi(val);
+            } catch (...) {
+            }
+            if (limit < 0) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported memory pool limit value: " << val;
+            }
+            memory_pool_limit = static_cast<uint64_t>(limit) << 20;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_WEIGHTS_CACHE) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                weightsCache = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                weightsCache = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported weights cache flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_OUT_OF_ORDER_QUEUE) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                outOfOrderQueue = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                outOfOrderQueue = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported out-of-order queue flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_PIPELINED_OUTPUTS) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                pipelinedOutputs = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                pipelinedOutputs = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported pipelined outputs flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_MICRO_BATCH) == 0) {
+            int batch = -1;
+            try {
+                batch = std::stoi(val);
+            } catch (...) {
+            }
+            if (batch < 0) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            microBatch = batch;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_OUTPUT_TOP_K) == 0) {
+            std::map<std::string, uint32_t> topK;
+            std::stringstream list(val);
+            std::string output;
+            while (std::getline(list, output, ',')) {
+                const auto colon = output.rfind(':');
+                int k = 0;
+                try {
+                    k = colon == std::string::npos ? 0 : std::stoi(output.substr(colon + 1));
+                } catch (...) {
+                }
+                if (k < 1 || colon == 0) {
+                    THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+                }
+                topK[output.substr(0, colon)] = static_cast<uint32_t>(k);
+            }
+            outputTopK = topK;
         } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_GRAPH_DUMPS_DIR) == 0) {
             if (!val.empty()) {
                 graph_dumps_dir = val;
@@ -223,6 +344,105 @@ void CLDNNGraph::Config::LoadFromMap(const std::map<std::string, std::string>& c
                 sources_dumps_dir = val;
                 mkdir(sources_dumps_dir.c_str(), 0755);
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_DIR) == 0) {
+            if (!val.empty()) {
+                kernels_cache_dir = val;
+                mkdir(kernels_cache_dir.c_str(), 0755);
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_SHARED_CONTEXT) == 0) {
+            try {
+                sharedContext = reinterpret_cast<void *>(static_cast<uintptr_t>(std::stoull(val)));
+            } catch (...) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            // the handle is valid in this process only, so it is not stored with the exported network
+            continue;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_COMPILATION_LISTENER) == 0) {
+            try {
+                compilationListener = reinterpret_cast<void *>(static_cast<uintptr_t>(std::stoull(val)));
+            } catch (...) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            continue;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_THROUGHPUT_STREAMS) == 0) {
+            int streams = 0;
+            try {
+                streams = std::stoi(val);
+            } catch (...) {
+            }
+            if (streams < 1) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            throughputStreams = streams;
+        } else if (key.compare(PluginConfigParams::KEY_DEVICE_ID) == 0) {
+            std::vector<uint32_t> ids;
+            std::stringstream list(val);
+            std::string id;
+            while (std::getline(list, id, ',')) {
+                try {
+                    ids.push_back(static_cast<uint32_t>(std::stoul(id)));
+                } catch (...) {
+                    THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+                }
+            }
+            if (ids.empty()) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            deviceIds = ids;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_BALANCER) == 0) {
+            if (val.compare(CLDNNConfigParams::CLDNN_BALANCER_ROUND_ROBIN) == 0) {
+                balancer = Balancer::RoundRobin;
+            } else if (val.compare(CLDNNConfigParams::CLDNN_BALANCER_LEAST_LOADED) == 0) {
+                balancer = Balancer::LeastLoaded;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_SHAPE_VARIANTS) == 0) {
+            int variants = 0;
+            try {
+                variants = std::stoi(val);
+            } catch (...) {
+            }
+            if (variants < 1) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            shapeVariants = static_cast<size_t>(variants);
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_DEVICE_PREPROCESSING) == 0) {
+            if (val.compare(PluginConfigParams::NO) == 0) {
+                frameWidth = frameHeight = 0;
+            } else {
+                const size_t separator = val.find('x');
+                int width = 0, height = 0;
+                try {
+                    width = std::stoi(val.substr(0, separator));
+                    height = separator == std::string::npos ? 0 : std::stoi(val.substr(separator + 1));
+                } catch (...) {
+                }
+                if (width < 1 || height < 1) {
+                    THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+                }
+                frameWidth = static_cast<size_t>(width);
+                frameHeight = static_cast<size_t>(height);
+            }
+        } else if (key.compare(PluginConfigParams::KEY_LOG_LEVEL) == 0) {
+            if (val.compare(PluginConfigParams::LOG_NONE) == 0) {
+                logLevel = LogLevel::None;
+            } else if (val.compare(PluginConfigParams::LOG_WARNING) == 0) {
+                logLevel = LogLevel::Warning;
+            } else if (val.compare(PluginConfigParams::LOG_INFO) == 0) {
+                logLevel = LogLevel::Info;
+            } else if (val.compare(PluginConfigParams::LOG_DEBUG) == 0) {
+                logLevel = LogLevel::Debug;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported log level value by plugin: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_SHARED_ENGINE) == 0) {
+            sharedEngine = val;
+        } else if (key.compare(PluginConfigParams::KEY_ASYNC_THREADS_CORES) == 0) {
+            asyncThreads.cpus = val.compare(PluginConfigParams::NO) == 0 ? std::vector<int>() : parseCpuList(key, val);
+            checkTaskExecutorConfig(asyncThreads);
+        } else if (key.compare(PluginConfigParams::KEY_ASYNC_THREADS_PRIORITY) == 0) {
+            asyncThreads.priority = parseThreadsPriority(key, val);
         } else if (key.compare(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0) {
                 exclusiveAsyncRequests = true;
@@ -234,6 +454,7 @@ void CLDNNGraph::Config::LoadFromMap(const std::map<std::string, std::string>& c
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property key by plugin: " << key;
         }
+        key_config_map[key] = val;
     }
 }
 
@@ -262,7 +483,7 @@ bool CLDNNGraph::CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const
             ROIPooling == type ||
             PriorBox == type ||
             DetectionOutput == type ||
-            Reshape == type ||
+            ReshapeLayer == type ||
             Permute == type ||
             Flatten == type ||
             Proposal == type ||
@@ -280,28 +501,59 @@ bool CLDNNGraph::CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const
     return check_result;
 }
 
-CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& config, int max_batch) : m_config(config),
+CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& config, int max_batch,
+                       const std::vector<char>& programsBinaries,
+                       const std::vector<char>& constantsData) : m_config(config),
+    m_network(cloneNet(network)),
     m_defaultFormat(cldnn::format::bfyx),
     m_networkPrecision(cldnn::data_types::f32),
+    m_nextStream(0),
     m_curBatch(-1) {
-    m_env.engine = std::make_shared<cldnn::engine>(cldnn::engine_configuration(
-        (config.useProfiling || (config.tuningConfig.mode != cldnn::tuning_mode::tuning_disabled)),
-        false,
-        config.dumpCustomKernels,
-        std::string(),
-        std::string(),
-        true,
-        std::string(),
-        config.sources_dumps_dir,
-        config.queuePriority,
-        config.queueThrottle,
-        config.memory_pool_on));
+    m_env.engine = config.sharedEngine.empty() ? CreateEngine(config.sharedContext, config.deviceIds.front())
+                                               : GetSharedEngine();
+    if (!programsBinaries.empty()) {
+        m_env.engine->set_programs_binaries(programsBinaries);
+    }
+    if (!constantsData.empty()) {
+        m_env.engine->set_constants_data(constantsData);
+    }
 #if 0
         m_env.debugOptions.PrintOptions();
 #endif
+    // the threads of the plugin only wait for the device, so they are kept off the cores of the application
+    const bool placedThreads = !config.asyncThreads.cpus.empty() || config.asyncThreads.priority != 0;
     if (config.exclusiveAsyncRequests) {
+        // the requests infer the single network of the single stream (see CreateStreams), so they run one by one
         ExecutorManager *executorManager = ExecutorManager::getInstance();
-        _taskExecutor = executorManager->getExecutor(TargetDeviceInfo::name(TargetDevice::eGPU));
+        _taskExecutor = executorManager->getExecutor(TargetDeviceInfo::name(TargetDevice::eGPU), 1, config.asyncThreads);
+    } else if (!config.sharedEngine.empty()) {
+        // the networks of the engine reuse the intermediate buffers of each other, so they are inferred one by one
+        ExecutorManager *executorManager = ExecutorManager::getInstance();
+        _taskExecutor = executorManager->getExecutor(std::string(TargetDeviceInfo::name(TargetDevice::eGPU)) + "_" + config.sharedEngine,
+                                                     1, config.asyncThreads);
+    } else if (placedThreads) {
+        _taskExecutor = std::make_shared<TaskExecutor>("GPU", config.asyncThreads);
+    }
+    if (placedThreads) {
+        _callbackExecutor = std::make_shared<TaskExecutor>("GPUCallbacks", config.asyncThreads);
+    }
+
+    // the resize of the ROI inputs by the CPU is pipelined with the inference of the previous request on the device
+    InputsDataMap networkInputs;
+    network.getInputsInfo(networkInputs);
+    for (auto &input : networkInputs) {
+        if (IsFrameInput(input.second)) {
+            if (max_batch > 1) {
+                THROW_CLDNN_EXCEPTION("The device pre-processing of the input " << input.first
+                                      << " is not supported with the dynamic batch");
+            }
+        } else if (input.second->getPreProcess().getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE) {
+            _preprocessExecutor = std::make_shared<TaskExecutor>("GPUPreprocess", config.asyncThreads);
+        }
+    }
+    // the copy of the outputs is the post-processing stage of the pipeline
+    if (config.pipelinedOutputs && !_preprocessExecutor) {
+        _preprocessExecutor = std::make_shared<TaskExecutor>("GPUPreprocess", config.asyncThreads);
     }
 
     if (max_batch > 1) {
@@ -309,23 +561,16 @@ CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& conf
         if (!CanProcessDynBatch(network)) {
             THROW_CLDNN_EXCEPTION("Such topology cannot be compiled for dynamic batch!");
         }
-
-        // calculate number of networks necessary based on binary log
-        unsigned int tmp = max_batch;
-        unsigned int mask = 1 << 31;
-        unsigned int ldigit = 31;
-
-        while (!(tmp & mask)) {
-            mask >>= 1;
-            ldigit--;
+        if (config.throughputStreams > 1 && !config.exclusiveAsyncRequests) {
+            THROW_CLDNN_EXCEPTION("The dynamic batch cannot be used with several streams!");
         }
-
-        m_env.m_bv_sz = ldigit + 1;
-    } else {
-        m_env.m_bv_sz = 0;
     }
 
     m_env.m_max_batch = max_batch;
+    if (max_batch > 1) {
+        BuildBatchNetworks(network, max_batch);
+        changeInputBatch(max_batch);
+    }
 
     // Handle workarounds
     char networkName[128] = { 0 };
@@ -333,36 +578,57 @@ CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& conf
     m_env.debugOptions.EnableWA(networkName);
     m_env.debugOptions.AddTimedEvent("Loading Begin");
 
-    if (max_batch > 1) {
-        for (int b = m_env.m_bv_sz - 1; b >= 0; b--) {
-            m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
-            m_env.network.reset();
-            m_env.constBlobs.clear();
-            m_env.inputLayouts.clear();
-            m_env.outputDims.clear();
-            m_env.primitiveIDs.clear();
-
-            changeInputBatch(1 << b);
-            Load(network);
-            CompileNetwork();
-            m_env.batchNetworks.insert(m_env.batchNetworks.begin(), m_env.network);
-
-            m_topology.reset();
-            m_env.engine->release_pending_memory();
-        }
+    m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
+    const auto microBatchNetwork = max_batch > 1 ? nullptr : CreateMicroBatchNetwork(network);
+    if (microBatchNetwork) {
+        m_env.m_micro_batches = static_cast<int>(network.getBatchSize()) / m_config.microBatch;
+        Load(*microBatchNetwork);
     } else {
-        m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
         Load(network);
-        CompileNetwork();
-        m_topology.reset();
-        m_env.engine->release_pending_memory();
     }
+    if (!config.compilationListener) {
+        Compile();
+        return;
+    }
+
+    // the topology keeps the data of the network, so the compilation doesn't need the network of the caller
+    auto listener = static_cast<CLDNNConfigParams::ICompilationListener *>(config.compilationListener);
+    m_compilation = std::async(std::launch::async, [this, listener]() {
+        try {
+            Compile();
+        } catch (const std::exception &e) {
+            listener->onCompiled(GENERAL_ERROR, e.what());
+            throw;
+        }
+        listener->onCompiled(OK, "");
+    }).share();
+}
+
+CLDNNGraph::~CLDNNGraph() {
+    if (m_compilation.valid()) {
+        m_compilation.wait();
+    }
+}
+
+void CLDNNGraph::Compile() {
+    CompileNetwork();
+    LogTuningStatistics();
+    m_env.engine->release_pending_memory();
+    CreateStreams();
+    LogMemoryStatistics();
+    m_topology.reset();
 
     m_env.debugOptions.AddTimedEvent("Loading", "Loading Begin");
     m_env.debugOptions.PrintTimedEvents();
     m_env.debugOptions.ClearTimedEvents();
 }
 
+void CLDNNGraph::WaitCompiled() const {
+    if (m_compilation.valid()) {
+        m_compilation.get();
+    }
+}
+
 std::vector<InferenceEngine::CNNLayerPtr> CLDNNGraph::GetNextLayers(const InferenceEngine::DataPtr data) {
     std::vector<InferenceEngine::CNNLayerPtr> nextLayers;
     if (data == nullptr) {
@@ -411,8 +677,80 @@ void CLDNNGraph::InitFormat(InferenceEngine::ICNNNetwork &network) {
     m_networkPrecision = DataTypeFromPrecision(network.getPrecision());
 }
 
-void CLDNNGraph::CompileNetwork() {
-    m_env.debugOptions.AddTimedEvent("Network Build Begin");
+void CLDNNGraph::LogTuningStatistics() const {
+    if (m_config.logLevel < Config::LogLevel::Info) {
+        return;
+    }
+    // the streams load the kernels selected for the first network, so its engine gives the statistics of the graph
+    const auto statistics = m_env.engine->get_tuning_statistics();
+    const uint64_t hits = statistics.online_cache_hits + statistics.offline_cache_hits;
+    const uint64_t total = hits + statistics.cache_misses;
+    if (total == 0) {
+        return;
+    }
+    std::cout << "[ INFO ] GPU tuning cache: " << hits << " of " << total << " kernels found ("
+              << std::fixed << std::setprecision(1) << 100.0 * hits / total << "%), "
+              << statistics.online_cache_hits << " in the tuning file, "
+              << statistics.offline_cache_hits << " in the offline cache" << std::endl;
+}
+
+void CLDNNGraph::LogMemoryStatistics() const {
+    if (m_config.logLevel < Config::LogLevel::Info) {
+        return;
+    }
+    // each stream allocates the intermediate buffers of its network, the constants are shared through the context
+    cldnn::memory_statistics total = {};
+    auto add = [&total](const cldnn::engine& engine) {
+        const auto statistics = engine.get_memory_statistics();
+        total.current_used += statistics.current_used;
+        total.peak_used += statistics.peak_used;
+        total.pool_used += statistics.pool_used;
+        total.pool_requested += statistics.pool_requested;
+    };
+    for (auto& stream : m_streams) {
+        add(*stream.env.engine);
+        if (stream.env.microBatchEngine) {
+            add(*stream.env.microBatchEngine);
+        }
+    }
+    const double megabyte = 1 << 20;
+    std::cout << "[ INFO ] GPU memory: " << std::fixed << std::setprecision(1)
+              << total.current_used / megabyte << " MB used, " << total.peak_used / megabyte << " MB at peak, "
+              << total.pool_used / megabyte << " MB of the memory pool for "
+              << total.pool_requested / megabyte << " MB of the intermediate buffers" << std::endl;
+}
+
+std::shared_ptr<const cldnn::engine> CLDNNGraph::CreateEngine(void* context, uint32_t deviceId) const {
+    return std::make_shared<cldnn::engine>(cldnn::engine_types::ocl, deviceId, cldnn::engine_configuration(
+        (m_config.useProfiling || (m_config.tuningConfig.mode != cldnn::tuning_mode::tuning_disabled)),
+        false,
+        m_config.dumpCustomKernels,
+        std::string(),
+        std::string(),
+        m_config.outOfOrderQueue,
+        std::string(),
+        m_config.sources_dumps_dir,
+        m_config.queuePriority,
+        m_config.queueThrottle,
+        m_config.memory_pool_on,
+        m_config.kernels_cache_dir,
+        context,
+        m_config.memory_pool_limit,
+        m_config.weightsCache));
+}
+
+std::shared_ptr<const cldnn::engine> CLDNNGraph::GetSharedEngine() const {
+    std::lock_guard<std::mutex> lock(sharedEnginesMutex);
+    auto engine = sharedEngines[m_config.sharedEngine].lock();
+    if (!engine) {
+        // the engine is configured by the first network, the rest use it as it is
+        engine = CreateEngine(m_config.sharedContext, m_config.deviceIds.front());
+        sharedEngines[m_config.sharedEngine] = engine;
+    }
+    return engine;
+}
+
+std::shared_ptr<cldnn::network> CLDNNGraph::BuildNetwork(const cldnn::engine& engine) const {
     cldnn::build_options options;
     if (!m_config.graph_dumps_dir.empty()) {
         options.set_option(cldnn::build_option::graph_dumps_dir(m_config.graph_dumps_dir));
@@ -420,17 +758,172 @@ void CLDNNGraph::CompileNetwork() {
     options.set_option(cldnn::build_option::optimize_data(true));
     options.set_option(cldnn::build_option::tuning_config(m_config.tuningConfig));
 
+    return std::make_shared<cldnn::network>(cldnn::network(engine, *m_topology, options));
+}
+
+InferenceEngine::details::CNNNetworkImplPtr CLDNNGraph::CreateMicroBatchNetwork(ICNNNetwork &network) {
+    const size_t batch = network.getBatchSize();
+    const size_t microBatch = static_cast<size_t>(m_config.microBatch);
+    if (microBatch == 0 || batch <= microBatch || batch % microBatch != 0 || !CanProcessDynBatch(network)) {
+        return nullptr;
+    }
+
+    // the layers of the copy share the weights with the network
+    auto microBatchNetwork = cloneNet(network);
+    InputsDataMap inputs;
+    microBatchNetwork->getInputsInfo(inputs);
+    ICNNNetwork::InputShapes shapes;
+    for (auto &input : inputs) {
+        auto dims = input.second->getTensorDesc().getDims();
+        // the frames of the batch are read by the single pre-processing kernel
+        if (dims.empty() || dims[0] != batch || IsFrameInput(input.second)) {
+            return nullptr;
+        }
+        dims[0] = microBatch;
+        shapes[input.first] = dims;
+    }
+    ResponseDesc resp;
+    if (microBatchNetwork->reshape(shapes, &resp) != OK) {
+        return nullptr;
+    }
+
+    // the images of the micro batches are written to the parts of the output blobs
+    OutputsDataMap outputs;
+    microBatchNetwork->getOutputsInfo(outputs);
+    for (auto &output : outputs) {
+        const auto& dims = output.second->getTensorDesc().getDims();
+        if (dims.empty() || dims[0] != microBatch) {
+            return nullptr;
+        }
+    }
+    return microBatchNetwork;
+}
+
+void CLDNNGraph::BuildMicroBatchNetwork(InferenceEnv& env, uint32_t deviceId) const {
+    if (env.m_micro_batches <= 1) {
+        return;
+    }
+    env.microBatchEngine = CreateEngine(env.engine->get_cl_context(), deviceId);
+    env.microBatchEngine->set_programs_binaries(env.engine->get_programs_binaries());
+    env.microBatchNetwork = BuildNetwork(*env.microBatchEngine);
+    for (auto& cblob : env.constBlobs) {
+        env.microBatchNetwork->set_input_data(cblob.first, cblob.second);
+    }
+}
+
+void CLDNNGraph::BuildBatchNetworks(InferenceEngine::ICNNNetwork &network, int max_batch) {
+    IE_PROFILING_AUTO_SCOPE(CLDNN_BuildBatchNetworks)
+    // each network is loaded into the empty environment, the network of the maximal batch is loaded after them
+    const InferenceEnv base = m_env;
+    std::vector<std::shared_ptr<cldnn::network>> batchNetworks;
+    for (int batch = 1; batch < max_batch; batch <<= 1) {
+        m_env = base;
+        m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
+        changeInputBatch(batch);
+        Load(network);
+        auto batchNetwork = BuildNetwork(*m_env.engine);
+        for (auto& cblob : m_env.constBlobs) {
+            batchNetwork->set_input_data(cblob.first, cblob.second);
+        }
+        batchNetworks.push_back(batchNetwork);
+        m_topology.reset();
+        m_env.engine->release_pending_memory();
+    }
+    m_env = base;
+    m_env.batchNetworks = batchNetworks;
+}
+
+void CLDNNGraph::CreateStreams() {
+    IE_PROFILING_AUTO_SCOPE(CLDNN_CreateStreams)
+    m_streams.push_back({ m_env, _taskExecutor, _taskSynchronizer, {} });
+
+    // exclusive requests and the networks of the shared engine share the single executor with other networks,
+    // so the streams are not applicable. The network of the context of the application runs on its device only,
+    // otherwise each device of KEY_DEVICE_ID runs one stream at least
+    const bool singleExecutor = m_config.exclusiveAsyncRequests || !m_config.sharedEngine.empty();
+    const size_t devices = (singleExecutor || m_config.sharedContext) ? 1 : m_config.deviceIds.size();
+    const size_t streams = singleExecutor ? 1 : std::max(static_cast<size_t>(m_config.throughputStreams), devices);
+    if (streams == 1) {
+        return;
+    }
+
+    // the engines of the streams of a device run in the context of its first engine, so the networks of the first
+    // device read the weights of the topology in place and the other devices copy them to their contexts.
+    // The programs compiled for the first network are loaded instead of being compiled again (the binaries of
+    // another device model are not matched), the same for the weights reordered for the first network with the
+    // weights cache
+    std::map<uint32_t, void*> contexts = { { m_config.deviceIds.front(), m_env.engine->get_cl_context() } };
+    const std::vector<char> programsBinaries = m_env.engine->get_programs_binaries();
+    const std::vector<char> constantsData = m_config.weightsCache ? m_env.engine->get_constants_data() : std::vector<char>();
+    for (size_t s = 1; s < streams; s++) {
+        m_env.debugOptions.AddTimedEvent("Stream Build Begin");
+        const uint32_t deviceId = m_config.deviceIds[s % devices];
+        auto context = contexts.find(deviceId);
+        InferenceEnv env = m_env;
+        env.engine = CreateEngine(context != contexts.end() ? context->second : nullptr, deviceId);
+        if (context == contexts.end()) {
+            contexts[deviceId] = env.engine->get_cl_context();
+        }
+        env.engine->set_programs_binaries(programsBinaries);
+        if (!constantsData.empty()) {
+            env.engine->set_constants_data(constantsData);
+        }
+        env.network = BuildNetwork(*env.engine);
+        for (auto& cblob : env.constBlobs) {
+            env.network->set_input_data(cblob.first, cblob.second);
+        }
+        BuildMicroBatchNetwork(env, deviceId);
+        env.engine->release_pending_memory();
+        m_env.debugOptions.AddTimedEvent("Stream Build", "Stream Build Begin");
+
+        m_streams.push_back({ env, std::make_shared<TaskExecutor>("GPUStream", m_config.asyncThreads),
+                              std::make_shared<TaskSynchronizer>(), {} });
+    }
+}
+
+size_t CLDNNGraph::SelectStream() {
+    const size_t next = m_nextStream++ % m_streams.size();
+    if (m_config.balancer != Config::Balancer::LeastLoaded) {
+        return next;
+    }
+
+    // the streams with the same number of the requests are taken in turn
+    std::lock_guard<std::mutex> lock(m_streamsMutex);
+    size_t selected = next;
+    size_t selectedLoad = std::numeric_limits<size_t>::max();
+    for (size_t i = 0; i < m_streams.size(); i++) {
+        const size_t s = (next + i) % m_streams.size();
+        auto& requests = m_streams[s].requests;
+        requests.erase(std::remove_if(requests.begin(), requests.end(),
+                                      [](const std::weak_ptr<IInferRequest>& r) { return r.expired(); }),
+                       requests.end());
+        if (requests.size() < selectedLoad) {
+            selected = s;
+            selectedLoad = requests.size();
+        }
+    }
+    return selected;
+}
+
+void CLDNNGraph::CompileNetwork() {
+    IE_PROFILING_AUTO_SCOPE(CLDNN_BuildNetwork)
+    m_env.debugOptions.AddTimedEvent("Network Build Begin");
     m_env.network.reset();
-    m_env.network = std::make_shared<cldnn::network>(cldnn::network(*(m_env.engine), *m_topology, options));
+    const auto statistics = m_env.engine->get_build_statistics();
+    const auto buildBegin = TraceCollector::Clock::now();
+    m_env.network = BuildNetwork(*m_env.engine);
+    TraceBuildPhases(buildBegin, statistics, m_env.engine->get_build_statistics());
     m_env.debugOptions.AddTimedEvent("Network Build", "Network Build Begin");
 
     // add input data from all constant blobs
     for (auto& cblob : m_env.constBlobs) {
         m_env.network->set_input_data(cblob.first, cblob.second);
     }
+    BuildMicroBatchNetwork(m_env, m_config.deviceIds.front());
 }
 
 void CLDNNGraph::Load(InferenceEngine::ICNNNetwork &network) {
+    IE_PROFILING_AUTO_SCOPE(CLDNN_CreateTopology)
     InitFormat(network);
     auto _networkPrecision = network.getPrecision();
 
@@ -499,7 +992,8 @@ void CLDNNGraph::Load(InferenceEngine::ICNNNetwork &network) {
         }
 
         infLoopProtection = 0;  // found a layer with all inputs already existing
-        IE_ASSERT(_networkPrecision == currLayer->precision);
+        // the convolutions quantized by CNNNetworkInt8Normalizer are the only layers in another precision
+        IE_ASSERT(_networkPrecision == currLayer->precision || IsInt8Convolution(currLayer));
         CreateSingleLayerPrimitive(currLayer);  // currLayer will be advanced if layer was skipped or merged
         m_env.prevPrimitiveIDs[currLayer->name] = GetPrevLayersPrimitives(currLayer);
 
@@ -510,6 +1004,10 @@ void CLDNNGraph::Load(InferenceEngine::ICNNNetwork &network) {
 
     // 3. Handle output reordering
     for (auto output : networkOutputs) {
+        if (m_config.outputTopK.find(output.first) != m_config.outputTopK.end()) {
+            AddTopKOutputPrimitives(output.first, output.second);
+            continue;
+        }
         // always reorder and let clDNN remove unneeded reorders
         AddOutputPrimitive(output.first, output.second);
     }
@@ -518,6 +1016,7 @@ void CLDNNGraph::Load(InferenceEngine::ICNNNetwork &network) {
     // 5. profit
     p_currentInputs = nullptr;
     p_currentOutputs = nullptr;
+    m_mergeableCustomLayers.clear();
 }
 
 CLDNNGraph::LayerType CLDNNGraph::LayerTypeFromStr(const std::string &str) {
@@ -546,7 +1045,7 @@ CLDNNGraph::LayerType CLDNNGraph::LayerTypeFromStr(const std::string &str) {
         { "PriorBox" , PriorBox },
         { "DetectionOutput" , DetectionOutput },
         { "Normalize" , Normalize },
-        { "Reshape" , Reshape },
+        { "Reshape" , ReshapeLayer },
         { "Permute" , Permute },
         { "Flatten" , Flatten },
         { "BatchNormalization" , BatchNormalization },
@@ -564,6 +1063,7 @@ CLDNNGraph::LayerType CLDNNGraph::LayerTypeFromStr(const std::string &str) {
         { "ArgMax" , ArgMax },
         { "MVN" , MVN },
         { "Unpooling" , Unpooling },
+        { "RNN" , RNN },
     };
     auto it = LayerNameToType.find(str);
     if (it != LayerNameToType.end())
@@ -685,6 +1185,15 @@ void CLDNNGraph::CreatePrimitiveFromBlob(cldnn::primitive_id primID,
     m_topology->add(cldnn::data(primID, mem));
 }
 
+void CLDNNGraph::CreateFloatDataPrimitive(cldnn::primitive_id primID, const std::vector<float>& values, cldnn::tensor size) {
+    cldnn::layout valuesLayout(cldnn::data_types::f32, m_defaultFormat, size);
+    IE_ASSERT(valuesLayout.count() == values.size());
+    auto mem = cldnn::memory::allocate(*(m_env.engine), valuesLayout);
+    auto tmpPointer = mem.pointer<float>();  // implicitly maps buffer - unmap in destructor
+    std::copy(values.begin(), values.end(), tmpPointer.data());
+    m_topology->add(cldnn::data(primID, mem));
+}
+
 void CLDNNGraph::CreateWeightAndBiasPrimitives(const InferenceEngine::CNNLayerPtr& layer,
                                                    std::vector<cldnn::primitive_id>& weightsPrimID,
                                                    std::vector<cldnn::primitive_id>& biasesPrimID) {
@@ -920,7 +1429,7 @@ void CLDNNGraph::CreateSingleLayerPrimitive(InferenceEngine::CNNLayerPtr &layer)
             break;
         case Normalize: CreateNormalizePrimitive(layer);
             break;
-        case Reshape: CreateReshapePrimitive(layer);
+        case ReshapeLayer: CreateReshapePrimitive(layer);
             break;
         case Permute: CreatePermutePrimitive(layer);
             break;
@@ -946,6 +1455,8 @@ void CLDNNGraph::CreateSingleLayerPrimitive(InferenceEngine::CNNLayerPtr &layer)
             break;
         case MVN: CreateMVNPrimitive(layer);
             break;
+        case RNN: CreateRNNPrimitive(layer);
+            break;
         case RegionYolo: CreateYOLO2RegionPrimitive(layer);
             break;
         case ReorgYolo: CreateYOLO2ReorgPrimitive(layer);
@@ -1469,6 +1980,36 @@ void CLDNNGraph::CreateCustomLayerPrimitive(InferenceEngine::CNNLayerPtr & layer
     auto genericLayer = dynamic_cast<InferenceEngine::GenericLayer*> (layer.get());
     auto inputPrimitives = GetPrevLayersPrimitives(layer);
 
+    // the sibling of the same inputs, parameters and blobs has the same output, the outputs of the network are
+    // computed by their own primitives
+    std::string siblingSignature;
+    if (customLayer->MergeSiblings()) {
+        std::stringstream signature;
+        signature << layer->type << " " << layer->precision.name();
+        for (const auto& input : inputPrimitives) {
+            signature << " " << input;
+        }
+        for (const auto& param : genericLayer->params) {
+            signature << " " << param.first << "=" << param.second;
+        }
+        for (const auto& blob : genericLayer->blobs) {
+            const auto* data = blob.second->cbuffer().as<const char *>();
+            signature << " " << blob.first << ":" << std::hash<std::string>{}(std::string(data, blob.second->byteSize()));
+        }
+        for (auto dim : genericLayer->outData[0]->dims) {
+            signature << " " << dim;
+        }
+        siblingSignature = signature.str();
+
+        auto sibling = m_mergeableCustomLayers.find(siblingSignature);
+        if (sibling != m_mergeableCustomLayers.end() &&
+            p_currentOutputs->find(genericLayer->name) == p_currentOutputs->end()) {
+            m_env.primitiveIDs[genericLayer->name] = m_env.primitiveIDs.at(sibling->second);
+            InitProfileInfo(layer->name, layer->type, "None", InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT);
+            return;
+        }
+    }
+
     // Handle defines
     std::string layerDefines;
     for (const auto& def : customLayer->Defines()) {
@@ -1553,7 +2094,8 @@ void CLDNNGraph::CreateCustomLayerPrimitive(InferenceEngine::CNNLayerPtr & layer
             THROW_CLDNN_EXCEPTION("Invalid custom layer param type: " << param.type << " in layer: " << genericLayer->name);
         }
     }
-    const std::string layerTitle("\n// Layer " + layer->name + " using Custom Layer " + customLayer->Name() + "\n");
+    // the layer name is not a part of the source, so the kernels of the identical layers are compiled once
+    const std::string layerTitle("\n// Custom Layer " + customLayer->Name() + "\n");
     const std::string defineTitle("// Custom Layer User Defines\n");
 
     auto dims = genericLayer->outData[0]->dims;
@@ -1646,6 +2188,9 @@ void CLDNNGraph::CreateCustomLayerPrimitive(InferenceEngine::CNNLayerPtr & layer
     }
     m_topology->add(customPrim);
     m_env.profilingIDs.insert(genericLayer->name);
+    if (!siblingSignature.empty()) {
+        m_mergeableCustomLayers.emplace(siblingSignature, genericLayer->name);
+    }
 }
 
 void CLDNNGraph::CreateSimplerNMSPrimitive(InferenceEngine::CNNLayerPtr &layer) {
@@ -2408,6 +2953,135 @@ void CLDNNGraph::CreateMVNPrimitive(InferenceEngine::CNNLayerPtr &layer) {
     m_env.profilingIDs.insert(MvnLayer->name);
 }
 
+bool CLDNNGraph::IsRNNLayerSupported(const InferenceEngine::CNNLayerPtr &layer) {
+    // clDNN lstm has no GRU cell, the time major sequence and the final cell state
+    const std::string direction = layer->GetParamAsString("direction", "Forward");
+    return CaselessEq<std::string>()(layer->GetParamAsString("cell_type", "LSTM"), "LSTM") &&
+           layer->GetParamAsInt("axis", 1) == 1 &&
+           (direction == "Forward" || direction == "Backward") &&
+           layer->outData.size() <= 2;
+}
+
+void CLDNNGraph::CreateRNNPrimitive(InferenceEngine::CNNLayerPtr &layer) {
+    ValidateLayer(layer, 0);
+    if (layer->insData.empty() || layer->insData.size() > 3) {
+        THROW_CLDNN_EXCEPTION("Invalid number of inputs for layer: " << layer->name);
+    }
+    if (!IsRNNLayerSupported(layer)) {
+        THROW_CLDNN_EXCEPTION("Unsupported RNN layer " << layer->name
+                              << ": only the LSTM cell with the time axis 1 and without the final cell state is supported");
+    }
+    auto inputPrimitives = GetPrevLayersPrimitives(layer);
+    auto rnnLayer = dynamic_cast<InferenceEngine::GenericLayer*> (layer.get());
+
+    auto inDataPtr = rnnLayer->insData[0].lock();
+    if (!inDataPtr || inDataPtr->dims.size() != 3) {
+        THROW_CLDNN_EXCEPTION("RNN layer " << rnnLayer->name << " supports only 3D input");
+    }
+    // X is [N, T, D], the dims are stored from the innermost one
+    const int batch = TensorValue(inDataPtr->dims[2]);
+    const int steps = TensorValue(inDataPtr->dims[1]);
+    const int inputSize = TensorValue(inDataPtr->dims[0]);
+    const int hiddenSize = rnnLayer->GetParamAsInt("hidden_size");
+    const bool reverse = rnnLayer->GetParamAsString("direction", "Forward") == "Backward";
+    if (hiddenSize <= 0) {
+        THROW_CLDNN_EXCEPTION("RNN layer " << rnnLayer->name << " has incorrect hidden size");
+    }
+
+    ValidateGenericLayerBlobs(rnnLayer, { "weights" });
+    auto weightsBlob = rnnLayer->blobs.at("weights");
+    if (weightsBlob->size() != 4lu * hiddenSize * (inputSize + hiddenSize)) {
+        THROW_CLDNN_EXCEPTION("RNN layer " << rnnLayer->name << " has incorrect weights");
+    }
+    InferenceEngine::Blob::Ptr biasesBlob;
+    if (rnnLayer->blobs.find("biases") != rnnLayer->blobs.end()) {
+        biasesBlob = rnnLayer->blobs.at("biases");
+        if (biasesBlob->size() != 4lu * hiddenSize) {
+            THROW_CLDNN_EXCEPTION("RNN layer " << rnnLayer->name << " has incorrect biases");
+        }
+    }
+
+    // the rows of the gates i, f, c, o of the IR are reordered to i, f, o, c of clDNN (ifoz), and the weights
+    // [4 * S][D + S] are split to the input and the recurrent ones
+    static const size_t gateOrder[4] = { 0, 1, 3, 2 };
+    auto addGatesData = [&](const cldnn::primitive_id& id, const InferenceEngine::Blob::Ptr& blob, cldnn::tensor size,
+                            size_t rowOffset, size_t rowLength, size_t rowStride) {
+        cldnn::layout dataLayout(DataTypeFromPrecision(blob->precision()), cldnn::format::bfyx, size);
+        auto mem = cldnn::memory::allocate(*(m_env.engine), dataLayout);
+        auto tmpPointer = mem.pointer<char>();  // implicitly maps buffer - unmap in destructor
+        auto src = static_cast<const char *>(blob->buffer());
+        const size_t rowBytes = rowLength * blob->element_size();
+        for (size_t g = 0; g < 4; g++) {
+            for (size_t s = 0; s < static_cast<size_t>(hiddenSize); s++) {
+                const size_t srcRow = gateOrder[g] * hiddenSize + s;
+                std::memcpy(tmpPointer.data() + (g * hiddenSize + s) * rowBytes,
+                            src + (srcRow * rowStride + rowOffset) * blob->element_size(), rowBytes);
+            }
+        }
+        m_topology->add(cldnn::data(id, mem));
+    };
+
+    cldnn::primitive_id weightsID = rnnLayer->name + m_weightsTag;
+    cldnn::primitive_id recurrentID = rnnLayer->name + "_recurrent" + m_weightsTag;
+    addGatesData(weightsID, weightsBlob, cldnn::tensor(1, 1, inputSize, 4 * hiddenSize),
+                 0, inputSize, inputSize + hiddenSize);
+    addGatesData(recurrentID, weightsBlob, cldnn::tensor(1, 1, hiddenSize, 4 * hiddenSize),
+                 inputSize, hiddenSize, inputSize + hiddenSize);
+    cldnn::primitive_id biasesID;
+    if (biasesBlob) {
+        biasesID = rnnLayer->name + m_biasesTag;
+        addGatesData(biasesID, biasesBlob, cldnn::tensor(1, 1, 4 * hiddenSize, 1), 0, 1, 1);
+    }
+
+    // the layouts of clDNN lstm: X {b: N, f: T, x: D}, the states {b: N, x: S}
+    cldnn::primitive_id inputID = rnnLayer->name + "_input" + m_workaroundTag;
+    m_topology->add(cldnn::reshape(inputID, inputPrimitives[0], cldnn::tensor(batch, steps, inputSize, 1)));
+    cldnn::primitive_id stateIDs[2];
+    for (size_t i = 1; i < inputPrimitives.size(); i++) {
+        stateIDs[i - 1] = rnnLayer->name + (i == 1 ? "_hidden" : "_cell") + m_workaroundTag;
+        m_topology->add(cldnn::reshape(stateIDs[i - 1], inputPrimitives[i], cldnn::tensor(batch, 1, hiddenSize, 1)));
+    }
+
+    // the whole sequence is a single lstm, which clDNN unrolls to the cells of the steps on the device
+    std::vector<cldnn::primitive_id> stepIDs;
+    for (int i = 0; i < steps; i++) {
+        const int t = reverse ? steps - 1 - i : i;
+        stepIDs.push_back(rnnLayer->name + "_step" + std::to_string(t) + m_workaroundTag);
+        m_topology->add(cldnn::crop(stepIDs.back(), inputID, cldnn::tensor(batch, 1, inputSize, 1), cldnn::tensor(0, t, 0, 0)));
+    }
+    cldnn::primitive_id lstmID = rnnLayer->name + "_lstm";
+    m_topology->add(cldnn::lstm(lstmID, stepIDs, weightsID, recurrentID, biasesID, stateIDs[0], stateIDs[1],
+                                "", 0, false, {}, {}, cldnn_lstm_offset_order_ifoz));
+
+    auto outputID = [&](size_t port) {
+        return rnnLayer->outData.size() > 1 ? rnnLayer->outData[port]->name : rnnLayer->name;
+    };
+
+    // the hidden states are concatenated in the order the steps are computed, so the backward sequence is reversed
+    cldnn::primitive_id sequenceID = lstmID;
+    if (reverse) {
+        std::vector<cldnn::primitive_id> reversedIDs;
+        for (int i = steps - 1; i >= 0; i--) {
+            reversedIDs.push_back(rnnLayer->name + "_output" + std::to_string(i) + m_workaroundTag);
+            m_topology->add(cldnn::crop(reversedIDs.back(), lstmID, cldnn::tensor(batch, 1, hiddenSize, 1),
+                                        cldnn::tensor(0, i, 0, 0)));
+        }
+        sequenceID = rnnLayer->name + "_reversed" + m_workaroundTag;
+        m_topology->add(cldnn::concatenation(sequenceID, reversedIDs, cldnn::concatenation::along_f));
+    }
+    m_topology->add(cldnn::reshape(outputID(0), sequenceID, CldnnTensorFromIEDims(rnnLayer->outData[0]->dims)));
+    m_env.primitiveIDs[outputID(0)] = outputID(0);
+    m_env.profilingIDs.insert(outputID(0));
+
+    if (rnnLayer->outData.size() > 1) {
+        // the final hidden state is the one of the last computed step
+        cldnn::primitive_id lastID = rnnLayer->name + "_last" + m_workaroundTag;
+        m_topology->add(cldnn::crop(lastID, lstmID, cldnn::tensor(batch, 1, hiddenSize, 1), cldnn::tensor(0, steps - 1, 0, 0)));
+        m_topology->add(cldnn::reshape(outputID(1), lastID, CldnnTensorFromIEDims(rnnLayer->outData[1]->dims)));
+        m_env.primitiveIDs[outputID(1)] = outputID(1);
+        m_env.profilingIDs.insert(outputID(1));
+    }
+}
 
 void CLDNNGraph::AddConstantBlobInput(InferenceEngine::CNNLayerPtr &layer) {
     auto constBlob = layer->blobs.begin()->second;
@@ -2456,6 +3130,10 @@ void CLDNNGraph::AddConstantBlobInput(InferenceEngine::CNNLayerPtr &layer) {
 
 void CLDNNGraph::CreateConvolutionPrimitive(InferenceEngine::CNNLayerPtr &layer) {
     ValidateLayer(layer, 1);
+    if (IsInt8Convolution(layer)) {
+        CreateInt8ConvolutionPrimitive(layer);
+        return;
+    }
     auto inputPrimitives = GetPrevLayersPrimitives(layer);
     auto convLayer = dynamic_cast<InferenceEngine::ConvolutionLayer *> (layer.get());
 
@@ -2486,6 +3164,181 @@ void CLDNNGraph::CreateConvolutionPrimitive(InferenceEngine::CNNLayerPtr &layer)
     m_env.profilingIDs.insert(convLayer->name);
 }
 
+bool CLDNNGraph::IsInt8Convolution(const InferenceEngine::CNNLayerPtr &layer) {
+    if (layer->precision != InferenceEngine::Precision::I8 || LayerTypeFromStr(layer->type) != Convolution) {
+        return false;
+    }
+    auto wScale = layer->blobs.find("w-scale");
+    return wScale != layer->blobs.end() && wScale->second && wScale->second->size() != 0;
+}
+
+void CLDNNGraph::CreateInt8ConvolutionPrimitive(InferenceEngine::CNNLayerPtr &layer) {
+    auto inputPrimitives = GetPrevLayersPrimitives(layer);
+    auto convLayer = dynamic_cast<InferenceEngine::ConvolutionLayer *> (layer.get());
+
+    if (m_networkPrecision != cldnn::data_types::f32) {
+        THROW_CLDNN_EXCEPTION("INT8 convolution " << layer->name << " is supported in FP32 networks only");
+    }
+    std::shared_ptr<Data> insData0 = layer->insData[0].lock();
+    IE_ASSERT(insData0 != nullptr);
+    cldnn::tensor::value_type inFeatures = TensorValue(insData0->dims[2]);
+    cldnn::tensor::value_type outFeatures = TensorValue(convLayer->_out_depth);
+    unsigned groupSize = convLayer->_group;
+    if ((inFeatures % groupSize) || (outFeatures % groupSize)) {
+        THROW_CLDNN_EXCEPTION("Invalid group size in layer " << convLayer->name);
+    }
+    auto wScaleBlob = layer->blobs["w-scale"];
+    if (wScaleBlob->size() != static_cast<size_t>(outFeatures) ||
+        convLayer->_weights == nullptr || convLayer->_weights->precision() != InferenceEngine::Precision::I8 ||
+        (convLayer->_biases != nullptr && convLayer->_biases->precision() != InferenceEngine::Precision::I32)) {
+        THROW_CLDNN_EXCEPTION("Invalid quantization data in INT8 convolution " << layer->name);
+    }
+    const float* wScale = wScaleBlob->cbuffer().as<const float*>();
+
+    // the INT8 output is fused with the ReLU of the normalizer and dequantized after it,
+    // the convolution which has no o-scale runs in FP32 with the dequantized weights
+    InferenceEngine::CNNLayerPtr activation;
+    if (convLayer->outData.size() == 1 && convLayer->outData[0]->getInputTo().size() == 1) {
+        activation = GetNextSingleLayer(convLayer->outData[0]);
+        if (LayerTypeFromStr(activation->type) != ReLU || activation->outData.size() != 1 ||
+            p_currentOutputs->find(convLayer->outData[0]->name) != p_currentOutputs->end() ||
+            p_currentOutputs->find(activation->outData[0]->name) != p_currentOutputs->end()) {
+            activation = nullptr;
+        }
+    }
+    auto oScaleIt = layer->blobs.find("o-scale");
+    bool int8Output = activation != nullptr && oScaleIt != layer->blobs.end() && oScaleIt->second &&
+                      convLayer->outData[0]->getPrecision() == InferenceEngine::Precision::I8;
+    if (int8Output && oScaleIt->second->size() != static_cast<size_t>(outFeatures)) {
+        THROW_CLDNN_EXCEPTION("Invalid o-scale in INT8 convolution " << layer->name);
+    }
+
+    cldnn::tensor::value_type groupOutFeatures = outFeatures / groupSize;
+    cldnn::tensor weightsTensor(std::vector<cldnn::tensor::value_type>{
+        groupOutFeatures,
+        inFeatures / groupSize,
+        TensorValue(convLayer->_kernel_x),
+        TensorValue(convLayer->_kernel_y) });
+    size_t groupWeights = weightsTensor.count();
+    size_t outFeatureWeights = groupWeights / static_cast<size_t>(groupOutFeatures);
+    const int8_t* weights = convLayer->_weights->cbuffer().as<const int8_t*>();
+    const int32_t* biases = convLayer->_biases ? convLayer->_biases->cbuffer().as<const int32_t*>() : nullptr;
+    if (convLayer->_weights->size() != groupWeights * groupSize) {
+        THROW_CLDNN_EXCEPTION("Invalid weights size in INT8 convolution " << layer->name);
+    }
+
+    std::vector<cldnn::primitive_id> weightPrimID;
+    std::vector<cldnn::primitive_id> biasPrimID;
+    std::vector<cldnn::primitive_id> quantizationPrimID;
+    std::vector<cldnn::primitive_id> calibrationPrimID;
+    for (unsigned g = 0; g < groupSize; g++) {
+        size_t firstOutFeature = g * static_cast<size_t>(groupOutFeatures);
+        std::vector<float> groupScales(wScale + firstOutFeature, wScale + firstOutFeature + groupOutFeatures);
+
+        cldnn::primitive_id weightID = layer->name + m_weightsTag + std::to_string(g);
+        if (int8Output) {
+            CreatePrimitiveFromBlob(
+                weightID,
+                convLayer->_weights,
+                cldnn::layout(cldnn::data_types::i8, m_defaultFormat, weightsTensor),
+                g * groupWeights);
+
+            cldnn::primitive_id quantizationID = layer->name + m_quantizeTag + m_weightsTag + std::to_string(g);
+            CreateFloatDataPrimitive(quantizationID, groupScales, cldnn::spatial(groupOutFeatures));
+            quantizationPrimID.push_back(quantizationID);
+
+            // the output is quantized by the reciprocal of o-scale and brought back by the ScaleShift after the ReLU
+            const float* oScale = oScaleIt->second->cbuffer().as<const float*>();
+            std::vector<float> calibration(groupOutFeatures);
+            for (size_t o = 0; o < calibration.size(); o++) {
+                calibration[o] = 1.0f / oScale[firstOutFeature + o];
+            }
+            cldnn::primitive_id calibrationID = layer->name + m_quantizeTag + m_scalesTag + std::to_string(g);
+            CreateFloatDataPrimitive(calibrationID, calibration, cldnn::spatial(groupOutFeatures));
+            calibrationPrimID.push_back(calibrationID);
+        } else {
+            std::vector<float> dequantizedWeights(groupWeights);
+            for (size_t i = 0; i < groupWeights; i++) {
+                dequantizedWeights[i] = weights[g * groupWeights + i] * groupScales[i / outFeatureWeights];
+            }
+            CreateFloatDataPrimitive(weightID, dequantizedWeights, weightsTensor);
+        }
+        weightPrimID.push_back(weightID);
+
+        // the biases are added to the dequantized accumulator
+        if (biases != nullptr) {
+            std::vector<float> dequantizedBiases(groupOutFeatures);
+            for (size_t o = 0; o < dequantizedBiases.size(); o++) {
+                dequantizedBiases[o] = biases[firstOutFeature + o] * groupScales[o];
+            }
+            cldnn::primitive_id biasID = layer->name + m_biasesTag + std::to_string(g);
+            CreateFloatDataPrimitive(biasID, dequantizedBiases, cldnn::spatial(groupOutFeatures));
+            biasPrimID.push_back(biasID);
+        }
+    }
+
+    cldnn::tensor stride = cldnn::tensor(cldnn::batch(1), cldnn::feature(1),
+                                         cldnn::spatial(convLayer->_stride_x, convLayer->_stride_y));
+    cldnn::tensor padding = cldnn::tensor(cldnn::batch(0), cldnn::feature(0),
+                                          cldnn::spatial(-convLayer->_padding_x, -convLayer->_padding_y));
+    cldnn::tensor dilation = cldnn::tensor(cldnn::batch(1), cldnn::feature(1),
+                                           cldnn::spatial(convLayer->_dilation_x, convLayer->_dilation_y));
+
+    m_env.primitiveIDs[convLayer->name] = convLayer->name;
+    m_env.profilingIDs.insert(convLayer->name);
+    if (!int8Output) {
+        m_topology->add(cldnn::convolution(convLayer->name,
+                                           inputPrimitives[0],
+                                           weightPrimID,
+                                           biasPrimID,
+                                           stride,
+                                           padding,
+                                           dilation,
+                                           false,
+                                           0.0f,
+                                           CldnnTensorFromIEDims(convLayer->outData[0]->dims)));
+        return;
+    }
+
+    // the ScaleShift of the normalizer brings the input to the unsigned range [0, 255],
+    // it is halved to fit the signed INT8 input of the MMAD kernels and the halving is undone by the input factor
+    const float inputRange = 127.0f / 255.0f;
+    cldnn::primitive_id inputScaleID = layer->name + m_quantizeTag + "_input" + m_scalesTag;
+    CreateFloatDataPrimitive(inputScaleID, { inputRange }, cldnn::feature(1));
+    cldnn::primitive_id inputRangeID = layer->name + m_quantizeTag + "_input";
+    m_topology->add(cldnn::scale(inputRangeID, inputPrimitives[0], inputScaleID));
+    m_env.profilingIDs.insert(inputRangeID);
+    InitProfileInfo(inputRangeID, "ScaleShift", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
+
+    cldnn::primitive_id quantizeID = layer->name + m_quantizeTag;
+    m_topology->add(cldnn::reorder(quantizeID, inputRangeID, m_defaultFormat, cldnn::data_types::i8));
+    m_env.profilingIDs.insert(quantizeID);
+    InitProfileInfo(quantizeID, "Reorder", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
+
+    m_topology->add(cldnn::convolution(convLayer->name,
+                                       quantizeID,
+                                       weightPrimID,
+                                       biasPrimID,
+                                       quantizationPrimID,
+                                       calibrationPrimID,
+                                       1.0f / inputRange,
+                                       stride,
+                                       padding,
+                                       dilation,
+                                       true,
+                                       activation->GetParamAsFloat("negative_slope", 0.0f)));
+
+    cldnn::primitive_id dequantizeID = activation->name + m_dequantizeTag;
+    m_topology->add(cldnn::reorder(dequantizeID, convLayer->name, m_defaultFormat, m_networkPrecision));
+    m_env.profilingIDs.insert(dequantizeID);
+    InitProfileInfo(dequantizeID, "Reorder", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
+
+    // the ReLU is fused with the convolution, the layers after it read the dequantized output
+    InitProfileInfo(activation->name, activation->type, "None", InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT);
+    m_env.primitiveIDs[activation->name] = dequantizeID;
+    layer = activation;
+}
+
 bool CLDNNGraph::IsValidSplitConvMerge(const InferenceEngine::SplitLayer *splitLayer) const {
     if (splitLayer->outData.size() != 2) return false;  // split into 2
     auto convLayer1 =
@@ -2562,7 +3415,6 @@ void CLDNNGraph::AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo) {
         FormatFromLayout(l),
         dataTensor);
     auto inputName = inputInfo->name();
-    m_topology->add(cldnn::input_layout(inputName, inputLayout));
 
     // save the input dims
     m_env.inputLayouts.insert({ inputName, inputLayout });
@@ -2582,6 +3434,14 @@ void CLDNNGraph::AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo) {
         THROW_CLDNN_EXCEPTION("Mismatched mean values channels in input " + inputName);
     }
 
+    if (IsFrameInput(inputInfo)) {
+        AddFramePreprocessPrimitive(inputInfo, internalInputLayout);
+        m_env.primitiveIDs[inputName] = preprocessPrimID;
+        m_env.primitiveIDs[preprocessPrimID] = preprocessPrimID;
+        return;
+    }
+    m_topology->add(cldnn::input_layout(inputName, inputLayout));
+
     switch (preProcess.getMeanVariant()) {
     case NONE:
     case MEAN_VALUE: {
@@ -2651,6 +3511,165 @@ void CLDNNGraph::AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo) {
     m_env.primitiveIDs[preprocessPrimID] = preprocessPrimID;
 }
 
+bool CLDNNGraph::IsFrameInput(const InferenceEngine::InputInfo::Ptr& inputInfo) const {
+    return m_config.frameWidth > 0 &&
+           inputInfo->getPreProcess().getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE &&
+           inputInfo->getDims().size() == 4;
+}
+
+// crops the ROI of the frame, resizes it to the input of the network, subtracts the mean and scales the channels,
+// the parameters of the ROI are the int values: the width, the height and the strides of the batch, the channels,
+// the rows and the columns of the frame (so any of NCHW and NHWC is read)
+static const char *const s_framePreprocessKernel = R"__krnl(
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+
+__kernel void frame_preprocess(const __global FRAME_TYPE* frame, const __global float* params,
+                               const __global float* constants, __global OUTPUT0_TYPE* output) {
+    const int x = get_global_id(0);
+    const int y = get_global_id(1);
+    const int c = get_global_id(2) % CHANNELS;
+    const int b = get_global_id(2) / CHANNELS;
+
+    const int IW = as_int(params[0]);
+    const int IH = as_int(params[1]);
+    const int strideY = as_int(params[4]);
+    const int strideX = as_int(params[5]);
+    const __global FRAME_TYPE* plane = frame + b * as_int(params[2]) + c * as_int(params[3]);
+    const float scaleX = (float)IW / OUTPUT_WIDTH;
+    const float scaleY = (float)IH / OUTPUT_HEIGHT;
+
+#ifdef RESIZE_AREA
+    // the pixels of the frame covered by the output pixel are summed with the covered parts as the weights
+    const float x0 = x * scaleX, x1 = fmin(x0 + scaleX, (float)IW);
+    const float y0 = y * scaleY, y1 = fmin(y0 + scaleY, (float)IH);
+    float value = 0.f;
+    for (int iy = (int)y0; iy < y1; iy++) {
+        const float wy = fmin(iy + 1.f, y1) - fmax((float)iy, y0);
+        float row = 0.f;
+        for (int ix = (int)x0; ix < x1; ix++) {
+            row += (fmin(ix + 1.f, x1) - fmax((float)ix, x0)) * plane[iy * strideY + ix * strideX];
+        }
+        value += wy * row;
+    }
+    value /= (x1 - x0) * (y1 - y0);
+#else
+    const float fx = fmax((x + 0.5f) * scaleX - 0.5f, 0.f);
+    const float fy = fmax((y + 0.5f) * scaleY - 0.5f, 0.f);
+    const int ix0 = min((int)fx, IW - 1), ix1 = min(ix0 + 1, IW - 1);
+    const int iy0 = min((int)fy, IH - 1), iy1 = min(iy0 + 1, IH - 1);
+    const float dx = fx - ix0, dy = fy - iy0;
+    const float top = mix((float)plane[iy0 * strideY + ix0 * strideX], (float)plane[iy0 * strideY + ix1 * strideX], dx);
+    const float bottom = mix((float)plane[iy1 * strideY + ix0 * strideX], (float)plane[iy1 * strideY + ix1 * strideX], dx);
+    float value = mix(top, bottom, dy);
+#endif
+
+    // the scales of the channels are followed by the mean values or the mean image
+#ifdef MEAN_IMAGE
+    value -= constants[CHANNELS + (c * OUTPUT_HEIGHT + y) * OUTPUT_WIDTH + x];
+#else
+    value -= constants[CHANNELS + c];
+#endif
+    value *= constants[c];
+
+    output[OUTPUT0_OFFSET + b * OUTPUT0_PITCHES[0] + c * OUTPUT0_PITCHES[1] + y * OUTPUT0_PITCHES[2] +
+           x * OUTPUT0_PITCHES[3]] = (OUTPUT0_TYPE)value;
+}
+)__krnl";
+
+void CLDNNGraph::AddFramePreprocessPrimitive(const InferenceEngine::InputInfo::Ptr& inputInfo,
+                                             const cldnn::layout& inputLayout) {
+    auto inputName = inputInfo->name();
+    auto preProcess = inputInfo->getPreProcess();
+    const int B = inputLayout.size.batch[0];
+    const int C = inputLayout.size.feature[0];
+    const int OW = inputLayout.size.spatial[0];
+    const int OH = inputLayout.size.spatial[1];
+
+    // the kernels of clDNN have no type of the u8 layouts, so the bytes of the frame are read by FRAME_TYPE
+    cldnn::data_types frameType;
+    std::string frameTypeName;
+    switch (inputInfo->getInputPrecision()) {
+    case Precision::U8: frameType = cldnn::data_types::i8;
+        frameTypeName = "uchar";
+        break;
+    case Precision::FP32: frameType = cldnn::data_types::f32;
+        frameTypeName = "float";
+        break;
+    default: THROW_CLDNN_EXCEPTION("Unsupported precision " << inputInfo->getInputPrecision()
+                                   << " of the device pre-processing in input " << inputName);
+    }
+
+    // the frame is the flat buffer of the largest frame of the batch, the layout of the blob is given by the strides
+    const int frameSize = TensorValue(B * C * m_config.frameWidth * m_config.frameHeight);
+    cldnn::layout frameLayout(frameType, cldnn::format::bfyx, cldnn::tensor(1, 1, frameSize, 1));
+    cldnn::layout paramsLayout(cldnn::data_types::f32, cldnn::format::bfyx, cldnn::tensor(1, 1, 8, 1));
+    const auto paramsID = inputName + m_frameParamsTag;
+    m_topology->add(cldnn::input_layout(inputName, frameLayout));
+    m_topology->add(cldnn::input_layout(paramsID, paramsLayout));
+    m_env.frameInputs.insert({ inputName, { frameLayout, paramsID } });
+
+    const size_t meanChannels = preProcess.getNumberOfChannels();
+    std::vector<float> constants(C, 1.0f);
+    for (size_t c = 0; c < meanChannels; c++) {
+        constants[c] = preProcess[c]->stdScale;
+    }
+    switch (preProcess.getMeanVariant()) {
+    case NONE:
+    case MEAN_VALUE:
+        for (int c = 0; c < C; c++) {
+            constants.push_back(static_cast<size_t>(c) < meanChannels ? preProcess[c]->meanValue : 0.0f);
+        }
+        break;
+    case MEAN_IMAGE:
+        IE_ASSERT(meanChannels);
+        for (size_t c = 0; c < meanChannels; c++) {
+            auto channelMeanBlob = std::dynamic_pointer_cast<TBlob<float>>(preProcess[c]->meanData);
+            if (!channelMeanBlob || channelMeanBlob->size() != static_cast<size_t>(OW * OH)) {
+                THROW_CLDNN_EXCEPTION("Mismatched mean image in input " + inputName);
+            }
+            const float* channelBlobData = channelMeanBlob->data();
+            constants.insert(constants.end(), channelBlobData, channelBlobData + channelMeanBlob->size());
+        }
+        break;
+    default: THROW_CLDNN_EXCEPTION("Invalid mean variant in input " + inputName);
+    }
+    const auto constantsID = inputName + m_frameConstantsTag;
+    CreateFloatDataPrimitive(constantsID, constants, cldnn::tensor(1, 1, TensorValue(constants.size()), 1));
+
+    std::ostringstream defines;
+    defines << "#define FRAME_TYPE " << frameTypeName << "\n"
+            << "#define CHANNELS " << C << "\n"
+            << "#define OUTPUT_WIDTH " << OW << "\n"
+            << "#define OUTPUT_HEIGHT " << OH << "\n";
+    if (preProcess.getResizeAlgorithm() == ResizeAlgorithm::RESIZE_AREA) {
+        defines << "#define RESIZE_AREA\n";
+    }
+    if (preProcess.getMeanVariant() == MEAN_IMAGE) {
+        defines << "#define MEAN_IMAGE\n";
+    }
+
+    std::vector<cldnn_arg> kernelParameters(4);
+    for (size_t i = 0; i < 3; i++) {
+        kernelParameters[i].arg_type = cldnn_arg_type::arg_input;
+        kernelParameters[i].index = static_cast<cldnn_arg_index>(i);
+    }
+    kernelParameters[3].arg_type = cldnn_arg_type::arg_output;
+    kernelParameters[3].index = 0;
+
+    const auto preprocessPrimID = inputName + m_preProcessTag;
+    m_topology->add(cldnn::custom_gpu_primitive(
+        preprocessPrimID,
+        { inputName, paramsID, constantsID },
+        { defines.str(), s_framePreprocessKernel },
+        "frame_preprocess",
+        kernelParameters,
+        "",
+        inputLayout,
+        { static_cast<size_t>(OW), static_cast<size_t>(OH), static_cast<size_t>(B * C) }));
+    m_env.profilingIDs.insert(preprocessPrimID);
+    InitProfileInfo(preprocessPrimID, "Resize", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
+}
+
 std::vector<cldnn::primitive_id> CLDNNGraph::GetPrevLayersPrimitives(const InferenceEngine::CNNLayerPtr layer) const {
     if (layer == nullptr) {
         return {};
@@ -2682,7 +3701,23 @@ void CLDNNGraph::AddOutputPrimitive(std::string outputName, const InferenceEngin
     }
     auto outputReorderID = outputName + m_postProcessTag;
     Precision precision = outputPrecision == Precision::UNSPECIFIED ? outputData->getPrecision() : outputPrecision;
+    if (m_config.pipelinedOutputs && precision == Precision::FP32 && m_networkPrecision == cldnn::data_types::f16) {
+        // the request converts the output to FP32 on the host, so half of the data is read from the device
+        precision = Precision::FP16;
+    }
+
+    const std::string outputID = GetOutputPrimitiveID(outputName);
+    m_topology->add(cldnn::reorder(outputReorderID, outputID,
+        FormatFromLayout(outputData->getLayout()),
+        DataTypeFromPrecision(precision)));
+    m_env.primitiveIDs[outputName] = outputReorderID;
+    m_env.profilingIDs.insert(outputReorderID);
+    InitProfileInfo(outputReorderID, "Reorder", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
+    m_env.outputDims[outputName] = outputData->dims;
+    m_env.prevPrimitiveIDs[outputReorderID] = {outputName};
+}
 
+cldnn::primitive_id CLDNNGraph::GetOutputPrimitiveID(const std::string& outputName) const {
     // Find correct output ID. Start with name stored in IR.
     std::string outputID = outputName;
     std::string finalID = m_env.primitiveIDs.at(outputName);
@@ -2696,15 +3731,53 @@ void CLDNNGraph::AddOutputPrimitive(std::string outputName, const InferenceEngin
         outputID = finalID;
         finalID = prim->second;
     }
+    return outputID;
+}
 
-    m_topology->add(cldnn::reorder(outputReorderID, outputID,
-        FormatFromLayout(outputData->getLayout()),
-        DataTypeFromPrecision(precision)));
-    m_env.primitiveIDs[outputName] = outputReorderID;
-    m_env.profilingIDs.insert(outputReorderID);
-    InitProfileInfo(outputReorderID, "Reorder", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
-    m_env.outputDims[outputName] = outputData->dims;
-    m_env.prevPrimitiveIDs[outputReorderID] = {outputName};
+void CLDNNGraph::AddTopKOutputPrimitives(const std::string& outputName, const InferenceEngine::DataPtr outputData) {
+    // the device finds the largest features of the output (of each pixel), so the request reads their indices
+    // and scores instead of the whole output
+    const uint32_t k = m_config.outputTopK.at(outputName);
+    const std::string scoresName = outputName + topKScoresSuffix;
+    auto indicesData = CreateTopKOutputData(outputData, outputName, k, Precision::FP32);
+    auto scoresData = CreateTopKOutputData(outputData, scoresName, k, outputData->getPrecision());
+
+    const cldnn::primitive_id inputID = outputName + m_topKTag;
+    const cldnn::primitive_id indicesID = outputName + m_topKTag + "_indices";
+    const cldnn::primitive_id scoresID = outputName + m_topKTag + "_scores";
+    m_topology->add(cldnn::reorder(inputID, GetOutputPrimitiveID(outputName), cldnn::format::bfyx, m_networkPrecision));
+    m_topology->add(cldnn::arg_max_min(indicesID, inputID, cldnn::arg_max_min::out_type::max, k,
+                                       cldnn::arg_max_min::axis_name::feature));
+    m_topology->add(cldnn::lookup_table(scoresID, inputID, indicesID, cldnn::lookup_table::axis_name::feature));
+    for (auto& id : { inputID, indicesID, scoresID }) {
+        m_env.primitiveIDs[id] = id;
+        m_env.profilingIDs.insert(id);
+    }
+    InitProfileInfo(inputID, "Reorder", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
+    InitProfileInfo(indicesID, "ArgMax", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
+    InitProfileInfo(scoresID, "LookupTable", "GPU", InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
+    m_env.prevPrimitiveIDs[inputID] = { outputName };
+    m_env.prevPrimitiveIDs[indicesID] = { inputID };
+    m_env.prevPrimitiveIDs[scoresID] = { inputID, indicesID };
+
+    m_env.primitiveIDs[outputName] = indicesID;
+    AddOutputPrimitive(outputName, indicesData);
+    m_env.primitiveIDs[scoresName] = scoresID;
+    AddOutputPrimitive(scoresName, scoresData);
+}
+
+void CLDNNGraph::setNetworkOutputs(const InferenceEngine::OutputsDataMap networkOutputs) {
+    _networkOutputs = networkOutputs;
+    for (auto& topK : m_config.outputTopK) {
+        auto output = networkOutputs.find(topK.first);
+        if (output == networkOutputs.end()) {
+            continue;
+        }
+        const std::string scoresName = topK.first + topKScoresSuffix;
+        _networkOutputs[topK.first] = CreateTopKOutputData(output->second, topK.first, topK.second, Precision::FP32);
+        _networkOutputs[scoresName] = CreateTopKOutputData(output->second, scoresName, topK.second,
+                                                           output->second->getPrecision());
+    }
 }
 
 void CLDNNGraph::AddSingleValuePrimitive(cldnn::primitive_id valPrimID, cldnn::data_types dataType, float value) {
@@ -2854,10 +3927,265 @@ cldnn::tensor CLDNNGraph::CldnnTensorFromIEDims(const InferenceEngine::SizeVecto
 
 InferRequestInternal::Ptr
 CLDNNGraph::CreateInferRequestImpl(InputsDataMap networkInputs, OutputsDataMap networkOutputs) {
+    WaitCompiled();
     if (m_env.network == nullptr) {
         THROW_IE_EXCEPTION << NETWORK_NOT_LOADED_str;
     }
-    return std::make_shared<CLDNNInferRequest>(m_env, m_config.useProfiling, networkInputs, networkOutputs);
+    return CreateStreamRequest(networkInputs, networkOutputs, m_streams[m_nextStream % m_streams.size()]);
+}
+
+InferRequestInternal::Ptr
+CLDNNGraph::CreateStreamRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs, const Stream& stream) {
+    return std::make_shared<CLDNNInferRequest>(stream.env, m_config.useProfiling, networkInputs, networkOutputs,
+                                               m_config.pipelinedOutputs);
+}
+
+namespace {
+
+std::string GetShapesKey(const ICNNNetwork &network) {
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+
+    std::string key;
+    for (auto &input : inputs) {
+        key += input.first + ":";
+        for (auto dim : input.second->getTensorDesc().getDims())
+            key += std::to_string(dim) + ",";
+        key += ";";
+    }
+    return key;
+}
+
+}  // namespace
+
+void CLDNNGraph::Reshape(const std::map<std::string, SizeVector> &inputShapes) {
+    WaitCompiled();
+    if (m_streams.size() != 1 || m_env.m_max_batch > 1 || m_env.m_micro_batches > 1) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
+                           << "The network inferred by several streams, with the dynamic batch or by the micro batches "
+                              "cannot be reshaped";
+    }
+
+    if (!m_reshapableNetwork) {
+        // the layers of the copy share the weights with the loaded network
+        m_reshapableNetwork = cloneNet(*m_network);
+        m_shapeVariants.push_front({ GetShapesKey(*m_reshapableNetwork), m_env });
+    }
+
+    ResponseDesc resp;
+    if (m_reshapableNetwork->reshape(inputShapes, &resp) != OK) {
+        THROW_IE_EXCEPTION << resp.msg;
+    }
+
+    const std::string key = GetShapesKey(*m_reshapableNetwork);
+    auto variant = std::find_if(m_shapeVariants.begin(), m_shapeVariants.end(),
+                                [&](const std::pair<std::string, InferenceEnv>& v) { return v.first == key; });
+    if (variant != m_shapeVariants.end()) {
+        m_shapeVariants.splice(m_shapeVariants.begin(), m_shapeVariants, variant);
+    } else {
+        // the network of the shapes is built in m_env on the engine of the graph, the requests created before
+        // infer the current network on the executor of the stream meanwhile
+        InferenceEnv current = m_env;
+        m_env = InferenceEnv();
+        m_env.engine = current.engine;
+        m_env.debugOptions = current.debugOptions;
+        m_env.m_max_batch = current.m_max_batch;
+        m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
+        try {
+            Load(*m_reshapableNetwork);
+            CompileNetwork();
+        } catch (...) {
+            m_env = current;
+            m_topology.reset();
+            throw;
+        }
+        m_topology.reset();
+
+        m_shapeVariants.push_front({ key, m_env });
+        // the requests of the released shapes keep their network until they are destroyed
+        while (m_shapeVariants.size() > m_config.shapeVariants) {
+            m_shapeVariants.pop_back();
+        }
+    }
+    m_env = m_shapeVariants.front().second;
+    m_streams[0].env = m_env;
+
+    // the blobs of the requests created from now on are allocated with the new shapes, the inputs and the outputs
+    // of the requests created before are not changed
+    InputsDataMap inputs;
+    m_reshapableNetwork->getInputsInfo(inputs);
+    for (auto &input : inputs) {
+        auto networkInput = _networkInputs.find(input.first);
+        if (networkInput == _networkInputs.end())
+            continue;
+        auto data = std::make_shared<Data>(*networkInput->second->getInputData());
+        data->setDims(input.second->getTensorDesc().getDims());
+        auto info = std::make_shared<InputInfo>(*networkInput->second);
+        info->setInputData(data);
+        networkInput->second = info;
+    }
+    OutputsDataMap outputs;
+    m_reshapableNetwork->getOutputsInfo(outputs);
+    for (auto &output : outputs) {
+        auto networkOutput = _networkOutputs.find(output.first);
+        if (networkOutput == _networkOutputs.end())
+            continue;
+        auto data = std::make_shared<Data>(*networkOutput->second);
+        data->setDims(output.second->getTensorDesc().getDims());
+        networkOutput->second = data;
+    }
+}
+
+void CLDNNGraph::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
+    WaitCompiled();
+    if (m_env.network == nullptr) {
+        THROW_IE_EXCEPTION << NETWORK_NOT_LOADED_str;
+    }
+    const size_t s = SelectStream();
+    const Stream& stream = m_streams[s];
+    auto syncRequestImpl = CreateStreamRequest(_networkInputs, _networkOutputs, stream);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    // the request is bound to the executor of its stream, so the requests of a stream are inferred one by one
+    auto asyncRequestImpl = std::make_shared<AsyncInferRequestThreadSafeDefault>(
+            syncRequestImpl, stream.taskExecutor, stream.taskSynchronizer, _callbackExecutor, _preprocessExecutor);
+    asyncRequest.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncRequestImpl),
+                       [](IInferRequest *p) { p->Release(); });
+    asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
+
+    if (m_config.balancer == Config::Balancer::LeastLoaded) {
+        std::lock_guard<std::mutex> lock(m_streamsMutex);
+        m_streams[s].requests.push_back(asyncRequest);
+    }
+}
+
+namespace {
+
+// the section of the plugin follows the binary IR in the exported file, the trailer at the end of the file
+// gives the offset of the section
+const char exportSignature[8] = {'C', 'L', 'D', 'N', 'N', 'E', 'X', 'P'};
+
+struct ExportTrailer {
+    uint64_t sectionOffset;
+    char signature[8];
+};
+
+void writeSize(std::ostream &stream, uint64_t size) {
+    stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+}
+
+void writeString(std::ostream &stream, const std::string &str) {
+    writeSize(stream, str.size());
+    stream.write(str.data(), str.size());
+}
+
+class SectionReader {
+public:
+    SectionReader(const char *data, size_t size) : _data(data), _size(size) {}
+
+    size_t size() {
+        uint64_t value;
+        read(&value, sizeof(value));
+        if (value > _size - _offset)
+            THROW_IE_EXCEPTION << "The exported network is truncated";
+        return static_cast<size_t>(value);
+    }
+
+    std::string str() {
+        size_t length = size();
+        std::string result(_data + _offset, length);
+        _offset += length;
+        return result;
+    }
+
+    bool empty() const {
+        return _offset == _size;
+    }
+
+    std::vector<char> bytes() {
+        size_t length = size();
+        std::vector<char> result(_data + _offset, _data + _offset + length);
+        _offset += length;
+        return result;
+    }
+
+private:
+    void read(void *dst, size_t size) {
+        if (size > _size - _offset)
+            THROW_IE_EXCEPTION << "The exported network is truncated";
+        memcpy(dst, _data + _offset, size);
+        _offset += size;
+    }
+
+    const char *_data;
+    size_t _size;
+    size_t _offset = 0;
+};
+
+}  // namespace
+
+void CLDNNGraph::Export(const std::string &modelFileName) {
+    // the compiled programs are written with the network
+    WaitCompiled();
+    BinaryIR::write(*m_network, modelFileName);
+
+    std::ofstream file(modelFileName, std::ios::binary | std::ios::app);
+    if (!file.is_open())
+        THROW_IE_EXCEPTION << "cannot open file " << modelFileName;
+    ExportTrailer trailer = {};
+    trailer.sectionOffset = static_cast<uint64_t>(file.tellp());
+    memcpy(trailer.signature, exportSignature, sizeof(exportSignature));
+
+    writeSize(file, m_config.key_config_map.size());
+    for (auto &item : m_config.key_config_map) {
+        writeString(file, item.first);
+        writeString(file, item.second);
+    }
+    std::vector<char> programs = m_env.engine->get_programs_binaries();
+    writeSize(file, programs.size());
+    file.write(programs.data(), programs.size());
+    // the reordered weights follow the programs, the files exported without them end after the programs
+    if (m_config.weightsCache) {
+        std::vector<char> constants = m_env.engine->get_constants_data();
+        writeSize(file, constants.size());
+        file.write(constants.data(), constants.size());
+    }
+
+    file.write(reinterpret_cast<const char *>(&trailer), sizeof(trailer));
+    if (!file.good())
+        THROW_IE_EXCEPTION << "cannot write the exported network to the file " << modelFileName;
+}
+
+CNNNetworkImplPtr CLDNNGraph::ReadExported(const std::string &modelFileName,
+                                           std::map<std::string, std::string> &config,
+                                           std::vector<char> &programsBinaries,
+                                           std::vector<char> &constantsData) {
+    long long fileSize = FileUtils::fileSize(modelFileName);
+    if (fileSize < static_cast<long long>(sizeof(ExportTrailer)))
+        THROW_IE_EXCEPTION << "cannot open the exported network " << modelFileName;
+    size_t size = static_cast<size_t>(fileSize);
+
+    TBlob<uint8_t>::Ptr file(new TBlob<uint8_t>(Precision::U8, C, {size}));
+    file->allocate();
+    FileUtils::readAllFile(modelFileName, file->buffer(), size);
+    const char *data = file->readOnly().as<const char *>();
+
+    ExportTrailer trailer;
+    memcpy(&trailer, data + size - sizeof(trailer), sizeof(trailer));
+    if (memcmp(trailer.signature, exportSignature, sizeof(exportSignature)) != 0 ||
+            trailer.sectionOffset > size - sizeof(trailer))
+        THROW_IE_EXCEPTION << "The file " << modelFileName << " is not a network exported by the GPU plugin";
+
+    SectionReader reader(data + trailer.sectionOffset, size - sizeof(trailer) - trailer.sectionOffset);
+    config.clear();
+    for (size_t count = reader.size(), i = 0; i < count; i++) {
+        std::string key = reader.str();
+        config[key] = reader.str();
+    }
+    programsBinaries = reader.bytes();
+    constantsData = reader.empty() ? std::vector<char>() : reader.bytes();
+
+    // the blobs of the network refer to the file
+    return BinaryIR::read(file);
 }
 
 void CLDNNGraph::InitProfileInfo(const std::string& layerName,
@@ -6,13 +6,18 @@
 #pragma once
 
 #include <vector>
+#include <list>
 #include <map>
 #include <set>
 #include <memory>
 #include <string>
+#include <atomic>
+#include <future>
+#include <mutex>
 #include "ie_blob.h"
 #include "ie_plugin.hpp"
 #include "cpp/ie_cnn_network.h"
+#include "cnn_network_impl.hpp"
 #include "debug_options.h"
 #include "inference_engine.hpp"
 #include <CPP/network.hpp>
@@ -44,9 +49,27 @@ struct InferenceEnv {
     std::map<std::string, cldnn::layout> inputLayouts;
     std::map<cldnn::primitive_id, cldnn::memory> constBlobs;
 
-    std::vector<std::shared_ptr<cldnn::network>> batchNetworks;
+    // the inputs pre-processed by the device (KEY_CLDNN_DEVICE_PREPROCESSING) by their names: the input primitive of
+    // the name takes the frame of the blob and the primitive of paramsID takes the size and the strides of its ROI
+    struct FrameInput {
+        cldnn::layout frameLayout;
+        cldnn::primitive_id paramsID;
+    };
+    std::map<std::string, FrameInput> frameInputs;
+
+    // the maximal batch of the dynamic batch, the network is compiled for it
     int m_max_batch;
-    int m_bv_sz;
+    // the networks of the dynamic batch compiled for the powers of two below m_max_batch, the request executes
+    // the smallest one which fits its batch (the network of the maximal batch otherwise), so the device computes
+    // less than twice the images of the request
+    std::vector<std::shared_ptr<cldnn::network>> batchNetworks;
+
+    // the number of the micro batches of KEY_CLDNN_MICRO_BATCH the batch of the request is split into, the network
+    // is compiled for a micro batch. The micro batches alternate between the network and its copy on the second
+    // engine (OpenCL queue), so the transfers of one micro batch overlap the execution of the other
+    int m_micro_batches = 1;
+    std::shared_ptr<const cldnn::engine> microBatchEngine;
+    std::shared_ptr<cldnn::network> microBatchNetwork;
 };
 
 class CLDNNGraph : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
@@ -55,7 +78,21 @@ public:
     struct Config {
         Config() : useProfiling(false), dumpCustomKernels(false), exclusiveAsyncRequests(false),
             memory_pool_on(false),
+            memory_pool_limit(0),
+            weightsCache(false),
+            outOfOrderQueue(true),
+            pipelinedOutputs(false),
+            microBatch(0),
             enableDynamicBatch(false),
+            sharedContext(nullptr),
+            compilationListener(nullptr),
+            throughputStreams(1),
+            deviceIds(1, 0),
+            balancer(Balancer::RoundRobin),
+            shapeVariants(4),
+            frameWidth(0),
+            frameHeight(0),
+            logLevel(LogLevel::None),
             queuePriority(cldnn::priority_mode_types::disabled),
             queueThrottle(cldnn::throttle_mode_types::disabled) {}
 
@@ -66,21 +103,104 @@ public:
         bool dumpCustomKernels;
         bool exclusiveAsyncRequests;
         bool memory_pool_on;
+        // in bytes, 0 means no limit
+        uint64_t memory_pool_limit;
+        // the engine keeps the reordered weights for the networks built later and the export
+        bool weightsCache;
+        bool outOfOrderQueue;
+        // the outputs of the async requests are copied to the blobs by the completion thread
+        bool pipelinedOutputs;
+        // the batch of the micro batches the request is inferred by, 0 means the whole batch is inferred at once
+        int microBatch;
+        // the number of the largest features of the outputs of KEY_CLDNN_OUTPUT_TOP_K by the output names
+        std::map<std::string, uint32_t> outputTopK;
         cldnn::priority_mode_types queuePriority;
         cldnn::throttle_mode_types queueThrottle;
         CLDNNCustomLayerMap customLayers;
         cldnn::tuning_config_options tuningConfig;
         std::string graph_dumps_dir;
         std::string sources_dumps_dir;
+        std::string kernels_cache_dir;
+        // the name of the engine shared by the networks loaded with it, empty means the network has its own engine
+        std::string sharedEngine;
+        // the OpenCL context of the application, the engine runs in it
+        void* sharedContext;
+        // the listener of the network compiled by the background thread, nullptr means it is compiled by the load
+        void* compilationListener;
+        int throughputStreams;
+        // the indices of the GPU devices of KEY_DEVICE_ID, the streams are spread over them in turn
+        std::vector<uint32_t> deviceIds;
+        // the placement of the threads which dispatch the requests to the device and run the callbacks
+        InferenceEngine::TaskExecutorConfig asyncThreads;
+        // the choice of the stream of a new request
+        enum class Balancer { RoundRobin, LeastLoaded };
+        Balancer balancer;
+        // the number of the input shapes kept compiled by Reshape()
+        size_t shapeVariants;
+        // the largest frame of the inputs pre-processed by the device, 0 means they are resized by the host
+        size_t frameWidth;
+        size_t frameHeight;
+        enum class LogLevel { None, Warning, Info, Debug };
+        LogLevel logLevel;
+        // the keys given to LoadFromMap, they are stored in the exported network and applied again by its import
+        std::map<std::string, std::string> key_config_map;
     };
-    explicit CLDNNGraph(InferenceEngine::ICNNNetwork &network, const Config& config = {}, int max_batch = -1);
+    /**
+     * @param programsBinaries - the OpenCL programs compiled by another engine, they are loaded instead of compiling
+     *                           the same sources
+     * @param constantsData - the reordered weights kept by another engine, they are taken with Config::weightsCache
+     */
+    explicit CLDNNGraph(InferenceEngine::ICNNNetwork &network, const Config& config = {}, int max_batch = -1,
+                        const std::vector<char>& programsBinaries = {},
+                        const std::vector<char>& constantsData = {});
+
+    ~CLDNNGraph() override;
+
+    /**
+     * @brief Writes the network, the configuration, the compiled OpenCL programs and the reordered weights kept with
+     * Config::weightsCache of the graph to the file. The network is stored as the binary IR, the rest follows it
+     */
+    void Export(const std::string &modelFileName) override;
+
+    /**
+     * @brief Reads the file written by Export
+     * @param config - the configuration the graph was loaded with
+     * @param programsBinaries - the OpenCL programs compiled for the graph
+     * @param constantsData - the reordered weights of the graph, empty if they were not kept
+     * @return The network
+     */
+    static InferenceEngine::details::CNNNetworkImplPtr ReadExported(const std::string &modelFileName,
+                                                                    std::map<std::string, std::string> &config,
+                                                                    std::vector<char> &programsBinaries,
+                                                                    std::vector<char> &constantsData);
 
     InferenceEngine::InferRequestInternal::Ptr
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs) override;
 
+    /**
+     * @brief Replaces the outputs of Config::outputTopK by the indices of their top-k and adds the outputs of the scores
+     */
+    void setNetworkOutputs(const InferenceEngine::OutputsDataMap networkOutputs) override;
+
+    /**
+     * @brief Creates the request inferred by the next stream, the requests are distributed among the streams in turn,
+     * or bound to the stream with the fewest requests with CLDNN_BALANCER_LEAST_LOADED
+     */
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
+
+    /**
+     * @brief Switches the network to other input shapes. The shapes compiled before are taken from the cache of
+     * the variants, otherwise the network is compiled for them while the requests created before keep inferring
+     * the current shapes. The requests created after the call use the new shapes.
+     * The reshape is supported with a single stream and without the dynamic batch only.
+     */
+    void Reshape(const std::map<std::string, InferenceEngine::SizeVector> &inputShapes) override;
+
     static bool IsLayerSupported(const std::string &type) {
         return LayerTypeFromStr(type) != NO_TYPE;
     }
+    // the RNN layers are supported with the LSTM cell only (see CreateRNNPrimitive)
+    static bool IsRNNLayerSupported(const InferenceEngine::CNNLayerPtr &layer);
 
 protected:
     // graph members
@@ -88,8 +208,32 @@ protected:
     InferenceEnv m_env;
     Config m_config;
 
+    // the streams run the copies of the network m_env on their own engines (OpenCL queues), the streams of a device
+    // share the context of its first engine, the first stream is m_env itself. Each stream has its own executor and
+    // synchronizer of the requests
+    struct Stream {
+        InferenceEnv env;
+        InferenceEngine::ITaskExecutor::Ptr taskExecutor;
+        InferenceEngine::TaskSynchronizer::Ptr taskSynchronizer;
+        // the requests bound to the stream by CLDNN_BALANCER_LEAST_LOADED, the released ones expire
+        std::vector<std::weak_ptr<InferenceEngine::IInferRequest>> requests;
+    };
+    std::vector<Stream> m_streams;
+    std::atomic<unsigned> m_nextStream;
+    std::mutex m_streamsMutex;
+    // the copy of the loaded network written by Export, the blobs are shared with the original network
+    InferenceEngine::details::CNNNetworkImplPtr m_network;
+    // the copy of the network reshaped by Reshape() and the networks compiled for the recently used shapes
+    // (the most recent first), the networks share the engine and the executor of the single stream
+    InferenceEngine::details::CNNNetworkImplPtr m_reshapableNetwork;
+    std::list<std::pair<std::string, InferenceEnv>> m_shapeVariants;
+    // the compilation by the background thread (see KEY_CLDNN_COMPILATION_LISTENER)
+    std::shared_future<void> m_compilation;
+
     InferenceEngine::InputsDataMap*  p_currentInputs;
     InferenceEngine::OutputsDataMap* p_currentOutputs;
+    // the custom layers with merge-siblings by the signature of their inputs, parameters and blobs
+    std::map<std::string, std::string> m_mergeableCustomLayers;
     int m_curBatch;
     static const cldnn::primitive_id m_preProcessTag;
     static const cldnn::primitive_id m_weightsTag;
@@ -100,6 +244,11 @@ protected:
     static const cldnn::primitive_id m_workaroundTag;
     static const cldnn::primitive_id m_preCustomLayerTag;
     static const cldnn::primitive_id m_postCustomLayerTag;
+    static const cldnn::primitive_id m_quantizeTag;
+    static const cldnn::primitive_id m_dequantizeTag;
+    static const cldnn::primitive_id m_topKTag;
+    static const cldnn::primitive_id m_frameParamsTag;
+    static const cldnn::primitive_id m_frameConstantsTag;
 
     // internal types
     enum LayerType {
@@ -125,7 +274,7 @@ protected:
         PriorBox,
         DetectionOutput,
         Normalize,
-        Reshape,
+        ReshapeLayer,
         Permute,
         Flatten,
         BatchNormalization,
@@ -143,6 +292,7 @@ protected:
         ArgMax,
         MVN,
         Unpooling,
+        RNN,
         NO_TYPE
     };
 
@@ -154,6 +304,10 @@ protected:
 
     cldnn::format m_defaultFormat;
     cldnn::data_types m_networkPrecision;
+    // prints how many kernels of the network were found in the tuning caches
+    void LogTuningStatistics() const;
+    // prints the device memory allocated by the engines of the streams
+    void LogMemoryStatistics() const;
     void InitFormat(InferenceEngine::ICNNNetwork &network);
 
     static cldnn::data_types DataTypeFromPrecision(InferenceEngine::Precision p);
@@ -172,6 +326,7 @@ protected:
                                  cldnn::layout blobLayout,
                                  size_t blobByteOffset = 0,
                                  WeightRearrangeType rearrange = NO_REARRANGE);
+    void CreateFloatDataPrimitive(cldnn::primitive_id primID, const std::vector<float>& values, cldnn::tensor size);
     void CreateWeightAndBiasPrimitives(const InferenceEngine::CNNLayerPtr& layer,
                                        std::vector<cldnn::primitive_id>& weightsPrimID,
                                        std::vector<cldnn::primitive_id>& biasesPrimID);
@@ -180,8 +335,16 @@ protected:
                                            cldnn::primitive_id biasesPrimID);
     void AddPreProcessPrimitive(InferenceEngine::InputInfo::Ptr inputInfo);
     void AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo);
+    // the input is resized by the device kernel of AddFramePreprocessPrimitive()
+    bool IsFrameInput(const InferenceEngine::InputInfo::Ptr& inputInfo) const;
+    // adds the inputs of the frame and of its ROI parameters and the kernel which writes the input of the layout
+    void AddFramePreprocessPrimitive(const InferenceEngine::InputInfo::Ptr& inputInfo, const cldnn::layout& inputLayout);
     void AddOutputPrimitive(std::string outputName, const InferenceEngine::DataPtr outputData,
                             InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::UNSPECIFIED);
+    // adds the outputs of the indices and the scores of the top-k features of the output instead of it
+    void AddTopKOutputPrimitives(const std::string& outputName, const InferenceEngine::DataPtr outputData);
+    // returns the primitive which computes the output of the IR
+    cldnn::primitive_id GetOutputPrimitiveID(const std::string& outputName) const;
     void CreateSingleLayerPrimitive(InferenceEngine::CNNLayerPtr& layer);
     bool IsValidSplitConvMerge(const InferenceEngine::SplitLayer* splitLayer) const;
     bool CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const;
@@ -206,6 +369,27 @@ protected:
                          InferenceEngine::InferenceEngineProfileInfo::LayerStatus status);
     void changeInputBatch(size_t batch);
     void CompileNetwork();
+    // compiles the loaded topology and creates the streams of the network
+    void Compile();
+    // waits for the background compilation, rethrows its error
+    void WaitCompiled() const;
+    // the engine runs on the device of the context if it is given, on the device of the index otherwise
+    std::shared_ptr<const cldnn::engine> CreateEngine(void* context, uint32_t deviceId) const;
+    // returns the engine of m_config.sharedEngine, creates it for the first network
+    std::shared_ptr<const cldnn::engine> GetSharedEngine() const;
+    std::shared_ptr<cldnn::network> BuildNetwork(const cldnn::engine& engine) const;
+    // returns the copy of the network reshaped to the micro batch, nullptr if the batch cannot be split
+    InferenceEngine::details::CNNNetworkImplPtr CreateMicroBatchNetwork(InferenceEngine::ICNNNetwork &network);
+    // builds the second network of the micro batches of env on the new engine of its context
+    void BuildMicroBatchNetwork(InferenceEnv& env, uint32_t deviceId) const;
+    // builds m_env.batchNetworks of the dynamic batch
+    void BuildBatchNetworks(InferenceEngine::ICNNNetwork &network, int max_batch);
+    void CreateStreams();
+    // returns the index of the stream of a new request
+    size_t SelectStream();
+    InferenceEngine::InferRequestInternal::Ptr CreateStreamRequest(InferenceEngine::InputsDataMap networkInputs,
+                                                                   InferenceEngine::OutputsDataMap networkOutputs,
+                                                                   const Stream& stream);
 
     // Layer Primitive Creators
     void CreatePReLUPrimitive(InferenceEngine::CNNLayerPtr &layer);
@@ -231,6 +415,8 @@ protected:
     void CreateLRNPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreateActivationPrimitive(InferenceEngine::CNNLayerPtr &layer, const LayerType type);
     void CreateConvolutionPrimitive(InferenceEngine::CNNLayerPtr &layer);
+    static bool IsInt8Convolution(const InferenceEngine::CNNLayerPtr &layer);
+    void CreateInt8ConvolutionPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreateScaleShiftPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreateProposalPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreatePSROIPoolingPrimitive(InferenceEngine::CNNLayerPtr &layer);
@@ -242,6 +428,7 @@ protected:
     void CreateArgMaxPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreateMaxUnpoolingPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void CreateMVNPrimitive(InferenceEngine::CNNLayerPtr &layer);
+    void CreateRNNPrimitive(InferenceEngine::CNNLayerPtr &layer);
     void AddConstantBlobInput(InferenceEngine::CNNLayerPtr &layer);
     void CreateCustomLayerPrimitive(InferenceEngine::CNNLayerPtr &layer, CLDNNCustomLayerPtr customLayer);
 };
@@ -7,8 +7,15 @@
 #include <string>
 #include <map>
 #include <functional>
+#include <cstring>
+#include <iterator>
 #include <CPP/detection_output.hpp>  // todo: find a way to remove this
 #include <description_buffer.hpp>
+#include <cldnn/cldnn_remote_blob.hpp>
+#include <cldnn/cldnn_config.hpp>
+#include <precision_utils.h>
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
 #include "cldnn_infer_request.h"
 
 using namespace InferenceEngine;
@@ -17,6 +24,68 @@ namespace CLDNNPlugin {
 
 const std::string CLDNNInferRequest::fp32_suffix = "_fp32";
 
+namespace {
+// the OpenCL runtimes use the host memory of the user in place if it is aligned for the zero copy
+const size_t zeroCopyAddressAlignment = 4096;
+const size_t zeroCopySizeAlignment = 64;
+
+template <typename T>
+cldnn::memory attachInputMemory(const cldnn::engine& engine, bool hostUnifiedMemory,
+                                const cldnn::layout& layout, T* ptr, size_t n) {
+    if (hostUnifiedMemory &&
+        reinterpret_cast<uintptr_t>(ptr) % zeroCopyAddressAlignment == 0 &&
+        (n * sizeof(T)) % zeroCopySizeAlignment == 0) {
+        // the device shares the memory with the host, it reads the input from the user buffer without copying it
+        return cldnn::memory::share(engine, layout, ptr, n);
+    }
+    return cldnn::memory::attach(layout, ptr, n);
+}
+
+inline float convertOutputValue(ie_fp16 value, float) {
+    return PrecisionUtils::f16tof32(value);
+}
+
+template <typename T>
+inline T convertOutputValue(T value, T) {
+    return value;
+}
+
+// copies n values of the device buffer of the layout to dst, the padding of the buffer is skipped
+template <typename src_t, typename dst_t>
+void copyOutputBuffer(const cldnn::layout& layout, const src_t* resPtr, dst_t* resVec, size_t n) {
+    auto size = layout.size;
+    auto l_padd = layout.data_padding.lower_size();
+    auto u_padd = layout.data_padding.upper_size();
+
+    auto h_padding = u_padd.spatial[0] + l_padd.spatial[0];
+    auto v_padding_l = (h_padding + size.spatial[0]) * u_padd.spatial[1];
+    auto v_padding_u = (h_padding + size.spatial[0]) * l_padd.spatial[1];
+    // the part of the batch given by buf_info is copied
+    const size_t batches = std::min<size_t>(size.batch[0], n / (size_t(size.feature[0]) * size.spatial[0] * size.spatial[1]));
+
+    if (h_padding || v_padding_l || v_padding_u) {
+        size_t i = 0;
+        for (size_t b = 0; b < batches; b++) {
+            for (size_t f = 0; f < size.feature[0]; f++) {
+                i += v_padding_l;
+                for (size_t y = 0; y < size.spatial[1]; y++) {
+                    i += l_padd.spatial[0];
+                    for (size_t x = 0; x < size.spatial[0]; x++, i++) {
+                        *resVec++ = convertOutputValue(resPtr[i], dst_t());
+                    }
+                    i += u_padd.spatial[0];
+                }
+                i += v_padding_u;
+            }
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            resVec[i] = convertOutputValue(resPtr[i], dst_t());
+        }
+    }
+}
+}  // namespace
+
 Blob::Ptr CLDNNInferRequest::createInputBlob(const Precision& p, const Layout& l, const SizeVector& sz, uint8_t* mem_ptr) {
     switch (p) {
     case Precision::FP32:
@@ -67,71 +136,31 @@ Blob::Ptr CLDNNInferRequest::createOutputBlob(const Precision& p, SizeVector& sz
 void CLDNNInferRequest::copyOutputData(const cldnn::memory& outputMemory,
                                         Blob::Ptr bptr,
                                         buf_info* bi) {
+    auto resPtr = outputMemory.pointer<uint8_t>();
+    copyOutputData(outputMemory.get_layout(), resPtr.data(), bptr, bi);
+}
+
+void CLDNNInferRequest::copyOutputData(const cldnn::layout& layout,
+                                        const uint8_t* data,
+                                        Blob::Ptr bptr,
+                                        buf_info* bi) {
     size_t n = (bi == nullptr) ? bptr->size() : bi->buf_size;
     size_t offset = (bi == nullptr) ? 0 : bi->buf_offset;
 
-    auto layout = outputMemory.get_layout();
-    auto size = layout.size;
-    auto l_padd = layout.data_padding.lower_size();
-    auto u_padd = layout.data_padding.upper_size();
-
-    auto h_padding = u_padd.spatial[0] + l_padd.spatial[0];
-    auto v_padding_l = (h_padding + size.spatial[0]) * u_padd.spatial[1];
-    auto v_padding_u = (h_padding + size.spatial[0]) * l_padd.spatial[1];
-
     switch (bptr->precision()) {
     case Precision::FP32: {
         TBlob<float>::Ptr out_f = std::dynamic_pointer_cast<TBlob<float>>(bptr);
-        auto resPtr = outputMemory.pointer<float>();
-        float *resVec = out_f->data() + offset;
-
-        if (h_padding || v_padding_l || v_padding_u) {
-            size_t i = 0;
-            for (size_t b = 0; b < size.batch[0]; b++) {
-                for (size_t f = 0; f < size.feature[0]; f++) {
-                    i += v_padding_l;
-                    for (size_t y = 0; y < size.spatial[1]; y++) {
-                        i += l_padd.spatial[0];
-                        for (size_t x = 0; x < size.spatial[0]; x++, i++) {
-                            *resVec++ = resPtr[i];
-                        }
-                        i += u_padd.spatial[0];
-                    }
-                    i += v_padding_u;
-                }
-            }
+        if (layout.data_type == cldnn::data_types::f16) {
+            // the output of the FP16 network is converted on the host
+            copyOutputBuffer(layout, reinterpret_cast<const ie_fp16*>(data), out_f->data() + offset, n);
         } else {
-            for (size_t i = 0; i < n; i++) {
-                resVec[i] = resPtr[i];
-            }
+            copyOutputBuffer(layout, reinterpret_cast<const float*>(data), out_f->data() + offset, n);
         }
     }
     break;
     case Precision::FP16: {
         TBlob<uint16_t>::Ptr out_f = std::dynamic_pointer_cast<TBlob<uint16_t>>(bptr);
-        auto resPtr = outputMemory.pointer<uint16_t>();
-        uint16_t *resVec = out_f->data() + offset;
-
-        if (h_padding || v_padding_l || v_padding_u) {
-            size_t i = 0;
-            for (size_t b = 0; b < size.batch[0]; b++) {
-                for (size_t f = 0; f < size.feature[0]; f++) {
-                    i += v_padding_l;
-                    for (size_t y = 0; y < size.spatial[1]; y++) {
-                        i += l_padd.spatial[0];
-                        for (size_t x = 0; x < size.spatial[0]; x++, i++) {
-                            *resVec++ = resPtr[i];
-                        }
-                        i += u_padd.spatial[0];
-                    }
-                    i += v_padding_u;
-                }
-            }
-        } else {
-            for (size_t i = 0; i < n; i++) {
-                resVec[i] = resPtr[i];
-            }
-        }
+        copyOutputBuffer(layout, reinterpret_cast<const uint16_t*>(data), out_f->data() + offset, n);
     }
     break;
     default:
@@ -142,24 +171,23 @@ void CLDNNInferRequest::copyOutputData(const cldnn::memory& outputMemory,
 void CLDNNInferRequest::copyInputData(std::shared_ptr<cldnn::network> network,
                                     const cldnn::primitive_id &inputName,
                                     const cldnn::layout& inputLayout,
-                                    const Blob &inputBlob, buf_info* bi) {
-    size_t n = (bi == nullptr) ? inputBlob.size() : bi->buf_size;
-    size_t offset = (bi == nullptr) ? 0 : bi->buf_offset;
+                                    const Blob &inputBlob) {
+    size_t n = inputBlob.size();
 
     switch (inputBlob.precision()) {
     case Precision::FP32: {
-        float* blob_ptr = const_cast<float*>(inputBlob.cbuffer().as<const float*>()) + offset;
-        network->set_input_data(inputName, cldnn::memory::attach(inputLayout, blob_ptr, n));
+        float* blob_ptr = const_cast<float*>(inputBlob.cbuffer().as<const float*>());
+        network->set_input_data(inputName, attachInputMemory(*(m_env.engine), m_hostUnifiedMemory, inputLayout, blob_ptr, n));
         break;
     }
     case Precision::FP16: {
-        uint16_t* blob_ptr = const_cast<uint16_t*>(inputBlob.cbuffer().as<const uint16_t*>()) + offset;
-        network->set_input_data(inputName, cldnn::memory::attach(inputLayout, blob_ptr, n));
+        uint16_t* blob_ptr = const_cast<uint16_t*>(inputBlob.cbuffer().as<const uint16_t*>());
+        network->set_input_data(inputName, attachInputMemory(*(m_env.engine), m_hostUnifiedMemory, inputLayout, blob_ptr, n));
         break;
     }
     case Precision::U8: {
-        uint8_t* blob_ptr = const_cast<uint8_t*>(inputBlob.cbuffer().as<const uint8_t*>()) + offset;
-        network->set_input_data(inputName, cldnn::memory::attach(inputLayout, blob_ptr, n));
+        uint8_t* blob_ptr = const_cast<uint8_t*>(inputBlob.cbuffer().as<const uint8_t*>());
+        network->set_input_data(inputName, attachInputMemory(*(m_env.engine), m_hostUnifiedMemory, inputLayout, blob_ptr, n));
         break;
     }
     default:
@@ -177,11 +205,32 @@ void CLDNNInferRequest::AllocateInputs() {
         InputInfo::Ptr ni = _networkInputs.at(input.first);
 
         const SizeVector sz = { size_t(dims.spatial[0]), size_t(dims.spatial[1]),
-                                size_t(dims.feature[0]), size_t(dims.batch[0]) };
+                                size_t(dims.feature[0]), size_t(dims.batch[0]) * m_env.m_micro_batches };
         Precision ip = ni->getInputPrecision();
         Layout l = TensorDesc::getLayoutByDims(sz);
 
-        cldnn::memory inputMem = cldnn::memory::allocate(*(m_env.engine), layout);
+        auto frameInput = m_env.frameInputs.find(name);
+        if (frameInput != m_env.frameInputs.end()) {
+            // the default blob is copied to the frame as the ROI of the whole blob
+            _inputs[name] = createInputBlob(ip, l, sz);
+            _inputs[name]->allocate();
+            inputsMemory.insert({ name, cldnn::memory::allocate(*(m_env.engine), frameInput->second.frameLayout) });
+            inputsMemory.insert({ frameInput->second.paramsID, cldnn::memory::allocate(*(m_env.engine),
+                cldnn::layout(cldnn::data_types::f32, cldnn::format::bfyx, cldnn::tensor(1, 1, 8, 1))) });
+            continue;
+        }
+
+        if (m_env.m_micro_batches > 1) {
+            // the network reads the micro batches of the blob in turn, so the blob of the whole batch is in host memory
+            if (layout.format == cldnn::format::byxf) l = NHWC;
+            _inputs[name] = createInputBlob(ip, l, sz);
+            _inputs[name]->allocate();
+            continue;
+        }
+
+        // the discrete device reads the blob of the input from the pinned host memory by the non-blocking transfer
+        cldnn::memory inputMem = m_hostUnifiedMemory ? cldnn::memory::allocate(*(m_env.engine), layout)
+                                                     : cldnn::memory::allocate_staging(*(m_env.engine), layout);
         cldnn::pointer<uint8_t> mem_ptr = inputMem.pointer<uint8_t>();
 
         inputsMemory.insert({ name, inputMem });
@@ -198,32 +247,6 @@ void CLDNNInferRequest::AllocateInputs() {
     }
 }
 
-void CLDNNInferRequest::AllocateInputsDyn() {
-    // allocate inputs
-    for (auto &input : m_env.inputLayouts) {
-        auto dims = input.second.size;
-        InputInfo::Ptr ni = _networkInputs.at(input.first);
-        const SizeVector sz = { size_t(dims.spatial[0]), size_t(dims.spatial[1]),
-                                size_t(dims.feature[0]), size_t(m_env.m_max_batch) };
-        Precision ip = ni->getInputPrecision();
-        Layout l = TensorDesc::getLayoutByDims(sz);
-
-        Blob::Ptr inputBlob = createInputBlob(ip, l, sz);
-        if (ip == Precision::I16) {
-            auto fp32inputBlob = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                Precision::FP32, NCHW,
-                { size_t(dims.spatial[0]),
-                size_t(dims.spatial[1]),
-                size_t(dims.feature[0]),
-                size_t(m_env.m_max_batch) });
-            fp32inputBlob->allocate();
-            _inputs[input.first + fp32_suffix] = fp32inputBlob;
-        }
-        inputBlob->allocate();
-        _inputs[input.first] = inputBlob;
-    }
-}
-
 void CLDNNInferRequest::AllocateOutputs() {
     auto networkOutputsIDs = m_env.network->get_output_ids();
     auto allPrimitiveIds = m_env.network->get_all_primitives();
@@ -267,30 +290,26 @@ void CLDNNInferRequest::AllocateOutputs() {
         DataPtr oi = no.second;
         Precision op = oi->getPrecision();
 
-        _outputs[no.first] = createOutputBlob(op, output, output_mem_ptr.data());
-    }
-}
-
-void CLDNNInferRequest::AllocateOutputsDyn() {
-    // allocate outputs
-    for (auto& no : _networkOutputs) {
-        auto res_output = m_env.outputDims.find(no.first);
-
-        InferenceEngine::SizeVector output;
-        if (res_output != m_env.outputDims.end()) {
-            // if output with this name exists, take it
-            output = res_output->second;
+        if (m_env.m_micro_batches > 1) {
+            // the outputs of the micro batches are copied to the parts of the blob of the whole batch
+            output.back() *= m_env.m_micro_batches;
+            _outputs[no.first] = createOutputBlob(op, output);
+            _outputs[no.first]->allocate();
+        } else if (op == Precision::FP32 && output_mem.get_layout().data_type == cldnn::data_types::f16) {
+            // the output is converted on the host, the blob has its own buffer
+            _outputs[no.first] = createOutputBlob(op, output);
+            _outputs[no.first]->allocate();
+        } else if (!m_hostUnifiedMemory) {
+            // the output of the discrete device is read to the pinned host memory of the blob after the network
+            cldnn::memory staging = cldnn::memory::allocate_staging(*(m_env.engine), output_mem.get_layout());
+            // the staging memory stays mapped, so its pointer is valid after the lock is released
+            cldnn::pointer<uint8_t> staging_lock = staging.pointer<uint8_t>();
+            uint8_t* staging_ptr = staging_lock.data();
+            outputsStaging.insert({ no.first, { staging, staging_ptr } });
+            _outputs[no.first] = createOutputBlob(op, output, staging_ptr);
         } else {
-            // if doesn't try to locate fused layer
-            std::string outputID = m_env.primitiveIDs.at(no.first);
-            output = m_env.outputDims.at(outputID);
+            _outputs[no.first] = createOutputBlob(op, output, output_mem_ptr.data());
         }
-
-        DataPtr oi = no.second;
-        Precision op = oi->getPrecision();
-        Blob::Ptr outputBlob = createOutputBlob(op, output);
-        outputBlob->allocate();
-        _outputs[no.first] = outputBlob;
     }
 }
 
@@ -303,87 +322,21 @@ void CLDNNInferRequest::SetBatch(int new_batch) {
             " for this request.";
     }
 
-    if (new_batch == m_curBatch)
-        return;
-
-    batchInputs.clear();
-    batchOutputs.clear();
-
-    // tune expected inputs
-    for (auto &input : m_env.inputLayouts) {
-        cldnn::tensor dims = input.second.size;
-        const SizeVector sz = { size_t(dims.spatial[0]), size_t(dims.spatial[1]), size_t(dims.feature[0]), 1 };
-        size_t single_batch = std::accumulate(std::begin(sz), std::end(sz), (size_t)1, std::multiplies<size_t>());
-        std::vector<buf_info> in_buf;
-
-        size_t offset = 0;
-        size_t bsz = single_batch;
-        int b = 0;
-
-        // calculate metadata for input buffers
-        for (unsigned nb = 0; nb < m_env.m_bv_sz; nb++) {
-            unsigned int mask = 1 << nb;
-
-            buf_info ib = { offset, bsz };
-            in_buf.push_back(ib);
-
-            if (new_batch & mask)
-                offset += bsz;
-            bsz <<= 1;
-        }
-
-        batchInputs[input.first] = in_buf;
-    }
-
-    // tune expected outputs
-    for (auto& no : _networkOutputs) {
-        auto res_output = m_env.outputDims.find(no.first);
-
-        InferenceEngine::SizeVector sz;
-        if (res_output != m_env.outputDims.end())
-            sz = res_output->second;
-        else
-            sz = m_env.outputDims.at(m_env.primitiveIDs.at(no.first));
-
-        sz.back() = 1;
-        size_t single_batch = std::accumulate(std::begin(sz), std::end(sz), (size_t)1, std::multiplies<size_t>());
-        std::vector<buf_info> out_buf;
-
-        size_t offset = 0;
-        size_t bsz = single_batch;
-        int b = 0;
-        // calculate metadata for output buffers
-        for (unsigned nb = 0; nb < m_env.m_bv_sz; nb++) {
-            unsigned int mask = 1 << nb;
-
-            buf_info ob = { offset, bsz };
-            out_buf.push_back(ob);
-
-            if (new_batch & mask)
-                offset += bsz;
-
-            bsz <<= 1;
-        }
-
-        batchOutputs[no.first] = out_buf;
-    }
-
     m_curBatch = new_batch;
 }
 
 CLDNNInferRequest::CLDNNInferRequest(InferenceEnv env, bool useProfiling,
-                                     InputsDataMap networkInputs, OutputsDataMap networkOutputs)
+                                     InputsDataMap networkInputs, OutputsDataMap networkOutputs,
+                                     bool pipelinedOutputs)
         : InferRequestInternal(networkInputs, networkOutputs),
           m_curBatch(-1),
+          m_pipelinedOutputs(pipelinedOutputs),
           m_env(env),
-          m_useProfiling(useProfiling) {
-    if (m_env.m_max_batch > 1) {
-        AllocateInputsDyn();
-        AllocateOutputsDyn();
-    } else {
-        AllocateInputs();
-        AllocateOutputs();
-    }
+          m_useProfiling(useProfiling),
+          m_profilingResolved(false),
+          m_hostUnifiedMemory(m_env.engine->get_info().supports_host_unified_memory != 0) {
+    AllocateInputs();
+    AllocateOutputs();
 
     // Fill implementations map
     if (m_useProfiling) {
@@ -416,19 +369,96 @@ CLDNNInferRequest::CLDNNInferRequest(InferenceEnv env, bool useProfiling,
         };
 
         // Parse primitive info and extract implementation name.
+        m_profilingTable.reserve(m_env.profilingIDs.size());
         for (auto& id : m_env.profilingIDs) {
             std::string prim_info = "";
             try {
                 prim_info = m_env.network->get_primitive_info(id);
             } catch (std::exception& e) { }
 
-            implementationsMap.insert({id, extractImplementationFromInfo(prim_info)});
+            std::string impl = extractImplementationFromInfo(prim_info);
+            impl.copy(m_env.perfMap[id].exec_type, impl.length());
+            m_profilingTable.push_back({ id, m_env.perfMap[id].status, 0, 0, false });
         }
     }
 }
 
+void CLDNNInferRequest::SetBlob(const char *name, const Blob::Ptr &data) {
+    if (name == nullptr || m_env.frameInputs.find(name) == m_env.frameInputs.end()) {
+        // the outputs are written as a whole, while the strided views of the inputs are gathered by the inference
+        if (name != nullptr && data && _networkOutputs.find(name) != _networkOutputs.end() &&
+                (!blob_is_dense(data) || data->getTensorDesc().getBlockingDesc().getOffsetPadding() != 0)) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The output '" << name
+                               << "' cannot be written to the strided or the offset view of a blob";
+        }
+        InferRequestInternal::SetBlob(name, data);
+        return;
+    }
+    if (!data)
+        THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty blob with name: \'" << name << "\'";
+    if (data->buffer() == nullptr)
+        THROW_IE_EXCEPTION << "Input data was not allocated. Input name: \'" << name << "\'";
+
+    const InputInfo::Ptr& input = _networkInputs.at(name);
+    if (input->getInputPrecision() != data->precision()) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
+                           << "Failed to set Blob with precision not corresponding to user input precision";
+    }
+    const TensorDesc& desc = data->getTensorDesc();
+    const SizeVector& dims = desc.getDims();
+    const SizeVector& inputDims = input->getTensorDesc().getDims();
+    if (desc.getLayout() != NCHW && desc.getLayout() != NHWC) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "The frame of the input \'" << name
+                           << "\' should have the NCHW or NHWC layout";
+    }
+    if (dims[0] != inputDims[0] || dims[1] != inputDims[1] || dims[2] == 0 || dims[3] == 0) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "The batch or the channels of the frame of the input \'" << name
+                           << "\' are not equal to the ones of the network";
+    }
+    m_frameBlobs[name] = data;
+}
+
+const Blob &CLDNNInferRequest::getDenseInput(const std::string &name, const Blob::Ptr &blob) {
+    if (blob_is_dense(blob) && blob->getTensorDesc().getBlockingDesc().getOffsetPadding() == 0)
+        return *blob;
+
+    // the crop or the slice of a bigger blob, the memory of the network is attached to the dense blobs only
+    const TensorDesc &desc = blob->getTensorDesc();
+    Blob::Ptr &dense = m_denseInputs[name];
+    if (!dense || dense->getTensorDesc().getDims() != desc.getDims() ||
+            dense->getTensorDesc().getPrecision() != desc.getPrecision() ||
+            dense->getTensorDesc().getLayout() != desc.getLayout()) {
+        dense = make_blob_with_precision(TensorDesc(desc.getPrecision(), desc.getDims(), desc.getLayout()));
+        dense->allocate();
+    }
+    blob_copy(blob, dense);
+    return *dense;
+}
+
+void CLDNNInferRequest::GetBlob(const char *name, Blob::Ptr &data) {
+    auto frameBlob = name == nullptr ? m_frameBlobs.end() : m_frameBlobs.find(name);
+    if (frameBlob != m_frameBlobs.end()) {
+        data = frameBlob->second;
+        return;
+    }
+    InferRequestInternal::GetBlob(name, data);
+}
+
 void CLDNNInferRequest::execAndParse() {
+    IE_PROFILING_AUTO_SCOPE(CLDNN_ExecuteAndPullOutputs)
+    // the enqueued network can't be stopped, so the cancelled or late inference is shed before it reaches the queue
+    _cancellation.check();
     auto networkOutputs = m_env.network->execute();
+    // the reads of the outputs to the pinned blobs are enqueued after the network, they overlap with its execution
+    for (auto& staging : outputsStaging) {
+        if (_outputs[staging.first]->buffer().as<uint8_t*>() == staging.second.data) {
+            staging.second.memory.download(networkOutputs.at(outputsMap[staging.first]).get_memory());
+        }
+    }
+    for (auto& output : networkOutputs) {
+        output.second.get_event().wait();
+    }
+    _timings.mark(&InferRequestTimings::executed_uSec);
 
     // Collect outputs as requested by the model
     for (auto& no : _networkOutputs) {
@@ -436,94 +466,221 @@ void CLDNNInferRequest::execAndParse() {
         auto outputMemory = networkOutputs.at(outputID).get_memory();
         Blob::Ptr bptr = _outputs[no.first];
 
+        auto staging = outputsStaging.find(no.first);
+        if (staging != outputsStaging.end() && bptr->buffer().as<uint8_t*>() == staging->second.data) {
+            // the blob is the staging memory, its lock waits for the read
+            staging->second.memory.pointer<uint8_t>();
+            continue;
+        }
+
         auto out_ptr = outputMemory.pointer<uint8_t>();
         auto blob_ptr = bptr->buffer().as<uint8_t*>();
 
         // If Async API is used, copy of output blobs is not needed, unless SetBlob function was called.
         // But in the case when old API is used we have to copy data to memory provided by user.
         if (blob_ptr != &out_ptr[0]) {
-            copyOutputData(outputMemory, bptr);
+            // the network computes the maximal batch, only the images of the current batch are copied
+            buf_info bi = { 0, m_curBatch > 0 ? bptr->size() / m_env.m_max_batch * m_curBatch : bptr->size() };
+            if (m_pipelinedOutputs && _isPreprocessed) {
+                // Postprocess() follows the pipelined inference, the padding and the conversion are left to it
+                auto& staged = m_stagedOutputs[no.first];
+                staged.layout = outputMemory.get_layout();
+                staged.data.assign(&out_ptr[0], &out_ptr[0] + outputMemory.size());
+                staged.bi = bi;
+                staged.pending = true;
+            } else {
+                copyOutputData(outputMemory, bptr, &bi);
+            }
         }
     }
+    _timings.mark(&InferRequestTimings::outputsCopied_uSec);
 
     // finally collect profiling info
     if (m_useProfiling) {
-        std::map<cldnn::primitive_id, cldnn::event> executedPrimitives = m_env.network->get_executed_primitives();
-        auto allPrimitives = m_env.network->get_all_primitives();
-
-        // Get profiling info for all layers
-        for (auto &profiledID : m_env.profilingIDs) {
-            std::string impl = implementationsMap.at(profiledID);
-            impl.copy(m_env.perfMap[profiledID].exec_type, impl.length());
-
-            // Change status if layer wasn't executed by cldnn engine
-            if (executedPrimitives.find(profiledID) == executedPrimitives.end()) {
-                if (allPrimitives.find(profiledID) != allPrimitives.end() &&
-                    allPrimitives.at(profiledID) == "_optimized_") {
-                    // Layer was marked as optimized by cldnn
-                    m_env.perfMap[profiledID].status = InferenceEngineProfileInfo::OPTIMIZED_OUT;
-                } else {
-                    // Layer wasn't run for some reason
-                    m_env.perfMap[profiledID].status = InferenceEngineProfileInfo::NOT_RUN;
-                }
-                m_env.perfMap[profiledID].cpu_uSec = m_env.perfMap[profiledID].realTime_uSec = 0;
-                continue;
+        CollectProfilingInfo(*m_env.network);
+    }
+}
+
+void CLDNNInferRequest::execBatchNetwork(size_t index) {
+    IE_PROFILING_AUTO_SCOPE(CLDNN_ExecuteBatchNetwork)
+    auto& network = *m_env.batchNetworks[index];
+    const int batch = 1 << index;
+    for (auto &item : _inputs) {
+        // the network reads the first images of the blob of the maximal batch, the ones after the current batch
+        // are computed and dropped
+        auto inputLayout = m_env.inputLayouts.at(item.first);
+        inputLayout.size.batch[0] = batch;
+        if (auto clBlob = dynamic_cast<const CLBufferBlob*>(item.second.get())) {
+            network.set_input_data(item.first,
+                cldnn::memory::attach_cl_buffer(*m_env.engine, inputLayout, clBlob->getCLBuffer()));
+            continue;
+        }
+        const Blob &inputBlob = getDenseInput(item.first, item.second);
+        setPartialInput(network, *m_env.engine, item.first, inputBlob, inputLayout, 0,
+                        inputBlob.size() / m_env.m_max_batch * batch);
+    }
+    _timings.mark(&InferRequestTimings::preprocessed_uSec);
+
+    _cancellation.check();
+    auto networkOutputs = network.execute();
+    for (auto& output : networkOutputs) {
+        output.second.get_event().wait();
+    }
+    _timings.mark(&InferRequestTimings::executed_uSec);
+
+    // the outputs of the network are not the memory of the blobs, the images of the current batch are copied
+    for (auto& no : _networkOutputs) {
+        auto outputMemory = networkOutputs.at(outputsMap[no.first]).get_memory();
+        Blob::Ptr bptr = _outputs[no.first];
+        buf_info bi = { 0, bptr->size() / m_env.m_max_batch * m_curBatch };
+        copyOutputData(outputMemory, bptr, &bi);
+    }
+    _timings.mark(&InferRequestTimings::outputsCopied_uSec);
+
+    if (m_useProfiling) {
+        CollectProfilingInfo(network);
+    }
+}
+
+void CLDNNInferRequest::execMicroBatches() {
+    IE_PROFILING_AUTO_SCOPE(CLDNN_ExecuteMicroBatches)
+    // the micro batches alternate between the networks of two queues: the inputs of the micro batch are written
+    // and the outputs of the previous one are read while the other network executes
+    const std::shared_ptr<cldnn::network> networks[] = { m_env.network, m_env.microBatchNetwork };
+    const std::shared_ptr<const cldnn::engine> engines[] = { m_env.engine, m_env.microBatchEngine };
+    std::map<cldnn::primitive_id, cldnn::network_output> executed[2];
+    const int microBatches = m_env.m_micro_batches;
+
+    // the strided inputs are gathered once for all the micro batches
+    std::map<std::string, const Blob *> inputs;
+    for (auto &item : _inputs) {
+        inputs[item.first] = &getDenseInput(item.first, item.second);
+    }
+    // the micro batches are set to the device while the previous ones execute, their copies are not separated
+    _timings.mark(&InferRequestTimings::preprocessed_uSec);
+
+    for (int mb = 0; mb <= microBatches; mb++) {
+        if (mb < microBatches) {
+            auto& network = *networks[mb % 2];
+            // the network waits for its previous micro batch, its outputs are read by the previous iteration
+            for (auto &item : inputs) {
+                setMicroBatchInput(network, *engines[mb % 2], item.first, *item.second, mb);
             }
+            // the micro batches already enqueued are completed by the device, the rest are not enqueued
+            _cancellation.check();
+            executed[mb % 2] = network.execute();
+        }
+        if (mb == 0) {
+            continue;
+        }
 
-            auto event = executedPrimitives.at(profiledID);
-            executedPrimitives.erase(profiledID);
-
-            cldnn::instrumentation::profiling_info cldnnInfo{profiledID, event.get_profiling_info()};
-
-            // Collect timings
-            for (auto &interval : cldnnInfo.intervals) {
-                using duration_t = std::chrono::duration<long long, std::chrono::microseconds::period>;
-                auto count = std::chrono::duration_cast<duration_t>(interval.value->value()).count();
-
-                if (interval.name == "submission") {
-                    m_env.perfMap[profiledID].cpu_uSec = count;
-                } else if (interval.name == "executing") {
-                    m_env.perfMap[profiledID].realTime_uSec = count;
-                } else if (interval.name == "duration") {  // "duration" is used for CPU layers
-                    m_env.perfMap[profiledID].cpu_uSec = count;
-                    static const std::string cpuExecType("CPU");
-                    memset(m_env.perfMap[profiledID].exec_type, 0, sizeof(m_env.perfMap[profiledID].exec_type));
-                    cpuExecType.copy(m_env.perfMap[profiledID].exec_type,
-                        cpuExecType.length());  // Override execType as CPU
-                }
+        const int previous = mb - 1;
+        if (mb == microBatches) {
+            for (auto& output : executed[previous % 2]) {
+                output.second.get_event().wait();
             }
+            _timings.mark(&InferRequestTimings::executed_uSec);
+        }
+        for (auto& no : _networkOutputs) {
+            auto outputMemory = executed[previous % 2].at(outputsMap[no.first]).get_memory();
+            Blob::Ptr bptr = _outputs[no.first];
+            const size_t size = bptr->size() / microBatches;
+            buf_info bi = { size * previous, size };
+            copyOutputData(outputMemory, bptr, &bi);
         }
     }
+    _timings.mark(&InferRequestTimings::outputsCopied_uSec);
+
+    if (m_useProfiling) {
+        CollectProfilingInfo(*m_env.network);
+    }
 }
 
-void CLDNNInferRequest::execAndParseDyn() {
-    std::vector<std::map<cldnn::primitive_id, cldnn::network_output>> networkOutputs(m_env.m_bv_sz);
+void CLDNNInferRequest::setMicroBatchInput(cldnn::network& network, const cldnn::engine& engine,
+                                           const cldnn::primitive_id &inputName, const Blob &inputBlob,
+                                           int microBatch) {
+    auto inputLayout = m_env.inputLayouts.at(inputName);
+    if (dynamic_cast<const CLBufferBlob*>(&inputBlob) != nullptr) {
+        THROW_IE_EXCEPTION << "The OpenCL buffer blob cannot be the input of the micro batches";
+    }
 
-    // set up exection and put all graphs into driver queue
-    for (unsigned nb = 0; nb < m_env.m_bv_sz; nb++) {
-        unsigned int mask = 1 << nb;
+    const size_t n = inputBlob.size() / m_env.m_micro_batches;
+    setPartialInput(network, engine, inputName, inputBlob, inputLayout, n * microBatch, n);
+}
 
-        if (m_curBatch & mask) {
-            networkOutputs[nb] = m_env.batchNetworks[nb]->execute();
-        }
+void CLDNNInferRequest::setPartialInput(cldnn::network& network, const cldnn::engine& engine,
+                                        const cldnn::primitive_id &inputName, const Blob &inputBlob,
+                                        cldnn::layout inputLayout, size_t offset, size_t n) {
+    switch (inputBlob.precision()) {
+    case Precision::FP32: {
+        float* blob_ptr = const_cast<float*>(inputBlob.cbuffer().as<const float*>()) + offset;
+        network.set_input_data(inputName, attachInputMemory(engine, m_hostUnifiedMemory, inputLayout, blob_ptr, n));
+        break;
+    }
+    case Precision::FP16: {
+        uint16_t* blob_ptr = const_cast<uint16_t*>(inputBlob.cbuffer().as<const uint16_t*>()) + offset;
+        network.set_input_data(inputName, attachInputMemory(engine, m_hostUnifiedMemory, inputLayout, blob_ptr, n));
+        break;
+    }
+    case Precision::U8: {
+        uint8_t* blob_ptr = const_cast<uint8_t*>(inputBlob.cbuffer().as<const uint8_t*>()) + offset;
+        network.set_input_data(inputName, attachInputMemory(engine, m_hostUnifiedMemory, inputLayout, blob_ptr, n));
+        break;
+    }
+    case Precision::I16: {
+        // clDNN doesn't support I16 input precision, the micro batch is converted to fp32
+        inputLayout.data_type = cldnn::data_types::f32;
+        std::vector<float> fp32(n);
+        const int16_t* blob_ptr = inputBlob.cbuffer().as<const int16_t*>() + offset;
+        std::copy(blob_ptr, blob_ptr + n, fp32.begin());
+        network.set_input_data(inputName, cldnn::memory::attach(inputLayout, fp32.data(), n));
+        break;
     }
+    default:
+        THROW_IE_EXCEPTION << "The plugin does not support input " << inputBlob.precision() << " precision";
+    }
+}
 
-    // now try to get execution results
-    for (unsigned nb = 0; nb < m_env.m_bv_sz; nb++) {
-        unsigned int mask = 1 << nb;
+void CLDNNInferRequest::CollectProfilingInfo(const cldnn::network& network) {
+    if (!m_profilingResolved) {
+        std::map<cldnn::primitive_id, cldnn::event> executedPrimitives = network.get_executed_primitives();
+        auto allPrimitives = network.get_all_primitives();
 
-        if (m_curBatch & mask) {
-            for (auto& no : _networkOutputs) {
-                std::string outputID = no.first;
-                while ((m_env.primitiveIDs.find(outputID) != m_env.primitiveIDs.end()) &&
-                    (m_env.primitiveIDs.at(outputID) != outputID)) {
-                    outputID = m_env.primitiveIDs.at(outputID);
-                }
+        // Change status if layer wasn't executed by cldnn engine
+        for (auto &entry : m_profilingTable) {
+            if (executedPrimitives.find(entry.id) != executedPrimitives.end()) {
+                continue;
+            }
+            if (allPrimitives.find(entry.id) != allPrimitives.end() &&
+                allPrimitives.at(entry.id) == "_optimized_") {
+                // Layer was marked as optimized by cldnn
+                entry.status = InferenceEngineProfileInfo::OPTIMIZED_OUT;
+            } else {
+                // Layer wasn't run for some reason
+                entry.status = InferenceEngineProfileInfo::NOT_RUN;
+            }
+        }
+        m_profilingResolved = true;
+    }
 
-                auto outputMemory = networkOutputs[nb].at(outputID).get_memory();
-                Blob::Ptr bptr = _outputs[no.first];
+    for (auto &entry : m_profilingTable) {
+        if (entry.status == InferenceEngineProfileInfo::OPTIMIZED_OUT ||
+            entry.status == InferenceEngineProfileInfo::NOT_RUN) {
+            continue;
+        }
 
-                copyOutputData(outputMemory, bptr, &batchOutputs[no.first][nb]);
+        // Collect timings
+        for (auto &interval : network.get_primitive_event(entry.id).get_profiling_info()) {
+            using duration_t = std::chrono::duration<long long, std::chrono::microseconds::period>;
+            auto count = std::chrono::duration_cast<duration_t>(interval.value->value()).count();
+
+            if (interval.name == "submission") {
+                entry.cpu_uSec = count;
+            } else if (interval.name == "executing") {
+                entry.realTime_uSec = count;
+            } else if (interval.name == "duration") {  // "duration" is used for CPU layers
+                entry.cpu_uSec = count;
+                entry.cpuExecuted = true;
             }
         }
     }
@@ -535,19 +692,43 @@ void CLDNNInferRequest::InferImpl() {
     // execute input pre-processing.
     execDataPreprocessing();
 
-    for (auto &item : _inputs) {
-        if (m_env.m_max_batch > 1) {
-            PrepareInputDyn(item.first, *item.second);
-        } else {
-            PrepareInput(item.first, *item.second);
+    if (m_env.m_micro_batches > 1) {
+        execMicroBatches();
+        return;
+    }
+    if (m_curBatch > 0) {
+        for (size_t i = 0; i < m_env.batchNetworks.size(); i++) {
+            if ((1 << i) >= m_curBatch) {
+                execBatchNetwork(i);
+                return;
+            }
         }
     }
 
+    for (auto &item : _inputs) {
+        auto frameBlob = m_frameBlobs.find(item.first);
+        PrepareInput(item.first, frameBlob == m_frameBlobs.end() ? getDenseInput(item.first, item.second)
+                                                                 : *frameBlob->second);
+    }
+    _timings.mark(&InferRequestTimings::preprocessed_uSec);
+
     // The actual inference
-    if (m_env.m_max_batch > 1) {
-        execAndParseDyn();
-    } else {
-        execAndParse();
+    execAndParse();
+}
+
+void CLDNNInferRequest::Postprocess() {
+    IE_PROFILING_AUTO_SCOPE(CLDNN_PullOutputs)
+    bool copied = false;
+    for (auto& staged : m_stagedOutputs) {
+        if (!staged.second.pending) {
+            continue;
+        }
+        staged.second.pending = false;
+        copyOutputData(staged.second.layout, staged.second.data.data(), _outputs[staged.first], &staged.second.bi);
+        copied = true;
+    }
+    if (copied) {
+        _timings.mark(&InferRequestTimings::outputsCopied_uSec);
     }
 }
 
@@ -557,14 +738,30 @@ void CLDNNInferRequest::GetPerformanceCounts(
         THROW_IE_EXCEPTION << "Performance counters were not enabled";
     } else {
         perfMap = m_env.perfMap;
+        static const std::string cpuExecType("CPU");
+        for (auto &entry : m_profilingTable) {
+            auto &info = perfMap[entry.id];
+            info.status = entry.status;
+            info.cpu_uSec = entry.cpu_uSec;
+            info.realTime_uSec = entry.realTime_uSec;
+            if (entry.cpuExecuted) {
+                memset(info.exec_type, 0, sizeof(info.exec_type));
+                cpuExecType.copy(info.exec_type, cpuExecType.length());  // Override execType as CPU
+            }
+        }
     }
 }
 
 void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
+    IE_PROFILING_AUTO_SCOPE(CLDNN_PrepareInput)
     // Get input layout
     if (m_env.inputLayouts.find(inputName) == m_env.inputLayouts.end()) {
         THROW_IE_EXCEPTION << "Input name mismatch.";
     }
+    if (m_env.frameInputs.find(inputName) != m_env.frameInputs.end()) {
+        PrepareFrameInput(inputName, inputBlob);
+        return;
+    }
     auto inputLayout = m_env.inputLayouts.at(inputName);
     auto is_same_buffer = [](const Blob& blob, const cldnn::memory& memory) -> bool {
         const std::string str_not_allocated("Input data was not allocated.");
@@ -577,6 +774,16 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
         return (blob_ptr == mem_ptr) && (blob.byteSize() == memory.size());
     };
 
+    if (auto clBlob = dynamic_cast<const CLBufferBlob*>(&inputBlob)) {
+        // The buffer of the shared context is the input of the network, no data are copied.
+        if (inputBlob.precision() == Precision::I16) {
+            THROW_IE_EXCEPTION << "Unsupported input precision " << inputBlob.precision() << " of the OpenCL buffer blob";
+        }
+        m_env.network->set_input_data(inputName,
+            cldnn::memory::attach_cl_buffer(*m_env.engine, inputLayout, clBlob->getCLBuffer()));
+        return;
+    }
+
     const cldnn::memory& memory = inputsMemory.at(inputName);
     if (inputBlob.precision() == Precision::I16) {
         // clDNN doesn't support I16 input precision, so we always have to convert input data to fp32 precision
@@ -602,17 +809,45 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
     }
 }
 
-void CLDNNInferRequest::PrepareInputDyn(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
-    // now try to get execution results
-    for (unsigned nb = 0; nb < m_env.m_bv_sz; nb++) {
-        unsigned int mask = 1 << nb;
+void CLDNNInferRequest::PrepareFrameInput(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
+    const auto& frameInput = m_env.frameInputs.at(inputName);
+    const BlockingDesc& blocking = inputBlob.getTensorDesc().getBlockingDesc();
+    const SizeVector& dims = inputBlob.getTensorDesc().getDims();
+    const uint8_t* blob_ptr = inputBlob.cbuffer().as<const uint8_t*>();
+    if (blob_ptr == nullptr) {
+        THROW_IE_EXCEPTION << "Input data was not allocated.";
+    }
 
-        if (m_curBatch & mask) {
-            auto inputLayout = m_env.inputLayouts.at(inputName);
-            inputLayout.size.batch[0] = mask;
-            copyInputData(m_env.batchNetworks[nb], inputName, inputLayout, inputBlob, &batchInputs[inputName][nb]);
-        }
+    // the strides of N, C, H and W, the ROI blob keeps the ones of the frame it is a part of
+    SizeVector strides(4);
+    size_t span = 1;
+    for (size_t i = 0; i < 4; i++) {
+        strides[blocking.getOrder()[i]] = blocking.getStrides()[i];
+    }
+    for (size_t i = 0; i < 4; i++) {
+        span += (dims[i] - 1) * strides[i];
+    }
+    const cldnn::memory& frameMemory = inputsMemory.at(inputName);
+    if (span > frameInput.frameLayout.count()) {
+        THROW_IE_EXCEPTION << "The frame of the input " << inputName << " is larger than the one of the "
+                           << CLDNNConfigParams::KEY_CLDNN_DEVICE_PREPROCESSING << " key";
+    }
+
+    const size_t elementSize = inputBlob.element_size();
+    {
+        cldnn::pointer<uint8_t> ptr = frameMemory.pointer<uint8_t>();
+        std::memcpy(ptr.data(), blob_ptr + blocking.getOffsetPadding() * elementSize, span * elementSize);
+    }
+    const cldnn::memory& paramsMemory = inputsMemory.at(frameInput.paramsID);
+    {
+        cldnn::pointer<int32_t> ptr = paramsMemory.pointer<int32_t>();
+        const int32_t params[] = { static_cast<int32_t>(dims[3]), static_cast<int32_t>(dims[2]),
+                                   static_cast<int32_t>(strides[0]), static_cast<int32_t>(strides[1]),
+                                   static_cast<int32_t>(strides[2]), static_cast<int32_t>(strides[3]) };
+        std::copy(std::begin(params), std::end(params), ptr.data());
     }
+    m_env.network->set_input_data(inputName, frameMemory);
+    m_env.network->set_input_data(frameInput.paramsID, paramsMemory);
 }
 
 };  // namespace CLDNNPlugin
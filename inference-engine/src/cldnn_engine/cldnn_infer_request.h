@@ -25,11 +25,20 @@ class CLDNNInferRequest : public InferenceEngine::InferRequestInternal {
 public:
     void InferImpl() override;
 
+    /**
+     * @brief Writes the outputs read from the device by the pipelined inference to the blobs
+     */
+    void Postprocess() override;
+
     void
     GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
+    /**
+     * @param pipelinedOutputs - the outputs of the pipelined inference are copied to the blobs by Postprocess()
+     */
     CLDNNInferRequest(InferenceEnv env, bool useProfiling,
-                      InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs);
+                      InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs,
+                      bool pipelinedOutputs = false);
 
     CLDNNInferRequest(const CLDNNInferRequest &) = delete;
 
@@ -37,36 +46,89 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    /**
+     * @brief Keeps the blob of the input pre-processed by the device as the frame, the ROI of any size which fits
+     * into the frame given by KEY_CLDNN_DEVICE_PREPROCESSING is resized by the network
+     */
+    void SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) override;
+
+    void GetBlob(const char *name, InferenceEngine::Blob::Ptr &data) override;
+
 protected:
     std::map<std::string, cldnn::memory> inputsMemory;
     std::map<std::string, cldnn::primitive_id> outputsMap;
-    std::map<cldnn::primitive_id, std::string> implementationsMap;
+    // the pinned host memory of the output blobs of the discrete device, the pointer stays the same
+    struct StagingOutput {
+        cldnn::memory memory;
+        uint8_t* data;
+    };
+    std::map<std::string, StagingOutput> outputsStaging;
     bool m_useProfiling;
+    // the counters of the profiled primitive, the inference updates the times only and GetPerformanceCounts()
+    // builds the map of the counters
+    struct ProfilingEntry {
+        cldnn::primitive_id id;
+        InferenceEngine::InferenceEngineProfileInfo::LayerStatus status;
+        long long cpu_uSec;
+        long long realTime_uSec;
+        // the primitive is executed by the CPU
+        bool cpuExecuted;
+    };
+    std::vector<ProfilingEntry> m_profilingTable;
+    // the statuses of the primitives are found by the first inference, the executed primitives are the same later
+    bool m_profilingResolved;
     InferenceEnv m_env;
+    // the device shares the memory with the host, the aligned input blobs of the user are not copied
+    bool m_hostUnifiedMemory;
 
-    // dynamic batch stuff
+    // the batch set by SetBatch, -1 if the dynamic batch is not set
     int m_curBatch;
-    std::map<std::string, std::vector<buf_info>> batchInputs;
-    std::map<std::string, std::vector<buf_info>> batchOutputs;
+
+    // the device data of the output read by the pipelined inference, the next inference of the stream overwrites
+    // the output memory of the network while Postprocess() writes the blob
+    struct StagedOutput {
+        cldnn::layout layout = cldnn::layout(cldnn::data_types::f32, cldnn::format::bfyx, {});
+        std::vector<uint8_t> data;
+        buf_info bi = { 0, 0 };
+        bool pending = false;
+    };
+    bool m_pipelinedOutputs;
+    std::map<std::string, StagedOutput> m_stagedOutputs;
+
+    // the blobs set to the inputs pre-processed by the device, the default blobs of _inputs are used otherwise
+    std::map<std::string, InferenceEngine::Blob::Ptr> m_frameBlobs;
+    // the dense copies of the inputs set as the strided or the offset views
+    std::map<std::string, InferenceEngine::Blob::Ptr> m_denseInputs;
+
+    const InferenceEngine::Blob &getDenseInput(const std::string &name, const InferenceEngine::Blob::Ptr &blob);
 
     InferenceEngine::Blob::Ptr createInputBlob(const InferenceEngine::Precision& p, const InferenceEngine::Layout& l,
                                                const InferenceEngine::SizeVector& sz, uint8_t* mem_ptr = nullptr);
     InferenceEngine::Blob::Ptr createOutputBlob(const InferenceEngine::Precision& p, InferenceEngine::SizeVector& sz,
                                                 uint8_t* mem_ptr = nullptr);
     void copyOutputData(const cldnn::memory& outputMemory, InferenceEngine::Blob::Ptr bptr, buf_info* bi = nullptr);
+    void copyOutputData(const cldnn::layout& layout, const uint8_t* data, InferenceEngine::Blob::Ptr bptr,
+                        buf_info* bi = nullptr);
     void copyInputData(std::shared_ptr<cldnn::network> network, const cldnn::primitive_id &inputName,
-                                                const cldnn::layout& inputLayout, const InferenceEngine::Blob &inputBlob,
-                                                buf_info* bi = nullptr);
+                                                const cldnn::layout& inputLayout, const InferenceEngine::Blob &inputBlob);
 
     void AllocateInputs();
     void AllocateOutputs();
-    void AllocateInputsDyn();
-    void AllocateOutputsDyn();
     void execAndParse();
-    void execAndParseDyn();
+    // infers the micro batches of the inputs by the two networks of m_env in turn
+    void execMicroBatches();
+    void setMicroBatchInput(cldnn::network& network, const cldnn::engine& engine,
+                            const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob, int microBatch);
+    // attaches n values of the blob from the offset as the input of the layout
+    void setPartialInput(cldnn::network& network, const cldnn::engine& engine, const cldnn::primitive_id &inputName,
+                         const InferenceEngine::Blob &inputBlob, cldnn::layout inputLayout, size_t offset, size_t n);
+    // infers the current batch by the network of m_env.batchNetworks of the index
+    void execBatchNetwork(size_t index);
+    void CollectProfilingInfo(const cldnn::network& network);
 
     void PrepareInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
-    void PrepareInputDyn(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    // copies the ROI of the blob to the frame of the input and writes its size and strides to the parameters
+    void PrepareFrameInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
 
 private:
     static const std::string fp32_suffix;
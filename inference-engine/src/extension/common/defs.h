@@ -5,7 +5,7 @@
 
 #pragma once
 
-#if defined (HAVE_SSE) || defined (HAVE_AVX2)
+#if defined (HAVE_SSE) || defined (HAVE_AVX2) || defined (HAVE_AVX512F)
 #if defined (_WIN32)
 #include <emmintrin.h>
 #else
@@ -23,6 +23,42 @@
 #define FAST_EXP_P4 0.999999881f
 #define FAST_EXP_P5 1.0f
 
+#if defined(HAVE_AVX512F)
+static inline __m512 _avx512_fast_exp_ps(__m512 vsrc) {
+    __m512 vc_exp_c1 = _mm512_set1_ps(FAST_EXP_C1);
+    __m512 vc_exp_c2 = _mm512_set1_ps(FAST_EXP_C2);
+    __m512 vc_log2e  = _mm512_set1_ps(LOG2EF);
+    __m512 vc_log2   = _mm512_set1_ps(LOG2);
+
+    __m512 vc_exp_p0 = _mm512_set1_ps(FAST_EXP_P0);
+    __m512 vc_exp_p1 = _mm512_set1_ps(FAST_EXP_P1);
+    __m512 vc_exp_p2 = _mm512_set1_ps(FAST_EXP_P2);
+    __m512 vc_exp_p3 = _mm512_set1_ps(FAST_EXP_P3);
+    __m512 vc_exp_p4 = _mm512_set1_ps(FAST_EXP_P4);
+    __m512 cv_exp_p5 = _mm512_set1_ps(FAST_EXP_P5);
+
+    __m512 vc_exp_hi = _mm512_set1_ps(FAST_EXP_HI);
+    __m512 vc_exp_lo = _mm512_set1_ps(FAST_EXP_LO);
+
+    vsrc = _mm512_max_ps(_mm512_min_ps(vsrc, vc_exp_hi), vc_exp_lo);
+
+    __m512 fx = _mm512_fmadd_ps(vsrc, vc_log2e, vc_exp_c1);
+    __m512 fx_ = _mm512_sub_ps(fx, vc_exp_c1);
+    __m512i msk = _mm512_slli_epi32(_mm512_castps_si512(fx), 23);
+
+    __m512 q = _mm512_fnmadd_ps(fx_, vc_log2, vsrc);
+    __m512 y = _mm512_fnmadd_ps(fx_, vc_exp_p0, q);
+           q = _mm512_fmadd_ps(vc_exp_c2, y, vc_exp_p1);
+           q = _mm512_fmadd_ps(y, q, vc_exp_p2);
+           q = _mm512_fmadd_ps(y, q, vc_exp_p3);
+           q = _mm512_fmadd_ps(y, q, vc_exp_p4);
+           q = _mm512_fmadd_ps(y, q, cv_exp_p5);
+
+    __m512 vexp = _mm512_castsi512_ps(_mm512_add_epi32(_mm512_castps_si512(q), msk));
+    return vexp;
+}
+#endif
+
 #if defined(HAVE_AVX2)
 static inline __m256 _avx_fast_exp_ps(__m256 vsrc) {
     __m256 vc_exp_c1 = _mm256_set1_ps(FAST_EXP_C1);
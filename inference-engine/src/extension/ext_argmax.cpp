@@ -12,6 +12,9 @@
 #include <cmath>
 #include <utility>
 #include <functional>
+#include <limits>
+#include "ie_parallel.hpp"
+#include "common/defs.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -31,6 +34,17 @@ public:
             axis_index_ = has_axis_ ?
                                 std::stoi(layer->params.at("axis")) :0;
 
+            // the argmax over the channels reads the blocked input as well, the output of a single channel is planar
+            const size_t in_rank = layer->insData[0].lock()->getTensorDesc().getDims().size();
+            const int axis = axis_index_ < 0 ? axis_index_ + static_cast<int>(in_rank) : axis_index_;
+            if (has_axis_ && axis == 1 && top_k_ == 1 && in_rank == 4) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(ConfLayout::PLN)});
+            }
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
@@ -56,38 +70,136 @@ public:
         float* dst_data = outputs[0]->buffer();
 
         int num = count(in_dims) / dim;
-        std::vector<std::pair<float, int> > src_vector(dim);
 
-        for (int i = 0; i < num; ++i) {
-            for (int j = 0; j < dim; ++j) {
-                src_vector[j] = std::make_pair(
-                        src_data[(i / axis_dist * dim + j) * axis_dist + i % axis_dist], j);
-            }
+        const auto &blocking = inputs[0]->getTensorDesc().getBlockingDesc();
+        if (blocking.getBlockDims().size() > in_dims.size()) {
+            argmax_blk(src_data, dst_data, num / axis_dist, dim, axis_dist,
+                       static_cast<int>(blocking.getBlockDims().back()));
+        } else if (top_k_ == 1 && has_axis_) {
+            argmax_one(src_data, dst_data, num / axis_dist, dim, axis_dist);
+        } else {
+            argmax_top_k(src_data, dst_data, num, dim, axis_dist);
+        }
 
-            std::partial_sort(src_vector.begin(), src_vector.begin() + top_k_,
-                              src_vector.end(), std::greater<std::pair<float, int> >());
+        return OK;
+    }
 
-            for (int j = 0; j < top_k_; ++j) {
-                if (out_max_val_) {
-                    if (has_axis_) {
-                        // Produces max_val per axis
-                        dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].first;
-                    } else {
-                        // Produces max_ind and max_val
-                        dst_data[2 * i * top_k_ + j] = src_vector[j].second;
-                        dst_data[2 * i * top_k_ + top_k_ + j] = src_vector[j].first;
+private:
+    // the positions of the inner dimensions processed together, the running maximums of the block stay in the cache
+    static const int positions_block = 256;
+
+    // the planar argmax along the axis: the positions behind the axis are contiguous, so the running maximums of
+    // the block of the positions are updated by the vector compares and blends
+    void argmax_one(const float* src_data, float* dst_data, int outer, int dim, int axis_dist) {
+        const int blocks = (axis_dist + positions_block - 1) / positions_block;
+        parallel_for2d(outer, blocks, [&](int o, int b) {
+            const int start = b * positions_block;
+            const int len = std::min(positions_block, axis_dist - start);
+            const float* src = src_data + static_cast<size_t>(o) * dim * axis_dist + start;
+            float max_val[positions_block];
+            int max_idx[positions_block];
+            for (int s = 0; s < len; s++) {
+                max_val[s] = src[s];
+                max_idx[s] = 0;
+            }
+            for (int j = 1; j < dim; j++) {
+                const float* psrc = src + static_cast<size_t>(j) * axis_dist;
+                // the later one of the equal values wins, as the pairs sorted by the value and the index do
+                DLSDK_EXT_IVDEP()
+                for (int s = 0; s < len; s++) {
+                    const bool greater = psrc[s] >= max_val[s];
+                    max_val[s] = greater ? psrc[s] : max_val[s];
+                    max_idx[s] = greater ? j : max_idx[s];
+                }
+            }
+            float* dst = dst_data + static_cast<size_t>(o) * axis_dist + start;
+            for (int s = 0; s < len; s++)
+                dst[s] = out_max_val_ ? max_val[s] : static_cast<float>(max_idx[s]);
+        });
+    }
+
+    // the argmax over the channels of nChw8c/nChw16c: the running maximums of the lanes of the block go through
+    // the full blocks of the channels, then the lanes and the channels of the last padded block are reduced
+    void argmax_blk(const float* src_data, float* dst_data, int N, int C, int HW, int blk_size) {
+        const int CB = (C + blk_size - 1) / blk_size;
+        const int full_blocks = C / blk_size;
+        parallel_for2d(N, HW, [&](int n, int s) {
+            const float* src = src_data + (static_cast<size_t>(n) * CB * HW + s) * blk_size;
+            const size_t blk_stride = static_cast<size_t>(HW) * blk_size;
+            float max_val = -std::numeric_limits<float>::infinity();
+            int max_idx = 0;
+            if (full_blocks > 0) {
+                float lane_val[16];
+                int lane_blk[16];
+                for (int c = 0; c < blk_size; c++) {
+                    lane_val[c] = src[c];
+                    lane_blk[c] = 0;
+                }
+                for (int cb = 1; cb < full_blocks; cb++) {
+                    const float* psrc = src + cb * blk_stride;
+                    DLSDK_EXT_IVDEP()
+                    for (int c = 0; c < blk_size; c++) {
+                        const bool greater = psrc[c] >= lane_val[c];
+                        lane_val[c] = greater ? psrc[c] : lane_val[c];
+                        lane_blk[c] = greater ? cb : lane_blk[c];
+                    }
+                }
+                max_val = lane_val[0];
+                for (int c = 0; c < blk_size; c++) {
+                    const int idx = lane_blk[c] * blk_size + c;
+                    if (lane_val[c] > max_val || (lane_val[c] == max_val && idx > max_idx)) {
+                        max_val = lane_val[c];
+                        max_idx = idx;
                     }
-                } else {
-                    // Produces max_ind per axis
-                    dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].second;
                 }
             }
-        }
+            const float* tail = src + full_blocks * blk_stride;
+            for (int c = full_blocks * blk_size; c < C; c++) {
+                const float value = tail[c - full_blocks * blk_size];
+                if (value >= max_val) {
+                    max_val = value;
+                    max_idx = c;
+                }
+            }
+            dst_data[static_cast<size_t>(n) * HW + s] = out_max_val_ ? max_val : static_cast<float>(max_idx);
+        });
+    }
 
-        return OK;
+    // the top k of every position: the k largest pairs of the value and the index are selected in the linear time,
+    // only they are sorted
+    void argmax_top_k(const float* src_data, float* dst_data, int num, int dim, int axis_dist) {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            std::vector<std::pair<float, int> > src_vector(dim);
+            for_1d(ithr, nthr, num, [&](int i) {
+                for (int j = 0; j < dim; ++j) {
+                    src_vector[j] = std::make_pair(
+                            src_data[(i / axis_dist * dim + j) * axis_dist + i % axis_dist], j);
+                }
+
+                if (top_k_ < dim)
+                    std::nth_element(src_vector.begin(), src_vector.begin() + top_k_ - 1,
+                                     src_vector.end(), std::greater<std::pair<float, int> >());
+                std::sort(src_vector.begin(), src_vector.begin() + top_k_, std::greater<std::pair<float, int> >());
+
+                for (int j = 0; j < top_k_; ++j) {
+                    if (out_max_val_) {
+                        if (has_axis_) {
+                            // Produces max_val per axis
+                            dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].first;
+                        } else {
+                            // Produces max_ind and max_val
+                            dst_data[2 * i * top_k_ + j] = src_vector[j].second;
+                            dst_data[2 * i * top_k_ + top_k_ + j] = src_vector[j].first;
+                        }
+                    } else {
+                        // Produces max_ind per axis
+                        dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].second;
+                    }
+                }
+            });
+        });
     }
 
-private:
     bool out_max_val_;
     int top_k_;
     bool has_axis_;
@@ -77,6 +77,10 @@ protected:
     static inline __m512 _mm_uni_sqrt_ps(__m512 vec) {
         return _mm512_sqrt_ps(vec);
     }
+
+    static inline __m512 _mm_uni_max_ps(__m512 vec0, __m512 vec1) {
+        return _mm512_max_ps(vec0, vec1);
+    }
 #elif defined(HAVE_AVX2)
     static inline __m256 _mm_uni_loadu_ps(const float* psrc) {
         return _mm256_loadu_ps(psrc);
@@ -113,6 +117,10 @@ protected:
     static inline __m256 _mm_uni_sqrt_ps(__m256 vec) {
         return _mm256_sqrt_ps(vec);
     }
+
+    static inline __m256 _mm_uni_max_ps(__m256 vec0, __m256 vec1) {
+        return _mm256_max_ps(vec0, vec1);
+    }
 #endif
 };
 
@@ -9,6 +9,8 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include "ie_parallel.hpp"
+#include "common/defs.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -47,31 +49,21 @@ public:
         size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
         size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
 
-        // Fill output_sequences with -1
-        for (size_t ii = 0; ii < T_*N_; ii++) {
-            output_sequences[ii] = -1;
-        }
+        // the sequences of the batch are decoded independently
+        parallel_for(N_, [&](size_t n) {
+            // Fill output_sequences with -1
+            for (size_t ii = n*T_; ii < (n + 1)*T_; ii++) {
+                output_sequences[ii] = -1;
+            }
 
-        for (int n = 0; n < N_; ++n) {
             int prev_class_idx = -1;
             size_t output_index = n*T_;
 
-            for (int t = 0; /* check at end */; ++t) {
+            for (size_t t = 0; /* check at end */; ++t) {
                 // get maximum probability and its index
-                int max_class_idx = 0;
-
-                const float* probs = probabilities + t*C_*N_ + n*C_;
-                float max_prob = probs[0];
-                ++probs;
-
-                for (int c = 1; c < C_; ++c, ++probs) {
-                    if (*probs > max_prob) {
-                        max_class_idx = c;
-                        max_prob = *probs;
-                    }
-                }
+                const int max_class_idx = argmax(probabilities + t*C_*N_ + n*C_, static_cast<int>(C_));
 
-                if (max_class_idx < C_-1 && max_class_idx != prev_class_idx) {
+                if (max_class_idx < static_cast<int>(C_) - 1 && max_class_idx != prev_class_idx) {
                     output_sequences[output_index] =  max_class_idx;
                     output_index++;
                 }
@@ -82,9 +74,59 @@ public:
                     break;
                 }
             }
-        }
+        });
         return OK;
     }
+
+private:
+    static const int lanes = 8;
+
+    // the index of the first maximum: the lanes keep their first maximums over the rows of the lanes,
+    // the loop over the lanes is vectorized, then the lanes and the tail are reduced
+    static int argmax(const float* probs, int C) {
+        const int rows = C / lanes;
+        if (rows < 2) {
+            int max_class_idx = 0;
+            for (int c = 1; c < C; ++c) {
+                if (probs[c] > probs[max_class_idx])
+                    max_class_idx = c;
+            }
+            return max_class_idx;
+        }
+
+        float lane_max[lanes];
+        int lane_row[lanes];
+        for (int l = 0; l < lanes; l++) {
+            lane_max[l] = probs[l];
+            lane_row[l] = 0;
+        }
+        for (int r = 1; r < rows; r++) {
+            const float* row = probs + r * lanes;
+            DLSDK_EXT_IVDEP()
+            for (int l = 0; l < lanes; l++) {
+                const bool greater = row[l] > lane_max[l];
+                lane_max[l] = greater ? row[l] : lane_max[l];
+                lane_row[l] = greater ? r : lane_row[l];
+            }
+        }
+
+        float max_prob = lane_max[0];
+        int max_class_idx = lane_row[0] * lanes;
+        for (int l = 1; l < lanes; l++) {
+            const int idx = lane_row[l] * lanes + l;
+            if (lane_max[l] > max_prob || (lane_max[l] == max_prob && idx < max_class_idx)) {
+                max_prob = lane_max[l];
+                max_class_idx = idx;
+            }
+        }
+        for (int c = rows * lanes; c < C; ++c) {
+            if (probs[c] > max_prob) {
+                max_prob = probs[c];
+                max_class_idx = c;
+            }
+        }
+        return max_class_idx;
+    }
 };
 
 REG_FACTORY_FOR(ImplFactory<CTCGreedyDecoderImpl>, CTCGreedyDecoder);
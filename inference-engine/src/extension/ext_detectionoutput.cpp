@@ -12,6 +12,7 @@
 #include <string>
 #include <utility>
 #include <algorithm>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -43,6 +44,7 @@ public:
             _clip = layer->GetParamsAsBool("clip", false);
             _decrease_label_id = layer->GetParamsAsBool("decrease_label_id", false);
             _normalized = layer->GetParamsAsBool("normalized", true);
+            _input_logits = layer->GetParamsAsBool("input_logits", false);
             _image_height = layer->GetParamAsInt("input_height", 1);
             _image_width = layer->GetParamAsInt("input_width", 1);
             _prior_size = _normalized ? 4 : 5;
@@ -105,6 +107,18 @@ public:
             _num_priors_actual = InferenceEngine::make_shared_blob<int>({Precision::UNSPECIFIED, num_priors_actual_size, C});
             _num_priors_actual->allocate();
 
+            if (_input_logits) {
+                // a class passes the threshold only if its logit is close enough to the maximal one, as the
+                // softmax is at most the exponent of their difference, the margin keeps the rounded ones
+                _use_logits_bound = _confidence_threshold > 0.0f;
+                if (_use_logits_bound)
+                    _logits_bound = std::log(_confidence_threshold) - logits_bound_margin;
+
+                InferenceEngine::SizeVector survivors_size{static_cast<size_t>(_num), static_cast<size_t>(_num_priors)};
+                _survivors = InferenceEngine::make_shared_blob<int>({Precision::UNSPECIFIED, survivors_size, NC});
+                _survivors->allocate();
+            }
+
             addConfig(layer, {DataConfigurator(ConfLayout::PLN),
                        DataConfigurator(ConfLayout::PLN),
                        DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
@@ -134,12 +148,55 @@ public:
         const float *prior_variances = prior_data + _num_priors*_prior_size;
         const float *ppriors = prior_data;
 
+        const int *survivors_data = nullptr;
+        if (_input_logits) {
+            // the softmax of the logits is computed only for the priors whose classes may pass the threshold,
+            // the boxes of the others are not decoded
+            int *psurvivors = _survivors->buffer();
+            parallel_for2d(N, _num_priors, [&](int n, int p) {
+                const float *plogits = conf_data + n*_num_priors*_num_classes + p*_num_classes;
+                float *pconf = reordered_conf_data + n*_num_priors*_num_classes + p;
+
+                float max_logit = -FLT_MAX;
+                float max_object_logit = -FLT_MAX;
+                for (int c = 0; c < _num_classes; ++c) {
+                    max_logit = std::max(max_logit, plogits[c]);
+                    if (c != _background_label_id)
+                        max_object_logit = std::max(max_object_logit, plogits[c]);
+                }
+
+                int survivor = !_use_logits_bound || max_object_logit - max_logit > _logits_bound;
+                psurvivors[n*_num_priors + p] = survivor;
+                if (!survivor) {
+                    for (int c = 0; c < _num_classes; ++c)
+                        pconf[c*_num_priors] = 0.0f;
+                    return;
+                }
+
+                float sum = 0.0f;
+                for (int c = 0; c < _num_classes; ++c) {
+                    pconf[c*_num_priors] = std::exp(plogits[c] - max_logit);
+                    sum += pconf[c*_num_priors];
+                }
+                for (int c = 0; c < _num_classes; ++c)
+                    pconf[c*_num_priors] /= sum;
+            });
+            survivors_data = psurvivors;
+        } else {
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                for (int p = 0; p < _num_priors; ++p) {
+                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
+                }
+            });
+        }
+
         for (int n = 0; n < N; ++n) {
+            const int *psurvivors = survivors_data ? survivors_data + n*_num_priors : nullptr;
             if (_share_location) {
                 const float *ploc = loc_data + n*4*_num_priors;
                 float *pboxes = decoded_bboxes_data + n*4*_num_priors;
                 float *psizes = bbox_sizes_data + n*_num_priors;
-                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
+                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, psurvivors);
             } else {
                 for (int c = 0; c < _num_loc_classes; ++c) {
                     if (c == _background_label_id) {
@@ -149,49 +206,41 @@ public:
                     const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
                     float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
                     float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
-                }
-            }
-        }
-
-        for (int n = 0; n < N; ++n) {
-            for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
+                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, psurvivors);
                 }
             }
         }
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-#pragma omp parallel for schedule(static)
-            for (int c = 0; c < _num_classes; ++c) {
-                if (c == _background_label_id) {
-                    // Ignore background class.
-                    continue;
-                }
+        // the classes of all the images are suppressed in parallel, each of them has its own part of the buffers
+        parallel_for2d(N, _num_classes, [&](int n, int c) {
+            if (c == _background_label_id) {
+                // Ignore background class.
+                return;
+            }
 
-                int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                int *pbuffer     = buffer_data + c*_num_priors;
-                int *pdetections = detections_data + n*_num_classes + c;
-
-                const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                const float *pboxes;
-                const float *psizes;
-                if (_share_location) {
-                    pboxes = decoded_bboxes_data + n*4*_num_priors;
-                    psizes = bbox_sizes_data + n*_num_priors;
-                } else {
-                    pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                    psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                }
+            int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+            int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+            int *pdetections = detections_data + n*_num_classes + c;
 
-                nms(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+            const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+            const float *pboxes;
+            const float *psizes;
+            if (_share_location) {
+                pboxes = decoded_bboxes_data + n*4*_num_priors;
+                psizes = bbox_sizes_data + n*_num_priors;
+            } else {
+                pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
             }
 
+            nms(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+        });
+
+        for (int n = 0; n < N; ++n) {
+            int detections_total = 0;
+
             for (int c = 0; c < _num_classes; ++c) {
                 detections_total += detections_data[n*_num_classes + c];
             }
@@ -307,6 +356,12 @@ private:
     float _nms_threshold = 0.0f;
     float _confidence_threshold = 0.0f;
 
+    // the confidences are the logits of the classes, their softmax is computed by the layer
+    bool _input_logits = false;
+    bool _use_logits_bound = false;
+    float _logits_bound = 0.0f;
+    const float logits_bound_margin = 1e-3f;
+
     int _num = 0;
     int _num_loc_classes = 0;
     int _num_priors = 0;
@@ -317,7 +372,8 @@ private:
     };
 
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
-                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n);
+                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n,
+                      const int *survivors = nullptr);
 
     void nms(const float *conf_data, const float *bboxes, const float *sizes,
              int *buffer, int *indices, int &detections, int num_priors_actual);
@@ -329,6 +385,7 @@ private:
     InferenceEngine::Blob::Ptr _reordered_conf;
     InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
+    InferenceEngine::Blob::Ptr _survivors;
 };
 
 struct ConfidenceComparator {
@@ -343,42 +400,8 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = std::max(xmin1, xmin2);
-    float intersect_ymin = std::max(ymin1, ymin2);
-    float intersect_xmax = std::min(xmax1, xmax2);
-    float intersect_ymax = std::min(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin;
-    float intersect_height = intersect_ymax - intersect_ymin;
-
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
-    }
-
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
-
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
-}
+// the number of the kept boxes whose overlaps with the candidate are computed before the suppression is checked
+static const int nms_block_size = 16;
 
 void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                    const float *loc_data,
@@ -386,7 +409,8 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                    float *decoded_bboxes,
                                    float *decoded_bbox_sizes,
                                    int* num_priors_actual,
-                                   int n) {
+                                   int n,
+                                   const int *survivors) {
     num_priors_actual[n] = _num_priors;
     if (!_normalized) {
         int num = 0;
@@ -399,8 +423,11 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
         }
     }
 
-    #pragma omp parallel for schedule(static)
-    for (int p = 0; p < num_priors_actual[n]; ++p) {
+    parallel_for(num_priors_actual[n], [&](int p) {
+        // the boxes of the priors whose confidences don't pass the threshold are never read
+        if (survivors && !survivors[p])
+            return;
+
         float new_xmin = 0.0f;
         float new_ymin = 0.0f;
         float new_xmax = 0.0f;
@@ -478,7 +505,7 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
         decoded_bboxes[p*4 + 3] = new_ymax;
 
         decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
-    }
+    });
 }
 
 void DetectionOutputImpl::nms(const float* conf_data,
@@ -502,19 +529,44 @@ void DetectionOutputImpl::nms(const float* conf_data,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    // the kept boxes are stored by coordinates, so the overlaps of a block of them are computed by the vector units
+    std::vector<float> kept(5 * num_output_scores);
+    float *kept_xmin = kept.data();
+    float *kept_ymin = kept_xmin + num_output_scores;
+    float *kept_xmax = kept_ymin + num_output_scores;
+    float *kept_ymax = kept_xmax + num_output_scores;
+    float *kept_size = kept_ymax + num_output_scores;
+
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
+        const float xmin = bboxes[idx*4 + 0];
+        const float ymin = bboxes[idx*4 + 1];
+        const float xmax = bboxes[idx*4 + 2];
+        const float ymax = bboxes[idx*4 + 3];
+        const float size = sizes[idx];
 
+        // the box is suppressed by any kept one, so the blocks are checked until the first overlapping one
         bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
+        for (int k0 = 0; k0 < detections && keep; k0 += nms_block_size) {
+            const int k1 = std::min(detections, k0 + nms_block_size);
+            int suppressed = 0;
+            for (int k = k0; k < k1; ++k) {
+                // the Jaccard overlap, the intersections of the disjoint boxes are not positive
+                float intersect_width  = std::min(xmax, kept_xmax[k]) - std::max(xmin, kept_xmin[k]);
+                float intersect_height = std::min(ymax, kept_ymax[k]) - std::max(ymin, kept_ymin[k]);
+                float intersect_size = intersect_width * intersect_height;
+                float overlap = (intersect_width > 0 && intersect_height > 0)
+                                ? intersect_size / (size + kept_size[k] - intersect_size) : 0.0f;
+                suppressed |= overlap > _nms_threshold;
             }
+            keep = suppressed == 0;
         }
         if (keep) {
+            kept_xmin[detections] = xmin;
+            kept_ymin[detections] = ymin;
+            kept_xmax[detections] = xmax;
+            kept_ymax[detections] = ymax;
+            kept_size[detections] = size;
             indices[detections] = idx;
             detections++;
         }
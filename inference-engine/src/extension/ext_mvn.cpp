@@ -12,6 +12,7 @@
 #include <cassert>
 #include <algorithm>
 #include <immintrin.h>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -38,7 +39,7 @@ public:
 #else
             auto blk_layout = ConfLayout::BLK8;
 #endif
-            addConfig(layer, {{blk_layout, false, -1}}, {{blk_layout, false, 0}});
+            addConfig(layer, {{blk_layout, false, 0}}, {{blk_layout, false, 0}});
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
@@ -70,96 +71,127 @@ private:
     void mvn_pln(const float* src_data, float* dst_data, int N, int C, int H, int W);
     void mvn_blk(const float* src_data, float* dst_data, int N, int C, int H, int W);
 
+#if defined(HAVE_AVX512F)
+    typedef __m512 vec_type;
+    static const int vec_size = 16;
+#elif defined(HAVE_AVX2)
+    typedef __m256 vec_type;
+    static const int vec_size = 8;
+#endif
+
+    // the values summed in float before they are added to the double sums
+    static const size_t sum_block_size = 4096;
+
+    static void shifted_sums(const float* src, size_t size, float shift, double& sum, double& sum2);
+    static void normalize(const float* src, float* dst, size_t size, float mean, float rcp);
+    void statistics(double sum, double sum2, size_t size, float shift, float& mean, float& rcp) const;
+
     bool across_channels = false;
     bool normalize_variance = true;
     float eps = 1e-9f;
 };
 
-void MVNImpl::mvn_pln(const float* src_data, float* dst_data, int N, int C, int H, int W) {
-    for (int b = 0; b < N; b++) {
-        // Calculate mean value
-        if (across_channels) {
-            double mean = 0;
-            #pragma omp parallel for reduction(+ : mean) schedule(static)
-            for (int c = 0; c < C; c++) {
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        mean += src_data[b*C*H*W + c*H*W + h*W + w];
-                    }
-                }
-            }
-            mean /= C*H*W;
-            #pragma omp parallel for schedule(static)
-            for (int c = 0; c < C; c++) {
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] - mean;
-                    }
-                }
-            }
-        } else {
-            #pragma omp parallel for schedule(static)
-            for (int c = 0; c < C; c++) {
-                double mean = 0;
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        mean += src_data[b*C*H*W + c*H*W + h*W + w];
-                    }
-                }
-                mean /= H*W;
+// the statistics are computed in one pass as the sums of the values shifted by one of them and of their squares,
+// the shift keeps E[x^2] - E[x]^2 away from the cancellation for the values far from zero
+void MVNImpl::shifted_sums(const float* src, size_t size, float shift, double& sum, double& sum2) {
+    for (size_t start = 0; start < size; start += sum_block_size) {
+        const size_t end = std::min(size, start + sum_block_size);
+        size_t i = start;
+        float block_sum = 0.f;
+        float block_sum2 = 0.f;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        vec_type vshift = _mm_uni_set1_ps(shift);
+        vec_type vsum = _mm_uni_setzero_ps();
+        vec_type vsum2 = _mm_uni_setzero_ps();
+        for (; i + vec_size <= end; i += vec_size) {
+            vec_type vsrc = _mm_uni_sub_ps(_mm_uni_loadu_ps(src + i), vshift);
+            vsum = _mm_uni_add_ps(vsum, vsrc);
+            vsum2 = _mm_uni_add_ps(vsum2, _mm_uni_mul_ps(vsrc, vsrc));
+        }
 
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] - mean;
-                    }
-                }
-            }
+        float lanes[vec_size];
+        float lanes2[vec_size];
+        _mm_uni_storeu_ps(lanes, vsum);
+        _mm_uni_storeu_ps(lanes2, vsum2);
+        for (int l = 0; l < vec_size; l++) {
+            block_sum += lanes[l];
+            block_sum2 += lanes2[l];
         }
+#endif
+        for (; i < end; i++) {
+            float value = src[i] - shift;
+            block_sum += value;
+            block_sum2 += value * value;
+        }
+        sum += block_sum;
+        sum2 += block_sum2;
     }
+}
+
+void MVNImpl::normalize(const float* src, float* dst, size_t size, float mean, float rcp) {
+    size_t i = 0;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    vec_type vmean = _mm_uni_set1_ps(mean);
+    vec_type vrcp = _mm_uni_set1_ps(rcp);
+    for (; i + vec_size <= size; i += vec_size) {
+        _mm_uni_storeu_ps(dst + i, _mm_uni_mul_ps(_mm_uni_sub_ps(_mm_uni_loadu_ps(src + i), vmean), vrcp));
+    }
+#endif
+    for (; i < size; i++) {
+        dst[i] = (src[i] - mean) * rcp;
+    }
+}
 
+void MVNImpl::statistics(double sum, double sum2, size_t size, float shift, float& mean, float& rcp) const {
+    double shifted_mean = sum / size;
+    mean = static_cast<float>(shift + shifted_mean);
+    rcp = 1.f;
     if (normalize_variance) {
-        for (int b = 0; b < N; b++) {
-            // Calculate variances value
-            if (across_channels) {
-                double variance = 0;
-                #pragma omp parallel for reduction(+ : variance) schedule(static)
-                for (int c = 0; c < C; c++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            variance += std::pow(dst_data[b*C*H*W + c*H*W + h*W + w], 2);
-                        }
-                    }
-                }
-                variance /= C*H*W;
-                variance = std::pow(variance, 0.5f);
-                variance += eps;
-                #pragma omp parallel for schedule(static)
-                for (int c = 0; c < C; c++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            dst_data[b*C*H*W + c*H*W + h*W + w] /= variance;
-                        }
-                    }
-                }
-            } else {
-                #pragma omp parallel for schedule(static)
-                for (int c = 0; c < C; c++) {
-                    double variance = 0;
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            variance += std::pow(dst_data[b*C*H*W + c*H*W + h*W + w], 2);
-                        }
-                    }
-                    variance /= H*W;
-                    variance = std::pow(variance, 0.5f);
-                    variance += eps;
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            dst_data[b*C*H*W + c*H*W + h*W + w] /= variance;
-                        }
-                    }
-                }
+        double variance = std::max(0.0, sum2 / size - shifted_mean * shifted_mean);
+        rcp = 1.f / (static_cast<float>(std::sqrt(variance)) + eps);
+    }
+}
+
+void MVNImpl::mvn_pln(const float* src_data, float* dst_data, int N, int C, int H, int W) {
+    const size_t HW = static_cast<size_t>(H) * W;
+    const size_t CHW = C * HW;
+
+    for (int b = 0; b < N; b++) {
+        const float* src = src_data + b * CHW;
+        float* dst = dst_data + b * CHW;
+
+        if (across_channels) {
+            const float shift = src[0];
+            std::vector<double> partial_sums(2 * parallel_get_max_threads(), 0.0);
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                double sum = 0, sum2 = 0;
+                for_1d(ithr, nthr, C, [&](int c) {
+                    shifted_sums(src + c * HW, HW, shift, sum, sum2);
+                });
+                partial_sums[2 * ithr] = sum;
+                partial_sums[2 * ithr + 1] = sum2;
+            });
+
+            double sum = 0, sum2 = 0;
+            for (size_t i = 0; i < partial_sums.size(); i += 2) {
+                sum += partial_sums[i];
+                sum2 += partial_sums[i + 1];
             }
+
+            float mean, rcp;
+            statistics(sum, sum2, CHW, shift, mean, rcp);
+            parallel_for(C, [&](int c) {
+                normalize(src + c * HW, dst + c * HW, HW, mean, rcp);
+            });
+        } else {
+            parallel_for(C, [&](int c) {
+                double sum = 0, sum2 = 0;
+                shifted_sums(src + c * HW, HW, src[c * HW], sum, sum2);
+
+                float mean, rcp;
+                statistics(sum, sum2, HW, src[c * HW], mean, rcp);
+                normalize(src + c * HW, dst + c * HW, HW, mean, rcp);
+            });
         }
     }
 }
@@ -171,227 +203,120 @@ void MVNImpl::mvn_blk(const float* src_data, float* dst_data, int N, int C, int
     size_t blk_size = 8;
 #endif
 
-#if defined(HAVE_AVX512F)
-    typedef __m512 vec_type;
-#elif defined(HAVE_AVX2)
-    typedef __m256 vec_type;
-#endif
-
     int CB = div_up(C, static_cast<int>(blk_size));
+    const size_t HW = static_cast<size_t>(H) * W;
+    const size_t row_size = W * blk_size;
 
-    if (normalize_variance) {
-        for (int b = 0; b < N; b++) {
-            if (across_channels) {
-                float mean = 0;
-#if _MSC_VER && !__INTEL_COMPILER
-                #pragma omp parallel for reduction(+ : mean) schedule(static)
-#else
-                #pragma omp parallel for collapse(2) reduction(+ : mean) schedule(static)
-#endif
-                for (int cb = 0; cb < CB; cb++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                                size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                                mean += src_data[src_offset];
-                            }
-                        }
-                    }
-                }
-
-                mean /= C * H * W;
+    for (int b = 0; b < N; b++) {
+        const float* src = src_data + b * CB * HW * blk_size;
+        float* dst = dst_data + b * CB * HW * blk_size;
 
-                float variance = 0;
-#if _MSC_VER && !__INTEL_COMPILER
-                #pragma omp parallel for reduction(+ : variance) schedule(static)
-#else
-                #pragma omp parallel for collapse(2) reduction(+ : variance) schedule(static)
-#endif
-                for (int cb = 0; cb < CB; cb++) {
-                    for (int h = 0; h < H; h++) {
+        if (across_channels) {
+            // the rows of the full blocks are contiguous, the padded channels of the last block are skipped
+            const float shift = src[0];
+            std::vector<double> partial_sums(2 * parallel_get_max_threads(), 0.0);
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                double sum = 0, sum2 = 0;
+                for_2d(ithr, nthr, CB, H, [&](int cb, int h) {
+                    const float* psrc = src + (cb * HW + h * W) * blk_size;
+                    const size_t blk = std::min(blk_size, C - cb * blk_size);
+                    if (blk == blk_size) {
+                        shifted_sums(psrc, row_size, shift, sum, sum2);
+                    } else {
                         for (int w = 0; w < W; w++) {
-                            for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                                size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                                variance += std::pow(src_data[src_offset] - mean, 2);
+                            for (size_t c = 0; c < blk; c++) {
+                                double value = psrc[w * blk_size + c] - shift;
+                                sum += value;
+                                sum2 += value * value;
                             }
                         }
                     }
-                }
-
-                variance /= C*H*W;
-                variance = std::pow(variance, 0.5f);
-                variance += eps;
-
-#if _MSC_VER && !__INTEL_COMPILER
-                #pragma omp parallel for schedule(static)
-#else
-                #pragma omp parallel for collapse(2) schedule(static)
-#endif
-                for (int cb = 0; cb < CB; cb++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                                size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
+                });
+                partial_sums[2 * ithr] = sum;
+                partial_sums[2 * ithr + 1] = sum2;
+            });
+
+            double sum = 0, sum2 = 0;
+            for (size_t i = 0; i < partial_sums.size(); i += 2) {
+                sum += partial_sums[i];
+                sum2 += partial_sums[i + 1];
+            }
 
-                                dst_data[src_offset] = (src_data[src_offset] - mean) / variance;
-                            }
+            float mean, rcp;
+            statistics(sum, sum2, static_cast<size_t>(C) * HW, shift, mean, rcp);
+            parallel_for2d(CB, H, [&](int cb, int h) {
+                const size_t offset = (cb * HW + h * W) * blk_size;
+                const size_t blk = std::min(blk_size, C - cb * blk_size);
+                if (blk == blk_size) {
+                    normalize(src + offset, dst + offset, row_size, mean, rcp);
+                } else {
+                    for (int w = 0; w < W; w++) {
+                        for (size_t c = 0; c < blk; c++) {
+                            dst[offset + w * blk_size + c] = (src[offset + w * blk_size + c] - mean) * rcp;
                         }
                     }
                 }
-            } else {
-                #pragma omp parallel for schedule(static)
-                for (int cb = 0; cb < CB; cb++) {
-                    size_t src_off = b*CB*H*W*blk_size + cb*H*W*blk_size;
+            });
+        } else {
+            // the statistics of the channels of a block are computed at once, one lane per channel
+            parallel_for(CB, [&](int cb) {
+                const float* psrc = src + cb * HW * blk_size;
+                float* pdst = dst + cb * HW * blk_size;
+
+                std::vector<double> sums(blk_size, 0.0), sums2(blk_size, 0.0);
+                std::vector<float> block_sums(blk_size), block_sums2(blk_size);
+                std::vector<float> means(blk_size), rcps(blk_size);
+                const float* shifts = psrc;
+
+                for (size_t start = 0; start < HW; start += sum_block_size / blk_size) {
+                    const size_t end = std::min(HW, start + sum_block_size / blk_size);
 #if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                    vec_type vmean = _mm_uni_setzero_ps();
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vmean = _mm_uni_add_ps(vmean, vsrc);
-                        }
-                    }
-
-                    vec_type vsize = _mm_uni_set1_ps(static_cast<float>(H * W));
-                    vmean = _mm_uni_div_ps(vmean, vsize);
-
-                    vec_type vvariance = _mm_uni_setzero_ps();
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vsrc = _mm_uni_sub_ps(vsrc, vmean);
-                            vvariance = _mm_uni_add_ps(vvariance, _mm_uni_mul_ps(vsrc, vsrc));
-                        }
-                    }
-
-                    vvariance = _mm_uni_div_ps(vvariance, vsize);
-                    vvariance = _mm_uni_sqrt_ps(vvariance);
-
-                    vec_type veps = _mm_uni_set1_ps(eps);
-                    vvariance = _mm_uni_add_ps(vvariance, veps);
-
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vsrc = _mm_uni_sub_ps(vsrc, vmean);
-                            _mm_uni_storeu_ps(dst_data + src_off + h*W*blk_size + w*blk_size, _mm_uni_div_ps(vsrc, vvariance));
-                        }
+                    vec_type vshift = _mm_uni_loadu_ps(shifts);
+                    vec_type vsum = _mm_uni_setzero_ps();
+                    vec_type vsum2 = _mm_uni_setzero_ps();
+                    for (size_t i = start; i < end; i++) {
+                        vec_type vsrc = _mm_uni_sub_ps(_mm_uni_loadu_ps(psrc + i * blk_size), vshift);
+                        vsum = _mm_uni_add_ps(vsum, vsrc);
+                        vsum2 = _mm_uni_add_ps(vsum2, _mm_uni_mul_ps(vsrc, vsrc));
                     }
+                    _mm_uni_storeu_ps(&block_sums[0], vsum);
+                    _mm_uni_storeu_ps(&block_sums2[0], vsum2);
 #else
-                    for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                        float mean = 0;
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                mean += src_data[src_off + h*W*blk_size + w*blk_size + c];
-                            }
-                        }
-
-                        mean /= H * W;
-
-                        float variance = 0;
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                float value = src_data[src_off + h*W*blk_size + w*blk_size + c] - mean;
-                                variance += std::pow(value, 2);
-                            }
-                        }
-
-                        variance /= H * W;
-                        variance = std::pow(variance, 0.5f);
-                        variance += eps;
-
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                dst_data[src_off + h*W*blk_size + w*blk_size + c] = (src_data[src_off + h*W*blk_size + w*blk_size + c] - mean) / variance;
-                            }
+                    std::fill(block_sums.begin(), block_sums.end(), 0.f);
+                    std::fill(block_sums2.begin(), block_sums2.end(), 0.f);
+                    for (size_t i = start; i < end; i++) {
+                        for (size_t c = 0; c < blk_size; c++) {
+                            float value = psrc[i * blk_size + c] - shifts[c];
+                            block_sums[c] += value;
+                            block_sums2[c] += value * value;
                         }
                     }
 #endif
-                }
-            }
-        }
-    } else {
-        for (int b = 0; b < N; b++) {
-            if (across_channels) {
-                float mean = 0;
-#if _MSC_VER && !__INTEL_COMPILER
-                #pragma omp parallel for reduction(+ : mean) schedule(static)
-#else
-                #pragma omp parallel for collapse(2) reduction(+ : mean) schedule(static)
-#endif
-                for (int cb = 0; cb < CB; cb++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                                size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                                mean += src_data[src_offset];
-                            }
-                        }
+                    for (size_t c = 0; c < blk_size; c++) {
+                        sums[c] += block_sums[c];
+                        sums2[c] += block_sums2[c];
                     }
                 }
 
-                mean /= C * H * W;
-
-#if _MSC_VER && !__INTEL_COMPILER
-                #pragma omp parallel for schedule(static)
-#else
-                #pragma omp parallel for collapse(2) schedule(static)
-#endif
-                for (int cb = 0; cb < CB; cb++) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                                size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                                dst_data[src_offset] = src_data[src_offset] - mean;
-                            }
-                        }
-                    }
+                for (size_t c = 0; c < blk_size; c++) {
+                    statistics(sums[c], sums2[c], HW, shifts[c], means[c], rcps[c]);
                 }
-            } else {
-                #pragma omp parallel for schedule(static)
-                for (int cb = 0; cb < CB; cb++) {
-                    size_t src_off = b*CB*H*W*blk_size + cb*H*W*blk_size;
-#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                    vec_type vmean = _mm_uni_setzero_ps();
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vmean = _mm_uni_add_ps(vmean, vsrc);
-                        }
-                    }
-
-                    vec_type vsize = _mm_uni_set1_ps(static_cast<float>(H * W));
-                    vmean = _mm_uni_div_ps(vmean, vsize);
 
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            _mm_uni_storeu_ps(dst_data + src_off + h*W*blk_size + w*blk_size, _mm_uni_sub_ps(vsrc, vmean));
-                        }
-                    }
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                vec_type vmean = _mm_uni_loadu_ps(&means[0]);
+                vec_type vrcp = _mm_uni_loadu_ps(&rcps[0]);
+                for (size_t i = 0; i < HW; i++) {
+                    vec_type vsrc = _mm_uni_sub_ps(_mm_uni_loadu_ps(psrc + i * blk_size), vmean);
+                    _mm_uni_storeu_ps(pdst + i * blk_size, _mm_uni_mul_ps(vsrc, vrcp));
+                }
 #else
-                    for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                        float mean = 0;
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                mean += src_data[src_off + h*W*blk_size + w*blk_size + c];
-                            }
-                        }
-
-                        mean /= H * W;
-
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                dst_data[src_off + h*W*blk_size + w*blk_size + c] = src_data[src_off + h*W*blk_size + w*blk_size + c] - mean;
-                            }
-                        }
+                for (size_t i = 0; i < HW; i++) {
+                    for (size_t c = 0; c < blk_size; c++) {
+                        pdst[i * blk_size + c] = (psrc[i * blk_size + c] - means[c]) * rcps[c];
                     }
-#endif
                 }
-            }
+#endif
+            });
         }
     }
 }
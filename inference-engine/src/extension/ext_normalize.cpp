@@ -12,6 +12,7 @@
 #include <map>
 #include <cmath>
 #include <immintrin.h>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -31,7 +32,13 @@ public:
             channel_shared = static_cast<bool>(layer->GetParamAsInt("channel_shared"));
             eps = layer->GetParamAsFloat("eps");
 
+#if defined(HAVE_AVX512F)
+            auto blk_layout = ConfLayout::BLK16;
+#else
+            auto blk_layout = ConfLayout::BLK8;
+#endif
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}}, true);
+            addConfig(layer, {{blk_layout, false, 0}}, {{blk_layout, false, 0}}, true);
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -79,6 +86,12 @@ public:
         const int H = static_cast<int>(dims.size() > 2 ? dims[2] : 1);
         const int W = static_cast<int>(dims.size() > 3 ? dims[3] : 1);
 
+        const BlockingDesc &src_blk = inputs[0]->getTensorDesc().getBlockingDesc();
+        if (src_blk.getBlockDims().size() == 5) {
+            normalize_blk(src, scl, dst, N, C, H, W, static_cast<int>(src_blk.getBlockDims()[4]));
+            return OK;
+        }
+
         const int HW = H*W;
         const int CHW = C*HW;
 
@@ -87,33 +100,38 @@ public:
             float* pdst = dst + n*C*H*W;
 
             if (across_spatial) {
-                float norm = eps;
-                int i = 0;
+                // the squares are summed by the channels in parallel, the sums of the channels are added in double
+                double sum = parallel_sum(C, 0.0, [&](int c) -> double {
+                    const float* psrc_c = psrc + c*H*W;
+                    float sum_c = 0.0f;
+                    int i = 0;
 #if defined(HAVE_AVX2)
-                {
-                    __m256 vsum = _mm256_setzero_ps();
-                    for (; i <= C*H*W-8; i += 8) {
-                        __m256 vsrc = _mm256_loadu_ps(psrc + i);
-                        vsum = _mm256_fmadd_ps(vsrc, vsrc, vsum);
+                    {
+                        __m256 vsum = _mm256_setzero_ps();
+                        for (; i <= H*W-8; i += 8) {
+                            __m256 vsrc = _mm256_loadu_ps(psrc_c + i);
+                            vsum = _mm256_fmadd_ps(vsrc, vsrc, vsum);
+                        }
+                        sum_c += hsum_avx2(vsum);
                     }
-                    norm += hsum_avx2(vsum);
-                }
 #elif defined(HAVE_SSE)
-                {
-                    __m128 vsum = _mm_setzero_ps();
-                    for (; i <= C*H*W-4; i += 4) {
-                        __m128 vsrc = _mm_loadu_ps(psrc + i);
-                        vsum = _mm_add_ps(_mm_mul_ps(vsrc, vsrc), vsum);
+                    {
+                        __m128 vsum = _mm_setzero_ps();
+                        for (; i <= H*W-4; i += 4) {
+                            __m128 vsrc = _mm_loadu_ps(psrc_c + i);
+                            vsum = _mm_add_ps(_mm_mul_ps(vsrc, vsrc), vsum);
+                        }
+                        sum_c += hsum_sse(vsum);
                     }
-                    norm += hsum_sse(vsum);
-                }
 #endif
-                for (; i < C*H*W; i++) {
-                    norm += psrc[i]*psrc[i];
-                }
-                norm = 1.0f / std::sqrt(norm);
+                    for (; i < H*W; i++) {
+                        sum_c += psrc_c[i]*psrc_c[i];
+                    }
+                    return sum_c;
+                });
+                float norm = 1.0f / std::sqrt(eps + static_cast<float>(sum));
 
-                for (int c = 0 ; c < C; c++) {
+                parallel_for(C, [&](int c) {
                     int hw = 0;
 #if defined(HAVE_AVX2)
                     __m256 vnorm_avx = _mm256_set1_ps(norm);
@@ -138,80 +156,142 @@ public:
                         float s = channel_shared ? scl[0] : scl[c];
                         pdst[c*H*W+hw] = psrc[c*H*W+hw] * norm * s;
                     }
-                }
+                });
             } else {
-                int wh = 0;
+                // the norms of the pixels are over their channels, so the blocks of the pixels are independent
+                const int pixel_block = 64;
+                parallel_for((W*H + pixel_block - 1) / pixel_block, [&](int blk) {
+                    int wh = blk * pixel_block;
+                    const int wh_end = std::min(W*H, wh + pixel_block);
 #if defined(HAVE_AVX2)
-                for (; wh <= W*H - 8; wh += 8) {
-                    __m256 vnorm = _mm256_set1_ps(eps);
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
-                        vnorm = _mm256_fmadd_ps(vsrc, vsrc, vnorm);
+                    for (; wh <= wh_end - 8; wh += 8) {
+                        __m256 vnorm = _mm256_set1_ps(eps);
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                            __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
+                            vnorm = _mm256_fmadd_ps(vsrc, vsrc, vnorm);
+                        }
+                        vnorm = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(vnorm));
+
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                            float* pdst_c = pdst + c*W*H;
+
+                            __m256 vscl = _mm256_set1_ps(channel_shared ? scl[0] : scl[c]);
+
+                            __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
+                            __m256 vdst = _mm256_mul_ps(vsrc, vnorm);
+                            vdst = _mm256_mul_ps(vdst, vscl);
+
+                            _mm256_storeu_ps(pdst_c + wh, vdst);
+                        }
                     }
-                    vnorm = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(vnorm));
+#elif defined(HAVE_SSE)
+                    for (; wh <= wh_end - 4; wh += 4) {
+                        __m128 vnorm = _mm_set1_ps(eps);
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                            __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
 
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        float* pdst_c = pdst + c*W*H;
+                            vnorm = _mm_add_ps(_mm_mul_ps(vsrc, vsrc), vnorm);
+                        }
 
-                        __m256 vscl = _mm256_set1_ps(channel_shared ? scl[0] : scl[c]);
+                        vnorm = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(vnorm));
 
-                        __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
-                        __m256 vdst = _mm256_mul_ps(vsrc, vnorm);
-                        vdst = _mm256_mul_ps(vdst, vscl);
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                                  float* pdst_c = pdst + c*W*H;
 
-                        _mm256_storeu_ps(pdst_c + wh, vdst);
-                    }
-                }
-#elif defined(HAVE_SSE)
-                for (; wh <= W*H - 4; wh += 4) {
-                    __m128 vnorm = _mm_set1_ps(eps);
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
+                            __m128 vscl = _mm_set1_ps(channel_shared ? scl[0] : scl[c]);
 
-                        vnorm = _mm_add_ps(_mm_mul_ps(vsrc, vsrc), vnorm);
+                            __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
+                            __m128 vdst = _mm_mul_ps(vsrc, vnorm);
+                            vdst = _mm_mul_ps(vdst, vscl);
+
+                            _mm_storeu_ps(pdst_c + wh, vdst);
+                        }
                     }
+#endif
+                    for (; wh < wh_end; wh++) {
+                        float norm = eps;
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                            norm += psrc_c[wh]*psrc_c[wh];
+                        }
+
+                        norm = 1.0f / std::sqrt(norm);
 
-                    vnorm = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(vnorm));
+                        for (int c = 0; c < C; c++) {
+                            const float* psrc_c = psrc + c*W*H;
+                            float* pdst_c = pdst + c*W*H;
 
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                              float* pdst_c = pdst + c*W*H;
+                            pdst_c[wh] = channel_shared ? (psrc_c[wh] * norm * scl[0]) : (psrc_c[wh] * norm * scl[c]);
+                        }
+                    }
+                });
+            }
+        }
+        return OK;
+    }
 
-                        __m128 vscl = _mm_set1_ps(channel_shared ? scl[0] : scl[c]);
+private:
+    // the channels of a pixel are in the blocks of blk_size, the padded channels of the last block are written as zeros
+    void normalize_blk(const float* src, const float* scl, float* dst, int N, int C, int H, int W, int blk_size) {
+        const int HW = H*W;
+        const int CB = (C + blk_size - 1) / blk_size;
+        std::vector<float> scales(CB * blk_size, 0.f);
+        for (int c = 0; c < C; c++)
+            scales[c] = channel_shared ? scl[0] : scl[c];
 
-                        __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
-                        __m128 vdst = _mm_mul_ps(vsrc, vnorm);
-                        vdst = _mm_mul_ps(vdst, vscl);
+        for (int n = 0; n < N; n++) {
+            const float* psrc = src + static_cast<size_t>(n) * CB * HW * blk_size;
+            float* pdst = dst + static_cast<size_t>(n) * CB * HW * blk_size;
 
-                        _mm_storeu_ps(pdst_c + wh, vdst);
+            if (across_spatial) {
+                double sum = parallel_sum(CB, 0.0, [&](int cb) -> double {
+                    const int blk = std::min(blk_size, C - cb * blk_size);
+                    const float* psrc_cb = psrc + static_cast<size_t>(cb) * HW * blk_size;
+                    float sum_cb = 0.0f;
+                    for (int hw = 0; hw < HW; hw++) {
+                        for (int c = 0; c < blk; c++)
+                            sum_cb += psrc_cb[hw * blk_size + c] * psrc_cb[hw * blk_size + c];
                     }
-                }
-#endif
-                for (; wh < W*H; wh++) {
+                    return sum_cb;
+                });
+                float norm = 1.0f / std::sqrt(eps + static_cast<float>(sum));
+
+                parallel_for(CB, [&](int cb) {
+                    const float* psrc_cb = psrc + static_cast<size_t>(cb) * HW * blk_size;
+                    float* pdst_cb = pdst + static_cast<size_t>(cb) * HW * blk_size;
+                    const float* pscl = &scales[cb * blk_size];
+                    for (int hw = 0; hw < HW; hw++) {
+                        for (int c = 0; c < blk_size; c++)
+                            pdst_cb[hw * blk_size + c] = psrc_cb[hw * blk_size + c] * norm * pscl[c];
+                    }
+                });
+            } else {
+                parallel_for(HW, [&](int hw) {
                     float norm = eps;
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        norm += psrc_c[wh]*psrc_c[wh];
+                    for (int cb = 0; cb < CB; cb++) {
+                        const int blk = std::min(blk_size, C - cb * blk_size);
+                        const float* psrc_c = psrc + (static_cast<size_t>(cb) * HW + hw) * blk_size;
+                        for (int c = 0; c < blk; c++)
+                            norm += psrc_c[c] * psrc_c[c];
                     }
-
                     norm = 1.0f / std::sqrt(norm);
 
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        float* pdst_c = pdst + c*W*H;
-
-                        pdst_c[wh] = channel_shared ? (psrc_c[wh] * norm * scl[0]) : (psrc_c[wh] * norm * scl[c]);
+                    for (int cb = 0; cb < CB; cb++) {
+                        const float* psrc_c = psrc + (static_cast<size_t>(cb) * HW + hw) * blk_size;
+                        float* pdst_c = pdst + (static_cast<size_t>(cb) * HW + hw) * blk_size;
+                        const float* pscl = &scales[cb * blk_size];
+                        for (int c = 0; c < blk_size; c++)
+                            pdst_c[c] = psrc_c[c] * norm * pscl[c];
                     }
-                }
+                });
             }
         }
-        return OK;
     }
 
-private:
     TBlob<float>::Ptr weights;
 
     bool across_spatial = true;
@@ -29,7 +29,7 @@ public:
             shift_.push_back(1);
             shift_.push_back(0);
 
-            addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
+            addConfig(layer, {DataConfigurator(ConfLayout::PLN, false, 0)}, {DataConfigurator(ConfLayout::PLN, false, 0)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
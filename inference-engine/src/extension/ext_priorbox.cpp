@@ -81,6 +81,7 @@ public:
                 THROW_IE_EXCEPTION << "Wrong number of variance values. Not less than 1 and more than 4 variance values.";
             }
 
+            // the priors depend only on the shapes, so the constant configs make the CPU graph compute them on load
             addConfig(layer, {{ConfLayout::ANY, true}, {ConfLayout::ANY, true}}, {{ConfLayout::PLN, true}});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
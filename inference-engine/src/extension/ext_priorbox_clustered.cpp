@@ -30,6 +30,10 @@ public:
             step_w_ = layer->GetParamAsFloat("step_w", 0);
             offset_ = layer->GetParamAsFloat("offset");
 
+            if (variance_.empty())
+                variance_.push_back(0.1);
+
+            // the priors depend only on the shapes, so the constant configs make the CPU graph compute them on load
             addConfig(layer, {{ConfLayout::PLN, true}, {ConfLayout::PLN, true}}, {{ConfLayout::PLN, true}});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
@@ -40,9 +44,6 @@ public:
                        ResponseDesc *resp) noexcept override {
         int num_priors_ = widths_.size();
 
-        if (variance_.empty())
-            variance_.push_back(0.1);
-
         // Execute
         const int layer_width = inputs[0]->getTensorDesc().getDims()[3];
         const int layer_height = inputs[0]->getTensorDesc().getDims()[2];
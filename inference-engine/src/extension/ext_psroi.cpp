@@ -9,6 +9,7 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -38,7 +39,14 @@ public:
             nh = static_cast<int>(outDims[2]);
             nw = static_cast<int>(outDims[3]);
 
+#if defined(HAVE_AVX512F)
+            auto blk_layout = ConfLayout::BLK16;
+#else
+            auto blk_layout = ConfLayout::BLK8;
+#endif
+            // the score maps are usually produced by the convolution in the blocked layout, so they are read without the reorder
             addConfig(layer, {DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
+            addConfig(layer, {DataConfigurator(blk_layout), DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -59,10 +67,18 @@ public:
             }
         }
 
-        #pragma omp parallel for schedule(static)
-        for (int n = 0; n < real_rois; n++) {
+        // the channels of the blocked input are split into the blocks of blk_size, the plain input is one block
+        const BlockingDesc &src_blk = inputs[0]->getTensorDesc().getBlockingDesc();
+        const int blk_size = src_blk.getBlockDims().size() == 5 ? static_cast<int>(src_blk.getBlockDims()[4]) : 1;
+        const int channels_blocks = (channels + blk_size - 1) / blk_size;
+        const int step_w = blk_size;
+        const int step_h = width * blk_size;
+
+        // the bins of the ROIs are the same for all the output channels, so they are computed once
+        std::vector<int> hstarts(real_rois * nh), hends(real_rois * nh);
+        std::vector<int> wstarts(real_rois * nw), wends(real_rois * nw);
+        parallel_for(real_rois, [&](int n) {
             const float* bottom_rois = bottom_rois_beginning + n * 5;
-            int roi_batch_ind = static_cast<int>(bottom_rois[0]);
             float roi_start_w = static_cast<float>(round(bottom_rois[1])) * spatial_scale_;
             float roi_start_h = static_cast<float>(round(bottom_rois[2])) * spatial_scale_;
             float roi_end_w   = static_cast<float>(round(bottom_rois[3]) + 1.0f) * spatial_scale_;
@@ -75,53 +91,57 @@ public:
             float bin_size_h = roi_height / static_cast<float>(pooled_height_);
             float bin_size_w = roi_width  / static_cast<float>(pooled_width_);
 
-            for (int c = 0; c < nc; c++) {
-                for (int h = 0; h < nh; h++) {
-                    int hstart = floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h);
-                    int hend = ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h);
+            for (int h = 0; h < nh; h++) {
+                int hstart = floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h);
+                int hend = ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h);
 
-                    hstart = std::min<int>(std::max<int>(hstart, 0), height);
-                    hend = std::min<int>(std::max<int>(hend, 0), height);
+                hstarts[n * nh + h] = std::min<int>(std::max<int>(hstart, 0), height);
+                hends[n * nh + h] = std::min<int>(std::max<int>(hend, 0), height);
+            }
 
-                    for (int w = 0; w < nw; w++) {
-                        int index = n * nc * nh * nw + c * nh * nw + h * nw + w;
-                        dst_data[index] = 0.0f;
+            for (int w = 0; w < nw; w++) {
+                int wstart = floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w);
+                int wend = ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w);
 
-                        int wstart = floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w);
-                        int wend = ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w);
+                wstarts[n * nw + w] = std::min<int>(std::max<int>(wstart, 0), width);
+                wends[n * nw + w] = std::min<int>(std::max<int>(wend, 0), width);
+            }
+        });
 
-                        wstart = std::min<int>(std::max<int>(wstart, 0), width);
-                        wend = std::min<int>(std::max<int>(wend, 0), width);
+        parallel_for3d(real_rois, nc, nh, [&](int n, int c, int h) {
+            int roi_batch_ind = static_cast<int>(bottom_rois_beginning[n * 5]);
 
-                        float bin_area = (hend - hstart) * (wend - wstart);
-                        if (bin_area) {
-                            int gc = (c * group_size_ + h) * group_size_ + w;
-                            const float *bottom_data =
-                                    bottom_data_beginning + ((roi_batch_ind * channels + gc) * height * width);
+            const int hstart = hstarts[n * nh + h];
+            const int hend = hends[n * nh + h];
 
-                            float out_sum = 0.0f;
-                            for (int hh = hstart; hh < hend; ++hh)
-                                for (int ww = wstart; ww < wend; ++ww)
-                                    out_sum += bottom_data[hh * width + ww];
+            for (int w = 0; w < nw; w++) {
+                int index = n * nc * nh * nw + c * nh * nw + h * nw + w;
+                dst_data[index] = 0.0f;
 
-                            dst_data[index] = out_sum / bin_area;
-                        }
-                    }
-                }
-            }
-        }
+                const int wstart = wstarts[n * nw + w];
+                const int wend = wends[n * nw + w];
+
+                float bin_area = (hend - hstart) * (wend - wstart);
+                if (bin_area) {
+                    int gc = (c * group_size_ + h) * group_size_ + w;
+                    const float *bottom_data = bottom_data_beginning +
+                            (static_cast<size_t>(roi_batch_ind * channels_blocks + gc / blk_size) * height * width) * blk_size +
+                            gc % blk_size;
+
+                    float out_sum = 0.0f;
+                    for (int hh = hstart; hh < hend; ++hh)
+                        for (int ww = wstart; ww < wend; ++ww)
+                            out_sum += bottom_data[hh * step_h + ww * step_w];
 
-        #pragma omp parallel for schedule(static)
-        for (int n = real_rois; n < nn; n++) {
-            for (int c = 0; c < nc; c++) {
-                for (int h = 0; h < nh; h++) {
-                    for (int w = 0; w < nw; w++) {
-                        int index = n * nc * nh * nw + c * nh * nw + h * nw + w;
-                        dst_data[index] = 0.0f;
-                    }
+                    dst_data[index] = out_sum / bin_area;
                 }
             }
-        }
+        });
+
+        parallel_for(nn - real_rois, [&](int i) {
+            const int n = real_rois + i;
+            std::fill(dst_data + n * nc * nh * nw, dst_data + (n + 1) * nc * nh * nw, 0.0f);
+        });
 
         return OK;
     }
@@ -6,13 +6,22 @@
 #include "ext_list.hpp"
 #include "ext_base.hpp"
 #include "defs.h"
-#include "softmax.h"
+#include "fast_exp.h"
+#include <cmath>
 #include <vector>
+#include <cassert>
+#include <algorithm>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+inline int div_up(const int a, const int b) {
+    assert(b);
+    return (a + b - 1) / b;
+}
+
 class RegionYoloImpl: public ExtLayerBase {
 public:
     explicit RegionYoloImpl(const CNNLayer* layer) {
@@ -26,7 +35,14 @@ public:
             do_softmax = static_cast<bool>(layer->GetParamAsInt("do_softmax", 1));
             mask = layer->GetParamAsInts("mask", {});
 
+#if defined(HAVE_AVX512F)
+            auto blk_layout = ConfLayout::BLK16;
+#else
+            auto blk_layout = ConfLayout::BLK8;
+#endif
+            // the input is usually produced by the convolution in the blocked layout, so it is read without the reorder
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
+            addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -44,7 +60,21 @@ public:
         int IC = (inputs[0]->getTensorDesc().getDims().size() > 1) ? inputs[0]->getTensorDesc().getDims()[1] : 1;
         int B = (inputs[0]->getTensorDesc().getDims().size() > 0) ? inputs[0]->getTensorDesc().getDims()[0] : 1;
 
-        memcpy(dst_data, src_data, B * IC * IH * IW * sizeof(float));
+        const BlockingDesc &src_blk = inputs[0]->getTensorDesc().getBlockingDesc();
+        const int blk_size = src_blk.getBlockDims().size() == 5 ? static_cast<int>(src_blk.getBlockDims()[4]) : 1;
+        if (blk_size == 1) {
+            memcpy(dst_data, src_data, B * IC * IH * IW * sizeof(float));
+        } else {
+            // the channels are gathered from their blocks, the padding of the last block is skipped
+            const int CB = (IC + blk_size - 1) / blk_size;
+            parallel_for2d(B, IC, [&](int b, int c) {
+                const float *psrc = src_data + (static_cast<size_t>(b * CB + c / blk_size) * IH * IW) * blk_size + c % blk_size;
+                float *pdst = dst_data + static_cast<size_t>(b * IC + c) * IH * IW;
+                for (int i = 0; i < IH * IW; i++) {
+                    pdst[i] = psrc[i * blk_size];
+                }
+            });
+        }
 
         int end_index = 0;
         int num_ = 0;
@@ -59,26 +89,28 @@ public:
         }
         int inputs_size = IH * IW * num_ * (classes + coords + 1);
 
-        for (int b = 0; b < B; b++) {
-            for (int n = 0; n < num_; n++) {
-                int index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, 0);
-                for (int i = index; i < index + 2 * IW * IH; i++) {
-                    dst_data[i] = logistic_activate(dst_data[i]);
-                }
-
-                index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, coords);
-                for (int i = index; i < index + end_index; i++) {
-                    dst_data[i] = logistic_activate(dst_data[i]);
-                }
-            }
-        }
+        // the anchors are split into the blocks of the spatial size, so all the threads are busy for the batch 1 too
+        const int xy_size = 2 * IW * IH;
+        const int xy_blocks = div_up(xy_size, block_size);
+        const int obj_blocks = div_up(end_index, block_size);
+        parallel_for3d(B, num_, xy_blocks + obj_blocks, [&](int b, int n, int blk) {
+            const bool is_xy = blk < xy_blocks;
+            const int start = (is_xy ? blk : blk - xy_blocks) * block_size;
+            const int size = is_xy ? xy_size : end_index;
+            int index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, is_xy ? 0 : coords);
+            calculate_logistic(dst_data + index + start, std::min(block_size, size - start));
+        });
 
         if (do_softmax) {
+            // the classes are not changed by the activations above, so the softmax works on the planar copy in place
             int index = entry_index(IW, IH, coords, classes, inputs_size, 0, 0, coords + 1);
             int batch_offset = inputs_size / num;
-            for (int b = 0; b < B * num; b++)
-                softmax_generic(src_data + index + b * batch_offset, dst_data + index + b * batch_offset, 1, classes,
-                                IH, IW);
+            const int spatial_blocks = div_up(IW * IH, block_size);
+            parallel_for2d(B * num, spatial_blocks, [&](int bn, int blk) {
+                const int start = blk * block_size;
+                calculate_softmax(dst_data + index + bn * batch_offset, classes, IW * IH,
+                                  start, std::min(start + block_size, IW * IH));
+            });
         }
 
         return OK;
@@ -102,8 +134,85 @@ private:
     inline float logistic_activate(float x) {
         return 1.f / (1.f + exp(-x));
     }
+
+    // the number of the values the threads process at once, multiple of the vector sizes
+    static const int block_size = 512;
+
+#if defined(HAVE_AVX512F)
+    typedef __m512 vec_type;
+    static const int vec_size = 16;
+
+    static inline __m512 _mm_uni_exp_ps(__m512 vec) {
+        return _avx512_fast_exp_ps(vec);
+    }
+#elif defined(HAVE_AVX2)
+    typedef __m256 vec_type;
+    static const int vec_size = 8;
+
+    static inline __m256 _mm_uni_exp_ps(__m256 vec) {
+        return _avx_fast_exp_ps(vec);
+    }
+#endif
+
+    void calculate_logistic(float* data, int count) {
+        int i = 0;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        vec_type vone = _mm_uni_set1_ps(1.f);
+        vec_type vzero = _mm_uni_setzero_ps();
+        for (; i <= count - vec_size; i += vec_size) {
+            vec_type vexp = _mm_uni_exp_ps(_mm_uni_sub_ps(vzero, _mm_uni_loadu_ps(data + i)));
+            _mm_uni_storeu_ps(data + i, _mm_uni_div_ps(vone, _mm_uni_add_ps(vone, vexp)));
+        }
+#endif
+        for (; i < count; i++) {
+            data[i] = logistic_activate(data[i]);
+        }
+    }
+
+    // the softmax over the channels of the spatial positions [start, end)
+    void calculate_softmax(float* data, int channels, int spatial, int start, int end) {
+        int i = start;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        for (; i <= end - vec_size; i += vec_size) {
+            vec_type vmax = _mm_uni_loadu_ps(data + i);
+            for (int c = 1; c < channels; c++) {
+                vmax = _mm_uni_max_ps(vmax, _mm_uni_loadu_ps(data + c * spatial + i));
+            }
+
+            vec_type vsum = _mm_uni_setzero_ps();
+            for (int c = 0; c < channels; c++) {
+                vec_type vexp = _mm_uni_exp_ps(_mm_uni_sub_ps(_mm_uni_loadu_ps(data + c * spatial + i), vmax));
+                vsum = _mm_uni_add_ps(vsum, vexp);
+                _mm_uni_storeu_ps(data + c * spatial + i, vexp);
+            }
+
+            vec_type vrcp = _mm_uni_div_ps(_mm_uni_set1_ps(1.f), vsum);
+            for (int c = 0; c < channels; c++) {
+                _mm_uni_storeu_ps(data + c * spatial + i, _mm_uni_mul_ps(_mm_uni_loadu_ps(data + c * spatial + i), vrcp));
+            }
+        }
+#endif
+        for (; i < end; i++) {
+            float max = data[i];
+            for (int c = 1; c < channels; c++) {
+                max = std::max(max, data[c * spatial + i]);
+            }
+
+            float sum = 0.f;
+            for (int c = 0; c < channels; c++) {
+                data[c * spatial + i] = std::exp(data[c * spatial + i] - max);
+                sum += data[c * spatial + i];
+            }
+
+            for (int c = 0; c < channels; c++) {
+                data[c * spatial + i] /= sum;
+            }
+        }
+    }
 };
 
+const int RegionYoloImpl::block_size;
+
 REG_FACTORY_FOR(ImplFactory<RegionYoloImpl>, RegionYolo);
 
 }  // namespace Cpu
@@ -6,6 +6,7 @@
 #include "ext_list.hpp"
 #include "ext_base.hpp"
 #include <vector>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -20,7 +21,13 @@ public:
 
             stride = layer->GetParamAsInt("stride");
 
+#if defined(HAVE_AVX512F)
+            auto blk_layout = ConfLayout::BLK16;
+#else
+            auto blk_layout = ConfLayout::BLK8;
+#endif
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
+            addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -36,28 +43,37 @@ public:
         int IC = (inputs[0]->getTensorDesc().getDims().size() > 1) ? inputs[0]->getTensorDesc().getDims()[1] : 1;
         int B = (inputs[0]->getTensorDesc().getDims().size() > 0) ? inputs[0]->getTensorDesc().getDims()[0] : 1;
 
+        // the planar index of the input is mapped to the channel block and the position in it for the blocked input
+        const BlockingDesc &src_blk = inputs[0]->getTensorDesc().getBlockingDesc();
+        const int blk_size = src_blk.getBlockDims().size() == 5 ? static_cast<int>(src_blk.getBlockDims()[4]) : 1;
+        const int CB = (IC + blk_size - 1) / blk_size;
+
         int ic_off = IC / (stride * stride);
         int ih_off = IH * stride;
         int iw_off = IW * stride;
-        for (int b = 0; b < B; b++) {
-            for (int ic = 0; ic < IC; ic++) {
-                for (int ih = 0; ih < IH; ih++) {
-                    for (int iw = 0; iw < IW; iw++) {
-                        int dstIndex = b * IC * IH * IW + ic * IH * IW + ih * IW + iw;
-
-                        int oc = ic % ic_off;
-                        int offset = ic / ic_off;
+        parallel_for2d(B, IC, [&](int b, int ic) {
+            for (int ih = 0; ih < IH; ih++) {
+                for (int iw = 0; iw < IW; iw++) {
+                    int dstIndex = b * IC * IH * IW + ic * IH * IW + ih * IW + iw;
 
-                        int ow = iw * stride + offset % stride;
-                        int oh = ih * stride + offset / stride;
+                    int oc = ic % ic_off;
+                    int offset = ic / ic_off;
 
-                        int srcIndex = b * ic_off * ih_off * iw_off + oc * ih_off * iw_off + oh * iw_off + ow;
+                    int ow = iw * stride + offset % stride;
+                    int oh = ih * stride + offset / stride;
 
-                        dst_data[dstIndex] = src_data[srcIndex];
+                    int srcIndex = b * ic_off * ih_off * iw_off + oc * ih_off * iw_off + oh * iw_off + ow;
+                    if (blk_size != 1) {
+                        int srcPlane = srcIndex - b * IC * IH * IW;
+                        int sc = srcPlane / (IH * IW);
+                        int shw = srcPlane % (IH * IW);
+                        srcIndex = ((b * CB + sc / blk_size) * IH * IW + shw) * blk_size + sc % blk_size;
                     }
+
+                    dst_data[dstIndex] = src_data[srcIndex];
                 }
             }
-        }
+        });
         return OK;
     }
 
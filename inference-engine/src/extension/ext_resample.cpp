@@ -11,6 +11,7 @@
 #include <immintrin.h>
 #include <cmath>
 #include <cassert>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -37,8 +38,7 @@ public:
             auto blk_layout = ConfLayout::BLK8;
 #endif
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
-            if (type == "caffe.ResampleParameter.NEAREST")
-                addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(blk_layout)});
+            addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(blk_layout)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -61,8 +61,11 @@ public:
         size_t OH = outputs[0]->getTensorDesc().getDims()[2];
         size_t OW = outputs[0]->getTensorDesc().getDims()[3];
 
+        const BlockingDesc &src_blk = inputs[0]->getTensorDesc().getBlockingDesc();
+        const int blk_size = src_blk.getBlockDims().size() == 5 ? static_cast<int>(src_blk.getBlockDims()[4]) : 1;
+
         if (IW == OW && IH == OH && type == "caffe.ResampleParameter.LINEAR") {
-            memcpy(dst_data, src_data, IN * IC * IH * IW * sizeof(float));
+            memcpy(dst_data, src_data, IN * div_up(IC, blk_size) * blk_size * IH * IW * sizeof(float));
             return OK;
         }
 
@@ -85,21 +88,18 @@ public:
                     Upsample_Nearest_BLK<2>(src_data, dst_data, IN, IC, IH, IW);
                 }
             } else {
-                if (layout == NCHW) {
-                    NearestNeighborKernel_PLN(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW);
-                } else {
-                    NearestNeighborKernel_BLK(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW);
-                }
+                NearestNeighborKernel(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW, blk_size);
             }
         } else if (type == "caffe.ResampleParameter.LINEAR") {
             size_t kernel_width = 2;
 
 #if defined(HAVE_SSE) || defined(HAVE_AVX2)
-            if (!isDownsample && fx == 0.25f && fy == 0.25f)
+            if (!isDownsample && fx == 0.25f && fy == 0.25f && layout == NCHW)
                 Upsample4x_TriangleInterpolation(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN);
             else
 #endif
-                InterpolationKernel(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN, kernel_width, isDownsample && antialias);
+                InterpolationKernel(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN, kernel_width, isDownsample && antialias,
+                                    blk_size);
         }
         return OK;
     }
@@ -112,103 +112,123 @@ private:
         return std::max(0.0f, 1 - std::abs(x));
     }
 
+    // the taps of the output coordinates and their weights normalized by the sum, the taps out of the input have zero weight
+    static void InterpolationCoeffs(const size_t in_size, const size_t out_size, const float f, const float shift,
+                                    const float a, const int r, std::vector<int> &idx, std::vector<float> &coeffs) {
+        const int taps = 2 * r + 1;
+        idx.resize(out_size * taps);
+        coeffs.resize(out_size * taps);
+
+        for (size_t o = 0; o < out_size; o++) {
+            float i = o * f + shift;
+            int i_r = static_cast<int>(round(i));
+
+            float sum = 0;
+            for (int k = 0; k < taps; k++) {
+                int x = i_r - r + k;
+                bool inside = x >= 0 && x < static_cast<int>(in_size);
+
+                idx[o * taps + k] = inside ? x : 0;
+                coeffs[o * taps + k] = inside ? a * triangleCoeff(a * (i - x)) : 0.0f;
+                sum += coeffs[o * taps + k];
+            }
+
+            for (int k = 0; k < taps; k++) {
+                coeffs[o * taps + k] = (!sum) ? 0 : (coeffs[o * taps + k] / sum);
+            }
+        }
+    }
+
+    // the triangle kernel is separable, so the input rows of the taps are blended first and the row is filtered then,
+    // the planar layout is the blocked one with the blocks of one channel
     static void InterpolationKernel(const float *in_ptr_,
                                     const size_t iw, const size_t ih,
                                     const float fx, const float fy,
                                     float *out_ptr_,
                                     const size_t ow, const size_t oh, const size_t channels, const size_t batch,
-                                    size_t kernel_width, bool antialias) {
-        for (size_t b = 0; b < batch; b++) {
-            for (size_t c = 0; c < channels; c++) {
-                const float *in_ptr = in_ptr_ + iw * ih * channels * b + iw * ih * c;
-                float *out_ptr = out_ptr_ + ow * oh * channels * b + ow * oh * c;
-
-                for (size_t oy = 0; oy < oh; oy++) {
-                    for (size_t ox = 0; ox < ow; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
-
-                        int ix_r = static_cast<int>(round(ix));
-                        int iy_r = static_cast<int>(round(iy));
-
-                        float sum = 0;
-                        float wsum = 0;
-
-                        float ax = 1.0f / (antialias ? fx : 1.0f);
-                        float ay = 1.0f / (antialias ? fy : 1.0f);
-
-                        int rx = (fx < 1.0f) ? 2 : ceil(static_cast<float>(kernel_width) / ax);
-                        int ry = (fy < 1.0f) ? 2 : ceil(static_cast<float>(kernel_width) / ay);
-
-                        for (int y = iy_r - ry; y <= iy_r + ry; y++) {
-                            for (int x = ix_r - rx; x <= ix_r + rx; x++) {
-                                if (y < 0 || x < 0 || y >= static_cast<int>(ih) || x >= static_cast<int>(iw))
-                                    continue;
-
-                                float dx = ix - x;
-                                float dy = iy - y;
-
-                                float w = ax * triangleCoeff(ax * dx) * ay * triangleCoeff(ay * dy);
-
-                                sum += w * in_ptr[y * iw + x];
-                                wsum += w;
-                            }
-                        }
-
-                        out_ptr[oy * ow + ox] = (!wsum) ? 0 : (sum / wsum);
+                                    size_t kernel_width, bool antialias, const int blk_size) {
+        float ax = 1.0f / (antialias ? fx : 1.0f);
+        float ay = 1.0f / (antialias ? fy : 1.0f);
+
+        int rx = (fx < 1.0f) ? 2 : ceil(static_cast<float>(kernel_width) / ax);
+        int ry = (fy < 1.0f) ? 2 : ceil(static_cast<float>(kernel_width) / ay);
+
+        std::vector<int> xs, ys;
+        std::vector<float> wx, wy;
+        InterpolationCoeffs(iw, ow, fx, fy / 2.0f - 0.5f, ax, rx, xs, wx);
+        InterpolationCoeffs(ih, oh, fy, fx / 2.0f - 0.5f, ay, ry, ys, wy);
+
+        const int taps_x = 2 * rx + 1;
+        const int taps_y = 2 * ry + 1;
+        const size_t CB = div_up(static_cast<int>(channels), blk_size);
+        const size_t row_size = iw * blk_size;
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            std::vector<float> row(row_size);
+
+            for_3d(ithr, nthr, batch, CB, oh, [&](size_t b, size_t cb, size_t oy) {
+                const float *in_ptr = in_ptr_ + (b * CB + cb) * ih * row_size;
+                float *out_ptr = out_ptr_ + ((b * CB + cb) * oh + oy) * ow * blk_size;
+
+                std::fill(row.begin(), row.end(), 0.0f);
+                for (int k = 0; k < taps_y; k++) {
+                    const float w = wy[oy * taps_y + k];
+                    if (w == 0.0f)
+                        continue;
+
+                    const float *in_row = in_ptr + ys[oy * taps_y + k] * row_size;
+                    for (size_t i = 0; i < row_size; i++) {
+                        row[i] += w * in_row[i];
                     }
                 }
-            }
-        }
-    }
 
-    static void NearestNeighborKernel_PLN(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW) {
-        for (size_t b = 0; b < B; b++) {
-            for (size_t c = 0; c < C; c++) {
-                const float *in_ptr = in_ptr_ + IW * IH * C * b + IW * IH * c;
-                float *out_ptr = out_ptr_ + OW * OH * C * b + OW * OH * c;
-
-                for (size_t oy = 0; oy < OH; oy++) {
-                    for (size_t ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
-
-                        size_t ix_r = static_cast<size_t>(round(ix));
-                        size_t iy_r = static_cast<size_t>(round(iy));
+                for (size_t ox = 0; ox < ow; ox++) {
+                    float *pdst = out_ptr + ox * blk_size;
+                    for (int c = 0; c < blk_size; c++) {
+                        pdst[c] = 0.0f;
+                    }
 
-                        out_ptr[oy * OW + ox] = in_ptr[iy_r * IW + ix_r];
+                    for (int k = 0; k < taps_x; k++) {
+                        const float w = wx[ox * taps_x + k];
+                        const float *psrc = &row[xs[ox * taps_x + k] * blk_size];
+                        for (int c = 0; c < blk_size; c++) {
+                            pdst[c] += w * psrc[c];
+                        }
                     }
                 }
-            }
-        }
+            });
+        });
     }
 
-    static void NearestNeighborKernel_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW) {
-        int blk_size = 8;
-        size_t CB = (size_t)div_up(C, blk_size);
-
-        for (size_t b = 0; b < B; b++) {
-            for (size_t cb = 0; cb < CB; cb++) {
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
+    // the input coordinates are computed once for all the rows and channels, the planar layout has the blocks of one channel
+    static void NearestNeighborKernel(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW,
+                                      int blk_size) {
+        std::vector<int> ixs(OW);
+        for (int ox = 0; ox < OW; ox++) {
+            int ix_r = static_cast<int>(round(ox * fx + fy / 2.0f - 0.5f));
+            ixs[ox] = std::min(std::max(ix_r, 0), IW - 1);
+        }
 
-                for (size_t oy = 0; oy < OH; oy++) {
-                    for (size_t ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
+        std::vector<int> iys(OH);
+        for (int oy = 0; oy < OH; oy++) {
+            int iy_r = static_cast<int>(round(oy * fy + fx / 2.0f - 0.5f));
+            iys[oy] = std::min(std::max(iy_r, 0), IH - 1);
+        }
 
-                        size_t ix_r = static_cast<size_t>(round(ix));
-                        size_t iy_r = static_cast<size_t>(round(iy));
+        const int CB = div_up(C, blk_size);
 
-                        for (int c = 0; c < blk_size; c++) {
-                            float value = in_ptr[iy_r * IW * blk_size + ix_r * blk_size + c];
+        parallel_for3d(B, CB, OH, [&](int b, int cb, int oy) {
+            const float *in_ptr = in_ptr_ + (static_cast<size_t>(b * CB + cb) * IH + iys[oy]) * IW * blk_size;
+            float *out_ptr = out_ptr_ + (static_cast<size_t>(b * CB + cb) * OH + oy) * OW * blk_size;
 
-                            out_ptr[oy * OW * blk_size + ox * blk_size + c] = value;
-                        }
-                    }
+            for (int ox = 0; ox < OW; ox++) {
+                const float *psrc = in_ptr + ixs[ox] * blk_size;
+                float *pdst = out_ptr + ox * blk_size;
+                for (int c = 0; c < blk_size; c++) {
+                    pdst[c] = psrc[c];
                 }
             }
-        }
+        });
     }
 
     template <int factor>
@@ -216,26 +236,24 @@ private:
         int OH = factor * IH;
         int OW = factor * IW;
 
-        for (size_t b = 0; b < B; b++) {
-            for (size_t c = 0; c < C; c++) {
-                const float *in_ptr = in_ptr_ + IW * IH * C * b + IW * IH * c;
-                float *out_ptr = out_ptr_ + OW * OH * C * b + OW * OH * c;
+        parallel_for2d(B, C, [&](int b, int c) {
+            const float *in_ptr = in_ptr_ + IW * IH * C * b + IW * IH * c;
+            float *out_ptr = out_ptr_ + OW * OH * C * b + OW * OH * c;
 
-                for (size_t iy = 0; iy < IH; iy++) {
-                    for (size_t ix = 0; ix < IW; ix++) {
-                        size_t oy = factor * iy;
-                        size_t ox = factor * ix;
-                        float value = in_ptr[iy * IW + ix];
+            for (size_t iy = 0; iy < IH; iy++) {
+                for (size_t ix = 0; ix < IW; ix++) {
+                    size_t oy = factor * iy;
+                    size_t ox = factor * ix;
+                    float value = in_ptr[iy * IW + ix];
 
-                        for (int fh = 0; fh < factor; fh++) {
-                            for (int fw = 0; fw < factor; fw++) {
-                                out_ptr[(oy + fh) * OW + ox + fw] = value;
-                            }
+                    for (int fh = 0; fh < factor; fh++) {
+                        for (int fw = 0; fw < factor; fw++) {
+                            out_ptr[(oy + fh) * OW + ox + fw] = value;
                         }
                     }
                 }
             }
-        }
+        });
     }
 
     template <int factor>
@@ -257,54 +275,47 @@ private:
         int OH = factor * IH;
         int OW = factor * IW;
 
-#if _MSC_VER && !__INTEL_COMPILER
-        #pragma omp parallel for schedule(static)
-#else
-        #pragma omp parallel for collapse(2) schedule(static)
-#endif
-        for (int b = 0; b < B; b++) {
-            for (int cb = 0; cb < CB; cb++) {
+        parallel_for2d(B, CB, [&](int b, int cb) {
 #if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
+            const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
+            float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
 
-                for (size_t iy = 0; iy < IH; iy++) {
-                    for (size_t ix = 0; ix < IW; ix++) {
-                        size_t oy = factor * iy;
-                        size_t ox = factor * ix;
+            for (size_t iy = 0; iy < IH; iy++) {
+                for (size_t ix = 0; ix < IW; ix++) {
+                    size_t oy = factor * iy;
+                    size_t ox = factor * ix;
 
-                        vec_type vsrc = _mm_uni_loadu_ps(in_ptr + iy * IW * blk_size + ix * blk_size);
+                    vec_type vsrc = _mm_uni_loadu_ps(in_ptr + iy * IW * blk_size + ix * blk_size);
 
-                        for (int fh = 0; fh < factor; fh++) {
-                            for (int fw = 0; fw < factor; fw++) {
-                                _mm_uni_storeu_ps(out_ptr + (oy + fh) * OW * blk_size + (ox + fw) * blk_size, vsrc);
-                            }
+                    for (int fh = 0; fh < factor; fh++) {
+                        for (int fw = 0; fw < factor; fw++) {
+                            _mm_uni_storeu_ps(out_ptr + (oy + fh) * OW * blk_size + (ox + fw) * blk_size, vsrc);
                         }
                     }
                 }
+            }
 #else
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
+            const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
+            float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
 
-                for (int iy = 0; iy < IH; iy++) {
-                    for (int ix = 0; ix < IW; ix++) {
-                        int oy = factor * iy;
-                        int ox = factor * ix;
+            for (int iy = 0; iy < IH; iy++) {
+                for (int ix = 0; ix < IW; ix++) {
+                    int oy = factor * iy;
+                    int ox = factor * ix;
 
-                        for (int c = 0; c < blk_size; c++) {
-                            float value = in_ptr[iy * IW * blk_size + ix * blk_size + c];
+                    for (int c = 0; c < blk_size; c++) {
+                        float value = in_ptr[iy * IW * blk_size + ix * blk_size + c];
 
-                            for (int fh = 0; fh < factor; fh++) {
-                                for (int fw = 0; fw < factor; fw++) {
-                                    out_ptr[(oy + fh) * OW * blk_size + (ox + fw) * blk_size + c] = value;
-                                }
+                        for (int fh = 0; fh < factor; fh++) {
+                            for (int fw = 0; fw < factor; fw++) {
+                                out_ptr[(oy + fh) * OW * blk_size + (ox + fw) * blk_size + c] = value;
                             }
                         }
                     }
                 }
-#endif
             }
-        }
+#endif
+        });
     }
 
 
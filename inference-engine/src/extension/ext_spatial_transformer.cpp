@@ -11,6 +11,8 @@
 #include <algorithm>
 #include <vector>
 #include <cmath>
+#include <immintrin.h>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -32,7 +34,7 @@ public:
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
                        ResponseDesc *resp) noexcept override {
         std::vector<size_t> real_dims = inputs[0]->getTensorDesc().getDims();
-        size_t data_size = inputs[0]->size();
+        std::vector<size_t> out_dims = outputs[0]->getTensorDesc().getDims();
 
         const auto *src_data = inputs[0]->cbuffer().as<const float *>();
         auto *theta = inputs[1]->buffer().as<float *>();
@@ -40,94 +42,94 @@ public:
 
         auto N = real_dims[0];
         auto C = real_dims[1];
-        auto output_H_ = real_dims[2];
-        auto output_W_ = real_dims[3];
+        const int input_H_ = static_cast<int>(real_dims[2]);
+        const int input_W_ = static_cast<int>(real_dims[3]);
+        const int output_H_ = static_cast<int>(out_dims[2]);
+        const int output_W_ = static_cast<int>(out_dims[3]);
+        const int output_size = output_H_ * output_W_;
 
         // Prepare input and output grid
-        std::vector<float> input_grid_data(N * output_H_ * output_W_ * 2);
-        std::vector<float> output_grid_data(3 * output_H_ * output_W_);
-        for (int i = 0; i < output_H_ * output_W_; ++i) {
+        std::vector<float> input_grid_data(N * output_size * 2);
+        std::vector<float> output_grid_data(3 * output_size);
+        for (int i = 0; i < output_size; ++i) {
             output_grid_data[3 * i] = (i / output_W_) * 1.0 / output_H_ * 2 - 1;
             output_grid_data[3 * i + 1] = (i % output_W_) * 1.0 / output_W_ * 2 - 1;
             output_grid_data[3 * i + 2] = 1;
         }
 
+        // the offsets and the weights of the 4 taps of the output pixels, the tap k of the pixel p is at k * output_size + p
+        std::vector<int> tap_offsets(4 * output_size);
+        std::vector<float> tap_weights(4 * output_size);
+
         // Actually execute
         for (int i = 0; i < N; ++i) {
-            auto coordinates = input_grid_data.begin() + (output_H_ * output_W_ * 2) * i;
+            auto coordinates = input_grid_data.begin() + (output_size * 2) * i;
 
-            auto M_size = output_H_ * output_W_;
+            auto M_size = output_size;
             auto N_size = 2;
             auto K_size = 3;
 
             matrixMult(&output_grid_data[0], theta + 6 * i, &(*coordinates), M_size, N_size, K_size, true);
 
-            int row_idx;
-            float px, py;
-
-            for (int j = 0; j < C; ++j) {
-                for (int s = 0; s < output_H_; ++s) {
-                    for (int t = 0; t < output_W_; ++t) {
-                        row_idx = output_W_ * s + t;
-
-                        px = coordinates[row_idx * 2];
-                        py = coordinates[row_idx * 2 + 1];
-
-                        size_t dst_offset = ((i * C + j) * output_H_ + s) * output_W_ + t;
-                        size_t src_offset = ((i * C + j) * output_H_ + 0) * output_W_ + 0;
-                        dst_data[dst_offset] = transform_forward_cpu(src_data + src_offset, px, py);
+            // the taps depend only on the transformation of the image, so they are shared by all the channels
+            parallel_for(output_size, [&](int p) {
+                compute_taps(coordinates[p * 2], coordinates[p * 2 + 1], input_H_, input_W_, p, output_size,
+                             &tap_offsets[0], &tap_weights[0]);
+            });
+
+            parallel_for2d(C, output_H_, [&](int j, int s) {
+                const float *pic = src_data + (i * C + j) * input_H_ * input_W_;
+                float *dst = dst_data + ((i * C + j) * output_H_ + s) * output_W_;
+
+                int t = 0;
+#if defined(HAVE_AVX2)
+                for (; t <= output_W_ - 8; t += 8) {
+                    const int p = output_W_ * s + t;
+                    __m256 vres = _mm256_setzero_ps();
+                    for (int k = 0; k < 4; k++) {
+                        __m256i voffset = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&tap_offsets[k * output_size + p]));
+                        __m256 vweight = _mm256_loadu_ps(&tap_weights[k * output_size + p]);
+                        vres = _mm256_fmadd_ps(vweight, _mm256_i32gather_ps(pic, voffset, 4), vres);
                     }
+                    _mm256_storeu_ps(dst + t, vres);
                 }
-            }
+#endif
+                for (; t < output_W_; t++) {
+                    const int p = output_W_ * s + t;
+                    float res = 0.0f;
+                    for (int k = 0; k < 4; k++) {
+                        res += tap_weights[k * output_size + p] * pic[tap_offsets[k * output_size + p]];
+                    }
+                    dst[t] = res;
+                }
+            });
         }
         return OK;
     }
 
 private:
-    float transform_forward_cpu(const float *pic, float px, float py) {
-        int H = 24;
-        int W = 94;
-
-        float res = 0.0f;
+    // the taps out of the picture have the zero weight and read its first value
+    static void compute_taps(float px, float py, int H, int W, int p, int output_size, int *offsets, float *weights) {
         float x = (px + 1) / 2 * H;
         float y = (py + 1) / 2 * W;
 
-        int m, n;
-        float w;
-
-        m = std::floor(x);
-        n = std::floor(y);
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
-        }
+        const int m0 = static_cast<int>(std::floor(x));
+        const int n0 = static_cast<int>(std::floor(y));
 
-        m = std::floor(x) + 1;
-        n = std::floor(y);
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
-        }
+        for (int k = 0; k < 4; k++) {
+            int m = m0 + k % 2;
+            int n = n0 + k / 2;
 
-        m = std::floor(x);
-        n = std::floor(y) + 1;
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
-        }
+            float w = 0;
+            int offset = 0;
+            if (m >= 0 && m < H && n >= 0 && n < W) {
+                w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
+                offset = m * W + n;
+            }
 
-        m = std::floor(x) + 1;
-        n = std::floor(y) + 1;
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
+            offsets[k * output_size + p] = offset;
+            weights[k * output_size + p] = w;
         }
-
-        return res;
     }
 };
 
@@ -8,11 +8,160 @@
 #include "details/ie_cnn_network_iterator.hpp"
 #include "ie_layers.h"
 #include "ie_util_internal.hpp"
+#include "hetero/hetero_plugin_config.hpp"
+#include <caseless.hpp>
+#include <algorithm>
 #include <fstream>
+#include <sstream>
 #include <vector>
 #include <memory>
 
 using namespace InferenceEngine;
+using namespace InferenceEngine::HeteroConfigParams;
+
+namespace {
+
+bool isInputLayer(const CNNLayerPtr &layer) {
+    return CaselessEq<std::string>()(layer->type, "input");
+}
+
+double dataSize(const DataPtr &data) {
+    double size = 1;
+    for (auto dim : data->getDims()) {
+        size *= dim;
+    }
+    return size;
+}
+
+/**
+ * @brief The estimated number of the multiply-accumulates of the layer, the layers without weights cost
+ * an operation per output element
+ */
+double estimateLayerCost(const CNNLayerPtr &layer) {
+    double outputs = 0;
+    for (auto &&data : layer->outData) {
+        outputs += dataSize(data);
+    }
+    auto weightable = dynamic_cast<WeightableLayer *>(layer.get());
+    if (weightable != nullptr && weightable->_weights != nullptr && !layer->outData.empty()) {
+        const auto &dims = layer->outData[0]->getDims();
+        double channels = dims.size() > 1 ? std::max<size_t>(dims[1], 1) : 1;
+        // each output element takes the weights of its output channel
+        return outputs * weightable->_weights->size() / channels;
+    }
+    return outputs;
+}
+
+class AffinityCostModel {
+public:
+    AffinityCostModel(const std::vector<CNNLayerPtr> &layers,
+                      const std::map<std::string, double> &speeds,
+                      double transferCost) :
+        _speeds(speeds), _transferCost(transferCost) {
+        for (auto &&layer : layers) {
+            _layerCosts[layer.get()] = estimateLayerCost(layer);
+        }
+    }
+
+    /**
+     * @brief The cost of the layer on the device and of the copies of its inputs and outputs from and to
+     * the adjacent layers of other devices
+     */
+    double layerCost(const CNNLayerPtr &layer, const std::string &device) const {
+        double cost = computeCost(layer, device);
+        for (auto &&input : layer->insData) {
+            auto data = input.lock();
+            auto creator = data ? data->creatorLayer.lock() : nullptr;
+            if (creator && !isInputLayer(creator) && creator->affinity != device) {
+                cost += dataSize(data) * _transferCost;
+            }
+        }
+        for (auto &&data : layer->outData) {
+            for (auto &&consumer : data->getInputTo()) {
+                if (consumer.second->affinity != device) {
+                    cost += dataSize(data) * _transferCost;
+                }
+            }
+        }
+        return cost;
+    }
+
+    /**
+     * @brief The cost of the layers on their devices and of the copies between the subgraphs
+     */
+    double totalCost(const std::vector<CNNLayerPtr> &layers) const {
+        double cost = 0;
+        for (auto &&layer : layers) {
+            cost += computeCost(layer, layer->affinity);
+            for (auto &&data : layer->outData) {
+                for (auto &&consumer : data->getInputTo()) {
+                    if (consumer.second->affinity != layer->affinity) {
+                        cost += dataSize(data) * _transferCost;
+                    }
+                }
+            }
+        }
+        return cost;
+    }
+
+private:
+    double computeCost(const CNNLayerPtr &layer, const std::string &device) const {
+        auto speed = _speeds.find(device);
+        auto cost = _layerCosts.find(layer.get());
+        return (cost != _layerCosts.end() ? cost->second : 0) / (speed != _speeds.end() ? speed->second : 1);
+    }
+
+    std::map<const CNNLayer *, double> _layerCosts;
+    std::map<std::string, double> _speeds;
+    double _transferCost;
+};
+
+std::vector<CNNLayerPtr> adjacentLayers(const CNNLayerPtr &layer) {
+    std::vector<CNNLayerPtr> layers;
+    for (auto &&input : layer->insData) {
+        auto data = input.lock();
+        auto creator = data ? data->creatorLayer.lock() : nullptr;
+        if (creator && !isInputLayer(creator)) {
+            layers.push_back(creator);
+        }
+    }
+    for (auto &&data : layer->outData) {
+        for (auto &&consumer : data->getInputTo()) {
+            layers.push_back(consumer.second);
+        }
+    }
+    return layers;
+}
+
+/**
+ * @brief The sets of the connected layers of the same device
+ */
+std::vector<std::vector<CNNLayerPtr>> findSubgraphs(const std::vector<CNNLayerPtr> &layers) {
+    std::vector<std::vector<CNNLayerPtr>> subgraphs;
+    std::set<const CNNLayer *> visited;
+    for (auto &&layer : layers) {
+        if (visited.count(layer.get())) {
+            continue;
+        }
+        std::vector<CNNLayerPtr> subgraph = {layer};
+        visited.insert(layer.get());
+        for (size_t i = 0; i < subgraph.size(); i++) {
+            for (auto &&adjacent : adjacentLayers(subgraph[i])) {
+                if (adjacent->affinity == layer->affinity && !visited.count(adjacent.get())) {
+                    visited.insert(adjacent.get());
+                    subgraph.push_back(adjacent);
+                }
+            }
+        }
+        subgraphs.push_back(subgraph);
+    }
+    return subgraphs;
+}
+
+// the passes of the layer moves stop earlier when none of the layers is moved
+const size_t maxMovePasses = 16;
+
+}  // namespace
 
 void dla_layer_colorer(const CNNLayerPtr layer,
                        ordered_properties &printed_properties,
@@ -86,8 +235,173 @@ void FallbackPolicy::setAffinity(const std::map<std::string, std::string>& confi
         i++;
     }
 
+    auto itPolicy = config.find(KEY_HETERO_AFFINITY_POLICY);
+    if (itPolicy != config.end() && itPolicy->second != HETERO_CONFIG_VALUE(AFFINITY_FIRST_SUPPORTED)) {
+        if (itPolicy->second != HETERO_CONFIG_VALUE(AFFINITY_MIN_COST)) {
+            THROW_IE_EXCEPTION << "Wrong value " << itPolicy->second << " for property key " << KEY_HETERO_AFFINITY_POLICY;
+        }
+        setMinCostAffinity(config, network, queryResults);
+    }
+
     if (_dumpDotFile) {
         std::ofstream file("hetero_affinity.dot");
         saveGraphToDot(network, file, dla_layer_colorer);
     }
 }
+
+std::map<std::string, double> FallbackPolicy::parseDeviceSpeeds(const std::string &value) {
+    std::map<std::string, double> speeds;
+    std::stringstream list(value);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        auto delimiter = item.find(':');
+        try {
+            if (delimiter == std::string::npos) {
+                throw std::invalid_argument("no speed");
+            }
+            double speed = std::stod(item.substr(delimiter + 1));
+            if (speed <= 0) {
+                throw std::invalid_argument("non-positive speed");
+            }
+            speeds[item.substr(0, delimiter)] = speed;
+        } catch (const std::exception &) {
+            THROW_IE_EXCEPTION << "Wrong value " << value << " for property key " << KEY_HETERO_DEVICE_SPEEDS
+                               << ". Expected the list of the devices with their positive speeds, e.g. GPU:4,CPU:1";
+        }
+    }
+    return speeds;
+}
+
+void FallbackPolicy::setMinCostAffinity(const std::map<std::string, std::string>& config, ICNNNetwork& network,
+                                        std::map<std::string, QueryNetworkResult>& queryResults) {
+    std::map<std::string, double> speeds;
+    double transferCost = 10;
+    size_t minSubgraphSize = 1;
+    auto it = config.find(KEY_HETERO_DEVICE_SPEEDS);
+    if (it != config.end()) {
+        speeds = parseDeviceSpeeds(it->second);
+    }
+    it = config.find(KEY_HETERO_TRANSFER_COST);
+    if (it != config.end()) {
+        try {
+            transferCost = std::stod(it->second);
+        } catch (const std::exception &) {
+            transferCost = -1;
+        }
+        if (transferCost < 0) {
+            THROW_IE_EXCEPTION << "Wrong value " << it->second << " for property key " << KEY_HETERO_TRANSFER_COST
+                               << ". Expected non-negative float value";
+        }
+    }
+    it = config.find(KEY_HETERO_MIN_SUBGRAPH_SIZE);
+    if (it != config.end()) {
+        int size = -1;
+        try {
+            size = std::stoi(it->second);
+        } catch (const std::exception &) {
+        }
+        if (size < 0) {
+            THROW_IE_EXCEPTION << "Wrong value " << it->second << " for property key " << KEY_HETERO_MIN_SUBGRAPH_SIZE
+                               << ". Expected unsigned integer value";
+        }
+        minSubgraphSize = static_cast<size_t>(size);
+    }
+
+    // the inputs are copied to the devices of their consumers anyway, so they keep their devices
+    std::vector<CNNLayerPtr> layers;
+    details::CNNNetworkIterator i(&network);
+    while (i != details::CNNNetworkIterator()) {
+        CNNLayer::Ptr layer = *i;
+        if (!isInputLayer(layer) && !layer->affinity.empty()) {
+            layers.push_back(layer);
+        }
+        i++;
+    }
+
+    auto isSupported = [&](const CNNLayerPtr &layer, const std::string &device) {
+        auto &supported = queryResults[device].supportedLayers;
+        return supported.find(layer->name) != supported.end();
+    };
+
+    AffinityCostModel costModel(layers, speeds, transferCost);
+
+    // moves each layer to the device of its lowest cost given the devices of the adjacent layers,
+    // the ties keep the device of the layer, so the order of TARGET_FALLBACK is kept for them
+    for (size_t pass = 0; pass < maxMovePasses; pass++) {
+        bool moved = false;
+        for (auto &&layer : layers) {
+            auto bestDevice = layer->affinity;
+            auto bestCost = costModel.layerCost(layer, bestDevice);
+            for (auto &&device : _fallbackDevices) {
+                if (device == layer->affinity || !isSupported(layer, device)) {
+                    continue;
+                }
+                auto cost = costModel.layerCost(layer, device);
+                if (cost < bestCost) {
+                    bestDevice = device;
+                    bestCost = cost;
+                }
+            }
+            if (bestDevice != layer->affinity) {
+                layer->affinity = bestDevice;
+                moved = true;
+            }
+        }
+        if (!moved) {
+            break;
+        }
+    }
+
+    if (minSubgraphSize <= 1) {
+        return;
+    }
+
+    // each move merges the small subgraph into an adjacent one, so the number of the subgraphs decreases
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        auto subgraphs = findSubgraphs(layers);
+        std::sort(subgraphs.begin(), subgraphs.end(),
+                  [](const std::vector<CNNLayerPtr> &a, const std::vector<CNNLayerPtr> &b) { return a.size() < b.size(); });
+        for (auto &&subgraph : subgraphs) {
+            if (subgraph.size() >= minSubgraphSize) {
+                break;
+            }
+            const auto device = subgraph.front()->affinity;
+            std::set<std::string> candidates;
+            for (auto &&layer : subgraph) {
+                for (auto &&adjacent : adjacentLayers(layer)) {
+                    if (adjacent->affinity != device) {
+                        candidates.insert(adjacent->affinity);
+                    }
+                }
+            }
+
+            std::string bestDevice;
+            double bestCost = 0;
+            for (auto &&candidate : candidates) {
+                bool allSupported = std::all_of(subgraph.begin(), subgraph.end(),
+                                                [&](const CNNLayerPtr &layer) { return isSupported(layer, candidate); });
+                if (!allSupported) {
+                    continue;
+                }
+                for (auto &&layer : subgraph) {
+                    layer->affinity = candidate;
+                }
+                auto cost = costModel.totalCost(layers);
+                if (bestDevice.empty() || cost < bestCost) {
+                    bestDevice = candidate;
+                    bestCost = cost;
+                }
+            }
+
+            for (auto &&layer : subgraph) {
+                layer->affinity = bestDevice.empty() ? device : bestDevice;
+            }
+            if (!bestDevice.empty()) {
+                merged = true;
+                break;
+            }
+        }
+    }
+}
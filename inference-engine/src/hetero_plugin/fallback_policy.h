@@ -10,6 +10,7 @@
 #include <ie_ihetero_plugin.hpp>
 #include <utility>
 #include <vector>
+#include <set>
 
 namespace InferenceEngine {
 
@@ -22,7 +23,19 @@ public:
 
     void setAffinity(const std::map<std::string, std::string>& config, ICNNNetwork& pNetwork);
 
+    /**
+     * @brief Parses the value of KEY_HETERO_DEVICE_SPEEDS
+     */
+    static std::map<std::string, double> parseDeviceSpeeds(const std::string &value);
+
 private:
+    /**
+     * @brief Moves the layers to the devices which minimize the estimated cost of the network, the layers of the
+     * subgraphs smaller than the minimal size are moved to the devices of the adjacent subgraphs
+     */
+    void setMinCostAffinity(const std::map<std::string, std::string>& config, ICNNNetwork& network,
+                            std::map<std::string, QueryNetworkResult>& queryResults);
+
     InferenceEngine::MapDeviceLoaders &_deviceLoaders;
     std::vector<std::string> _fallbackDevices;
     bool _dumpDotFile;
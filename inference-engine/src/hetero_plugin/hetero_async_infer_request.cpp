@@ -17,6 +17,11 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(HeteroInferRequest::Ptr request
                                                  const ITaskExecutor::Ptr &callbackExecutor)
         : AsyncInferRequestThreadSafeDefault(request, taskExecutor, taskSynchronizer, callbackExecutor),
           _heteroInferRequest(request) {
+    // the subgraph requests of the pipelined request belong to the lanes of the pipeline
+    if (_heteroInferRequest->isPipelined()) {
+        return;
+    }
+
     _heteroInferRequest->setCallbackSequence();
 
     std::function<void(InferRequest, StatusCode)> f =
@@ -27,15 +32,59 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(HeteroInferRequest::Ptr request
     _heteroInferRequest->setCallbackForLastRequest(f);
 }
 
+HeteroAsyncInferRequest::~HeteroAsyncInferRequest() {
+    // the callback of the frame on the pipeline refers to the request
+    if (_frameStatus.valid()) {
+        _frameStatus.wait();
+    }
+}
+
 void HeteroAsyncInferRequest::StartAsync() {
     IE_PROFILING_AUTO_SCOPE(Hetero_Async)
     if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
     setIsRequestBusy(true);
+    _heteroInferRequest->getCancellation().start();
+    if (_heteroInferRequest->isPipelined()) {
+        auto frame = std::make_shared<std::promise<StatusCode>>();
+        _frameStatus = frame->get_future().share();
+        _heteroInferRequest->startPipelined([this, frame](StatusCode sts) {
+            setIsRequestBusy(false);
+            // the frame is completed after the callback, so Wait() returns after it as for the other requests
+            // and the request destroyed after Wait() is not used by the callback
+            try {
+                onFrameCompleted(sts);
+            } catch (...) {
+                frame->set_value(sts);
+                throw;
+            }
+            frame->set_value(sts);
+        });
+        return;
+    }
     _heteroInferRequest->updateInOutIfNeeded();
     _heteroInferRequest->startFirstAsyncRequest();
 }
 
+void HeteroAsyncInferRequest::onFrameCompleted(StatusCode sts) {
+    if (_callbackManager.isCallbackEnabled()) {
+        _callbackManager.set_requestStatus(sts);
+        _callbackManager.runCallback();
+    }
+}
+
 InferenceEngine::StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
+    if (_heteroInferRequest->isPipelined()) {
+        if (!_frameStatus.valid()) {
+            return INFER_NOT_STARTED;
+        }
+        if (millis_timeout == IInferRequest::WaitMode::RESULT_READY) {
+            _frameStatus.wait();
+        } else if (_frameStatus.wait_for(std::chrono::milliseconds(millis_timeout)) != std::future_status::ready) {
+            return RESULT_NOT_READY;
+        }
+        return _frameStatus.get();
+    }
+
     auto sts = _heteroInferRequest->waitAllRequests(millis_timeout);
     if (sts != StatusCode::RESULT_NOT_READY && sts != StatusCode::REQUEST_BUSY) {
         setIsRequestBusy(false);
@@ -45,6 +94,9 @@ InferenceEngine::StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout
 
 void HeteroAsyncInferRequest::SetCompletionCallback(IInferRequest::CompletionCallback callback) {
     AsyncInferRequestThreadSafeDefault::SetCompletionCallback(callback);
+    if (_heteroInferRequest->isPipelined()) {
+        return;
+    }
 
     std::function<void(InferRequest, StatusCode)> f =
             [&](InferRequest /*request*/, StatusCode sts) {
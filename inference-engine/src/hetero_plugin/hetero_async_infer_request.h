@@ -15,6 +15,7 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <future>
 
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "hetero_infer_request.h"
@@ -30,6 +31,8 @@ public:
                             const InferenceEngine::TaskSynchronizer::Ptr &taskSynchronizer,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
 
+    ~HeteroAsyncInferRequest();
+
     void StartAsync() override;
 
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
@@ -37,7 +40,11 @@ public:
     void SetCompletionCallback(InferenceEngine::IInferRequest::CompletionCallback callback) override;
 
 private:
+    void onFrameCompleted(InferenceEngine::StatusCode sts);
+
     HeteroInferRequest::Ptr _heteroInferRequest;
+    // the status of the last frame started on the pipeline
+    std::shared_future<InferenceEngine::StatusCode> _frameStatus;
 };
 
 }  // namespace HeteroPlugin
@@ -0,0 +1,119 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_batch_split_infer_request.h"
+#include <blob_factory.hpp>
+#include <ie_profiling.hpp>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroBatchSplitInferRequest::HeteroBatchSplitInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                                           InferenceEngine::OutputsDataMap networkOutputs,
+                                                           const BatchPartsList &parts,
+                                                           size_t batch) :
+        InferRequestInternal(networkInputs, networkOutputs),
+        _parts(parts),
+        _batch(batch) {
+    if (_networkOutputs.empty() || _networkInputs.empty()) {
+        THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
+    }
+    if (_parts.empty()) {
+        THROW_IE_EXCEPTION << "Internal error: no parts of the batch";
+    }
+
+    for (auto &&part : _parts) {
+        part._request = part._network->CreateInferRequestPtr();
+    }
+
+    // the blobs of the request hold the whole batch of the blobs of the part requests
+    auto allocateBlob([&](const std::string &name) {
+        auto partDesc = _parts.front()._request->GetBlob(name.c_str())->getTensorDesc();
+        auto dims = partDesc.getDims();
+        dims[0] = _batch;
+        auto blob = make_blob_with_precision(TensorDesc(partDesc.getPrecision(), dims, partDesc.getLayout()));
+        blob->allocate();
+        bindParts(name, blob);
+        return blob;
+    });
+
+    for (auto &&input : _networkInputs) {
+        _inputs[input.first] = allocateBlob(input.first);
+    }
+    for (auto &&output : _networkOutputs) {
+        _outputs[output.first] = allocateBlob(output.first);
+    }
+}
+
+void HeteroBatchSplitInferRequest::bindParts(const std::string &name, const Blob::Ptr &blob) {
+    const auto &desc = blob->getTensorDesc();
+    if (desc.getDims().empty() || desc.getDims()[0] != _batch) {
+        THROW_IE_EXCEPTION << "The blob \'" << name << "\' of the batch split request doesn't hold the batch "
+                           << _batch << " in its first dimension";
+    }
+    const size_t imageSize = blob->byteSize() / _batch;
+    auto data = blob->buffer().as<uint8_t *>();
+    for (auto &&part : _parts) {
+        auto dims = desc.getDims();
+        dims[0] = part._batch;
+        auto partBlob = make_blob_with_precision(TensorDesc(desc.getPrecision(), dims, desc.getLayout()),
+                                                 data + part._offset * imageSize);
+        part._request->SetBlob(name.c_str(), partBlob);
+    }
+    _boundBlobs[name] = blob;
+}
+
+void HeteroBatchSplitInferRequest::Cancel() {
+    InferRequestInternal::Cancel();
+    for (auto &&part : _parts) {
+        static_cast<IInferRequest::Ptr &>(*part._request)->Cancel(nullptr);
+    }
+}
+
+void HeteroBatchSplitInferRequest::InferImpl() {
+    IE_PROFILING_AUTO_SCOPE(HeteroBatchSplit_Infer)
+    // the parts read the inputs of the request, so the pre-processing fills them first
+    execDataPreprocessing();
+    for (auto &&input : _inputs) {
+        if (_boundBlobs[input.first] != input.second) {
+            bindParts(input.first, input.second);
+        }
+    }
+    for (auto &&output : _outputs) {
+        if (_boundBlobs[output.first] != output.second) {
+            bindParts(output.first, output.second);
+        }
+    }
+
+    for (auto &&part : _parts) {
+        part._request->StartAsync();
+    }
+
+    // all the parts are finished before the error is reported, as they write the blobs of the request
+    StatusCode status = OK;
+    std::string failedDevice;
+    for (auto &&part : _parts) {
+        auto sts = part._request->Wait(IInferRequest::WaitMode::RESULT_READY);
+        if (sts != OK && status == OK) {
+            status = sts;
+            failedDevice = part._device;
+        }
+    }
+    if (status != OK) {
+        _cancellation.check();
+        THROW_IE_EXCEPTION << "The part of the batch inferred by " << failedDevice << " has failed with status " << status;
+    }
+    _timings.mark(&InferRequestTimings::executed_uSec);
+}
+
+void HeteroBatchSplitInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    perfMap.clear();
+    for (size_t i = 0; i < _parts.size(); i++) {
+        auto perfMapRequest = _parts[i]._request->GetPerformanceCounts();
+        for (auto &&r : perfMapRequest) {
+            perfMap[std::string("part") + std::to_string(i + 1) + " " + _parts[i]._device + ": " + r.first] = r.second;
+        }
+    }
+}
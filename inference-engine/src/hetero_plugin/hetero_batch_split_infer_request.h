@@ -0,0 +1,67 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the infer request of the data-parallel hetero mode
+ * @file hetero_batch_split_infer_request.h
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+#include <ie_common.h>
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <cpp/ie_infer_request.hpp>
+#include <cpp/ie_executable_network.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @class HeteroBatchSplitInferRequest
+ * @brief The request which infers the parts of its batch by the networks of the devices at the same time,
+ * the part requests read and write the parts of the blobs of the request in place
+ */
+class HeteroBatchSplitInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    typedef std::shared_ptr<HeteroBatchSplitInferRequest> Ptr;
+
+    struct BatchPartDesc {
+        std::string _device;
+        InferenceEngine::ExecutableNetwork::Ptr _network;
+        InferenceEngine::InferRequest::Ptr _request;
+        // the first image and the number of the images of the part
+        size_t _offset;
+        size_t _batch;
+    };
+    using BatchPartsList = std::vector<BatchPartDesc>;
+
+    explicit HeteroBatchSplitInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                          InferenceEngine::OutputsDataMap networkOutputs,
+                                          const BatchPartsList &parts,
+                                          size_t batch);
+
+    void InferImpl() override;
+
+    /**
+     * @brief Cancels the running part requests as well
+     */
+    void Cancel() override;
+
+    void
+    GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
+
+private:
+    void bindParts(const std::string &name, const InferenceEngine::Blob::Ptr &blob);
+
+    BatchPartsList _parts;
+    size_t _batch;
+    // the blobs whose parts are set to the part requests
+    std::map<std::string, InferenceEngine::Blob::Ptr> _boundBlobs;
+};
+
+}  // namespace HeteroPlugin
@@ -5,6 +5,7 @@
 
 #include "hetero_executable_network.h"
 #include "hetero_async_infer_request.h"
+#include "hetero_batch_split_infer_request.h"
 #include "ie_util_internal.hpp"
 #include "hetero_device_loader.h"
 
@@ -13,7 +14,11 @@
 #include <utility>
 #include <unordered_map>
 #include <fstream>
+#include <sstream>
 #include <algorithm>
+#include <chrono>
+#include <future>
+#include <limits>
 
 #include <ie_plugin_dispatcher.hpp>
 #include <ie_graph_splitter.hpp>
@@ -78,6 +83,122 @@ void dumpGraph(InferenceEngine::ICNNNetwork &network,
     saveGraphToDot(network, stream, split_color);
 }
 
+/**
+ * @brief The key of the split of the network, it depends on the layers and on the options of the fallback policy
+ */
+std::string getSplitKey(InferenceEngine::ICNNNetwork &network, const std::map<std::string, std::string> &config) {
+    std::map<std::string, std::string> layers;
+    details::CNNNetworkIterator i(&network);
+    while (i != details::CNNNetworkIterator()) {
+        CNNLayer::Ptr layer = *i;
+        std::stringstream ss;
+        ss << layer->type << " " << layer->precision.name();
+        for (auto &&param : layer->params) {
+            ss << " " << param.first << "=" << param.second;
+        }
+        for (auto &&input : layer->insData) {
+            ss << " <" << input.lock()->getName();
+        }
+        for (auto &&output : layer->outData) {
+            ss << " >" << output->getName();
+            for (auto dim : output->getDims()) {
+                ss << "," << dim;
+            }
+        }
+        layers[layer->name] = ss.str();
+        i++;
+    }
+
+    std::stringstream ss;
+    for (auto &&layer : layers) {
+        ss << layer.first << ":" << layer.second << ";";
+    }
+    for (auto &&key : {std::string("TARGET_FALLBACK"), std::string(KEY_HETERO_AFFINITY_POLICY),
+                       std::string(KEY_HETERO_DEVICE_SPEEDS), std::string(KEY_HETERO_TRANSFER_COST),
+                       std::string(KEY_HETERO_MIN_SUBGRAPH_SIZE)}) {
+        auto it = config.find(key);
+        ss << key << "=" << (it != config.end() ? it->second : "") << ";";
+    }
+    return std::to_string(std::hash<std::string>{}(ss.str()));
+}
+
+/**
+ * @brief Reads the subgraphs of the network from the cache file and sets the affinities of their layers
+ * @return false if the file is missing, damaged or was written for another network
+ */
+bool loadSplit(const std::string &path, const std::string &key, InferenceEngine::ICNNNetwork &network,
+               std::vector<LayersSet> &subgraphs) {
+    std::ifstream file(path);
+    std::string line;
+    if (!file || !std::getline(file, line) || line != "hetero_split " + key) {
+        return false;
+    }
+
+    std::map<std::string, CNNLayerPtr> layers;
+    details::CNNNetworkIterator i(&network);
+    while (i != details::CNNNetworkIterator()) {
+        layers[(*i)->name] = *i;
+        i++;
+    }
+
+    // the subgraph line holds the device and the number of the layers, a layer name per line follows it
+    std::vector<std::pair<std::string, LayersSet>> cached;
+    size_t cachedLayers = 0;
+    while (std::getline(file, line)) {
+        std::stringstream header(line);
+        std::string tag, device;
+        size_t size = 0;
+        if (!(header >> tag >> device >> size) || tag != "subgraph" || size == 0) {
+            return false;
+        }
+        LayersSet subgraph;
+        for (size_t l = 0; l < size; l++) {
+            auto layer = std::getline(file, line) ? layers.find(line) : layers.end();
+            if (layer == layers.end()) {
+                return false;
+            }
+            subgraph.insert(layer->second);
+        }
+        cachedLayers += size;
+        cached.emplace_back(device, std::move(subgraph));
+    }
+    if (cached.empty() || cachedLayers != layers.size()) {
+        return false;
+    }
+
+    subgraphs.clear();
+    for (auto &&subgraph : cached) {
+        for (auto &&layer : subgraph.second) {
+            layer->affinity = subgraph.first;
+        }
+        subgraphs.push_back(std::move(subgraph.second));
+    }
+    return true;
+}
+
+void storeSplit(const std::string &path, const std::string &key, const std::vector<LayersSet> &subgraphs) {
+    // the cache is optional, the network is loaded even if the file cannot be written
+    std::ofstream file(path, std::ofstream::out | std::ofstream::trunc);
+    file << "hetero_split " << key << "\n";
+    for (auto &&subgraph : subgraphs) {
+        file << "subgraph " << (*subgraph.begin())->affinity << " " << subgraph.size() << "\n";
+        for (auto &&layer : subgraph) {
+            file << layer->name << "\n";
+        }
+    }
+}
+
+// the batch split divides the blobs of the request in their first dimension, so it must be the batch, e.g. the
+// [1, 1, N, 7] output of DetectionOutput can't be split or merged by the images
+void checkBatchDim(const std::string &name, const TensorDesc &desc, size_t batch) {
+    const auto layout = desc.getLayout();
+    const auto &dims = desc.getDims();
+    if ((layout != NCHW && layout != NHWC && layout != NC) || dims.empty() || dims[0] != batch) {
+        THROW_IE_EXCEPTION << KEY_HETERO_BATCH_SPLIT << " needs the batch " << batch << " in the first dimension of"
+                           << " each input and output, but \'" << name << "\' doesn't have it";
+    }
+}
+
 }   // namespace
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(InferenceEngine::ICNNNetwork &network,
@@ -108,7 +229,42 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
     auto itDumpDotFile = config.find(KEY_HETERO_DUMP_GRAPH_DOT);
     bool dumpDotFile = itDumpDotFile != config.end() ? itDumpDotFile->second == YES : false;
 
-    if (allEmpty) {
+    auto itPipelineDepth = config.find(KEY_HETERO_PIPELINE_DEPTH);
+    if (itPipelineDepth != config.end()) {
+        try {
+            int depth = std::stoi(itPipelineDepth->second);
+            if (depth < 0) {
+                throw std::invalid_argument("negative depth");
+            }
+            _pipelineDepth = static_cast<size_t>(depth);
+        } catch (const std::exception &) {
+            THROW_IE_EXCEPTION << "Wrong value " << itPipelineDepth->second << " for property key "
+                               << KEY_HETERO_PIPELINE_DEPTH << ". Expected unsigned integer value";
+        }
+    }
+
+    auto itBatchSplit = config.find(KEY_HETERO_BATCH_SPLIT);
+    if (itBatchSplit != config.end() && itBatchSplit->second == YES) {
+        if (_pipelineDepth > 0) {
+            THROW_IE_EXCEPTION << KEY_HETERO_BATCH_SPLIT << " cannot be used with " << KEY_HETERO_PIPELINE_DEPTH;
+        }
+        loadBatchSplit(network, config, extensions);
+        return;
+    }
+
+    // the cached split of the default fallback policy skips the queries of the devices and the splitting
+    std::string splitCacheFile;
+    std::string splitKey;
+    std::vector<LayersSet> subgraphs;
+    bool splitCached = false;
+    auto itSplitCacheFile = config.find(KEY_HETERO_SPLIT_CACHE_FILE);
+    if (allEmpty && itSplitCacheFile != config.end() && !itSplitCacheFile->second.empty()) {
+        splitCacheFile = itSplitCacheFile->second;
+        splitKey = getSplitKey(network, config);
+        splitCached = loadSplit(splitCacheFile, splitKey, network, subgraphs);
+    }
+
+    if (allEmpty && !splitCached) {
         FallbackPolicy fbPolicy(_deviceLoaders, dumpDotFile);
         auto it = config.find("TARGET_FALLBACK");
         if (it != config.end()) {
@@ -154,7 +310,9 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
     OutputsDataMap externalOutputsData;
     network.getOutputsInfo(externalOutputsData);
 
-    auto subgraphs = splitGraph(network, getAffinities(network));
+    if (!splitCached) {
+        subgraphs = splitGraph(network, getAffinities(network));
+    }
 
     if (dumpDotFile) {
         char name[1024];
@@ -167,7 +325,12 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
         dumpGraph(network, subgraphs, file);
     }
 
-    sortSubgraphs(subgraphs);
+    if (!splitCached) {
+        sortSubgraphs(subgraphs);
+        if (!splitCacheFile.empty()) {
+            storeSplit(splitCacheFile, splitKey, subgraphs);
+        }
+    }
 
     std::vector<NetworkDesc> descs;
     PluginDispatcher dispatcher({ "" });
@@ -310,24 +473,177 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
         descs.emplace_back(std::move(desc));
     }
 
+    // the devices load their subgraphs at the same time. The subgraphs of a device are loaded one by one:
+    // HeteroDeviceLoader::LoadNetwork() calls SetConfig() of the plugin, which must not overlap with the
+    // other LoadNetwork() calls of the plugin even if they can run concurrently by themselves
+    std::map<std::string, std::vector<NetworkDesc *>> deviceDescs;
     for (auto &&d : descs) {
-        IExecutableNetwork::Ptr ret;
+        deviceDescs[d._device].push_back(&d);
+    }
+    std::vector<std::future<void>> loadings;
+    for (auto &&device : deviceDescs) {
+        auto &deviceSubgraphs = device.second;
+        loadings.push_back(std::async(std::launch::async, [&config, &deviceSubgraphs]() {
+            for (auto d : deviceSubgraphs) {
+                IExecutableNetwork::Ptr ret;
+                ResponseDesc resp;
+                StatusCode status = d->_deviceLoader->LoadNetwork(d->_device, ret, *d->_clonedNetwork, config, &resp);
+                if (status != OK) {
+                    THROW_IE_EXCEPTION << resp.msg;
+                }
+                d->network = std::make_shared<ExecutableNetwork>(ret);
+                d->_clonedNetwork = nullptr;
+            }
+        }));
+    }
+    // all the loadings are finished before the first error is reported
+    std::exception_ptr loadingError;
+    for (auto &&loading : loadings) {
+        try {
+            loading.get();
+        } catch (...) {
+            if (!loadingError) {
+                loadingError = std::current_exception();
+            }
+        }
+    }
+    if (loadingError) {
+        std::rethrow_exception(loadingError);
+    }
+
+
+    networks = std::move(descs);
+}
+
+void HeteroExecutableNetwork::loadBatchSplit(InferenceEngine::ICNNNetwork &network,
+                                             const std::map<std::string, std::string> &config,
+                                             const std::vector<InferenceEngine::IExtensionPtr> &extensions) {
+    auto itFallback = config.find("TARGET_FALLBACK");
+    if (itFallback == config.end() || itFallback->second.empty()) {
+        THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
+    }
+    std::vector<std::string> devices;
+    std::stringstream list(itFallback->second);
+    for (std::string device; std::getline(list, device, ',');) {
+        if (!device.empty()) {
+            devices.push_back(device);
+        }
+    }
+
+    _batch = network.getBatchSize();
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (auto &&input : inputs) {
+        checkBatchDim(input.first, input.second->getTensorDesc(), _batch);
+    }
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    for (auto &&output : outputs) {
+        checkBatchDim(output.first, output.second->getTensorDesc(), _batch);
+    }
+
+    // each device infers the whole network
+    for (auto &&device : devices) {
+        if (_deviceLoaders.find(device) == _deviceLoaders.end()) {
+            IHeteroDeviceLoader::Ptr loader;
+            loader = std::make_shared<HeteroDeviceLoader>(device);
+            HeteroDeviceLoader *pdl = dynamic_cast<HeteroDeviceLoader *>(loader.get());
+            pdl->initConfigs(config, extensions);
+            _deviceLoaders[device] = loader;
+        }
+        QueryNetworkResult result;
+        _deviceLoaders[device]->QueryNetwork(device, network, config, result);
+        details::CNNNetworkIterator i(&network);
+        while (i != details::CNNNetworkIterator()) {
+            CNNLayer::Ptr layer = *i;
+            if (!CaselessEq<std::string>()(layer->type, "input") &&
+                result.supportedLayers.find(layer->name) == result.supportedLayers.end()) {
+                THROW_IE_EXCEPTION << "The batch split needs the whole network on each device, but the layer (Name:"
+                                   << layer->name << ", Type: " << layer->type << ") is not supported by " << device;
+            }
+            i++;
+        }
+    }
+
+    auto loadPart = [&](const std::string &device, size_t batch) {
+        auto part = cloneNet(network);
         ResponseDesc resp;
-        StatusCode status = d._deviceLoader->LoadNetwork(d._device, ret, *d._clonedNetwork, config, &resp);
-        if (status != OK) {
+        if (part->setBatchSize(batch, &resp) != OK) {
             THROW_IE_EXCEPTION << resp.msg;
         }
-        d.network = std::make_shared<ExecutableNetwork>(ret);
-        d._clonedNetwork = nullptr;
+        IExecutableNetwork::Ptr ret;
+        if (_deviceLoaders[device]->LoadNetwork(device, ret, *part, config, &resp) != OK) {
+            THROW_IE_EXCEPTION << resp.msg;
+        }
+        // the part requests write the parts of the blobs of the request, so their blobs hold their batch only
+        auto executable = std::make_shared<ExecutableNetwork>(ret);
+        for (auto &&input : executable->GetInputsInfo()) {
+            checkBatchDim(input.first, input.second->getTensorDesc(), batch);
+        }
+        for (auto &&output : executable->GetOutputsInfo()) {
+            checkBatchDim(output.first, output.second->getTensorDesc(), batch);
+        }
+        return executable;
+    };
+
+    std::map<std::string, double> speeds;
+    auto itSpeeds = config.find(KEY_HETERO_DEVICE_SPEEDS);
+    if (itSpeeds != config.end()) {
+        speeds = FallbackPolicy::parseDeviceSpeeds(itSpeeds->second);
+    } else {
+        // the speed is the number of the images of the batch 1 inferred per second, the first inference warms up;
+        // the network of the batch 1 is loaded on each device for the measurement only and released after it
+        const int measuredInferences = 3;
+        for (auto &&device : devices) {
+            auto request = loadPart(device, 1)->CreateInferRequest();
+            request.Infer();
+            auto best = std::numeric_limits<double>::max();
+            for (int i = 0; i < measuredInferences; i++) {
+                auto start = std::chrono::high_resolution_clock::now();
+                request.Infer();
+                std::chrono::duration<double> time = std::chrono::high_resolution_clock::now() - start;
+                best = std::min(best, time.count());
+            }
+            speeds[device] = 1.0 / std::max(best, std::numeric_limits<double>::epsilon());
+        }
     }
 
+    // the images are split in proportion to the speeds, the rest of the rounding goes to the largest remainders
+    double totalSpeed = 0;
+    for (auto &&device : devices) {
+        totalSpeed += speeds.count(device) ? speeds[device] : 1;
+    }
+    std::vector<size_t> shares;
+    std::vector<std::pair<double, size_t>> remainders;
+    size_t assigned = 0;
+    for (size_t d = 0; d < devices.size(); d++) {
+        double exact = _batch * (speeds.count(devices[d]) ? speeds[devices[d]] : 1) / totalSpeed;
+        shares.push_back(static_cast<size_t>(exact));
+        remainders.emplace_back(exact - shares.back(), d);
+        assigned += shares.back();
+    }
+    std::stable_sort(remainders.begin(), remainders.end(),
+                     [](const std::pair<double, size_t> &a, const std::pair<double, size_t> &b) { return a.first > b.first; });
+    for (size_t r = 0; assigned < _batch; r++, assigned++) {
+        shares[remainders[r % remainders.size()].second]++;
+    }
 
-    networks = std::move(descs);
+    size_t offset = 0;
+    for (size_t d = 0; d < devices.size(); d++) {
+        if (shares[d] == 0) {
+            continue;
+        }
+        HeteroBatchSplitInferRequest::BatchPartDesc part;
+        part._device = devices[d];
+        part._network = loadPart(devices[d], shares[d]);
+        part._offset = offset;
+        part._batch = shares[d];
+        _batchParts.push_back(part);
+        offset += shares[d];
+    }
 }
 
-InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
-        InputsDataMap networkInputs,
-        OutputsDataMap networkOutputs) {
+HeteroInferRequest::SubRequestsList HeteroExecutableNetwork::createSubRequestsList() {
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto i : networks) {
@@ -339,12 +655,56 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
 
         inferRequests.push_back(desc);
     }
+    return inferRequests;
+}
+
+InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
+        InputsDataMap networkInputs,
+        OutputsDataMap networkOutputs) {
+    if (!_batchParts.empty()) {
+        return std::make_shared<HeteroBatchSplitInferRequest>(networkInputs,
+                                                              networkOutputs,
+                                                              _batchParts,
+                                                              _batch);
+    }
+
+    if (_pipelineDepth == 0) {
+        return std::make_shared<HeteroInferRequest>(networkInputs,
+                                                    networkOutputs,
+                                                    createSubRequestsList());
+    }
+
+    {
+        // the lanes are created with the first request, as the inputs and outputs are set after the loading
+        std::lock_guard<std::mutex> lock(_pipelineMutex);
+        if (!_pipeline) {
+            std::vector<HeteroInferRequest::Ptr> lanes;
+            for (size_t i = 0; i < _pipelineDepth; i++) {
+                lanes.push_back(std::make_shared<HeteroInferRequest>(_networkInputs,
+                                                                     _networkOutputs,
+                                                                     createSubRequestsList()));
+            }
+            _pipeline = std::make_shared<HeteroPipeline>(lanes);
+        }
+    }
     return std::make_shared<HeteroInferRequest>(networkInputs,
                                                 networkOutputs,
-                                                inferRequests);
+                                                _pipeline);
 }
 
 void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
+    if (!_batchParts.empty()) {
+        // the parts of the batch are inferred in parallel by the synchronous request
+        auto syncRequest = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+        syncRequest->setPointerToExecutableNetworkInternal(shared_from_this());
+        auto asyncTreadSafeImpl = std::make_shared<AsyncInferRequestThreadSafeDefault>(
+                syncRequest, _taskExecutor, _taskSynchronizer, _callbackExecutor);
+        asyncRequest.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncTreadSafeImpl),
+                           [](IInferRequest *p) { p->Release(); });
+        asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+        return;
+    }
+
     auto heteroInferRequest = std::dynamic_pointer_cast<HeteroInferRequest>(
             CreateInferRequestImpl(_networkInputs, _networkOutputs));
     heteroInferRequest->setPointerToExecutableNetworkInternal(shared_from_this());
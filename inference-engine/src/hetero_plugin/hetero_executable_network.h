@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -23,6 +24,8 @@
 #include "hetero_infer_request.h"
 #include "cnn_network_impl.hpp"
 #include "hetero_async_infer_request.h"
+#include "hetero_pipeline.h"
+#include "hetero_batch_split_infer_request.h"
 
 namespace HeteroPlugin {
 
@@ -61,6 +64,15 @@ public:
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
 
 private:
+    /**
+     * @brief Loads the whole network on each device of TARGET_FALLBACK with the part of the batch of the device
+     */
+    void loadBatchSplit(InferenceEngine::ICNNNetwork &network,
+                        const std::map<std::string, std::string> &config,
+                        const std::vector<InferenceEngine::IExtensionPtr> &extensions);
+
+    HeteroInferRequest::SubRequestsList createSubRequestsList();
+
     struct NetworkDesc {
         std::string _device;
         InferenceEngine::details::CNNNetworkImplPtr _clonedNetwork;
@@ -71,6 +83,15 @@ private:
     };
     std::vector<NetworkDesc> networks;
 
+    // the number of the lanes of the pipeline, 0 if the requests run their subgraphs by themselves
+    size_t _pipelineDepth = 0;
+    HeteroPipeline::Ptr _pipeline;
+    std::mutex _pipelineMutex;
+
+    // the networks of the devices of the batch split mode
+    HeteroBatchSplitInferRequest::BatchPartsList _batchParts;
+    size_t _batch = 0;
+
     InferenceEngine::MapDeviceLoaders &_deviceLoaders;
 };
 
@@ -4,18 +4,33 @@
 //
 
 #include "hetero_infer_request.h"
+#include "hetero_pipeline.h"
 #include <ie_blob.h>
 #include <ie_plugin.hpp>
 #include <ie_util_internal.hpp>
 #include <description_buffer.hpp>
 #include <debug.h>
 #include <ie_layouts.h>
+#include <blob_factory.hpp>
 #include <assert.h>
+#include <future>
+#include <algorithm>
 #include "ie_profiling.hpp"
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
 
+namespace {
+// the devices which share the memory with the host, e.g. the integrated GPU, use the host buffers of
+// such alignment in place
+const size_t sharedAddressAlignment = 4096;
+const size_t sharedSizeAlignment = 64;
+
+bool isSharedBuffer(const Blob::Ptr &blob) {
+    return reinterpret_cast<uintptr_t>(blob->cbuffer().as<const void *>()) % sharedAddressAlignment == 0;
+}
+}  // namespace
+
 HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                        InferenceEngine::OutputsDataMap networkOutputs,
                                        const SubRequestsList &inferRequests) :
@@ -45,6 +60,11 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
                 r->SetBlob(e.c_str(), _blobs[e]);
             } else {
                 _blobs[e] = r->GetBlob(e.c_str());
+                if (!isSharedBuffer(_blobs[e])) {
+                    // the subgraph writes the blob to the buffer the next ones read without copying it
+                    _blobs[e] = allocateSharedBlob(_blobs[e]->getTensorDesc());
+                    r->SetBlob(e.c_str(), _blobs[e]);
+                }
             }
         }
     });
@@ -64,20 +84,185 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
             requestBlob(e, r._request);
         }
     }
+
+    buildSubgraphsDependencies();
+
+    // the nodes of the maps of the blobs are kept, so the bindings refer to their values
+    for (auto &&desc : _inferRequests) {
+        for (auto &&name : desc._iNames) {
+            auto it = _inputs.find(name);
+            if (it != _inputs.end()) {
+                _bindings.push_back({desc._request, name, true, &it->second, it->second});
+            }
+        }
+        for (auto &&name : desc._oNames) {
+            auto it = _outputs.find(name);
+            if (it != _outputs.end()) {
+                _bindings.push_back({desc._request, name, false, &it->second, it->second});
+            }
+        }
+    }
+}
+
+HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                       InferenceEngine::OutputsDataMap networkOutputs,
+                                       const std::shared_ptr<HeteroPipeline> &pipeline) :
+        InferRequestInternal(networkInputs, networkOutputs),
+        _pipeline(pipeline) {
+    if (_networkOutputs.empty() || _networkInputs.empty()) {
+        THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
+    }
+
+    auto allocateBlob([&](const std::string &name) {
+        auto blob = make_blob_with_precision(_pipeline->GetBlobDesc(name));
+        blob->allocate();
+        return blob;
+    });
+
+    for (auto &&input : _networkInputs) {
+        _inputs[input.first] = allocateBlob(input.first);
+    }
+    for (auto &&output : _networkOutputs) {
+        _outputs[output.first] = allocateBlob(output.first);
+    }
+}
+
+bool HeteroInferRequest::isPipelined() const {
+    return _pipeline != nullptr;
+}
+
+void HeteroInferRequest::startPipelined(const std::function<void(StatusCode)> &callback) {
+    BlobMap blobs;
+    for (auto &&input : _inputs) {
+        auto it = _preProcData.find(input.first);
+        blobs[input.first] = it != _preProcData.end() ? it->second.getRoiBlob() : input.second;
+    }
+    for (auto &&output : _outputs) {
+        blobs[output.first] = output.second;
+    }
+    _pipeline->Start(blobs, [this, callback](StatusCode sts, size_t lane) {
+        _lane = lane;
+        callback(sts);
+    });
+}
+
+Blob::Ptr HeteroInferRequest::allocateSharedBlob(const TensorDesc &desc) {
+    size_t byteSize = desc.getPrecision().size();
+    for (auto dim : desc.getDims()) {
+        byteSize *= dim;
+    }
+    byteSize = (byteSize + sharedSizeAlignment - 1) / sharedSizeAlignment * sharedSizeAlignment;
+
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[byteSize + sharedAddressAlignment]);
+    auto address = reinterpret_cast<uintptr_t>(buffer.get());
+    auto aligned = reinterpret_cast<uint8_t *>((address + sharedAddressAlignment - 1) / sharedAddressAlignment * sharedAddressAlignment);
+    _sharedBuffers.push_back(std::move(buffer));
+    return make_blob_with_precision(desc, aligned);
+}
+
+void HeteroInferRequest::SetBlob(const char *name, const Blob::Ptr &data) {
+    InferRequestInternal::SetBlob(name, data);
+    _blobsChanged = true;
+}
+
+void HeteroInferRequest::Cancel() {
+    InferRequestInternal::Cancel();
+    // the plugins not supporting the cancellation complete their subgraphs, the status is not checked
+    for (auto &&desc : _inferRequests) {
+        static_cast<IInferRequest::Ptr &>(*desc._request)->Cancel(nullptr);
+    }
 }
 
 void HeteroInferRequest::InferImpl() {
+    if (_pipeline) {
+        std::promise<StatusCode> frame;
+        auto frameStatus = frame.get_future();
+        startPipelined([&frame](StatusCode sts) {
+            frame.set_value(sts);
+        });
+        auto sts = frameStatus.get();
+        if (sts != OK) {
+            THROW_IE_EXCEPTION << "The pipeline of the subgraphs has failed with status " << sts;
+        }
+        return;
+    }
+
     updateInOutIfNeeded();
-    size_t i = 0;
-    for (auto &&desc : _inferRequests) {
-        IE_PROFILING_AUTO_SCOPE_TASK(desc._profilingTask);
-        auto &r = desc._request;
-        assert(nullptr != r);
-        r->Infer();
+    _asyncInference = false;
+    for (auto &&level : _levels) {
+        _cancellation.check();
+        if (level.size() == 1) {
+            auto &desc = _inferRequests[level.front()];
+            IE_PROFILING_AUTO_SCOPE_TASK(desc._profilingTask);
+            assert(nullptr != desc._request);
+            try {
+                desc._request->Infer();
+            } catch (...) {
+                // the subgraph stopped by the cancellation of the request reports it as the request's own one
+                _cancellation.check();
+                throw;
+            }
+            continue;
+        }
+        // the independent subgraphs run on their devices at the same time, the started ones are waited for before
+        // the error is thrown, so none of them writes the blobs after the request has completed
+        std::exception_ptr startError;
+        size_t started = 0;
+        try {
+            for (auto i : level) {
+                _inferRequests[i]._request->StartAsync();
+                started++;
+            }
+        } catch (...) {
+            startError = std::current_exception();
+        }
+        StatusCode status = OK;
+        for (size_t s = 0; s < started; s++) {
+            auto sts = _inferRequests[level[s]]._request->Wait(IInferRequest::WaitMode::RESULT_READY);
+            if (status == OK) {
+                status = sts;
+            }
+        }
+        if (startError) {
+            std::rethrow_exception(startError);
+        }
+        if (status != OK) {
+            _cancellation.check();
+            THROW_IE_EXCEPTION << "The subgraph request has failed with status " << status;
+        }
+    }
+    // the subgraphs write the outputs of the request, the stages of each subgraph are reported by its own request
+    _timings.mark(&InferRequestTimings::executed_uSec);
+}
+
+void HeteroInferRequest::buildSubgraphsDependencies() {
+    // the subgraphs are sorted topologically, so a subgraph reads only the outputs of the previous ones
+    std::vector<size_t> levels(_inferRequests.size(), 0);
+    for (size_t j = 0; j < _inferRequests.size(); j++) {
+        for (size_t i = 0; i < j; i++) {
+            auto &producer = _inferRequests[i];
+            bool depends = std::any_of(_inferRequests[j]._iNames.begin(), _inferRequests[j]._iNames.end(),
+                                       [&](const std::string &name) { return producer._oNames.count(name) != 0; });
+            if (depends) {
+                producer._dependents.push_back(j);
+                _inferRequests[j]._dependencies++;
+                levels[j] = std::max(levels[j], levels[i] + 1);
+            }
+        }
+        if (_levels.size() <= levels[j]) {
+            _levels.resize(levels[j] + 1);
+        }
+        _levels[levels[j]].push_back(j);
     }
+    _pendingDependencies.reset(new std::atomic<size_t>[_inferRequests.size()]);
 }
 
 void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    if (_pipeline) {
+        _pipeline->GetPerformanceCounts(_lane, perfMap);
+        return;
+    }
+
     perfMap.clear();
     for (size_t i = 0; i < _inferRequests.size(); i++) {
         auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
@@ -90,61 +275,107 @@ void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEng
 void HeteroInferRequest::updateInOutIfNeeded() {
     IE_PROFILING_AUTO_SCOPE(updateInOutIfNeeded);
     assert(!_inferRequests.empty());
-    for (auto &&desc : _inferRequests) {
-        auto &r = desc._request;
-        assert(nullptr != r);
-        for (auto &&ioname : desc._iNames) {
-            auto iti = _inputs.find(ioname);
-            if (iti != _inputs.end()) {
-                auto it = _preProcData.find(ioname);
-                if (it != _preProcData.end()) {
-                    if (it->second.getRoiBlob() != _blobs[ioname]) {
-                        r->SetBlob(ioname.c_str(), it->second.getRoiBlob());
-                        _blobs[ioname] = iti->second;
-                    }
-                } else {
-                    if (iti->second != _blobs[ioname]) {
-                        r->SetBlob(ioname.c_str(), iti->second);
-                        _blobs[ioname] = iti->second;
-                    }
-                }
+    // the intermediate blobs are bound once by the constructor
+    if (!_blobsChanged) {
+        return;
+    }
+    _blobsChanged = false;
+    for (auto &&binding : _bindings) {
+        Blob::Ptr blob = *binding._source;
+        if (binding._isInput) {
+            auto it = _preProcData.find(binding._name);
+            if (it != _preProcData.end()) {
+                blob = it->second.getRoiBlob();
             }
         }
-        for (auto &&ioname : desc._oNames) {
-            auto ito = _outputs.find(ioname);
-            if (ito != _outputs.end()) {
-                if (ito->second != _blobs[ioname]) {
-                    r->SetBlob(ioname.c_str(), ito->second);
-                    _blobs[ioname] = ito->second;
-                }
-            }
+        if (blob != binding._bound) {
+            binding._request->SetBlob(binding._name.c_str(), blob);
+            binding._bound = blob;
         }
     }
 }
 
 void HeteroInferRequest::startFirstAsyncRequest() {
-    auto firstAsyncRequest = _inferRequests.begin()->_request;
-    firstAsyncRequest->StartAsync();
+    for (size_t i = 0; i < _inferRequests.size(); i++) {
+        _pendingDependencies[i] = _inferRequests[i]._dependencies;
+    }
+    _pendingRequests = _inferRequests.size();
+    _asyncFailed = false;
+    _asyncErrorRequest = InferRequest();
+    _asyncCancelled = false;
+    _asyncInference = true;
+    // the subgraphs of the first level don't read the outputs of others
+    for (auto i : _levels.front()) {
+        _inferRequests[i]._request->StartAsync();
+    }
 }
 
 void HeteroInferRequest::setCallbackForLastRequest(std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)>& callback) {
-    auto lastRequest = _inferRequests.back()._request;
-    if (lastRequest) lastRequest->SetCompletionCallback(callback);
+    _lastRequestCallback = callback;
 }
 
 void HeteroInferRequest::setCallbackSequence() {
-    for (auto desc = _inferRequests.begin(); desc != _inferRequests.end(); desc++) {
-        auto &currentAsyncRequest = desc->_request;
-        auto nextRequestDesc = std::next(desc);
-        if (nextRequestDesc != _inferRequests.end()) {
-            currentAsyncRequest->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                    [=](InferRequest request, StatusCode sts) {
-                        IE_PROFILING_AUTO_SCOPE(Callback)
-                        if (sts == OK) {
-                            nextRequestDesc->_request->StartAsync();
-                        }
-                    });
+    for (size_t i = 0; i < _inferRequests.size(); i++) {
+        _inferRequests[i]._request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [this, i](InferRequest request, StatusCode sts) {
+                    IE_PROFILING_AUTO_SCOPE(Callback)
+                    onSubRequestCompleted(i, request, sts);
+                });
+    }
+}
+
+void HeteroInferRequest::onSubRequestCompleted(size_t index, InferRequest request, StatusCode sts) {
+    // the subgraphs started by the synchronous inference don't start the others
+    if (!_asyncInference) {
+        return;
+    }
+    if (sts != OK) {
+        failAsync(request, sts);
+    } else if (!_inferRequests[index]._dependents.empty() && _cancellation.isCancelled()) {
+        // the cancelled or late request doesn't start the next subgraphs, it completes as the failed one
+        _asyncCancelled = true;
+        failAsync(request, INFER_CANCELLED);
+    }
+    releaseDependents(index, request);
+    completeSubRequest(request, sts);
+}
+
+void HeteroInferRequest::failAsync(InferRequest request, StatusCode sts) {
+    // the first error is kept, it is written before the subgraph is counted as completed
+    if (!_asyncFailed.exchange(true)) {
+        _asyncErrorRequest = request;
+        _asyncErrorStatus = sts;
+    }
+}
+
+void HeteroInferRequest::releaseDependents(size_t index, InferRequest request) {
+    for (auto dependent : _inferRequests[index]._dependents) {
+        if (--_pendingDependencies[dependent] != 0) {
+            continue;
+        }
+        if (!_asyncFailed) {
+            try {
+                _inferRequests[dependent]._request->StartAsync();
+                continue;
+            } catch (...) {
+                failAsync(request, GENERAL_ERROR);
+            }
         }
+        // the dependents of the failed subgraph are not started, they complete at once
+        releaseDependents(dependent, request);
+        completeSubRequest(request, INFER_NOT_STARTED);
+    }
+}
+
+void HeteroInferRequest::completeSubRequest(InferRequest request, StatusCode sts) {
+    // the callback is called once, when all the subgraphs have completed or have been skipped
+    if (--_pendingRequests != 0 || !_lastRequestCallback) {
+        return;
+    }
+    if (_asyncFailed) {
+        _lastRequestCallback(_asyncErrorRequest, _asyncErrorStatus);
+    } else {
+        _lastRequestCallback(request, sts);
     }
 }
 
@@ -162,6 +393,10 @@ StatusCode HeteroInferRequest::waitAllRequests(int64_t millis_timeout) {
         status = it->_request->Wait(millis_timeout);
         msLeft = std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::high_resolution_clock::now() - startTime).count();
+        // the subgraphs after the cancellation are not started
+        if (INFER_NOT_STARTED == status && _asyncCancelled) {
+            continue;
+        }
         if (OK != status) {
             return status;
         }
@@ -173,5 +408,5 @@ StatusCode HeteroInferRequest::waitAllRequests(int64_t millis_timeout) {
             }
         }
     }
-    return status;
+    return _asyncCancelled ? INFER_CANCELLED : status;
 }
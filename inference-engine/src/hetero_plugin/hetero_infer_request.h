@@ -14,6 +14,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <functional>
+#include <atomic>
 #include <unordered_set>
 #include <ie_common.h>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
@@ -23,6 +25,8 @@
 
 namespace HeteroPlugin {
 
+class HeteroPipeline;
+
 class HeteroInferRequest : public InferenceEngine::InferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
@@ -33,6 +37,9 @@ public:
         std::unordered_set<std::string> _iNames;
         std::unordered_set<std::string> _oNames;
         InferenceEngine::ProfilingTask _profilingTask;
+        // the subgraphs which read the outputs of this one and the number of the subgraphs this one reads
+        std::vector<size_t> _dependents;
+        size_t _dependencies = 0;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -40,8 +47,22 @@ public:
                                 InferenceEngine::OutputsDataMap networkOutputs,
                                 const SubRequestsList &inferRequests);
 
+    /**
+     * @brief The request whose frames run on the lanes of the pipeline, it holds only its input and output blobs
+     */
+    explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                InferenceEngine::OutputsDataMap networkOutputs,
+                                const std::shared_ptr<HeteroPipeline> &pipeline);
+
     void InferImpl() override;
 
+    void SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) override;
+
+    /**
+     * @brief Cancels the running subgraph requests as well, the next subgraphs are not started
+     */
+    void Cancel() override;
+
     void
     GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
@@ -57,9 +78,61 @@ public:
 
     bool isAnyRequestBusy();
 
+    bool isPipelined() const;
+
+    /**
+     * @brief Starts the frame of the input and output blobs of the request on the pipeline
+     * @param callback - the callback called with the status of the frame
+     */
+    void startPipelined(const std::function<void(InferenceEngine::StatusCode)> &callback);
+
 private:
+    /**
+     * @brief The input or output blob of the request set to a subgraph request
+     */
+    struct BlobBinding {
+        InferenceEngine::InferRequest::Ptr _request;
+        std::string _name;
+        bool _isInput;
+        const InferenceEngine::Blob::Ptr *_source;
+        InferenceEngine::Blob::Ptr _bound;
+    };
+
+    InferenceEngine::Blob::Ptr allocateSharedBlob(const InferenceEngine::TensorDesc &desc);
+
+    void buildSubgraphsDependencies();
+
+    void onSubRequestCompleted(size_t index, InferenceEngine::InferRequest request, InferenceEngine::StatusCode sts);
+    // keeps the first error of the asynchronous inference
+    void failAsync(InferenceEngine::InferRequest request, InferenceEngine::StatusCode sts);
+    // starts the dependents of the completed subgraph, or completes them without starting after a failure
+    void releaseDependents(size_t index, InferenceEngine::InferRequest request);
+    // counts the subgraph as completed, the last one calls the callback of the request
+    void completeSubRequest(InferenceEngine::InferRequest request, InferenceEngine::StatusCode sts);
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
+    // the buffers of the intermediate blobs allocated to be shared by the devices of the subgraphs
+    std::vector<std::unique_ptr<uint8_t[]>> _sharedBuffers;
+    // the blobs of the subgraph requests are bound again only after the blobs of the request are set
+    bool _blobsChanged = false;
+    std::vector<BlobBinding> _bindings;
+    // the subgraphs of a level depend only on the subgraphs of the previous levels, so they run at the same time
+    std::vector<std::vector<size_t>> _levels;
+    // the state of the asynchronous inference, the completed subgraphs start their dependents
+    std::unique_ptr<std::atomic<size_t>[]> _pendingDependencies;
+    std::atomic<size_t> _pendingRequests{0};
+    std::atomic<bool> _asyncFailed{false};
+    // the first failed subgraph and its status, reported by the callback when all the subgraphs have completed
+    InferenceEngine::InferRequest _asyncErrorRequest;
+    InferenceEngine::StatusCode _asyncErrorStatus = InferenceEngine::OK;
+    std::atomic<bool> _asyncCancelled{false};
+    std::atomic<bool> _asyncInference{false};
+    // it is also called when one of the subgraph requests has failed, so the request is not left busy
+    std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)> _lastRequestCallback;
+    std::shared_ptr<HeteroPipeline> _pipeline;
+    // the lane the last frame of the request ran on
+    size_t _lane = 0;
 };
 
 }  // namespace HeteroPlugin
@@ -0,0 +1,112 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_pipeline.h"
+#include <ie_profiling.hpp>
+#include <utility>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroPipeline::HeteroPipeline(const std::vector<HeteroInferRequest::Ptr> &lanes) :
+        _executor(std::make_shared<TaskExecutor>("HeteroPipeline")) {
+    if (lanes.empty()) {
+        THROW_IE_EXCEPTION << "Internal error: no lanes for the pipeline of the subgraphs";
+    }
+    _lanes.resize(lanes.size());
+    for (size_t i = 0; i < lanes.size(); i++) {
+        _lanes[i]._request = lanes[i];
+        _lanes[i]._request->setCallbackSequence();
+
+        std::function<void(InferRequest, StatusCode)> f =
+            [this, i](InferRequest /*request*/, StatusCode sts) {
+                onLaneCompleted(i, sts);
+            };
+        _lanes[i]._request->setCallbackForLastRequest(f);
+        _freeLanes.push_back(i);
+    }
+}
+
+HeteroPipeline::~HeteroPipeline() {
+    // the waiting frames are started before the lanes are destroyed
+    _executor.reset();
+    for (auto &&lane : _lanes) {
+        lane._request->waitAllRequests(IInferRequest::WaitMode::RESULT_READY);
+    }
+}
+
+void HeteroPipeline::Start(const BlobMap &blobs, const FrameCallback &callback) {
+    size_t lane = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_freeLanes.empty()) {
+            _waitingFrames.push_back({blobs, callback});
+            return;
+        }
+        lane = _freeLanes.back();
+        _freeLanes.pop_back();
+    }
+    run(lane, {blobs, callback});
+}
+
+void HeteroPipeline::run(size_t lane, Frame frame) {
+    IE_PROFILING_AUTO_SCOPE(HeteroPipeline_Run)
+    auto &l = _lanes[lane];
+    l._frame = std::move(frame);
+    try {
+        for (auto &&blob : l._frame._blobs) {
+            l._request->SetBlob(blob.first.c_str(), blob.second);
+        }
+        l._request->updateInOutIfNeeded();
+        l._request->startFirstAsyncRequest();
+    } catch (...) {
+        onLaneCompleted(lane, GENERAL_ERROR);
+    }
+}
+
+void HeteroPipeline::onLaneCompleted(size_t lane, StatusCode sts) {
+    Frame frame = std::move(_lanes[lane]._frame);
+    if (frame._callback) {
+        frame._callback(sts, lane);
+    }
+
+    // the lane is freed after the callback, so the frames started by the callback wait for it in the queue
+    bool hasWaitingFrame = false;
+    Frame waitingFrame;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_waitingFrames.empty()) {
+            _freeLanes.push_back(lane);
+        } else {
+            waitingFrame = std::move(_waitingFrames.front());
+            _waitingFrames.pop_front();
+            hasWaitingFrame = true;
+        }
+    }
+
+    if (hasWaitingFrame) {
+        // the first subgraph request of the lane may be the one whose callback is running
+        auto task = std::make_shared<Task>([this, lane, waitingFrame]() {
+            run(lane, waitingFrame);
+        });
+        _executor->startTask(task);
+    }
+}
+
+void HeteroPipeline::GetPerformanceCounts(size_t lane, std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    if (lane >= _lanes.size()) {
+        THROW_IE_EXCEPTION << "Internal error: no lane " << lane << " in the pipeline of the subgraphs";
+    }
+    _lanes[lane]._request->GetPerformanceCounts(perfMap);
+}
+
+TensorDesc HeteroPipeline::GetBlobDesc(const std::string &name) const {
+    Blob::Ptr blob;
+    _lanes.front()._request->GetBlob(name.c_str(), blob);
+    if (!blob) {
+        THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find the blob with name: \'" << name << "\'";
+    }
+    return blob->getTensorDesc();
+}
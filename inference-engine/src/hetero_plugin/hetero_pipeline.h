@@ -0,0 +1,87 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the pipeline of the subgraph requests
+ * @file hetero_pipeline.h
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <functional>
+
+#include <ie_common.h>
+#include <cpp_interfaces/ie_task_executor.hpp>
+
+#include "hetero_infer_request.h"
+
+namespace HeteroPlugin {
+
+/**
+ * @class HeteroPipeline
+ * @brief The lanes of the subgraph requests the frames of the hetero requests run on.
+ * A lane holds a request of each subgraph and their intermediate blobs, the subgraph requests start one another,
+ * so the frames of different lanes run on their devices at the same time
+ */
+class HeteroPipeline {
+public:
+    typedef std::shared_ptr<HeteroPipeline> Ptr;
+
+    /**
+     * @brief The callback of the frame, it is called with the status and the number of the lane the frame ran on
+     */
+    using FrameCallback = std::function<void(InferenceEngine::StatusCode, size_t)>;
+
+    explicit HeteroPipeline(const std::vector<HeteroInferRequest::Ptr> &lanes);
+
+    ~HeteroPipeline();
+
+    /**
+     * @brief Starts the frame on a free lane, the frame waits for the first freed lane when all of them are busy
+     * @param blobs - the input and output blobs of the frame by their names
+     * @param callback - the callback called when the last subgraph of the frame is done or one of them has failed
+     */
+    void Start(const InferenceEngine::BlobMap &blobs, const FrameCallback &callback);
+
+    /**
+     * @brief The counters of the last frame which ran on the lane
+     */
+    void GetPerformanceCounts(size_t lane, std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
+
+    /**
+     * @brief The tensor descriptor of the input or output blob of the lanes
+     */
+    InferenceEngine::TensorDesc GetBlobDesc(const std::string &name) const;
+
+private:
+    struct Frame {
+        InferenceEngine::BlobMap _blobs;
+        FrameCallback _callback;
+    };
+
+    struct Lane {
+        HeteroInferRequest::Ptr _request;
+        Frame _frame;
+    };
+
+    void run(size_t lane, Frame frame);
+
+    void onLaneCompleted(size_t lane, InferenceEngine::StatusCode sts);
+
+    std::vector<Lane> _lanes;
+    std::vector<size_t> _freeLanes;
+    std::deque<Frame> _waitingFrames;
+    std::mutex _mutex;
+    // the waiting frames are started apart from the callbacks of the subgraph requests of the freed lane
+    InferenceEngine::TaskExecutor::Ptr _executor;
+};
+
+}  // namespace HeteroPlugin
@@ -0,0 +1,343 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "blob_transform.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <ie_parallel.hpp>
+#include "precision_utils.h"
+
+namespace InferenceEngine {
+
+namespace {
+
+// the blobs smaller than this number of elements are copied by the calling thread
+const size_t parallel_threshold = 64 * 1024;
+// the contiguous rows are split into the chunks of this number of elements for the parallel copy
+const size_t row_chunk_size = 16 * 1024;
+// the side of the square tile of the transposition, the tile of FP32 is 4KB
+const size_t tile_size = 32;
+
+// FP16 is stored as I16, the distinct type selects the conversion through FP32
+struct fp16_t {
+    ie_fp16 value;
+};
+
+template <typename T>
+struct Arithmetic {
+    using type = T;
+    static T get(T v) { return v; }
+};
+
+template <>
+struct Arithmetic<fp16_t> {
+    using type = float;
+    static float get(fp16_t v) { return PrecisionUtils::f16tof32(v.value); }
+};
+
+template <typename D, typename S>
+inline typename std::enable_if<std::is_floating_point<D>::value, D>::type convertArithmetic(S v) {
+    return static_cast<D>(v);
+}
+
+template <typename D, typename S>
+inline typename std::enable_if<std::is_integral<D>::value, D>::type convertArithmetic(S v) {
+    double x = std::is_floating_point<S>::value ? std::nearbyint(static_cast<double>(v)) : static_cast<double>(v);
+    x = std::min(std::max(x, static_cast<double>(std::numeric_limits<D>::lowest())),
+                 static_cast<double>(std::numeric_limits<D>::max()));
+    return static_cast<D>(x);
+}
+
+template <typename D, typename S>
+struct Converter {
+    static D convert(S v) {
+        return convertArithmetic<D>(Arithmetic<S>::get(v));
+    }
+};
+
+template <typename S>
+struct Converter<fp16_t, S> {
+    static fp16_t convert(S v) {
+        return {PrecisionUtils::f32tof16(static_cast<float>(Arithmetic<S>::get(v)))};
+    }
+};
+
+template <typename T>
+struct Converter<T, T> {
+    static T convert(T v) { return v; }
+};
+
+template <>
+struct Converter<fp16_t, fp16_t> {
+    static fp16_t convert(fp16_t v) { return v; }
+};
+
+template <typename D, typename S>
+struct RowCopy {
+    static void contiguous(const S *src, D *dst, size_t n) {
+        if (std::is_same<D, S>::value) {
+            std::memcpy(dst, src, n * sizeof(S));
+            return;
+        }
+        for (size_t i = 0; i < n; i++)
+            dst[i] = Converter<D, S>::convert(src[i]);
+    }
+};
+
+// the contiguous rows of FP16 use the vectorized conversions
+template <>
+struct RowCopy<float, fp16_t> {
+    static void contiguous(const fp16_t *src, float *dst, size_t n) {
+        PrecisionUtils::f16tof32Arrays(dst, reinterpret_cast<const ie_fp16 *>(src), n);
+    }
+};
+
+template <>
+struct RowCopy<fp16_t, float> {
+    static void contiguous(const float *src, fp16_t *dst, size_t n) {
+        PrecisionUtils::f32tof16Arrays(reinterpret_cast<ie_fp16 *>(dst), src, n);
+    }
+};
+
+template <typename D, typename S>
+void copyRow(const S *src, ptrdiff_t srcStride, D *dst, ptrdiff_t dstStride, size_t n) {
+    if (srcStride == 1 && dstStride == 1) {
+        RowCopy<D, S>::contiguous(src, dst, n);
+        return;
+    }
+    for (size_t i = 0; i < n; i++)
+        dst[i * dstStride] = Converter<D, S>::convert(src[i * srcStride]);
+}
+
+// a is the inner dimension of the source and b is the one of the destination: the tile is written by the lines
+// along b, the source lines along a which are read for them stay in the L1 cache for the next lines of the tile
+template <typename D, typename S>
+void copyTile(const S *src, ptrdiff_t srcStrideA, ptrdiff_t srcStrideB,
+              D *dst, ptrdiff_t dstStrideA, ptrdiff_t dstStrideB, size_t na, size_t nb) {
+    for (size_t a = 0; a < na; a++) {
+        const S *srcLine = src + a * srcStrideA;
+        D *dstLine = dst + a * dstStrideA;
+        for (size_t b = 0; b < nb; b++)
+            dstLine[b * dstStrideB] = Converter<D, S>::convert(srcLine[b * srcStrideB]);
+    }
+}
+
+struct Dimension {
+    size_t size;
+    ptrdiff_t srcStride;
+    ptrdiff_t dstStride;
+};
+
+std::vector<ptrdiff_t> getLogicalStrides(const TensorDesc &desc) {
+    const BlockingDesc &blockingDesc = desc.getBlockingDesc();
+    const SizeVector &order = blockingDesc.getOrder();
+    const SizeVector &strides = blockingDesc.getStrides();
+    if (order.size() != desc.getDims().size() || strides.size() != order.size())
+        THROW_IE_EXCEPTION << "Unimplemented blob transformation for the layout " << desc.getLayout();
+
+    std::vector<ptrdiff_t> logicalStrides(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+        logicalStrides[order[i]] = static_cast<ptrdiff_t>(strides[i]);
+    return logicalStrides;
+}
+
+// the dimensions of size 1 are dropped and the neighbouring dimensions which are dense in both blobs are merged
+std::vector<Dimension> getDimensions(const TensorDesc &srcDesc, const TensorDesc &dstDesc) {
+    const SizeVector &dims = srcDesc.getDims();
+    std::vector<ptrdiff_t> srcStrides = getLogicalStrides(srcDesc);
+    std::vector<ptrdiff_t> dstStrides = getLogicalStrides(dstDesc);
+
+    std::vector<Dimension> dimensions;
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (dims[i] == 1)
+            continue;
+        Dimension dim = {dims[i], srcStrides[i], dstStrides[i]};
+        if (!dimensions.empty()) {
+            Dimension &outer = dimensions.back();
+            if (outer.srcStride == static_cast<ptrdiff_t>(dim.size) * dim.srcStride &&
+                outer.dstStride == static_cast<ptrdiff_t>(dim.size) * dim.dstStride) {
+                outer.size *= dim.size;
+                outer.srcStride = dim.srcStride;
+                outer.dstStride = dim.dstStride;
+                continue;
+            }
+        }
+        dimensions.push_back(dim);
+    }
+    return dimensions;
+}
+
+size_t getInnerDimension(const std::vector<Dimension> &dimensions, ptrdiff_t Dimension::*stride) {
+    size_t inner = dimensions.size() - 1;
+    for (size_t i = 0; i < dimensions.size(); i++) {
+        if (std::abs(dimensions[i].*stride) < std::abs(dimensions[inner].*stride))
+            inner = i;
+    }
+    return inner;
+}
+
+template <typename F>
+void forEachItem(size_t items, size_t elements, const F &func) {
+    if (items == 1 || elements < parallel_threshold) {
+        for (size_t i = 0; i < items; i++)
+            func(i);
+    } else {
+        parallel_for(items, func);
+    }
+}
+
+template <typename D, typename S>
+void copyBlob(const Blob::Ptr &src, const Blob::Ptr &dst) {
+    const TensorDesc &srcDesc = src->getTensorDesc();
+    const TensorDesc &dstDesc = dst->getTensorDesc();
+    const S *srcPtr = src->cbuffer().as<const S *>() + srcDesc.getBlockingDesc().getOffsetPadding();
+    D *dstPtr = dst->buffer().as<D *>() + dstDesc.getBlockingDesc().getOffsetPadding();
+
+    std::vector<Dimension> dimensions = getDimensions(srcDesc, dstDesc);
+    if (dimensions.empty()) {
+        *dstPtr = Converter<D, S>::convert(*srcPtr);
+        return;
+    }
+
+    size_t elements = 1;
+    for (const auto &dim : dimensions)
+        elements *= dim.size;
+
+    const size_t srcInner = getInnerDimension(dimensions, &Dimension::srcStride);
+    const size_t dstInner = getInnerDimension(dimensions, &Dimension::dstStride);
+    const Dimension a = dimensions[srcInner];
+    const Dimension b = dimensions[dstInner];
+
+    std::vector<Dimension> outer;
+    for (size_t i = 0; i < dimensions.size(); i++) {
+        if (i != srcInner && i != dstInner)
+            outer.push_back(dimensions[i]);
+    }
+    size_t outerCount = 1;
+    for (const auto &dim : outer)
+        outerCount *= dim.size;
+
+    auto outerOffsets = [&](size_t index, ptrdiff_t &srcOffset, ptrdiff_t &dstOffset) {
+        srcOffset = 0;
+        dstOffset = 0;
+        for (size_t i = outer.size(); i-- > 0;) {
+            const size_t coord = index % outer[i].size;
+            index /= outer[i].size;
+            srcOffset += coord * outer[i].srcStride;
+            dstOffset += coord * outer[i].dstStride;
+        }
+    };
+
+    if (srcInner == dstInner) {
+        // the rows along the inner dimension are copied as a whole
+        const size_t chunks = (a.size + row_chunk_size - 1) / row_chunk_size;
+        forEachItem(outerCount * chunks, elements, [&](size_t item) {
+            ptrdiff_t srcOffset, dstOffset;
+            outerOffsets(item / chunks, srcOffset, dstOffset);
+            const size_t start = (item % chunks) * row_chunk_size;
+            const size_t count = std::min(row_chunk_size, a.size - start);
+            copyRow(srcPtr + srcOffset + start * a.srcStride, a.srcStride,
+                    dstPtr + dstOffset + start * a.dstStride, a.dstStride, count);
+        });
+        return;
+    }
+
+    // the transposition of the plane of the inner dimensions of the source and the destination by the tiles
+    const size_t tilesA = (a.size + tile_size - 1) / tile_size;
+    const size_t tilesB = (b.size + tile_size - 1) / tile_size;
+    forEachItem(outerCount * tilesA * tilesB, elements, [&](size_t item) {
+        ptrdiff_t srcOffset, dstOffset;
+        outerOffsets(item / (tilesA * tilesB), srcOffset, dstOffset);
+        const size_t tile = item % (tilesA * tilesB);
+        const size_t startA = (tile / tilesB) * tile_size;
+        const size_t startB = (tile % tilesB) * tile_size;
+        srcOffset += startA * a.srcStride + startB * b.srcStride;
+        dstOffset += startA * a.dstStride + startB * b.dstStride;
+        copyTile(srcPtr + srcOffset, a.srcStride, b.srcStride,
+                 dstPtr + dstOffset, a.dstStride, b.dstStride,
+                 std::min(tile_size, a.size - startA), std::min(tile_size, b.size - startB));
+    });
+}
+
+// the same precisions are copied by the bits
+template <typename S>
+void copyToPrecision(const Blob::Ptr &src, const Blob::Ptr &dst) {
+    switch (dst->getTensorDesc().getPrecision()) {
+        case Precision::FP32: copyBlob<float, S>(src, dst); break;
+        case Precision::FP16: copyBlob<fp16_t, S>(src, dst); break;
+        case Precision::I32: copyBlob<int32_t, S>(src, dst); break;
+        case Precision::I16: copyBlob<int16_t, S>(src, dst); break;
+        case Precision::U16: copyBlob<uint16_t, S>(src, dst); break;
+        case Precision::I8: copyBlob<int8_t, S>(src, dst); break;
+        case Precision::U8: copyBlob<uint8_t, S>(src, dst); break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported blob transformation for precision " << dst->getTensorDesc().getPrecision();
+    }
+}
+
+}  // namespace
+
+void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
+    if (src->buffer() == nullptr)
+        THROW_IE_EXCEPTION << "Cannot copy blob data. Source is not allocated.";
+
+    if (dst->buffer() == nullptr)
+        THROW_IE_EXCEPTION << "Cannot copy blob data. Destination is not allocated.";
+
+    if (src->getTensorDesc().getDims() != dst->getTensorDesc().getDims())
+        THROW_IE_EXCEPTION << "Unimplemented blob transformation from different shapes ";
+
+    const Precision srcPrecision = src->getTensorDesc().getPrecision();
+    const Precision dstPrecision = dst->getTensorDesc().getPrecision();
+    if (srcPrecision == dstPrecision) {
+        switch (srcPrecision.size()) {
+            case 4: copyBlob<uint32_t, uint32_t>(src, dst); return;
+            case 2: copyBlob<uint16_t, uint16_t>(src, dst); return;
+            case 1: copyBlob<uint8_t, uint8_t>(src, dst); return;
+            default:
+                THROW_IE_EXCEPTION << "Unsupported blob transformation for precision " << srcPrecision;
+        }
+    }
+
+    switch (srcPrecision) {
+        case Precision::FP32: copyToPrecision<float>(src, dst); break;
+        case Precision::FP16: copyToPrecision<fp16_t>(src, dst); break;
+        case Precision::I32: copyToPrecision<int32_t>(src, dst); break;
+        case Precision::I16: copyToPrecision<int16_t>(src, dst); break;
+        case Precision::U16: copyToPrecision<uint16_t>(src, dst); break;
+        case Precision::I8: copyToPrecision<int8_t>(src, dst); break;
+        case Precision::U8: copyToPrecision<uint8_t>(src, dst); break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported blob transformation for precision " << srcPrecision;
+    }
+}
+
+bool blob_is_dense(const Blob::Ptr &blob) {
+    const BlockingDesc &blockingDesc = blob->getTensorDesc().getBlockingDesc();
+    const SizeVector &blkDims = blockingDesc.getBlockDims();
+    const SizeVector &strides = blockingDesc.getStrides();
+    const SizeVector &dimOffsets = blockingDesc.getOffsetPaddingToData();
+    if (strides.size() != blkDims.size())
+        return false;
+
+    size_t stride = 1;
+    for (size_t i = blkDims.size(); i-- > 0;) {
+        // the stride of the dimension of 1 is never used
+        if (blkDims[i] != 1 && strides[i] != stride)
+            return false;
+        if (i < dimOffsets.size() && dimOffsets[i] != 0)
+            return false;
+        stride *= blkDims[i];
+    }
+    return true;
+}
+
+}  // namespace InferenceEngine
@@ -32,6 +32,17 @@ void CNNNetworkImpl::getInputsInfo(InputsDataMap& inputs) const noexcept {
 
 void CNNNetworkImpl::addLayer(const CNNLayerPtr& layer) noexcept {
     _layers[layer->name] = layer;
+    _reshaper.reset();
+}
+
+void CNNNetworkImpl::removeLayer(const std::string& layerName) {
+    _layers.erase(layerName);
+    _reshaper.reset();
+}
+
+void CNNNetworkImpl::removeData(const std::string& dataName) {
+    _data.erase(dataName);
+    _reshaper.reset();
 }
 
 void CNNNetworkImpl::validate(int version) {
@@ -51,7 +62,7 @@ void CNNNetworkImpl::validate(int version) {
             for (auto i : layer->insData) {
                 auto data = i.lock();
                 if (data) {
-                    auto inputTo = data->getInputTo();
+                    const auto& inputTo = data->getInputTo();
                     auto iter = inputTo.find(layerName);
                     auto dataName = data->name;
                     if (iter == inputTo.end()) {
@@ -67,17 +78,17 @@ void CNNNetworkImpl::validate(int version) {
                 }
             }
             for (auto data : layer->outData) {
-                auto inputTo = data->getInputTo();
+                const auto& inputTo = data->getInputTo();
                 std::string dataName = data->getName();
                 for (auto layerIter : inputTo) {
                     CNNLayerPtr layerInData = layerIter.second;
                     if (!layerInData) {
                         THROW_IE_EXCEPTION << "Layer which takes data " << dataName << " is nullptr";
                     }
-                    auto insertedDatas = layerInData->insData;
+                    const auto& insertedDatas = layerInData->insData;
 
                     auto it = std::find_if(insertedDatas.begin(), insertedDatas.end(),
-                                           [&](InferenceEngine::DataWeakPtr& d) {
+                                           [&](const InferenceEngine::DataWeakPtr& d) {
                                                return d.lock() == data;
                                            });
                     if (it == insertedDatas.end()) {
@@ -175,8 +186,9 @@ StatusCode
 CNNNetworkImpl::reshape(const std::map<std::string, std::vector<size_t>>& inputShapes,
                         ResponseDesc* responseDesc) noexcept {
     try {
-        ShapeInfer::Reshaper reshaper(*this);
-        reshaper.run(inputShapes);
+        if (!_reshaper)
+            _reshaper = std::make_shared<ShapeInfer::Reshaper>(*this);
+        _reshaper->run(inputShapes);
     } catch (const InferenceEngineException& e) {
         return DescriptionBuffer(GENERAL_ERROR, responseDesc) << e.what();
     } catch (const std::exception& e) {
@@ -198,6 +210,8 @@ StatusCode CNNNetworkImpl::setBatchSize(size_t size, ResponseDesc* responseDesc)
     auto originalBatchSize = getBatchSize();
     if (originalBatchSize == size)
         return OK;
+    // the shapes are changed bypassing the reshaper
+    _reshaper.reset();
     for (auto layer : _data) {
         SizeVector dims = layer.second->getDims();
         // Calculates original size for batch = 1
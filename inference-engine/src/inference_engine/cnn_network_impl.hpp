@@ -13,10 +13,14 @@
 #include "ie_blob.h"
 #include "ie_api.h"
 #include "description_buffer.hpp"
+#include "indexed_map.hpp"
 #include <string>
 #include <vector>
 
 namespace InferenceEngine {
+namespace ShapeInfer {
+class Reshaper;
+}  // namespace ShapeInfer
 namespace details {
 class INFERENCE_ENGINE_API_CLASS(CNNNetworkImpl) : public ICNNNetwork {
 public:
@@ -60,7 +64,7 @@ public:
         _name = name;
     }
 
-    const std::map<std::string, CNNLayerPtr>& allLayers() const {
+    const IndexedMap<CNNLayerPtr>& allLayers() const {
         return _layers;
     }
 
@@ -78,6 +82,16 @@ public:
 
     void addLayer(const CNNLayerPtr& layer) noexcept override;
 
+    /**
+     * @brief Removes the layer of the name from the network, its connections are left to the caller
+     */
+    void removeLayer(const std::string& layerName);
+
+    /**
+     * @brief Removes the data of the name from the network, its connections are left to the caller
+     */
+    void removeData(const std::string& dataName);
+
     StatusCode getLayerByName(const char* layerName, CNNLayerPtr& out, ResponseDesc* resp) const noexcept override;
 
     // deprecated, as there is no ResponseDesc to put error message
@@ -118,8 +132,9 @@ public:
 
 protected:
     Precision precision {Precision::MIXED};
-    std::map<std::string, DataPtr> _data;
-    std::map<std::string, CNNLayerPtr> _layers;
+    /// @brief The data and the layers in the order of the addition, their names are hashed to the indices
+    IndexedMap<DataPtr> _data;
+    IndexedMap<CNNLayerPtr> _layers;
     InferenceEngine::InputsDataMap _inputData;
     std::map<std::string, DataPtr> _outputData;
     std::string _name;
@@ -127,6 +142,8 @@ protected:
     TargetDevice _targetDevice;
     DataPtr _emptyData;
     std::vector<IShapeInferExtensionPtr> _shapeInferExts;
+    /// @brief The reshaper of the previous reshapes, it keeps the inferred shapes until the layers are changed
+    std::shared_ptr<ShapeInfer::Reshaper> _reshaper;
 };
 
 
@@ -8,6 +8,7 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <set>
 #include <string>
 #include <cassert>
 #include <cmath>
@@ -18,6 +19,7 @@
 #include <data_stats.h>
 #include "cnn_network_impl.hpp"
 #include "cnn_network_stats_impl.hpp"
+#include "ie_util_internal.hpp"
 #include "debug.h"
 
 using namespace std;
@@ -77,6 +79,8 @@ void CNNNetworkInt8Normalizer::AddScaleShiftBeforeAndAfterInt8(CNNNetwork& net)
                         CNNLayerPtr ssCnnLayer(new ScaleShiftLayer(ssCnnLayerParams));
 
                         AddLayerToCNNNetwork(net, previousNode, iter, ssCnnLayer);
+                        // the ScaleShift brings the data to the unsigned range of the quantized layer input
+                        ssCnnLayer->outData[0]->setPrecision(Precision::U8);
 
                         size_t C = static_cast<size_t>(previousNode->outData[0]->getDims()[1]);
 
@@ -123,6 +127,13 @@ void CNNNetworkInt8Normalizer::AddScaleShiftBeforeAndAfterInt8(CNNNetwork& net)
                     THROW_IE_EXCEPTION<< "Only Conv-ReLU is supported so far: " << iter->name;
                 }
 
+                if (nextNode->outData[0]->getInputTo().empty()) {
+                    // the output of the network stays FP32, the layer dequantizes its output itself
+                    iter->outData[0]->setPrecision(Precision::FP32);
+                    iter->blobs.erase("o-scale");
+                    continue;
+                }
+
                 for (auto next : nextNode->outData[0]->getInputTo()) {
                     auto nextNextNode = next.second;
 
@@ -205,11 +216,95 @@ void CNNNetworkInt8Normalizer::ScaleDataToInt8(const float* srcData, size_t srcS
     }
 }
 
-void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetwork& net, const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats) {
+namespace {
+
+// the ReLU which is the only consumer of the output of the convolution, the quantized convolution is fused with it
+CNNLayerPtr getActivation(const CNNLayerPtr& conv) {
+    if (conv->outData.size() != 1 || conv->outData[0]->getInputTo().size() != 1) {
+        return nullptr;
+    }
+    CNNLayerPtr next = conv->outData[0]->getInputTo().begin()->second;
+    if (next->type != "ReLU" || next->outData.size() != 1) {
+        return nullptr;
+    }
+    return next;
+}
+
+CNNLayerPtr getPreviousLayer(const CNNLayerPtr& layer) {
+    if (layer->insData.empty()) {
+        return nullptr;
+    }
+    DataPtr input = layer->insData[0].lock();
+    return input ? input->getCreatorLayer().lock() : nullptr;
+}
+
+}  // namespace
+
+std::set<std::string> CNNNetworkInt8Normalizer::SelectInt8Layers(CNNNetwork& net, const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats,
+                                                                 const std::set<std::string>& fp32Layers, bool minimizeBoundaries) {
+    std::map<std::string, CNNLayerPtr> candidates;
+    for (auto layer : CNNNetSortTopologically(net)) {
+        if (layer->type != "Convolution" || contains(fp32Layers, layer->name) ||
+            netNodesStats.find(layer->name) == netNodesStats.end()) {
+            continue;
+        }
+        // the scales of the input are taken from the statistics of the previous layer
+        CNNLayerPtr previousLayer = getPreviousLayer(layer);
+        if (!previousLayer || netNodesStats.find(previousLayer->name) == netNodesStats.end() || !getActivation(layer)) {
+            continue;
+        }
+        candidates[layer->name] = layer;
+    }
+
+    std::set<std::string> int8Layers;
+    for (auto& candidate : candidates) {
+        int8Layers.insert(candidate.first);
+    }
+    if (!minimizeBoundaries) {
+        return int8Layers;
+    }
+
+    // the plugin keeps the data in INT8 between the quantized convolutions if the quantized ones are the only consumers
+    auto outputStaysInt8 = [&](const CNNLayerPtr& conv) {
+        const std::map<std::string, CNNLayerPtr>& consumers = getActivation(conv)->outData[0]->getInputTo();
+        if (consumers.empty()) {
+            return false;
+        }
+        for (auto& consumer : consumers) {
+            if (!contains(int8Layers, consumer.first)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto inputStaysInt8 = [&](const CNNLayerPtr& conv) {
+        CNNLayerPtr activation = getPreviousLayer(conv);
+        if (activation->type != "ReLU") {
+            return false;
+        }
+        CNNLayerPtr previousConv = getPreviousLayer(activation);
+        return previousConv && contains(int8Layers, previousConv->name) && outputStaysInt8(previousConv);
+    };
+
+    // removing an isolated convolution does not isolate the others, its neighbours do not keep INT8 data through it
+    std::vector<std::string> isolated;
+    for (auto& candidate : candidates) {
+        if (!inputStaysInt8(candidate.second) && !outputStaysInt8(candidate.second)) {
+            isolated.push_back(candidate.first);
+        }
+    }
+    for (auto& name : isolated) {
+        int8Layers.erase(name);
+    }
+    return int8Layers;
+}
+
+void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetwork& net, const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats,
+                                             const std::set<std::string>& int8Layers) {
     std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(net);
 
     for (auto iter : sortedLayers) {
-        if (netNodesStats.find(iter->name) == netNodesStats.end()) {
+        if (!contains(int8Layers, iter->name)) {
             continue;
         }
 
@@ -223,11 +318,14 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
             int8weights->allocate();
             iter->blobs["weights"] = int8weights;
 
-            // Creating int8 biases blob
-            std::shared_ptr<Data> int8BiasesData = std::shared_ptr<Data>(new Data("biases", biases->dims(), Precision::I8, biases->layout()));
-            auto int8biases = CreateBlobFromData(int8BiasesData);
-            int8biases->allocate();
-            iter->blobs["biases"] = int8biases;
+            // Creating int32 biases blob, the biases are added to the int32 accumulator of the convolution
+            Blob::Ptr int32biases;
+            if (biases) {
+                std::shared_ptr<Data> int32BiasesData = std::shared_ptr<Data>(new Data("biases", biases->dims(), Precision::I32, biases->layout()));
+                int32biases = CreateBlobFromData(int32BiasesData);
+                int32biases->allocate();
+                iter->blobs["biases"] = int32biases;
+            }
 
             std::vector<float> weightScalers;
 
@@ -263,7 +361,6 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
             // Creating w-scale blob
 
             const float* weight = static_cast<const float*>(weights->buffer());
-            const float* bias = static_cast<const float*>(biases->buffer());
 
             std::vector<float> newWeights;  // "new" weights are weights multiplied by i-scale
             {
@@ -324,16 +421,27 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
 
             // Normalizing the weights and the biases
             ScaleDataToInt8(&newWeights[0], weights->size(), int8weights, maxSign, weightScalers);
-            ScaleDataToInt8(bias, biases->size(), int8biases, maxSign, weightScalers);
+            if (biases) {
+                const float* bias = static_cast<const float*>(biases->buffer());
+                int32_t* int32bias = static_cast<int32_t*>(int32biases->buffer());
+                size_t biasesPerScale = biases->size() / weightScalers.size();
+                for (size_t i = 0; i < biases->size(); i++) {
+                    int32bias[i] = static_cast<int32_t>(std::round(bias[i] * weightScalers[i / biasesPerScale]));
+                }
+            }
+
+            // the plugins read the weights from the weightable layer
+            auto* weightableLayer = dynamic_cast<WeightableLayer*>(iter.get());
+            if (weightableLayer) {
+                weightableLayer->_weights = int8weights;
+                weightableLayer->_biases = int32biases;
+            }
 
-            // Setting precisions
+            // Setting precisions, the precision of the input data is set on the ScaleShift inserted before the layer
             iter->precision = Precision::I8;
 
-            for (auto&& in : iter->insData) {
-                in.lock()->precision = Precision::U8;
-            }
             for (auto&& out : iter->outData) {
-                out->precision = Precision::I8;
+                out->setPrecision(Precision::I8);
             }
 
             std::cout << "Layer " << iter->name << " converted to INT8" << std::endl;
@@ -342,13 +450,21 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
 }
 
 void CNNNetworkInt8Normalizer::NormalizeNetwork(ICNNNetwork& network, ICNNNetworkStats& netStats) {
+    NormalizeNetwork(network, netStats, {}, false);
+}
+
+void CNNNetworkInt8Normalizer::NormalizeNetwork(ICNNNetwork& network, ICNNNetworkStats& netStats,
+                                                const std::set<std::string>& fp32Layers, bool minimizeBoundaries) {
     CNNNetwork cnnn(&network);
 
     int maxSign = 0x7F;
     int maxUnsign = 0xFF;
 
+    const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats = dynamic_cast<const CNNNetworkStatsImpl&>(netStats).getNodesStats();
+    std::set<std::string> int8Layers = SelectInt8Layers(cnnn, netNodesStats, fp32Layers, minimizeBoundaries);
+
     // Applying int8-conversion
-    ConvertToInt8(maxSign, maxUnsign, cnnn, dynamic_cast<const CNNNetworkStatsImpl&>(netStats).getNodesStats());
+    ConvertToInt8(maxSign, maxUnsign, cnnn, netNodesStats, int8Layers);
 
     // Adding ScaleShift layers before and after each Convolution-Activation pair
     AddScaleShiftBeforeAndAfterInt8(cnnn);
@@ -7,6 +7,7 @@
 
 #include <map>
 #include <memory>
+#include <set>
 #include <float.h>
 
 #include <string>
@@ -25,12 +26,31 @@ public:
     }
 
 public:
+    /**
+     * @brief Quantizes to INT8 every Convolution followed by ReLU which has the statistics of its input and output
+     */
     void NormalizeNetwork(ICNNNetwork& network, ICNNNetworkStats& netStats);
 
+    /**
+     * @brief The accuracy-aware quantization. The layers of fp32Layers (e.g. the ones sensitive to the quantization)
+     * stay in FP32. With minimizeBoundaries the convolutions which would be quantized alone between FP32 layers stay
+     * in FP32 too: every FP32/INT8 boundary costs a reorder and a scaling pass, a single quantized convolution
+     * pays for two of them.
+     */
+    void NormalizeNetwork(ICNNNetwork& network, ICNNNetworkStats& netStats,
+                          const std::set<std::string>& fp32Layers, bool minimizeBoundaries);
+
+    /**
+     * @brief Selects the names of the layers NormalizeNetwork quantizes, the network is not changed
+     */
+    std::set<std::string> SelectInt8Layers(CNNNetwork& net, const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats,
+                                           const std::set<std::string>& fp32Layers, bool minimizeBoundaries);
+
 protected:
     void AddLayerToCNNNetwork(CNNNetwork& net, CNNLayerPtr firstNode, CNNLayerPtr secondNode, CNNLayerPtr nodeToInsert);
     void AddScaleShiftBeforeAndAfterInt8(CNNNetwork& net);
-    void ConvertToInt8(int maxSign, int maxUnsign, CNNNetwork& net, const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats);
+    void ConvertToInt8(int maxSign, int maxUnsign, CNNNetwork& net, const std::map<std::string, NetworkNodeStatsPtr>& netNodesStats,
+                       const std::set<std::string>& int8Layers);
     void ScaleDataToInt8(const float* srcData, size_t srcSize, Blob::Ptr int8blob, float maxValue, const std::vector<float>& scales);
 };
 
@@ -59,6 +59,15 @@ public:
         TO_STATUS(_impl->GetMappedTopology(deployedTopology));
     }
 
+    StatusCode Reshape(const std::map<std::string, SizeVector> &inputShapes, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->Reshape(inputShapes));
+    }
+
+    StatusCode GetExecutorMetrics(std::map<std::string, ExecutorMetrics> &metrics,
+                                  ResponseDesc *resp) const noexcept override {
+        TO_STATUS(_impl->GetExecutorMetrics(metrics));
+    }
+
     StatusCode  QueryState(IMemoryState::Ptr & pState, size_t idx
         , ResponseDesc *resp) noexcept override {
         try {
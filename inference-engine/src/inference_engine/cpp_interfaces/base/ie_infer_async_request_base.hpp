@@ -38,6 +38,10 @@ public:
         TO_STATUS(_impl->GetPerformanceCounts(perfMap));
     }
 
+    StatusCode GetTimings(InferRequestTimings &timings, ResponseDesc *resp) const noexcept override {
+        TO_STATUS(_impl->GetTimings(timings));
+    }
+
     StatusCode SetBlob(const char *name, const Blob::Ptr &data, ResponseDesc *resp) noexcept override {
         TO_STATUS(_impl->SetBlob(name, data));
     }
@@ -46,6 +50,35 @@ public:
         TO_STATUS(_impl->GetBlob(name, data));
     }
 
+    StatusCode SetBlobByIndex(size_t index, const Blob::Ptr &data, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetBlobByIndex(index, data));
+    }
+
+    StatusCode GetBlobByIndex(size_t index, Blob::Ptr &data, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->GetBlobByIndex(index, data));
+    }
+
+    StatusCode SetRoiBlobs(const char *name, const std::vector<Blob::Ptr> &rois, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetRoiBlobs(name, rois));
+    }
+
+    StatusCode SetSkippedOutputs(const std::vector<std::string> &names, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetSkippedOutputs(names));
+    }
+
+    StatusCode IsZeroCopyBlob(const char *name, const Blob::Ptr &data, bool &zeroCopy,
+                              ResponseDesc *resp) noexcept override {
+        TO_STATUS(zeroCopy = _impl->IsZeroCopyBlob(name, data));
+    }
+
+    StatusCode Cancel(ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->Cancel());
+    }
+
+    StatusCode SetDeadline(int64_t millis_timeout, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetDeadline(millis_timeout));
+    }
+
     StatusCode StartAsync(ResponseDesc *resp) noexcept override {
         IE_PROFILING_AUTO_SCOPE(StartAsync);
         TO_STATUS(_impl->StartAsync());
@@ -65,5 +65,6 @@ try {return x;\
 #define REQUEST_BUSY_str std::string("[REQUEST_BUSY] ")
 #define NOT_IMPLEMENTED_str std::string("[NOT_IMPLEMENTED] ")
 #define NOT_ALLOCATED_str std::string("[NOT_ALLOCATED] ")
+#define INFER_CANCELLED_str std::string("[INFER_CANCELLED] ")
 
 }  // namespace InferenceEngine
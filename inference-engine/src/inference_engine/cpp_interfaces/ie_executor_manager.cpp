@@ -4,16 +4,33 @@
 //
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include "cpp_interfaces/ie_executor_manager.hpp"
 #include "cpp_interfaces/ie_task_executor.hpp"
+#include "cpp_interfaces/ie_work_stealing_task_executor.hpp"
 
 namespace InferenceEngine {
 
 ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
+    return getExecutor(id, 1);
+}
+
+ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id, size_t workersNumber) {
+    return getExecutor(id, workersNumber, {});
+}
+
+ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id, size_t workersNumber,
+                                                    const TaskExecutorConfig &config) {
+    std::lock_guard<std::mutex> lock(executorsMutex);
     auto foundEntry = executors.find(id);
     if (foundEntry == executors.end()) {
-        auto newExec = std::make_shared<TaskExecutor>(id);
+        ITaskExecutor::Ptr newExec;
+        if (workersNumber > 1) {
+            newExec = std::make_shared<WorkStealingTaskExecutor>(workersNumber, id, config);
+        } else {
+            newExec = std::make_shared<TaskExecutor>(id, config);
+        }
         executors[id] = newExec;
         return newExec;
     }
@@ -22,19 +39,38 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
 
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
+    std::lock_guard<std::mutex> lock(executorsMutex);
     return executors.size();
 }
 
 void ExecutorManagerImpl::clear() {
+    std::lock_guard<std::mutex> lock(executorsMutex);
     executors.clear();
 }
 
 ExecutorManager *ExecutorManager::_instance = nullptr;
 
+ExecutorManager *ExecutorManager::getInstance() {
+    static std::once_flag created;
+    std::call_once(created, []() {
+        _instance = new ExecutorManager();
+    });
+    return _instance;
+}
+
 ITaskExecutor::Ptr ExecutorManager::getExecutor(std::string id) {
     return _impl.getExecutor(id);
 }
 
+ITaskExecutor::Ptr ExecutorManager::getExecutor(std::string id, size_t workersNumber) {
+    return _impl.getExecutor(id, workersNumber);
+}
+
+ITaskExecutor::Ptr ExecutorManager::getExecutor(std::string id, size_t workersNumber,
+                                                const TaskExecutorConfig &config) {
+    return _impl.getExecutor(id, workersNumber, config);
+}
+
 size_t ExecutorManager::getExecutorsNumber() {
     return _impl.getExecutorsNumber();
 }
@@ -5,10 +5,12 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include "ie_api.h"
 #include "cpp_interfaces/ie_itask_executor.hpp"
+#include "cpp_interfaces/ie_thread_affinity.hpp"
 
 namespace InferenceEngine {
 
@@ -22,6 +24,10 @@ class ExecutorManagerImpl {
 public:
     ITaskExecutor::Ptr getExecutor(std::string id);
 
+    ITaskExecutor::Ptr getExecutor(std::string id, size_t workersNumber);
+
+    ITaskExecutor::Ptr getExecutor(std::string id, size_t workersNumber, const TaskExecutorConfig &config);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -29,6 +35,7 @@ public:
 
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
+    std::mutex executorsMutex;
 };
 
 /**
@@ -40,13 +47,11 @@ private:
  */
 class INFERENCE_ENGINE_API_CLASS(ExecutorManager) {
 public:
-    static ExecutorManager *getInstance() {
-        if (!_instance) {
-            _instance = new ExecutorManager();
-        }
-
-        return _instance;
-    }
+    /**
+     * @brief Returns the global instance, the instance and its methods are safe to be used from several threads,
+     * e.g. by the networks loaded concurrently
+     */
+    static ExecutorManager *getInstance();
 
     ExecutorManager(ExecutorManager const &) = delete;
 
@@ -58,6 +63,24 @@ public:
      */
     ITaskExecutor::Ptr getExecutor(std::string id);
 
+    /**
+     * @brief Returns executor by unique identificator, the executor with several workers runs the started tasks
+     * concurrently. The first request of the identificator defines the number of the workers of the executor.
+     * @param id unique identificator of device (Usually string representation of TargetDevice)
+     * @param workersNumber the number of the working threads, the single worker executes the tasks in FIFO mode
+     */
+    ITaskExecutor::Ptr getExecutor(std::string id, size_t workersNumber);
+
+    /**
+     * @brief Returns executor by unique identificator, the workers of the executor run on the processors
+     * of the config with its priority. The first request of the identificator defines the workers and their
+     * placement, so the plugins sharing the executor should agree on it.
+     * @param id unique identificator of device (Usually string representation of TargetDevice)
+     * @param workersNumber the number of the working threads, the single worker executes the tasks in FIFO mode
+     * @param config the processors and the priority of the working threads
+     */
+    ITaskExecutor::Ptr getExecutor(std::string id, size_t workersNumber, const TaskExecutorConfig &config);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
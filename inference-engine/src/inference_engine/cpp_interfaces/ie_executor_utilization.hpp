@@ -0,0 +1,93 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The busy and the idle time of the workers of an executor. A worker marks the start and the end of every
+ * task it runs, these are a read of the clock and a few relaxed atomic stores, so the executor is not slowed down
+ * and the metrics are read by any thread without locking the queue.
+ */
+class ExecutorUtilization {
+public:
+    explicit ExecutorUtilization(size_t workers)
+            : _created(now()), _workersNumber(workers), _workers(new Worker[workers]) {}
+
+    static long long now() noexcept {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void taskStarted(size_t worker) noexcept {
+        _workers[worker].taskStart.store(now(), std::memory_order_relaxed);
+    }
+
+    void taskFinished(size_t worker) noexcept {
+        auto &state = _workers[worker];
+        // the start is dropped first, so the reader may miss the task for a moment but never counts it twice
+        const long long start = state.taskStart.exchange(0, std::memory_order_relaxed);
+        state.busy.fetch_add(now() - start, std::memory_order_relaxed);
+        state.completed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    size_t getWorkersNumber() const noexcept {
+        return _workersNumber;
+    }
+
+    /**
+     * @brief The metrics of a worker, the running task counts as busy up to now
+     */
+    ExecutorMetrics get(size_t worker) const noexcept {
+        const long long current = now();
+        const auto &state = _workers[worker];
+        ExecutorMetrics metrics;
+        metrics.workers = 1;
+        const long long start = state.taskStart.load(std::memory_order_relaxed);
+        metrics.runningTasks = start != 0 ? 1 : 0;
+        metrics.completedTasks = state.completed.load(std::memory_order_relaxed);
+        metrics.busy_uSec = state.busy.load(std::memory_order_relaxed) + (start != 0 ? current - start : 0);
+        metrics.idle_uSec = std::max(0ll, current - _created - metrics.busy_uSec);
+        return metrics;
+    }
+
+    /**
+     * @brief The metrics summed over the workers
+     * @param queueDepth - the tasks waiting in the queue of the executor, it's known to the executor only
+     */
+    ExecutorMetrics getTotal(size_t queueDepth) const noexcept {
+        ExecutorMetrics total;
+        for (size_t worker = 0; worker < _workersNumber; worker++) {
+            const ExecutorMetrics metrics = get(worker);
+            total.workers += metrics.workers;
+            total.runningTasks += metrics.runningTasks;
+            total.completedTasks += metrics.completedTasks;
+            total.busy_uSec += metrics.busy_uSec;
+            total.idle_uSec += metrics.idle_uSec;
+        }
+        total.queueDepth = queueDepth;
+        return total;
+    }
+
+private:
+    struct Worker {
+        std::atomic<long long> taskStart = {0};
+        std::atomic<long long> busy = {0};
+        std::atomic<unsigned long long> completed = {0};
+    };
+
+    const long long _created;
+    const size_t _workersNumber;
+    std::unique_ptr<Worker[]> _workers;
+};
+
+}  // namespace InferenceEngine
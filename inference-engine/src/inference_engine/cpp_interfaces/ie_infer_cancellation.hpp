@@ -0,0 +1,72 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "details/ie_exception.hpp"
+#include "cpp_interfaces/exception2status.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The cancellation and the deadline of the inference of a request. The plugin checks it at the points
+ * the inference can be stopped at (e.g. between the layers), an overloaded device sheds the late inferences
+ * instead of queueing them.
+ */
+class InferCancellation {
+public:
+    /**
+     * @brief Cancels the inference, it's called by any thread while the inference is running
+     */
+    void cancel() noexcept {
+        _cancelled = true;
+    }
+
+    /**
+     * @brief Sets the time the following inferences are given, 0 disables the deadline
+     */
+    void setTimeout(int64_t millis_timeout) {
+        if (millis_timeout < 0)
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "The deadline can't be negative: " << millis_timeout;
+        _timeout = std::chrono::milliseconds(millis_timeout);
+    }
+
+    /**
+     * @brief Starts the inference: the cancellation of the previous one is dropped and the deadline is counted from now.
+     * It's called by the thread starting the request, before the inference is passed to the executors.
+     */
+    void start() noexcept {
+        _cancelled = false;
+        _hasDeadline = _timeout.count() > 0;
+        if (_hasDeadline)
+            _deadline = std::chrono::steady_clock::now() + _timeout;
+    }
+
+    bool isCancelled() const noexcept {
+        return _cancelled || (_hasDeadline && std::chrono::steady_clock::now() >= _deadline);
+    }
+
+    /**
+     * @brief Throws the exception of the INFER_CANCELLED status if the inference is cancelled or has missed the deadline
+     */
+    void check() const {
+        if (_cancelled)
+            THROW_IE_EXCEPTION << details::as_status << INFER_CANCELLED << INFER_CANCELLED_str << "The inference is cancelled";
+        if (_hasDeadline && std::chrono::steady_clock::now() >= _deadline)
+            THROW_IE_EXCEPTION << details::as_status << INFER_CANCELLED << INFER_CANCELLED_str
+                               << "The inference has missed its deadline of " << _timeout.count() << " ms";
+    }
+
+private:
+    std::atomic<bool> _cancelled = {false};
+    std::chrono::milliseconds _timeout = std::chrono::milliseconds(0);
+    bool _hasDeadline = false;
+    std::chrono::steady_clock::time_point _deadline;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,50 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The timestamps of the stages of the last inference of a request. Each stage is a single read of the clock
+ * and a store, the stages follow each other through the handoffs of the executors, so no synchronization is needed.
+ */
+class InferTimings {
+public:
+    using Stage = long long InferRequestTimings::*;
+
+    static long long now() noexcept {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Starts the inference: the stages of the previous one are dropped and the request is enqueued now.
+     * It's called by the thread starting the request, before the inference is passed to the executors.
+     */
+    void start() noexcept {
+        _timings = InferRequestTimings();
+        _timings.enqueued_uSec = now();
+    }
+
+    /**
+     * @brief Marks the end of the stage, e.g. mark(&InferRequestTimings::executed_uSec)
+     */
+    void mark(Stage stage) noexcept {
+        _timings.*stage = now();
+    }
+
+    const InferRequestTimings &get() const noexcept {
+        return _timings;
+    }
+
+private:
+    InferRequestTimings _timings;
+};
+
+}  // namespace InferenceEngine
@@ -7,6 +7,7 @@
 
 #include <memory>
 #include "ie_api.h"
+#include "ie_common.h"
 #include "ie_task.hpp"
 
 namespace InferenceEngine {
@@ -22,6 +23,14 @@ public:
      *  @return true if succeed to add task, otherwise - false
      */
     virtual bool startTask(Task::Ptr task) = 0;
+
+    /**
+     * @brief Returns the utilization of the executor since it is created, see ExecutorMetrics
+     * @note The default implementation reports no workers, i.e. the executor does not track its utilization
+     */
+    virtual ExecutorMetrics getMetrics() const {
+        return ExecutorMetrics();
+    }
 };
 
 }  // namespace InferenceEngine
@@ -18,18 +18,23 @@
 
 namespace InferenceEngine {
 
-Task::Task() : _status(TS_INITIAL) {
+Task::Task() : _status(TS_INITIAL), _parkedWaiters(0), _waitSpinTime(0) {
     _function = [&]() {
         _status = TS_DONE;
         return;
     };
 }
 
-Task::Task(std::function<void()> function) : _status(TS_INITIAL), _function(function) {
+Task::Task(std::function<void()> function)
+        : _function(function), _status(TS_INITIAL), _parkedWaiters(0), _waitSpinTime(0) {
     if (!function) THROW_IE_EXCEPTION << "Failed to create Task object with null function";
 }
 
 Task::Status Task::runNoThrowNoBusyCheck() noexcept {
+    if (TraceCollector::isEnabled() && _occupiedTime != TraceCollector::Clock::time_point()) {
+        TraceCollector::add("TaskQueueWait", _occupiedTime, TraceCollector::Clock::now());
+        _occupiedTime = TraceCollector::Clock::time_point();
+    }
     IE_PROFILING_AUTO_SCOPE(TaskExecution);
     try {
         _exceptionPtr = nullptr;
@@ -39,7 +44,7 @@ Task::Status Task::runNoThrowNoBusyCheck() noexcept {
         _exceptionPtr = std::current_exception();
         setStatus(TS_ERROR);
     }
-    _isTaskDoneCondVar.notify_all();
+    notifyWaiters();
     return getStatus();
 }
 
@@ -55,14 +60,24 @@ Task::Status Task::wait(int64_t millis_timeout) {
     _isOnWait = true;
     std::exception_ptr exceptionPtr;
     try {
-        std::unique_lock<std::mutex> lock(_taskStatusMutex);
-        if (_status != TS_INITIAL) {
-            auto predicate = [&]() -> bool { return _status == TS_DONE || _status == TS_ERROR; };
+        if (_status != TS_INITIAL && !isCompleted() && _waitSpinTime.count() > 0) {
+            auto spinEnd = std::chrono::steady_clock::now() + _waitSpinTime;
+            while (!isCompleted() && std::chrono::steady_clock::now() < spinEnd) {
+                std::this_thread::yield();
+            }
+        }
+        if (_status != TS_INITIAL && !isCompleted()) {
+            // the counter is increased before the status is checked under the mutex, so notifyWaiters() either
+            // sees the parked waiter or the waiter sees the completed status
+            _parkedWaiters++;
+            std::unique_lock<std::mutex> lock(_taskStatusMutex);
+            auto predicate = [&]() -> bool { return isCompleted(); };
             if (millis_timeout < 0) {
                 _isTaskDoneCondVar.wait(lock, predicate);
             } else {
                 _isTaskDoneCondVar.wait_for(lock, std::chrono::milliseconds(millis_timeout), predicate);
             }
+            _parkedWaiters--;
         }
     } catch (...) {
         exceptionPtr = std::current_exception();
@@ -72,15 +87,21 @@ Task::Status Task::wait(int64_t millis_timeout) {
     return _status;
 }
 
+void Task::setWaitSpinTime(std::chrono::microseconds spinTime) {
+    _waitSpinTime = spinTime;
+}
+
 bool Task::occupy() {
-    std::unique_lock<std::mutex> guard(_taskStatusMutex);
-    if (_status == Task::TS_BUSY) return false;
-    _status = TS_BUSY;
+    Status status = _status;
+    do {
+        if (status == Task::TS_BUSY) return false;
+    } while (!_status.compare_exchange_weak(status, TS_BUSY));
+    if (TraceCollector::isEnabled())
+        _occupiedTime = TraceCollector::Clock::now();
     return true;
 }
 
 Task::Status Task::getStatus() {
-    std::unique_lock<std::mutex> guard(_taskStatusMutex);
     return _status;
 }
 
@@ -107,10 +128,23 @@ StatusCode Task::TaskStatus2StatusCode(Task::Status status) {
 }
 
 void Task::setStatus(Task::Status status) {
-    std::unique_lock<std::mutex> guard(_taskStatusMutex);
     _status = status;
 }
 
+void Task::notifyWaiters() {
+    if (_parkedWaiters == 0) return;
+    {
+        // the waiter which has checked the status is parked when the mutex is released
+        std::lock_guard<std::mutex> guard(_taskStatusMutex);
+    }
+    _isTaskDoneCondVar.notify_all();
+}
+
+bool Task::isCompleted() const {
+    Status status = _status;
+    return status == TS_DONE || status == TS_ERROR;
+}
+
 bool Task::isOnWait() {
     return _isOnWait;
 }
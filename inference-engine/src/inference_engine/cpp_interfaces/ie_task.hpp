@@ -8,6 +8,8 @@
 #include <vector>
 #include <mutex>
 #include <memory>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <thread>
 #include <queue>
@@ -68,8 +70,17 @@ public:
      */
     Status wait(int64_t millis_timeout);
 
+    /**
+     * @brief Sets the time of the active waiting in wait() before the thread is parked on the condition variable.
+     *  @note The short tasks are completed before the waiting thread is parked and woken up by the scheduler
+     * @param spinTime - the time to poll the status of the task, zero (default) parks the thread at once
+     */
+    void setWaitSpinTime(std::chrono::microseconds spinTime);
+
     /**
      * @brief Occupies task for launching. Makes busy status, if task is not running
+     *  @note If the tracing is enabled the time of the occupation is remembered, the wait of the task in the queue of
+     *  the executor is traced as TaskQueueWait when it is run
      * @return true if occupation succeed, otherwise - false
      */
     bool occupy();
@@ -85,12 +96,22 @@ public:
 protected:
     void setStatus(Status status);
 
+    /**
+     * @brief Wakes up the threads parked in wait(), the mutex is not taken if nobody is parked
+     */
+    void notifyWaiters();
+
+    bool isCompleted() const;
+
 protected:
     std::function<void()> _function;
-    Status _status;
+    std::atomic<Status> _status;
     std::exception_ptr _exceptionPtr = nullptr;
     std::mutex _taskStatusMutex;
     std::condition_variable _isTaskDoneCondVar;
+    std::atomic<int> _parkedWaiters;
+    std::chrono::microseconds _waitSpinTime;
+    TraceCollector::Clock::time_point _occupiedTime;
 
     bool _isOnWait = false;
 };
@@ -17,8 +17,10 @@
 
 namespace InferenceEngine {
 
-TaskExecutor::TaskExecutor(std::string name) : _isStopped(false), _name(name) {
-    _thread = std::make_shared<std::thread>([&] {
+TaskExecutor::TaskExecutor(std::string name, const TaskExecutorConfig &config) : _isStopped(false), _name(name) {
+    checkTaskExecutorConfig(config);
+    _thread = std::make_shared<std::thread>([this, config] {
+        applyTaskExecutorConfig(config);
         while (!_isStopped) {
             bool isQueueEmpty;
             Task::Ptr currentTask;
@@ -31,9 +33,12 @@ TaskExecutor::TaskExecutor(std::string name) : _isStopped(false), _name(name) {
             if (_isStopped && isQueueEmpty)
                 break;
             if (!isQueueEmpty) {
+                _utilization.taskStarted(0);
                 currentTask->runNoThrowNoBusyCheck();
                 std::unique_lock<std::mutex> lock(_queueMutex);
                 _taskQueue.pop();
+                // the task leaves the queue and the running ones at once, so the metrics read under the lock agree
+                _utilization.taskFinished(0);
                 isQueueEmpty = _taskQueue.empty();
                 if (isQueueEmpty) {
                     // notify dtor, that all tasks were completed
@@ -67,4 +72,13 @@ bool TaskExecutor::startTask(Task::Ptr task) {
     return true;
 }
 
+ExecutorMetrics TaskExecutor::getMetrics() const {
+    std::unique_lock<std::mutex> lock(_queueMutex);
+    const size_t queued = _taskQueue.size();
+    ExecutorMetrics metrics = _utilization.getTotal(0);
+    // the running task leaves the queue when it's completed
+    metrics.queueDepth = queued > metrics.runningTasks ? queued - metrics.runningTasks : 0;
+    return metrics;
+}
+
 }  // namespace InferenceEngine
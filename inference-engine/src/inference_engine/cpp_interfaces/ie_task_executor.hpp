@@ -18,6 +18,8 @@
 #include "cpp_interfaces/ie_task.hpp"
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/ie_itask_executor.hpp"
+#include "cpp_interfaces/ie_thread_affinity.hpp"
+#include "cpp_interfaces/ie_executor_utilization.hpp"
 
 namespace InferenceEngine {
 
@@ -25,7 +27,10 @@ class INFERENCE_ENGINE_API_CLASS(TaskExecutor) : public ITaskExecutor {
 public:
     typedef std::shared_ptr<TaskExecutor> Ptr;
 
-    TaskExecutor(std::string name = "Default");
+    /**
+     * @param config - the processors and the priority of the working thread, it runs anywhere by default
+     */
+    TaskExecutor(std::string name = "Default", const TaskExecutorConfig &config = {});
 
     ~TaskExecutor();
 
@@ -37,13 +42,16 @@ public:
      */
     bool startTask(Task::Ptr task) override;
 
+    ExecutorMetrics getMetrics() const override;
+
 private:
     std::shared_ptr<std::thread> _thread;
-    std::mutex _queueMutex;
+    mutable std::mutex _queueMutex;
     std::condition_variable _queueCondVar;
     std::queue<Task::Ptr> _taskQueue;
     bool _isStopped;
     std::string _name;
+    ExecutorUtilization _utilization{1};
 };
 
 }  // namespace InferenceEngine
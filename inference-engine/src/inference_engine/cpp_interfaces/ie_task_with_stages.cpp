@@ -37,7 +37,7 @@ Task::Status StagedTask::runNoThrowNoBusyCheck() noexcept {
     }
 
     if (_status != TS_POSTPONED) {
-        _isTaskDoneCondVar.notify_all();
+        notifyWaiters();
     }
     return getStatus();
 }
@@ -0,0 +1,132 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "details/ie_exception.hpp"
+#include "cpp_interfaces/ie_thread_affinity.hpp"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif !defined(__APPLE__)
+#include <sched.h>
+#include <sys/resource.h>
+#include <cerrno>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+#if defined(_WIN32)
+// the affinity mask of the thread covers the processors of its processor group only
+const int maxCpus = static_cast<int>(sizeof(DWORD_PTR) * 8);
+#elif !defined(__APPLE__)
+const int maxCpus = CPU_SETSIZE;
+#else
+const int maxCpus = 0;
+#endif
+
+// the step of the nice value per the level of the priority, the levels of Windows span the same range
+const int niceStep = 5;
+
+}  // namespace
+
+void checkTaskExecutorConfig(const TaskExecutorConfig &config) {
+    if (config.priority < -2 || config.priority > 2)
+        THROW_IE_EXCEPTION << "The priority " << config.priority << " of the threads is out of the range [-2, 2]";
+    if (config.cpus.empty())
+        return;
+
+    const int available = static_cast<int>(std::thread::hardware_concurrency());
+    for (int cpu : config.cpus) {
+        if (cpu < 0 || (available > 0 && cpu >= available) || cpu >= maxCpus)
+            THROW_IE_EXCEPTION << "The processor " << cpu << " is not available to bind the threads to";
+    }
+}
+
+void applyTaskExecutorConfig(const TaskExecutorConfig &config) noexcept {
+#if defined(_WIN32)
+    if (!config.cpus.empty()) {
+        DWORD_PTR mask = 0;
+        for (int cpu : config.cpus)
+            mask |= static_cast<DWORD_PTR>(1) << cpu;
+        SetThreadAffinityMask(GetCurrentThread(), mask);
+    }
+    if (config.priority != 0)
+        SetThreadPriority(GetCurrentThread(), config.priority);
+#elif !defined(__APPLE__)
+    if (!config.cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : config.cpus)
+            CPU_SET(cpu, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+    if (config.priority != 0) {
+        // the nice value of Linux is the one of the thread, the new threads inherit the value of their creator
+        errno = 0;
+        const int nice = getpriority(PRIO_PROCESS, 0);
+        if (errno == 0)
+            setpriority(PRIO_PROCESS, 0, nice - niceStep * config.priority);
+    }
+#endif
+}
+
+std::vector<int> parseCpuList(const std::string &key, const std::string &value) {
+    // std::getline skips the empty item at the end, so the separator is appended to read it (and reject it) too
+    std::vector<int> cpus;
+    std::stringstream stream(value + ',');
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        int first = -1, last = -1;
+        try {
+            size_t pos = 0;
+            first = last = std::stoi(item, &pos);
+            if (pos < item.size() && item[pos] == '-') {
+                size_t lastPos = 0;
+                last = std::stoi(item.substr(pos + 1), &lastPos);
+                pos += 1 + lastPos;
+            }
+            if (pos != item.size())
+                first = -1;
+        } catch (const std::exception&) {
+            first = -1;
+        }
+        if (first < 0 || last < first)
+            THROW_IE_EXCEPTION << "Wrong value for property key " << key
+                               << ". Expected only the comma separated non-negative numbers and ranges (#processor or "
+                               << "#first-#last)";
+        for (int cpu = first; cpu <= last; cpu++) {
+            for (int listed : cpus) {
+                if (listed == cpu)
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << key
+                                       << ". The processor " << cpu << " is listed twice";
+            }
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+int parseThreadsPriority(const std::string &key, const std::string &value) {
+    int priority = 0;
+    size_t pos = 0;
+    try {
+        priority = std::stoi(value, &pos);
+    } catch (const std::exception&) {
+        pos = 0;
+    }
+    if (pos == 0 || pos != value.size() || priority < -2 || priority > 2)
+        THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only the numbers from -2 to 2";
+    return priority;
+}
+
+}  // namespace InferenceEngine
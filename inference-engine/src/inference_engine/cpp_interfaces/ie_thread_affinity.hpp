@@ -0,0 +1,58 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The placement of the working threads of a task executor. The threads which dispatch the asynchronous
+ * requests and run their callbacks are kept off the cores of the inference threads by it, the priority lets
+ * the inference threads preempt them.
+ */
+struct TaskExecutorConfig {
+    /**
+     * @brief The logical processors of the OS the threads run on, empty means the threads are not bound
+     */
+    std::vector<int> cpus;
+    /**
+     * @brief The priority of the threads relative to the normal one, from -2 (lowest) to 2 (highest).
+     * The higher priority may be denied by the OS to the unprivileged process, then the threads keep the normal one
+     */
+    int priority = 0;
+
+    bool operator==(const TaskExecutorConfig &other) const {
+        return cpus == other.cpus && priority == other.priority;
+    }
+};
+
+/**
+ * @brief Throws if the processors or the priority of the config are wrong
+ */
+INFERENCE_ENGINE_API_CPP(void) checkTaskExecutorConfig(const TaskExecutorConfig &config);
+
+/**
+ * @brief Binds the calling thread and sets its priority, the thread is kept as it is if the OS fails to do it.
+ * The binding and the priority are supported on Linux and Windows
+ */
+INFERENCE_ENGINE_API_CPP(void) applyTaskExecutorConfig(const TaskExecutorConfig &config) noexcept;
+
+/**
+ * @brief Parses the comma separated list of the processors and of the ranges of them, e.g. "0-3,8"
+ * @param key - the config key of the list, it is reported by the exception thrown for the wrong list
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<int>) parseCpuList(const std::string &key, const std::string &value);
+
+/**
+ * @brief Parses the priority of TaskExecutorConfig, the number from -2 to 2
+ * @param key - the config key of the priority, it is reported by the exception thrown for the wrong value
+ */
+INFERENCE_ENGINE_API_CPP(int) parseThreadsPriority(const std::string &key, const std::string &value);
+
+}  // namespace InferenceEngine
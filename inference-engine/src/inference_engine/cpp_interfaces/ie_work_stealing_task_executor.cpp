@@ -0,0 +1,142 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include "details/ie_exception.hpp"
+#include "ie_task.hpp"
+#include "ie_work_stealing_task_executor.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+// the executor and the index of the worker executed by the current thread
+thread_local const WorkStealingTaskExecutor *currentExecutor = nullptr;
+thread_local size_t currentWorker = 0;
+
+}  // namespace
+
+WorkStealingTaskExecutor::WorkStealingTaskExecutor(size_t workersNumber, std::string name,
+                                                   const TaskExecutorConfig &config)
+        : _pendingTasks(0), _unfinishedTasks(0), _isStopped(false), _nextWorker(0), _name(name) {
+    checkTaskExecutorConfig(config);
+    workersNumber = (std::max)(workersNumber, static_cast<size_t>(1));
+    _utilization.reset(new ExecutorUtilization(workersNumber));
+    for (size_t i = 0; i < workersNumber; i++) {
+        _workers.emplace_back(new Worker());
+    }
+    for (size_t i = 0; i < workersNumber; i++) {
+        _workers[i]->thread = std::thread([this, i, config] {
+            applyTaskExecutorConfig(config);
+            run(i);
+        });
+    }
+}
+
+WorkStealingTaskExecutor::~WorkStealingTaskExecutor() {
+    {
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        if (_unfinishedTasks) {
+            _doneCondVar.wait(lock, [this]() { return _unfinishedTasks == 0; });
+        }
+        _isStopped = true;
+        _queueCondVar.notify_all();
+    }
+    for (auto &worker : _workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+bool WorkStealingTaskExecutor::startTask(Task::Ptr task) {
+    if (!task->occupy()) return false;
+    // the worker keeps its own tasks to run them while the data is hot in its cache
+    size_t worker = currentExecutor == this ? currentWorker : _nextWorker++ % _workers.size();
+    {
+        std::unique_lock<std::mutex> lock(_workers[worker]->mutex);
+        _workers[worker]->tasks.push_back(task);
+    }
+    std::unique_lock<std::mutex> lock(_queueMutex);
+    _pendingTasks++;
+    _unfinishedTasks++;
+    _queueCondVar.notify_one();
+    return true;
+}
+
+size_t WorkStealingTaskExecutor::getWorkersNumber() const {
+    return _workers.size();
+}
+
+ExecutorMetrics WorkStealingTaskExecutor::getMetrics() const {
+    size_t pending;
+    {
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        pending = _pendingTasks;
+    }
+    return _utilization->getTotal(pending);
+}
+
+bool WorkStealingTaskExecutor::popTask(size_t worker, Task::Ptr &task) {
+    {
+        std::unique_lock<std::mutex> lock(_workers[worker]->mutex);
+        auto &tasks = _workers[worker]->tasks;
+        if (!tasks.empty()) {
+            task = tasks.back();
+            tasks.pop_back();
+            return true;
+        }
+    }
+    for (size_t i = 1; i < _workers.size(); i++) {
+        auto &victim = *_workers[(worker + i) % _workers.size()];
+        std::unique_lock<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingTaskExecutor::run(size_t worker) {
+    currentExecutor = this;
+    currentWorker = worker;
+    while (true) {
+        {  // waiting for the new task or for stop signal
+            std::unique_lock<std::mutex> lock(_queueMutex);
+            _queueCondVar.wait(lock, [&]() { return _pendingTasks != 0 || _isStopped; });
+            if (_pendingTasks == 0)
+                break;
+            // reserves one of the tasks in the deques, so the search below always finds a task
+            _pendingTasks--;
+        }
+        Task::Ptr currentTask;
+        while (!popTask(worker, currentTask)) {
+            // the other workers took the tasks found first, the task left for this one is in a visited deque
+            std::this_thread::yield();
+        }
+        _utilization->taskStarted(worker);
+        currentTask->runNoThrowNoBusyCheck();
+        _utilization->taskFinished(worker);
+        currentTask.reset();
+
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        if (--_unfinishedTasks == 0) {
+            // notify dtor, that all tasks were completed
+            _doneCondVar.notify_all();
+        }
+    }
+    currentExecutor = nullptr;
+}
+
+}  // namespace InferenceEngine
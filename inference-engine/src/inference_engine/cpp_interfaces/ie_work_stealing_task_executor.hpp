@@ -0,0 +1,86 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include <atomic>
+#include "ie_api.h"
+#include "details/ie_exception.hpp"
+#include "cpp_interfaces/ie_task.hpp"
+#include "cpp_interfaces/ie_itask_executor.hpp"
+#include "cpp_interfaces/ie_thread_affinity.hpp"
+#include "cpp_interfaces/ie_executor_utilization.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class WorkStealingTaskExecutor
+ * @brief The task executor with the pool of the working threads. Every worker owns the deque of the tasks:
+ * the tasks started from a worker go to the back of its own deque, the other tasks are distributed round-robin.
+ * A worker takes the tasks from the back of its own deque and steals them from the front of the others,
+ * so several tasks (e.g. the in-flight asynchronous requests) run concurrently.
+ * @note The tasks are not executed in FIFO mode. The tasks run at the same time only if they are independent,
+ * e.g. the plugin can infer several requests of the network at once.
+ */
+class INFERENCE_ENGINE_API_CLASS(WorkStealingTaskExecutor) : public ITaskExecutor {
+public:
+    typedef std::shared_ptr<WorkStealingTaskExecutor> Ptr;
+
+    /**
+     * @param config - the processors and the priority of the workers, all of them share the processors
+     */
+    explicit WorkStealingTaskExecutor(size_t workersNumber = std::thread::hardware_concurrency(),
+                                      std::string name = "Default", const TaskExecutorConfig &config = {});
+
+    /**
+     * @brief Waits for all the started tasks and stops the workers
+     */
+    ~WorkStealingTaskExecutor();
+
+    /**
+     * @brief Add task for execution and notify an idle working thread about new task to start.
+     * @note can be called from multiple threads and from the tasks executed by this executor
+     * @param task - shared pointer to the task to start
+     *  @return true if succeed to add task, otherwise - false
+     */
+    bool startTask(Task::Ptr task) override;
+
+    size_t getWorkersNumber() const;
+
+    ExecutorMetrics getMetrics() const override;
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task::Ptr> tasks;
+        std::thread thread;
+    };
+
+    void run(size_t worker);
+
+    bool popTask(size_t worker, Task::Ptr &task);
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    mutable std::mutex _queueMutex;
+    std::condition_variable _queueCondVar;
+    std::condition_variable _doneCondVar;
+    // the number of the tasks in the deques which are not reserved by the workers yet
+    size_t _pendingTasks;
+    // the number of the started tasks which are not completed yet
+    size_t _unfinishedTasks;
+    bool _isStopped;
+    std::atomic<size_t> _nextWorker;
+    std::string _name;
+    std::unique_ptr<ExecutorUtilization> _utilization;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,402 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * \brief the executable network which infers the concurrent requests of the batch 1 by the batches
+ * of the network loaded with the dynamic batch (see PluginConfigParams::KEY_AUTO_BATCH)
+ * \file ie_executable_network_batching.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <ie_plugin_config.hpp>
+#include <cpp/ie_executable_network.hpp>
+#include <cpp/ie_infer_request.hpp>
+#include <blob_transform.hpp>
+#include "ie_blob_proxy.hpp"
+#include "cpp_interfaces/impl/ie_executable_network_thread_safe_async_only.hpp"
+#include "cpp_interfaces/impl/ie_infer_async_request_internal.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The parameters of the batching of KEY_AUTO_BATCH and KEY_AUTO_BATCH_TIMEOUT taken from the config
+ * of LoadNetwork(), the rest of the config is passed to the plugin
+ */
+struct BatchingConfig {
+    explicit BatchingConfig(const std::map<std::string, std::string> &config) {
+        for (const auto &item : config) {
+            if (item.first == PluginConfigParams::KEY_AUTO_BATCH) {
+                batchSize = parse(item.first, item.second, false);
+            } else if (item.first == PluginConfigParams::KEY_AUTO_BATCH_TIMEOUT) {
+                timeout = std::chrono::microseconds(parse(item.first, item.second, true));
+            } else {
+                networkConfig.insert(item);
+            }
+        }
+    }
+
+    // the largest batch of the requests, 1 disables the batching
+    size_t batchSize = 1;
+    // the time the first queued request waits for the batch to be filled
+    std::chrono::microseconds timeout = std::chrono::microseconds(1000);
+    std::map<std::string, std::string> networkConfig;
+
+private:
+    static size_t parse(const std::string &key, const std::string &value, bool zeroAllowed) {
+        int number = -1;
+        try {
+            size_t end = 0;
+            number = std::stoi(value, &end);
+            if (end != value.size()) number = -1;
+        } catch (...) {
+        }
+        if (number < (zeroAllowed ? 0 : 1)) {
+            THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported value " << value << " of the key " << key;
+        }
+        return static_cast<size_t>(number);
+    }
+};
+
+/**
+ * @brief Creates the blob of the image of the batched blob at the slot, the blob shares the memory of the batched one
+ * @param batched - the blob with the batch as the outer dimension
+ */
+inline Blob::Ptr makeBatchSlotBlob(const Blob::Ptr &batched, size_t slot, size_t batchSize) {
+    const TensorDesc &desc = batched->getTensorDesc();
+    SizeVector dims = desc.getDims();
+    if (dims.empty() || dims[0] != batchSize || desc.getBlockingDesc().getOrder()[0] != 0) {
+        THROW_IE_EXCEPTION << "The batch is not the outer dimension of the blob of the layout " << desc.getLayout();
+    }
+    dims[0] = 1;
+    // the proxies take the reversed dimensions
+    const SizeVector reversed(dims.rbegin(), dims.rend());
+    const size_t offset = slot * (batched->size() / batchSize);
+    switch (batched->element_size()) {
+        case 1: return std::make_shared<TBlobProxy<uint8_t>>(desc.getPrecision(), desc.getLayout(), batched, offset, reversed);
+        case 2: return std::make_shared<TBlobProxy<int16_t>>(desc.getPrecision(), desc.getLayout(), batched, offset, reversed);
+        case 4: return std::make_shared<TBlobProxy<float>>(desc.getPrecision(), desc.getLayout(), batched, offset, reversed);
+        default:
+            THROW_IE_EXCEPTION << "Unsupported precision " << desc.getPrecision() << " of the batched blob";
+    }
+}
+
+class BatchingInferRequest;
+
+/**
+ * @brief Queues the started requests of the batch 1 and infers them by the requests of the batched network: a batch
+ * is started when it is full or the first queued request has waited for the timeout, and a request of the batched
+ * network is free. The inputs are copied to the slots of the batch and the outputs are copied back on the completion.
+ */
+class BatchAggregator {
+public:
+    using Ptr = std::shared_ptr<BatchAggregator>;
+
+    /**
+     * @param batchedNetwork - the network loaded with the batch of batchSize and KEY_DYN_BATCH_ENABLED
+     * @param batchedRequests - the number of the batches inferred at once, the next batch is collected and copied
+     * while the previous one is inferred
+     */
+    BatchAggregator(ExecutableNetwork batchedNetwork, size_t batchSize, std::chrono::microseconds timeout,
+                    size_t batchedRequests = 2)
+            : _batchedNetwork(batchedNetwork), _batchSize(batchSize), _timeout(timeout) {
+        for (size_t i = 0; i < batchedRequests; i++) {
+            std::unique_ptr<Slot> slot(new Slot());
+            slot->request = _batchedNetwork.CreateInferRequest();
+            Slot *slotPtr = slot.get();
+            slot->request.SetCompletionCallback(std::function<void(InferRequest, StatusCode)>(
+                    [this, slotPtr](InferRequest, StatusCode status) { onBatchDone(*slotPtr, status); }));
+            _slots.push_back(std::move(slot));
+        }
+        _worker = std::thread([this]() { run(); });
+    }
+
+    ~BatchAggregator() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        _worker.join();
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this]() {
+            for (const auto &slot : _slots) {
+                if (slot->busy) return false;
+            }
+            return true;
+        });
+    }
+
+    size_t getBatchSize() const {
+        return _batchSize;
+    }
+
+    void enqueue(BatchingInferRequest *request) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queue.emplace_back(request, std::chrono::steady_clock::now());
+        }
+        _cv.notify_all();
+    }
+
+private:
+    struct Slot {
+        InferRequest request;
+        std::vector<BatchingInferRequest *> requests;
+        bool busy = false;
+    };
+
+    void run();
+    void startBatch(Slot &slot);
+    void onBatchDone(Slot &slot, StatusCode status);
+    void finishBatch(Slot &slot, StatusCode status, const std::string &error);
+
+    ExecutableNetwork _batchedNetwork;
+    const size_t _batchSize;
+    const std::chrono::microseconds _timeout;
+    std::vector<std::unique_ptr<Slot>> _slots;
+    std::deque<std::pair<BatchingInferRequest *, std::chrono::steady_clock::time_point>> _queue;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stop = false;
+    std::thread _worker;
+};
+
+/**
+ * @brief The request of the batch 1 inferred as a slot of a batch by BatchAggregator
+ */
+class BatchingInferRequest : public AsyncInferRequestInternal {
+public:
+    BatchingInferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs, const BatchAggregator::Ptr &aggregator)
+            : AsyncInferRequestInternal(networkInputs, networkOutputs), _aggregator(aggregator) {
+        for (const auto &input : _networkInputs) {
+            _inputs[input.first] = make_blob_with_precision(input.second->getTensorDesc());
+            _inputs[input.first]->allocate();
+        }
+        for (const auto &output : _networkOutputs) {
+            _outputs[output.first] = make_blob_with_precision(output.second->getTensorDesc());
+            _outputs[output.first]->allocate();
+        }
+    }
+
+    ~BatchingInferRequest() override {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done.wait(lock, [this]() { return !_busy && !_completing; });
+    }
+
+    void StartAsyncImpl() override {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_busy) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+            _busy = true;
+            _status = RESULT_NOT_READY;
+            _error.clear();
+        }
+        try {
+            execDataPreprocessing();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _busy = false;
+            _status = INFER_NOT_STARTED;
+            throw;
+        }
+        _aggregator->enqueue(this);
+    }
+
+    void InferImpl() override {
+        StartAsyncImpl();
+        Wait(IInferRequest::WaitMode::RESULT_READY);
+    }
+
+    StatusCode Wait(int64_t millis_timeout) override {
+        if (millis_timeout < IInferRequest::WaitMode::RESULT_READY) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str + "Timeout can't be less "
+                               << IInferRequest::WaitMode::RESULT_READY << " for InferRequest::Wait\n";
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto ready = [this]() { return !_busy && !_completing; };
+        if (millis_timeout == IInferRequest::WaitMode::RESULT_READY) {
+            _done.wait(lock, ready);
+        } else if (millis_timeout > 0) {
+            _done.wait_for(lock, std::chrono::milliseconds(millis_timeout), ready);
+        }
+        if (_busy) return RESULT_NOT_READY;
+        if (_status != OK && _status != INFER_NOT_STARTED) THROW_IE_EXCEPTION << _error;
+        return _status;
+    }
+
+    void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const override {
+        InferRequest lastBatch;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            lastBatch = _lastBatch;
+        }
+        if (!lastBatch) THROW_IE_EXCEPTION << INFER_NOT_STARTED_str;
+        // the counters of the last batch the request was inferred by
+        perfMap = lastBatch.GetPerformanceCounts();
+    }
+
+    const BlobMap &getInputs() const {
+        return _inputs;
+    }
+
+    const BlobMap &getOutputs() const {
+        return _outputs;
+    }
+
+    /**
+     * @brief Completes the request inferred by the batch, the callback is called by the thread of the batch
+     */
+    void complete(StatusCode status, const std::string &error, const InferRequest &batch) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _status = status;
+            _error = error;
+            _lastBatch = batch;
+            _busy = false;
+            _completing = true;
+        }
+        if (_callback) {
+            auto request = _publicInterface.lock();
+            if (request) _callback(request, status);
+        }
+        // the request may be destroyed right after the waiters are notified, so they are notified under the lock
+        std::lock_guard<std::mutex> lock(_mutex);
+        _completing = false;
+        _done.notify_all();
+    }
+
+private:
+    BatchAggregator::Ptr _aggregator;
+    mutable std::mutex _mutex;
+    std::condition_variable _done;
+    bool _busy = false;
+    // the callback of the completed request is called, the request may be started again by it
+    bool _completing = false;
+    StatusCode _status = INFER_NOT_STARTED;
+    std::string _error;
+    InferRequest _lastBatch;
+};
+
+inline void BatchAggregator::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _cv.wait(lock, [this]() { return _stop || !_queue.empty(); });
+        if (_stop) return;
+        const auto deadline = _queue.front().second + _timeout;
+        _cv.wait_until(lock, deadline, [this]() { return _stop || _queue.size() >= _batchSize; });
+
+        Slot *freeSlot = nullptr;
+        _cv.wait(lock, [this, &freeSlot]() {
+            for (const auto &slot : _slots) {
+                if (!slot->busy) {
+                    freeSlot = slot.get();
+                    return true;
+                }
+            }
+            return _stop;
+        });
+        if (_stop) return;
+
+        // the requests queued while the batches were busy join the batch
+        freeSlot->busy = true;
+        freeSlot->requests.clear();
+        while (!_queue.empty() && freeSlot->requests.size() < _batchSize) {
+            freeSlot->requests.push_back(_queue.front().first);
+            _queue.pop_front();
+        }
+        lock.unlock();
+        startBatch(*freeSlot);
+        lock.lock();
+    }
+}
+
+inline void BatchAggregator::startBatch(Slot &slot) {
+    try {
+        for (size_t i = 0; i < slot.requests.size(); i++) {
+            for (const auto &input : slot.requests[i]->getInputs()) {
+                blob_copy(input.second, makeBatchSlotBlob(slot.request.GetBlob(input.first), i, _batchSize));
+            }
+        }
+        slot.request.SetBatch(static_cast<int>(slot.requests.size()));
+        slot.request.StartAsync();
+    } catch (const std::exception &e) {
+        finishBatch(slot, GENERAL_ERROR, e.what());
+    }
+}
+
+inline void BatchAggregator::onBatchDone(Slot &slot, StatusCode status) {
+    if (status != OK) {
+        finishBatch(slot, status, "The inference of the batch has failed with the status " + std::to_string(status));
+        return;
+    }
+    try {
+        for (size_t i = 0; i < slot.requests.size(); i++) {
+            for (const auto &output : slot.requests[i]->getOutputs()) {
+                blob_copy(makeBatchSlotBlob(slot.request.GetBlob(output.first), i, _batchSize), output.second);
+            }
+        }
+    } catch (const std::exception &e) {
+        finishBatch(slot, GENERAL_ERROR, e.what());
+        return;
+    }
+    finishBatch(slot, OK, "");
+}
+
+inline void BatchAggregator::finishBatch(Slot &slot, StatusCode status, const std::string &error) {
+    // the outputs are copied, so the next batch may be started by the request while the callbacks are called
+    std::vector<BatchingInferRequest *> requests;
+    requests.swap(slot.requests);
+    InferRequest batch = slot.request;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        slot.busy = false;
+        _cv.notify_all();
+    }
+    for (auto request : requests) {
+        request->complete(status, error, batch);
+    }
+}
+
+/**
+ * @brief The executable network of the batch 1 which infers its requests by the batches of the batched network
+ */
+class BatchingExecutableNetwork : public ExecutableNetworkThreadSafeAsyncOnly {
+public:
+    BatchingExecutableNetwork(ExecutableNetwork batchedNetwork, size_t batchSize, std::chrono::microseconds timeout) {
+        for (const auto &input : batchedNetwork.GetInputsInfo()) {
+            const SizeVector &dims = input.second->getTensorDesc().getDims();
+            if (dims.empty() || dims[0] != batchSize)
+                THROW_IE_EXCEPTION << "The batch is not the outer dimension of the input " << input.first;
+        }
+        for (const auto &output : batchedNetwork.GetOutputsInfo()) {
+            const SizeVector &dims = output.second->getTensorDesc().getDims();
+            if (dims.empty() || dims[0] != batchSize)
+                THROW_IE_EXCEPTION << "The batch is not the outer dimension of the output " << output.first;
+        }
+        _aggregator = std::make_shared<BatchAggregator>(batchedNetwork, batchSize, timeout);
+    }
+
+    AsyncInferRequestInternal::Ptr
+    CreateAsyncInferRequestImpl(InputsDataMap networkInputs, OutputsDataMap networkOutputs) override {
+        return std::make_shared<BatchingInferRequest>(networkInputs, networkOutputs, _aggregator);
+    }
+
+private:
+    BatchAggregator::Ptr _aggregator;
+};
+
+}  // namespace InferenceEngine
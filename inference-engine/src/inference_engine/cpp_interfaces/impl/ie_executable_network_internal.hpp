@@ -60,6 +60,14 @@ public:
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
 
+    void Reshape(const std::map<std::string, SizeVector> &inputShapes) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    void GetExecutorMetrics(std::map<std::string, ExecutorMetrics> &metrics) const override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
     void SetPointerToPluginInternal(InferencePluginInternalPtr plugin) {
         _plugin = plugin;
     }
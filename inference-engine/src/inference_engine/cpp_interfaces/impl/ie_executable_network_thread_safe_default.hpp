@@ -42,16 +42,41 @@ public:
         auto syncRequestImpl = this->CreateInferRequestImpl(_networkInputs, _networkOutputs);
         syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
         auto asyncTreadSafeImpl = std::make_shared<AsyncInferRequestThreadSafeDefault>(
-                syncRequestImpl, _taskExecutor, _taskSynchronizer, _callbackExecutor);
+                syncRequestImpl, _taskExecutor, _taskSynchronizer, _callbackExecutor, _preprocessExecutor);
         asyncRequest.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncTreadSafeImpl),
                            [](IInferRequest *p) { p->Release(); });
         asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
     }
 
+    /**
+     * @brief Given optional implementation of the executor metrics: the "infer", the "callback" and the "preprocess"
+     * (the pipelined requests only) executors, the ones which do not track their utilization are skipped
+     */
+    void GetExecutorMetrics(std::map<std::string, ExecutorMetrics> &metrics) const override {
+        metrics.clear();
+        auto add = [&metrics](const std::string &name, const ITaskExecutor::Ptr &executor) {
+            if (!executor) return;
+            ExecutorMetrics executorMetrics = executor->getMetrics();
+            if (executorMetrics.workers != 0) metrics[name] = executorMetrics;
+        };
+        add("infer", _taskExecutor);
+        add("callback", _callbackExecutor);
+        add("preprocess", _preprocessExecutor);
+    }
+
 protected:
     TaskSynchronizer::Ptr _taskSynchronizer;
+    /**
+     * @brief Executes the asynchronous requests one by one. The plugin which infers several requests of the network
+     * at once can replace it with the WorkStealingTaskExecutor to run the in-flight requests concurrently.
+     */
     ITaskExecutor::Ptr _taskExecutor = nullptr;
     ITaskExecutor::Ptr _callbackExecutor = nullptr;
+    /**
+     * @brief Pre-processes the inputs of the pipelined asynchronous requests (see AsyncInferRequestThreadSafeDefault),
+     * nullptr (default) keeps the pre-processing in the inference
+     */
+    ITaskExecutor::Ptr _preprocessExecutor = nullptr;
 };
 
 }  // namespace InferenceEngine
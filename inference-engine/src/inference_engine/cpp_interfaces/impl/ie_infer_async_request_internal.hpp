@@ -54,6 +54,8 @@ public:
 
     void StartAsync() override {
         checkBlobs();
+        _cancellation.start();
+        _timings.start();
         StartAsyncImpl();
     };
 
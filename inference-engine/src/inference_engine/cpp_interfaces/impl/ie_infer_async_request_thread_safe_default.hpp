@@ -10,6 +10,7 @@
 #include <list>
 #include <string>
 #include <mutex>
+#include <chrono>
 #include <exception>
 #include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
 #include <cpp_interfaces/ie_task_with_stages.hpp>
@@ -71,6 +72,10 @@ public:
         _requestStatus = requestStatus;
     }
 
+    StatusCode get_requestStatus() const {
+        return _requestStatus;
+    }
+
     void set_callback(IInferRequest::CompletionCallback callback) {
         enableCallback();
         _callback = callback;
@@ -85,13 +90,21 @@ class AsyncInferRequestThreadSafeDefault : public AsyncInferRequestThreadSafeInt
 public:
     typedef std::shared_ptr<AsyncInferRequestThreadSafeDefault> Ptr;
 
+    /**
+     * @param preprocessExecutor - the executor of the pre-processing stage of the pipelined request, the requests
+     * started one after another pre-process the inputs on it while the previous one is inferred by taskExecutor,
+     * and the post-processing stage is executed by callbackExecutor. If it is nullptr (default) the pre-processing
+     * is a part of the inference.
+     */
     explicit AsyncInferRequestThreadSafeDefault(InferRequestInternal::Ptr request,
                                                 const ITaskExecutor::Ptr &taskExecutor,
                                                 const TaskSynchronizer::Ptr &taskSynchronizer,
-                                                const ITaskExecutor::Ptr &callbackExecutor)
+                                                const ITaskExecutor::Ptr &callbackExecutor,
+                                                const ITaskExecutor::Ptr &preprocessExecutor = nullptr)
             : _syncRequest(request),
               _requestExecutor(taskExecutor),
               _requestSynchronizer(taskSynchronizer),
+              _preprocessExecutor(preprocessExecutor),
               _callbackManager(callbackExecutor) {
         _syncTask = std::make_shared<Task>([this]() { _syncRequest->Infer(); });
         _currentTask = _syncTask;
@@ -138,15 +151,20 @@ public:
             }
         }
         _asyncTask->resetStages();
+        // the inline completion is short, so the waiting thread polls the status before it is parked
+        _asyncTask->setWaitSpinTime(std::chrono::microseconds(_inlineCompletion ? 50 : 0));
         _currentTask = _asyncTask;
     }
 
     virtual void startAsyncTask() {
-        if (!_requestExecutor->startTask(_currentTask)) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        auto &executor = _preprocessExecutor ? _preprocessExecutor : _requestExecutor;
+        if (!executor->startTask(_currentTask)) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
     }
 
     void StartAsync_ThreadUnsafe() override {
         _syncRequest->checkBlobs();
+        _syncRequest->getCancellation().start();
+        _syncRequest->getTimings().start();
         _callbackManager.reset();
         initNextAsyncTask();
         startAsyncTask();
@@ -159,33 +177,59 @@ public:
         if (_callbackManager.isCallbackEnabled() && asyncTask->getStage() >= 1) {
             // jump to the "callback" stage because of happened error
             while (asyncTask->getStage() != 1) asyncTask->stageDone();
-            _callbackManager.set_requestStatus(GENERAL_ERROR);
+            _callbackManager.set_requestStatus(getFailureStatus(requestException));
             _callbackManager.set_requestException(requestException);
-            _callbackManager.startTask(asyncTask);
+            if (_inlineCompletion) {
+                completeAsyncTask(asyncTask);
+            } else {
+                _callbackManager.startTask(asyncTask);
+            }
         } else {
             std::rethrow_exception(requestException);
         }
     }
 
+    /**
+     * @brief The status the callback of the failed request is called with: INFER_CANCELLED for the cancelled
+     * inference and GENERAL_ERROR for the others
+     */
+    static StatusCode getFailureStatus(const std::exception_ptr &requestException) {
+        try {
+            std::rethrow_exception(requestException);
+        } catch (const details::InferenceEngineException &iex) {
+            if (iex.hasStatus() && iex.getStatus() == INFER_CANCELLED)
+                return INFER_CANCELLED;
+        } catch (...) {}
+        return GENERAL_ERROR;
+    }
+
     virtual StagedTask::Ptr createAsyncRequestTask() {
         return std::make_shared<StagedTask>([this]() {
             auto asyncTaskCopy = _asyncTask;
             try {
                 switch (asyncTaskCopy->getStage()) {
+                    case 3: {
+                        _syncRequest->Preprocess();
+                        asyncTaskCopy->stageDone();
+                        if (!_requestExecutor->startTask(asyncTaskCopy)) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+                    }
+                        break;
                     case 2: {
                         _syncRequest->Infer();
                         asyncTaskCopy->stageDone();
-                        if (_callbackManager.isCallbackEnabled()) {
-                            _callbackManager.startTask(asyncTaskCopy);
-                        } else {
+                        if (!_callbackManager.isCallbackEnabled() && !_preprocessExecutor) {
                             asyncTaskCopy->stageDone();
+                        } else if (_inlineCompletion) {
+                            // the callback stage runs on the same worker, the task stays postponed while
+                            // the callback is executed, so the callback can start the request again
+                            completeAsyncTask(asyncTaskCopy);
+                        } else {
+                            _callbackManager.startTask(asyncTaskCopy);
                         }
                     }
                         break;
                     case 1: {
-                        setIsRequestBusy(false);
-                        asyncTaskCopy->stageDone();
-                        _callbackManager.runCallback();
+                        completeAsyncTask(asyncTaskCopy);
                     }
                         break;
                     default:
@@ -194,7 +238,40 @@ public:
             } catch (...) {
                 processAsyncTaskFailure(asyncTaskCopy);
             }
-        }, 2);
+        }, _preprocessExecutor ? 3 : 2);
+    }
+
+    /**
+     * @brief The last stage of the request: the post-processing of the pipelined request and the callback
+     */
+    void completeAsyncTask(const StagedTask::Ptr &asyncTask) {
+        if (_preprocessExecutor && _callbackManager.get_requestStatus() == OK) {
+            _syncRequest->Postprocess();
+        }
+        // marked before the request is released, so the callback and the thread waiting for it read the timestamp
+        if (_callbackManager.isCallbackEnabled()) {
+            _syncRequest->getTimings().mark(&InferRequestTimings::callback_uSec);
+        }
+        setIsRequestBusy(false);
+        asyncTask->stageDone();
+        _callbackManager.runCallback();
+    }
+
+    /**
+     * @brief Switches the request to the inline completion for the small and frequent requests, where the handoffs
+     * between the threads take the large share of the latency: the callback is invoked by the worker of the task
+     * executor right after the inference instead of the callback executor, and Wait() polls the status of the task
+     * for a short time before the thread is parked.
+     *  @note The callback blocks the worker of the task executor, so it must be short.
+     * @param enable - true to complete the request inline, false (default) to run the callback by the callback executor
+     */
+    void EnableInlineCompletion(bool enable) {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        _inlineCompletion = enable;
+    }
+
+    bool isInlineCompletionEnabled() const {
+        return _inlineCompletion;
     }
 
     StatusCode Wait(int64_t millis_timeout) override {
@@ -217,6 +294,8 @@ public:
     }
 
     void Infer_ThreadUnsafe() override {
+        _syncRequest->getCancellation().start();
+        _syncRequest->getTimings().start();
         _currentTask = _syncTask;
         auto status = _currentTask->runWithSynchronizer(_requestSynchronizer);
         if (status == Task::Status::TS_BUSY)
@@ -228,6 +307,10 @@ public:
         _syncRequest->GetPerformanceCounts(perfMap);
     }
 
+    void GetTimings_ThreadUnsafe(InferRequestTimings &timings) const override {
+        _syncRequest->GetTimings(timings);
+    }
+
     void SetBlob_ThreadUnsafe(const char *name, const Blob::Ptr &data) override {
         _syncRequest->SetBlob(name, data);
     }
@@ -236,6 +319,37 @@ public:
         _syncRequest->GetBlob(name, data);
     }
 
+    void SetBlobByIndex_ThreadUnsafe(size_t index, const Blob::Ptr &data) override {
+        _syncRequest->SetBlobByIndex(index, data);
+    }
+
+    void GetBlobByIndex_ThreadUnsafe(size_t index, Blob::Ptr &data) override {
+        _syncRequest->GetBlobByIndex(index, data);
+    }
+
+    void SetRoiBlobs_ThreadUnsafe(const char *name, const std::vector<Blob::Ptr> &rois) override {
+        _syncRequest->SetRoiBlobs(name, rois);
+    }
+
+    void SetSkippedOutputs_ThreadUnsafe(const std::vector<std::string> &names) override {
+        _syncRequest->SetSkippedOutputs(names);
+    }
+
+    bool IsZeroCopyBlob_ThreadUnsafe(const char *name, const Blob::Ptr &data) override {
+        return _syncRequest->IsZeroCopyBlob(name, data);
+    }
+
+    /**
+     * @brief Not guarded by the busy state of the request as the running inference is the one to be cancelled
+     */
+    void Cancel() override {
+        _syncRequest->Cancel();
+    }
+
+    void SetDeadline_ThreadUnsafe(int64_t millis_timeout) override {
+        _syncRequest->SetDeadline(millis_timeout);
+    }
+
     void SetCompletionCallback_ThreadUnsafe(InferenceEngine::IInferRequest::CompletionCallback callback) override {
         _callbackManager.set_callback(callback);
     }
@@ -260,6 +374,7 @@ public:
 protected:
     ITaskExecutor::Ptr _requestExecutor;
     TaskSynchronizer::Ptr _requestSynchronizer;
+    ITaskExecutor::Ptr _preprocessExecutor;
     InferRequestInternal::Ptr _syncRequest;
     Task::Ptr _syncTask;
     StagedTask::Ptr _asyncTask;
@@ -267,6 +382,7 @@ protected:
     std::list<StagedTask::Ptr> _listAsyncTasks;
     void *_userData;
     CallbackManager _callbackManager;
+    bool _inlineCompletion = false;
 };
 
 }  // namespace InferenceEngine
@@ -82,6 +82,11 @@ public:
         GetPerformanceCounts_ThreadUnsafe(perfMap);
     }
 
+    void GetTimings(InferRequestTimings &timings) const override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        GetTimings_ThreadUnsafe(timings);
+    }
+
     void SetBlob(const char *name, const Blob::Ptr &data) override {
         if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
         SetBlob_ThreadUnsafe(name, data);
@@ -92,6 +97,36 @@ public:
         GetBlob_ThreadUnsafe(name, data);
     }
 
+    void SetBlobByIndex(size_t index, const Blob::Ptr &data) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetBlobByIndex_ThreadUnsafe(index, data);
+    }
+
+    void GetBlobByIndex(size_t index, Blob::Ptr &data) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        GetBlobByIndex_ThreadUnsafe(index, data);
+    }
+
+    void SetRoiBlobs(const char *name, const std::vector<Blob::Ptr> &rois) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetRoiBlobs_ThreadUnsafe(name, rois);
+    }
+
+    void SetSkippedOutputs(const std::vector<std::string> &names) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetSkippedOutputs_ThreadUnsafe(names);
+    }
+
+    bool IsZeroCopyBlob(const char *name, const Blob::Ptr &data) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        return IsZeroCopyBlob_ThreadUnsafe(name, data);
+    }
+
+    void SetDeadline(int64_t millis_timeout) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetDeadline_ThreadUnsafe(millis_timeout);
+    }
+
     void SetBatch(int batch) override {
         if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
         SetBatch_ThreadUnsafe(batch);
@@ -114,10 +149,24 @@ public:
     virtual void
     GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const = 0;
 
+    virtual void GetTimings_ThreadUnsafe(InferRequestTimings &timings) const = 0;
+
     virtual void SetBlob_ThreadUnsafe(const char *name, const Blob::Ptr &data) = 0;
 
     virtual void GetBlob_ThreadUnsafe(const char *name, Blob::Ptr &data) = 0;
 
+    virtual void SetBlobByIndex_ThreadUnsafe(size_t index, const Blob::Ptr &data) = 0;
+
+    virtual void GetBlobByIndex_ThreadUnsafe(size_t index, Blob::Ptr &data) = 0;
+
+    virtual void SetRoiBlobs_ThreadUnsafe(const char *name, const std::vector<Blob::Ptr> &rois) = 0;
+
+    virtual void SetSkippedOutputs_ThreadUnsafe(const std::vector<std::string> &names) = 0;
+
+    virtual bool IsZeroCopyBlob_ThreadUnsafe(const char *name, const Blob::Ptr &data) = 0;
+
+    virtual void SetDeadline_ThreadUnsafe(int64_t millis_timeout) = 0;
+
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
 };
 
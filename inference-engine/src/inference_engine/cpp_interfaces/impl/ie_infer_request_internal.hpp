@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <iterator>
 #include <map>
 #include <memory>
 #include <string>
@@ -15,6 +16,8 @@
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "debug.h"
 #include "cpp_interfaces/exception2status.hpp"
+#include "cpp_interfaces/ie_infer_cancellation.hpp"
+#include "cpp_interfaces/ie_infer_timings.hpp"
 #include "ie_preprocess_data.hpp"
 
 namespace InferenceEngine {
@@ -73,10 +76,36 @@ public:
      * @brief Default common implementation for all plugins with checking input and output blobs before inference
      */
     void Infer() override {
+        // the inputs pre-processed ahead are consumed by this inference only
+        struct PreprocessedReset {
+            bool &isPreprocessed;
+            ~PreprocessedReset() { isPreprocessed = false; }
+        } preprocessedReset{_isPreprocessed};
+        // the pipelined inference has been started by Preprocess()
+        if (!_isPreprocessed) _timings.mark(&InferRequestTimings::started_uSec);
         checkBlobs();
+        // the inference cancelled or late while it was waiting in the queue is not run at all
+        _cancellation.check();
         InferImpl();
     };
 
+    /**
+     * @brief The stage of the pipelined request executed before Infer() by the other thread. It pre-processes
+     * the inputs (e.g. resizes the ROI blobs), so the call of execDataPreprocessing() by the next inference is skipped,
+     * and the pre-processing of a request overlaps with the inference of the previous one on the device.
+     */
+    virtual void Preprocess() {
+        _timings.mark(&InferRequestTimings::started_uSec);
+        execDataPreprocessing();
+        _isPreprocessed = true;
+    }
+
+    /**
+     * @brief The stage of the pipelined request executed after the successful Infer() by the other thread,
+     * e.g. to pull the outputs from the device while the next request is inferred. The default does nothing.
+     */
+    virtual void Postprocess() {}
+
     /**
      * @brief Given optional implementation of setting blob to avoid need for it to be implemented by plugin
      * @param name - a name of input or output blob.
@@ -94,6 +123,10 @@ public:
         DataPtr foundOutput;
         size_t dataSize = data->size();
         if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
+            if (foundInput->getPreProcess().getColorFormat() != ColorFormat::RAW) {
+                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Color conversion of the input \'" << name
+                                   << "\' is not supported by the plugin";
+            }
             // Only precision is checked for an input with ROI inside (resize algorithm was set for the input).
             if (foundInput->getPreProcess().getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE) {
                 if (foundInput->getInputPrecision() != data->precision()) {
@@ -152,6 +185,85 @@ public:
         }
     }
 
+    /**
+     * @brief Given optional implementation of setting blob by index, it finds the name of the blob and sets it by name
+     * @param index - the index of input or output blob, the inputs go first in the order of the names,
+     * the outputs follow them in the order of the names.
+     * @param data - a reference to input or output blob.
+     */
+    void SetBlobByIndex(size_t index, const Blob::Ptr &data) override {
+        SetBlob(getBlobName(index).c_str(), data);
+    }
+
+    /**
+     * @brief Given optional implementation of getting blob by index, it finds the name of the blob and gets it by name
+     * @param index - the index of input or output blob, see SetBlobByIndex().
+     * @param data - a reference to input or output blob.
+     */
+    void GetBlobByIndex(size_t index, Blob::Ptr &data) override {
+        GetBlob(getBlobName(index).c_str(), data);
+    }
+
+    /**
+     * @brief The batched ROIs are pre-processed only by the plugins which implement it
+     * @param name - a name of the input.
+     * @param rois - the ROI blobs with the batch 1.
+     */
+    void SetRoiBlobs(const char *name, const std::vector<Blob::Ptr> &rois) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Batched ROIs are not supported by the plugin";
+    }
+
+    /**
+     * @brief The outputs are skipped only by the plugins which implement it
+     * @param names - the names of the skipped outputs.
+     */
+    void SetSkippedOutputs(const std::vector<std::string> &names) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Skipped outputs are not supported by the plugin";
+    }
+
+    /**
+     * @brief The blobs are bound without copying only by the plugins which implement it
+     * @param name - a name of input or output blob.
+     * @param data - a blob to check.
+     */
+    bool IsZeroCopyBlob(const char *name, const Blob::Ptr &data) override {
+        return false;
+    }
+
+    /**
+     * @brief The inference is stopped before it is run and at the points InferImpl() checks getCancellation()
+     */
+    void Cancel() override {
+        _cancellation.cancel();
+    }
+
+    void SetDeadline(int64_t millis_timeout) override {
+        _cancellation.setTimeout(millis_timeout);
+    }
+
+    /**
+     * @brief The cancellation of the inference, it is started by the wrapper starting the request
+     * and checked by the plugin between the stages of InferImpl()
+     */
+    InferCancellation &getCancellation() {
+        return _cancellation;
+    }
+
+    /**
+     * @brief The start of the inference and the end of the pre-processing are marked by the request itself, the ends
+     * of the execution and of the copy of the outputs are marked by InferImpl() of the plugin
+     */
+    void GetTimings(InferRequestTimings &timings) const override {
+        timings = _timings.get();
+    }
+
+    /**
+     * @brief The timestamps of the stages of the inference, they are started by the wrapper starting the request
+     */
+    InferTimings &getTimings() {
+        return _timings;
+    }
+
     void setPointerToExecutableNetworkInternal(ExecutableNetworkInternalPtr exeNetwork) {
         _exeNetwork = exeNetwork;
     }
@@ -173,6 +285,7 @@ public:
      * @brief Checks and executes input data pre-processing if needed.
      */
     void execDataPreprocessing() {
+        if (_isPreprocessed) return;
         for (auto &input : _inputs) {
             // If there is a pre-process entry for an input then it must be pre-processed
             // using preconfigured resize algorithm.
@@ -182,6 +295,7 @@ public:
                                                   _networkInputs[input.first]->getPreProcess().getResizeAlgorithm());
             }
         }
+        _timings.mark(&InferRequestTimings::preprocessed_uSec);
     }
 
 protected:
@@ -191,6 +305,9 @@ protected:
     InferenceEngine::BlobMap _outputs;
     ExecutableNetworkInternalPtr _exeNetwork;
     std::map<std::string, PreProcessData> _preProcData;  // pre-process data per input
+    bool _isPreprocessed = false;  // the inputs were pre-processed by Preprocess() for the next inference
+    InferCancellation _cancellation;
+    InferTimings _timings;
 
 protected:
     /**
@@ -229,6 +346,20 @@ protected:
         }
     }
 
+    /**
+     * @brief helper to find the name of input or output blob by its index
+     * @param index - the index of input or output blob, the inputs go first in the order of the names,
+     * the outputs follow them in the order of the names.
+     * @throws [not_found] exception if the index is greater than the number of inputs and outputs
+     */
+    const std::string &getBlobName(size_t index) const {
+        if (index < _networkInputs.size())
+            return std::next(_networkInputs.begin(), index)->first;
+        if (index - _networkInputs.size() < _networkOutputs.size())
+            return std::next(_networkOutputs.begin(), index - _networkInputs.size())->first;
+        THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input or output with index: " << index;
+    }
+
     void checkBlob(const Blob::Ptr &blob, const std::string &name, bool isInput, const SizeVector& refDims = {}) const {
         std::string bType = isInput ? "Input" : "Output";
         std::string sType = isInput ? "input" : "output";
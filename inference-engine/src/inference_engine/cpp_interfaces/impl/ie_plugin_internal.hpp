@@ -12,11 +12,16 @@
 
 #include <memory>
 #include <map>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <blob_factory.hpp>
+#include <ie_profiling.hpp>
+#include <ie_util_internal.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "cpp_interfaces/base/ie_executable_network_base.hpp"
 #include "cpp_interfaces/impl/ie_executable_network_internal.hpp"
+#include "cpp_interfaces/impl/ie_executable_network_batching.hpp"
 
 namespace InferenceEngine {
 
@@ -30,7 +35,6 @@ public:
      * Given optional implementation of deprecated load to avoid need for it to be implemented by plugin
      */
     void LoadNetwork(ICNNNetwork &network) override {
-        _isDeprecatedLoad = true;
         network.getInputsInfo(_networkInputs);
         network.getOutputsInfo(_networkOutputs);
         if (_networkInputs.empty() || _networkOutputs.empty()) {
@@ -42,6 +46,12 @@ public:
         _firstInput = _networkInputs.begin()->first;
         _firstOutput = _networkOutputs.begin()->first;
         LoadNetwork(_loadedNetwork, network, {});
+        // the plugin keeps the network, so the network must not keep the plugin to avoid the circular dependency:
+        // ExecutableNetworkBase -> IExecutableNetworkInternal -> InferencePluginInternal
+        auto loadedNetworkBase = dynamic_cast<ExecutableNetworkBase<ExecutableNetworkInternal> *>(_loadedNetwork.get());
+        if (loadedNetworkBase) {
+            loadedNetworkBase->getImpl()->SetPointerToPluginInternal(nullptr);
+        }
 
         ResponseDesc resp;
         StatusCode sts = _loadedNetwork->CreateInferRequest(_createdInferRequest, &resp);
@@ -60,16 +70,94 @@ public:
 
     /**
      * Given optional implementation of load executable network to avoid need for it to be implemented by plugin
+     * The method does not change the state of the plugin, so several networks may be loaded concurrently
+     * if LoadExeNetworkImpl of the plugin only reads the state too
      */
     void LoadNetwork(IExecutableNetwork::Ptr &executableNetwork,
                      ICNNNetwork &network,
                      const std::map<std::string, std::string> &config) override {
-        InputsDataMap networkInputs;
-        OutputsDataMap networkOutputs;
+        // the scope of the flush ends after the scope of the load, so the trace holds the whole load when it returns
+        TraceFlushScope flushTrace;
+        IE_PROFILING_AUTO_SCOPE(LoadNetwork)
+        // the key of the sharing is handled here for all the plugins
+        auto loadConfig = config;
+        bool share = false;
+        auto shareIt = loadConfig.find(PluginConfigParams::KEY_SHARE_EXECUTABLE_NETWORK);
+        if (shareIt != loadConfig.end()) {
+            if (shareIt->second == PluginConfigParams::YES) {
+                share = true;
+            } else if (shareIt->second != PluginConfigParams::NO) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported value " << shareIt->second << " of the key "
+                                   << PluginConfigParams::KEY_SHARE_EXECUTABLE_NETWORK;
+            }
+            loadConfig.erase(shareIt);
+        }
+
+        auto impl = share ? LoadSharedNetwork(network, loadConfig) : LoadExecutableNetwork(network, loadConfig);
+        executableNetwork.reset(new ExecutableNetworkBase<ExecutableNetworkInternal>(impl), [](details::IRelease *p) {
+            p->Release();
+        });
+    };
+
+    /**
+     * @brief Returns the network loaded before with the same content and the same config (the one of the plugin
+     * merged with the one of the load) if it is still alive, otherwise loads the network. The concurrent loads of
+     * the same network wait for the first of them, the loads of the different networks don't wait for each other.
+     */
+    ExecutableNetworkInternal::Ptr LoadSharedNetwork(ICNNNetwork &network,
+                                                     const std::map<std::string, std::string> &config) {
+        auto mergedConfig = _config;
+        for (const auto &item : config) {
+            mergedConfig[item.first] = item.second;
+        }
+        std::stringstream key;
+        key << std::hex << hashNetwork(network);
+        for (const auto &item : mergedConfig) {
+            // the sizes separate the keys and the values
+            key << ";" << item.first.size() << ":" << item.first << item.second.size() << ":" << item.second;
+        }
+
+        std::shared_ptr<SharedNetwork> shared;
+        {
+            std::lock_guard<std::mutex> lock(_sharedNetworksMutex);
+            // the entries of the released networks are dropped unless a load holds them
+            for (auto it = _sharedNetworks.begin(); it != _sharedNetworks.end();) {
+                if (it->second.use_count() == 1 && it->second->network.expired())
+                    it = _sharedNetworks.erase(it);
+                else
+                    ++it;
+            }
+            auto &entry = _sharedNetworks[key.str()];
+            if (!entry) entry = std::make_shared<SharedNetwork>();
+            shared = entry;
+        }
+
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        auto impl = shared->network.lock();
+        if (!impl) {
+            impl = LoadExecutableNetwork(network, config);
+            shared->network = impl;
+            shared->content = recordNetwork(network);
+        } else if (!(shared->content == recordNetwork(network))) {
+            // the hashes of the different networks are the same, the network is not shared
+            impl = LoadExecutableNetwork(network, config);
+        }
+        return impl;
+    }
+
+    /**
+     * @brief Loads the network by the plugin with the copies of the inputs and the outputs of the network
+     */
+    ExecutableNetworkInternal::Ptr LoadExecutableNetwork(ICNNNetwork &network,
+                                                         const std::map<std::string, std::string> &config) {
+        // the weights may be read from the file on the first access, the failed read is reported here,
+        // not as the null data in the plugin
+        checkNetworkBlobs(network);
+
+        InputsDataMap networkInputs, clonedInputs;
+        OutputsDataMap networkOutputs, clonedOutputs;
         network.getInputsInfo(networkInputs);
         network.getOutputsInfo(networkOutputs);
-        _networkInputs.clear();
-        _networkOutputs.clear();
 
         for (const auto& it : networkInputs) {
             InputInfo::Ptr newPtr;
@@ -89,7 +177,7 @@ public:
                 newData->inputTo.clear();
                 newPtr->setInputData(newData);
             }
-            _networkInputs[it.first] = newPtr;
+            clonedInputs[it.first] = newPtr;
         }
 
         for (const auto& it : networkOutputs) {
@@ -98,21 +186,38 @@ public:
                 newData.reset(new Data(*it.second));
                 newData->inputTo.clear();
             }
-            _networkOutputs[it.first] = newData;
+            clonedOutputs[it.first] = newData;
         }
-        auto impl = LoadExeNetworkImpl(network, config);
-        impl->setNetworkInputs(_networkInputs);
-        impl->setNetworkOutputs(_networkOutputs);
-        // skip setting shared ptr to avoid curricular dependency: ExecutableNetworkBase -> IExecutableNetworkInternal -> InferencePluginInternal
-        if (!_isDeprecatedLoad) {
-            impl->SetPointerToPluginInternal(shared_from_this());
+        // the keys of the batching of the requests are handled here for all the plugins
+        const BatchingConfig batching(config);
+        auto impl = batching.batchSize > 1 ? LoadBatchingNetwork(network, batching)
+                                           : LoadExeNetworkImpl(network, batching.networkConfig);
+        impl->setNetworkInputs(clonedInputs);
+        impl->setNetworkOutputs(clonedOutputs);
+        impl->SetPointerToPluginInternal(shared_from_this());
+        return impl;
+    }
+
+    /**
+     * @brief Loads the copy of the network of the batch 1 with the batch of KEY_AUTO_BATCH and the dynamic batch,
+     * the returned network of the batch 1 infers its requests by the batches of it
+     */
+    ExecutableNetworkInternal::Ptr LoadBatchingNetwork(ICNNNetwork &network, const BatchingConfig &batching) {
+        if (network.getBatchSize() != 1) {
+            THROW_IE_EXCEPTION << "The requests are batched by " << PluginConfigParams::KEY_AUTO_BATCH
+                               << " for the network of the batch 1 only";
         }
+        auto batchedNetwork = cloneNet(network);
+        ResponseDesc resp;
+        if (batchedNetwork->setBatchSize(batching.batchSize, &resp) != OK) THROW_IE_EXCEPTION << resp.msg;
 
-        executableNetwork.reset(new ExecutableNetworkBase<ExecutableNetworkInternal>(impl), [](details::IRelease *p) {
-            p->Release();
-        });
-        _isDeprecatedLoad = false;
-    };
+        auto batchedConfig = batching.networkConfig;
+        batchedConfig[PluginConfigParams::KEY_DYN_BATCH_ENABLED] = PluginConfigParams::YES;
+        IExecutableNetwork::Ptr batchedExecutableNetwork;
+        LoadNetwork(batchedExecutableNetwork, *batchedNetwork, batchedConfig);
+        return std::make_shared<BatchingExecutableNetwork>(ExecutableNetwork(batchedExecutableNetwork),
+                                                           batching.batchSize, batching.timeout);
+    }
 
     /**
      * Given optional implementation of deprecated infer to avoid need for it to be implemented by plugin
@@ -203,7 +308,18 @@ protected:
     InferenceEngine::InputsDataMap _networkInputs;
     InferenceEngine::OutputsDataMap _networkOutputs;
     std::map<std::string, std::string> _config;
-    bool _isDeprecatedLoad = false;
+
+private:
+    struct SharedNetwork {
+        // held by the load of the network
+        std::mutex mutex;
+        std::weak_ptr<ExecutableNetworkInternal> network;
+        // the loaded network holding its blobs, the networks of the same hash are compared with it
+        NetworkContent content;
+    };
+    // the networks loaded with KEY_SHARE_EXECUTABLE_NETWORK by the hash of the network and the config
+    std::mutex _sharedNetworksMutex;
+    std::map<std::string, std::shared_ptr<SharedNetwork>> _sharedNetworks;
 };
 
 }  // namespace InferenceEngine
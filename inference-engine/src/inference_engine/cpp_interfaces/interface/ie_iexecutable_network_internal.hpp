@@ -63,6 +63,18 @@ public:
 
 
     virtual std::vector<IMemoryStateInternal::Ptr> QueryState() = 0;
+
+    /**
+     * @brief Changes the shapes of the network inputs without loading the network again
+     * @param inputShapes - map of the input names and their new shapes
+     */
+    virtual void Reshape(const std::map<std::string, SizeVector> &inputShapes) = 0;
+
+    /**
+     * @brief Gets the utilization of the executors running the requests of the network
+     * @param metrics - map of the executor names and their metrics
+     */
+    virtual void GetExecutorMetrics(std::map<std::string, ExecutorMetrics> &metrics) const = 0;
 };
 
 }  // namespace InferenceEngine
@@ -8,6 +8,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include <ie_common.h>
 #include <ie_blob.h>
 
@@ -35,6 +36,12 @@ public:
      */
     virtual void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const = 0;
 
+    /**
+     * @brief Gets the timestamps of the stages of the last inference.
+     *  @param timings - the timestamps, the stages not reported by the plugin are 0.
+     */
+    virtual void GetTimings(InferRequestTimings &timings) const = 0;
+
     /**
      * @brief Set input/output data to infer
      * @note: Memory allocation doesn't happen
@@ -51,6 +58,52 @@ public:
      */
     virtual void GetBlob(const char *name, Blob::Ptr &data) = 0;
 
+    /**
+     * @brief Set input/output data to infer by the index of the blob
+     * @param index - the index of input or output blob, the inputs go first in the order of the names,
+     * the outputs follow them in the order of the names.
+     * @param data - a reference to input or output blob. The type of Blob must correspond to the network input precision and size.
+     */
+    virtual void SetBlobByIndex(size_t index, const Blob::Ptr &data) = 0;
+
+    /**
+     * @brief Get input/output data to infer by the index of the blob
+     * @param index - the index of input or output blob, see SetBlobByIndex().
+     * @param data - a reference to input or output blob. The type of Blob must correspond to the network input precision and size.
+     */
+    virtual void GetBlobByIndex(size_t index, Blob::Ptr &data) = 0;
+
+    /**
+     * @brief Set the ROI blobs to be pre-processed into the batch slots of the input
+     * @param name - a name of the input.
+     * @param rois - the ROI blobs with the batch 1, the ROI i goes to the batch slot i.
+     */
+    virtual void SetRoiBlobs(const char *name, const std::vector<Blob::Ptr> &rois) = 0;
+
+    /**
+     * @brief Set the outputs which are not computed by the following inferences
+     * @param names - the names of the outputs, an empty list computes all the outputs.
+     */
+    virtual void SetSkippedOutputs(const std::vector<std::string> &names) = 0;
+
+    /**
+     * @brief Checks whether the blob would be used by the plugin without copying if it is set
+     * @param name - a name of input or output blob.
+     * @param data - a blob to check.
+     */
+    virtual bool IsZeroCopyBlob(const char *name, const Blob::Ptr &data) = 0;
+
+    /**
+     * @brief Cancel the ongoing inference, it may be called by any thread while the request is running
+     */
+    virtual void Cancel() = 0;
+
+    /**
+     * @brief Set the time the following inferences are given after they are started
+     * @param millis_timeout - the time in milliseconds, 0 disables the deadline.
+     */
+    virtual void SetDeadline(int64_t millis_timeout) = 0;
+
     /**
     * @brief Sets new batch size when dynamic batching is enabled in executable network that created this request.
     * @param batch - new batch size to be used by all the following inference calls for this request.
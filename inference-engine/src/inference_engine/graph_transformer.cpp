@@ -4,7 +4,12 @@
 //
 
 #include <assert.h>
+#include <string>
+#include <unordered_set>
+#include <vector>
 #include "graph_transformer.h"
+#include "graph_tools.hpp"
+#include "caseless.hpp"
 
 namespace InferenceEngine {
 
@@ -26,4 +31,112 @@ void replaceLayerWithNewLayer(ICNNNetwork &network, const CNNLayerPtr &layer, co
     network.addLayer(newLayer);
 }
 
+namespace {
+
+bool matchNode(const GraphRewriter::PatternNode &node, const CNNLayerPtr &layer) {
+    if (!node.type.empty() && !CaselessEq<std::string>()(node.type, layer->type))
+        return false;
+    return !node.predicate || node.predicate(layer);
+}
+
+// the chain of the pattern starting at the layer or the empty one
+std::vector<CNNLayerPtr> matchChain(const std::vector<GraphRewriter::PatternNode> &pattern, CNNLayerPtr layer,
+                                    const OutputsDataMap &outputs) {
+    std::vector<CNNLayerPtr> chain;
+    for (size_t i = 0; i < pattern.size(); i++) {
+        if (i > 0) {
+            const auto &out = chain.back()->outData;
+            if (out.size() != 1 || out[0]->getInputTo().size() != 1 || outputs.count(out[0]->getName()))
+                return {};
+            layer = out[0]->getInputTo().begin()->second;
+            if (layer->insData.size() != 1)
+                return {};
+        }
+        if (!matchNode(pattern[i], layer))
+            return {};
+        chain.push_back(layer);
+    }
+    return chain;
+}
+
+void replaceChain(details::CNNNetworkImpl &network, const std::vector<CNNLayerPtr> &chain,
+                  const CNNLayerPtr &newLayer) {
+    const CNNLayerPtr &first = chain.front(), &last = chain.back();
+
+    for (auto &src : first->insData) {
+        auto &inputTo = src.lock()->getInputTo();
+        inputTo.erase(first->name);
+        inputTo[newLayer->name] = newLayer;
+    }
+    newLayer->insData = first->insData;
+
+    for (auto &dst : last->outData) {
+        dst->creatorLayer = newLayer;
+    }
+    newLayer->outData = last->outData;
+
+    for (size_t i = 0; i < chain.size(); i++) {
+        if (i + 1 < chain.size())
+            network.removeData(chain[i]->outData[0]->getName());
+        network.removeLayer(chain[i]->name);
+    }
+    network.addLayer(newLayer);
+}
+
+}  // namespace
+
+GraphRewriter &GraphRewriter::addRule(const std::string &name, const std::vector<PatternNode> &pattern,
+                                      const Replacement &replacement) {
+    if (pattern.empty() || !replacement)
+        THROW_IE_EXCEPTION << "The rewrite rule " << name << " has no pattern or no replacement";
+    _rules.push_back({name, pattern, replacement});
+    return *this;
+}
+
+size_t GraphRewriter::run(details::CNNNetworkImpl &network) const {
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+
+    size_t rewrites = 0;
+    std::unordered_set<CNNLayer *> removed;
+    // the removed layers are kept alive till the end, so their addresses are not reused by the new layers
+    std::vector<CNNLayerPtr> replaced;
+    for (auto layer : CNNNetSortTopologically(network)) {
+        if (removed.count(layer.get()))
+            continue;
+        bool rewritten = true;
+        while (layer && rewritten) {
+            rewritten = false;
+            for (const auto &rule : _rules) {
+                auto chain = matchChain(rule.pattern, layer, outputs);
+                if (chain.empty())
+                    continue;
+                CNNLayerPtr newLayer = rule.replacement(chain);
+                if (!newLayer)
+                    continue;
+
+                CNNLayerPtr existing;
+                bool matched = false;
+                for (auto &l : chain)
+                    matched = matched || l->name == newLayer->name;
+                if (!matched && network.getLayerByName(newLayer->name.c_str(), existing, nullptr) == OK) {
+                    THROW_IE_EXCEPTION << "The rewrite rule " << rule.name << " creates the layer " << newLayer->name
+                                       << " which is already in the network";
+                }
+
+                replaceChain(network, chain, newLayer);
+                for (auto &l : chain)
+                    removed.insert(l.get());
+                replaced.insert(replaced.end(), chain.begin(), chain.end());
+                rewrites++;
+                // the chain of a single layer is not matched again, a rule replacing it by the same type never ends
+                rewritten = chain.size() > 1;
+                layer = newLayer;
+                break;
+            }
+        }
+    }
+    return rewrites;
+}
+
 }  // namespace InferenceEngine
@@ -10,7 +10,11 @@
 
 #pragma once
 
+#include <functional>
+#include <string>
+#include <vector>
 #include <ie_icnn_network.hpp>
+#include "cnn_network_impl.hpp"
 
 namespace InferenceEngine {
 
@@ -22,4 +26,57 @@ namespace InferenceEngine {
  */
 void replaceLayerWithNewLayer(ICNNNetwork &network, const CNNLayerPtr &layer, const CNNLayerPtr &newLayer);
 
+/**
+ * @brief The declarative rewrites of the network: every rule is a chain of the layers and the function creating
+ * the single layer which replaces the chain. The fusions written as the rules are run on the network once before
+ * the lowering of a plugin, so the plugins share them instead of matching the layers by hand.
+ * @details The chain is matched along the single consumer of the single output of a layer, the outputs inside
+ * the chain must not be the outputs of the network and the layers after the first one have no other inputs.
+ * The replacement takes the inputs of the first layer and the outputs of the last one, the other layers and data
+ * are removed from the network.
+ */
+class INFERENCE_ENGINE_API_CLASS(GraphRewriter) {
+public:
+    /**
+     * @brief The layer of the pattern: its type compared caseless, the empty type matches any layer,
+     * and the optional predicate on the layer
+     */
+    struct PatternNode {
+        std::string type;
+        std::function<bool(const CNNLayerPtr &)> predicate;
+    };
+
+    /**
+     * @brief Creates the layer replacing the matched chain, the layers are given in the order of the pattern.
+     * nullptr rejects the match, so the conditions spanning several layers are checked here.
+     * The name of the layer is either one of the matched names or a new one.
+     */
+    using Replacement = std::function<CNNLayerPtr(const std::vector<CNNLayerPtr> &)>;
+
+    /**
+     * @brief Adds the rule, the rules are tried in the order of the addition at every layer
+     * @param name - the name of the rule for the messages
+     * @param pattern - the nonempty chain of the layers
+     * @param replacement - the factory of the new layer
+     */
+    GraphRewriter &addRule(const std::string &name, const std::vector<PatternNode> &pattern,
+                           const Replacement &replacement);
+
+    /**
+     * @brief Rewrites the network in a topological order. The layer created by a rule of several layers is matched
+     * again, so the chains fuse step by step, e.g. Convolution+ReLU after Convolution+ScaleShift.
+     * @return The number of the rewrites
+     */
+    size_t run(details::CNNNetworkImpl &network) const;
+
+private:
+    struct Rule {
+        std::string name;
+        std::vector<PatternNode> pattern;
+        Replacement replacement;
+    };
+
+    std::vector<Rule> _rules;
+};
+
 }  // namespace InferenceEngine
@@ -0,0 +1,455 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_binary_ir.hpp"
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_layers.h>
+#include <file_utils.h>
+#include "graph_tools.hpp"
+#include "ie_blob_proxy.hpp"
+#include "mmap_allocator.hpp"
+#include "v2_format_parser.h"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+const char signature[8] = {'I', 'E', 'B', 'I', 'N', 'I', 'R', '\0'};
+const uint32_t formatVersion = 2;
+// the weights are aligned as the memory of the plugins
+const size_t weightsAlignment = 64;
+
+struct Header {
+    char signature[8];
+    uint32_t version;
+    uint32_t reserved;
+    // the offset and the size of the weights from the beginning of the file, the description follows the header
+    uint64_t weightsOffset;
+    uint64_t weightsSize;
+};
+
+class Writer {
+public:
+    void u8(uint8_t value) {
+        raw(&value, sizeof(value));
+    }
+
+    void u32(uint32_t value) {
+        raw(&value, sizeof(value));
+    }
+
+    void u64(uint64_t value) {
+        raw(&value, sizeof(value));
+    }
+
+    void f32(float value) {
+        raw(&value, sizeof(value));
+    }
+
+    void str(const std::string &value) {
+        u64(value.size());
+        raw(value.data(), value.size());
+    }
+
+    void dims(const SizeVector &value) {
+        u64(value.size());
+        for (auto dim : value)
+            u64(dim);
+    }
+
+    void raw(const void *data, size_t size) {
+        auto bytes = reinterpret_cast<const char *>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    std::vector<char> buffer;
+};
+
+class Reader {
+public:
+    Reader(const uint8_t *data, size_t size) : data(data), size(size) {}
+
+    uint8_t u8() {
+        uint8_t value;
+        raw(&value, sizeof(value));
+        return value;
+    }
+
+    uint32_t u32() {
+        uint32_t value;
+        raw(&value, sizeof(value));
+        return value;
+    }
+
+    uint64_t u64() {
+        uint64_t value;
+        raw(&value, sizeof(value));
+        return value;
+    }
+
+    float f32() {
+        float value;
+        raw(&value, sizeof(value));
+        return value;
+    }
+
+    std::string str() {
+        size_t length = static_cast<size_t>(u64());
+        check(length);
+        std::string value(reinterpret_cast<const char *>(data + offset), length);
+        offset += length;
+        return value;
+    }
+
+    SizeVector dims() {
+        size_t count = static_cast<size_t>(u64());
+        check(count * sizeof(uint64_t));
+        SizeVector value(count);
+        for (auto &dim : value)
+            dim = static_cast<size_t>(u64());
+        return value;
+    }
+
+    void raw(void *value, size_t length) {
+        check(length);
+        memcpy(value, data + offset, length);
+        offset += length;
+    }
+
+private:
+    void check(size_t length) const {
+        if (length > size - offset)
+            THROW_IE_EXCEPTION << "The binary IR is truncated at offset " << offset;
+    }
+
+    const uint8_t *data;
+    size_t size;
+    size_t offset = 0;
+};
+
+class WeightsWriter {
+public:
+    void blob(Writer &writer, const Blob::Ptr &blob) {
+        auto &desc = blob->getTensorDesc();
+        writer.u32(desc.getPrecision());
+        writer.u32(desc.getLayout());
+        writer.dims(desc.getDims());
+
+        auto it = offsets.find(blob.get());
+        if (it == offsets.end()) {
+            weights.resize((weights.size() + weightsAlignment - 1) / weightsAlignment * weightsAlignment);
+            it = offsets.insert({blob.get(), weights.size()}).first;
+            auto data = blob->cbuffer().as<const char *>();
+            if (data == nullptr && blob->byteSize())
+                THROW_IE_EXCEPTION << "Cannot write the blob without the memory to the binary IR";
+            weights.insert(weights.end(), data, data + blob->byteSize());
+        }
+        writer.u64(it->second);
+        writer.u64(blob->byteSize());
+    }
+
+    std::vector<char> weights;
+
+private:
+    // the same blob may be a member and in blobs of the layer
+    std::map<const Blob *, size_t> offsets;
+};
+
+template <typename T>
+Blob::Ptr makeProxy(const TBlob<uint8_t>::Ptr &file, Precision precision, Layout layout, size_t offset,
+                    const SizeVector &dims) {
+    return std::make_shared<TBlobProxy<T>>(precision, layout, file, offset, dims);
+}
+
+Blob::Ptr readBlob(Reader &reader, const TBlob<uint8_t>::Ptr &file, const Header &header) {
+    Precision precision = static_cast<Precision::ePrecision>(reader.u32());
+    Layout layout = static_cast<Layout>(reader.u32());
+    SizeVector dims = reader.dims();
+    size_t offset = static_cast<size_t>(reader.u64());
+    size_t size = static_cast<size_t>(reader.u64());
+
+    if (offset > header.weightsSize || size > header.weightsSize - offset)
+        THROW_IE_EXCEPTION << "The blob of the binary IR exceeds the weights";
+    offset += static_cast<size_t>(header.weightsOffset);
+
+    // the types of the blobs are the same as the IR reader creates for the precisions
+    switch (precision) {
+        case Precision::FP32:
+            return makeProxy<float>(file, precision, layout, offset, dims);
+        case Precision::I32:
+            return makeProxy<int32_t>(file, precision, layout, offset, dims);
+        case Precision::FP16:
+        case Precision::Q78:
+        case Precision::I16:
+            return makeProxy<short>(file, precision, layout, offset, dims);
+        case Precision::U16:
+            return makeProxy<uint16_t>(file, precision, layout, offset, dims);
+        case Precision::I8:
+            return makeProxy<int8_t>(file, precision, layout, offset, dims);
+        case Precision::U8:
+            return makeProxy<uint8_t>(file, precision, layout, offset, dims);
+        default:
+            THROW_IE_EXCEPTION << "The precision " << precision << " of the blob is not supported by the binary IR";
+    }
+}
+
+}  // namespace
+
+bool BinaryIR::isBinaryIR(const void *buffer, size_t size) {
+    return buffer != nullptr && size >= sizeof(Header) && memcmp(buffer, signature, sizeof(signature)) == 0;
+}
+
+bool BinaryIR::isBinaryIR(const char *filepath) {
+    std::ifstream file(filepath, std::ios::binary);
+    char buffer[sizeof(Header)] = {};
+    return file.read(buffer, sizeof(buffer)) && isBinaryIR(buffer, sizeof(buffer));
+}
+
+void BinaryIR::write(ICNNNetwork &network, const std::string &filepath) {
+    Writer writer;
+    WeightsWriter weightsWriter;
+
+    writer.str(network.getName());
+    writer.u32(network.getPrecision());
+
+    auto layers = CNNNetSortTopologically(network);
+    std::vector<DataPtr> datas;
+    for (auto &layer : layers) {
+        for (auto &data : layer->outData)
+            datas.push_back(data);
+    }
+    writer.u32(datas.size());
+    for (auto &data : datas) {
+        auto &desc = data->getTensorDesc();
+        writer.str(data->getName());
+        writer.u32(desc.getPrecision());
+        writer.u32(desc.getLayout());
+        writer.dims(desc.getDims());
+    }
+
+    writer.u32(layers.size());
+    for (auto &layer : layers) {
+        writer.str(layer->name);
+        writer.str(layer->type);
+        writer.u32(layer->precision);
+        writer.str(layer->affinity);
+
+        auto params = layer->params;
+        // the crop parameters from the children of the data node are stored only in the layer
+        auto *cropLayer = dynamic_cast<CropLayer *>(layer.get());
+        if (cropLayer && params.find("axis") == params.end() && !cropLayer->axis.empty()) {
+            std::string axis, offset;
+            for (size_t i = 0; i < cropLayer->axis.size(); i++) {
+                axis += (i ? "," : "") + std::to_string(cropLayer->axis[i]);
+                offset += (i ? "," : "") + std::to_string(i < cropLayer->offset.size() ? cropLayer->offset[i] : 0);
+            }
+            params["axis"] = axis;
+            params["offset"] = offset;
+        }
+        writer.u32(params.size());
+        for (auto &param : params) {
+            writer.str(param.first);
+            writer.str(param.second);
+        }
+
+        writer.u32(layer->insData.size());
+        for (auto &input : layer->insData) {
+            auto data = input.lock();
+            if (!data)
+                THROW_IE_EXCEPTION << "The input of the layer " << layer->name << " is not connected";
+            writer.str(data->getName());
+        }
+        writer.u32(layer->outData.size());
+        for (auto &data : layer->outData)
+            writer.str(data->getName());
+
+        writer.u32(layer->blobs.size());
+        for (auto &blob : layer->blobs) {
+            writer.str(blob.first);
+            weightsWriter.blob(writer, blob.second);
+        }
+    }
+
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    writer.u32(inputs.size());
+    for (auto &input : inputs) {
+        writer.str(input.second->getInputData()->getName());
+        auto &preProcess = input.second->getPreProcess();
+        writer.u32(preProcess.getMeanVariant());
+        writer.u32(preProcess.getResizeAlgorithm());
+        writer.u32(preProcess.getColorFormat());
+        writer.u32(preProcess.getNumberOfChannels());
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            auto &channel = preProcess[c];
+            writer.f32(channel->meanValue);
+            writer.f32(channel->stdScale);
+            writer.u8(channel->meanData ? 1 : 0);
+            if (channel->meanData)
+                weightsWriter.blob(writer, channel->meanData);
+        }
+    }
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    writer.u32(outputs.size());
+    for (auto &output : outputs)
+        writer.str(output.first);
+
+    Header header = {};
+    memcpy(header.signature, signature, sizeof(signature));
+    header.version = formatVersion;
+    header.weightsOffset = (sizeof(Header) + writer.buffer.size() + weightsAlignment - 1) /
+            weightsAlignment * weightsAlignment;
+    header.weightsSize = weightsWriter.weights.size();
+
+    std::ofstream file(filepath, std::ios::binary | std::ios::out);
+    if (!file.is_open())
+        THROW_IE_EXCEPTION << "cannot open file " << filepath;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(writer.buffer.data(), writer.buffer.size());
+    std::vector<char> padding(header.weightsOffset - sizeof(Header) - writer.buffer.size(), 0);
+    file.write(padding.data(), padding.size());
+    file.write(weightsWriter.weights.data(), weightsWriter.weights.size());
+    if (!file.good())
+        THROW_IE_EXCEPTION << "cannot write the binary IR to the file " << filepath;
+}
+
+CNNNetworkImplPtr BinaryIR::read(const char *filepath) {
+    long long fileSize = FileUtils::fileSize(filepath);
+    if (fileSize <= 0)
+        THROW_IE_EXCEPTION << "cannot open file " << filepath;
+    size_t size = static_cast<size_t>(fileSize);
+
+    TBlob<uint8_t>::Ptr file(new TBlob<uint8_t>(Precision::U8, C, {size},
+                                                shared_from_irelease(new MmapAllocator(filepath))));
+    file->allocate();
+    if (file->buffer() == nullptr) {
+        file.reset(new TBlob<uint8_t>(Precision::U8, C, {size}));
+        file->allocate();
+        FileUtils::readAllFile(filepath, file->buffer(), size);
+    }
+    return read(file);
+}
+
+CNNNetworkImplPtr BinaryIR::read(const TBlob<uint8_t>::Ptr &file) {
+    const uint8_t *data = file->readOnly();
+    if (!isBinaryIR(data, file->byteSize()))
+        THROW_IE_EXCEPTION << "The file is not the binary IR";
+
+    Header header;
+    memcpy(&header, data, sizeof(header));
+    if (header.version != formatVersion)
+        THROW_IE_EXCEPTION << "cannot parse the version " << header.version << " of the binary IR";
+    if (header.weightsOffset < sizeof(Header) || header.weightsOffset > file->byteSize() ||
+            header.weightsSize > file->byteSize() - header.weightsOffset)
+        THROW_IE_EXCEPTION << "The weights of the binary IR exceed the file";
+
+    Reader reader(data + sizeof(Header), static_cast<size_t>(header.weightsOffset) - sizeof(Header));
+    CNNNetworkImplPtr network(new CNNNetworkImpl());
+    network->setName(reader.str());
+    network->setPrecision(static_cast<Precision::ePrecision>(reader.u32()));
+
+    for (uint32_t count = reader.u32(), i = 0; i < count; i++) {
+        std::string name = reader.str();
+        Precision precision = static_cast<Precision::ePrecision>(reader.u32());
+        Layout layout = static_cast<Layout>(reader.u32());
+        SizeVector dims = reader.dims();
+        DataPtr &ptr = network->getData(name);
+        if (ptr)
+            THROW_IE_EXCEPTION << "The data name " << name << " of the binary IR is not unique";
+        ptr.reset(new Data(name, TensorDesc(precision, dims, layout)));
+    }
+
+    auto findData = [&](const std::string &name) -> DataPtr {
+        DataPtr &ptr = network->getData(name);
+        if (!ptr)
+            THROW_IE_EXCEPTION << "The data " << name << " is missing in the binary IR";
+        return ptr;
+    };
+
+    // the layer classes are the same as the IR reader creates for the types
+    V2FormatParser parser(2);
+    std::vector<CNNLayerPtr> layers;
+    for (uint32_t count = reader.u32(), i = 0; i < count; i++) {
+        LayerParams prms;
+        prms.name = reader.str();
+        prms.type = reader.str();
+        prms.precision = static_cast<Precision::ePrecision>(reader.u32());
+        CNNLayerPtr layer = parser.CreateLayer(prms);
+        layer->affinity = reader.str();
+
+        for (uint32_t params = reader.u32(), j = 0; j < params; j++) {
+            std::string key = reader.str();
+            layer->params[key] = reader.str();
+        }
+
+        for (uint32_t inputs = reader.u32(), j = 0; j < inputs; j++) {
+            DataPtr input = findData(reader.str());
+            input->getInputTo()[layer->name] = layer;
+            layer->insData.push_back(input);
+        }
+        for (uint32_t outputs = reader.u32(), j = 0; j < outputs; j++) {
+            DataPtr output = findData(reader.str());
+            if (output->getCreatorLayer().lock())
+                THROW_IE_EXCEPTION << "two layers set to the same output [" << output->getName() << "]";
+            output->getCreatorLayer() = layer;
+            layer->outData.push_back(output);
+        }
+
+        for (uint32_t blobs = reader.u32(), j = 0; j < blobs; j++) {
+            std::string key = reader.str();
+            layer->blobs[key] = readBlob(reader, file, header);
+        }
+        auto *weightableLayer = dynamic_cast<WeightableLayer *>(layer.get());
+        if (weightableLayer) {
+            if (layer->blobs.find("weights") != layer->blobs.end())
+                weightableLayer->_weights = layer->blobs["weights"];
+            if (layer->blobs.find("biases") != layer->blobs.end())
+                weightableLayer->_biases = layer->blobs["biases"];
+        }
+
+        network->addLayer(layer);
+        layers.push_back(layer);
+    }
+
+    // the typed parameters of the layers are parsed when all the layers are connected
+    for (auto &layer : layers)
+        layer->validateLayer();
+
+    for (uint32_t count = reader.u32(), i = 0; i < count; i++) {
+        InputInfo::Ptr info(new InputInfo());
+        info->setInputData(findData(reader.str()));
+
+        auto &preProcess = info->getPreProcess();
+        auto variant = static_cast<MeanVariant>(reader.u32());
+        preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(reader.u32()));
+        preProcess.setColorFormat(static_cast<ColorFormat>(reader.u32()));
+        uint32_t channels = reader.u32();
+        if (channels)
+            preProcess.init(channels);
+        for (uint32_t c = 0; c < channels; c++) {
+            preProcess[c]->meanValue = reader.f32();
+            preProcess[c]->stdScale = reader.f32();
+            if (reader.u8())
+                preProcess[c]->meanData = readBlob(reader, file, header);
+        }
+        preProcess.setVariant(variant);
+        network->setInputInfo(info);
+    }
+
+    network->resolveOutput();
+    for (uint32_t count = reader.u32(), i = 0; i < count; i++)
+        network->addOutput(reader.str());
+
+    return network;
+}
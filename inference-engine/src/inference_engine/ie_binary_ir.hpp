@@ -0,0 +1,52 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <ie_api.h>
+#include <ie_icnn_network.hpp>
+#include <ie_blob.h>
+#include "cnn_network_impl.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief The binary IR is the network and its weights in one file which is read without the XML parsing.
+ * The file starts with the header, the description of the layers and the data follows it, the weights
+ * are stored after the description aligned to 64 bytes, so the file is mapped to the memory and the blobs
+ * of the layers refer to the mapping.
+ */
+class INFERENCE_ENGINE_API_CLASS(BinaryIR) {
+public:
+    /**
+     * @brief Checks that the first size bytes of the buffer start with the signature of the binary IR
+     */
+    static bool isBinaryIR(const void *buffer, size_t size);
+
+    /**
+     * @brief Checks that the file starts with the signature of the binary IR
+     */
+    static bool isBinaryIR(const char *filepath);
+
+    /**
+     * @brief Writes the network with the weights of its layers and the mean images of its inputs
+     */
+    static void write(ICNNNetwork &network, const std::string &filepath);
+
+    /**
+     * @brief Maps the file and builds the network, the layers keep the mapping alive
+     */
+    static CNNNetworkImplPtr read(const char *filepath);
+
+    /**
+     * @brief Builds the network from the binary IR in the memory of the blob, the layers keep the blob alive
+     */
+    static CNNNetworkImplPtr read(const TBlob<uint8_t>::Ptr &file);
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
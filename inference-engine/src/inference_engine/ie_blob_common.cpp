@@ -8,29 +8,77 @@
 
 namespace InferenceEngine {
 
+namespace {
+
+/**
+ * @brief The allocator of the views which share the memory of the blob, it keeps the blob alive
+ */
+class ViewAllocator : public IAllocator {
+public:
+    explicit ViewAllocator(const Blob::Ptr &blob) : _blob(blob), _data(blob->buffer()) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    void * alloc(size_t size) noexcept override {
+        return _data;
+    }
+
+    bool free(void* handle) noexcept override {
+        return handle == _data;
+    }
+
+private:
+    Blob::Ptr _blob;
+    void *_data;
+};
+
+Blob::Ptr makeView(const Blob::Ptr &inputBlob, const TensorDesc &desc) {
+    Blob::Ptr view = make_blob_with_precision(desc, details::shared_from_irelease(new ViewAllocator(inputBlob)));
+    view->allocate();
+    return view;
+}
+
+}  // namespace
+
 Blob::Ptr make_shared_blob(const Blob::Ptr &inputBlob, const ROI &roi) {
+    const TensorDesc &inputDesc = inputBlob->getTensorDesc();
+    if (inputDesc.getDims().size() != 4)
+        THROW_IE_EXCEPTION << "ROI could not be cropped from the blob of " << inputDesc.getDims().size() << " dimensions";
+
     size_t blkDimsH = roi.sizeY;
     size_t blkDimsW = roi.sizeX;
-    size_t blkDimsC = inputBlob->getTensorDesc().getDims()[1];
+    size_t blkDimsC = inputDesc.getDims()[1];
     size_t blkOffset;
     SizeVector blkOrder;
     SizeVector blkDims;
 
-    if (roi.posX + roi.sizeX > inputBlob->getTensorDesc().getDims()[3] ||
-        roi.posY + roi.sizeY > inputBlob->getTensorDesc().getDims()[2]) {
+    if (roi.id >= inputDesc.getDims()[0] ||
+        roi.posX + roi.sizeX > inputDesc.getDims()[3] ||
+        roi.posY + roi.sizeY > inputDesc.getDims()[2]) {
         THROW_IE_EXCEPTION << "passed ROI coordinates are inconsistent to input size";
     }
 
-    Layout blobLayout = inputBlob->getTensorDesc().getLayout();
+    // the strides are the same because ROI blob uses the same memory buffer as original input blob.
+    SizeVector blkStrides(inputDesc.getBlockingDesc().getStrides());
+
+    Layout blobLayout = inputDesc.getLayout();
     switch (blobLayout) {
         case NCHW: {
-            blkOffset = inputBlob->getTensorDesc().getDims()[3] * roi.posY + roi.posX;
+            blkOffset = blkStrides[0] * roi.id + blkStrides[2] * roi.posY + blkStrides[3] * roi.posX;
             blkOrder = {0, 1, 2, 3};
             blkDims = {1, blkDimsC, blkDimsH, blkDimsW};  // we use BlockingDesc for 1 cropped image only
         }
         break;
         case NHWC: {
-            blkOffset = blkDimsC * (inputBlob->getTensorDesc().getDims()[3] * roi.posY + roi.posX);
+            blkOffset = blkStrides[0] * roi.id + blkStrides[1] * roi.posY + blkStrides[2] * roi.posX;
             blkOrder = {0, 2, 3, 1};
             blkDims = {1, blkDimsH, blkDimsW, blkDimsC};  // we use BlockingDesc for 1 cropped image only
         }
@@ -39,17 +87,38 @@ Blob::Ptr make_shared_blob(const Blob::Ptr &inputBlob, const ROI &roi) {
             THROW_IE_EXCEPTION << "ROI could not be cropped due to inconsistent input layout: " << blobLayout;
         }
     }
-
-    // the strides are the same because ROI blob uses the same memory buffer as original input blob.
-    SizeVector blkStrides(inputBlob->getTensorDesc().getBlockingDesc().getStrides());
+    // the ROI of the ROI blob starts at the offset of the latter
+    blkOffset += inputDesc.getBlockingDesc().getOffsetPadding();
 
     SizeVector blkDimsOffsets = {0, 0, 0, 0};  // no offset per dims by default
 
     BlockingDesc blkDesc(blkDims, blkOrder, blkOffset, blkDimsOffsets, blkStrides);
-    TensorDesc tDesc(inputBlob->getTensorDesc().getPrecision(), {1, blkDimsC, blkDimsH, blkDimsW}, blkDesc);
+    TensorDesc tDesc(inputDesc.getPrecision(), {1, blkDimsC, blkDimsH, blkDimsW}, blkDesc);
     tDesc.setLayout(blobLayout);
 
-    return make_blob_with_precision(tDesc, inputBlob->buffer());
+    return makeView(inputBlob, tDesc);
+}
+
+Blob::Ptr make_shared_blob(const Blob::Ptr &inputBlob, size_t batchOffset, size_t batchSize) {
+    const TensorDesc &inputDesc = inputBlob->getTensorDesc();
+    const BlockingDesc &inputBlk = inputDesc.getBlockingDesc();
+    SizeVector dims = inputDesc.getDims();
+    if (dims.empty() || inputBlk.getOrder().empty() || inputBlk.getOrder()[0] != 0)
+        THROW_IE_EXCEPTION << "The batch is not the outermost dimension of the blob of the layout "
+                           << inputDesc.getLayout();
+    if (batchSize == 0 || batchOffset >= dims[0] || batchSize > dims[0] - batchOffset)
+        THROW_IE_EXCEPTION << "The batch slice [" << batchOffset << ", " << batchOffset + batchSize
+                           << ") is out of the batch " << dims[0];
+
+    dims[0] = batchSize;
+    SizeVector blkDims = inputBlk.getBlockDims();
+    blkDims[0] = batchSize;
+    BlockingDesc blkDesc(blkDims, inputBlk.getOrder(), inputBlk.getOffsetPadding() + inputBlk.getStrides()[0] * batchOffset,
+                         inputBlk.getOffsetPaddingToData(), inputBlk.getStrides());
+    TensorDesc tDesc(inputDesc.getPrecision(), dims, blkDesc);
+    tDesc.setLayout(inputDesc.getLayout());
+
+    return makeView(inputBlob, tDesc);
 }
 
 }  // namespace InferenceEngine
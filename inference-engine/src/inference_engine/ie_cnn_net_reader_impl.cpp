@@ -16,6 +16,8 @@
 #include <file_utils.h>
 #include <ie_plugin.hpp>
 #include "xml_parse_utils.h"
+#include "mmap_allocator.hpp"
+#include "ie_binary_ir.hpp"
 
 using namespace std;
 using namespace InferenceEngine;
@@ -38,6 +40,8 @@ CNNNetReaderImpl::CNNNetReaderImpl(const FormatParserCreator::Ptr& _creator)
         : parseSuccess(false), version(0), parserCreator(_creator) {}
 
 StatusCode CNNNetReaderImpl::SetWeights(const TBlob<uint8_t>::Ptr& weights, ResponseDesc* desc)  noexcept {
+    if (weightsIncluded)
+        return OK;
     if (!_parser) {
         return DescriptionBuffer(desc) << "network must be read first";
     }
@@ -56,6 +60,20 @@ int CNNNetReaderImpl::GetFileVersion(pugi::xml_node& root) {
 }
 
 StatusCode CNNNetReaderImpl::ReadNetwork(const void* model, size_t size, ResponseDesc* resp) noexcept {
+    if (BinaryIR::isBinaryIR(model, size)) {
+        StatusCode ret = ReadBinaryNetwork([&]() {
+            // the layers refer to the weights, so the memory of the caller is copied
+            TBlob<uint8_t>::Ptr file(new TBlob<uint8_t>(Precision::U8, C, {size}));
+            file->allocate();
+            memcpy(file->buffer(), model, size);
+            return BinaryIR::read(file);
+        });
+        if (ret != OK) {
+            return DescriptionBuffer(resp) << "Error reading network: " << description;
+        }
+        return OK;
+    }
+
     pugi::xml_document xmlDoc;
     pugi::xml_parse_result res = xmlDoc.load_buffer(model, size);
     if (res.status != pugi::status_ok) {
@@ -69,6 +87,9 @@ StatusCode CNNNetReaderImpl::ReadNetwork(const void* model, size_t size, Respons
 }
 
 StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* resp) noexcept {
+    if (weightsIncluded)
+        return OK;
+
     long long fileSize = FileUtils::fileSize(filepath);
     if (fileSize == 0)
         return OK;
@@ -81,30 +102,47 @@ StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* res
 
     size_t ulFileSize = static_cast<size_t>(fileSize);
 
-    TBlob<uint8_t>::Ptr weightsPtr(new TBlob<uint8_t>(Precision::U8, C, {ulFileSize}));
+    // the layers keep the proxies of the mapped weights, so the file is read by the pages which are used
+    TBlob<uint8_t>::Ptr weightsPtr(new TBlob<uint8_t>(Precision::U8, C, {ulFileSize},
+                                                      shared_from_irelease(new MmapAllocator(filepath))));
     weightsPtr->allocate();
-    try {
-        FileUtils::readAllFile(filepath, weightsPtr->buffer(), ulFileSize);
-    }
-    catch (const InferenceEngineException& iee) {
-        return DescriptionBuffer(resp) << iee.what();
+    if (weightsPtr->buffer() == nullptr) {
+        // the file which cannot be mapped is read by the segments of the layers on their first access
+        if (!_parser) {
+            return DescriptionBuffer(resp) << "network must be read first";
+        }
+        try {
+            _parser->SetWeightsFile(filepath, ulFileSize);
+        }
+        catch (const InferenceEngineException& iee) {
+            return DescriptionBuffer(resp) << iee.what();
+        }
+        return OK;
     }
 
     return SetWeights(weightsPtr, resp);
 }
 
 StatusCode CNNNetReaderImpl::ReadNetwork(const char* filepath, ResponseDesc* resp) noexcept {
+    if (BinaryIR::isBinaryIR(filepath)) {
+        StatusCode ret = ReadBinaryNetwork([&]() {
+            return BinaryIR::read(filepath);
+        });
+        if (ret != OK) {
+            return DescriptionBuffer(resp) << "Error reading network: " << description;
+        }
+        return OK;
+    }
+
     pugi::xml_document xmlDoc;
     pugi::xml_parse_result res = xmlDoc.load_file(filepath);
     if (res.status != pugi::status_ok) {
         std::ifstream t(filepath);
-        std::string str((std::istreambuf_iterator<char>(t)),
-                        std::istreambuf_iterator<char>());
 
         int line = 1;
         int pos = 0;
-        for (auto token : str) {
-            if (token == '\n') {
+        for (std::istreambuf_iterator<char> it(t), end; it != end; it++) {
+            if (*it == '\n') {
                 line++;
                 pos = 0;
             } else {
@@ -135,6 +173,7 @@ StatusCode CNNNetReaderImpl::ReadNetwork(pugi::xml_document& xmlDoc) {
         version = GetFileVersion(root);
         if (version > 2) THROW_IE_EXCEPTION << "cannot parse future versions: " << version;
         _parser = parserCreator->create(version);
+        weightsIncluded = false;
         network = _parser->Parse(root);
         name = network->getName();
         network->validate(version);
@@ -160,6 +199,34 @@ StatusCode CNNNetReaderImpl::ReadNetwork(pugi::xml_document& xmlDoc) {
     return OK;
 }
 
+StatusCode CNNNetReaderImpl::ReadBinaryNetwork(const std::function<CNNNetworkImplPtr()> &read) {
+    description.clear();
+
+    try {
+        _parser.reset();
+        version = 2;
+        network = read();
+        name = network->getName();
+        network->validate(version);
+        weightsIncluded = true;
+        parseSuccess = true;
+    } catch (const InferenceEngineException& e) {
+        description = e.what();
+        parseSuccess = false;
+        return GENERAL_ERROR;
+    } catch (const std::exception& e) {
+        description = e.what();
+        parseSuccess = false;
+        return GENERAL_ERROR;
+    } catch (...) {
+        description = "Unknown exception thrown";
+        parseSuccess = false;
+        return UNEXPECTED;
+    }
+
+    return OK;
+}
+
 std::shared_ptr<IFormatParser> V2FormatParserCreator::create(int version) {
     return std::make_shared<V2FormatParser>(version);
 }
@@ -7,6 +7,7 @@
 
 #include "ie_icnn_net_reader.h"
 #include "cnn_network_impl.hpp"
+#include <functional>
 #include <memory>
 #include <string>
 #include <map>
@@ -79,10 +80,17 @@ private:
 
     StatusCode ReadNetwork(pugi::xml_document &xmlDoc);
 
+    /**
+     * @brief Builds the network with the weights from the binary IR, the weights of the reader are not used then
+     */
+    StatusCode ReadBinaryNetwork(const std::function<CNNNetworkImplPtr()> &read);
+
     std::string description;
     std::string name;
     InferenceEngine::details::CNNNetworkImplPtr network;
     bool parseSuccess;
+    // the network is read from the binary IR which contains the weights
+    bool weightsIncluded = false;
     int version;
     FormatParserCreator::Ptr parserCreator;
 };
@@ -5,7 +5,9 @@
 
 #include "ie_graph_splitter.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -13,156 +15,118 @@
 #include <string>
 
 #include <ade_util.hpp>
+#include <details/ie_exception.hpp>
 
+#include <graph.hpp>
 #include <typed_graph.hpp>
-#include <helpers/subgraphs.hpp>
+#include <passes/topological_sort.hpp>
 
-#include <util/filter_range.hpp>
+#include <util/algorithm.hpp>
 #include <util/iota_range.hpp>
 
 namespace InferenceEngine {
 
 namespace {
-class ISplitChecker {
-public:
-    struct GraphSelectionResult final {
-        static const constexpr std::size_t NoGraph
-            = static_cast<std::size_t>(-1);
-
-        std::size_t selectedGraph = NoGraph;
-        bool continueSelect = false;
-    };
-
-    virtual ~ISplitChecker() = default;
-    virtual GraphSelectionResult selectSubgraph(
-            const std::vector<LayersSet>& subgraphs) = 0;
-};
-
-class DefaultSplitChecker : public ISplitChecker {
-public:
-    // ISplitChecker interface
-    GraphSelectionResult selectSubgraph(const std::vector<LayersSet>& subgraphs) override;
-};
+using NodesMap = std::unordered_map<ade::NodeHandle, std::size_t, ade::HandleHasher<ade::Node>>;
 }  // namespace
 
 std::vector<LayersSet> splitGraph(ICNNNetwork& network,
         const std::vector<std::string>& plugins) {
     assert(!plugins.empty());
     ade::Graph gr;
-    ade::TypedGraph<CNNLayerMetadata> tgr(gr);
-
-    std::vector<LayersSet> tempSubgraphs;
-    LayersSet tempSet1;
-    LayersSet tempSet2;
-
     translateNetworkToAde(gr, network);
-    std::size_t currentChecker = 0;
 
-    DefaultSplitChecker checker;
-
-    auto getChecker = [&]() {
-        assert(currentChecker < plugins.size());
-        return &checker;
-    };
+    ade::passes::PassContext context{gr};
+    ade::passes::TopologicalSort()(context);
+    ade::TypedGraph<CNNLayerMetadata, ade::passes::TopologicalSortData> tgr(gr);
+    std::vector<ade::NodeHandle> sorted;
+    for (auto&& node : tgr.metadata().get<ade::passes::TopologicalSortData>().nodes()) {
+        sorted.push_back(node);
+    }
 
-    auto getAffinity = [&]()->const std::string& {
-        assert(currentChecker < plugins.size());
-        return plugins[currentChecker];
+    auto getAffinity = [&](const ade::NodeHandle& node)->const std::string& {
+        assert(nullptr != node);
+        auto layer = tgr.metadata(node).get<CNNLayerMetadata>().layer;
+        assert(nullptr != layer);
+        return layer->affinity;
     };
 
-    auto nodes = gr.nodes();
-    ade::subgraphs::NodesSet availableNodes(nodes.begin(), nodes.end());
-    std::vector<LayersSet> finalSubgraphs;
-    ade::SubgraphSelfReferenceChecker cycleChecker(nodes);
-    while (!availableNodes.empty()) {
-        auto subgraphs = ade::selectSubgraphs(
-                             util::filter(util::toRange(availableNodes),
-                                          [&](const ade::NodeHandle& node) {
-            assert(nullptr != node);
-            auto layer = tgr.metadata(node).get<CNNLayerMetadata>().layer;
-            assert(nullptr != layer);
-            return layer->affinity == getAffinity();
-        }),
-                             [&](
-                             const ade::EdgeHandle& edge,
-                             ade::SubgraphMergeDirection dir) {
-            assert(nullptr != edge);
-            auto dstNode = ade::getDstMergeNode(edge, dir);
-            assert(nullptr != dstNode);
-            if (!util::contains(availableNodes, dstNode)) {
-                return false;
-            }
-            auto srcNode = ade::getSrcMergeNode(edge, dir);
-            assert(nullptr != srcNode);
-            auto srcLayer = tgr.metadata(srcNode).get<CNNLayerMetadata>().layer;
-            auto dstLayer = tgr.metadata(dstNode).get<CNNLayerMetadata>().layer;
-            assert(nullptr != srcLayer);
-            assert(nullptr != dstLayer);
-            return srcLayer->affinity == dstLayer->affinity;
-        },
-                             [&](
-                             const ade::subgraphs::NodesSet& acceptedNodes,
-                             const ade::subgraphs::NodesSet& rejectedNodes) {
-            if (cycleChecker(acceptedNodes, rejectedNodes)) {
-                return false;
-            }
-            return true;
-        });
+    std::unordered_set<std::string> affinities(plugins.begin(), plugins.end());
+    for (auto&& node : sorted) {
+        if (!util::contains(affinities, getAffinity(node))) {
+            THROW_IE_EXCEPTION << "Some nodes weren't assigned to plugin";
+        }
+    }
 
-        if (!subgraphs.empty()) {
-            if (plugins.size() == currentChecker) {
-                THROW_IE_EXCEPTION << "Some nodes weren't assigned to plugin";
-            }
+    // The level of the node is the number of the changes of the affinity on the path to it, so the edges between
+    // the layers of different affinities go from a lower level to a higher one. The components of the layers
+    // of the same affinity and level connected by the edges are the subgraphs, and the edges between the subgraphs
+    // always go to the higher levels, so the subgraphs have no cycles. The level is the earliest one first, then
+    // the nodes are moved to the latest level their users allow, so the layers are merged with their users rather
+    // than left in the subgraphs of their own.
+    NodesMap levels;
+    for (auto&& node : sorted) {
+        std::size_t level = 0;
+        for (auto&& prevNode : node->inNodes()) {
+            assert(util::contains(levels, prevNode));
+            level = std::max(level, levels[prevNode] + (getAffinity(prevNode) != getAffinity(node) ? 1 : 0));
+        }
+        levels[node] = level;
+    }
+    for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+        auto& node = *it;
+        if (node->outNodes().empty()) {
+            continue;
+        }
+        auto level = std::numeric_limits<std::size_t>::max();
+        for (auto&& nextNode : node->outNodes()) {
+            level = std::min(level, levels[nextNode] - (getAffinity(nextNode) != getAffinity(node) ? 1 : 0));
+        }
+        assert(level >= levels[node]);
+        levels[node] = level;
+    }
 
-            tempSubgraphs.clear();
-            for (auto&& subgraph : subgraphs) {
-                assert(!subgraph.empty());
-                tempSet1.clear();
-                for (auto&& node : subgraph) {
-                    assert(nullptr != node);
-                    auto layer = tgr.metadata(node).get<CNNLayerMetadata>().layer;
-                    assert(nullptr != layer);
-                    tempSet1.insert(layer);
+    NodesMap components;
+    std::vector<std::pair<std::size_t, LayersSet>> subgraphs;
+    std::vector<ade::NodeHandle> stack;
+    for (auto&& root : sorted) {
+        if (util::contains(components, root)) {
+            continue;
+        }
+        const auto index = subgraphs.size();
+        subgraphs.emplace_back(levels[root], LayersSet());
+        components[root] = index;
+        stack.push_back(root);
+        while (!stack.empty()) {
+            auto node = stack.back();
+            stack.pop_back();
+            subgraphs.back().second.insert(tgr.metadata(node).get<CNNLayerMetadata>().layer);
+            auto visit = [&](const ade::NodeHandle& adjacent) {
+                if (!util::contains(components, adjacent) && levels[adjacent] == levels[node] &&
+                        getAffinity(adjacent) == getAffinity(node)) {
+                    components[adjacent] = index;
+                    stack.push_back(adjacent);
                 }
-                tempSubgraphs.emplace_back(std::move(tempSet1));
+            };
+            for (auto&& prevNode : node->inNodes()) {
+                visit(prevNode);
             }
-            auto result = getChecker()->selectSubgraph(tempSubgraphs);
-            const auto selected = result.selectedGraph;
-            if (ISplitChecker::GraphSelectionResult::NoGraph !=
-                    selected) {
-                assert(selected < subgraphs.size());
-                finalSubgraphs.emplace_back(std::move(tempSubgraphs[selected]));
-
-                for (auto&& node : subgraphs[selected]) {
-                    availableNodes.erase(node);
-                }
-
-                if (result.continueSelect) {
-                    continue;
-                }
+            for (auto&& nextNode : node->outNodes()) {
+                visit(nextNode);
             }
         }
-        ++currentChecker;
     }
 
-    return finalSubgraphs;
-}
-
-ISplitChecker::GraphSelectionResult DefaultSplitChecker::selectSubgraph(
-        const std::vector<LayersSet>& subgraphs) {
-    assert(!subgraphs.empty());
-    std::size_t index = 0;
-    auto maxSize = subgraphs[0].size();
-    for (auto i : util::iota(std::size_t(1), subgraphs.size())) {
-        auto size = subgraphs[i].size();
-        if (size > maxSize) {
-            index = 1;
-            maxSize = size;
-        }
+    // the subgraphs of the lower levels don't depend on the higher ones, so they are returned in the topological order
+    std::stable_sort(subgraphs.begin(), subgraphs.end(),
+                     [](const std::pair<std::size_t, LayersSet>& lhs, const std::pair<std::size_t, LayersSet>& rhs) {
+        return lhs.first < rhs.first;
+    });
+    std::vector<LayersSet> ret;
+    ret.reserve(subgraphs.size());
+    for (auto&& subgraph : subgraphs) {
+        ret.emplace_back(std::move(subgraph.second));
     }
-    GraphSelectionResult ret;
-    ret.selectedGraph = index;
-    ret.continueSelect = true;
     return ret;
 }
 
@@ -191,6 +155,14 @@ void topoVisitSubgraph(std::vector<SubgraphDesc>& subgraphs,
 void sortSubgraphs(std::vector<LayersSet>& subgraphs) {
     std::vector<SubgraphDesc> descs(subgraphs.size());
 
+    std::unordered_map<const CNNLayer*, std::size_t> layerSubgraphs;
+    for (auto i : util::iota(subgraphs.size())) {
+        for (auto&& layer : subgraphs[i]) {
+            assert(nullptr != layer);
+            layerSubgraphs[layer.get()] = i;
+        }
+    }
+
     for (auto i : util::iota(subgraphs.size())) {
         auto& subgraph = subgraphs[i];
         assert(!subgraph.empty());
@@ -201,13 +173,9 @@ void sortSubgraphs(std::vector<LayersSet>& subgraphs) {
                 assert(nullptr != data);
                 auto prevLayer = data->creatorLayer.lock();
                 if (nullptr != prevLayer) {
-                    for (auto j : util::iota(subgraphs.size())) {
-                        if (i != j) {
-                            if (util::contains(subgraphs[j], prevLayer)) {
-                                descs[i].dependsOn.insert(j);
-                                break;
-                            }
-                        }
+                    auto it = layerSubgraphs.find(prevLayer.get());
+                    if (layerSubgraphs.end() != it && i != it->second) {
+                        descs[i].dependsOn.insert(it->second);
                     }
                 }
             }
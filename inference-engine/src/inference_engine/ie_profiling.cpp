@@ -0,0 +1,213 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_profiling.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+struct TraceEvent {
+    std::string name;
+    TraceCollector::Clock::time_point begin;
+    TraceCollector::Clock::time_point end;
+};
+
+struct TraceBuffer {
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    size_t tid = 0;
+};
+
+std::atomic<bool> traceEnabled(false);
+
+class TraceWriter {
+public:
+    // the events of a thread are written by chunks of the size, the lock of the file is taken once per chunk
+    static constexpr size_t chunkSize = 1024;
+
+    static TraceWriter& instance() {
+        static TraceWriter writer;
+        return writer;
+    }
+
+    bool open(const std::string& path) {
+        close();
+        std::lock_guard<std::mutex> lock(_mutex);
+        _file.open(path, std::ios::out | std::ios::trunc);
+        if (!_file.is_open())
+            return false;
+        // the closing bracket is optional in the array format, so the file is valid at any moment
+        _file << "[\n";
+        traceEnabled = true;
+        return true;
+    }
+
+    void close() {
+        traceEnabled = false;
+        flush();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_file.is_open())
+            _file.close();
+    }
+
+    std::shared_ptr<TraceBuffer> registerThread() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto buffer = std::make_shared<TraceBuffer>();
+        buffer->tid = _buffers.size();
+        buffer->events.reserve(chunkSize);
+        _buffers.push_back(buffer);
+        return buffer;
+    }
+
+    void write(const std::vector<TraceEvent>& events, size_t tid) {
+        std::string chunk;
+        for (auto& event : events) {
+            chunk += "{\"name\":\"" + escape(event.name) + "\",\"cat\":\"IE\",\"ph\":\"X\",\"ts\":" +
+                     microseconds(event.begin) + ",\"dur\":" + microseconds(event.end, event.begin) +
+                     ",\"pid\":" + _pid + ",\"tid\":" + std::to_string(tid) + "},\n";
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_file.is_open())
+            return;
+        _file << chunk;
+        _file.flush();
+    }
+
+    void flush() {
+        std::vector<std::shared_ptr<TraceBuffer>> buffers;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            buffers = _buffers;
+        }
+        for (auto& buffer : buffers) {
+            std::vector<TraceEvent> events;
+            {
+                std::lock_guard<std::mutex> lock(buffer->mutex);
+                events.swap(buffer->events);
+            }
+            if (!events.empty())
+                write(events, buffer->tid);
+        }
+    }
+
+    ~TraceWriter() {
+        close();
+    }
+
+private:
+    TraceWriter() : _start(TraceCollector::Clock::now()) {
+#ifdef _WIN32
+        _pid = std::to_string(_getpid());
+#else
+        _pid = std::to_string(getpid());
+#endif
+        const char* path = std::getenv("IE_TRACE_FILE");
+        if (path != nullptr && *path != '\0' && !open(path))
+            std::cerr << "Cannot open the trace file " << path << std::endl;
+    }
+
+    std::string microseconds(TraceCollector::Clock::time_point end, TraceCollector::Clock::time_point begin) const {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.3f",
+                      std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() / 1000.0);
+        return buffer;
+    }
+
+    std::string microseconds(TraceCollector::Clock::time_point time) const {
+        return microseconds(time, _start);
+    }
+
+    static std::string escape(const std::string& name) {
+        std::string escaped;
+        for (char c : name) {
+            if (c == '"' || c == '\\') {
+                escaped += '\\';
+                escaped += c;
+            } else if (static_cast<unsigned char>(c) >= 0x20) {
+                escaped += c;
+            }
+        }
+        return escaped;
+    }
+
+    TraceCollector::Clock::time_point _start;
+    std::string _pid;
+    std::ofstream _file;
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<TraceBuffer>> _buffers;
+};
+
+constexpr size_t TraceWriter::chunkSize;
+
+}  // namespace
+
+bool TraceCollector::isEnabled() noexcept {
+    // the environment variable is read at the first check
+    static TraceWriter& writer = TraceWriter::instance();
+    (void)writer;
+    return traceEnabled.load(std::memory_order_relaxed);
+}
+
+void TraceCollector::add(const char* name, Clock::time_point begin, Clock::time_point end) noexcept {
+    if (!isEnabled())
+        return;
+    try {
+        thread_local std::shared_ptr<TraceBuffer> buffer = TraceWriter::instance().registerThread();
+        std::vector<TraceEvent> events;
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            buffer->events.push_back({name, begin, end});
+            if (buffer->events.size() < TraceWriter::chunkSize)
+                return;
+            events.swap(buffer->events);
+            buffer->events.reserve(TraceWriter::chunkSize);
+        }
+        TraceWriter::instance().write(events, buffer->tid);
+    } catch (...) {
+        // the tracing never breaks the inference
+    }
+}
+
+void TraceCollector::flush() noexcept {
+    try {
+        TraceWriter::instance().flush();
+    } catch (...) {
+    }
+}
+
+bool TraceCollector::start(const std::string& path) noexcept {
+    try {
+        return TraceWriter::instance().open(path);
+    } catch (...) {
+        return false;
+    }
+}
+
+void TraceCollector::stop() noexcept {
+    try {
+        TraceWriter::instance().close();
+    } catch (...) {
+    }
+}
+
+}  // namespace InferenceEngine
@@ -21,6 +21,8 @@
 #include <mutex>
 #include <cfloat>
 
+#include "ie_api.h"
+
 #if ENABLE_PROFILING_ITT
 #include <ittnotify.h>
 #endif
@@ -207,10 +209,81 @@ inline static void annotateEnd(TimeResultsMap& m, TimeSampler& t) {
     #define IE_TIMER_SCOPE(timerName)
 #endif
 
+/**
+ * @brief Collects the profiling scopes in the Chrome trace event format (chrome://tracing, Perfetto). Unlike ITT and
+ * the raw timers the trace is enabled at runtime: by the IE_TRACE_FILE environment variable naming a file or by
+ * start(). Every scope of the process is written as a complete event with the thread it was run on. The events are
+ * buffered per thread and appended to the file by chunks, the file is a JSON array which stays valid if the process
+ * is killed. If the trace is disabled a scope costs a check of a flag.
+ */
+class INFERENCE_ENGINE_API_CLASS(TraceCollector) {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static bool isEnabled() noexcept;
+
+    static void add(const char* name, Clock::time_point begin, Clock::time_point end) noexcept;
+
+    /**
+     * @brief Starts the trace to the file, the previous trace file is closed
+     * @return false if the file cannot be opened
+     */
+    static bool start(const std::string& path) noexcept;
+
+    /**
+     * @brief Writes the buffered events and closes the trace file
+     */
+    static void stop() noexcept;
+
+    /**
+     * @brief Writes the buffered events of all threads to the file
+     */
+    static void flush() noexcept;
+};
+
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) noexcept : _name(TraceCollector::isEnabled() ? name : nullptr) {
+        if (_name) _begin = TraceCollector::Clock::now();
+    }
+
+    // the name is referenced until the end of the scope
+    explicit TraceScope(const std::string& name) noexcept : TraceScope(name.c_str()) {}
+    explicit TraceScope(std::string&& name) = delete;
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope() {
+        if (_name) TraceCollector::add(_name, _begin, TraceCollector::Clock::now());
+    }
+
+private:
+    const char* _name;
+    TraceCollector::Clock::time_point _begin;
+};
+
+/**
+ * @brief Writes the buffered events of all threads at the end of the scope. It is used by the rare operations, like the
+ * load of a network, whose events are read from the file while the process runs
+ */
+class TraceFlushScope {
+public:
+    TraceFlushScope() = default;
+    TraceFlushScope(const TraceFlushScope&) = delete;
+    TraceFlushScope& operator=(const TraceFlushScope&) = delete;
+
+    ~TraceFlushScope() {
+        if (TraceCollector::isEnabled()) TraceCollector::flush();
+    }
+};
+
+#define IE_TRACE_SCOPE(name) ::InferenceEngine::TraceScope IE_ANNOTATE_MAKE_NAME(InferenceEngineTrace, _scope)(name)
+
 #define IE_STR(x) IE_STR_(x)
 #define IE_STR_(x) #x
 
-#define IE_PROFILING_AUTO_SCOPE(NAME) IE_ITT_SCOPE(IE_STR(NAME)); IE_TIMER_SCOPE(IE_STR(NAME));
+#define IE_PROFILING_AUTO_SCOPE(NAME) IE_ITT_SCOPE(IE_STR(NAME)); IE_TIMER_SCOPE(IE_STR(NAME)); IE_TRACE_SCOPE(IE_STR(NAME));
 
 struct ProfilingTask {
     std::string name;
@@ -262,6 +335,7 @@ inline static void annotateEnd(IttStatic&, IttProfilingTask& t) {
     #define IE_ITT_TASK_SCOPE(profiling_task)
 #endif
 
-#define IE_PROFILING_AUTO_SCOPE_TASK(PROFILING_TASK) IE_ITT_TASK_SCOPE(PROFILING_TASK); IE_TIMER_SCOPE(PROFILING_TASK.name);
+#define IE_PROFILING_AUTO_SCOPE_TASK(PROFILING_TASK) \
+    IE_ITT_TASK_SCOPE(PROFILING_TASK); IE_TIMER_SCOPE(PROFILING_TASK.name); IE_TRACE_SCOPE(PROFILING_TASK.name);
 
 }  // namespace InferenceEngine
@@ -0,0 +1,306 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_tiling.hpp"
+#include "graph_tools.hpp"
+#include "caseless.hpp"
+
+#include <ie_layers.h>
+#include <details/ie_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+// the geometry of a feature map along an axis in the pixels of the input of the network: the distance between
+// its neighbouring elements and the distance to the farthest input pixel an element depends on
+struct AxisGeometry {
+    double jump = 1.0;
+    double reach = 0.0;
+};
+
+struct DataGeometry {
+    AxisGeometry x, y;
+};
+
+// the window of the layer of the given kernel, the padding is symmetric, so the window reaches the farther one
+// of the padding and the rest of the kernel
+double windowReach(unsigned int kernel, unsigned int padding, unsigned int dilation) {
+    const unsigned int extent = (std::max(kernel, 1u) - 1) * std::max(dilation, 1u);
+    return static_cast<double>(std::max(padding, extent - std::min(padding, extent)));
+}
+
+void applyWindow(AxisGeometry &axis, unsigned int kernel, unsigned int stride, unsigned int padding,
+                 unsigned int dilation) {
+    axis.reach += windowReach(kernel, padding, dilation) * axis.jump;
+    axis.jump *= std::max(stride, 1u);
+}
+
+// the output element of the deconvolution is gathered from the inputs within the window divided by the stride
+void applyDeconvolution(AxisGeometry &axis, unsigned int kernel, unsigned int stride, unsigned int padding,
+                        unsigned int dilation) {
+    const double step = std::max(stride, 1u);
+    axis.reach += std::ceil(windowReach(kernel, padding, dilation) / step) * axis.jump;
+    axis.jump /= step;
+}
+
+size_t roundUp(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+size_t alignOf(double jump) {
+    return std::max<size_t>(1, static_cast<size_t>(std::ceil(jump - 1e-6)));
+}
+
+// the window of the tile along an axis: its start in the image, the part of the image it writes the output of
+struct Span {
+    size_t start;
+    size_t begin;
+    size_t end;
+};
+
+// the windows step by the window without the halo on both sides, so the written parts follow each other.
+// The last window is moved back into the image padded to the alignment, so only the image smaller than the window
+// is read beyond its end
+std::vector<Span> splitAxis(size_t length, size_t window, size_t halo, size_t align) {
+    const size_t padded = roundUp(length, align);
+    if (padded <= window)
+        return {{0, 0, length}};
+
+    std::vector<Span> spans;
+    for (size_t start = 0;; start += window - 2 * halo) {
+        const bool last = start + window >= padded;
+        if (last)
+            start = padded - window;
+        const size_t begin = spans.empty() ? 0 : spans.back().end;
+        const size_t end = last ? length : std::min(length, start + window - halo);
+        spans.push_back({start, begin, end});
+        if (last)
+            break;
+    }
+    return spans;
+}
+
+Blob::Ptr getRequestBlob(const IInferRequest::Ptr &request, const std::string &name) {
+    ResponseDesc resp;
+    Blob::Ptr blob;
+    if (request->GetBlob(name.c_str(), blob, &resp) != OK || !blob)
+        THROW_IE_EXCEPTION << "Cannot get the blob " << name << " of the request: " << resp.msg;
+    return blob;
+}
+
+void checkPlanar(const Blob::Ptr &blob, const std::string &what) {
+    if (!blob || blob->getTensorDesc().getDims().size() != 4 || blob->getTensorDesc().getLayout() != NCHW)
+        THROW_IE_EXCEPTION << "The tiled inference supports the dense NCHW " << what << " only";
+}
+
+}  // namespace
+
+TilingInfo InferenceEngine::getTilingInfo(const ICNNNetwork &network) {
+    static const caseless_set<std::string> globalLayers = {
+        "FullyConnected", "InnerProduct", "Reshape", "Flatten", "Permute", "Crop", "Tile", "MVN", "ROIPooling",
+        "PSROIPooling", "PriorBox", "PriorBoxClustered", "Proposal", "DetectionOutput", "RegionYolo", "ReorgYolo",
+        "SpatialTransformer", "SimplerNMS"
+    };
+
+    std::map<std::string, DataGeometry> geometries;
+    double maxJumpX = 1.0, maxJumpY = 1.0;
+
+    for (const auto &layer : CNNNetSortTopologically(network)) {
+        if (globalLayers.count(layer->type))
+            THROW_IE_EXCEPTION << "The network is not fully convolutional, the layer " << layer->name
+                               << " of the type " << layer->type << " mixes the whole feature maps";
+
+        DataGeometry geometry;
+        bool isFirst = true;
+        for (const auto &input : layer->insData) {
+            auto data = input.lock();
+            if (!data)
+                THROW_IE_EXCEPTION << "The input of the layer " << layer->name << " is not set";
+            const auto found = geometries.find(data->name);
+            const DataGeometry inputGeometry = found == geometries.end() ? DataGeometry() : found->second;
+            if (isFirst) {
+                geometry = inputGeometry;
+                isFirst = false;
+                continue;
+            }
+            if (std::fabs(geometry.x.jump - inputGeometry.x.jump) > 1e-6 ||
+                    std::fabs(geometry.y.jump - inputGeometry.y.jump) > 1e-6)
+                THROW_IE_EXCEPTION << "The inputs of the layer " << layer->name << " have different strides";
+            geometry.x.reach = std::max(geometry.x.reach, inputGeometry.x.reach);
+            geometry.y.reach = std::max(geometry.y.reach, inputGeometry.y.reach);
+        }
+
+        if (auto conv = dynamic_cast<ConvolutionLayer *>(layer.get())) {
+            applyWindow(geometry.x, conv->_kernel_x, conv->_stride_x, conv->_padding_x, conv->_dilation_x);
+            applyWindow(geometry.y, conv->_kernel_y, conv->_stride_y, conv->_padding_y, conv->_dilation_y);
+        } else if (auto pool = dynamic_cast<PoolingLayer *>(layer.get())) {
+            applyWindow(geometry.x, pool->_kernel_x, pool->_stride_x, pool->_padding_x, 1);
+            applyWindow(geometry.y, pool->_kernel_y, pool->_stride_y, pool->_padding_y, 1);
+        } else if (auto deconv = dynamic_cast<DeconvolutionLayer *>(layer.get())) {
+            applyDeconvolution(geometry.x, deconv->_kernel_x, deconv->_stride_x, deconv->_padding_x,
+                               deconv->_dilation_x);
+            applyDeconvolution(geometry.y, deconv->_kernel_y, deconv->_stride_y, deconv->_padding_y,
+                               deconv->_dilation_y);
+        } else if (auto norm = dynamic_cast<NormLayer *>(layer.get())) {
+            if (!norm->_isAcrossMaps) {
+                const double reach = std::ceil((std::max(norm->_size, 1u) - 1) / 2.0);
+                geometry.x.reach += reach * geometry.x.jump;
+                geometry.y.reach += reach * geometry.y.jump;
+            }
+        } else if (CaselessEq<std::string>()(layer->type, "Resample")) {
+            // the interpolation reads the neighbours of the input element
+            const double factor = layer->GetParamAsFloat("factor", 1.0f);
+            if (factor <= 0.0)
+                THROW_IE_EXCEPTION << "The layer " << layer->name << " has the wrong factor " << factor;
+            for (AxisGeometry *axis : {&geometry.x, &geometry.y}) {
+                axis->reach += axis->jump;
+                axis->jump /= factor;
+            }
+        }
+
+        maxJumpX = std::max(maxJumpX, geometry.x.jump);
+        maxJumpY = std::max(maxJumpY, geometry.y.jump);
+        for (const auto &data : layer->outData)
+            geometries[data->name] = geometry;
+    }
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+
+    TilingInfo tiling;
+    tiling.alignX = alignOf(maxJumpX);
+    tiling.alignY = alignOf(maxJumpY);
+    for (const auto &output : outputs) {
+        const DataGeometry &geometry = geometries[output.first];
+        tiling.haloX = std::max(tiling.haloX, roundUp(static_cast<size_t>(std::ceil(geometry.x.reach - 1e-6)),
+                                                      tiling.alignX));
+        tiling.haloY = std::max(tiling.haloY, roundUp(static_cast<size_t>(std::ceil(geometry.y.reach - 1e-6)),
+                                                      tiling.alignY));
+    }
+    return tiling;
+}
+
+SizeVector InferenceEngine::getTileDims(const TilingInfo &tiling, const SizeVector &inputDims, size_t batch,
+                                        size_t tileHeight, size_t tileWidth) {
+    if (inputDims.size() != 4)
+        THROW_IE_EXCEPTION << "The tiled inference supports the NCHW inputs only, the input has "
+                           << inputDims.size() << " dimensions";
+    return {std::max<size_t>(batch, 1), inputDims[1],
+            roundUp(std::max<size_t>(tileHeight, 1), tiling.alignY) + 2 * tiling.haloY,
+            roundUp(std::max<size_t>(tileWidth, 1), tiling.alignX) + 2 * tiling.haloX};
+}
+
+void InferenceEngine::inferTiled(IInferRequest::Ptr request, const std::string &inputName, const Blob::Ptr &image,
+                                 const std::string &outputName, const Blob::Ptr &result, const TilingInfo &tiling) {
+    if (!request)
+        THROW_IE_EXCEPTION << "The request of the tiled inference is not set";
+    Blob::Ptr tileInput = getRequestBlob(request, inputName);
+    Blob::Ptr tileOutput = getRequestBlob(request, outputName);
+    checkPlanar(image, "image");
+    checkPlanar(result, "result");
+    checkPlanar(tileInput, "inputs of the network");
+    checkPlanar(tileOutput, "outputs of the network");
+
+    const SizeVector &inDims = tileInput->getTensorDesc().getDims();
+    const SizeVector &outDims = tileOutput->getTensorDesc().getDims();
+    const SizeVector &imageDims = image->getTensorDesc().getDims();
+    const SizeVector &resultDims = result->getTensorDesc().getDims();
+    const size_t batch = inDims[0], C = inDims[1], tileH = inDims[2], tileW = inDims[3];
+    const size_t outC = outDims[1], outTileH = outDims[2], outTileW = outDims[3];
+    const size_t N = imageDims[0], H = imageDims[2], W = imageDims[3];
+    const size_t outH = resultDims[2], outW = resultDims[3];
+
+    if (image->getTensorDesc().getPrecision() != tileInput->getTensorDesc().getPrecision() ||
+            result->getTensorDesc().getPrecision() != tileOutput->getTensorDesc().getPrecision())
+        THROW_IE_EXCEPTION << "The precisions of the image and of the result differ from the ones of the network";
+    if (outDims[0] != batch || imageDims[1] != C || resultDims[0] != N || resultDims[1] != outC)
+        THROW_IE_EXCEPTION << "The batch or the channels of the image and of the result don't match the network";
+    if (tileH <= 2 * tiling.haloY || tileW <= 2 * tiling.haloX ||
+            (tileH - 2 * tiling.haloY) % tiling.alignY != 0 || (tileW - 2 * tiling.haloX) % tiling.alignX != 0)
+        THROW_IE_EXCEPTION << "The input of the network " << tileH << "x" << tileW
+                           << " is not a tile of the alignment extended by the halo, see getTileDims";
+    if ((tiling.alignY * outTileH) % tileH != 0 || (tiling.alignX * outTileW) % tileW != 0)
+        THROW_IE_EXCEPTION << "The output of the network " << outTileH << "x" << outTileW
+                           << " is not scaled from its input " << tileH << "x" << tileW << " by the alignment";
+    if (outH != (H * outTileH + tileH - 1) / tileH || outW != (W * outTileW + tileW - 1) / tileW)
+        THROW_IE_EXCEPTION << "The result " << outH << "x" << outW << " is not the image " << H << "x" << W
+                           << " scaled as the tiles are";
+
+    // the positions in the image are mapped to the output by the scale of the tiles
+    auto mapY = [&](size_t y) { return y == H ? outH : y * outTileH / tileH; };
+    auto mapX = [&](size_t x) { return x == W ? outW : x * outTileW / tileW; };
+
+    struct Tile {
+        size_t n;
+        Span y, x;
+    };
+    std::vector<Tile> tiles;
+    const std::vector<Span> rows = splitAxis(H, tileH, tiling.haloY, tiling.alignY);
+    const std::vector<Span> columns = splitAxis(W, tileW, tiling.haloX, tiling.alignX);
+    for (size_t n = 0; n < N; n++) {
+        for (const auto &row : rows) {
+            for (const auto &column : columns)
+                tiles.push_back({n, row, column});
+        }
+    }
+
+    const size_t inElement = image->element_size();
+    const size_t outElement = result->element_size();
+    for (size_t first = 0; first < tiles.size(); first += batch) {
+        const size_t count = std::min(batch, tiles.size() - first);
+        {
+            const uint8_t *src = image->cbuffer().as<const uint8_t *>();
+            uint8_t *dst = tileInput->buffer().as<uint8_t *>();
+            for (size_t b = 0; b < count; b++) {
+                const Tile &tile = tiles[first + b];
+                // the window is filled with zeros beyond the image
+                const size_t cols = tile.x.start < W ? std::min(tileW, W - tile.x.start) : 0;
+                for (size_t c = 0; c < C; c++) {
+                    for (size_t r = 0; r < tileH; r++) {
+                        uint8_t *dstRow = dst + (((b * C + c) * tileH + r) * tileW) * inElement;
+                        const size_t y = tile.y.start + r;
+                        size_t copied = 0;
+                        if (y < H) {
+                            copied = cols;
+                            std::memcpy(dstRow, src + (((tile.n * C + c) * H + y) * W + tile.x.start) * inElement,
+                                        copied * inElement);
+                        }
+                        std::memset(dstRow + copied * inElement, 0, (tileW - copied) * inElement);
+                    }
+                }
+            }
+        }
+
+        ResponseDesc resp;
+        if (request->Infer(&resp) != OK)
+            THROW_IE_EXCEPTION << "The inference of the tiles failed: " << resp.msg;
+
+        const uint8_t *src = tileOutput->cbuffer().as<const uint8_t *>();
+        uint8_t *dst = result->buffer().as<uint8_t *>();
+        for (size_t b = 0; b < count; b++) {
+            const Tile &tile = tiles[first + b];
+            const size_t originY = mapY(tile.y.start), originX = mapX(tile.x.start);
+            const size_t beginY = mapY(tile.y.begin), endY = mapY(tile.y.end);
+            const size_t beginX = mapX(tile.x.begin), endX = mapX(tile.x.end);
+            for (size_t c = 0; c < outC; c++) {
+                for (size_t y = beginY; y < endY; y++) {
+                    std::memcpy(dst + (((tile.n * outC + c) * outH + y) * outW + beginX) * outElement,
+                                src + (((b * outC + c) * outTileH + y - originY) * outTileW + beginX - originX) *
+                                      outElement,
+                                (endX - beginX) * outElement);
+                }
+            }
+        }
+    }
+}
@@ -7,6 +7,7 @@
 #include "graph_tools.hpp"
 #include "caseless.hpp"
 #include "ie_utils.hpp"
+#include "mmap_allocator.hpp"
 
 #include <ie_layers.h>
 
@@ -19,6 +20,8 @@
 #include <memory>
 #include <utility>
 #include <iomanip>
+#include <typeinfo>
+#include <cstring>
 
 namespace InferenceEngine {
 
@@ -103,8 +106,9 @@ DataPtr cloneData(const InferenceEngine::Data& source) {
 
 namespace {
 template<typename T>
-CNNLayerPtr layerCloneImpl(const CNNLayer* source) {
-    auto layer = dynamic_cast<const T*>(source);
+CNNLayerPtr layerCloneImpl(const CNNLayer* source, bool exactType) {
+    auto layer = exactType ? (typeid(*source) == typeid(T) ? static_cast<const T*>(source) : nullptr)
+                           : dynamic_cast<const T*>(source);
     if (nullptr != layer) {
         auto newLayer = std::make_shared<T>(*layer);
         newLayer->_fusedWith = nullptr;
@@ -118,7 +122,7 @@ CNNLayerPtr layerCloneImpl(const CNNLayer* source) {
 }  // namespace
 
 CNNLayerPtr clonelayer(const CNNLayer& source) {
-    using fptr = CNNLayerPtr (*)(const CNNLayer*);
+    using fptr = CNNLayerPtr (*)(const CNNLayer*, bool);
     // Most derived layers must go first in this list
     static const fptr cloners[] = {
         &layerCloneImpl<BatchNormalizationLayer>,
@@ -144,10 +148,14 @@ CNNLayerPtr clonelayer(const CNNLayer& source) {
         &layerCloneImpl<WeightableLayer        >,
         &layerCloneImpl<CNNLayer               >
     };
-    for (auto cloner : cloners) {
-        auto cloned = cloner(&source);
-        if (nullptr != cloned) {
-            return cloned;
+    // the comparison of the exact types is cheap and finds almost every layer, the dynamic casts
+    // are left for the layer types derived from the listed ones
+    for (bool exactType : {true, false}) {
+        for (auto cloner : cloners) {
+            auto cloned = cloner(&source, exactType);
+            if (nullptr != cloned) {
+                return cloned;
+            }
         }
     }
     assert(!"All layers derived from CNNLayer so we must never get here");
@@ -157,7 +165,8 @@ CNNLayerPtr clonelayer(const CNNLayer& source) {
 details::CNNNetworkImplPtr cloneNet(const ICNNNetwork &network) {
     std::vector<CNNLayerPtr> layers;
     details::CNNNetworkIterator i(const_cast<ICNNNetwork *>(&network));
-    while (i != details::CNNNetworkIterator()) {
+    const details::CNNNetworkIterator end;
+    while (i != end) {
         layers.push_back(*i);
         i++;
     }
@@ -196,15 +205,26 @@ details::CNNNetworkImplPtr cloneNet(const std::vector<CNNLayerPtr>& layers,
     // llvm::function_ref-like lightweight callable when we add one
     auto net = std::make_shared<InferenceEngine::details::CNNNetworkImpl>();
 
+    // The set of the cloned layers, the lookup of the consumers in it keeps the cloning linear in the size of the net
+    std::unordered_set<const CNNLayer*> layersSet;
+    layersSet.reserve(layers.size());
+    for (auto&& layer : layers) {
+        layersSet.insert(layer.get());
+    }
+
     // Src to cloned data map
     std::unordered_map<InferenceEngine::DataPtr, InferenceEngine::DataPtr> dataMap;
     // Cloned to src data map
     std::unordered_map<InferenceEngine::DataPtr, InferenceEngine::DataPtr> clonedDataMap;
     std::vector<InferenceEngine::DataPtr> clonedDatas;
+    dataMap.reserve(2 * layers.size());
+    clonedDataMap.reserve(2 * layers.size());
+    clonedDatas.reserve(2 * layers.size());
 
     auto createDataImpl = [&](const InferenceEngine::DataPtr& data) {
         assert(nullptr != data);
-        if (!contains(dataMap, data)) {
+        auto it = dataMap.find(data);
+        if (it == dataMap.end()) {
             auto clonedData = cloneData(*data);
             dataMap[data] = clonedData;
             clonedDataMap[clonedData] = data;
@@ -212,7 +232,7 @@ details::CNNNetworkImplPtr cloneNet(const std::vector<CNNLayerPtr>& layers,
             net->getData(clonedData->getName()) = clonedData;
             return clonedData;
         }
-        return dataMap[data];
+        return it->second;
     };
 
     auto cloneLayerImpl = [&](const CNNLayer &srcLayer) {
@@ -249,8 +269,8 @@ details::CNNNetworkImplPtr cloneNet(const std::vector<CNNLayerPtr>& layers,
             clonedData->getCreatorLayer() = clonedLayer;
             clonedLayer->outData.push_back(clonedData);
             for (auto&& inp : data->getInputTo()) {
-                auto layer = inp.second;
-                if (std::find(layers.begin(), layers.end(), layer) == layers.end() &&
+                auto& layer = inp.second;
+                if (!contains(layersSet, layer.get()) &&
                     !(CaselessEq<std::string>()(layer->type, "priorbox") ||
                       CaselessEq<std::string>()(layer->type, "PriorBoxClustered"))) {
                     net->addOutput(data->getName());
@@ -570,4 +590,193 @@ std::unordered_set<DataPtr> getRootDataObjects(ICNNNetwork &network) {
     return ret;
 }
 
+namespace {
+
+// the content of the network is given to Impl::addBytes() and the blobs to Impl::addBlob()
+template <typename Impl>
+struct NetworkVisitor {
+    void add(const void *data, size_t size) {
+        static_cast<Impl *>(this)->addBytes(data, size);
+    }
+    void add(const std::string &str) {
+        // the size separates the neighbour strings
+        add(str.size());
+        add(str.data(), str.size());
+    }
+    void add(size_t value) {
+        add(&value, sizeof(value));
+    }
+    void add(float value) {
+        add(&value, sizeof(value));
+    }
+    void add(const Blob::CPtr &blob) {
+        add(static_cast<size_t>(blob != nullptr));
+        if (blob) {
+            add(blob->byteSize());
+            static_cast<Impl *>(this)->addBlob(blob);
+        }
+    }
+    void add(const DataPtr &data) {
+        add(static_cast<size_t>(data != nullptr));
+        if (data) {
+            add(data->getName());
+            add(std::string(data->getPrecision().name()));
+            add(static_cast<size_t>(data->getLayout()));
+            add(data->getDims().size());
+            for (auto dim : data->getDims()) add(dim);
+        }
+    }
+};
+
+// FNV-1a over 64-bit words, the tail is processed byte by byte
+struct NetworkHasher : NetworkVisitor<NetworkHasher> {
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    void addBytes(const void *data, size_t size) {
+        auto bytes = reinterpret_cast<const uint8_t *>(data);
+        size_t words = size / sizeof(uint64_t);
+        for (size_t i = 0; i < words; i++) {
+            uint64_t word;
+            memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+            hash = (hash ^ word) * prime;
+        }
+        for (size_t i = words * sizeof(uint64_t); i < size; i++) {
+            hash = (hash ^ bytes[i]) * prime;
+        }
+    }
+    void addBlob(const Blob::CPtr &blob) {
+        addBytes(blob->cbuffer(), blob->byteSize());
+    }
+};
+
+struct NetworkRecorder : NetworkVisitor<NetworkRecorder> {
+    NetworkContent content;
+
+    void addBytes(const void *data, size_t size) {
+        content.description.append(reinterpret_cast<const char *>(data), size);
+    }
+    void addBlob(const Blob::CPtr &blob) {
+        content.blobs.push_back(blob);
+    }
+};
+
+template <typename Visitor>
+void visitNetwork(const ICNNNetwork &network, Visitor &visitor) {
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    bool hasLayers = !inputs.empty();
+    for (auto &input : inputs) {
+        visitor.add(input.first);
+        if (!input.second || !input.second->getInputData()) {
+            hasLayers = false;
+            continue;
+        }
+        visitor.add(std::string(input.second->getInputPrecision().name()));
+        visitor.add(input.second->getInputData());
+
+        const PreProcessInfo &preProcess = input.second->getPreProcess();
+        visitor.add(static_cast<size_t>(preProcess.getMeanVariant()));
+        visitor.add(static_cast<size_t>(preProcess.getResizeAlgorithm()));
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            visitor.add(preProcess[c]->stdScale);
+            visitor.add(preProcess[c]->meanValue);
+            visitor.add(Blob::CPtr(preProcess[c]->meanData));
+        }
+    }
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    for (auto &output : outputs) {
+        visitor.add(output.first);
+        visitor.add(output.second);
+    }
+
+    // the network without the data of the inputs has no layers to walk through
+    if (!hasLayers)
+        return;
+
+    for (auto &layer : CNNNetSortTopologically(network)) {
+        visitor.add(layer->name);
+        visitor.add(layer->type);
+        visitor.add(std::string(layer->precision.name()));
+        visitor.add(layer->affinity);
+        for (auto &param : layer->params) {
+            visitor.add(param.first);
+            visitor.add(param.second);
+        }
+        for (auto &data : layer->insData) {
+            visitor.add(data.lock());
+        }
+        for (auto &data : layer->outData) {
+            visitor.add(data);
+        }
+        for (auto &blob : layer->blobs) {
+            visitor.add(blob.first);
+            visitor.add(Blob::CPtr(blob.second));
+        }
+    }
+}
+
+}  // namespace
+
+static void checkBlob(const Blob::Ptr &blob, const std::string &owner) {
+    if (!blob || blob->byteSize() == 0 || blob->cbuffer() != nullptr)
+        return;
+    auto segment = dynamic_cast<const FileSegmentSource *>(blob.get());
+    std::string error = segment ? segment->getReadError() : std::string();
+    THROW_IE_EXCEPTION << "Cannot read the data of " << owner << (error.empty() ? "" : ". ") << error;
+}
+
+void checkNetworkBlobs(const ICNNNetwork &network) {
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    bool hasLayers = !inputs.empty();
+    for (auto &input : inputs) {
+        if (!input.second || !input.second->getInputData()) {
+            hasLayers = false;
+            continue;
+        }
+        const PreProcessInfo &preProcess = input.second->getPreProcess();
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            checkBlob(preProcess[c]->meanData, "the mean image of the input " + input.first);
+        }
+    }
+
+    // the network without the data of the inputs has no layers to walk through
+    if (!hasLayers)
+        return;
+
+    for (auto &layer : CNNNetSortTopologically(network)) {
+        for (auto &blob : layer->blobs) {
+            checkBlob(blob.second, "the blob " + blob.first + " of the layer " + layer->name);
+        }
+    }
+}
+
+uint64_t hashNetwork(const ICNNNetwork &network) {
+    NetworkHasher hasher;
+    visitNetwork(network, hasher);
+    return hasher.hash;
+}
+
+NetworkContent recordNetwork(const ICNNNetwork &network) {
+    NetworkRecorder recorder;
+    visitNetwork(network, recorder);
+    return recorder.content;
+}
+
+bool NetworkContent::operator==(const NetworkContent &other) const {
+    if (description != other.description || blobs.size() != other.blobs.size())
+        return false;
+    for (size_t i = 0; i < blobs.size(); i++) {
+        // the sizes of the blobs are a part of the description
+        const void *data = blobs[i]->cbuffer();
+        const void *otherData = other.blobs[i]->cbuffer();
+        if (data != otherData && memcmp(data, otherData, blobs[i]->byteSize()) != 0)
+            return false;
+    }
+    return true;
+}
+
 }  // namespace InferenceEngine
@@ -6,6 +6,7 @@
 #ifndef IE_UTIL_HPP
 #define IE_UTIL_HPP
 
+#include <cstdint>
 #include <vector>
 #include <functional>
 #include <deque>
@@ -76,7 +77,9 @@ cloneNet(const std::vector<InferenceEngine::CNNLayerPtr>& layers,
 /**
  * Clones the whole network. All layers and data objects will be cloned
  *
- * Blobs inside layers are reused
+ * Blobs inside layers are reused: the clone shares the weights with the source network by the pointers,
+ * so the cost of the cloning does not depend on the size of the weights. A layer which modifies its blobs
+ * in place must replace them by the copies first, otherwise the change is visible in both networks
  * */
 INFERENCE_ENGINE_API_CPP(InferenceEngine::details::CNNNetworkImplPtr)
 cloneNet(const InferenceEngine::ICNNNetwork &network);
@@ -93,14 +96,15 @@ template<class T>
 void traverse(T& inputs,
               std::function<void(InferenceEngine::CNNLayerPtr& layer)> apply,
               std::function<void(const InferenceEngine::CNNLayerPtr& layer, std::deque<InferenceEngine::CNNLayerPtr>& layers)> expand = forward) {
-    std::unordered_set<InferenceEngine::CNNLayerPtr> visitedObjects;
+    // the layers are owned by the network, the raw pointers save the reference counting of the hash set
+    std::unordered_set<InferenceEngine::CNNLayer*>   visitedObjects;
     std::deque<InferenceEngine::CNNLayerPtr>         layersToCheck;
 
     layersToCheck.insert(layersToCheck.end(), inputs.begin(), inputs.end());
 
     while (!layersToCheck.empty()) {
         auto& layer = layersToCheck.front();
-        if (visitedObjects.insert(layer).second) {
+        if (visitedObjects.insert(layer.get()).second) {
             apply(layer);
             expand(layer, layersToCheck);
         }
@@ -140,6 +144,47 @@ INFERENCE_ENGINE_API_CPP(void) saveGraphToDot(InferenceEngine::ICNNNetwork &netw
 INFERENCE_ENGINE_API_CPP(std::unordered_set<DataPtr>)
 getRootDataObjects(ICNNNetwork &network);
 
+/**
+  @brief Throws if the data of a blob of a layer or of the mean image of an input cannot be read, e.g. the weights
+  read from the file on the first access, the exception tells the failed read
+
+  @param network - network to process
+  */
+INFERENCE_ENGINE_API_CPP(void) checkNetworkBlobs(const ICNNNetwork &network);
+
+/**
+  @brief Returns the hash of the content of the network: the inputs with their precisions and preprocessing,
+  the outputs, the layers with their parameters, affinities, data and blobs. The networks read from the same IR
+  and configured the same way have the same hash.
+
+  @param network - network to process
+
+  @return hash of the network
+  */
+INFERENCE_ENGINE_API_CPP(uint64_t) hashNetwork(const ICNNNetwork &network);
+
+/**
+  @brief The content of the network hashed by hashNetwork(), the blobs of the network are held, not copied
+  */
+struct INFERENCE_ENGINE_API_CLASS(NetworkContent) {
+    std::string description;
+    std::vector<Blob::CPtr> blobs;
+
+    /**
+      @brief Compares the descriptions and the data of the blobs byte by byte
+      */
+    bool operator==(const NetworkContent &other) const;
+};
+
+/**
+  @brief Returns the content of the network hashed by hashNetwork() to compare the networks of the same hash
+
+  @param network - network to process
+
+  @return content of the network
+  */
+INFERENCE_ENGINE_API_CPP(NetworkContent) recordNetwork(const ICNNNetwork &network);
+
 }  // namespace InferenceEngine
 
 #endif  // IE_UTIL_HPP
@@ -0,0 +1,208 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief The named items stored in the order of their insertion and addressed by the index,
+ * the index of a name is kept in the hash map aside.
+ * @details The interface follows the one of std::map, the iteration gives the pairs of the name and the item.
+ * The items are kept in std::deque: the references to them stay valid when the items are added.
+ * The erased items are marked and skipped, the marked slots are dropped at once when they outnumber the others,
+ * so the erase is O(1) amortized. Only this compaction invalidates the references and shifts the indices.
+ * @tparam T - type of the item
+ */
+template<typename T>
+class IndexedMap {
+public:
+    using key_type = std::string;
+    using mapped_type = T;
+    using value_type = std::pair<const std::string, T>;
+
+private:
+    struct Slot {
+        Slot(const std::string& name, T&& item) : value(name, std::move(item)), erased(false) {}
+        Slot(Slot&& other) : value(std::move(other.value)), erased(other.erased) {}
+
+        value_type value;
+        bool erased;
+    };
+
+    /**
+     * @brief The forward iterator over the slots which are not erased
+     */
+    template<typename SlotIterator, typename Value>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator(SlotIterator it, SlotIterator end) : _it(it), _end(end) {
+            skipErased();
+        }
+
+        reference operator*() const { return _it->value; }
+        pointer operator->() const { return &_it->value; }
+
+        Iterator& operator++() {
+            ++_it;
+            skipErased();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator it = *this;
+            ++*this;
+            return it;
+        }
+
+        bool operator==(const Iterator& other) const { return _it == other._it; }
+        bool operator!=(const Iterator& other) const { return _it != other._it; }
+
+    private:
+        void skipErased() {
+            while (_it != _end && _it->erased)
+                ++_it;
+        }
+
+        SlotIterator _it;
+        SlotIterator _end;
+    };
+
+public:
+    using iterator = Iterator<typename std::deque<Slot>::iterator, value_type>;
+    using const_iterator = Iterator<typename std::deque<Slot>::const_iterator, const value_type>;
+
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief Returns the item of the name, the default one is added if there is no such item
+     */
+    T& operator[](const std::string& name) {
+        auto it = _index.find(name);
+        if (it != _index.end())
+            return _slots[it->second].value.second;
+        _index.emplace(name, _slots.size());
+        _slots.emplace_back(name, T());
+        return _slots.back().value.second;
+    }
+
+    /**
+     * @brief Returns the index of the name or npos if there is no such item
+     */
+    size_t indexOf(const std::string& name) const {
+        auto it = _index.find(name);
+        return it == _index.end() ? npos : it->second;
+    }
+
+    T& at(size_t index) {
+        return slotAt(index).value.second;
+    }
+
+    const T& at(size_t index) const {
+        return slotAt(index).value.second;
+    }
+
+    iterator find(const std::string& name) {
+        size_t index = indexOf(name);
+        return index == npos ? end() : iterator(_slots.begin() + index, _slots.end());
+    }
+
+    const_iterator find(const std::string& name) const {
+        size_t index = indexOf(name);
+        return index == npos ? end() : const_iterator(_slots.begin() + index, _slots.end());
+    }
+
+    size_t count(const std::string& name) const {
+        return _index.count(name);
+    }
+
+    size_t size() const noexcept {
+        return _index.size();
+    }
+
+    bool empty() const noexcept {
+        return _index.empty();
+    }
+
+    void clear() noexcept {
+        _slots.clear();
+        _index.clear();
+    }
+
+    /**
+     * @brief Removes the item of the name, the order of the others is kept
+     * @return The number of the removed items
+     */
+    size_t erase(const std::string& name) {
+        auto it = _index.find(name);
+        if (it == _index.end())
+            return 0;
+        Slot& slot = _slots[it->second];
+        _index.erase(it);
+        // the item is released right away, only the slot is kept till the compaction
+        slot.value.second = T();
+        slot.erased = true;
+        if (_slots.size() > 2 * _index.size())
+            compact();
+        return 1;
+    }
+
+    iterator begin() noexcept { return iterator(_slots.begin(), _slots.end()); }
+    iterator end() noexcept { return iterator(_slots.end(), _slots.end()); }
+    const_iterator begin() const noexcept { return const_iterator(_slots.begin(), _slots.end()); }
+    const_iterator end() const noexcept { return const_iterator(_slots.end(), _slots.end()); }
+
+private:
+    Slot& slotAt(size_t index) {
+        Slot& slot = _slots.at(index);
+        if (slot.erased)
+            throw std::out_of_range("IndexedMap: the item of the index is erased");
+        return slot;
+    }
+
+    const Slot& slotAt(size_t index) const {
+        const Slot& slot = _slots.at(index);
+        if (slot.erased)
+            throw std::out_of_range("IndexedMap: the item of the index is erased");
+        return slot;
+    }
+
+    void compact() {
+        // the names are const, so the items are moved to the new deque rather than shifted in place
+        std::deque<Slot> slots;
+        for (auto& slot : _slots) {
+            if (slot.erased)
+                continue;
+            _index[slot.value.first] = slots.size();
+            slots.emplace_back(std::move(slot));
+        }
+        _slots.swap(slots);
+    }
+
+    std::deque<Slot> _slots;
+    std::unordered_map<std::string, size_t> _index;
+};
+
+template<typename T>
+constexpr size_t IndexedMap<T>::npos;
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -8,12 +8,14 @@
 #include "details/ie_exception.hpp"
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace InferenceEngine {
 
-MemorySolver::MemorySolver(const std::vector<Box> boxes) : _boxes(boxes) {
+MemorySolver::MemorySolver(const std::vector<Box> boxes, Strategy strategy) : _boxes(boxes), _strategy(strategy) {
     int max_ts = 0;
     for (const Box &box : _boxes) max_ts = std::max(std::max(max_ts, box.start), box.finish);
     for (Box &box : _boxes) if (box.finish == -1) box.finish = max_ts;
@@ -52,7 +54,76 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
     }
 }
 
+static inline bool liveTogether(const MemorySolver::Box &l, const MemorySolver::Box &r) {
+    return l.start <= r.finish && r.start <= l.finish;
+}
+
+/**
+ * Places the boxes one by one in the given order, each one to the smallest gap between the boxes
+ * already placed during its live time, or on top of them if there is no such a gap.
+ */
+static int placeBestFit(const std::vector<MemorySolver::Box> &boxes, std::map<int, int> &offsets) {
+    std::vector<std::pair<const MemorySolver::Box*, int>> placed;
+    placed.reserve(boxes.size());
+    std::vector<std::pair<int, int>> busy;
+
+    int min_required = 0;
+    for (const auto &box : boxes) {
+        busy.clear();
+        for (const auto &p : placed)
+            if (liveTogether(box, *p.first))
+                busy.emplace_back(p.second, p.second + p.first->size);
+        std::sort(busy.begin(), busy.end());
+
+        int offset = -1;
+        int best_gap = std::numeric_limits<int>::max();
+        int free_from = 0;
+        for (const auto &b : busy) {
+            int gap = b.first - free_from;
+            if (gap >= box.size && gap < best_gap) {
+                offset = free_from;
+                best_gap = gap;
+            }
+            free_from = std::max(free_from, b.second);
+        }
+        if (offset == -1) offset = free_from;
+
+        placed.emplace_back(&box, offset);
+        offsets[box.id] = offset;
+        min_required = std::max(min_required, offset + box.size);
+    }
+    return min_required;
+}
+
 int MemorySolver::solve() {
+    if (_strategy == Greedy)
+        return solveGreedy();
+
+    const std::vector<Box> boxes = _boxes;
+    int min_required = solveGreedy();
+    _boxes = boxes;
+
+    // biggest first (the longest lived of the same size go first) and in the execution order
+    std::vector<std::vector<Box>> orders(2, boxes);
+    std::stable_sort(orders[0].begin(), orders[0].end(), [](const Box& l, const Box& r) {
+        return l.size > r.size || (l.size == r.size && l.finish - l.start > r.finish - r.start);
+    });
+    std::stable_sort(orders[1].begin(), orders[1].end(), [](const Box& l, const Box& r) {
+        return l.start < r.start || (l.start == r.start && l.size > r.size);
+    });
+
+    for (const auto &order : orders) {
+        std::map<int, int> offsets;
+        int required = placeBestFit(order, offsets);
+        if (required < min_required) {
+            min_required = required;
+            _offsets = offsets;
+        }
+    }
+    return min_required;
+}
+
+int MemorySolver::solveGreedy() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
@@ -64,7 +64,18 @@ public:
         int id;
     };
 
-    explicit MemorySolver(const std::vector<Box> boxes);
+    /** @brief The way the boxes are placed on the Mem axis */
+    enum Strategy {
+        /** The biggest boxes are placed first, each one at the lowest offset free during its live time */
+        Greedy,
+        /**
+         * Each box is placed to the smallest gap it fits into (best-fit). Several orders of the boxes are tried
+         * and the smallest solution is kept, it is never worse than the Greedy one.
+         */
+        BestFit
+    };
+
+    explicit MemorySolver(const std::vector<Box> boxes, Strategy strategy = Greedy);
 
     /**
      * @brief Solve memory location with maximal reuse.
@@ -75,19 +86,24 @@ public:
     /** Provides calculated offset for specified box id */
     int getOffset(int id) const;
 
-    /** Additional info. Max sum of box sizes required for any time stamp. */
+    /**
+     * Additional info. Max sum of box sizes required for any time stamp.
+     * It is the lower bound of the solve() result.
+     */
     int maxDepth();
     /** Additional info. Max num of boxes required for any time stamp. */
     int maxTopDepth();
 
 private:
     std::vector<Box> _boxes;
+    Strategy _strategy;
     std::map<int, int> _offsets;
     int _top_depth = -1;
     int _depth = -1;
     int _time_duration = -1;
 
     void calcDepth();
+    int solveGreedy();
 };
 
 }  // namespace InferenceEngine
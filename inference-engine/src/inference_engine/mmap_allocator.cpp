@@ -0,0 +1,175 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_allocator.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+
+void * MmapAllocator::alloc(size_t size) noexcept {
+    if (_data != nullptr || size == 0)
+        return nullptr;
+
+    HANDLE file = CreateFileA(_fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || static_cast<unsigned long long>(fileSize.QuadPart) < size) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    // the mapping object keeps the file open
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        return nullptr;
+
+    void *data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        return nullptr;
+    }
+
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+    // the pages are read in the background while the network is compiled, see the POSIX version
+    WIN32_MEMORY_RANGE_ENTRY range = {data, size};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif
+
+    _mapping = mapping;
+    _data = data;
+    _size = size;
+    return _data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || handle != _data)
+        return false;
+
+    UnmapViewOfFile(_data);
+    CloseHandle(_mapping);
+    _mapping = nullptr;
+    _data = nullptr;
+    _size = 0;
+    return true;
+}
+
+#else
+
+void * MmapAllocator::alloc(size_t size) noexcept {
+    if (_data != nullptr || size == 0)
+        return nullptr;
+
+    int fd = open(_fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat sb;
+    if (fstat(fd, &sb) != 0 || static_cast<unsigned long long>(sb.st_size) < size) {
+        close(fd);
+        return nullptr;
+    }
+
+    // the mapping keeps the file referenced after the descriptor is closed
+    void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+
+#if defined(POSIX_FADV_WILLNEED)
+    // the kernel starts reading the file to the page cache and returns at once, so the weights stream in while
+    // the plugin compiles the network from the topology, the first access to a page not read yet waits for it
+    posix_fadvise(fd, 0, static_cast<off_t>(size), POSIX_FADV_WILLNEED);
+#endif
+    close(fd);
+
+    _data = data;
+    _size = size;
+    return _data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || handle != _data)
+        return false;
+
+    munmap(_data, _size);
+    _data = nullptr;
+    _size = 0;
+    return true;
+}
+
+#endif
+
+void * FileSegmentAllocator::alloc(size_t size) noexcept {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_allocated || size == 0)
+        return nullptr;
+    _allocated = true;
+    _size = size;
+    // the handle is only compared with the one passed to lock and free
+    return this;
+}
+
+void * FileSegmentAllocator::lock(void * handle, InferenceEngine::LockOp) noexcept {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (handle != this || !_allocated)
+        return nullptr;
+    if (!_read) {
+        try {
+            _buffer.resize(_size);
+            errno = 0;
+            std::ifstream file(_fileName, std::ios::binary | std::ios::in);
+            if (!file.is_open() || !file.seekg(static_cast<std::streamoff>(_offset)) ||
+                    !file.read(_buffer.data(), _size)) {
+                const int readErrno = errno;
+                std::stringstream error;
+                error << "Cannot read " << _size << " bytes at the offset " << _offset << " of the file " << _fileName
+                      << ": " << (readErrno != 0 ? strerror(readErrno) : "the file is too short");
+                _error = error.str();
+                std::vector<char>().swap(_buffer);
+                return nullptr;
+            }
+        } catch (...) {
+            std::vector<char>().swap(_buffer);
+            return nullptr;
+        }
+        _read = true;
+        _error.clear();
+    }
+    return _buffer.data();
+}
+
+bool FileSegmentAllocator::free(void* handle) noexcept {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (handle != this || !_allocated)
+        return false;
+    std::vector<char>().swap(_buffer);
+    _allocated = false;
+    _read = false;
+    _size = 0;
+    return true;
+}
+
+std::string FileSegmentAllocator::getError() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _error;
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ie_allocator.hpp"
+#include "ie_blob.h"
+#include "details/ie_irelease.hpp"
+
+/**
+ * @brief The allocator which maps the file to the memory instead of reading it. The mapping is private:
+ * the pages are read on the first access and shared through the page cache by all the processes which map
+ * the same file, the pages which are written are copied for the process and never reach the file.
+ * The file must not be changed while the blob is alive. The reading of the whole file is started in the background
+ * when it is mapped, so the load of the network overlaps with it and waits only for the pages it touches.
+ */
+class MmapAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit MmapAllocator(const std::string &fileName) : _fileName(fileName) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    /**
+     * @brief Maps the first size bytes of the file, returns nullptr if the file is smaller or cannot be mapped
+     */
+    void * alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    std::string _fileName;
+    void *_data = nullptr;
+    size_t _size = 0;
+#if defined(_WIN32)
+    void *_mapping = nullptr;
+#endif
+};
+
+/**
+ * @brief The allocator of the blob of a segment of the file, the segment is read on the first lock.
+ * It is used for the weights of a layer when the file cannot be mapped, the weights which are never read
+ * are not loaded. The lock which cannot read the segment returns nullptr and keeps the reason for getError().
+ */
+class FileSegmentAllocator : public InferenceEngine::IAllocator {
+public:
+    FileSegmentAllocator(const std::string &fileName, size_t offset) : _fileName(fileName), _offset(offset) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    /**
+     * @brief Reads the segment on the first call, returns nullptr if it cannot be read
+     */
+    void * lock(void * handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override;
+
+    void unlock(void * a) noexcept override {}
+
+    /**
+     * @brief Keeps the size of the segment, the memory is allocated by the first lock
+     */
+    void * alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @brief The reason of the last failed read of the segment, empty if it has not failed
+     */
+    std::string getError();
+
+private:
+    std::string _fileName;
+    size_t _offset;
+    size_t _size = 0;
+    bool _allocated = false;
+    bool _read = false;
+    std::vector<char> _buffer;
+    std::string _error;
+    std::mutex _mutex;
+};
+
+/**
+ * @brief The data read from a segment of the file on the first access
+ */
+class FileSegmentSource {
+public:
+    virtual ~FileSegmentSource() = default;
+
+    /**
+     * @brief The reason of the last failed read of the segment, empty if it has not failed
+     */
+    virtual std::string getReadError() const = 0;
+};
+
+/**
+ * @brief The blob of a segment of the file read by FileSegmentAllocator, checkNetworkBlobs() reports its failed
+ * read from LoadNetwork
+ */
+template <typename T>
+class FileSegmentBlob : public InferenceEngine::TBlob<T>, public FileSegmentSource {
+public:
+    FileSegmentBlob(InferenceEngine::Precision p, InferenceEngine::Layout l, const InferenceEngine::SizeVector &dims,
+                    const std::string &fileName, size_t offset)
+            : InferenceEngine::TBlob<T>(p, l, dims, InferenceEngine::details::shared_from_irelease(
+                    new FileSegmentAllocator(fileName, offset))) {}
+
+    std::string getReadError() const override {
+        return static_cast<FileSegmentAllocator *>(this->getAllocator().get())->getError();
+    }
+};
@@ -6,7 +6,9 @@
 #pragma once
 
 #include <ie_icnn_network.hpp>
+#include <string>
 #include "cnn_network_impl.hpp"
+#include "file_utils.h"
 
 namespace pugi {
 class xml_node;
@@ -20,6 +22,17 @@ struct IFormatParser {
     virtual CNNNetworkImplPtr Parse(pugi::xml_node &root) = 0;
 
     virtual void SetWeights(const TBlob<uint8_t>::Ptr &weights) = 0;
+
+    /**
+     * @brief Sets the weights of the file which cannot be mapped to the memory, the parser may read only the
+     * weights which are used
+     */
+    virtual void SetWeightsFile(const std::string &filepath, size_t size) {
+        TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>(Precision::U8, C, {size}));
+        weights->allocate();
+        FileUtils::readAllFile(filepath, weights->buffer(), size);
+        SetWeights(weights);
+    }
 };
 }  // namespace details
 }  // namespace InferenceEngine
@@ -0,0 +1,134 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pooled_allocator.hpp"
+#include <cstdlib>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+constexpr size_t PooledMemoryAllocator::alignment;
+constexpr size_t PooledMemoryAllocator::hugePageSize;
+constexpr size_t PooledMemoryAllocator::defaultMaxCachedBytes;
+
+namespace {
+
+// the header occupies the first cache line of the block, so the data that follow it keep the alignment
+struct BlockHeader {
+    void *base;
+    size_t capacity;
+};
+
+static_assert(sizeof(BlockHeader) <= PooledMemoryAllocator::alignment, "The block header must fit the alignment");
+
+BlockHeader *getHeader(void *handle) {
+    return reinterpret_cast<BlockHeader *>(static_cast<char *>(handle) - PooledMemoryAllocator::alignment);
+}
+
+}  // namespace
+
+PooledMemoryAllocator::~PooledMemoryAllocator() {
+    for (auto &sizeClassBlocks : _freeBlocks) {
+        for (void *handle : sizeClassBlocks.second)
+            freeBlock(handle);
+    }
+}
+
+size_t PooledMemoryAllocator::sizeClass(size_t size) {
+    if (size <= alignment)
+        return alignment;
+    size_t lowerPowerOfTwo = alignment;
+    while (lowerPowerOfTwo * 2 < size)
+        lowerPowerOfTwo *= 2;
+    size_t step = lowerPowerOfTwo / 4;
+    return (size + step - 1) / step * step;
+}
+
+size_t PooledMemoryAllocator::cachedBytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _cachedBytes;
+}
+
+void *PooledMemoryAllocator::alloc(size_t size) noexcept {
+    size_t capacity = sizeClass(size);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto sizeClassBlocks = _freeBlocks.find(capacity);
+        if (sizeClassBlocks != _freeBlocks.end() && !sizeClassBlocks->second.empty()) {
+            void *handle = sizeClassBlocks->second.back();
+            sizeClassBlocks->second.pop_back();
+            _cachedBytes -= capacity;
+            return handle;
+        }
+    }
+    return allocBlock(capacity);
+}
+
+bool PooledMemoryAllocator::free(void *handle) noexcept {
+    if (handle == nullptr)
+        return true;
+    size_t capacity = getHeader(handle)->capacity;
+    try {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_cachedBytes + capacity <= _maxCachedBytes) {
+            _freeBlocks[capacity].push_back(handle);
+            _cachedBytes += capacity;
+            return true;
+        }
+    } catch (...) {
+        // the block which cannot be kept is released
+    }
+    freeBlock(handle);
+    return true;
+}
+
+void *PooledMemoryAllocator::allocBlock(size_t capacity) noexcept {
+    const bool useHugePages = _hugePages && capacity >= hugePageSize;
+    const size_t blockAlignment = useHugePages ? hugePageSize : alignment;
+    const size_t blockSize = capacity + alignment;
+    if (blockSize < capacity)
+        return nullptr;
+
+    void *base = nullptr;
+#if defined(_WIN32)
+    base = _aligned_malloc(blockSize, blockAlignment);
+#else
+    if (posix_memalign(&base, blockAlignment, blockSize) != 0)
+        base = nullptr;
+#endif
+    if (base == nullptr)
+        return nullptr;
+
+#if defined(MADV_HUGEPAGE)
+    // the advice is ignored if the transparent huge pages are disabled, the memory is usable anyway
+    if (useHugePages)
+        madvise(base, blockSize, MADV_HUGEPAGE);
+#endif
+
+    BlockHeader *header = static_cast<BlockHeader *>(base);
+    header->base = base;
+    header->capacity = capacity;
+    return static_cast<char *>(base) + alignment;
+}
+
+void PooledMemoryAllocator::freeBlock(void *handle) noexcept {
+    void *base = getHeader(handle)->base;
+#if defined(_WIN32)
+    _aligned_free(base);
+#else
+    std::free(base);
+#endif
+}
+
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreatePooledAllocator(bool hugePages) noexcept {
+    try {
+        return new PooledMemoryAllocator(hugePages);
+    }catch (...) {
+        return nullptr;
+    }
+}
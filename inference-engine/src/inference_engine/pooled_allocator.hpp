@@ -0,0 +1,73 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "ie_allocator.hpp"
+
+/**
+ * @brief The allocator which keeps the freed blocks for the next allocations of the same size class instead of
+ * returning them to the system, so the blobs of the requests created and destroyed again and again reuse the pages
+ * which are already mapped. The blocks are aligned to the cache line, the blocks of the huge page size or larger
+ * are aligned to the huge page and advised to be backed by the transparent huge pages if it is enabled.
+ * The allocator is thread-safe, the blobs hold it until they are destroyed.
+ */
+class PooledMemoryAllocator : public InferenceEngine::IAllocator {
+public:
+    static constexpr size_t alignment = 64;
+    static constexpr size_t hugePageSize = 2 * 1024 * 1024;
+    static constexpr size_t defaultMaxCachedBytes = 512 * 1024 * 1024;
+
+    explicit PooledMemoryAllocator(bool hugePages = false, size_t maxCachedBytes = defaultMaxCachedBytes)
+            : _hugePages(hugePages), _maxCachedBytes(maxCachedBytes) {}
+
+    ~PooledMemoryAllocator() override;
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    /**
+     * @brief Takes the block of the size class of size from the pool or allocates the new one
+     */
+    void * alloc(size_t size) noexcept override;
+
+    /**
+     * @brief Returns the block to the pool, the block is released if the pool already keeps maxCachedBytes
+     */
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @brief The size of the blocks which serve the allocations of the given size, the sizes between the
+     * neighbouring powers of two are split into four classes, so at most a quarter of the block is wasted
+     */
+    static size_t sizeClass(size_t size);
+
+    /**
+     * @brief The number of bytes in the freed blocks kept by the pool
+     */
+    size_t cachedBytes() const;
+
+private:
+    void *allocBlock(size_t capacity) noexcept;
+    static void freeBlock(void *handle) noexcept;
+
+    const bool _hugePages;
+    const size_t _maxCachedBytes;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<size_t, std::vector<void *>> _freeBlocks;  // the free blocks per size class
+    size_t _cachedBytes = 0;
+};
@@ -5,34 +5,238 @@
 
 #include "precision_utils.h"
 #include <stdint.h>
+#include <algorithm>
 #include <details/ie_exception.hpp>
 #include <ie_blob.h>
+#include <ie_parallel.hpp>
 #include <emmintrin.h>
 #include <nmmintrin.h>
 #include "inference_engine.hpp"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+// the wider vectors are compiled for their ISA only and are called after the check of the CPU
+#define IE_PRECISION_UTILS_DISPATCH
+#endif
+
 using namespace InferenceEngine;
 
+// Function to convert F32 into F16
+// F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
+// F16: exp_bias:15  SEEEEEMM MMMMMMMM
+#define EXP_MASK_F32 0x7F800000U
+#define EXP_MASK_F16     0x7C00U
+
+namespace {
+
+// the arrays longer than the chunk are converted by the chunks in parallel
+const size_t parallel_chunk_size = 64 * 1024;
+
+/**
+ * The vector conversions give the same bits as the scalar f16tof32() and f32tof16(): the denormals are flushed
+ * to zero, the F32 values are rounded by adding the half of the F16 ULP and are saturated to the maximal F16.
+ * Every function converts the multiple of its vector length and returns the number of the converted elements.
+ */
+#ifdef IE_PRECISION_UTILS_DISPATCH
+__attribute__((target("avx512f")))
+size_t f16tof32_avx512(float *dst, const ie_fp16 *src, size_t nelem, float scale, float bias) {
+    const __m512i abs_mask = _mm512_set1_epi32(0x7FFFFFFF);
+    const __m512i sign_mask = _mm512_set1_epi32(0x80000000);
+    // the minimal normal F16 value 2^-14
+    const __m512 min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 14) << 23));
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m512 f = _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i)));
+        __m512i u = _mm512_castps_si512(f);
+        __mmask16 denormal = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_and_epi32(u, abs_mask)), min16,
+                                                _CMP_LT_OQ);
+        f = _mm512_mask_mov_ps(f, denormal, _mm512_castsi512_ps(_mm512_and_epi32(u, sign_mask)));
+        _mm512_storeu_ps(dst + i, _mm512_add_ps(_mm512_mul_ps(f, vscale), vbias));
+    }
+    return i;
+}
+
+__attribute__((target("avx,f16c")))
+size_t f16tof32_f16c(float *dst, const ie_fp16 *src, size_t nelem, float scale, float bias) {
+    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 f = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)));
+        __m256 denormal = _mm256_cmp_ps(_mm256_and_ps(f, abs_mask), min16, _CMP_LT_OQ);
+        f = _mm256_blendv_ps(f, _mm256_and_ps(f, sign_mask), denormal);
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(f, vscale), vbias));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t f32tof16_avx2(ie_fp16 *dst, const float *src, size_t nelem, float scale, float bias) {
+    const __m256i exp_mask = _mm256_set1_epi32(EXP_MASK_F32);
+    const __m256i abs_mask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i mant_mask = _mm256_set1_epi32(0x007FFFFF);
+    const __m256i sign16 = _mm256_set1_epi32(0x8000);
+    const __m256i nan16 = _mm256_set1_epi32(0x0200);
+    const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+    const __m256i min16f16 = _mm256_set1_epi32(1 << 10);
+    const __m256i max16f16 = _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF);
+    const __m256i bias_diff = _mm256_set1_epi32((127 - 15) << 23);
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 half_min16 = _mm256_mul_ps(min16, _mm256_set1_ps(0.5f));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+    const __m256 ulp_scale = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23));
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), vscale), vbias);
+        __m256i v = _mm256_castps_si256(x);
+        __m256i s = _mm256_and_si256(_mm256_srli_epi32(v, 16), sign16);
+        __m256i a = _mm256_and_si256(v, abs_mask);
+        __m256i e = _mm256_and_si256(a, exp_mask);
+
+        __m256i nan_bit = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_and_si256(a, mant_mask),
+                                                                 _mm256_setzero_si256()), nan16);
+        __m256i nan_inf = _mm256_or_si256(_mm256_or_si256(s, _mm256_srli_epi32(a, 23 - 10)), nan_bit);
+
+        __m256 f = _mm256_add_ps(_mm256_castsi256_ps(a), _mm256_mul_ps(_mm256_castsi256_ps(e), ulp_scale));
+        __m256i res = _mm256_or_si256(_mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(f), bias_diff),
+                                                        23 - 10), s);
+        res = _mm256_blendv_epi8(res, _mm256_or_si256(max16f16, s),
+                                 _mm256_castps_si256(_mm256_cmp_ps(f, max16, _CMP_GE_OQ)));
+        res = _mm256_blendv_epi8(res, _mm256_or_si256(min16f16, s),
+                                 _mm256_castps_si256(_mm256_cmp_ps(f, min16, _CMP_LT_OQ)));
+        res = _mm256_blendv_epi8(res, s, _mm256_castps_si256(_mm256_cmp_ps(f, half_min16, _CMP_LT_OQ)));
+        res = _mm256_blendv_epi8(res, nan_inf, _mm256_cmpeq_epi32(e, exp_mask));
+
+        // the low halves of the dwords are the F16 values, as the scalar code truncates them
+        res = _mm256_packus_epi32(_mm256_and_si256(res, low16), _mm256_setzero_si256());
+        res = _mm256_permute4x64_epi64(res, 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm256_castsi256_si128(res));
+    }
+    return i;
+}
+#endif
+
+#if defined(__SSE4_2__)
+size_t f32tof16_sse42(ie_fp16 *dst, const float *src, size_t nelem, float scale, float bias) {
+    const __m128i exp_mask = _mm_set1_epi32(EXP_MASK_F32);
+    const __m128i abs_mask = _mm_set1_epi32(0x7FFFFFFF);
+    const __m128i mant_mask = _mm_set1_epi32(0x007FFFFF);
+    const __m128i sign16 = _mm_set1_epi32(0x8000);
+    const __m128i nan16 = _mm_set1_epi32(0x0200);
+    const __m128i low16 = _mm_set1_epi32(0xFFFF);
+    const __m128i min16f16 = _mm_set1_epi32(1 << 10);
+    const __m128i max16f16 = _mm_set1_epi32(((15 + 15) << 10) | 0x3FF);
+    const __m128i bias_diff = _mm_set1_epi32((127 - 15) << 23);
+    const __m128 min16 = _mm_castsi128_ps(_mm_set1_epi32((127 - 14) << 23));
+    const __m128 half_min16 = _mm_mul_ps(min16, _mm_set1_ps(0.5f));
+    const __m128 max16 = _mm_castsi128_ps(_mm_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+    const __m128 ulp_scale = _mm_castsi128_ps(_mm_set1_epi32((127 - 11) << 23));
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 4 <= nelem; i += 4) {
+        __m128 x = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i), vscale), vbias);
+        __m128i v = _mm_castps_si128(x);
+        __m128i s = _mm_and_si128(_mm_srli_epi32(v, 16), sign16);
+        __m128i a = _mm_and_si128(v, abs_mask);
+        __m128i e = _mm_and_si128(a, exp_mask);
+
+        __m128i nan_bit = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(a, mant_mask), _mm_setzero_si128()),
+                                           nan16);
+        __m128i nan_inf = _mm_or_si128(_mm_or_si128(s, _mm_srli_epi32(a, 23 - 10)), nan_bit);
+
+        __m128 f = _mm_add_ps(_mm_castsi128_ps(a), _mm_mul_ps(_mm_castsi128_ps(e), ulp_scale));
+        __m128i res = _mm_or_si128(_mm_srli_epi32(_mm_sub_epi32(_mm_castps_si128(f), bias_diff), 23 - 10), s);
+        res = _mm_blendv_epi8(res, _mm_or_si128(max16f16, s), _mm_castps_si128(_mm_cmpge_ps(f, max16)));
+        res = _mm_blendv_epi8(res, _mm_or_si128(min16f16, s), _mm_castps_si128(_mm_cmplt_ps(f, min16)));
+        res = _mm_blendv_epi8(res, s, _mm_castps_si128(_mm_cmplt_ps(f, half_min16)));
+        res = _mm_blendv_epi8(res, nan_inf, _mm_cmpeq_epi32(e, exp_mask));
+
+        res = _mm_packus_epi32(_mm_and_si128(res, low16), _mm_setzero_si128());
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i), res);
+    }
+    return i;
+}
+#endif
+
+typedef size_t (*f16tof32_kernel_t)(float *, const ie_fp16 *, size_t, float, float);
+typedef size_t (*f32tof16_kernel_t)(ie_fp16 *, const float *, size_t, float, float);
+
+f16tof32_kernel_t select_f16tof32_kernel() {
+#ifdef IE_PRECISION_UTILS_DISPATCH
+    if (__builtin_cpu_supports("avx512f"))
+        return f16tof32_avx512;
+    if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c"))
+        return f16tof32_f16c;
+#endif
+    return nullptr;
+}
+
+f32tof16_kernel_t select_f32tof16_kernel() {
+#ifdef IE_PRECISION_UTILS_DISPATCH
+    if (__builtin_cpu_supports("avx2"))
+        return f32tof16_avx2;
+#endif
+#if defined(__SSE4_2__)
+    return f32tof16_sse42;
+#else
+    return nullptr;
+#endif
+}
+
+void f16tof32_chunk(float *dst, const ie_fp16 *src, size_t nelem, float scale, float bias) {
+    static const f16tof32_kernel_t kernel = select_f16tof32_kernel();
+    size_t i = kernel ? kernel(dst, src, nelem, scale, bias) : 0;
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16_chunk(ie_fp16 *dst, const float *src, size_t nelem, float scale, float bias) {
+    static const f32tof16_kernel_t kernel = select_f32tof16_kernel();
+    size_t i = kernel ? kernel(dst, src, nelem, scale, bias) : 0;
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace
+
 void PrecisionUtils::f16tof32Arrays(float *dst, const short *src, size_t nelem, float scale, float bias) {
     const ie_fp16 *_src = reinterpret_cast<const ie_fp16 *>(src);
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+    if (nelem <= parallel_chunk_size) {
+        f16tof32_chunk(dst, _src, nelem, scale, bias);
+        return;
     }
+    parallel_for((nelem + parallel_chunk_size - 1) / parallel_chunk_size, [&](size_t chunk) {
+        size_t start = chunk * parallel_chunk_size;
+        f16tof32_chunk(dst + start, _src + start, std::min(parallel_chunk_size, nelem - start), scale, bias);
+    });
 }
 
 void PrecisionUtils::f32tof16Arrays(short *dst, const float *src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    if (nelem <= parallel_chunk_size) {
+        f32tof16_chunk(dst, src, nelem, scale, bias);
+        return;
     }
+    parallel_for((nelem + parallel_chunk_size - 1) / parallel_chunk_size, [&](size_t chunk) {
+        size_t start = chunk * parallel_chunk_size;
+        f32tof16_chunk(dst + start, src + start, std::min(parallel_chunk_size, nelem - start), scale, bias);
+    });
 }
 
-// Function to convert F32 into F16
-// F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
-// F16: exp_bias:15  SEEEEEMM MMMMMMMM
-#define EXP_MASK_F32 0x7F800000U
-#define EXP_MASK_F16     0x7C00U
-
 
 // small helper function to represent uint32_t value as float32
 inline float asfloat(uint32_t v) {
@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -124,19 +126,32 @@ void OutputController::propagateShapes(const std::set<ReshapeLauncher::Ptr>& lau
                             << inputTo.first
                             << "): connected layer is null";
             }
-            auto layerName = layer->name;
-            auto foundLauncher = std::find_if(launchers.begin(), launchers.end(),
-                                              [&layerName](const ReshapeLauncher::Ptr& launcher) {
-                                                  return launcher->getLayerName() == layerName;
-                                              });
-            if (foundLauncher == launchers.end())
-                THROW_IE_EXCEPTION << "Failed to find ReshapeLauncher for layer: '" << layerName << "'";
-            (*foundLauncher)->setShapeByName(_shapes[idx], outData->name);
+            getLauncherByLayerName(layer->name, launchers)->setShapeByName(_shapes[idx], outData->name);
         }
         idx++;
     }
 }
 
+ReshapeLauncher::Ptr OutputController::getLauncherByLayerName(const std::string& layerName,
+                                                             const std::set<ReshapeLauncher::Ptr>& launchers) {
+    // the launcher found before is checked to be still in the set, it may be replaced by the extension
+    auto connected = _connectedLaunchers.find(layerName);
+    if (connected != _connectedLaunchers.end()) {
+        auto launcher = connected->second.lock();
+        if (launcher && launchers.find(launcher) != launchers.end())
+            return launcher;
+    }
+
+    auto foundLauncher = std::find_if(launchers.begin(), launchers.end(),
+                                      [&layerName](const ReshapeLauncher::Ptr& launcher) {
+                                          return launcher->getLayerName() == layerName;
+                                      });
+    if (foundLauncher == launchers.end())
+        THROW_IE_EXCEPTION << "Failed to find ReshapeLauncher for layer: '" << layerName << "'";
+    _connectedLaunchers[layerName] = *foundLauncher;
+    return *foundLauncher;
+}
+
 void OutputController::setShapes(const std::vector<SizeVector>& shapes) {
     _shapes = shapes;
 }
@@ -10,6 +10,7 @@
 #include <list>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <memory>
 
 #include <ie_layers.h>
@@ -133,6 +134,13 @@ public:
     virtual void propagateShapes(const std::set<ReshapeLauncher::Ptr>& launchers);
 
     virtual void setShapes(const std::vector<SizeVector>& shapes);
+
+private:
+    ReshapeLauncher::Ptr getLauncherByLayerName(const std::string& layerName,
+                                                const std::set<ReshapeLauncher::Ptr>& launchers);
+
+    // the launchers of the connected layers found on the previous propagations
+    std::unordered_map<std::string, std::weak_ptr<ReshapeLauncher>> _connectedLaunchers;
 };
 
 }  // namespace ShapeInfer
@@ -10,6 +10,7 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <utility>
 #include "shape_infer/ie_reshape_launcher.hpp"
 #include "shape_infer/ie_reshape_io_controllers.hpp"
 
@@ -52,13 +53,30 @@ void ReshapeLauncher::setShapeByName(const SizeVector& shape, const std::string&
     _iController->setShapeByName(shape, dataName);
 }
 
+constexpr size_t ReshapeLauncher::maxInferredShapes;
+
 void ReshapeLauncher::reshape(const std::set<ReshapeLauncher::Ptr>& launchers) {
-    ResponseDesc resp;
-    std::vector<SizeVector> outShapes;
-    auto sts = _impl->inferShapes(_iController->getShapes(true), _layer->params, _layer->blobs, outShapes, &resp);
-    _oController->setShapes(outShapes);
-    if (sts != OK)
-        THROW_IE_EXCEPTION << resp.msg;
+    auto inShapes = _iController->getShapes(true);
+    if (_layer->params != _inferredParams || _layer->blobs != _inferredBlobs) {
+        _inferredShapes.clear();
+        _inferredParams = _layer->params;
+        _inferredBlobs = _layer->blobs;
+    }
+
+    auto inferred = _inferredShapes.find(inShapes);
+    if (inferred != _inferredShapes.end()) {
+        _oController->setShapes(inferred->second);
+    } else {
+        ResponseDesc resp;
+        std::vector<SizeVector> outShapes;
+        auto sts = _impl->inferShapes(inShapes, _layer->params, _layer->blobs, outShapes, &resp);
+        _oController->setShapes(outShapes);
+        if (sts != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+        if (_inferredShapes.size() >= maxInferredShapes)
+            _inferredShapes.clear();
+        _inferredShapes.emplace(std::move(inShapes), std::move(outShapes));
+    }
     _oController->propagateShapes(launchers);
 }
 
@@ -100,6 +118,7 @@ void ReshapeLauncher::setIRShapeByName(const std::string& dataName) {
 
 void ReshapeLauncher::setShapeInferImpl(const IShapeInferImpl::Ptr& impl) {
     _impl = impl;
+    _inferredShapes.clear();
 }
 
 const CNNLayer* ReshapeLauncher::getLayer() const {
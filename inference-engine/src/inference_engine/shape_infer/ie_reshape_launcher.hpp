@@ -69,6 +69,8 @@ public:
 
     /**
      * @brief Calculates output shapes and changed layer params using input shapes that was set
+     * The output shapes are kept per the input shapes, the shape infer implementation is not called again for
+     * the known input shapes while the params and the blobs of the layer are the same.
      * @param resp Pointer to the response message that holds a description of an error if any occurred
      * @param launchers - Map of pairs: layer name and its reshape launcher.
      * @return Status code of the operation. OK if succeeded
@@ -102,6 +104,12 @@ protected:
     const CNNLayer* _layer;
     IShapeInferImpl::Ptr _impl;
 
+    // the output shapes inferred for the input shapes, valid for the params and the blobs of the layer below
+    std::map<std::vector<SizeVector>, std::vector<SizeVector>> _inferredShapes;
+    std::map<std::string, std::string> _inferredParams;
+    std::map<std::string, Blob::Ptr> _inferredBlobs;
+    static constexpr size_t maxInferredShapes = 16;
+
 protected:
     /**
      * @brief Check that all shape infer operations were done with specified layer.
@@ -41,6 +41,7 @@ Reshaper::Reshaper(const ICNNNetwork& network, const LauncherCreator::Ptr& launc
             createdLauncher = launcherCreator->createInputLauncher(currentLayer.get(), _extensions);
         }
         _launchers.insert(createdLauncher);
+        _launchersByName[currentLayer->name] = createdLauncher;
     }
 }
 
@@ -83,19 +84,17 @@ void Reshaper::AddExtension(const IShapeInferExtensionPtr& extension) {
         }
         for (const auto& launcher : launchersToInsert) {
             _launchers.insert(launcher);
+            _launchersByName[launcher->getLayer()->name] = launcher;
         }
     }
     _extensions.push_back(extension);
 }
 
 ReshapeLauncher::Ptr Reshaper::getLauncherByLayerName(const std::string& layerName) const {
-    auto foundLauncher = std::find_if(_launchers.begin(), _launchers.end(),
-                                      [&layerName](const ReshapeLauncher::Ptr& launcher) {
-                                          return launcher->getLayerName() == layerName;
-                                      });
-    if (foundLauncher == _launchers.end())
+    auto foundLauncher = _launchersByName.find(layerName);
+    if (foundLauncher == _launchersByName.end())
         THROW_IE_EXCEPTION << "Failed to reshape layer ('" << layerName << "'): can't find the corresponding launcher";
-    return *foundLauncher;
+    return foundLauncher->second;
 }
 
 void Reshaper::run(const std::map<std::string, SizeVector>& inputShapes) {
@@ -104,17 +103,17 @@ void Reshaper::run(const std::map<std::string, SizeVector>& inputShapes) {
         launcher->reset();
     }
 
-    // Set new input shapes
+    // Set new input shapes, the inputs without the new shapes keep the current ones, which are the shapes
+    // from IR for the first run
     for (auto const& input : _inputLayers) {
-        std::string layerName = input->name;
+        auto foundLauncher = getLauncherByLayerName(input->name);
         for (auto const& outData : input->outData) {
             std::string dataName = outData->name;
             auto foundShapeIt = inputShapes.find(dataName);
-            auto foundLauncher = getLauncherByLayerName(layerName);
             if (foundShapeIt != inputShapes.end()) {
                 foundLauncher->setShapeByName(foundShapeIt->second, dataName);
             } else {
-                foundLauncher->setIRShapeByName(dataName);
+                foundLauncher->setShapeByName(outData->getTensorDesc().getDims(), dataName);
             }
         }
     }
@@ -10,6 +10,7 @@
 #include <list>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <memory>
 
 #include <ie_layers.h>
@@ -73,6 +74,9 @@ public:
     /**
      * @brief Launches shape inference for the given ICNNNetworkAdds and input shapes.
      * Throws if shape infer failed without corruption of original shapes
+     * The inputs missing in the map keep their current shapes. The launchers remember the shapes inferred on the
+     * previous runs, so the Reshaper may be kept and run again: only the layers with the changed input shapes
+     * are inferred again.
      * @param inputShapes - Map of input names (data) to their input shapes.
      */
     void run(const std::map<std::string, SizeVector>& inputShapes);
@@ -86,6 +90,7 @@ private:
 private:
     std::vector<IShapeInferExtensionPtr> _extensions;
     std::set<ReshapeLauncher::Ptr> _launchers;
+    std::unordered_map<std::string, ReshapeLauncher::Ptr> _launchersByName;
     std::vector<CNNLayerPtr> _allSortedLayers{};
     CNNLayerSet _inputLayers{};
     caseless_set<std::string> _allTypes;
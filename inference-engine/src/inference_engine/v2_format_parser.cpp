@@ -9,6 +9,7 @@
 #include "v2_layer_parsers.h"
 #include "xml_parse_utils.h"
 #include "ie_blob_proxy.hpp"
+#include "mmap_allocator.hpp"
 #include "range_iterator.hpp"
 #include <fstream>
 
@@ -123,6 +124,17 @@ InferenceEngine::CNNLayer::Ptr V2FormatParser::CreateLayer(pugi::xml_node& node,
     return genericCreator.CreateLayer(node, layerParsePrms);
 }
 
+CNNLayer::Ptr V2FormatParser::CreateLayer(const LayerParams& prms) const {
+    for (auto &creator : getCreators()) {
+        if (!creator->shouldCreate(prms.type))
+            continue;
+        auto layer = creator->CreateLayer(prms);
+        if (layer)
+            return layer;
+    }
+    return std::make_shared<GenericLayer>(prms);
+}
+
 void V2FormatParser::SetLayerInput(CNNNetworkImpl& network, const std::string& dataId,
                                    CNNLayerPtr& targetLayer, int inputPort) {
     DataPtr& dataPtr = _portsToData[dataId];
@@ -181,14 +193,15 @@ CNNNetworkImplPtr V2FormatParser::Parse(pugi::xml_node& root) {
     int nodeCnt = 0;
     std::map<int, CNNLayer::Ptr> layerById;
     bool identifyNetworkPrecision = _defPrecision == Precision::UNSPECIFIED;
-    for (auto node = allLayersNode.child("layer"); !node.empty(); node = node.next_sibling("layer")) {
-        LayerParseParameters lprms;
-        ParseGenericParams(node, lprms);
+    for (auto node = allLayersNode.child("layer"); !node.empty(); ) {
+        LayerParseParameters parsedPrms;
+        ParseGenericParams(node, parsedPrms);
 
-        CNNLayer::Ptr layer = CreateLayer(node, lprms);
-        if (!layer) THROW_IE_EXCEPTION << "Don't know how to create Layer type: " << lprms.prms.type;
+        CNNLayer::Ptr layer = CreateLayer(node, parsedPrms);
+        if (!layer) THROW_IE_EXCEPTION << "Don't know how to create Layer type: " << parsedPrms.prms.type;
 
-        layersParseInfo[layer->name] = lprms;
+        LayerParseParameters& lprms = layersParseInfo[layer->name];
+        lprms = std::move(parsedPrms);
         _network->addLayer(layer);
         layerById[lprms.layerId] = layer;
 
@@ -225,6 +238,12 @@ CNNNetworkImplPtr V2FormatParser::Parse(pugi::xml_node& root) {
             layer->outData.push_back(ptr);
         }
         nodeCnt++;
+
+        // the converted layers are removed from the document, so the memory of the nodes is reused
+        // by the built network instead of holding both of them until the end of the parsing
+        auto next = node.next_sibling("layer");
+        allLayersNode.remove_child(node);
+        node = next;
     }
 
     // connect the edges
@@ -377,7 +396,40 @@ Blob::Ptr V2FormatParser::GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights,
     }
 }
 
+template<typename BlobType>
+inline Blob::Ptr GetTypedBlobFromFile(const std::string& filepath, size_t size, const WeightSegment& segment) {
+    if (segment.getEnd() > size)
+        THROW_IE_EXCEPTION << "segment exceeds given buffer limits";
+
+    SizeVector w_dims({segment.size / sizeof(BlobType)});
+    typename TBlob<BlobType>::Ptr blob(new FileSegmentBlob<BlobType>(segment.precision, Layout::C, w_dims,
+                                                                     filepath, segment.start));
+    blob->allocate();
+    return blob;
+}
+
 void V2FormatParser::SetWeights(const TBlob<uint8_t>::Ptr& weights) {
+    SetBlobs([&](const WeightSegment& segment) {
+        return GetBlobFromSegment(weights, segment);
+    });
+}
+
+void V2FormatParser::SetWeightsFile(const std::string& filepath, size_t size) {
+    SetBlobs([&](const WeightSegment& segment) -> Blob::Ptr {
+        if (segment.precision == Precision::FP32) {
+            return GetTypedBlobFromFile<float>(filepath, size, segment);
+        } else if (segment.precision == Precision::I16 || segment.precision == Precision::Q78 ||
+                   segment.precision == Precision::FP16) {
+            return GetTypedBlobFromFile<short>(filepath, size, segment);
+        } else if (segment.precision == Precision::U8) {
+            return GetTypedBlobFromFile<uint8_t>(filepath, size, segment);
+        } else {
+            THROW_IE_EXCEPTION << "precision " << segment.precision << " is not supported...";
+        }
+    });
+}
+
+void V2FormatParser::SetBlobs(const std::function<Blob::Ptr(const WeightSegment&)>& getBlob) {
     for (auto& kvp : _network->allLayers()) {
         auto fit = layersParseInfo.find(kvp.second->name);
         // todo: may check that earlier - while parsing...
@@ -388,18 +440,18 @@ void V2FormatParser::SetWeights(const TBlob<uint8_t>::Ptr& weights) {
         WeightableLayer* pWL = dynamic_cast<WeightableLayer*>(kvp.second.get());
         if (pWL != nullptr) {
             if (lprms.blobs.find("weights") != lprms.blobs.end()) {
-                pWL->_weights = GetBlobFromSegment(weights, lprms.blobs["weights"]);
+                pWL->_weights = getBlob(lprms.blobs["weights"]);
                 pWL->blobs["weights"] = pWL->_weights;
             }
             if (lprms.blobs.find("biases") != lprms.blobs.end()) {
-                pWL->_biases  = GetBlobFromSegment(weights, lprms.blobs["biases"]);
+                pWL->_biases  = getBlob(lprms.blobs["biases"]);
                 pWL->blobs["biases"] = pWL->_biases;
             }
         }
         auto pGL = dynamic_cast<GenericLayer *>(kvp.second.get());
         if (pGL == nullptr) continue;
         for (auto s : lprms.blobs) {
-            pGL->blobs[s.first] = GetBlobFromSegment(weights, s.second);
+            pGL->blobs[s.first] = getBlob(s.second);
         }
     }
     for (auto &kvp : _preProcessSegments) {
@@ -417,7 +469,7 @@ void V2FormatParser::SetWeights(const TBlob<uint8_t>::Ptr& weights) {
         for (size_t c = 0; c < segments.size(); c++) {
             if (segments[c].size == 0)
                 continue;
-            Blob::Ptr blob = GetBlobFromSegment(weights, segments[c]);
+            Blob::Ptr blob = getBlob(segments[c]);
             blob->Reshape({ width, height }, Layout::HW);  // to fit input image sizes (summing it is an image)
             pp.setMeanImageForChannel(blob, c);
         }
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <map>
 #include <memory>
@@ -58,6 +59,14 @@ public:
 
     virtual CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& layerParsePrms) = 0;
 
+    /**
+     * @brief Creates the layer of the class of the type without the parameters, returns nullptr if the class
+     * is defined by the parameters
+     */
+    virtual CNNLayer::Ptr CreateLayer(const LayerParams& prms) {
+        return nullptr;
+    }
+
     bool shouldCreate(const std::string& nodeType) const {
         CaselessEq<std::string> comparator;
         return comparator(nodeType, type_);
@@ -72,8 +81,17 @@ public:
 
     Blob::Ptr GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment & weight_segment) const;
     void SetWeights(const TBlob<uint8_t>::Ptr& weights) override;
+    /**
+     * @brief Creates the blobs of the layers which read their segments of the file on the first access
+     */
+    void SetWeightsFile(const std::string& filepath, size_t size) override;
     void ParseDims(SizeVector& dims, const pugi::xml_node &node) const;
 
+    /**
+     * @brief Creates the layer of the same class as the parsed layer of the type prms.type
+     */
+    CNNLayer::Ptr CreateLayer(const LayerParams& prms) const;
+
 private:
     int _version;
     Precision _defPrecision;
@@ -92,6 +110,8 @@ private:
     DataPtr ParseInputData(pugi::xml_node& root) const;
 
     void ParsePreProcess(pugi::xml_node& node);
+
+    void SetBlobs(const std::function<Blob::Ptr(const WeightSegment&)>& getBlob);
 };
 }  // namespace details
 }  // namespace InferenceEngine
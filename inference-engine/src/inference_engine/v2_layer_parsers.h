@@ -35,6 +35,10 @@ class V2LayerCreator : public BaseCreator {
 public:
     explicit V2LayerCreator(const std::string& type) : BaseCreator(type) {}
 
+    CNNLayer::Ptr CreateLayer(const LayerParams& prms) override {
+        return std::make_shared<LT>(prms);
+    }
+
     CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& layerParsePrms) override {
         auto res = std::make_shared<LT>(layerParsePrms.prms);
 
@@ -103,6 +107,7 @@ public:
 class ActivationLayerCreator : public BaseCreator {
  public:
     explicit ActivationLayerCreator(const std::string& type) : BaseCreator(type) {}
+    using BaseCreator::CreateLayer;
     CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& layerParsePrms) override;
 };
 }  // namespace details
@@ -4,18 +4,57 @@
 //
 
 #include "config.h"
+#include "mkldnn_huge_pages.h"
 #include "ie_plugin_config.hpp"
 #include "ie_common.h"
 
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
+#include <thread>
+#include <vector>
 #include <cpp_interfaces/exception2status.hpp>
 
 namespace MKLDNNPlugin {
 
 using namespace InferenceEngine;
 
+// the comma separated list of the cores and of the ranges of them, e.g. "0-3,8"
+static std::vector<int> parseCores(const std::string &value) {
+    // std::getline skips the empty item at the end, so the separator is appended to read it (and reject it) too
+    std::vector<int> cores;
+    std::stringstream stream(value + ',');
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        int first = -1, last = -1;
+        try {
+            size_t pos = 0;
+            first = last = std::stoi(item, &pos);
+            if (pos < item.size() && item[pos] == '-') {
+                size_t lastPos = 0;
+                last = std::stoi(item.substr(pos + 1), &lastPos);
+                pos += 1 + lastPos;
+            }
+            if (pos != item.size())
+                first = -1;
+        } catch (const std::exception&) {
+            first = -1;
+        }
+        if (first < 0 || last < first)
+            THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BIND_CORES
+                               << ". Expected only the comma separated non-negative numbers and ranges (#core or "
+                               << "#first-#last) or NO";
+        for (int core = first; core <= last; core++) {
+            if (std::find(cores.begin(), cores.end(), core) != cores.end())
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BIND_CORES
+                                   << ". The core " << core << " is listed twice";
+            cores.push_back(core);
+        }
+    }
+    return cores;
+}
+
 void Config::readProperties(const std::map<std::string, std::string> &prop) {
     for (auto& kvp : prop) {
         std::string key = kvp.first;
@@ -27,6 +66,126 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BIND_THREAD
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) {
+            if (val == PluginConfigParams::CPU_THROUGHPUT_AUTO) {
+                // bare minimum of streams that evenly divides the available cores
+                const int num_cores = std::thread::hardware_concurrency();
+                if (num_cores % 4 == 0)
+                    throughputStreams = std::max(4, num_cores / 4);
+                else if (num_cores % 3 == 0)
+                    throughputStreams = std::max(3, num_cores / 3);
+                else
+                    throughputStreams = 1;
+            } else {
+                int val_i;
+                try {
+                    val_i = std::stoi(val);
+                } catch (const std::exception&) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS
+                                       << ". Expected only positive numbers (#streams) or "
+                                       << "PluginConfigParams::CPU_THROUGHPUT_AUTO";
+                }
+                if (val_i < 1)
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS
+                                       << ". Expected only positive numbers (#streams)";
+                throughputStreams = val_i;
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_BIND_NUMA_NODE) {
+            if (val == PluginConfigParams::NO) {
+                numaNode = -1;
+            } else {
+                int val_i;
+                try {
+                    val_i = std::stoi(val);
+                } catch (const std::exception&) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BIND_NUMA_NODE
+                                       << ". Expected only non-negative numbers (#node) or NO";
+                }
+                if (val_i < 0)
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BIND_NUMA_NODE
+                                       << ". Expected only non-negative numbers (#node) or NO";
+                numaNode = val_i;
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_THREADS_NUM) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THREADS_NUM
+                                   << ". Expected only non-negative numbers (#threads)";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THREADS_NUM
+                                   << ". Expected only non-negative numbers (#threads)";
+            threadsNum = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_BIND_CORES) {
+            bindCores = val == PluginConfigParams::NO ? std::vector<int>() : parseCores(val);
+        } else if (key == PluginConfigParams::KEY_CPU_SCHEDULER_GROUPS) {
+            if (val == PluginConfigParams::NO) {
+                schedulerGroups = 0;
+            } else {
+                int val_i;
+                try {
+                    val_i = std::stoi(val);
+                } catch (const std::exception&) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SCHEDULER_GROUPS
+                                       << ". Expected only positive numbers (#groups) or NO";
+                }
+                if (val_i < 1)
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SCHEDULER_GROUPS
+                                       << ". Expected only positive numbers (#groups) or NO";
+                schedulerGroups = val_i;
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_SCHEDULER_PRIORITY) {
+            try {
+                schedulerPriority = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SCHEDULER_PRIORITY
+                                   << ". Expected only integer numbers";
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_SCHEDULER_WEIGHT) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SCHEDULER_WEIGHT
+                                   << ". Expected only positive numbers";
+            }
+            if (val_i < 1)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SCHEDULER_WEIGHT
+                                   << ". Expected only positive numbers";
+            schedulerWeight = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_WORKSPACE_GROUP) {
+            workspaceGroup = val;
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_SOLVER) {
+            if (val == PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT) memorySolver = MemorySolverBestFit;
+            else if (val == PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY) memorySolver = MemorySolverGreedy;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_SOLVER
+                                   << ". Expected only CPU_MEMORY_SOLVER_BEST_FIT/CPU_MEMORY_SOLVER_GREEDY";
+        } else if (key == PluginConfigParams::KEY_CPU_FP16_WEIGHTS) {
+            if (val == PluginConfigParams::YES) fp16Weights = true;
+            else if (val == PluginConfigParams::NO) fp16Weights = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_FP16_WEIGHTS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_GRAPH_CACHE_DIR) {
+            graphCacheDir = val;
+        } else if (key == PluginConfigParams::KEY_TUNING_MODE) {
+            if (val == PluginConfigParams::TUNING_CREATE) tuningMode = TuningCreate;
+            else if (val == PluginConfigParams::TUNING_USE_EXISTING) tuningMode = TuningUseExisting;
+            else if (val == PluginConfigParams::TUNING_DISABLED) tuningMode = TuningDisabled;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_TUNING_MODE
+                                   << ". Expected only TUNING_CREATE/TUNING_USE_EXISTING/TUNING_DISABLED";
+        } else if (key == PluginConfigParams::KEY_TUNING_FILE) {
+            tuningFile = val;
         } else if (key == PluginConfigParams::KEY_DYN_BATCH_LIMIT) {
             int val_i = std::stoi(val);
             // zero and any negative value will be treated
@@ -38,12 +197,64 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_PERF_COUNT
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PERF_COUNT_SAMPLING) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_SAMPLING
+                                   << ". Expected only non-negative numbers (period of the timed inferences)";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_SAMPLING
+                                   << ". Expected only non-negative numbers (period of the timed inferences)";
+            perfCountSampling = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_PERF_COUNT_STATISTIC) {
+            if (val == PluginConfigParams::PERF_COUNT_AVG) perfCountStatistic = PerfAvg;
+            else if (val == PluginConfigParams::PERF_COUNT_MIN) perfCountStatistic = PerfMin;
+            else if (val == PluginConfigParams::PERF_COUNT_P50) perfCountStatistic = PerfP50;
+            else if (val == PluginConfigParams::PERF_COUNT_P99) perfCountStatistic = PerfP99;
+            else if (val == PluginConfigParams::PERF_COUNT_MAX) perfCountStatistic = PerfMax;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_STATISTIC
+                                   << ". Expected only PERF_COUNT_AVG/PERF_COUNT_MIN/PERF_COUNT_P50/PERF_COUNT_P99/PERF_COUNT_MAX";
+        } else if (key == PluginConfigParams::KEY_CPU_PERF_COUNT_BY_LAYER_TYPE) {
+            if (val == PluginConfigParams::YES) perfCountByLayerType = true;
+            else if (val == PluginConfigParams::NO) perfCountByLayerType = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_BY_LAYER_TYPE
+                                   << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) {
             if (val == PluginConfigParams::YES) exclusiveAsyncRequests = true;
             else if (val == PluginConfigParams::NO) exclusiveAsyncRequests = false;
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_ASYNC_THREADS_CORES) {
+            asyncThreads.cpus = val == PluginConfigParams::NO ? std::vector<int>() : parseCpuList(key, val);
+        } else if (key == PluginConfigParams::KEY_ASYNC_THREADS_PRIORITY) {
+            asyncThreads.priority = parseThreadsPriority(key, val);
+        } else if (key == PluginConfigParams::KEY_CPU_INLINE_COMPLETION) {
+            if (val == PluginConfigParams::YES) inlineCompletion = true;
+            else if (val == PluginConfigParams::NO) inlineCompletion = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INLINE_COMPLETION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::NO) hugePageSize = 0;
+            else if (val == PluginConfigParams::HUGE_PAGES_2MB) hugePageSize = MKLDNNHugePages::size2MB;
+            else if (val == PluginConfigParams::HUGE_PAGES_1GB) hugePageSize = MKLDNNHugePages::size1GB;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HUGE_PAGES
+                                   << ". Expected only NO/HUGE_PAGES_2MB/HUGE_PAGES_1GB";
+        } else if (key == PluginConfigParams::KEY_CPU_BLOB_ALLOCATOR) {
+            if (val == PluginConfigParams::CPU_BLOB_ALLOCATOR_SYSTEM) blobAllocator = BlobAllocatorSystem;
+            else if (val == PluginConfigParams::CPU_BLOB_ALLOCATOR_POOLED) blobAllocator = BlobAllocatorPooled;
+            else if (val == PluginConfigParams::CPU_BLOB_ALLOCATOR_HUGE_PAGES) blobAllocator = BlobAllocatorHugePages;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BLOB_ALLOCATOR
+                                   << ". Expected only CPU_BLOB_ALLOCATOR_SYSTEM/CPU_BLOB_ALLOCATOR_POOLED/"
+                                   << "CPU_BLOB_ALLOCATOR_HUGE_PAGES";
         } else if (key.compare(PluginConfigParams::KEY_DYN_BATCH_ENABLED) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0)
                 enableDynamicBatch = true;
@@ -7,15 +7,67 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include <cpp_interfaces/ie_thread_affinity.hpp>
 
 namespace MKLDNNPlugin {
 
 struct Config {
+    enum TuningMode {
+        TuningDisabled,
+        TuningCreate,
+        TuningUseExisting
+    };
+
+    enum PerfStatistic {
+        PerfAvg,
+        PerfMin,
+        PerfP50,
+        PerfP99,
+        PerfMax
+    };
+
+    enum BlobAllocator {
+        BlobAllocatorSystem,
+        BlobAllocatorPooled,
+        BlobAllocatorHugePages
+    };
+
+    enum MemorySolverStrategy {
+        MemorySolverBestFit,
+        MemorySolverGreedy
+    };
+
     bool useThreadBinding = true;
     bool collectPerfCounters = false;
+    int perfCountSampling = 0;
+    PerfStatistic perfCountStatistic = PerfAvg;
+    bool perfCountByLayerType = false;
     bool exclusiveAsyncRequests = false;
+    bool inlineCompletion = false;
+    BlobAllocator blobAllocator = BlobAllocatorSystem;
+    size_t hugePageSize = 0;
     bool enableDynamicBatch = false;
     int batchLimit = 0;
+    int throughputStreams = 1;
+    bool parallelBranches = false;
+    int numaNode = -1;
+    // 0 takes all the cores
+    int threadsNum = 0;
+    // the logical cores the threads of the network are bound to, empty if they are not set explicitly
+    std::vector<int> bindCores;
+    // the groups of the CPU scheduler shared by the networks of the process, 0 if the network has its own threads
+    int schedulerGroups = 0;
+    int schedulerPriority = 0;
+    int schedulerWeight = 1;
+    // the placement of the callback threads, the processors are the ones of OS (see KEY_ASYNC_THREADS_CORES)
+    InferenceEngine::TaskExecutorConfig asyncThreads;
+    std::string workspaceGroup;
+    MemorySolverStrategy memorySolver = MemorySolverBestFit;
+    bool fp16Weights = false;
+    std::string graphCacheDir;
+    TuningMode tuningMode = TuningDisabled;
+    std::string tuningFile;
 
     void readProperties(const std::map<std::string, std::string> &config);
 };
@@ -4,9 +4,146 @@
 //
 
 #include "mean_image.h"
+#include <memory>
+#include <vector>
+#include "jit_generator.hpp"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace Xbyak;
+
+namespace {
+
+struct jit_mean_call_args {
+    float *dst;
+    const float *mean;
+    // the number of the elements, the multiple of jit_mean_kernel::step
+    size_t work_amount;
+};
+
+#define GET_OFF(field) offsetof(jit_mean_call_args, field)
+
+struct jit_mean_kernel : public jit_generator {
+    // the elements of one iteration, it is also the period of the repeated mean
+    static const size_t step = 16;
+
+    jit_mean_kernel(): jit_generator(nullptr, 4096) {}
+
+    void (*ker_)(const jit_mean_call_args *) = nullptr;
+};
+
+/**
+ * dst[i] -= mean[i], or dst[i] -= mean[i % step] for the repeated mean: the mean values of a plane (repeated
+ * value) or of a block of the channels (nChw8c, nChw16c) are loaded once
+ */
+template <cpu_isa_t isa>
+struct jit_mean_kernel_impl : public jit_mean_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_mean_kernel_impl)
+
+    explicit jit_mean_kernel_impl(bool repeated) {
+        preamble();
+
+        mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+        mov(reg_mean, ptr[param1 + GET_OFF(mean)]);
+        mov(reg_work_amount, ptr[param1 + GET_OFF(work_amount)]);
+
+        if (repeated) {
+            for (int k = 0; k < unroll; k++)
+                uni_vmovups(vmm_mean(k), ptr[reg_mean + k * vlen]);
+        }
+
+        Label l_loop, l_exit;
+        L(l_loop);
+        {
+            cmp(reg_work_amount, step);
+            jl(l_exit, T_NEAR);
+
+            for (int k = 0; k < unroll; k++) {
+                uni_vmovups(vmm_val(k), ptr[reg_dst + k * vlen]);
+                if (!repeated)
+                    uni_vmovups(vmm_mean(k), ptr[reg_mean + k * vlen]);
+                uni_vsubps(vmm_val(k), vmm_val(k), vmm_mean(k));
+                uni_vmovups(ptr[reg_dst + k * vlen], vmm_val(k));
+            }
+
+            add(reg_dst, step * sizeof(float));
+            if (!repeated)
+                add(reg_mean, step * sizeof(float));
+            sub(reg_work_amount, step);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_exit);
+
+        postamble();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse42, Xmm, isa == avx2, Ymm, Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int unroll = static_cast<int>(step * sizeof(float)) / vlen;
+
+    Reg64 reg_dst = r8;
+    Reg64 reg_mean = r9;
+    Reg64 reg_work_amount = r10;
+
+    Vmm vmm_val(int k) { return Vmm(k); }
+    Vmm vmm_mean(int k) { return Vmm(unroll + k); }
+};
+
+jit_mean_kernel *create_kernel(bool repeated) {
+    if (mayiuse(avx512_common))
+        return new jit_mean_kernel_impl<avx512_common>(repeated);
+    if (mayiuse(avx2))
+        return new jit_mean_kernel_impl<avx2>(repeated);
+    if (mayiuse(sse42))
+        return new jit_mean_kernel_impl<sse42>(repeated);
+    return nullptr;
+}
+
+struct MeanKernels {
+    std::unique_ptr<jit_mean_kernel> image;
+    std::unique_ptr<jit_mean_kernel> repeated;
+
+    MeanKernels(): image(create_kernel(false)), repeated(create_kernel(true)) {}
+
+    static const MeanKernels &get() {
+        static const MeanKernels instance;
+        return instance;
+    }
+};
+
+size_t callKernel(const jit_mean_kernel *jit, float *dst, const float *mean, size_t size) {
+    size_t simdSize = jit ? size / jit_mean_kernel::step * jit_mean_kernel::step : 0;
+    if (simdSize) {
+        jit_mean_call_args args;
+        args.dst = dst;
+        args.mean = mean;
+        args.work_amount = simdSize;
+        jit->ker_(&args);
+    }
+    return simdSize;
+}
+
+// dst[i] -= mean[i]
+void subtractImage(float *dst, const float *mean, size_t size) {
+    for (size_t i = callKernel(MeanKernels::get().image.get(), dst, mean, size); i < size; i++)
+        dst[i] -= mean[i];
+}
+
+// dst[i] -= mean[i % step]
+void subtractRepeated(float *dst, const float *mean, size_t size) {
+    for (size_t i = callKernel(MeanKernels::get().repeated.get(), dst, mean, size); i < size; i++)
+        dst[i] -= mean[i % jit_mean_kernel::step];
+}
+
+int getBlockSize(mkldnn::memory::format format) {
+    return format == mkldnn::memory::nChw8c ? 8 : format == mkldnn::memory::nChw16c ? 16 : 1;
+}
+
+}  // namespace
 
 MeanImage::MeanImage() : meanBuffer(nullptr) {
 }
@@ -70,35 +207,91 @@ void MeanImage::Load(const MKLDNNDims& inputDims, InputInfo::Ptr inputInfo) {
     }
 }
 
+void MeanImage::setFormat(mkldnn::memory::format format) {
+    this->format = format;
+    blockedMean.clear();
+
+    int blockSize = getBlockSize(format);
+    if (blockSize == 1 || !meanBuffer || !meanBuffer->size())
+        return;
+
+    // the mean image is CHW
+    const float *mean = meanBuffer->readOnly();
+    int C = static_cast<int>(meanBuffer->dims()[2]);
+    int HW = static_cast<int>(meanBuffer->size()) / C;
+    int CB = mkldnn::impl::utils::div_up(C, blockSize);
+    blockedMean.assign(CB * HW * blockSize, 0.0f);
+    for (int cb = 0; cb < CB; cb++) {
+        for (int p = 0; p < HW; p++) {
+            for (int l = 0; l < blockSize && cb * blockSize + l < C; l++)
+                blockedMean[(cb * HW + p) * blockSize + l] = mean[(cb * blockSize + l) * HW + p];
+        }
+    }
+}
+
 void MeanImage::Subtract(const MKLDNNDims &inputDims, float *input) {
     IE_ASSERT(input != nullptr);
 
     if (inputDims.ndims() != 4) {
         THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
     }
+    if (format != mkldnn::memory::nchw && format != mkldnn::memory::nhwc &&
+            format != mkldnn::memory::nChw8c && format != mkldnn::memory::nChw16c) {
+        THROW_IE_EXCEPTION << "Unsupported format of the input for the mean subtraction: " << format;
+    }
+
+    // the planes are split to the chunks, so the work is shared between threads for a single image too
+    const int chunkSize = 4096;
 
     int MB = inputDims[0];
-    int srcSize = inputDims.size() / MB;
+    int C = inputDims[1];
+    int HW = inputDims[2] * inputDims[3];
+    int blockSize = getBlockSize(format);
+    int CB = mkldnn::impl::utils::div_up(C, blockSize);
+    // the channels of the blocked formats are padded
+    int imageSize = CB * blockSize * HW;
 
     if (meanBuffer && meanBuffer->size()) {
         const float * meanBufferValues = meanBuffer->readOnly();
-#   pragma omp parallel for collapse(2) schedule(static)
-        for (int mb = 0; mb < MB; mb++) {
-            for (int i = 0; i < srcSize; i++) {
-                input[srcSize * mb + i] -= meanBufferValues[i];
-            }
+        if (format == mkldnn::memory::nhwc) {
+            parallel_for2d(MB, HW, [&](int mb, int p) {
+                float *dst = input + (mb * HW + p) * C;
+                for (int c = 0; c < C; c++)
+                    dst[c] -= meanBufferValues[c * HW + p];
+            });
+            return;
         }
+
+        // the input and the mean have the same layout
+        const float *mean = blockSize == 1 ? meanBufferValues : blockedMean.data();
+        int chunks = mkldnn::impl::utils::div_up(imageSize, chunkSize);
+        parallel_for2d(MB, chunks, [&](int mb, int b) {
+            int start = b * chunkSize;
+            int end = std::min(start + chunkSize, imageSize);
+            subtractImage(input + mb * imageSize + start, mean + start, end - start);
+        });
     } else if (!meanValues.empty()) {
-        int C = inputDims[1];
-        srcSize /= inputDims[1];
-
-#   pragma omp parallel for collapse(3) schedule(static)
-        for (int mb = 0; mb < MB; mb++) {
-            for (int c = 0; c < C; c++) {
-                for (int i = 0; i < srcSize; i++) {
-                    input[srcSize * mb * C + c * srcSize + i] -= meanValues[c];
-                }
-            }
+        if (format == mkldnn::memory::nhwc) {
+            parallel_for2d(MB, HW, [&](int mb, int p) {
+                float *dst = input + (mb * HW + p) * C;
+                for (int c = 0; c < C; c++)
+                    dst[c] -= meanValues[c];
+            });
+            return;
         }
+
+        // a plane of nchw or a block of the channels is contiguous, its values repeat with the period of step
+        int planeSize = HW * blockSize;
+        int chunks = mkldnn::impl::utils::div_up(planeSize, chunkSize);
+        parallel_for3d(MB, CB, chunks, [&](int mb, int cb, int b) {
+            float mean[jit_mean_kernel::step];
+            for (int i = 0; i < static_cast<int>(jit_mean_kernel::step); i++) {
+                int c = cb * blockSize + i % blockSize;
+                mean[i] = c < C ? meanValues[c] : 0.0f;
+            }
+            int start = b * chunkSize;
+            int end = std::min(start + chunkSize, planeSize);
+            subtractRepeated(input + mb * imageSize + cb * planeSize + start, mean, end - start);
+        });
     }
 }
@@ -7,8 +7,11 @@
 
 #include "inference_engine.hpp"
 #include "mkldnn_dims.h"
+#include "ie_parallel.hpp"
+#include <mkldnn.hpp>
 #include <vector>
 #include <limits>
+#include <algorithm>
 
 namespace MKLDNNPlugin {
 
@@ -18,6 +21,17 @@ public:
 
 public:
     void Load(const MKLDNNDims& inputDims, InferenceEngine::InputInfo::Ptr inputInfo);
+
+    /**
+     * @brief Sets the format of the input memory the mean is subtracted from (nchw by default), the mean image is
+     * reordered to the blocked formats here, so Subtract reads both the input and the mean sequentially
+     */
+    void setFormat(mkldnn::memory::format format);
+
+    /**
+     * @brief Subtracts the mean from the FP32 input of the format set by setFormat: nchw, nhwc, nChw8c or nChw16c.
+     * The planar and blocked data are processed by the vector kernel for the best ISA of the machine.
+     */
     void Subtract(const MKLDNNDims &inputDims, float *input);
 
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
@@ -33,32 +47,87 @@ public:
 
         if (meanBuffer && meanBuffer->size()) {
             const float * meanBufferValues = meanBuffer->readOnly();
-        #   pragma omp parallel for collapse(2) schedule(static)
-            for (int mb = 0; mb < MB; mb++) {
-                for (int i = 0; i < srcSize; i++) {
-                    int buf = input[srcSize * mb + i];
-                    buf -= meanBufferValues[i];
-                    if (buf < std::numeric_limits<T>::min()) buf = std::numeric_limits<T>::min();
-                    if (buf > std::numeric_limits<T>::max()) buf = std::numeric_limits<T>::max();
-                    input[srcSize * mb + i] = buf;
-                }
-            }
+            InferenceEngine::parallel_for2d(MB, srcSize, [&](int mb, int i) {
+                int buf = input[srcSize * mb + i];
+                buf -= meanBufferValues[i];
+                if (buf < std::numeric_limits<T>::min()) buf = std::numeric_limits<T>::min();
+                if (buf > std::numeric_limits<T>::max()) buf = std::numeric_limits<T>::max();
+                input[srcSize * mb + i] = buf;
+            });
         } else if (!meanValues.empty()) {
             int C = inputDims[1];
             srcSize /= inputDims[1];
 
-        #   pragma omp parallel for collapse(3) schedule(static)
-            for (int mb = 0; mb < MB; mb++) {
-                for (int c = 0; c < C; c++) {
-                    for (int i = 0; i < srcSize; i++) {
-                        int buf = input[srcSize * mb * C + c * srcSize + i];
-                        buf -= meanValues[c];
-                        if (buf < std::numeric_limits<T>::min()) buf = std::numeric_limits<T>::min();
-                        if (buf > std::numeric_limits<T>::max()) buf = std::numeric_limits<T>::max();
-                        input[srcSize * mb * C + c * srcSize + i] = buf;
-                    }
+            InferenceEngine::parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
+                int buf = input[srcSize * mb * C + c * srcSize + i];
+                buf -= meanValues[c];
+                if (buf < std::numeric_limits<T>::min()) buf = std::numeric_limits<T>::min();
+                if (buf > std::numeric_limits<T>::max()) buf = std::numeric_limits<T>::max();
+                input[srcSize * mb * C + c * srcSize + i] = buf;
+            });
+        }
+    }
+
+    /**
+     * @brief Converts the NxCxHxW input to FP32 and subtracts the mean in a single pass, so no intermediate
+     * FP32 copy of the input is needed. If no mean is loaded, the input is only converted.
+     */
+    template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
+    void Subtract(const MKLDNNDims &inputDims, const T *input, float *output) {
+        IE_ASSERT(input != nullptr && output != nullptr);
+
+        // the planes are split to the blocks, so the work is shared between threads for a single image too
+        // and the inner loop over the contiguous data is vectorized
+        const int blockSize = 4096;
+
+        int MB = inputDims[0];
+        int srcSize = inputDims.size() / MB;
+
+        if (meanBuffer && meanBuffer->size()) {
+            if (inputDims.ndims() != 4) {
+                THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
+            }
+            const float * meanBufferValues = meanBuffer->readOnly();
+            int blocks = (srcSize + blockSize - 1) / blockSize;
+
+            InferenceEngine::parallel_for2d(MB, blocks, [&](int mb, int b) {
+                int start = b * blockSize;
+                int end = std::min(start + blockSize, srcSize);
+                const T *src = input + srcSize * mb;
+                float *dst = output + srcSize * mb;
+                for (int i = start; i < end; i++) {
+                    dst[i] = static_cast<float>(src[i]) - meanBufferValues[i];
                 }
+            });
+        } else if (!meanValues.empty()) {
+            if (inputDims.ndims() != 4) {
+                THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
             }
+            int C = inputDims[1];
+            srcSize /= inputDims[1];
+            int blocks = (srcSize + blockSize - 1) / blockSize;
+
+            InferenceEngine::parallel_for3d(MB, C, blocks, [&](int mb, int c, int b) {
+                int start = b * blockSize;
+                int end = std::min(start + blockSize, srcSize);
+                const T *src = input + srcSize * mb * C + c * srcSize;
+                float *dst = output + srcSize * mb * C + c * srcSize;
+                const float mean = meanValues[c];
+                for (int i = start; i < end; i++) {
+                    dst[i] = static_cast<float>(src[i]) - mean;
+                }
+            });
+        } else {
+            int size = srcSize * MB;
+            int blocks = (size + blockSize - 1) / blockSize;
+
+            InferenceEngine::parallel_for(blocks, [&](int b) {
+                int start = b * blockSize;
+                int end = std::min(start + blockSize, size);
+                for (int i = start; i < end; i++) {
+                    output[i] = static_cast<float>(input[i]);
+                }
+            });
         }
     }
 
@@ -66,6 +135,10 @@ private:
     std::vector<float> meanValues;
 
     InferenceEngine::TBlob<float>::Ptr meanBuffer;
+
+    mkldnn::memory::format format = mkldnn::memory::nchw;
+    // the mean image in the blocked format, the padded channels are zeros
+    std::vector<float> blockedMean;
 };
 
 }  // namespace MKLDNNPlugin
@@ -305,6 +305,117 @@ void OpenMpManager::bindOpenMpThreads(int env_cores) {
     }
 }
 
+// Limits the OpenMP team of the calling thread to numCores threads and
+// pins them to the logical cores [firstCore, firstCore + numCores)
+void OpenMpManager::bindOpenMpThreadsToCores(int firstCore, int numCores) {
+    OpenMpManager &openMpManager = getInstance();
+
+    omp_set_num_threads(numCores);
+    if (!openMpManager.isThreadsBindAllowed())
+        return;
+
+    int totalNumberOfAvailableCores = CPU_COUNT(&openMpManager.currentCoreSet);
+    if (firstCore + numCores > totalNumberOfAvailableCores)
+        return;
+
+    #pragma omp parallel
+    {
+        unsigned logicalCoreId = firstCore + omp_get_thread_num();
+        openMpManager.bindCurrentThreadToLogicalCoreCpu(logicalCoreId);
+    }
+}
+
+// Limits the OpenMP team of the calling thread to the size of logicalCores and
+// pins the i-th thread of the team to the i-th core of the list
+void OpenMpManager::bindOpenMpThreadsToCores(const std::vector<int> &logicalCores) {
+    OpenMpManager &openMpManager = getInstance();
+
+    if (logicalCores.empty())
+        return;
+
+    omp_set_num_threads(static_cast<int>(logicalCores.size()));
+    if (!openMpManager.isThreadsBindAllowed())
+        return;
+
+    #pragma omp parallel
+    {
+        int thread = omp_get_thread_num();
+        if (thread < static_cast<int>(logicalCores.size()))
+            openMpManager.bindCurrentThreadToLogicalCoreCpu(logicalCores[thread]);
+    }
+}
+
+// Pins the calling thread to all the hyper-threads of the logical cores, so the thread which owns
+// the OpenMP team bound to them (and the memory it touches first) stays on their node too
+void OpenMpManager::bindCurrentThreadToCores(const std::vector<int> &logicalCores) {
+    OpenMpManager &openMpManager = getInstance();
+
+    if (logicalCores.empty() || !openMpManager.isThreadsBindAllowed())
+        return;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int logicalCoreId : logicalCores)
+        openMpManager.selectAllCoreCpus(&set, openMpManager.getPhysicalCoreId(logicalCoreId));
+    sched_setaffinity(0, sizeof(set), &set);
+}
+
+// Returns the logical cores (see bindOpenMpThreadsToCores) which belong to the socket,
+// the socket is the "physical id" reported by /proc/cpuinfo
+std::vector<int> OpenMpManager::getSocketCores(int socket) {
+    OpenMpManager &openMpManager = getInstance();
+
+    std::vector<int> cores;
+    int totalNumberOfAvailableCores = CPU_COUNT(&openMpManager.currentCoreSet);
+    for (int logicalCoreId = 0; logicalCoreId < totalNumberOfAvailableCores; logicalCoreId++) {
+        unsigned processorId = openMpManager.getPhysicalCoreId(logicalCoreId);
+        if (static_cast<int>(openMpManager.collection.getProcessor(processorId).physicalId) == socket)
+            cores.push_back(logicalCoreId);
+    }
+    return cores;
+}
+
+// Returns the processors of the OS available to the process which are not the ones of the logical cores,
+// all the hyper-threads of a core are taken by it
+std::vector<int> OpenMpManager::getOtherProcessors(const std::vector<int> &logicalCores) {
+    OpenMpManager &openMpManager = getInstance();
+
+    cpu_set_t usedCpuSet;
+    CPU_ZERO(&usedCpuSet);
+    for (int logicalCoreId : logicalCores)
+        openMpManager.selectAllCoreCpus(&usedCpuSet, openMpManager.getPhysicalCoreId(logicalCoreId));
+
+    std::vector<int> processors;
+    unsigned numberOfProcessors = openMpManager.collection.getNumberOfProcessors();
+    for (unsigned processorId = 0; processorId < numberOfProcessors; processorId++) {
+        if (CPU_ISSET(processorId, &openMpManager.currentCpuSet) && !CPU_ISSET(processorId, &usedCpuSet))
+            processors.push_back(static_cast<int>(processorId));
+    }
+    return processors;
+}
+
+// Returns the socket the calling thread is restricted to or -1 if it may run on several sockets
+int OpenMpManager::getCurrentThreadSocket() {
+    OpenMpManager &openMpManager = getInstance();
+
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(set), &set))
+        return -1;
+
+    int socket = -1;
+    unsigned numberOfProcessors = openMpManager.collection.getNumberOfProcessors();
+    for (unsigned processorId = 0; processorId < numberOfProcessors; processorId++) {
+        if (!CPU_ISSET(processorId, &set))
+            continue;
+        int processorSocket = static_cast<int>(openMpManager.collection.getProcessor(processorId).physicalId);
+        if (socket == -1)
+            socket = processorSocket;
+        else if (socket != processorSocket)
+            return -1;
+    }
+    return socket;
+}
+
 int OpenMpManager::getOpenMpThreadNumber() {
     OpenMpManager &openMpManager = getInstance();
 
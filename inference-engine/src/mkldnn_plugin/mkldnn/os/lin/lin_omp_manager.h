@@ -132,6 +132,18 @@ public:
 
     static void bindOpenMpThreads(int env_cores = 0);
 
+    static void bindOpenMpThreadsToCores(int firstCore, int numCores);
+
+    static void bindOpenMpThreadsToCores(const std::vector<int> &logicalCores);
+
+    static void bindCurrentThreadToCores(const std::vector<int> &logicalCores);
+
+    static std::vector<int> getSocketCores(int socket);
+
+    static std::vector<int> getOtherProcessors(const std::vector<int> &logicalCores);
+
+    static int getCurrentThreadSocket();
+
     static int getOpenMpThreadNumber();
 
     static void printVerboseInformation();
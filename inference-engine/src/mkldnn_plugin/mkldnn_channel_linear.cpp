@@ -0,0 +1,74 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_channel_linear.h"
+#include <ie_layers.h>
+#include <cmath>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNChannelLinear::fromNode(const MKLDNNNodePtr &node, size_t channels, MKLDNNChannelLinear &linear) {
+    const CNNLayerPtr &layer = node->getCnnLayer();
+    if (!layer || layer->outData.empty() || layer->outData[0]->getPrecision() != Precision::FP32)
+        return false;
+
+    auto isSutableBlob = [&](const Blob::Ptr &blob) {
+        return blob && blob->precision() == Precision::FP32 && (blob->size() == 1 || blob->size() == channels);
+    };
+    auto getValue = [](const Blob::Ptr &blob, size_t c) {
+        const float *data = blob->cbuffer().as<const float *>();
+        return blob->size() == 1 ? data[0] : data[c];
+    };
+
+    linear.scales.assign(channels, 1.0f);
+    linear.shifts.assign(channels, 0.0f);
+
+    if (node->getType() == Depthwise) {
+        auto *scshLayer = dynamic_cast<ScaleShiftLayer *>(layer.get());
+        if (!scshLayer || (scshLayer->_weights && !isSutableBlob(scshLayer->_weights)) ||
+                (scshLayer->_biases && !isSutableBlob(scshLayer->_biases)))
+            return false;
+        for (size_t c = 0; c < channels; c++) {
+            if (scshLayer->_weights)
+                linear.scales[c] = getValue(scshLayer->_weights, c);
+            if (scshLayer->_biases)
+                linear.shifts[c] = getValue(scshLayer->_biases, c);
+        }
+        return true;
+    }
+
+    if (node->getType() == BatchNormalization) {
+        // the weights are the variances and the biases are the means
+        auto *bnLayer = dynamic_cast<BatchNormalizationLayer *>(layer.get());
+        if (!bnLayer || !isSutableBlob(bnLayer->_weights) || !isSutableBlob(bnLayer->_biases))
+            return false;
+        for (size_t c = 0; c < channels; c++) {
+            linear.scales[c] = 1.0f / std::sqrt(getValue(bnLayer->_weights, c) + bnLayer->epsilon);
+            linear.shifts[c] = -getValue(bnLayer->_biases, c) * linear.scales[c];
+        }
+        return true;
+    }
+
+    if (node->getType() == Power) {
+        auto *powerLayer = dynamic_cast<PowerLayer *>(layer.get());
+        if (!powerLayer || powerLayer->power != 1.0f)
+            return false;
+        linear.scales.assign(channels, powerLayer->scale);
+        linear.shifts.assign(channels, powerLayer->offset);
+        return true;
+    }
+
+    return false;
+}
+
+bool MKLDNNChannelLinear::hasShifts() const {
+    for (float shift : shifts) {
+        if (shift != 0.0f)
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include "mkldnn_node.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The layer computing y = scales[c] * x + shifts[c] for every channel c of the data: ScaleShift,
+ * BatchNormalization of the inference (with the precomputed mean and variance) and Power with the power 1.
+ * Such layers are folded into the weights and the biases of the adjacent convolution or fully connected layer.
+ */
+struct MKLDNNChannelLinear {
+    std::vector<float> scales;
+    std::vector<float> shifts;
+
+    /**
+     * @brief Gets the transformation of the node for the given number of channels, the single values of the
+     * layer are broadcasted to all the channels
+     * @return false if the node is not linear or its values do not fit the channels
+     */
+    static bool fromNode(const MKLDNNNodePtr &node, size_t channels, MKLDNNChannelLinear &linear);
+
+    bool hasShifts() const;
+};
+
+}  // namespace MKLDNNPlugin
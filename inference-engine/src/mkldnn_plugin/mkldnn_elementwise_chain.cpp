@@ -0,0 +1,311 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_elementwise_chain.h"
+#include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "jit_generator.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl::cpu;
+using namespace Xbyak;
+
+namespace {
+
+struct jit_elementwise_call_args {
+    const float * const *src;
+    float *dst;
+    size_t start;
+    // the number of the elements, the multiple of the vector length
+    size_t work_amount;
+};
+
+#define GET_OFF(field) offsetof(jit_elementwise_call_args, field)
+
+struct jit_uni_elementwise_kernel : public jit_generator {
+    explicit jit_uni_elementwise_kernel(size_t code_size): jit_generator(nullptr, code_size) {}
+
+    void (*ker_)(const jit_elementwise_call_args *) = nullptr;
+    size_t simd_w = 1;
+    std::string isa_name;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_elementwise_kernel_f32 : public jit_uni_elementwise_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_elementwise_kernel_f32)
+
+    explicit jit_uni_elementwise_kernel_f32(const std::vector<MKLDNNElementwiseChain::Op> &ops)
+            : jit_uni_elementwise_kernel(4096 + ops.size() * 256) {
+        simd_w = vlen / sizeof(float);
+        isa_name = isa == sse42 ? "sse42" : isa == avx2 ? "avx2" : "avx512";
+
+        preamble();
+
+        mov(reg_src, ptr[param1 + GET_OFF(src)]);
+        mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+        mov(reg_offt, ptr[param1 + GET_OFF(start)]);
+        shl(reg_offt, 2);
+        mov(reg_work_amount, ptr[param1 + GET_OFF(work_amount)]);
+        mov(reg_table, l_table);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        Label l_loop, l_exit;
+        L(l_loop);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(l_exit, T_NEAR);
+
+            load(vmm_acc, 0);
+            for (const auto &op : ops)
+                compute(op);
+            uni_vmovups(ptr[reg_dst + reg_offt], vmm_acc);
+
+            add(reg_offt, vlen);
+            sub(reg_work_amount, simd_w);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_exit);
+
+        postamble();
+
+        // every constant is repeated for the whole vector, so the operations take it from the memory
+        align(64);
+        L(l_table);
+        for (float value : constants) {
+            for (size_t i = 0; i < simd_w; i++)
+                dd(float2int(value));
+        }
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse42, Xmm, isa == avx2, Ymm, Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_offt = r10;
+    Reg64 reg_work_amount = r11;
+    Reg64 reg_input = r12;
+    Reg64 reg_table = r13;
+
+    Vmm vmm_acc = Vmm(0);
+    Vmm vmm_operand = Vmm(1);
+    Vmm vmm_aux = Vmm(2);
+    Vmm vmm_zero = Vmm(3);
+
+    Label l_table;
+    std::vector<float> constants;
+
+    Address constant(float value) {
+        constants.push_back(value);
+        return ptr[reg_table + (constants.size() - 1) * vlen];
+    }
+
+    void load(const Vmm &vmm, size_t input) {
+        mov(reg_input, ptr[reg_src + input * sizeof(float *)]);
+        uni_vmovups(vmm, ptr[reg_input + reg_offt]);
+    }
+
+    void compute(const MKLDNNElementwiseChain::Op &op) {
+        const Vmm &x = op.onOperand ? vmm_operand : vmm_acc;
+        switch (op.type) {
+            case MKLDNNElementwiseChain::Load:
+                load(vmm_operand, op.input);
+                break;
+            case MKLDNNElementwiseChain::Sum:
+                if (op.alpha != 1.0f)
+                    uni_vmulps(vmm_operand, vmm_operand, constant(op.alpha));
+                uni_vaddps(vmm_acc, vmm_acc, vmm_operand);
+                break;
+            case MKLDNNElementwiseChain::Prod:
+                uni_vmulps(vmm_acc, vmm_acc, vmm_operand);
+                break;
+            case MKLDNNElementwiseChain::Max:
+                uni_vmaxps(vmm_acc, vmm_acc, vmm_operand);
+                break;
+            case MKLDNNElementwiseChain::Linear:
+                if (op.alpha != 1.0f)
+                    uni_vmulps(x, x, constant(op.alpha));
+                if (op.beta != 0.0f)
+                    uni_vaddps(x, x, constant(op.beta));
+                break;
+            case MKLDNNElementwiseChain::Relu:
+                if (op.alpha != 0.0f) {
+                    uni_vmovups(vmm_aux, x);
+                    uni_vminps(vmm_aux, vmm_aux, vmm_zero);
+                    uni_vmulps(vmm_aux, vmm_aux, constant(op.alpha));
+                }
+                uni_vmaxps(x, x, vmm_zero);
+                if (op.alpha != 0.0f)
+                    uni_vaddps(x, x, vmm_aux);
+                break;
+            case MKLDNNElementwiseChain::Clamp:
+                uni_vmaxps(x, x, constant(op.beta));
+                uni_vminps(x, x, constant(op.alpha));
+                break;
+            case MKLDNNElementwiseChain::Abs:
+                uni_vmovups(vmm_aux, vmm_zero);
+                uni_vsubps(vmm_aux, vmm_aux, x);
+                uni_vmaxps(x, x, vmm_aux);
+                break;
+            case MKLDNNElementwiseChain::Square:
+                uni_vmulps(x, x, x);
+                break;
+            case MKLDNNElementwiseChain::Sqrt:
+                uni_vsqrtps(x, x);
+                break;
+        }
+    }
+};
+
+}  // namespace
+
+struct MKLDNNElementwiseChain::Kernel {
+    std::unique_ptr<jit_uni_elementwise_kernel> jit;
+};
+
+MKLDNNElementwiseChain::MKLDNNElementwiseChain() = default;
+
+MKLDNNElementwiseChain::~MKLDNNElementwiseChain() = default;
+
+void MKLDNNElementwiseChain::clear() {
+    ops.clear();
+    kernel.reset();
+}
+
+bool MKLDNNElementwiseChain::empty() const {
+    return ops.empty();
+}
+
+void MKLDNNElementwiseChain::addLoad(size_t input) {
+    if (kernel)
+        THROW_IE_EXCEPTION << "Cannot change the compiled elementwise chain.";
+    if (input == 0)
+        THROW_IE_EXCEPTION << "The input 0 of the elementwise chain is the initial value of the accumulator.";
+    ops.push_back({Load, input, false, 1.0f, 0.0f});
+}
+
+void MKLDNNElementwiseChain::addBinary(OpType type, float alpha) {
+    if (kernel)
+        THROW_IE_EXCEPTION << "Cannot change the compiled elementwise chain.";
+    if (type != Sum && type != Prod && type != Max)
+        THROW_IE_EXCEPTION << "Unsupported binary operation of the elementwise chain.";
+    if (ops.empty() || (ops.back().type != Load && !ops.back().onOperand))
+        THROW_IE_EXCEPTION << "The binary operation of the elementwise chain doesn't follow the load of the operand.";
+    ops.push_back({type, 0, false, alpha, 0.0f});
+}
+
+void MKLDNNElementwiseChain::addUnary(OpType type, float alpha, float beta, bool onOperand) {
+    if (kernel)
+        THROW_IE_EXCEPTION << "Cannot change the compiled elementwise chain.";
+    if (type == Load || type == Sum || type == Prod || type == Max)
+        THROW_IE_EXCEPTION << "Unsupported unary operation of the elementwise chain.";
+    ops.push_back({type, 0, onOperand, alpha, beta});
+}
+
+size_t MKLDNNElementwiseChain::getInputsCount() const {
+    size_t count = 1;
+    for (const auto &op : ops) {
+        if (op.type == Load)
+            count = (std::max)(count, op.input + 1);
+    }
+    return count;
+}
+
+void MKLDNNElementwiseChain::compile() {
+    if (kernel)
+        return;
+
+    kernel.reset(new Kernel());
+    if (mayiuse(avx512_common)) {
+        kernel->jit.reset(new jit_uni_elementwise_kernel_f32<avx512_common>(ops));
+    } else if (mayiuse(avx2)) {
+        kernel->jit.reset(new jit_uni_elementwise_kernel_f32<avx2>(ops));
+    } else if (mayiuse(sse42)) {
+        kernel->jit.reset(new jit_uni_elementwise_kernel_f32<sse42>(ops));
+    }
+}
+
+std::string MKLDNNElementwiseChain::getIsaName() const {
+    return kernel && kernel->jit ? kernel->jit->isa_name : "ref";
+}
+
+void MKLDNNElementwiseChain::executeRef(const float * const *src, float *dst, size_t start, size_t end) const {
+    for (size_t i = start; i < end; i++) {
+        float acc = src[0][i];
+        float operand = 0.0f;
+        for (const auto &op : ops) {
+            float &x = op.onOperand ? operand : acc;
+            switch (op.type) {
+                case Load:   operand = src[op.input][i]; break;
+                case Sum:    acc += op.alpha * operand; break;
+                case Prod:   acc *= operand; break;
+                case Max:    acc = (std::max)(acc, operand); break;
+                case Linear: x = op.alpha * x + op.beta; break;
+                case Relu:   x = (std::max)(x, 0.0f) + op.alpha * (std::min)(x, 0.0f); break;
+                case Clamp:  x = (std::min)((std::max)(x, op.beta), op.alpha); break;
+                case Abs:    x = std::fabs(x); break;
+                case Square: x = x * x; break;
+                case Sqrt:   x = std::sqrt(x); break;
+            }
+        }
+        dst[i] = acc;
+    }
+}
+
+void MKLDNNElementwiseChain::execute(const std::vector<const float *> &src, float *dst, size_t size) const {
+    if (src.size() < getInputsCount())
+        THROW_IE_EXCEPTION << "The elementwise chain reads " << getInputsCount() << " inputs, but only "
+                           << src.size() << " are provided.";
+
+    const jit_uni_elementwise_kernel *jit = kernel ? kernel->jit.get() : nullptr;
+    const size_t simd_w = jit ? jit->simd_w : 1;
+    const size_t vectors = size / simd_w;
+
+    // the vectors are split between the threads, the tail of the last vector is computed by the last thread
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(vectors, nthr, ithr, start, end);
+        start *= simd_w;
+        end *= simd_w;
+
+        if (jit && end > start) {
+            jit_elementwise_call_args args;
+            args.src = src.data();
+            args.dst = dst;
+            args.start = start;
+            args.work_amount = end - start;
+            jit->ker_(&args);
+        } else {
+            executeRef(src.data(), dst, start, end);
+        }
+
+        if (ithr == nthr - 1)
+            executeRef(src.data(), dst, vectors * simd_w, size);
+    });
+}
+
+void MKLDNNElementwiseChain::executeSequential(const float * const *src, float *dst, size_t size) const {
+    const jit_uni_elementwise_kernel *jit = kernel ? kernel->jit.get() : nullptr;
+    const size_t vectorized = jit ? size / jit->simd_w * jit->simd_w : 0;
+
+    if (vectorized) {
+        jit_elementwise_call_args args;
+        args.src = src;
+        args.dst = dst;
+        args.start = 0;
+        args.work_amount = vectorized;
+        jit->ker_(&args);
+    }
+    executeRef(src, dst, vectorized, size);
+}
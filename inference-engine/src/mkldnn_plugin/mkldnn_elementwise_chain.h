@@ -0,0 +1,97 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The chain of the elementwise operations over the inputs of the same shape and layout.
+ * The chain is compiled to one JIT kernel for AVX-512, AVX2 or SSE4.2, so the fused Eltwise, Power and
+ * Activation layers read every input and write the output in one pass over the memory.
+ * The value is computed in the accumulator which is initialized by the input 0. The Load operation reads
+ * one more input to the operand, the binary operations combine the operand with the accumulator and
+ * the unary operations are applied to the accumulator or to the operand.
+ */
+class MKLDNNElementwiseChain {
+public:
+    enum OpType {
+        Load,       // operand = src[input]
+        Sum,        // acc = acc + alpha * operand
+        Prod,       // acc = acc * operand
+        Max,        // acc = max(acc, operand)
+        Linear,     // x = alpha * x + beta
+        Relu,       // x = max(x, 0) + alpha * min(x, 0)
+        Clamp,      // x = min(max(x, beta), alpha)
+        Abs,        // x = |x|
+        Square,     // x = x * x
+        Sqrt        // x = sqrt(x)
+    };
+
+    struct Op {
+        OpType type;
+        size_t input;
+        // the unary operation is applied to the operand instead of the accumulator
+        bool onOperand;
+        float alpha;
+        float beta;
+    };
+
+    MKLDNNElementwiseChain();
+    ~MKLDNNElementwiseChain();
+
+    void clear();
+    bool empty() const;
+
+    void addLoad(size_t input);
+    void addBinary(OpType type, float alpha = 1.0f);
+    void addUnary(OpType type, float alpha = 1.0f, float beta = 0.0f, bool onOperand = false);
+
+    const std::vector<Op>& getOps() const {
+        return ops;
+    }
+
+    /**
+     * @brief The number of the inputs read by the chain
+     */
+    size_t getInputsCount() const;
+
+    /**
+     * @brief Generates the kernel for the best ISA of the machine, the chain can't be changed after that
+     */
+    void compile();
+
+    /**
+     * @brief Computes size elements of the output in parallel, the memory of dst may be the memory of src[0]
+     */
+    void execute(const std::vector<const float *> &src, float *dst, size_t size) const;
+
+    /**
+     * @brief Computes size elements of the output in the calling thread
+     */
+    void executeSequential(const float * const *src, float *dst, size_t size) const;
+
+    /**
+     * @brief Computes the elements [start, end) without the JIT kernel
+     */
+    void executeRef(const float * const *src, float *dst, size_t start, size_t end) const;
+
+    /**
+     * @brief The name of the ISA of the compiled kernel or "ref"
+     */
+    std::string getIsaName() const;
+
+private:
+    struct Kernel;
+
+    std::vector<Op> ops;
+    std::shared_ptr<Kernel> kernel;
+};
+
+}  // namespace MKLDNNPlugin
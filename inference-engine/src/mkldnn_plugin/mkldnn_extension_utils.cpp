@@ -6,6 +6,12 @@
 #include "mkldnn_extension_utils.h"
 #include <limits>
 #include <vector>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#define XBYAK_NO_OP_NAMES
+#include "../../thirdparty/mkl-dnn/src/cpu/xbyak/xbyak_util.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -38,6 +44,8 @@ memory::data_type MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::P
             return memory::s8;
         case InferenceEngine::Precision::U8:
             return memory::u8;
+        case InferenceEngine::Precision::I32:
+            return memory::s32;
 
         default: {
             THROW_IE_EXCEPTION << "The plugin does not support " << prec.name();
@@ -49,6 +57,14 @@ InferenceEngine::Precision MKLDNNExtensionUtils::DataTypeToIEPrecision(memory::d
     switch (dataType) {
         case memory::f32:
             return InferenceEngine::Precision(InferenceEngine::Precision::FP32);
+        case memory::u8:
+            return InferenceEngine::Precision(InferenceEngine::Precision::U8);
+        case memory::s8:
+            return InferenceEngine::Precision(InferenceEngine::Precision::I8);
+        case memory::s16:
+            return InferenceEngine::Precision(InferenceEngine::Precision::I16);
+        case memory::s32:
+            return InferenceEngine::Precision(InferenceEngine::Precision::I32);
 
         default: {
             THROW_IE_EXCEPTION << "Unsupported data type.";
@@ -211,3 +227,60 @@ bool MKLDNNExtensionUtils::initTensorsAreEqual(InferenceEngine::TensorDesc desc1
     return !(in1Block.getOffsetPadding() != in2Block.getOffsetPadding() &&
         in1Block.getOffsetPadding() != uninitNum && in2Block.getOffsetPadding() != uninitNum);
 }
+
+uint64_t MKLDNNExtensionUtils::hashData(const void *data, size_t size, uint64_t seed) {
+    // FNV-1a over 64-bit words, the tail is processed byte by byte
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t hash = seed;
+
+    auto bytes = reinterpret_cast<const uint8_t *>(data);
+    size_t words = size / sizeof(uint64_t);
+    for (size_t i = 0; i < words; i++) {
+        uint64_t word;
+        memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+        hash = (hash ^ word) * prime;
+    }
+    for (size_t i = words * sizeof(uint64_t); i < size; i++) {
+        hash = (hash ^ bytes[i]) * prime;
+    }
+    return hash;
+}
+
+std::string MKLDNNExtensionUtils::getIsaName() {
+    using namespace Xbyak::util;
+    static const Cpu cpu;
+    static const std::vector<std::pair<Cpu::Type, const char *>> isaList = {
+        { Cpu::tSSE42, "sse42" },
+        { Cpu::tAVX2, "avx2" },
+        { Cpu::tAVX512F, "avx512f" },
+        { Cpu::tAVX512CD, "avx512cd" },
+        { Cpu::tAVX512BW, "avx512bw" },
+        { Cpu::tAVX512DQ, "avx512dq" },
+        { Cpu::tAVX512VL, "avx512vl" },
+        { Cpu::tAVX512_4FMAPS, "avx512_4fmaps" },
+        { Cpu::tAVX512_4VNNIW, "avx512_4vnniw" },
+        { Cpu::tAVX512_VNNI, "avx512_vnni" },
+    };
+
+    std::string isa;
+    for (auto &item : isaList) {
+        if (cpu.has(item.first))
+            isa += std::string(isa.empty() ? "" : "_") + item.second;
+    }
+    return isa.empty() ? "generic" : isa;
+}
+
+void *MKLDNNExtensionUtils::getBlobData(const InferenceEngine::Blob::Ptr &blob) {
+    return blob->buffer().as<uint8_t *>() +
+           blob->getTensorDesc().getBlockingDesc().getOffsetPadding() * blob->element_size();
+}
+
+InferenceEngine::TensorDesc MKLDNNExtensionUtils::getDenseTensorDesc(const InferenceEngine::TensorDesc &desc) {
+    const InferenceEngine::BlockingDesc &blockingDesc = desc.getBlockingDesc();
+    if (desc.getLayout() == InferenceEngine::Layout::ANY || blockingDesc.getBlockDims().empty())
+        return desc;
+    InferenceEngine::TensorDesc dense(desc.getPrecision(), desc.getDims(),
+                                      {blockingDesc.getBlockDims(), blockingDesc.getOrder()});
+    dense.setLayout(desc.getLayout());
+    return dense;
+}
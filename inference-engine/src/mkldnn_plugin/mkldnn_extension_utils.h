@@ -29,6 +29,22 @@ public:
     static InferenceEngine::MKLDNNPlugin::MemoryFormat MKLFormatToMemoryFormat(mkldnn::memory::dims dims, mkldnn::memory::format fmt);
     static mkldnn::memory::format MemoryFormatToMKLFormat(InferenceEngine::MKLDNNPlugin::MemoryFormat fmt);
     static InferenceEngine::MKLDNNPlugin::MKLDNNPrimitiveMemory MKLMemoryToGenericMemory(const MKLDNNMemory& mem);
+    /**
+     * @brief FNV-1a hash of the data, the seed allows to continue hashing of the previous data
+     */
+    static uint64_t hashData(const void *data, size_t size, uint64_t seed = 0xcbf29ce484222325ULL);
+    /**
+     * @brief Name of the instruction set extensions available on the machine, e.g. "sse42_avx2"
+     */
+    static std::string getIsaName();
+    /**
+     * @brief The first element of the blob, the view of a batch slice starts at the offset of its blocking descriptor
+     */
+    static void *getBlobData(const InferenceEngine::Blob::Ptr &blob);
+    /**
+     * @brief The descriptor of the dense blob as its data start at getBlobData(), i.e. without the offset
+     */
+    static InferenceEngine::TensorDesc getDenseTensorDesc(const InferenceEngine::TensorDesc &desc);
 };
 
 }  // namespace MKLDNNPlugin
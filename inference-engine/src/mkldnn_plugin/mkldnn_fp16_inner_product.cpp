@@ -0,0 +1,234 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_fp16_inner_product.h"
+#include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "jit_generator.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace Xbyak;
+
+namespace {
+
+// the number of the output channels computed by one call of the kernel
+const size_t channelsBlock = 16;
+
+struct jit_fp16_ip_call_args {
+    const float *src;
+    const ie_fp16 *weights;
+    float *dst;
+    // the number of the elements of the dot product, the multiple of the vector length
+    size_t work_amount;
+    size_t channels;
+    // the stride of the rows of the weights in bytes
+    size_t weights_stride;
+};
+
+#define GET_OFF(field) offsetof(jit_fp16_ip_call_args, field)
+
+struct jit_fp16_ip_kernel : public jit_generator {
+    jit_fp16_ip_kernel(): jit_generator(nullptr, 8192) {}
+
+    void (*ker_)(const jit_fp16_ip_call_args *) = nullptr;
+    size_t simd_w = 1;
+    std::string isa_name;
+};
+
+template <cpu_isa_t isa>
+struct jit_fp16_ip_kernel_f32 : public jit_fp16_ip_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_fp16_ip_kernel_f32)
+
+    jit_fp16_ip_kernel_f32() {
+        simd_w = vlen / sizeof(float);
+        isa_name = isa == avx2 ? "avx2" : "avx512";
+
+        preamble();
+
+        mov(reg_src, ptr[param1 + GET_OFF(src)]);
+        mov(reg_weights, ptr[param1 + GET_OFF(weights)]);
+        mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[param1 + GET_OFF(work_amount)]);
+        mov(reg_channels, ptr[param1 + GET_OFF(channels)]);
+        mov(reg_stride, ptr[param1 + GET_OFF(weights_stride)]);
+
+        // four channels share every load of the source
+        Label l_channels4, l_channels1, l_exit;
+        L(l_channels4);
+        {
+            cmp(reg_channels, 4);
+            jl(l_channels1, T_NEAR);
+
+            dot_products(4);
+            for (int i = 0; i < 4; i++)
+                add(reg_weights, reg_stride);
+            add(reg_dst, 4 * sizeof(float));
+            sub(reg_channels, 4);
+            jmp(l_channels4, T_NEAR);
+        }
+        L(l_channels1);
+        {
+            cmp(reg_channels, 1);
+            jl(l_exit, T_NEAR);
+
+            dot_products(1);
+            add(reg_weights, reg_stride);
+            add(reg_dst, sizeof(float));
+            sub(reg_channels, 1);
+            jmp(l_channels1, T_NEAR);
+        }
+        L(l_exit);
+
+        postamble();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional<isa == avx2, Ymm, Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Reg64 reg_src = r8;
+    Reg64 reg_weights = r9;
+    Reg64 reg_dst = r10;
+    Reg64 reg_work_amount = r11;
+    Reg64 reg_channels = r12;
+    Reg64 reg_stride = r13;
+    Reg64 reg_offt = r14;
+    Reg64 reg_count = r15;
+    Reg64 reg_row[4] = {rax, rbx, rdx, rsi};
+
+    Vmm vmm_src = Vmm(4);
+    Vmm vmm_weights = Vmm(5);
+    Vmm vmm_aux = Vmm(6);
+
+    void dot_products(int channels) {
+        for (int i = 0; i < channels; i++) {
+            uni_vpxor(Vmm(i), Vmm(i), Vmm(i));
+            if (i == 0)
+                mov(reg_row[i], reg_weights);
+            else
+                lea(reg_row[i], ptr[reg_row[i - 1] + reg_stride]);
+        }
+        xor_(reg_offt, reg_offt);
+        mov(reg_count, reg_work_amount);
+
+        Label l_loop, l_exit;
+        L(l_loop);
+        {
+            cmp(reg_count, simd_w);
+            jl(l_exit, T_NEAR);
+
+            uni_vmovups(vmm_src, ptr[reg_src + reg_offt * sizeof(float)]);
+            for (int i = 0; i < channels; i++) {
+                vcvtph2ps(vmm_weights, ptr[reg_row[i] + reg_offt * sizeof(ie_fp16)]);
+                vfmadd231ps(Vmm(i), vmm_weights, vmm_src);
+            }
+
+            add(reg_offt, simd_w);
+            sub(reg_count, simd_w);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_exit);
+
+        for (int i = 0; i < channels; i++) {
+            reduce(i);
+            vmovss(ptr[reg_dst + i * sizeof(float)], Xmm(i));
+        }
+    }
+
+    // the horizontal sum of the vector i to the lowest element
+    void reduce(int i) {
+        if (isa == avx512_common) {
+            vextractf64x4(Ymm(vmm_aux.getIdx()), Zmm(i), 1);
+            vaddps(Ymm(i), Ymm(i), Ymm(vmm_aux.getIdx()));
+        }
+        vextractf128(Xmm(vmm_aux.getIdx()), Ymm(i), 1);
+        vaddps(Xmm(i), Xmm(i), Xmm(vmm_aux.getIdx()));
+        vhaddps(Xmm(i), Xmm(i), Xmm(i));
+        vhaddps(Xmm(i), Xmm(i), Xmm(i));
+    }
+};
+
+}  // namespace
+
+struct MKLDNNFP16InnerProduct::Kernel {
+    std::unique_ptr<jit_fp16_ip_kernel> jit;
+};
+
+MKLDNNFP16InnerProduct::MKLDNNFP16InnerProduct() = default;
+
+MKLDNNFP16InnerProduct::~MKLDNNFP16InnerProduct() = default;
+
+void MKLDNNFP16InnerProduct::init(const float *src_weights, size_t oc, size_t k) {
+    if (!src_weights || !oc || !k)
+        THROW_IE_EXCEPTION << "Cannot store empty weights of the inner product in FP16.";
+
+    OC = oc;
+    K = k;
+    weights.resize(OC * K);
+    parallel_for(OC, [&](size_t c) {
+        PrecisionUtils::f32tof16Arrays(&weights[c * K], src_weights + c * K, K);
+    });
+
+    kernel.reset(new Kernel());
+    if (mayiuse(avx512_common)) {
+        kernel->jit.reset(new jit_fp16_ip_kernel_f32<avx512_common>());
+    } else if (mayiuse(avx2) && cpu.has(util::Cpu::tF16C)) {
+        kernel->jit.reset(new jit_fp16_ip_kernel_f32<avx2>());
+    }
+}
+
+std::string MKLDNNFP16InnerProduct::getIsaName() const {
+    return kernel && kernel->jit ? kernel->jit->isa_name : "ref";
+}
+
+void MKLDNNFP16InnerProduct::execute(const float *src, const float *bias, float *dst, size_t MB) const {
+    if (weights.empty())
+        THROW_IE_EXCEPTION << "The FP16 weights of the inner product are not initialized.";
+
+    const jit_fp16_ip_kernel *jit = kernel ? kernel->jit.get() : nullptr;
+    const size_t vectorized = jit ? K / jit->simd_w * jit->simd_w : 0;
+    const size_t blocks = (OC + channelsBlock - 1) / channelsBlock;
+
+    // the threads split the output channels, so every row of the weights is read once per sample from the cache
+    parallel_for(blocks, [&](size_t blk) {
+        const size_t start = blk * channelsBlock;
+        const size_t end = (std::min)(OC, start + channelsBlock);
+        for (size_t n = 0; n < MB; n++) {
+            const float *src_row = src + n * K;
+            float *dst_row = dst + n * OC;
+
+            if (jit && vectorized) {
+                jit_fp16_ip_call_args args;
+                args.src = src_row;
+                args.weights = &weights[start * K];
+                args.dst = dst_row + start;
+                args.work_amount = vectorized;
+                args.channels = end - start;
+                args.weights_stride = K * sizeof(ie_fp16);
+                jit->ker_(&args);
+            } else {
+                for (size_t c = start; c < end; c++)
+                    dst_row[c] = 0.0f;
+            }
+
+            for (size_t c = start; c < end; c++) {
+                const ie_fp16 *w = &weights[c * K];
+                float sum = bias ? bias[c] : 0.0f;
+                for (size_t k = vectorized; k < K; k++)
+                    sum += src_row[k] * PrecisionUtils::f16tof32(w[k]);
+                dst_row[c] += sum;
+            }
+        }
+    });
+}
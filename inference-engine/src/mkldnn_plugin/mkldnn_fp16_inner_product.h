@@ -0,0 +1,55 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <precision_utils.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The inner product with the weights stored in FP16. The weights are converted to FP32 in the registers
+ * by the JIT kernel for AVX-512 or AVX2 with F16C and accumulated in FP32, so the small batches which are bound
+ * by the bandwidth of the weights read half of the memory.
+ * Every output channel is the dot product of a source row with a row of the weights of the same layout.
+ */
+class MKLDNNFP16InnerProduct {
+public:
+    MKLDNNFP16InnerProduct();
+    ~MKLDNNFP16InnerProduct();
+
+    /**
+     * @brief Converts the weights [OC][K] to FP16 and generates the kernel for the best ISA of the machine
+     */
+    void init(const float *weights, size_t OC, size_t K);
+
+    bool empty() const {
+        return weights.empty();
+    }
+
+    /**
+     * @brief Computes dst[n][oc] = bias[oc] + src[n] * weights[oc] for MB rows of the source with the stride K
+     * @param bias - the biases of the output channels or nullptr
+     */
+    void execute(const float *src, const float *bias, float *dst, size_t MB) const;
+
+    /**
+     * @brief The name of the ISA of the compiled kernel or "ref"
+     */
+    std::string getIsaName() const;
+
+private:
+    struct Kernel;
+
+    size_t OC = 0;
+    size_t K = 0;
+    std::vector<InferenceEngine::ie_fp16> weights;
+    std::shared_ptr<Kernel> kernel;
+};
+
+}  // namespace MKLDNNPlugin
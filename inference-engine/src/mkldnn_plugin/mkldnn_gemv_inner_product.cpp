@@ -0,0 +1,250 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_gemv_inner_product.h"
+#include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "jit_generator.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace Xbyak;
+
+namespace {
+
+// the number of the output channels interleaved in the packed weights
+const size_t groupSize = 4;
+// the number of the groups computed by one call of the kernel
+const size_t groupsBlock = 8;
+
+struct jit_gemv_ip_call_args {
+    const float *src;
+    const float *weights;
+    float *dst;
+    // the number of the elements of the dot product, the multiple of the vector length
+    size_t work_amount;
+    size_t groups;
+};
+
+#define GET_OFF(field) offsetof(jit_gemv_ip_call_args, field)
+
+struct jit_gemv_ip_kernel : public jit_generator {
+    jit_gemv_ip_kernel(): jit_generator(nullptr, 8192) {}
+
+    void (*ker_)(const jit_gemv_ip_call_args *) = nullptr;
+    size_t simd_w = 1;
+    std::string isa_name;
+};
+
+template <cpu_isa_t isa>
+struct jit_gemv_ip_kernel_f32 : public jit_gemv_ip_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_gemv_ip_kernel_f32)
+
+    jit_gemv_ip_kernel_f32() {
+        simd_w = vlen / sizeof(float);
+        isa_name = isa == avx2 ? "avx2" : "avx512";
+
+        preamble();
+
+        mov(reg_weights, ptr[param1 + GET_OFF(weights)]);
+        mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[param1 + GET_OFF(work_amount)]);
+        mov(reg_groups, ptr[param1 + GET_OFF(groups)]);
+
+        Label l_groups, l_exit;
+        L(l_groups);
+        {
+            cmp(reg_groups, 1);
+            jl(l_exit, T_NEAR);
+
+            dot_products();
+            add(reg_dst, groupSize * sizeof(float));
+            sub(reg_groups, 1);
+            jmp(l_groups, T_NEAR);
+        }
+        L(l_exit);
+
+        postamble();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional<isa == avx2, Ymm, Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Reg64 reg_src = r8;
+    Reg64 reg_weights = r9;
+    Reg64 reg_dst = r10;
+    Reg64 reg_work_amount = r11;
+    Reg64 reg_groups = r12;
+    Reg64 reg_count = r13;
+
+    // the accumulators are Vmm(0) - Vmm(7), two per channel to hide the latency of the FMA
+    Vmm vmm_src[2] = {Vmm(8), Vmm(9)};
+    Vmm vmm_aux = Vmm(10);
+
+    // the weights of the group are read sequentially, reg_weights points to the next group after the call
+    void dot_products() {
+        for (int i = 0; i < 2 * static_cast<int>(groupSize); i++)
+            uni_vpxor(Vmm(i), Vmm(i), Vmm(i));
+        mov(reg_src, ptr[param1 + GET_OFF(src)]);
+        mov(reg_count, reg_work_amount);
+
+        Label l_loop2, l_loop1, l_exit;
+        L(l_loop2);
+        {
+            cmp(reg_count, 2 * simd_w);
+            jl(l_loop1, T_NEAR);
+
+            for (int u = 0; u < 2; u++) {
+                uni_vmovups(vmm_src[u], ptr[reg_src + u * vlen]);
+                for (int i = 0; i < static_cast<int>(groupSize); i++)
+                    vfmadd231ps(Vmm(u * groupSize + i), vmm_src[u], ptr[reg_weights + (u * groupSize + i) * vlen]);
+            }
+
+            add(reg_src, 2 * vlen);
+            add(reg_weights, 2 * groupSize * vlen);
+            sub(reg_count, 2 * simd_w);
+            jmp(l_loop2, T_NEAR);
+        }
+        L(l_loop1);
+        {
+            cmp(reg_count, simd_w);
+            jl(l_exit, T_NEAR);
+
+            uni_vmovups(vmm_src[0], ptr[reg_src]);
+            for (int i = 0; i < static_cast<int>(groupSize); i++)
+                vfmadd231ps(Vmm(i), vmm_src[0], ptr[reg_weights + i * vlen]);
+
+            add(reg_src, vlen);
+            add(reg_weights, groupSize * vlen);
+            sub(reg_count, simd_w);
+            jmp(l_loop1, T_NEAR);
+        }
+        L(l_exit);
+
+        for (int i = 0; i < static_cast<int>(groupSize); i++) {
+            vaddps(Vmm(i), Vmm(i), Vmm(groupSize + i));
+            reduce(i);
+            vmovss(ptr[reg_dst + i * sizeof(float)], Xmm(i));
+        }
+    }
+
+    // the horizontal sum of the vector i to the lowest element
+    void reduce(int i) {
+        if (isa == avx512_common) {
+            vextractf64x4(Ymm(vmm_aux.getIdx()), Zmm(i), 1);
+            vaddps(Ymm(i), Ymm(i), Ymm(vmm_aux.getIdx()));
+        }
+        vextractf128(Xmm(vmm_aux.getIdx()), Ymm(i), 1);
+        vaddps(Xmm(i), Xmm(i), Xmm(vmm_aux.getIdx()));
+        vhaddps(Xmm(i), Xmm(i), Xmm(i));
+        vhaddps(Xmm(i), Xmm(i), Xmm(i));
+    }
+};
+
+}  // namespace
+
+struct MKLDNNGemvInnerProduct::Kernel {
+    std::unique_ptr<jit_gemv_ip_kernel> jit;
+};
+
+MKLDNNGemvInnerProduct::MKLDNNGemvInnerProduct() = default;
+
+MKLDNNGemvInnerProduct::~MKLDNNGemvInnerProduct() = default;
+
+void MKLDNNGemvInnerProduct::init(const float *weights, size_t oc, size_t k) {
+    if (!weights || !oc || !k)
+        THROW_IE_EXCEPTION << "Cannot pack empty weights of the inner product.";
+
+    std::unique_ptr<jit_gemv_ip_kernel> jit;
+    if (mayiuse(avx512_common)) {
+        jit.reset(new jit_gemv_ip_kernel_f32<avx512_common>());
+    } else if (mayiuse(avx2)) {
+        jit.reset(new jit_gemv_ip_kernel_f32<avx2>());
+    }
+    // the source shorter than the vector is left to the primitive
+    if (!jit || k < jit->simd_w)
+        return;
+
+    OC = oc;
+    K = k;
+    const size_t simd_w = jit->simd_w;
+    const size_t vectors = K / simd_w;
+    const size_t tail = K - vectors * simd_w;
+    const size_t groups = (OC + groupSize - 1) / groupSize;
+
+    packedWeights.assign(groups * vectors * groupSize * simd_w, 0.0f);
+    tailWeights.resize(OC * tail);
+    parallel_for(groups, [&](size_t g) {
+        float *packed = &packedWeights[g * vectors * groupSize * simd_w];
+        for (size_t i = 0; i < groupSize && g * groupSize + i < OC; i++) {
+            const size_t c = g * groupSize + i;
+            const float *row = weights + c * K;
+            for (size_t v = 0; v < vectors; v++)
+                std::copy_n(row + v * simd_w, simd_w, packed + (v * groupSize + i) * simd_w);
+            std::copy_n(row + vectors * simd_w, tail, &tailWeights[c * tail]);
+        }
+    });
+
+    kernel.reset(new Kernel());
+    kernel->jit = std::move(jit);
+}
+
+std::string MKLDNNGemvInnerProduct::getIsaName() const {
+    return kernel && kernel->jit ? kernel->jit->isa_name : "ref";
+}
+
+void MKLDNNGemvInnerProduct::execute(const float *src, const float *bias, float *dst) const {
+    if (packedWeights.empty())
+        THROW_IE_EXCEPTION << "The packed weights of the inner product are not initialized.";
+
+    const jit_gemv_ip_kernel *jit = kernel->jit.get();
+    const size_t vectorized = K / jit->simd_w * jit->simd_w;
+    const size_t tail = K - vectorized;
+    const size_t groups = (OC + groupSize - 1) / groupSize;
+    const size_t blocks = (groups + groupsBlock - 1) / groupsBlock;
+
+    parallel_for(blocks, [&](size_t blk) {
+        const size_t startGroup = blk * groupsBlock;
+        const size_t endGroup = (std::min)(groups, startGroup + groupsBlock);
+        // the padded channels of the last group are not written to the output
+        const size_t fullGroups = (std::min)(endGroup, OC / groupSize) - (std::min)(startGroup, OC / groupSize);
+
+        jit_gemv_ip_call_args args;
+        args.src = src;
+        args.weights = &packedWeights[startGroup * vectorized * groupSize];
+        args.dst = dst + startGroup * groupSize;
+        args.work_amount = vectorized;
+        args.groups = fullGroups;
+        if (fullGroups)
+            jit->ker_(&args);
+
+        if (startGroup + fullGroups < endGroup) {
+            float last[groupSize];
+            args.weights = &packedWeights[(startGroup + fullGroups) * vectorized * groupSize];
+            args.dst = last;
+            args.groups = 1;
+            jit->ker_(&args);
+            std::copy_n(last, OC - (startGroup + fullGroups) * groupSize, dst + (startGroup + fullGroups) * groupSize);
+        }
+
+        const size_t end = (std::min)(OC, endGroup * groupSize);
+        for (size_t c = startGroup * groupSize; c < end; c++) {
+            const float *w = &tailWeights[c * tail];
+            float sum = bias ? bias[c] : 0.0f;
+            for (size_t k = 0; k < tail; k++)
+                sum += src[vectorized + k] * w[k];
+            dst[c] += sum;
+        }
+    });
+}
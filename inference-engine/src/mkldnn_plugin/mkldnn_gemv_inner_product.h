@@ -0,0 +1,58 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The inner product of a single sample. Such a layer is a matrix-vector product bound by the bandwidth
+ * of the weights, so the weights are packed once for the JIT kernel of AVX-512 or AVX2: four output channels
+ * are interleaved by vectors and the kernel reads them in one sequential stream.
+ * The threads split the output channels, so every thread streams its own part of the weights.
+ */
+class MKLDNNGemvInnerProduct {
+public:
+    MKLDNNGemvInnerProduct();
+    ~MKLDNNGemvInnerProduct();
+
+    /**
+     * @brief Packs the weights [OC][K] for the kernel of the best ISA of the machine. Nothing is packed if the
+     * machine has no AVX2 or K is shorter than the vector, so the inner product stays empty
+     */
+    void init(const float *weights, size_t OC, size_t K);
+
+    bool empty() const {
+        return packedWeights.empty();
+    }
+
+    /**
+     * @brief Computes dst[oc] = bias[oc] + src * weights[oc] for the source of K elements
+     * @param bias - the biases of the output channels or nullptr
+     */
+    void execute(const float *src, const float *bias, float *dst) const;
+
+    /**
+     * @brief The name of the ISA of the compiled kernel or "ref"
+     */
+    std::string getIsaName() const;
+
+private:
+    struct Kernel;
+
+    size_t OC = 0;
+    size_t K = 0;
+    // [OC / 4][K / simd_w][4][simd_w], the last group is padded by the zero channels
+    std::vector<float> packedWeights;
+    // [OC][K % simd_w], the elements which are not covered by the vectors
+    std::vector<float> tailWeights;
+    std::shared_ptr<Kernel> kernel;
+};
+
+}  // namespace MKLDNNPlugin
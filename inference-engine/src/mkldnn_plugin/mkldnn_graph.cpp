@@ -8,6 +8,12 @@
 #include <map>
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <deque>
+#include <condition_variable>
+#include <exception>
 #include <limits>
 #include <fstream>
 #include <caseless.hpp>
@@ -17,16 +23,26 @@
 #include <debug.h>
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
+#include <nodes/mkldnn_conv_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
 #include "mkldnn_extension_utils.h"
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn/omp_manager.h"
 #include <omp.h>
 #include <graph_tools.hpp>
 #include <cpp_interfaces/ie_executor_manager.hpp>
 #include "ie_algorithm.hpp"
+#include "ie_util_internal.hpp"
 #include "memory_solver.hpp"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_streams.h"
+#include "mkldnn_scheduler.h"
+#include <ie_profiling.hpp>
+#include "ie_parallel.hpp"
 // #define DEBUG_DUMP_PATH "/home/user/HDD/gna-mkldnn/"
 // #define DEBUG_DUMP_NEW_FOLDER_PER_INFER
 #ifdef DEBUG_DUMP_PATH
@@ -41,6 +57,8 @@ using namespace MKLDNNPlugin::cpu;
 using namespace InferenceEngine;
 using namespace InferenceEngine::MKLDNNPlugin;
 
+constexpr int MKLDNNGraph::workspaceAlignment;
+
 void BindThreads(mkldnn::engine eng) {
     static bool alreadyBind = false;
     if (!alreadyBind) {
@@ -64,12 +82,64 @@ void BindThreads(mkldnn::engine eng) {
     }
 }
 
+// the logical cores the network is bound to: the listed ones (see Config::bindCores) or the ones of the NUMA node
+// (see Config::numaNode), the first Config::threadsNum of them are taken. The binding is supported on Linux only
+static std::vector<int> GetNetworkCores(const Config &cfg) {
+#if !(defined(__APPLE__) || defined(_WIN32))
+    if (!cfg.bindCores.empty() && cfg.numaNode >= 0)
+        THROW_IE_EXCEPTION << "The cores and the NUMA node of the network cannot be bound together";
+
+    std::vector<int> cores;
+    if (!cfg.bindCores.empty()) {
+        const int available = OpenMpManager::getOpenMpThreadNumber();
+        for (int core : cfg.bindCores) {
+            if (core >= available)
+                THROW_IE_EXCEPTION << "The core " << core << " is not available, there are " << available << " cores";
+        }
+        cores = cfg.bindCores;
+    } else if (cfg.numaNode >= 0) {
+        cores = OpenMpManager::getSocketCores(cfg.numaNode);
+        if (cores.empty())
+            THROW_IE_EXCEPTION << "There are no available cores on the NUMA node " << cfg.numaNode;
+    }
+
+    if (cfg.threadsNum > 0 && !cores.empty()) {
+        if (static_cast<size_t>(cfg.threadsNum) > cores.size())
+            THROW_IE_EXCEPTION << "The " << cfg.threadsNum << " threads of the network exceed the " << cores.size()
+                               << " cores it is bound to";
+        cores.resize(cfg.threadsNum);
+    }
+    return cores;
+#else
+    return {};
+#endif
+}
+
+void MKLDNNGraph::setSelectionFrom(const MKLDNNGraph &graph) {
+    graphCache.reset(new MKLDNNGraphCache(graph.graphNodes));
+}
+
 void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_CreateGraph)
     if (IsReady()) {
         ForgetGraphData();
     }
 
-    if (config.useThreadBinding) BindThreads(eng);
+    // streams bind their own OpenMP teams (see MKLDNNExecNetwork)
+    if (config.throughputStreams <= 1) {
+        const std::vector<int> cores = GetNetworkCores(config);
+        if (!cores.empty()) {
+            // the memory of the graph is touched first by the bound threads, so it is placed on their node as well
+#if !(defined(__APPLE__) || defined(_WIN32))
+            OpenMpManager::bindOpenMpThreadsToCores(cores);
+#endif
+        } else if (config.threadsNum > 0) {
+            // the team of the thread which infers the network, the other networks keep their own teams
+            omp_set_num_threads(config.threadsNum);
+        } else if (config.useThreadBinding) {
+            BindThreads(eng);
+        }
+    }
 
     // go over the inputs and create input primitives
     InputsDataMap inputs;
@@ -180,17 +250,42 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
     optimizer.Optimize(*this);
     SortTopologically();
 
+    if (!graphCache && !config.graphCacheDir.empty()) {
+        graphCache.reset(new MKLDNNGraphCache(config.graphCacheDir, network, config));
+        // the missing or outdated cache is written again after the selection
+        graphCache->load();
+    }
+
+    if (config.tuningMode != Config::TuningDisabled) {
+        tuningCache.reset(new MKLDNNTuningCache(config.tuningFile));
+        // the new results are appended to the existing file
+        if (!tuningCache->load() && config.tuningMode == Config::TuningUseExisting)
+            THROW_IE_EXCEPTION << "Cannot read the tuning file '" << config.tuningFile << "'";
+    }
+
     InitNodes();
+    graphCache.reset();
+    tuningCache.reset();
 
     for (auto &node : graphNodes) {
         node->initOptimalPrimitiveDescriptor();
     }
     InitEdges();
+    RemoveRedundantReorders();
 
     SortTopologically();
 
+    if (config.parallelBranches)
+        InitDataflow();
+
     Allocate();
 
+    for (auto &mean : _meanImages) {
+        auto input = inputNodes.find(mean.first);
+        if (input != inputNodes.end())
+            mean.second.setFormat(input->second->getChildEdgeAt(0)->getMemory().GetFormat());
+    }
+
     CreatePrimitives();
 
     for (auto &graphNode : graphNodes) {
@@ -204,13 +299,24 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
         graphNode->execute(stream);
     }
 
+    FoldConstants();
+
+    for (auto &graphNode : graphNodes) {
+        auto *memoryOutput = dynamic_cast<MKLDNNMemoryOutputNode *>(graphNode.get());
+        if (memoryOutput)
+            memoryOutput->initStateSwap(graphEdges);
+    }
+
     status = Ready;
 }
 
 void MKLDNNGraph::ParseNode(const CNNLayerPtr& cnnLayer, MKLDNNNodePtr& parent,
                             const MKLDNNExtensionManager::Ptr& extMgr, size_t outIdx,
                             std::vector<ParsedLayer>& queuelayers) {
-    if (cnnLayer->precision != Precision::FP32) {
+    // the convolutions quantized by CNNNetworkInt8Normalizer are executed in INT8
+    bool isInt8Convolution = cnnLayer->precision == Precision::I8 &&
+                             CaselessEq<std::string>()(cnnLayer->type, "Convolution");
+    if (cnnLayer->precision != Precision::FP32 && !isInt8Convolution) {
         THROW_IE_EXCEPTION << "The plugin does not support " << cnnLayer->precision;
     }
 
@@ -283,23 +389,60 @@ void MKLDNNGraph::ParseNode(const CNNLayerPtr& cnnLayer, MKLDNNNodePtr& parent,
 }
 
 void MKLDNNGraph::InitNodes() {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_InitNodes)
     for (auto &node : graphNodes) {
         if (node->getType() == Input && _meanImages.find(node->getName()) != _meanImages.end()) {
             auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
             if (inputNode)
                 inputNode->withMeanImage();
         }
+        node->storeWeightsOnHugePages(config.hugePageSize);
+        if (config.fp16Weights && node->getType() == FullyConnected) {
+            auto *fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+            if (fcNode)
+                fcNode->storeWeightsInFP16();
+        }
         node->getSupportedDescriptors();
 
         node->initSupportedPrimitiveDescriptors();
     }
 
+    bool cached = true;
+    bool tuned = false;
     for (auto &node : graphNodes) {
+        if (graphCache && graphCache->select(node))
+            continue;
+        cached = false;
         node->selectOptimalPrimitiveDescriptor();
+
+        auto *convNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get());
+        if (tuningCache && convNode) {
+            std::string key = convNode->getTuningKey();
+            if (key.empty() || tuningCache->select(key, node) || config.tuningMode != Config::TuningCreate)
+                continue;
+            convNode->selectFastestPrimitiveDescriptor();
+            tuningCache->store(key, node);
+            tuned = true;
+        }
     }
+
+    if (graphCache && !cached)
+        graphCache->save(graphNodes);
+    if (tuned)
+        tuningCache->save();
 }
 
 void MKLDNNGraph::InitEdges() {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_InitEdges)
+    // the reorders replace the edges in graphEdges
+    auto edges = graphEdges;
+    for (auto &edge : edges) {
+        if (edge->needReorder())
+            InsertReorder(edge);
+    }
+}
+
+void MKLDNNGraph::InsertReorder(const MKLDNNEdgePtr &edge) {
     auto reorderArgs = [](InferenceEngine::TensorDesc parentDesc, InferenceEngine::TensorDesc childDesc) {
         std::string inArgs, outArgs;
         if (parentDesc.getPrecision() != childDesc.getPrecision()) {
@@ -364,130 +507,335 @@ void MKLDNNGraph::InitEdges() {
         }
         return inArgs + "_" + outArgs;
     };
-    size_t numberOfEdges = graphEdges.size();
-    for (auto i = 0; i < numberOfEdges; i++) {
-        if (graphEdges[i]->needReorder()) {
-            std::string layerName = graphEdges[i]->getParent()->getName() + "_" +
-                    reorderArgs(graphEdges[i]->getInputDesc(), graphEdges[i]->getOutputDesc()) + "_" +
-                    graphEdges[i]->getChild()->getName();
-            CNNLayerPtr layer(new CNNLayer({layerName,
-                                            "Reorder",
-                                            graphEdges[i]->getInputDesc().getPrecision()}));
-            MKLDNNNodePtr newReorder(new MKLDNNReorderNode(layer, getEngine()));
-            auto *reorderPtr = dynamic_cast<MKLDNNReorderNode *>(newReorder.get());
-            if (reorderPtr) {
-                reorderPtr->setDescs(graphEdges[i]->getInputDesc(), graphEdges[i]->getOutputDesc());
+    std::string layerName = edge->getParent()->getName() + "_" +
+            reorderArgs(edge->getInputDesc(), edge->getOutputDesc()) + "_" +
+            edge->getChild()->getName();
+    CNNLayerPtr layer(new CNNLayer({layerName,
+                                    "Reorder",
+                                    edge->getInputDesc().getPrecision()}));
+    MKLDNNNodePtr newReorder(new MKLDNNReorderNode(layer, getEngine()));
+    auto *reorderPtr = dynamic_cast<MKLDNNReorderNode *>(newReorder.get());
+    if (reorderPtr) {
+        reorderPtr->setDescs(edge->getInputDesc(), edge->getOutputDesc());
+    }
+    MKLDNNEdgePtr beforeNode(new MKLDNNEdge(edge->getParent(), newReorder));
+    beforeNode->setDims(edge->getDims());
+    MKLDNNEdgePtr afterNode(new MKLDNNEdge(newReorder, edge->getChild()));
+    afterNode->setDims(edge->getDims());
+
+    int oIndex = edge->getOutputNum();
+    int iIndex = edge->getInputNum();
+    if (iIndex < 0 || oIndex < 0)
+        THROW_IE_EXCEPTION << "Cannot create reorder for nodes: "
+                           << edge->getParent()->getName() << " and "
+                           << edge->getChild()->getName() << ".";
+
+    // Add edge for beforeNode
+    edge->getParent()->childEdges[iIndex].reset();
+    edge->getParent()->childEdges[iIndex] = beforeNode;
+    beforeNode->getChild()->parentEdges.push_back(beforeNode);
+
+    // Add edge for afterNode
+    afterNode->getParent()->childEdges.push_back(afterNode);
+    edge->getChild()->parentEdges[oIndex].reset();
+    edge->getChild()->parentEdges[oIndex] = afterNode;
+
+    newReorder->getSupportedDescriptors();
+    newReorder->initSupportedPrimitiveDescriptors();
+    newReorder->selectOptimalPrimitiveDescriptor();
+
+    beforeNode->getDesc();
+    graphEdges.push_back(beforeNode);
+    afterNode->getDesc();
+    graphEdges.push_back(afterNode);
+
+    graphNodes.push_back(newReorder);
+    graphEdges.erase(std::find(graphEdges.begin(), graphEdges.end(), edge));
+}
+
+MKLDNNEdgePtr MKLDNNGraph::ReplaceEdges(const MKLDNNEdgePtr &from, const MKLDNNEdgePtr &to) {
+    auto parent = from->getParent();
+    auto child = to->getChild();
+    int iIndex = from->getInputNum();
+    int oIndex = to->getOutputNum();
+    if (iIndex < 0 || oIndex < 0)
+        THROW_IE_EXCEPTION << "Cannot connect nodes: " << parent->getName() << " and " << child->getName() << ".";
+
+    MKLDNNEdgePtr edge(new MKLDNNEdge(parent, child));
+    edge->setDims(from->getDims());
+    parent->childEdges[iIndex] = edge;
+    child->parentEdges[oIndex] = edge;
+
+    graphEdges.erase(std::find(graphEdges.begin(), graphEdges.end(), from));
+    if (to != from)
+        graphEdges.erase(std::find(graphEdges.begin(), graphEdges.end(), to));
+    graphEdges.push_back(edge);
+    return edge;
+}
+
+/**
+ * InitEdges puts a reorder on every edge whose descriptors differ, so some of them are redundant:
+ *  - the reorders of one output to the same descriptor, the children share the first one
+ *  - two reorders in a row, they are replaced by one from the first descriptor to the last one, or by nothing
+ *  - a layout-agnostic node (activation, power, depthwise) between the reorders which convert the data back,
+ *    the node runs in the layout of its parent and the reorders are removed
+ */
+void MKLDNNGraph::RemoveRedundantReorders() {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_RemoveRedundantReorders)
+    auto isReorder = [](const MKLDNNNodePtr &node) {
+        return node->getType() == Reorder && node->getParentEdges().size() == 1 && node->getChildEdges().size() == 1;
+    };
+    auto equalDescs = [](const TensorDesc &lhs, const TensorDesc &rhs) {
+        return lhs.getPrecision() == rhs.getPrecision() && MKLDNNExtensionUtils::initTensorsAreEqual(lhs, rhs);
+    };
+    auto removeNode = [&](const MKLDNNNodePtr &node) {
+        graphNodes.erase(std::find(graphNodes.begin(), graphNodes.end(), node));
+    };
+    auto initEdge = [&](const MKLDNNEdgePtr &edge) {
+        if (edge->needReorder())
+            InsertReorder(edge);
+        else
+            edge->getDesc();
+    };
+
+    // the reorders of one output to the same descriptor
+    auto nodes = graphNodes;
+    for (auto &node : nodes) {
+        auto spd = node->getSelectedPrimitiveDescriptor();
+        if (!spd || spd->getConfig().outConfs.size() != 1)
+            continue;
+
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            // the children which work in place of their input cannot share it
+            auto reorder = node->getChildEdgeAt(i)->getChild();
+            if (!isReorder(reorder) || reorder->getChildEdgeAt(0)->inPlace(MKLDNNEdge::LOOK_DOWN))
+                continue;
+
+            TensorDesc desc = reorder->getChildEdgeAt(0)->getDesc();
+            for (size_t j = i + 1; j < node->getChildEdges().size(); j++) {
+                auto edge = node->getChildEdgeAt(j);
+                auto peer = edge->getChild();
+                if (!isReorder(peer) || !equalDescs(desc, peer->getChildEdgeAt(0)->getDesc()) ||
+                        peer->getChildEdgeAt(0)->inPlace(MKLDNNEdge::LOOK_DOWN))
+                    continue;
+
+                auto peerEdge = peer->getChildEdgeAt(0);
+                auto child = peerEdge->getChild();
+                int oIndex = peerEdge->getOutputNum();
+                MKLDNNEdgePtr newEdge(new MKLDNNEdge(reorder, child));
+                newEdge->setDims(peerEdge->getDims());
+                reorder->childEdges.push_back(newEdge);
+                child->parentEdges[oIndex] = newEdge;
+                newEdge->getDesc();
+
+                node->childEdges.erase(node->childEdges.begin() + j);
+                graphEdges.erase(std::find(graphEdges.begin(), graphEdges.end(), edge));
+                graphEdges.erase(std::find(graphEdges.begin(), graphEdges.end(), peerEdge));
+                graphEdges.push_back(newEdge);
+                removeNode(peer);
+                j--;
             }
-            MKLDNNEdgePtr beforeNode(new MKLDNNEdge(graphEdges[i]->getParent(), newReorder));
-            beforeNode->setDims(graphEdges[i]->getDims());
-            MKLDNNEdgePtr afterNode(new MKLDNNEdge(newReorder, graphEdges[i]->getChild()));
-            afterNode->setDims(graphEdges[i]->getDims());
-
-            int oIndex = graphEdges[i]->getOutputNum();
-            int iIndex = graphEdges[i]->getInputNum();
-            if (iIndex < 0 || oIndex < 0)
-                THROW_IE_EXCEPTION << "Cannot create reorder for nodes: "
-                                   << graphEdges[i]->getParent()->getName() << " and "
-                                   << graphEdges[i]->getChild()->getName() << ".";
-
-            // Add edge for beforeNode
-            graphEdges[i]->getParent()->childEdges[iIndex].reset();
-            graphEdges[i]->getParent()->childEdges[iIndex] = beforeNode;
-            beforeNode->getChild()->parentEdges.push_back(beforeNode);
-
-            // Add edge for afterNode
-            afterNode->getParent()->childEdges.push_back(afterNode);
-            graphEdges[i]->getChild()->parentEdges[oIndex].reset();
-            graphEdges[i]->getChild()->parentEdges[oIndex] = afterNode;
-
-            newReorder->getSupportedDescriptors();
-            newReorder->initSupportedPrimitiveDescriptors();
-            newReorder->selectOptimalPrimitiveDescriptor();
-
-            beforeNode->getDesc();
-            graphEdges.push_back(beforeNode);
-            afterNode->getDesc();
-            graphEdges.push_back(afterNode);
-
-            graphNodes.push_back(newReorder);
-            graphEdges.erase(graphEdges.begin() + i);
-            i--;
-            numberOfEdges--;
         }
     }
+
+    // two reorders in a row, the reorder inserted instead of them may start a new pair
+    for (bool merged = true; merged;) {
+        merged = false;
+        nodes = graphNodes;
+        for (auto &reorder : nodes) {
+            if (!isReorder(reorder) || std::find(graphNodes.begin(), graphNodes.end(), reorder) == graphNodes.end())
+                continue;
+            auto next = reorder->getChildEdgeAt(0)->getChild();
+            if (!isReorder(next))
+                continue;
+
+            auto edge = ReplaceEdges(reorder->getParentEdgeAt(0), next->getChildEdgeAt(0));
+            removeNode(reorder);
+            removeNode(next);
+            initEdge(edge);
+            merged = true;
+        }
+    }
+
+    // the layout-agnostic node between the reorders converting the data back
+    nodes = graphNodes;
+    for (auto &node : nodes) {
+        if ((node->getType() != Activation && node->getType() != Power && node->getType() != Depthwise) ||
+                node->getParentEdges().size() != 1 || node->getChildEdges().empty() || node->isConstant())
+            continue;
+        auto reorder = node->getParentEdgeAt(0)->getParent();
+        if (!isReorder(reorder))
+            continue;
+
+        TensorDesc desc = reorder->getParentEdgeAt(0)->getDesc();
+        bool convertedBack = true;
+        for (size_t i = 0; convertedBack && i < node->getChildEdges().size(); i++) {
+            auto child = node->getChildEdgeAt(i)->getChild();
+            convertedBack = isReorder(child) && equalDescs(desc, child->getChildEdgeAt(0)->getDesc());
+        }
+        if (!convertedBack)
+            continue;
+
+        // the node may work in place only if it is the only child of the new parent
+        auto parent = reorder->getParentEdgeAt(0)->getParent();
+        bool inPlaceAllowed = parent->getChildEdges().size() == 1 && !parent->isConstant();
+        int selected = -1;
+        auto &spds = node->getSupportedPrimitiveDescriptors();
+        for (size_t i = 0; selected < 0 && i < spds.size(); i++) {
+            const auto &config = spds[i].getConfig();
+            if (config.inConfs.size() == 1 && config.outConfs.size() == 1 &&
+                    equalDescs(desc, config.inConfs[0].desc) && equalDescs(desc, config.outConfs[0].desc) &&
+                    (inPlaceAllowed || (config.inConfs[0].inPlace < 0 && config.outConfs[0].inPlace < 0)))
+                selected = static_cast<int>(i);
+        }
+        if (selected < 0)
+            continue;
+
+        node->selectPrimitiveDescriptorByIndex(selected);
+        node->initOptimalPrimitiveDescriptor();
+
+        initEdge(ReplaceEdges(reorder->getParentEdgeAt(0), node->getParentEdgeAt(0)));
+        removeNode(reorder);
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto back = node->getChildEdgeAt(i)->getChild();
+            initEdge(ReplaceEdges(node->getChildEdgeAt(i), back->getChildEdgeAt(0)));
+            removeNode(back);
+        }
+    }
+}
+
+void MKLDNNGraph::GetReorderStatistics(size_t &count, size_t &bytes) const {
+    count = 0;
+    bytes = 0;
+    for (auto &node : graphNodes) {
+        if (node->getType() != Reorder || node->isConstant())
+            continue;
+        // the children of the reorder share its output memory
+        count++;
+        bytes += node->getParentEdgeAt(0)->getMemory().GetSize() + node->getChildEdgeAt(0)->getMemory().GetSize();
+    }
 }
 
 static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
-void MKLDNNGraph::AllocateWithReuse() {
-    std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
+/**
+ * @brief Groups the edges which are views on one memory. The clusters are the connected components of the edges
+ * linked to their shared edges, they are resolved with the union-find in the linear time (getSharedEdge() of the
+ * view may return another view, so the chains are merged transitively).
+ * The clusters are ordered by the first edge of each one in the edges list.
+ */
+static std::vector<std::vector<MKLDNNEdgePtr>> getEdgeClusters(const std::vector<MKLDNNEdgePtr> &graphEdges) {
+    std::vector<MKLDNNEdgePtr> edges(graphEdges);
+    std::unordered_map<MKLDNNEdge *, int> edgeIndex;
+    for (int i = 0; i < edges.size(); i++)
+        edgeIndex[edges[i].get()] = i;
+
+    std::vector<int> root(edges.size());
+    for (int i = 0; i < root.size(); i++)
+        root[i] = i;
+
+    auto find = [&](int i) {
+        while (root[i] != i) {
+            root[i] = root[root[i]];
+            i = root[i];
+        }
+        return i;
+    };
+    // the smallest index is kept as the root, it defines the order of the clusters
+    auto unite = [&](int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a < b) root[b] = a;
+        else if (b < a) root[a] = b;
+    };
 
-    // detect edge clasters which are view on one.
-    for (auto &edge : graphEdges) {
+    for (int i = 0; i < graphEdges.size(); i++) {
+        auto &edge = graphEdges[i];
         MKLDNNEdgePtr par = (edge->getStatus() == MKLDNNEdge::Status::NotAllocated)
                             ? edge->getSharedEdge()
                             : nullptr;
-        if (par) {
-            bool found = false;
-            for (auto &claster : edge_clasters) {
-                for (auto &element : claster) {
-                    if (element == par) {
-                        claster.push_back(edge);
-                        found = true;
-                        break;
-                    }
-                }
-            }
-            if (!found) edge_clasters.push_back({par, edge});
+        if (!par)
+            continue;
 
+        auto found = edgeIndex.find(par.get());
+        int parIndex;
+        if (found == edgeIndex.end()) {
+            parIndex = static_cast<int>(edges.size());
+            edgeIndex[par.get()] = parIndex;
+            edges.push_back(par);
+            root.push_back(parIndex);
         } else {
-            bool found = false;
-            for (auto &claster : edge_clasters) {
-                for (auto &element : claster) {
-                    if (element == edge) {
-                        found = true;
-                        break;
-                    }
-                }
-            }
-            if (!found) edge_clasters.push_back({edge});
+            parIndex = found->second;
         }
+        unite(i, parIndex);
     }
 
-    //======= WA. getSharedEdge() returns not identical edges ============
-    //  Will try to merge clasters with matched edges
-    for (auto &edge : graphEdges) {
-        std::vector<decltype(&edge_clasters[0])> to_merge;
-
-        for (auto &claster : edge_clasters)
-            if (std::find(claster.begin(), claster.end(), edge) != claster.end())
-                to_merge.push_back(&claster);
-
-        if (to_merge.size() > 1) {
-            // Merge clasters
-            auto base_classter = to_merge[0];
-            for (int i = 1; i < to_merge.size(); i++) {
-                base_classter->insert(base_classter->end(),
-                                      to_merge[i]->begin(), to_merge[i]->end());
-                to_merge[i]->clear();
-            }
+    std::vector<std::vector<MKLDNNEdgePtr>> clusters;
+    std::vector<int> clusterOf(edges.size(), -1);
+    for (int i = 0; i < edges.size(); i++) {
+        int r = find(i);
+        if (clusterOf[r] < 0) {
+            clusterOf[r] = static_cast<int>(clusters.size());
+            clusters.emplace_back();
+        }
+        clusters[clusterOf[r]].push_back(edges[i]);
+    }
+    return clusters;
+}
 
-            // remove duplicates in merged claster
-            std::sort(base_classter->begin(), base_classter->end());
-            base_classter->erase(std::unique(base_classter->begin(), base_classter->end()),
-                    base_classter->end() );
+/**
+ * @brief Finds the constant nodes which depend on the Const inputs only. They are computed once on load and
+ * only the data they pass to the rest of the graph is kept. The constant nodes reading non-constant data
+ * (e.g. the PriorBox of the extensions which needs the shape only) are not folded.
+ * @param nodes topologically sorted nodes
+ */
+static std::unordered_set<MKLDNNNode *> getFoldableNodes(const std::vector<MKLDNNNodePtr> &nodes) {
+    std::unordered_set<MKLDNNNode *> foldable;
+    for (auto &node : nodes) {
+        if (!node->isConstant() || node->getType() == Output ||
+                (node->getParentEdges().empty() && node->getType() != Input))
+            continue;
 
-            // remove empty clasters
-            edge_clasters.erase(std::remove_if(edge_clasters.begin(), edge_clasters.end(),
-                    [] ( std::vector<MKLDNNEdgePtr> &cls) { return cls.empty(); }),
-                    edge_clasters.end());
+        bool isFoldable = true;
+        for (size_t i = 0; isFoldable && i < node->getParentEdges().size(); i++)
+            isFoldable = foldable.count(node->getParentEdgeAt(i)->getParent().get()) != 0;
+        if (isFoldable)
+            foldable.insert(node.get());
+    }
+    return foldable;
+}
+
+void MKLDNNGraph::AllocateWithReuse() {
+    std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters = getEdgeClusters(graphEdges);
+
+    // The data passed between the folded constant nodes is only needed on load, it is allocated separately
+    // from the workspace and released by FoldConstants()
+    auto foldable = getFoldableNodes(graphNodes);
+    auto isFoldedData = [&](const std::vector<MKLDNNEdgePtr> &claster) {
+        for (auto &edge : claster) {
+            if (!foldable.count(edge->getParent().get()) || !foldable.count(edge->getChild().get()))
+                return false;
         }
+        return true;
+    };
+    for (auto &claster : edge_clasters) {
+        if (!isFoldedData(claster))
+            continue;
+        for (auto &edge : claster)
+            edge->allocate();
+        claster.clear();
     }
-    //======= End of WA ============
+    edge_clasters.erase(std::remove_if(edge_clasters.begin(), edge_clasters.end(),
+            [] (std::vector<MKLDNNEdgePtr> &cls) { return cls.empty(); }),
+            edge_clasters.end());
 
-    const int alignment = 16;  // 64 bytes or 16 floats
+    const int alignment = workspaceAlignment;
+
+    // the data of the graph only, which is not alive between the inferences, can be placed to the workspace group
+    const bool shareWorkspace = !config.workspaceGroup.empty();
+    std::vector<bool> isShared(edge_clasters.size(), false);
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
     for (int i = 0; i < edge_clasters.size(); i++) {
@@ -520,29 +868,59 @@ void MKLDNNGraph::AllocateWithReuse() {
             // WA. MemoryOutput will keep data in that edge
             // So need to make it immortal..
             isConst |= edge->getParent()->getType() == MemoryInput;
+            // The state written to MemoryOutput is swapped with the data of MemoryInput for the next inference
+            isConst |= edge->getChild()->getType() == MemoryOutput;
         }
 
         if (isInput  | isConst) box.start = 0;
         if (isOutput | isConst) box.finish = -1;
 
+        // The branches are executed simultaneously, so the topological order
+        // doesn't define lifetime of the data and the memory cannot be reused
+        if (!nodeConsumers.empty()) {
+            box.start = 0;
+            box.finish = -1;
+        }
+
         box.size = div_up(box.size, alignment);
+        isShared[i] = shareWorkspace && !(isInput | isOutput | isConst);
     }
 
-    MemorySolver memSolver(boxes);
+    std::vector<MemorySolver::Box> privateBoxes, sharedBoxes;
+    for (int i = 0; i < boxes.size(); i++)
+        (isShared[i] ? sharedBoxes : privateBoxes).push_back(boxes[i]);
+
+    // the best-fit packing is never worse than the greedy one, it pays off on the models with many branches
+    const auto strategy = config.memorySolver == Config::MemorySolverGreedy ? MemorySolver::Greedy
+                                                                            : MemorySolver::BestFit;
+    MemorySolver memSolver(privateBoxes, strategy);
+    workspaceBoxes = privateBoxes;
     size_t total_size = memSolver.solve() * alignment;
 
     memWorkspace.reset(new MKLDNNMemory(eng));
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::FP32, {1, total_size}, Layout::NC)));
+    memWorkspace->CreateOnHugePages(MKLDNNMemoryDesc(TensorDesc(Precision::FP32, {1, total_size}, Layout::NC)),
+                                    config.hugePageSize);
     float* workspace_ptr = static_cast<float*>(memWorkspace->GetData());
 
+    MemorySolver sharedMemSolver(sharedBoxes, strategy);
+    float* shared_workspace_ptr = nullptr;
+    if (!sharedBoxes.empty()) {
+        sharedWorkspaceSize = sharedMemSolver.solve() * alignment * sizeof(float);
+        workspaceGroup = MKLDNNWorkspaceGroup::get(config.workspaceGroup);
+        workspaceGroup->reserve(sharedWorkspaceSize, eng, config.hugePageSize);
+        sharedWorkspacePtr = workspaceGroup->getData();
+        shared_workspace_ptr = static_cast<float*>(sharedWorkspacePtr);
+    }
+
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int offset = memSolver.getOffset(i);
+                int offset = isShared[i] ? sharedMemSolver.getOffset(i) : memSolver.getOffset(i);
+                float* base_ptr = isShared[i] ? shared_workspace_ptr : workspace_ptr;
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in float
+                edge->allocate(base_ptr + offset * alignment);  // alignment in float
                 count++;
             }
         }
@@ -550,7 +928,21 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::RebaseSharedWorkspace() {
+    auto *oldPtr = static_cast<uint8_t*>(sharedWorkspacePtr);
+    auto *newPtr = static_cast<uint8_t*>(workspaceGroup->getData());
+
+    // the views and in-place edges point to the memory of the shared edges, so they are moved as well
+    for (auto &edge : graphEdges) {
+        auto *data = static_cast<uint8_t*>(edge->getMemory().GetData());
+        if (data >= oldPtr && data < oldPtr + sharedWorkspaceSize)
+            edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr + (data - oldPtr));
+    }
+    sharedWorkspacePtr = newPtr;
+}
+
 void MKLDNNGraph::Allocate() {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_Allocate)
     // resolve edges. Define which will be a view on others
     //   NeedAllocation - real blob
     //   NotAllocated - view on other blob, peer or in-place
@@ -564,42 +956,204 @@ void MKLDNNGraph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    for (auto& input : inputNodes) {
+        auto& memory = input.second->getChildEdgeAt(0)->getMemory();
+        defaultInputPtrs[input.first] = memory.GetPrimitive().get_data_handle();
+    }
+    for (auto& output : outputNodes) {
+        // remove out_ from node name
+        auto& memory = output->getParentEdgeAt(0)->getMemory();
+        defaultOutputPtrs[output->getName().substr(4)] = memory.GetPrimitive().get_data_handle();
+    }
 }
 
 void MKLDNNGraph::CreatePrimitives() {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_CreatePrimitives)
+    // the thread safety of the extensions is not known, their primitives are created serially
+    std::vector<MKLDNNNodePtr> nodes;
     for (auto& node : graphNodes) {
-        node->createPrimitive();
+        if (node->getType() == Generic)
+            node->createPrimitive();
+        else
+            nodes.push_back(node);
     }
+
+    // the memory of the edges is allocated already and is only read here, so the nodes generate the JIT code
+    // and reorder the weights in parallel. The costs of the nodes differ a lot, so the threads take them one by one.
+    std::atomic<size_t> nextNode(0);
+    std::atomic<bool> failed(false);
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+    parallel_nt(0, [&](int, int) {
+        for (size_t i = nextNode++; i < nodes.size() && !failed; i = nextNode++) {
+            try {
+                nodes[i]->createPrimitive();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!exception)
+                    exception = std::current_exception();
+                failed = true;
+            }
+        }
+    });
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+/**
+ * The subgraphs computed from the Const inputs only (Power/ScaleShift/Reshape/Permute of the constants and so on)
+ * were executed on load. Every such subgraph is replaced by its last nodes which keep the results and are never
+ * executed again, the rest of the subgraph and its data are released.
+ */
+void MKLDNNGraph::FoldConstants() {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_FoldConstants)
+    auto foldable = getFoldableNodes(graphNodes);
+    if (foldable.empty())
+        return;
+
+    graphEdges.erase(std::remove_if(graphEdges.begin(), graphEdges.end(), [&](const MKLDNNEdgePtr &edge) {
+                         return foldable.count(edge->getParent().get()) && foldable.count(edge->getChild().get());
+                     }), graphEdges.end());
+
+    std::vector<MKLDNNNodePtr> nodes;
+    for (auto &node : graphNodes) {
+        if (!foldable.count(node.get())) {
+            nodes.push_back(node);
+            continue;
+        }
+
+        bool isResult = false;
+        for (size_t i = 0; !isResult && i < node->getChildEdges().size(); i++)
+            isResult = !foldable.count(node->getChildEdgeAt(i)->getChild().get());
+
+        if (isResult) {
+            for (const auto &parentEdge : node->parentEdges)
+                node->removeEdge(parentEdge);
+            node->parentEdges.clear();
+            node->prim.reset(nullptr);
+            node->internalBlobMemory.clear();
+            nodes.push_back(node);
+        } else {
+            node->remove();
+        }
+    }
+
+    graphNodes = nodes;
+    for (size_t i = 0; i < graphNodes.size(); i++)
+        graphNodes[i]->execIndex = static_cast<int>(i);
+
+    // the dataflow refers the nodes by the execIndex
+    if (!nodeConsumers.empty())
+        InitDataflow();
 }
 
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
-    if (input != inputNodes.end()) {
-        MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
-
-        const void *ext_data_ptr = in->cbuffer();
-        void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
-
-        if (ext_data_ptr != inter_data_ptr)
-        input->second->getChildEdgeAt(0)->getMemory().SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
-                MKLDNNMemory::Convert(in->getTensorDesc().getLayout()), ext_data_ptr, in->byteSize(), false);
-
-        // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
-            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
-                _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr));
-            } else {
-                THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
-            }
-        }
-    } else {
+    if (input == inputNodes.end())
         THROW_IE_EXCEPTION << "Input blob for infer '" << name << "' doesn't correspond to input in network";
+
+    auto mean = _meanImages.find(name);
+    PushInputData(input->second, mean != _meanImages.end() ? &mean->second : nullptr, in);
+}
+
+void MKLDNNGraph::PushInputData(const MKLDNNNodePtr &input, MeanImage *mean, const InferenceEngine::Blob::Ptr &in) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_PushInputData)
+    if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
+
+    MKLDNNDims outDims = input->getChildEdgeAt(0)->getDims();
+    void *inter_data_ptr = input->getChildEdgeAt(0)->getMemory().GetData();
+
+    if (!blob_is_dense(in)) {
+        // the strided crop is gathered right into the plain memory of the graph, otherwise it is made dense first
+        TensorDesc graphDesc = input->getChildEdgeAt(0)->getDesc();
+        const Precision precision = in->getTensorDesc().getPrecision();
+        const bool plain = graphDesc.getLayout() != Layout::ANY && graphDesc.getLayout() != Layout::BLOCKED;
+        if (plain && graphDesc.getPrecision() == precision && (!mean || precision == Precision::FP32)) {
+            blob_copy(in, make_blob_with_precision(graphDesc, inter_data_ptr));
+            if (mean)
+                mean->Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr));
+            return;
+        }
+        Blob::Ptr dense = make_blob_with_precision(TensorDesc(precision, in->getTensorDesc().getDims(),
+                                                              in->getTensorDesc().getLayout()));
+        dense->allocate();
+        blob_copy(in, dense);
+        PushInputData(input, mean, dense);
+        return;
+    }
+
+    const void *ext_data_ptr = MKLDNNExtensionUtils::getBlobData(in);
+
+    if (in->getTensorDesc().getPrecision() != Precision::FP32 && canConvertInput(input, mean, in)) {
+        // the input is converted right into the graph memory, taking the mean into account
+        auto *out_data_ptr = reinterpret_cast<float *>(inter_data_ptr);
+        MeanImage noMean;
+        MeanImage &meanImage = mean ? *mean : noMean;
+        switch (in->getTensorDesc().getPrecision()) {
+            case Precision::U8:
+                meanImage.Subtract(outDims, reinterpret_cast<const uint8_t *>(ext_data_ptr), out_data_ptr);
+                break;
+            case Precision::U16:
+                meanImage.Subtract(outDims, reinterpret_cast<const uint16_t *>(ext_data_ptr), out_data_ptr);
+                break;
+            case Precision::I16:
+                meanImage.Subtract(outDims, reinterpret_cast<const int16_t *>(ext_data_ptr), out_data_ptr);
+                break;
+            default:
+                THROW_IE_EXCEPTION << "Unsupported input precision " << in->getTensorDesc().getPrecision();
+        }
+        return;
+    }
+
+    if (ext_data_ptr != inter_data_ptr)
+    input->getChildEdgeAt(0)->getMemory().SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
+            MKLDNNMemory::Convert(in->getTensorDesc().getLayout()), ext_data_ptr, in->byteSize(), false);
+
+    if (mean) {
+        if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
+            mean->Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr));
+        } else {
+            THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
+        }
     }
 }
 
+bool MKLDNNGraph::canConvertInput(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+    auto input = inputNodes.find(name);
+    if (input == inputNodes.end())
+        return false;
+
+    auto mean = _meanImages.find(name);
+    return canConvertInput(input->second, mean != _meanImages.end() ? &mean->second : nullptr, in);
+}
+
+bool MKLDNNGraph::canConvertInput(const MKLDNNNodePtr &input, const MeanImage *mean, const InferenceEngine::Blob::Ptr &in) {
+    switch (in->getTensorDesc().getPrecision()) {
+        case Precision::U8:
+        case Precision::U16:
+        case Precision::I16:
+            break;
+        default:
+            return false;
+    }
+
+    // the data are converted element by element, so only the precision may differ
+    if (!blob_is_dense(in))
+        return false;
+    TensorDesc desc = MKLDNNExtensionUtils::getDenseTensorDesc(in->getTensorDesc());
+    desc.setPrecision(Precision::FP32);
+    if (desc.getLayout() == Layout::ANY ||
+            !MKLDNNExtensionUtils::initTensorsAreEqual(desc, input->getChildEdgeAt(0)->getDesc()))
+        return false;
+
+    return !mean || desc.getLayout() == Layout::NCHW;
+}
+
 void MKLDNNGraph::PullOutputData(BlobMap &out) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_PullOutputData)
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
 
@@ -615,36 +1169,56 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
             out[name] = outBlob;
         }
 
-        Blob::Ptr &ext_blob = out[name];
+        PullOutputData(node, out[name]);
+    }
+}
 
-        // TODO: Why we allow allocation of output memory inside Infer call??
-        // Suggestion is to disable this behaviour
-        if (ext_blob->buffer() == nullptr) {
-            SizeVector dims = node->getParentEdgeAt(0)->getDims().ToSizeVector();
-            std::reverse(dims.begin(), dims.end());  // Blobs dims are in reverse order (legacy of OpenVX :-( )
-            ext_blob->Resize(dims);
-            ext_blob->allocate();
-        }
+void MKLDNNGraph::PullOutputData(const MKLDNNNodePtr &output, Blob::Ptr &ext_blob) {
+    if (!IsReady())
+        THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
+
+    const MKLDNNMemory& intr_blob = output->getParentEdgeAt(0)->getMemory();
 
-        if (ext_blob->byteSize() != intr_blob.GetSize())
-            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
-                               << ext_blob->size() << "!=" << intr_blob.GetSize()/sizeof(float) << ").";
+    // TODO: Why we allow allocation of output memory inside Infer call??
+    // Suggestion is to disable this behaviour
+    if (ext_blob->buffer() == nullptr) {
+        SizeVector dims = output->getParentEdgeAt(0)->getDims().ToSizeVector();
+        std::reverse(dims.begin(), dims.end());  // Blobs dims are in reverse order (legacy of OpenVX :-( )
+        ext_blob->Resize(dims);
+        ext_blob->allocate();
+    }
 
-        void *ext_blob_ptr = ext_blob->buffer();
-        void *intr_blob_ptr = intr_blob.GetData();
+    if (ext_blob->byteSize() != intr_blob.GetSize())
+        THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                           << ext_blob->size() << "!=" << intr_blob.GetSize()/sizeof(float) << ").";
 
-        // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+    void *intr_blob_ptr = intr_blob.GetData();
 
-        int MB = intr_blob.GetDims()[0];
-        int MB_to_process = node->batchToProcess();
-        // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
-        if (config.batchLimit)
-            MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
-        size_t size_to_copy = intr_blob.GetSize() * MB_to_process / MB;
+    int MB = intr_blob.GetDims()[0];
+    int MB_to_process = output->batchToProcess();
+    // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
+    if (config.batchLimit)
+        MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
 
-        memcpy(ext_blob_ptr, intr_blob_ptr, size_to_copy);
+    if (!blob_is_dense(ext_blob)) {
+        // the output is scattered to the strided view, e.g. to the crop of a bigger image
+        Blob::Ptr intr = make_blob_with_precision(output->getParentEdgeAt(0)->getDesc(), intr_blob_ptr);
+        if (MB_to_process < MB) {
+            blob_copy(make_shared_blob(intr, 0, MB_to_process), make_shared_blob(ext_blob, 0, MB_to_process));
+        } else {
+            blob_copy(intr, ext_blob);
+        }
+        return;
     }
+
+    void *ext_blob_ptr = MKLDNNExtensionUtils::getBlobData(ext_blob);
+
+    // That is the same memory. No need to copy
+    if (ext_blob_ptr == intr_blob_ptr) return;
+
+    size_t size_to_copy = intr_blob.GetSize() * MB_to_process / MB;
+
+    memcpy(ext_blob_ptr, intr_blob_ptr, size_to_copy);
 }
 
 #ifdef DEBUG_BMP_OUTPUT
@@ -777,21 +1351,210 @@ void dump_as_bitmaps(const std::string name, const float* data,
 }
 #endif
 
-void MKLDNNGraph::Infer(int batch) {
+void MKLDNNGraph::InitDataflow() {
+    nodeProducersNum.assign(graphNodes.size(), 0);
+    nodeConsumers.assign(graphNodes.size(), {});
+
+    // the topological level of the node, the nodes of one level are independent
+    std::vector<int> levels(graphNodes.size(), 0);
+    std::map<int, int> levelWidth;
+    for (auto &node : graphNodes) {
+        // The state of the memory layers is passed between the infer calls through the common memory,
+        // so such networks are executed sequentially
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput) {
+            nodeProducersNum.clear();
+            nodeConsumers.clear();
+            return;
+        }
+
+        std::unordered_set<int> producers;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            producers.insert(node->getParentEdgeAt(i)->getParent()->execIndex);
+
+        for (int producer : producers) {
+            nodeConsumers[producer].push_back(node->execIndex);
+            levels[node->execIndex] = std::max(levels[node->execIndex], levels[producer] + 1);
+        }
+        nodeProducersNum[node->execIndex] = static_cast<int>(producers.size());
+
+        if (!node->isConstant())
+            levelWidth[levels[node->execIndex]]++;
+    }
+
+    dataflowWidth = 1;
+    for (auto &level : levelWidth)
+        dataflowWidth = std::max(dataflowWidth, level.second);
+
+    // nothing to run in parallel
+    if (dataflowWidth == 1) {
+        nodeProducersNum.clear();
+        nodeConsumers.clear();
+    }
+}
+
+void MKLDNNGraph::InferDataflow(int batch, bool timed, const std::vector<bool> *skippedNodes,
+                                const InferenceEngine::InferCancellation *cancellation) {
+    const int threadsNum = omp_get_max_threads();
+    const int groupsNum = std::max(1, std::min(dataflowWidth, threadsNum));
+    const int groupThreadsNum = std::max(1, threadsNum / groupsNum);
+    const size_t nodesNum = graphNodes.size();
+
+    std::mutex readyMutex;
+    std::condition_variable readyCondVar;
+    std::deque<int> readyNodes;
+    size_t finishedNum = 0;
+    std::exception_ptr exception;
+
+    nodePendingProducers = nodeProducersNum;
+    for (size_t i = 0; i < nodesNum; i++) {
+        if (nodePendingProducers[i] == 0)
+            readyNodes.push_back(static_cast<int>(i));
+    }
+
+    // every ready node is executed by the own group of threads of the nested OpenMP region
+    int nested = omp_get_nested();
+    omp_set_nested(1);
+#pragma omp parallel num_threads(groupsNum)
+    {
+        omp_set_num_threads(groupThreadsNum);
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        while (true) {
+            int idx;
+            {
+                std::unique_lock<std::mutex> lock(readyMutex);
+                readyCondVar.wait(lock, [&] {
+                    return !readyNodes.empty() || finishedNum == nodesNum || exception;
+                });
+                if (readyNodes.empty() || exception)
+                    break;
+                idx = readyNodes.front();
+                readyNodes.pop_front();
+            }
+
+            try {
+                auto &node = graphNodes[idx];
+                // the skipped node releases its consumers at once, they are skipped as well
+                if (!skippedNodes || !(*skippedNodes)[idx]) {
+                    // the cancellation stops the groups as the failure of a node does
+                    if (cancellation && !node->isConstant())
+                        cancellation->check();
+
+                    PERF_IF(node, timed);
+
+                    if (!node->isConstant()) {
+                        IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+                        node->execute(stream);
+                    }
+                }
+            } catch (...) {
+                std::unique_lock<std::mutex> lock(readyMutex);
+                if (!exception)
+                    exception = std::current_exception();
+                readyCondVar.notify_all();
+                break;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(readyMutex);
+                finishedNum++;
+                for (int consumer : nodeConsumers[idx]) {
+                    if (--nodePendingProducers[consumer] == 0)
+                        readyNodes.push_back(consumer);
+                }
+            }
+            readyCondVar.notify_all();
+        }
+    }
+    omp_set_nested(nested);
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+std::vector<bool> MKLDNNGraph::GetSkippedNodes(const std::vector<MKLDNNNodePtr> &skippedOutputs) const {
+    std::vector<bool> needed(graphNodes.size(), false);
+    std::vector<MKLDNNNodePtr> stack;
+    for (auto &output : outputNodes) {
+        if (std::find(skippedOutputs.begin(), skippedOutputs.end(), output) == skippedOutputs.end())
+            stack.push_back(output);
+    }
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryOutput)
+            stack.push_back(node);
+    }
+
+    while (!stack.empty()) {
+        MKLDNNNodePtr node = stack.back();
+        stack.pop_back();
+        if (needed[node->execIndex])
+            continue;
+        needed[node->execIndex] = true;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            stack.push_back(node->getParentEdgeAt(i)->getParent());
+    }
+
+    std::vector<bool> skipped(graphNodes.size());
+    for (size_t i = 0; i < needed.size(); i++)
+        skipped[i] = !needed[i];
+    return skipped;
+}
+
+const std::vector<bool> &MKLDNNGraph::GetCachedSkippedNodes(const std::vector<bool> &skippedOutputs) {
+    std::lock_guard<std::mutex> lock(*skippedNodesMutex);
+    auto found = skippedNodesCache.find(skippedOutputs);
+    if (found != skippedNodesCache.end())
+        return found->second;
+
+    std::vector<MKLDNNNodePtr> outputs;
+    for (size_t i = 0; i < outputNodes.size() && i < skippedOutputs.size(); i++) {
+        if (skippedOutputs[i])
+            outputs.push_back(outputNodes[i]);
+    }
+    return skippedNodesCache[skippedOutputs] = GetSkippedNodes(outputs);
+}
+
+void MKLDNNGraph::Infer(int batch, const std::vector<bool> *skippedNodes,
+                        const InferenceEngine::InferCancellation *cancellation) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    // another graph of the workspace group has grown the shared memory
+    if (workspaceGroup && workspaceGroup->getData() != sharedWorkspacePtr)
+        RebaseSharedWorkspace();
+
+    // the nodes keep the state prepared for the batch limit, so it is only updated when the batch changes
+    if (batch > 0 && batch != dynBatchLim) {
+        for (auto &node : graphNodes)
+            node->setDynamicBatchLim(batch);
+        dynBatchLim = batch;
+    }
+
+    // without the sampling every inference is timed and only the average time is kept
+    const bool sampled = config.perfCountSampling > 0 && inferCount % config.perfCountSampling == 0;
+    const bool timed = config.perfCountSampling == 0 || sampled;
+    inferCount++;
+
+    if (!nodeConsumers.empty()) {
+        InferDataflow(batch, timed, skippedNodes, cancellation);
+        if (sampled)
+            CollectPerfSamples();
+        return;
+    }
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
 #ifdef DEBUG_DUMP_NEW_FOLDER_PER_INFER
         static int folderIdx = 0;
         folderIdx++;
 #endif
     for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+        if (skippedNodes && (*skippedNodes)[i])
+            continue;
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+        if (cancellation && !graphNodes[i]->isConstant())
+            cancellation->check();
+
+        PERF_IF(graphNodes[i], timed);
 
         if (!graphNodes[i]->isConstant()) {
             IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
@@ -894,6 +1657,21 @@ void MKLDNNGraph::Infer(int batch) {
         }
 #endif
     }
+
+    if (sampled)
+        CollectPerfSamples();
+}
+
+void MKLDNNGraph::CollectPerfSamples() {
+    std::map<std::string, uint64_t> typeTimes;
+    for (int i = 1; i < graphNodes.size(); i++) {
+        auto &node = graphNodes[i];
+        uint64_t time = node->PerfCounter().lastDuration();
+        node->PerfSamples().add(time);
+        typeTimes[node->typeStr] += time;
+    }
+    for (auto &typeTime : typeTimes)
+        perfTypeSamples[typeTime.first].add(typeTime.second);
 }
 
 MKLDNNNodePtr MKLDNNGraph::FindNodeWithName(const std::string& name) const {
@@ -958,12 +1736,37 @@ void MKLDNNGraph::SortTopologically() {
     graphNodes.assign(sorted.begin(), sorted.end());
 }
 
+static long long getStatistic(const PerfHistogram &samples, Config::PerfStatistic statistic) {
+    switch (statistic) {
+        case Config::PerfMin: return static_cast<long long>(samples.min());
+        case Config::PerfP50: return static_cast<long long>(samples.percentile(0.5));
+        case Config::PerfP99: return static_cast<long long>(samples.percentile(0.99));
+        case Config::PerfMax: return static_cast<long long>(samples.max());
+        default: return static_cast<long long>(samples.avg());
+    }
+}
+
 void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
+    if (config.perfCountSampling > 0 && config.perfCountByLayerType) {
+        for (auto &typeSamples : perfTypeSamples) {
+            InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[typeSamples.first];
+            pc.cpu_uSec = pc.realTime_uSec = getStatistic(typeSamples.second, config.perfCountStatistic);
+            pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                        : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+            size_t layerTypeLen = sizeof(pc.layer_type) / sizeof(pc.layer_type[0]);
+            typeSamples.first.copy(pc.layer_type, layerTypeLen, 0);
+        }
+        return;
+    }
+
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
             getPerfMapFor = [&](std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap, const MKLDNNNodePtr& node) {
         InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[node->getName()];
         // TODO: Why time counter is signed?
-        pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
+        if (config.perfCountSampling > 0)
+            pc.cpu_uSec = pc.realTime_uSec = getStatistic(node->PerfSamples(), config.perfCountStatistic);
+        else
+            pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
         pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
@@ -1047,9 +1850,25 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(InferenceEngine::ICNNNetwork &network
             type != Eltwise &&
             type != Crop &&
             type != BatchNormalization &&
-            type != Copy) {
+            type != Copy &&
+            type != Type::Reshape &&
+            type != Flatten &&
+            !CaselessEq<std::string>()(layer->type, "DetectionOutput")) {
             check_result = false;
         }
+
+        // the batch is the outermost dimension of the data, it must be kept by the layers
+        if (type == Concatenation) {
+            auto concat = dynamic_cast<ConcatLayer *>(layer.get());
+            if (concat == nullptr || concat->_axis == 0)
+                check_result = false;
+        }
+        if (type == Type::Reshape || type == Flatten) {
+            auto input = layer->insData[0].lock();
+            if (!input || layer->outData.empty() ||
+                    input->getTensorDesc().getDims()[0] != layer->outData[0]->getTensorDesc().getDims()[0])
+                check_result = false;
+        }
     }, false);
 
     return check_result;
@@ -1061,11 +1880,28 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
     return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs);
 }
 
-MKLDNNExecNetwork::MKLDNNExecNetwork(InferenceEngine::ICNNNetwork &network,
+static std::string getShapesKey(const ICNNNetwork &network) {
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+
+    std::string key;
+    for (auto &input : inputs) {
+        key += input.first + ":";
+        for (auto dim : input.second->getTensorDesc().getDims())
+            key += std::to_string(dim) + ",";
+        key += ";";
+    }
+    return key;
+}
+
+MKLDNNExecNetwork::MKLDNNExecNetwork(InferenceEngine::ICNNNetwork &sourceNetwork,
                                      const Config &cfg,
-                                     const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr) {
-    graph.reset(new MKLDNNGraph());
-    graph->setConfig(cfg);
+                                     const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr), config(cfg) {
+    // the layers are rewritten on the copy which shares the weights with the original network,
+    // the graphs of all the streams are created from it
+    rewrittenNetwork = cloneNet(sourceNetwork);
+    MKLDNNGraphOptimizer::RewriteNetwork(*rewrittenNetwork);
+    ICNNNetwork &network = *rewrittenNetwork;
 
     if (cfg.batchLimit > 1) {
         // check topology for applicability
@@ -1074,27 +1910,244 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(InferenceEngine::ICNNNetwork &network,
         }
     }
 
-    if (graph->getProperty().exclusiveAsyncRequests) {
+    // the threads of the scheduler are shared by the networks, so the ones of the network cannot be set
+    MKLDNNScheduler::Ptr scheduler;
+    if (cfg.schedulerGroups > 0) {
+        if (cfg.exclusiveAsyncRequests || cfg.threadsNum > 0 || !cfg.bindCores.empty() || cfg.numaNode >= 0)
+            THROW_IE_EXCEPTION << "The CPU scheduler cannot be used with the exclusive async requests "
+                               << "or with the threads, the cores or the NUMA node of the network";
+        scheduler = MKLDNNScheduler::getInstance(cfg.schedulerGroups, cfg.useThreadBinding);
+    }
+
+    // exclusive requests share the executor with other networks, its workers infer the graphs of the streams
+    // taken from the pool, on the scheduler the streams are the graphs inferred by the different groups at the same time
+    int streams = std::max(cfg.throughputStreams, 1);
+    if (scheduler)
+        streams = std::min(streams, scheduler->getGroupsNumber());
+    // the graphs of the streams are inferred concurrently, so they cannot share the intermediate data
+    if (streams > 1 && !cfg.workspaceGroup.empty())
+        THROW_IE_EXCEPTION << "The workspace group " << cfg.workspaceGroup << " cannot be used with several streams";
+    // the threads of the network are owned by its executor, the exclusive requests share it with other networks
+    const bool ownThreads = cfg.threadsNum > 0 || !cfg.bindCores.empty() || cfg.numaNode >= 0;
+    if (ownThreads && cfg.exclusiveAsyncRequests)
+        THROW_IE_EXCEPTION << "The threads of the network cannot be set for the exclusive async requests";
+
+    if (cfg.blobAllocator != Config::BlobAllocatorSystem) {
+        blobAllocator = InferenceEngine::details::shared_from_irelease(
+                CreatePooledAllocator(cfg.blobAllocator == Config::BlobAllocatorHugePages));
+        if (!blobAllocator)
+            THROW_IE_EXCEPTION << "Cannot create the pooled blob allocator";
+    }
+
+    if (cfg.exclusiveAsyncRequests) {
+        // the first network requesting the executor defines the number of its workers
         ExecutorManager *executorManager = ExecutorManager::getInstance();
-        _taskExecutor = executorManager->getExecutor(TargetDeviceInfo::name(TargetDevice::eCPU));
+        _taskExecutor = executorManager->getExecutor(TargetDeviceInfo::name(TargetDevice::eCPU),
+                                                     static_cast<size_t>(streams));
     }
 
-    // initialization in taskExecutor thread
-    auto task = std::make_shared<InferenceEngine::Task>([&]() {
-        graph->CreateGraph(network, extensionManager);
-    });
+    // the callbacks do not wake up on the cores of the inference threads, the latter start the callbacks
+    // right after the inference and so would be preempted by them
+    TaskExecutorConfig callbackConfig = cfg.asyncThreads;
+#if !(defined(__APPLE__) || defined(_WIN32))
+    if (callbackConfig.cpus.empty()) {
+        const std::vector<int> networkCores = GetNetworkCores(cfg);
+        if (!networkCores.empty())
+            callbackConfig.cpus = OpenMpManager::getOtherProcessors(networkCores);
+    }
+#endif
+    if (!callbackConfig.cpus.empty() || callbackConfig.priority != 0)
+        _callbackExecutor = std::make_shared<TaskExecutor>("CPUCallbacks", callbackConfig);
+
+    if (scheduler) {
+        MKLDNNScheduler::Executor::Ptr executor = scheduler->createExecutor(cfg.schedulerPriority, cfg.schedulerWeight);
+        // the graphs are created one by one by the groups, the executor without the contexts runs a task at a time
+        for (int n = 0; n < streams; n++) {
+            MKLDNNGraph::Ptr graph = std::make_shared<MKLDNNGraph>();
+            graph->setConfig(cfg);
+            graphs.push_back(graph);
+
+            auto task = std::make_shared<InferenceEngine::Task>([&]() {
+                graph->CreateGraph(network, extensionManager);
+            });
+            executor->startTask(task);
+            Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+            if (sts == Task::TS_ERROR) task->checkException();
+        }
+
+        if (streams > 1) {
+            std::vector<MultiWorkerTaskContext> contexts(graphs.size());
+            for (size_t n = 0; n < graphs.size(); n++)
+                contexts[n].ptrGraph = graphs[n];
+            executor->setContexts(contexts);
+        } else {
+            reshapableNetwork = cloneNet(network);
+            reshapedGraphs[getShapesKey(network)] = graphs[0];
+        }
+        _taskExecutor = executor;
+    } else if (streams == 1) {
+        MKLDNNGraph::Ptr graph = std::make_shared<MKLDNNGraph>();
+        graph->setConfig(cfg);
+        graphs.push_back(graph);
+
+        // initialization in taskExecutor thread
+        auto task = std::make_shared<InferenceEngine::Task>([&]() {
+            graph->CreateGraph(network, extensionManager);
+        });
+
+        if (ownThreads) {
+            // the single worker sets the OpenMP team (or the TBB arena) of the network, the graph is not
+            // attached to the worker, so the reshaped graphs are inferred by it as well.
+            // The worker itself is bound to the cores of the network, not only its team
+            const std::vector<int> cores = GetNetworkCores(cfg);
+            const int threads = cores.empty() ? cfg.threadsNum : static_cast<int>(cores.size());
+            _taskExecutor = std::make_shared<MultiWorkerTaskExecutor>(std::vector<Task::Ptr>{task},
+                                                                      "CPUThreadsExecutor", threads,
+                                                                      std::vector<std::vector<int>>{cores});
+        } else {
+            _taskExecutor->startTask(task);
+        }
+        Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+
+        if (sts == Task::TS_ERROR) task->checkException();
+
+        // the layers of the copy share the weights with the original network
+        reshapableNetwork = cloneNet(network);
+        reshapedGraphs[getShapesKey(network)] = graph;
+    } else if (cfg.exclusiveAsyncRequests) {
+        // the threads of the cores are split among the graphs as the ones of the streams below,
+        // the graphs are created one by one by the shared executor
+        const int threadsPerStream = std::max(1, OpenMpManager::getOpenMpThreadNumber() / streams);
+        for (int n = 0; n < streams; n++) {
+            MKLDNNGraph::Ptr graph = std::make_shared<MKLDNNGraph>();
+            graph->setConfig(cfg);
+            graphs.push_back(graph);
+
+            auto task = std::make_shared<InferenceEngine::Task>([&]() {
+                graph->CreateGraph(network, extensionManager);
+            });
+            _taskExecutor->startTask(task);
+            Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+            if (sts == Task::TS_ERROR) task->checkException();
+        }
+        graphPool = std::make_shared<GraphPool>(graphs, threadsPerStream);
+    } else {
+        // with the cores or the NUMA node set the streams share the cores of the network only,
+        // without them the threads of the network are split
+        const std::vector<int> nodeCores = GetNetworkCores(cfg);
+        const int cores = !nodeCores.empty() ? static_cast<int>(nodeCores.size()) :
+                          cfg.threadsNum > 0 ? cfg.threadsNum : OpenMpManager::getOpenMpThreadNumber();
+        const int threadsPerStream = std::max(1, cores / streams);
+
+        // the graphs are created one by one, as the network is not guaranteed to be safe for concurrent reading
+        std::mutex createGraphMutex;
+        std::vector<Task::Ptr> tasks;
+        std::vector<std::vector<int>> streamCores(nodeCores.empty() ? 0 : streams);
+        for (int n = 0; n < streams; n++) {
+            if (!nodeCores.empty()) {
+                // the streams beyond the number of cores of the node wrap around
+                const int first = (n * threadsPerStream) % cores;
+                const int count = std::min(threadsPerStream, cores - first);
+                streamCores[n].assign(nodeCores.begin() + first, nodeCores.begin() + first + count);
+            }
+
+            MKLDNNGraph::Ptr graph = std::make_shared<MKLDNNGraph>();
+            graph->setConfig(cfg);
+            graphs.push_back(graph);
+
+            // initialization in the worker thread of the stream, it owns OpenMP team used for the graph
+            tasks.push_back(std::make_shared<InferenceEngine::Task>([&, n, graph]() {
+#if !(defined(__APPLE__) || defined(_WIN32))
+                if (!nodeCores.empty())
+                    OpenMpManager::bindOpenMpThreadsToCores(streamCores[n]);
+                else if (cfg.useThreadBinding && cfg.threadsNum == 0 && (n + 1) * threadsPerStream <= cores)
+                    OpenMpManager::bindOpenMpThreadsToCores(n * threadsPerStream, threadsPerStream);
+                else
+                    omp_set_num_threads(threadsPerStream);
+#else
+                omp_set_num_threads(threadsPerStream);
+#endif
+                {
+                    std::lock_guard<std::mutex> lock(createGraphMutex);
+                    graph->CreateGraph(network, extensionManager);
+                }
+                MultiWorkerTaskExecutor::ptrContext.ptrGraph = graph;
+            }));
+        }
 
-    _taskExecutor->startTask(task);
-    Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+        // the worker threads are bound to the cores of their streams before the init tasks
+        _taskExecutor = std::make_shared<MultiWorkerTaskExecutor>(tasks, "CPUStreamsExecutor", threadsPerStream,
+                                                                  streamCores);
 
-    if (sts == Task::TS_ERROR) task->checkException();
+        for (auto &task : tasks) {
+            Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+            if (sts == Task::TS_ERROR) task->checkException();
+        }
+    }
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
-    if (graph)  // TODO: graph field cannot be empty
+    for (auto &graph : graphs)
         graph->setProperty(properties);
 }
 
+void MKLDNNExecNetwork::GetExecutorMetrics(std::map<std::string, ExecutorMetrics> &metrics) const {
+    ExecutableNetworkThreadSafeDefault::GetExecutorMetrics(metrics);
+    auto streams = std::dynamic_pointer_cast<MultiWorkerTaskExecutor>(_taskExecutor);
+    if (!streams)
+        return;
+    for (size_t n = 0; n < streams->getWorkersNumber(); n++)
+        metrics["stream" + std::to_string(n)] = streams->getWorkerMetrics(n);
+}
+
+void MKLDNNExecNetwork::Reshape(const std::map<std::string, SizeVector> &inputShapes) {
+    if (!reshapableNetwork)
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The network loaded with several streams cannot be reshaped";
+
+    ResponseDesc resp;
+    if (reshapableNetwork->reshape(inputShapes, &resp) != OK)
+        THROW_IE_EXCEPTION << resp.msg;
+
+    std::string key = getShapesKey(*reshapableNetwork);
+    auto found = reshapedGraphs.find(key);
+    if (found != reshapedGraphs.end()) {
+        graphs[0] = found->second;
+    } else {
+        MKLDNNGraph::Ptr graph = std::make_shared<MKLDNNGraph>();
+        graph->setConfig(config);
+        // the implementations chosen for the current shapes are kept, and the reordered weights
+        // are shared with the current graph (see MKLDNNWeightsSharing)
+        graph->setSelectionFrom(*graphs[0]);
+
+        // the graph is created by the thread which infers it, after the inferences already started
+        auto task = std::make_shared<InferenceEngine::Task>([&]() {
+            graph->CreateGraph(*reshapableNetwork, extensionManager);
+        });
+        _taskExecutor->startTask(task);
+        Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+        if (sts == Task::TS_ERROR) task->checkException();
+
+        reshapedGraphs[key] = graph;
+        graphs[0] = graph;
+    }
+
+    // the blobs of the requests created from now on are allocated with the new shapes
+    InputsDataMap inputs;
+    reshapableNetwork->getInputsInfo(inputs);
+    for (auto &input : inputs) {
+        auto networkInput = _networkInputs.find(input.first);
+        if (networkInput != _networkInputs.end())
+            networkInput->second->getInputData()->setDims(input.second->getTensorDesc().getDims());
+    }
+    OutputsDataMap outputs;
+    reshapableNetwork->getOutputsInfo(outputs);
+    for (auto &output : outputs) {
+        auto networkOutput = _networkOutputs.find(output.first);
+        if (networkOutput != _networkOutputs.end())
+            networkOutput->second->setDims(output.second->getTensorDesc().getDims());
+    }
+}
+
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
@@ -1104,14 +2157,25 @@ void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &
                        [](IInferRequest *p) { p->Release(); });
 
     asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
+    if (config.inlineCompletion)
+        asyncRequestImpl->EnableInlineCompletion(true);
 
     auto mkldnnSyncRequest = dynamic_cast<MKLDNNInferRequest *>(syncRequestImpl.get());
     if (!mkldnnSyncRequest)
         THROW_IE_EXCEPTION << " Cannot get mkldnn sync request.";
-    mkldnnSyncRequest->SetGraph(graph);
+    // all the stream graphs are identical, the graph that executes the request is selected in InferImpl
+    mkldnnSyncRequest->SetGraph(graphs[0]);
+    mkldnnSyncRequest->SetGraphPool(graphPool);
+    // the graphs of the streams are held by the workers of the executor
+    if (graphs.size() > 1 && !graphPool)
+        mkldnnSyncRequest->SetStreamsExecutor(_taskExecutor);
+    mkldnnSyncRequest->SetBlobAllocator(blobAllocator);
 }
 
 MKLDNNExecNetwork::~MKLDNNExecNetwork() {
-    graph.reset();
+    // stream workers hold their graphs, so they are released first
+    _taskExecutor.reset();
+    graphPool.reset();
+    graphs.clear();
     extensionManager.reset();
 }
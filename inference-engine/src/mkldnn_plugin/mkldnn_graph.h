@@ -9,16 +9,24 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/ie_infer_cancellation.hpp>
+#include <cnn_network_impl.hpp>
+#include <memory_solver.hpp>
 
 #include "mkldnn_memory.h"
 #include "config.h"
 #include "perf_count.h"
 #include "mkldnn_dims.h"
 #include "mean_image.h"
+#include "mkldnn_graph_cache.h"
+#include "mkldnn_tuning_cache.h"
+#include "mkldnn_workspace_sharing.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_streams.h"
 
 namespace MKLDNNPlugin {
 
@@ -50,14 +58,58 @@ public:
 
     void CreateGraph(InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
 
+    /**
+     * @brief The next CreateGraph selects the primitive descriptors chosen for the nodes of the graph when they
+     * are still supported (e.g. by the same network with other input shapes), instead of searching for them
+     */
+    void setSelectionFrom(const MKLDNNGraph &graph);
+
     bool hasMeanImageFor(const std::string& name) {
         return _meanImages.find(name) != _meanImages.end();
     }
 
+    /**
+     * @brief Checks whether the U8/U16/I16 input is converted to FP32 and the mean is subtracted by PushInputData
+     * in a single pass directly into the graph memory, without the intermediate FP32 blob
+     */
+    bool canConvertInput(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    bool canConvertInput(const MKLDNNNodePtr &input, const MeanImage *mean, const InferenceEngine::Blob::Ptr &in);
+
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
-    void Infer(int batch = -1);
+    /**
+     * @brief The versions of PushInputData and PullOutputData for the input/output node found by the caller in advance
+     * (e.g. the infer request binding its blobs to the graph once), the mean image is nullptr if there is none
+     */
+    void PushInputData(const MKLDNNNodePtr &input, MeanImage *mean, const InferenceEngine::Blob::Ptr &in);
+    void PullOutputData(const MKLDNNNodePtr &output, InferenceEngine::Blob::Ptr &out);
+
+    /**
+     * @brief Infers the graph
+     * @param batch - the dynamic batch, -1 for the batch of the graph
+     * @param skippedNodes - the nodes not executed by this inference by their execution index (see GetSkippedNodes),
+     * nullptr to execute all the nodes
+     * @param cancellation - the cancellation of the inference checked before every node, the cancelled inference
+     * throws INFER_CANCELLED and leaves the outputs incomplete
+     */
+    void Infer(int batch = -1, const std::vector<bool> *skippedNodes = nullptr,
+               const InferenceEngine::InferCancellation *cancellation = nullptr);
+
+    /**
+     * @brief Finds the nodes which are needed only for the given outputs, they may be skipped when the outputs
+     * are not read. The state of the memory layers is always computed.
+     * @param skippedOutputs - the output nodes which are not needed
+     * @return the flags of the skipped nodes by their execution index
+     */
+    std::vector<bool> GetSkippedNodes(const std::vector<MKLDNNNodePtr> &skippedOutputs) const;
+
+    /**
+     * @brief The cached version of GetSkippedNodes for the requests switching between the sets of the outputs
+     * @param skippedOutputs - the flags of the skipped outputs in the order of the output nodes of the graph
+     * @return the flags of the skipped nodes, they are kept by the graph until it is recreated
+     */
+    const std::vector<bool> &GetCachedSkippedNodes(const std::vector<bool> &skippedOutputs);
 
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
@@ -77,6 +129,12 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief The number of the reorders run by every inference and the bytes they read and write, the reorders
+     * of the constant data are done once on load and are not counted
+     */
+    void GetReorderStatistics(size_t &count, size_t &bytes) const;
+
 protected:
     MKLDNNNodePtr FindNodeWithName(const std::string& name) const;
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
@@ -91,11 +149,34 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        nodeProducersNum.clear();
+        nodeConsumers.clear();
+        dataflowWidth = 1;
+        dynBatchLim = 0;
+        inferCount = 0;
+        perfTypeSamples.clear();
+        defaultInputPtrs.clear();
+        defaultOutputPtrs.clear();
+        skippedNodesCache.clear();
+        workspaceGroup.reset();
+        sharedWorkspacePtr = nullptr;
+        sharedWorkspaceSize = 0;
+        workspaceBoxes.clear();
     }
     Status status;
     Config config;
 
     MKLDNNMemoryPtr memWorkspace;
+    // the live times and the sizes of the data placed to memWorkspace by AllocateWithReuse(), they are kept
+    // for the reports of the memory solver. The sizes are counted in the units of workspaceAlignment floats
+    std::vector<InferenceEngine::MemorySolver::Box> workspaceBoxes;
+    static constexpr int workspaceAlignment = 16;  // 64 bytes or 16 floats
+
+    // the intermediate data placed to the memory of the workspace group (see Config::workspaceGroup),
+    // the edges are moved to the new data of the group if another graph has reallocated it
+    MKLDNNWorkspaceGroup::Ptr workspaceGroup;
+    void *sharedWorkspacePtr = nullptr;
+    size_t sharedWorkspaceSize = 0;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -104,13 +185,56 @@ protected:
 
     std::map<std::string, MeanImage> _meanImages;
 
+    // memory of the input and output edges allocated by the graph, the infer requests bind the user blobs
+    // to these edges for the time of inference and restore the default memory for others
+    std::map<std::string, void*> defaultInputPtrs;
+    std::map<std::string, void*> defaultOutputPtrs;
+
+    // dataflow execution data (see Config::parallelBranches), the nodes are referred by the execIndex
+    std::vector<int> nodeProducersNum;
+    std::vector<std::vector<int>> nodeConsumers;
+    std::vector<int> nodePendingProducers;
+    int dataflowWidth = 1;
+
+    // the skipped nodes by the flags of the skipped outputs (see GetCachedSkippedNodes), the graph is shared
+    // by the requests
+    std::map<std::vector<bool>, std::vector<bool>> skippedNodesCache;
+    std::shared_ptr<std::mutex> skippedNodesMutex = std::make_shared<std::mutex>();
+
+    // the batch limit set to the nodes by the last inference (see Config::enableDynamicBatch), 0 if it is not set
+    int dynBatchLim = 0;
+
+    // the sampled timing (see Config::perfCountSampling): the number of inferences done so far and the distribution
+    // of the total time of the nodes of every layer type in one timed inference
+    uint64_t inferCount = 0;
+    std::map<std::string, PerfHistogram> perfTypeSamples;
+
+    // the choice of the primitive descriptors stored on disk or made by setSelectionFrom(), it exists only while
+    // the graph is created
+    MKLDNNGraphCache::Ptr graphCache;
+    // the timing results of the convolutions (see Config::tuningMode), it exists only while the graph is created
+    MKLDNNTuningCache::Ptr tuningCache;
+
     mkldnn::engine eng;
 
     void InitNodes();
     void InitEdges();
+    void InsertReorder(const MKLDNNEdgePtr &edge);
+    void RemoveRedundantReorders();
+    /**
+     * @brief Connects the parent of the first edge to the child of the second one, the new edge takes their places
+     * in the nodes and in the graph
+     */
+    MKLDNNEdgePtr ReplaceEdges(const MKLDNNEdgePtr &from, const MKLDNNEdgePtr &to);
     void Allocate();
     void AllocateWithReuse();
+    void RebaseSharedWorkspace();
     void CreatePrimitives();
+    void FoldConstants();
+    void InitDataflow();
+    void InferDataflow(int batch, bool timed, const std::vector<bool> *skippedNodes,
+                       const InferenceEngine::InferCancellation *cancellation);
+    void CollectPerfSamples();
 
     friend class MKLDNNInferRequest;
 
@@ -141,10 +265,31 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void Reshape(const std::map<std::string, InferenceEngine::SizeVector> &inputShapes) override;
+
+    /**
+     * @brief Adds the metrics of every stream as "stream<N>" to the ones of the executors
+     */
+    void GetExecutorMetrics(std::map<std::string, InferenceEngine::ExecutorMetrics> &metrics) const override;
+
 protected:
-    MKLDNNGraph::Ptr graph;
+    // one graph per stream (see MultiWorkerTaskExecutor), the first one is used for the requests bookkeeping
+    std::vector<MKLDNNGraph::Ptr> graphs;
+    // the graphs of the streams of the exclusive async requests, null otherwise
+    GraphPool::Ptr graphPool;
     MKLDNNExtensionManager::Ptr extensionManager;
 
+    // the copy of the loaded network after the rewrites of the layers (see MKLDNNGraphOptimizer::RewriteNetwork)
+    InferenceEngine::details::CNNNetworkImplPtr rewrittenNetwork;
+
+    // the copy of the network reshaped by Reshape() and the graphs created for the input shapes used so far,
+    // so switching back to the known shapes costs nothing (the reshape is supported with the single stream only)
+    InferenceEngine::details::CNNNetworkImplPtr reshapableNetwork;
+    std::map<std::string, MKLDNNGraph::Ptr> reshapedGraphs;
+    Config config;
+    // the allocator of the blobs of all the requests, null for the system one
+    std::shared_ptr<InferenceEngine::IAllocator> blobAllocator;
+
     bool CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const;
 };
 
@@ -0,0 +1,198 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_graph_cache.h"
+#include "mkldnn_extension_utils.h"
+#include <graph_tools.hpp>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <chrono>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+const char cacheSignature[] = "MKLDNNGraphCache";
+
+struct Hasher {
+    uint64_t hash = MKLDNNExtensionUtils::hashData(nullptr, 0);
+
+    void add(const void *data, size_t size) {
+        hash = MKLDNNExtensionUtils::hashData(data, size, hash);
+    }
+    void add(const std::string &str) {
+        // the size separates the neighbour strings
+        add(str.size());
+        add(str.data(), str.size());
+    }
+    void add(size_t value) {
+        add(&value, sizeof(value));
+    }
+    void add(const SizeVector &dims) {
+        add(dims.size());
+        for (auto dim : dims) add(dim);
+    }
+    void add(const DataPtr &data) {
+        add(data->getName());
+        add(std::string(data->getPrecision().name()));
+        add(static_cast<size_t>(data->getLayout()));
+        add(data->getDims());
+    }
+};
+
+}  // namespace
+
+MKLDNNGraphCache::MKLDNNGraphCache(const std::string &cacheDir, ICNNNetwork &network, const Config &config) {
+    Hasher hasher;
+
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (auto &input : inputs) {
+        hasher.add(input.first);
+        hasher.add(std::string(input.second->getInputPrecision().name()));
+        hasher.add(input.second->getInputData());
+        hasher.add(static_cast<size_t>(input.second->getPreProcess().getMeanVariant()));
+    }
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    for (auto &output : outputs) {
+        hasher.add(output.first);
+    }
+
+    for (auto &layer : CNNNetSortTopologically(network)) {
+        hasher.add(layer->name);
+        hasher.add(layer->type);
+        hasher.add(std::string(layer->precision.name()));
+        for (auto &param : layer->params) {
+            hasher.add(param.first);
+            hasher.add(param.second);
+        }
+        for (auto &data : layer->insData) {
+            auto locked = data.lock();
+            if (locked)
+                hasher.add(locked);
+        }
+        for (auto &data : layer->outData) {
+            hasher.add(data);
+        }
+        for (auto &blob : layer->blobs) {
+            hasher.add(blob.first);
+            if (blob.second) {
+                const void *data = blob.second->cbuffer();
+                hasher.add(blob.second->byteSize());
+                hasher.add(data, blob.second->byteSize());
+            }
+        }
+    }
+
+    // the options which change the set of the supported descriptors
+    hasher.add(static_cast<size_t>(config.enableDynamicBatch));
+    hasher.add(static_cast<size_t>(config.batchLimit));
+
+    std::stringstream keyStream;
+    keyStream << std::hex << hasher.hash << "_" << MKLDNNExtensionUtils::getIsaName();
+    key = keyStream.str();
+
+    path = cacheDir;
+    if (!path.empty() && path.back() != '/' && path.back() != '\\')
+        path += "/";
+    path += "mkldnn_" + key + ".cache";
+}
+
+MKLDNNGraphCache::MKLDNNGraphCache(const std::vector<MKLDNNNodePtr> &nodes) {
+    for (auto &node : nodes) {
+        auto *selected = node->getSelectedPrimitiveDescriptor();
+        if (!selected)
+            continue;
+        Entry entry;
+        entry.index = static_cast<int>(selected - &node->getSupportedPrimitiveDescriptors()[0]);
+        entry.implType = static_cast<int>(selected->getImplementationType());
+        entry.supportedNum = node->getSupportedPrimitiveDescriptors().size();
+        entries[node->getName()] = entry;
+    }
+}
+
+bool MKLDNNGraphCache::load() {
+    if (path.empty())
+        return !entries.empty();
+
+    entries.clear();
+
+    std::ifstream file(path);
+    if (!file.is_open())
+        return false;
+
+    std::string signature, fileKey;
+    file >> signature >> fileKey;
+    if (signature != cacheSignature || fileKey != key)
+        return false;
+
+    Entry entry;
+    std::string name;
+    while (file >> entry.index >> entry.implType >> entry.supportedNum) {
+        // the rest of the line is the name of the node, it can contain spaces
+        file.get();
+        std::getline(file, name);
+        entries[name] = entry;
+    }
+    return !entries.empty();
+}
+
+void MKLDNNGraphCache::save(const std::vector<MKLDNNNodePtr> &nodes) const {
+    if (path.empty())
+        return;
+
+    // the file is written aside and renamed, so the processes started simultaneously never read partial data
+    std::string tmpPath = path + ".tmp" +
+            std::to_string(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    {
+        std::ofstream file(tmpPath);
+        if (!file.is_open())
+            return;
+
+        file << cacheSignature << " " << key << std::endl;
+        for (auto &node : nodes) {
+            auto *selected = node->getSelectedPrimitiveDescriptor();
+            if (!selected)
+                continue;
+            auto index = static_cast<int>(selected - &node->getSupportedPrimitiveDescriptors()[0]);
+            file << index << " " << static_cast<int>(selected->getImplementationType()) << " "
+                 << node->getSupportedPrimitiveDescriptors().size() << " " << node->getName() << std::endl;
+        }
+        if (!file.good()) {
+            file.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        // rename doesn't replace the existing file on some platforms
+        std::remove(path.c_str());
+        if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+            std::remove(tmpPath.c_str());
+    }
+}
+
+bool MKLDNNGraphCache::select(const MKLDNNNodePtr &node) const {
+    auto found = entries.find(node->getName());
+    if (found == entries.end())
+        return false;
+
+    const Entry &entry = found->second;
+    const auto &supported = node->getSupportedPrimitiveDescriptors();
+    if (supported.size() != entry.supportedNum || entry.index < 0 || entry.index >= supported.size() ||
+            static_cast<int>(supported[entry.index].getImplementationType()) != entry.implType)
+        return false;
+
+    node->selectPrimitiveDescriptorByIndex(entry.index);
+    return true;
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include "config.h"
+#include "mkldnn_node.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief On-disk storage of the primitive descriptors chosen for the graph nodes (see Config::graphCacheDir).
+ * The file is keyed by the hash of the network (topology, parameters and weights), the CPU instruction set
+ * and the options that affect the choice, so the cached choice is only applied to the same network compiled
+ * on the same kind of machine. The next loads of the network skip the selection of the descriptors; the weights
+ * are still reordered at load, the reorder is a single pass over them which costs no more than their read.
+ */
+class MKLDNNGraphCache {
+public:
+    typedef std::shared_ptr<MKLDNNGraphCache> Ptr;
+
+    MKLDNNGraphCache(const std::string &cacheDir, InferenceEngine::ICNNNetwork &network, const Config &config);
+
+    /**
+     * @brief Creates the in-memory choice of the descriptors selected for the nodes of another graph,
+     * it is neither loaded nor saved
+     */
+    explicit MKLDNNGraphCache(const std::vector<MKLDNNNodePtr> &nodes);
+
+    /**
+     * @brief Reads the cached choice
+     * @return true if the cache file for the network exists and is valid
+     */
+    bool load();
+
+    /**
+     * @brief Stores the descriptors selected for the nodes
+     */
+    void save(const std::vector<MKLDNNNodePtr> &nodes) const;
+
+    /**
+     * @brief Selects the cached primitive descriptor for the node
+     * @return false if nothing is cached for the node or the cached entry doesn't match the
+     * supported primitive descriptors of the node
+     */
+    bool select(const MKLDNNNodePtr &node) const;
+
+    const std::string &getPath() const {
+        return path;
+    }
+
+private:
+    struct Entry {
+        int index;
+        int implType;
+        size_t supportedNum;
+    };
+
+    std::string key;
+    std::string path;
+    std::map<std::string, Entry> entries;
+};
+
+}  // namespace MKLDNNPlugin
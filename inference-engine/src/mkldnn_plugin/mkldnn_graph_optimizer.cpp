@@ -7,10 +7,17 @@
 #include <list>
 #include <memory>
 #include <set>
+#include <vector>
+#include <cmath>
+#include <algorithm>
 #include <nodes/mkldnn_activation_node.h>
 #include "mkldnn_graph_optimizer.h"
 #include "nodes/mkldnn_pooling_node.h"
 #include "nodes/mkldnn_eltwise_node.h"
+#include "nodes/mkldnn_conv_node.h"
+#include "mkldnn_channel_linear.h"
+#include <graph_transformer.h>
+#include <ie_profiling.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -18,17 +25,35 @@ using namespace InferenceEngine;
 
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
+static bool isInt8Convolution(const MKLDNNNodePtr &node) {
+    auto *convNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get());
+    return convNode && convNode->isInt8();
+}
+
 void MKLDNNGraphOptimizer::Optimize(MKLDNNGraph &graph) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_OptimizeGraph)
     MergeGroupConvolution(graph);
     RemoveDropped(graph);
 
+    FuseScaleShiftAndConvolution(graph);
+    RemoveDropped(graph);
+
+    FuseConvolutionAndScaleShift(graph);
+    RemoveDropped(graph);
+
     FuseConvolutionAndActivation(graph);
     RemoveDropped(graph);
 
-    FuseConvolutionAndDWConvolution(graph);
+    FuseFullyConnectedAndScaleShift(graph);
+    RemoveDropped(graph);
+
+    FuseFullyConnectedAndActivation(graph);
+    RemoveDropped(graph);
+
+    FuseConvolutionAndRequantization(graph);
     RemoveDropped(graph);
 
-    FuseBatchNormWithScale(graph);
+    FuseConvolutionAndDWConvolution(graph);
     RemoveDropped(graph);
 
     RemoveIdentityOperator(graph);
@@ -37,6 +62,12 @@ void MKLDNNGraphOptimizer::Optimize(MKLDNNGraph &graph) {
     FuseConvolutionSumAndConvolutionSumActivation(graph);
     RemoveDropped(graph);
 
+    FuseElementwiseChains(graph);
+    RemoveDropped(graph);
+
+    FuseTileAndEltwise(graph);
+    RemoveDropped(graph);
+
     RemoveDroppedEdges(graph);
 }
 
@@ -44,7 +75,8 @@ void MKLDNNGraphOptimizer::MergeGroupConvolution(MKLDNNGraph &graph) {
     for (auto node : graph.GetNodes()) {
         // Split with at least 2 Convolutions
         if (!IsOneOf(node->getType(), {Split}) || node->getChildEdges().size() < 2 ||
-                !IsOneOf(node->getChildEdgeAt(0)->getChild()->getType(), {Convolution, Convolution_Activation})) {
+                !IsOneOf(node->getChildEdgeAt(0)->getChild()->getType(), {Convolution, Convolution_Activation}) ||
+                isInt8Convolution(node->getChildEdgeAt(0)->getChild())) {
             continue;
         }
         bool canBeMerged = true;
@@ -94,26 +126,183 @@ void MKLDNNGraphOptimizer::MergeGroupConvolution(MKLDNNGraph &graph) {
     }
 }
 
-void MKLDNNGraphOptimizer::FuseBatchNormWithScale(MKLDNNGraph &graph) {
-    auto &graphNodes = graph.GetNodes();
+/**
+ *  The ScaleShift after the BatchNorm is folded with the statistics of the latter, the pair becomes the ScaleShift
+ *  of the name of the second layer:
+ *
+ *    scale'[c] = scale[c] / sqrt(variance[c] + eps),  shift'[c] = shift[c] - mean[c] * scale'[c]
+ *
+ *  The values of the blobs of a single element are used for all the channels.
+ */
+static CNNLayerPtr FuseBatchNormAndScaleShift(const std::vector<CNNLayerPtr> &layers) {
+    auto *bn = dynamic_cast<BatchNormalizationLayer *>(layers[0].get());
+    auto *scaleShift = dynamic_cast<ScaleShiftLayer *>(layers[1].get());
+    if (!bn || !scaleShift || !bn->_weights || !bn->_biases || !scaleShift->_weights)
+        return nullptr;
+    const SizeVector &dims = bn->outData[0]->getTensorDesc().getDims();
+    if (dims.size() < 2)
+        return nullptr;
+    const size_t channels = dims[1];
+    auto isChannelBlob = [channels](const Blob::Ptr &blob) {
+        return !blob || (blob->precision() == Precision::FP32 && (blob->size() == channels || blob->size() == 1));
+    };
+    if (!isChannelBlob(bn->_weights) || !isChannelBlob(bn->_biases) ||
+        !isChannelBlob(scaleShift->_weights) || !isChannelBlob(scaleShift->_biases))
+        return nullptr;
+    auto value = [](const Blob::Ptr &blob, size_t c, float defaultValue) {
+        if (!blob)
+            return defaultValue;
+        const float *data = blob->cbuffer().as<const float *>();
+        return data[blob->size() == 1 ? 0 : c];
+    };
+
+    TensorDesc desc(Precision::FP32, {channels}, Layout::C);
+    TBlob<float>::Ptr weights = make_shared_blob<float>(desc);
+    TBlob<float>::Ptr biases = make_shared_blob<float>(desc);
+    weights->allocate();
+    biases->allocate();
+    float *scales = weights->data();
+    float *shifts = biases->data();
+    for (size_t c = 0; c < channels; c++) {
+        scales[c] = value(scaleShift->_weights, c, 1.0f) / std::sqrt(value(bn->_weights, c, 1.0f) + bn->epsilon);
+        shifts[c] = value(scaleShift->_biases, c, 0.0f) - value(bn->_biases, c, 0.0f) * scales[c];
+    }
+
+    auto fused = std::make_shared<ScaleShiftLayer>(LayerParams{scaleShift->name, scaleShift->type,
+                                                               scaleShift->precision});
+    fused->params = scaleShift->params;
+    fused->affinity = scaleShift->affinity;
+    fused->_broadcast = 0;
+    fused->_weights = weights;
+    fused->_biases = biases;
+    fused->blobs["weights"] = weights;
+    fused->blobs["biases"] = biases;
+    return fused;
+}
+
+size_t MKLDNNGraphOptimizer::RewriteNetwork(details::CNNNetworkImpl &network) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_RewriteNetwork)
+    static const GraphRewriter rewriter = GraphRewriter()
+            .addRule("BatchNormAndScaleShift", {{"BatchNormalization", nullptr}, {"ScaleShift", nullptr}},
+                     FuseBatchNormAndScaleShift);
+    return rewriter.run(network);
+}
+
+/**
+ *  The per-channel linear layers following the convolution (ScaleShift, BatchNorm, Power with the power 1, e.g.
+ *  BatchNorm+Scale of the ResNet blocks) are folded into the weights and the biases of the convolution:
+ *
+ *    W'[oc] = W[oc] * scale[oc],  B'[oc] = B[oc] * scale[oc] + shift[oc]
+ *
+ *  The convolution stays of the Convolution type, so the activation or sum after these layers can be fused next.
+ */
+void MKLDNNGraphOptimizer::FuseConvolutionAndScaleShift(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
 
     for (int i = 0; i < graphNodes.size(); i++) {
-        const auto& bn = graphNodes[i];
-        if (bn->getType() == BatchNormalization) {
-            const auto& outputNodes = graph.GetOutputNodes();
-            const std::string node_name = bn->getName();
-            // Check that the node is not output node
-            if (std::find_if(outputNodes.begin(), outputNodes.end(),
-                            [&node_name](const MKLDNNNodePtr& x) {
-                                return x->getName() == node_name;}) == outputNodes.end()) {
-                if (bn->getChildEdges().size() == 1) {
-                    auto child = bn->getChildEdgeAt(0)->getChild();
-                    if (child->type == Depthwise && child->getCnnLayer()->type == "ScaleShift") {
-                        bn->fuseWith(child);
-                        DropNode(graph, child);
-                    }
-                }
-            }
+        auto conv = graphNodes[i];
+        if (conv->getType() != Convolution || isInt8Convolution(conv))
+            continue;
+
+        auto* convLayer = dynamic_cast<ConvolutionLayer *>(conv->getCnnLayer().get());
+        if (!convLayer)
+            continue;
+
+        MKLDNNChannelLinear linear;
+        while (conv->getChildEdges().size() == 1) {
+            auto child = conv->getChildEdgeAt(0)->getChild();
+            if (child->getParentEdges().size() != 1 ||
+                    !MKLDNNChannelLinear::fromNode(child, convLayer->_out_depth, linear))
+                break;
+
+            conv->fuseWith(child);
+            DropNode(graph, child);
+        }
+    }
+}
+
+/**
+ *  The same folding for the fully connected layer, W'[oc] = W[oc] * scale[oc], B'[oc] = B[oc] * scale[oc] + shift[oc]
+ */
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndScaleShift(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto fc = graphNodes[i];
+        if (fc->getType() != FullyConnected)
+            continue;
+
+        auto* fcLayer = dynamic_cast<FullyConnectedLayer *>(fc->getCnnLayer().get());
+        if (!fcLayer)
+            continue;
+
+        MKLDNNChannelLinear linear;
+        while (fc->getChildEdges().size() == 1) {
+            auto child = fc->getChildEdgeAt(0)->getChild();
+            if (child->getParentEdges().size() != 1 ||
+                    !MKLDNNChannelLinear::fromNode(child, fcLayer->_out_num, linear))
+                break;
+
+            fc->fuseWith(child);
+            DropNode(graph, child);
+        }
+    }
+}
+
+/**
+ *  The per-channel linear layer preceding the convolution (e.g. the normalization of the input image) is folded
+ *  into the weights of the convolution:
+ *
+ *    W'[oc][ic] = W[oc][ic] * scale[ic],  B'[oc] = B[oc] + sum(W[oc][ic] * shift[ic])
+ *
+ *  The padded values of the input are zeros, not the shifts, so the layers with the shifts are only folded into
+ *  the convolutions without the padding.
+ */
+void MKLDNNGraphOptimizer::FuseScaleShiftAndConvolution(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto hasPadding = [](const MKLDNNNodePtr &conv, const ConvolutionLayer *convLayer) {
+        if (convLayer->_padding_x || convLayer->_padding_y)
+            return true;
+
+        const MKLDNNDims &inDims = conv->getParentEdgeAt(0)->getDims();
+        const MKLDNNDims &outDims = conv->getChildEdgeAt(0)->getDims();
+        int kernels[] = {static_cast<int>(convLayer->_kernel_y), static_cast<int>(convLayer->_kernel_x)};
+        int strides[] = {static_cast<int>(convLayer->_stride_y), static_cast<int>(convLayer->_stride_x)};
+        int dilations[] = {static_cast<int>(convLayer->_dilation_y), static_cast<int>(convLayer->_dilation_x)};
+        for (int i = 0; i < 2; i++) {
+            int krn = (kernels[i] - 1) * dilations[i] + 1;
+            int calc_dst = (inDims[2 + i] - krn) / strides[i] + 1;
+            if (outDims[2 + i] != calc_dst)
+                return true;
+        }
+        return false;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto conv = graphNodes[i];
+        auto* convNode = dynamic_cast<MKLDNNConvolutionNode *>(conv.get());
+        if (!convNode || conv->getType() != Convolution || convNode->isInt8() || !conv->getMergeWith().empty() ||
+                conv->getParentEdges().size() != 1 || conv->getParentEdgeAt(0)->getDims().ndims() != 4)
+            continue;
+
+        auto* convLayer = dynamic_cast<ConvolutionLayer *>(conv->getCnnLayer().get());
+        if (!convLayer)
+            continue;
+
+        size_t channels = conv->getParentEdgeAt(0)->getDims()[1];
+        bool padded = hasPadding(conv, convLayer);
+
+        MKLDNNChannelLinear linear;
+        while (true) {
+            auto parent = conv->getParentEdgeAt(0)->getParent();
+            // the network outputs have another child, the output node
+            if (parent->getParentEdges().size() != 1 || parent->getChildEdges().size() != 1 ||
+                    !MKLDNNChannelLinear::fromNode(parent, channels, linear) || (padded && linear.hasShifts()))
+                break;
+
+            convNode->foldInputWith(parent);
+            DropNode(graph, parent);
         }
     }
 }
@@ -169,6 +358,110 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndActivation(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndActivation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto fc = graphNodes[i];
+        if (fc->getType() != FullyConnected || fc->getChildEdges().size() != 1)
+            continue;
+
+        bool hasActivation = false;
+        for (auto &node : fc->getFusedWith())
+            hasActivation = hasActivation || dynamic_cast<MKLDNNActivationNode *>(node.get()) != nullptr;
+        if (hasActivation)
+            continue;
+
+        auto activation = fc->getChildEdgeAt(0)->getChild();
+        if (!activation->getCnnLayer() || !dynamic_cast<MKLDNNActivationNode *>(activation.get()))
+            continue;
+
+        fc->fuseWith(activation);
+        DropNode(graph, activation);
+    }
+}
+
+/**
+ *  CNNNetworkInt8Normalizer surrounds every quantized Convolution+ReLU with ScaleShift layers which convert
+ *  the data from and to FP32. Two quantized convolutions are connected by a chain of such ScaleShifts:
+ *
+ *    conv 1 (s8) -> ScaleShift (* o-scale) -> ScaleShift (/ i-scale) -> conv 2 (u8)
+ *
+ *  The chain is folded into the output scales of the first convolution and it produces u8 data for the second one,
+ *  so there are no reorders and FP32 data between them.
+ */
+void MKLDNNGraphOptimizer::FuseConvolutionAndRequantization(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // the output of ReLU is non-negative, so it is representable as u8
+    auto hasReLU = [](const MKLDNNNodePtr &node) {
+        for (auto &fused : node->fusedWith) {
+            auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(fused.get());
+            if (activationNode && activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_relu &&
+                    activationNode->getAlpha() == 0.0f)
+                return true;
+        }
+        return false;
+    };
+
+    auto getScales = [](const MKLDNNNodePtr &node, std::vector<float> &scales) {
+        if (node->getType() != Depthwise || node->getCnnLayer()->type != "ScaleShift")
+            return false;
+
+        auto* layer = dynamic_cast<ScaleShiftLayer*>(node->getCnnLayer().get());
+        if (layer == nullptr || layer->_weights == nullptr || layer->_weights->precision() != Precision::FP32)
+            return false;
+        if (layer->_biases != nullptr) {
+            const float *biases = layer->_biases->cbuffer().as<const float *>();
+            for (size_t i = 0; i < layer->_biases->size(); i++)
+                if (biases[i] != 0.0f)
+                    return false;
+        }
+
+        const float *weights = layer->_weights->cbuffer().as<const float *>();
+        scales.assign(weights, weights + layer->_weights->size());
+        return true;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto conv = graphNodes[i];
+        if (conv->getType() != Convolution_Activation || !isInt8Convolution(conv) || !hasReLU(conv))
+            continue;
+
+        std::vector<MKLDNNNodePtr> scaleShifts;
+        std::vector<float> scales;
+        MKLDNNNodePtr child = conv;
+        while (child->getChildEdges().size() == 1) {
+            child = child->getChildEdgeAt(0)->getChild();
+
+            std::vector<float> childScales;
+            if (!getScales(child, childScales))
+                break;
+            // the negative scale would break the range of u8 data
+            if (std::any_of(childScales.begin(), childScales.end(), [](float scale) { return scale < 0.0f; }))
+                break;
+            if (scales.empty()) {
+                scales = childScales;
+            } else {
+                if (scales.size() != childScales.size() && scales.size() != 1 && childScales.size() != 1)
+                    break;
+                if (scales.size() == 1)
+                    scales.resize(childScales.size(), scales[0]);
+                for (size_t c = 0; c < scales.size(); c++)
+                    scales[c] *= childScales[childScales.size() == 1 ? 0 : c];
+            }
+            scaleShifts.push_back(child);
+        }
+
+        if (scaleShifts.empty() || !isInt8Convolution(child) || child->getParentEdges().size() != 1)
+            continue;
+
+        dynamic_cast<MKLDNNConvolutionNode *>(conv.get())->fuseRequantization(scales);
+        for (auto &scaleShift : scaleShifts)
+            DropNode(graph, scaleShift);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -181,6 +474,9 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     };
 
     auto isSutableParentConvolution = [&](MKLDNNNodePtr node) {
+        if (isInt8Convolution(node) || isInt8Convolution(node->getChildEdgeAt(0)->getChild()))
+            return false;
+
         auto* layer = dynamic_cast<ConvolutionLayer*>(node->getCnnLayer().get());
 
         bool isSupportedParams = layer->_group == 1 &&
@@ -199,6 +495,11 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
                                  layer->_padding_x == 1 && layer->_padding_y == 1 &&
                                  layer->_dilation_x == 1 && layer->_dilation_y == 1 &&
                                  layer->_biases != nullptr && layer->_biases->size() != 0;
+        // the post-op takes the weights of the layer, the folded ScaleShift would be lost
+        for (auto &fused : node->fusedWith) {
+            if (fused->getType() == Depthwise)
+                return false;
+        }
         return isSupportedParams;
     };
 
@@ -332,7 +633,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
         auto sum = graphNode;
         auto lastNode = sum;
 
-        bool fuse_allowed = mergedConv->getChildEdges().size() == 1;
+        bool fuse_allowed = mergedConv->getChildEdges().size() == 1 && !isInt8Convolution(mergedConv);
         for (size_t j = 0; fuse_allowed && j < mergedConv->getParentEdges().size(); j++)
             if (mergedConv->getParentEdgeAt(j)->getParent() == peerNode)
                 fuse_allowed = false;
@@ -390,6 +691,117 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
     }
 }
 
+void MKLDNNGraphOptimizer::FuseElementwiseChains(MKLDNNGraph &graph) {
+    std::vector<MKLDNNNodePtr> &graphNodes = graph.GetNodes();
+
+    auto isUnaryFusingSupported = [](const MKLDNNNodePtr &node) {
+        return (node->getType() == Power || node->getType() == Activation) &&
+               node->getParentEdges().size() == 1 && MKLDNNEltwiseNode::isUnaryFusingSupported(node);
+    };
+
+    auto isEltwiseFusingSupported = [](const MKLDNNNodePtr &host, const MKLDNNNodePtr &node) {
+        if (node->getType() != Eltwise || !node->getFusedWith().empty())
+            return false;
+        auto *eltwiseLayer = dynamic_cast<EltwiseLayer *>(node->getCnnLayer().get());
+        if (eltwiseLayer == nullptr || node->getParentEdges().size() != eltwiseLayer->insData.size() ||
+                (!eltwiseLayer->coeff.empty() && eltwiseLayer->coeff.size() != eltwiseLayer->insData.size()))
+            return false;
+
+        // the edges are matched by their nodes, so every parent is connected only once
+        auto dims = host->getChildEdgeAt(0)->getDims();
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            if (node->getParentEdgeAt(i)->getDims() != dims)
+                return false;
+            for (size_t j = 0; j < i; j++) {
+                if (node->getParentEdgeAt(j)->getParent() == parent)
+                    return false;
+            }
+        }
+        return true;
+    };
+
+    for (auto &graphNode : graphNodes) {
+        auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(graphNode);
+        if (!eltwise || eltwise->getType() != Eltwise || eltwise->isDropped())
+            continue;
+
+        // the Power and Activation layers before the inputs
+        for (size_t i = 0; i < eltwise->getParentEdges().size(); i++) {
+            auto parent = eltwise->getParentEdgeAt(i)->getParent();
+            while (parent->getChildEdges().size() == 1 && isUnaryFusingSupported(parent)) {
+                eltwise->fuseInputWith(i, parent);
+                DropNode(graph, parent);
+                parent = eltwise->getParentEdgeAt(i)->getParent();
+            }
+        }
+
+        // the Power, Activation and Eltwise layers after the output
+        while (eltwise->getChildEdges().size() == 1) {
+            auto child = eltwise->getChildEdgeAt(0)->getChild();
+            if (isUnaryFusingSupported(child)) {
+                eltwise->fuseWith(child);
+                DropNode(graph, child);
+                continue;
+            }
+            if (!isEltwiseFusingSupported(eltwise, child))
+                break;
+
+            size_t chainInput = eltwise->getChildEdgeAt(0)->getOutputNum();
+            eltwise->fuseEltwise(child, chainInput, eltwise->getParentEdges().size());
+
+            for (size_t i = 0; i < child->getParentEdges().size(); i++) {
+                if (i == chainInput)
+                    continue;
+                auto parentEdge = child->getParentEdgeAt(i);
+                MKLDNNEdgePtr edgePtr(new MKLDNNEdge(parentEdge->getParent(), eltwise));
+                graph.GetEdges().push_back(edgePtr);
+                eltwise->addEdge(edgePtr, eltwise->getParentEdges().size(), parentEdge->getInputNum());
+            }
+
+            for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+                auto childEdge = child->getChildEdgeAt(j);
+                auto grandChild = childEdge->getChild();
+                int idxParent = childEdge->getOutputNum();
+                int idxChild = childEdge->getInputNum();
+
+                MKLDNNEdgePtr newEdge(new MKLDNNEdge(eltwise, grandChild));
+                graph.GetEdges().push_back(newEdge);
+                grandChild->addEdge(newEdge, idxParent, idxChild);
+            }
+
+            child->remove();
+        }
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseTileAndEltwise(MKLDNNGraph &graph) {
+    std::vector<MKLDNNNodePtr> &graphNodes = graph.GetNodes();
+
+    for (auto &graphNode : graphNodes) {
+        if (graphNode->getType() != Tile || graphNode->isDropped() ||
+                graphNode->getParentEdges().size() != 1 || graphNode->getChildEdges().size() != 1)
+            continue;
+
+        auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(graphNode->getChildEdgeAt(0)->getChild());
+        if (!eltwise || eltwise->getType() != Eltwise || eltwise->getParentEdges().size() < 2)
+            continue;
+
+        // the batch is not tiled, so the dynamic batch changes only the number of the rows of the output
+        auto *tileLayer = dynamic_cast<TileLayer *>(graphNode->getCnnLayer().get());
+        auto dims = graphNode->getParentEdgeAt(0)->getDims();
+        if (tileLayer == nullptr || tileLayer->axis <= 0 || tileLayer->axis >= dims.ndims() || tileLayer->tiles <= 0 ||
+                (dims.ndims() != 2 && dims.ndims() != 4))
+            continue;
+
+        size_t input = graphNode->getChildEdgeAt(0)->getOutputNum();
+        if (eltwise->isBroadcastInput(input))
+            continue;
+
+        DropNode(graph, graphNode);
+        eltwise->broadcastInput(input, dims, tileLayer->axis, tileLayer->tiles);
+    }
+}
 
 void MKLDNNGraphOptimizer::RemoveIdentityOperator(MKLDNNGraph &graph) {
     for (MKLDNNNodePtr& node : graph.GetNodes()) {
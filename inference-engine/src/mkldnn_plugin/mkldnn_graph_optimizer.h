@@ -17,12 +17,24 @@ public:
 public:
     void Optimize(MKLDNNGraph& graph);
 
+    /**
+     * @brief Runs the rewrites of the layers (see GraphRewriter) on the copy of the network the graphs are created from
+     * @return The number of the rewrites
+     */
+    static size_t RewriteNetwork(InferenceEngine::details::CNNNetworkImpl& network);
+
 private:
     void MergeGroupConvolution(MKLDNNGraph& graph);
+    void FuseScaleShiftAndConvolution(MKLDNNGraph &graph);
+    void FuseConvolutionAndScaleShift(MKLDNNGraph &graph);
+    void FuseFullyConnectedAndScaleShift(MKLDNNGraph &graph);
     void FuseConvolutionAndActivation(MKLDNNGraph &graph);
+    void FuseFullyConnectedAndActivation(MKLDNNGraph &graph);
+    void FuseConvolutionAndRequantization(MKLDNNGraph &graph);
     void FuseConvolutionAndDWConvolution(MKLDNNGraph &graph);
-    void FuseBatchNormWithScale(MKLDNNGraph& graph);
     void FuseConvolutionSumAndConvolutionSumActivation(MKLDNNGraph &graph);
+    void FuseElementwiseChains(MKLDNNGraph &graph);
+    void FuseTileAndEltwise(MKLDNNGraph &graph);
     void RemoveIdentityOperator(MKLDNNGraph& graph);
     void RemoveDropped(MKLDNNGraph& graph);
     void RemoveDroppedEdges(MKLDNNGraph& graph);
@@ -0,0 +1,124 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_huge_pages.h"
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+constexpr size_t MKLDNNHugePages::size2MB;
+constexpr size_t MKLDNNHugePages::size1GB;
+
+#if defined(__linux__)
+
+namespace {
+
+constexpr size_t alignment = 64;
+
+size_t roundUp(size_t size, size_t multiple) {
+    return (size + multiple - 1) / multiple * multiple;
+}
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+std::shared_ptr<void> makeMapping(void *data, size_t size) {
+    return std::shared_ptr<void>(data, [size](void *ptr) { munmap(ptr, size); });
+}
+
+// the mapping of the explicit huge pages fails if the pool of the pages of the size is exhausted or not configured
+std::shared_ptr<void> mapExplicitPages(size_t size, size_t pageSize) {
+#if defined(MAP_HUGETLB)
+    int log2PageSize = 0;
+    while ((static_cast<size_t>(1) << log2PageSize) < pageSize)
+        log2PageSize++;
+    void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (log2PageSize << MAP_HUGE_SHIFT), -1, 0);
+    if (data != MAP_FAILED)
+        return makeMapping(data, size);
+#endif
+    return nullptr;
+}
+
+// the mapping is aligned to 2MB, so the kernel may back it by the transparent huge pages at the first touch
+std::shared_ptr<void> mapTransparentPages(size_t size) {
+    const size_t mappedSize = size + MKLDNNHugePages::size2MB;
+    void *data = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    auto *begin = static_cast<uint8_t *>(data);
+    auto *aligned = reinterpret_cast<uint8_t *>(roundUp(reinterpret_cast<uintptr_t>(begin), MKLDNNHugePages::size2MB));
+    if (aligned != begin)
+        munmap(begin, aligned - begin);
+    uint8_t *end = begin + mappedSize;
+    if (aligned + size != end)
+        munmap(aligned + size, end - (aligned + size));
+
+#if defined(MADV_HUGEPAGE)
+    madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+    return makeMapping(aligned, size);
+}
+
+std::shared_ptr<void> mapPages(size_t size, size_t pageSize) {
+    std::shared_ptr<void> data = mapExplicitPages(roundUp(size, pageSize), pageSize);
+    if (!data && pageSize != MKLDNNHugePages::size2MB)
+        data = mapExplicitPages(roundUp(size, MKLDNNHugePages::size2MB), MKLDNNHugePages::size2MB);
+    if (!data)
+        data = mapTransparentPages(roundUp(size, MKLDNNHugePages::size2MB));
+    return data;
+}
+
+// the chunk of one page for the small allocations, the chunk is referenced only by the allocations from it
+struct Chunk {
+    std::weak_ptr<void> data;
+    size_t capacity = 0;
+    size_t used = 0;
+};
+
+}  // namespace
+
+#endif
+
+std::shared_ptr<void> MKLDNNHugePages::allocate(size_t size, size_t pageSize) {
+#if defined(__linux__)
+    if (pageSize != size2MB && pageSize != size1GB)
+        return nullptr;
+    size = roundUp(size == 0 ? 1 : size, alignment);
+    if (size >= pageSize)
+        return mapPages(size, pageSize);
+
+    static std::mutex guard;
+    static std::map<size_t, Chunk> chunks;
+
+    std::lock_guard<std::mutex> lock(guard);
+    Chunk &chunk = chunks[pageSize];
+    std::shared_ptr<void> chunkData = chunk.data.lock();
+    if (!chunkData || chunk.used + size > chunk.capacity) {
+        chunkData = mapPages(pageSize, pageSize);
+        if (!chunkData)
+            return nullptr;
+        chunk.data = chunkData;
+        chunk.capacity = pageSize;
+        chunk.used = 0;
+    }
+    // the allocation keeps the chunk alive
+    void *data = static_cast<uint8_t *>(chunkData.get()) + chunk.used;
+    chunk.used += size;
+    return std::shared_ptr<void>(chunkData, data);
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,36 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The allocator of the long-living memory of the graphs (weights and workspaces) on the huge pages, so
+ * streaming over the big weights doesn't miss the TLB on every 4KB page (see Config::hugePageSize).
+ * The explicit huge pages of the requested size (hugetlbfs pool) are tried first, then the explicit 2MB pages
+ * and then the transparent huge pages advised for the aligned anonymous mapping. The allocations smaller than
+ * the page share the chunk of one page, the chunk is unmapped with the last allocation which uses it.
+ * The huge pages are supported on Linux only.
+ */
+class MKLDNNHugePages {
+public:
+    static constexpr size_t size2MB = 2 * 1024 * 1024;
+    static constexpr size_t size1GB = 1024 * 1024 * 1024;
+
+    /**
+     * @brief Allocates the zeroed memory of size bytes aligned to 64 bytes
+     * @param size - the size in bytes
+     * @param pageSize - the size of the huge pages: size2MB or size1GB
+     * @return the memory, it is unmapped when the last copy of the pointer is released; null if the huge pages
+     * are not available, the caller falls back to the regular memory then
+     */
+    static std::shared_ptr<void> allocate(size_t size, size_t pageSize);
+};
+
+}  // namespace MKLDNNPlugin
@@ -5,10 +5,13 @@
 
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_streams.h"
 #include <vector>
 #include <string>
 #include <map>
+#include <algorithm>
 #include <blob_factory.hpp>
+#include <blob_transform.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 
@@ -17,7 +20,8 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         : InferRequestInternal(networkInputs, networkOutputs), m_curBatch(-1) {}
 
 
-template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob) {
+template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const GraphBinding& input,
+                                                                       InferenceEngine::Blob::Ptr& inputBlob) {
     InferenceEngine::TBlob<T> *in_f = dynamic_cast<InferenceEngine::TBlob<T> *>(inputBlob.get());
 
     if (in_f == nullptr) {
@@ -28,91 +32,128 @@ template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std
         THROW_IE_EXCEPTION << "Input data was not allocated.";
     }
 
-    graph->PushInputData(inputName, inputBlob);
+    graph->PushInputData(input.node, input.meanImage, inputBlob);
+}
+
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::allocateBlob(const InferenceEngine::TensorDesc &desc) const {
+    InferenceEngine::Blob::Ptr blob = blobAllocator ? make_blob_with_precision(desc, blobAllocator)
+                                                    : make_blob_with_precision(desc);
+    blob->allocate();
+    return blob;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetBlobAllocator(const std::shared_ptr<InferenceEngine::IAllocator> &allocator) {
+    blobAllocator = allocator;
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     IE_PROFILING_AUTO_SCOPE(MKLDNN_INFER)
+    // in the throughput mode the request is executed by the graph of the current stream
+    auto streamGraph = MultiWorkerTaskExecutor::ptrContext.ptrGraph;
+    if (streamGraph) {
+        graph = streamGraph;
+    } else if (streamsExecutor) {
+        // out of the workers the graph of any stream may be in use, so the inference is run by a worker
+        auto task = std::make_shared<InferenceEngine::Task>([this]() {
+            InferImpl();
+        });
+        if (!streamsExecutor->startTask(task))
+            THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+        task->checkException();
+        return;
+    }
+    // with the exclusive async requests the graph of the stream is taken from the pool till the end of the inference
+    std::unique_ptr<GraphPool::Lease> lease;
+    if (graphPool) {
+        lease.reset(new GraphPool::Lease(*graphPool));
+        graph = lease->graph();
+    }
+
     if (!graph || !graph->IsReady()) {
         THROW_IE_EXCEPTION << "Network not loaded.";
     }
+    const std::vector<GraphBinding> &graphBindings = getGraphBindings();
 
     // execute input pre-processing.
     execDataPreprocessing();
 
-    changeDefaultPtr();
+    changeDefaultPtr(graphBindings);
     // need to retain converted blobs until infer finish
     std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
-    for (auto input : _inputs) {
-        if (!_networkInputs[input.first]) {
-            THROW_IE_EXCEPTION <<
-                               "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
-                               << input.first;
+    for (size_t i = 0; i < bindings.size(); i++) {
+        if (!bindings[i].inputInfo || !bindings[i].blob)
+            continue;
+        const GraphBinding &graphInput = graphBindings[i];
+        if (!graphInput.node) {
+            THROW_IE_EXCEPTION << "Input blob for infer '" << bindings[i].name << "' doesn't correspond to input in network";
         }
-        /*if (_networkInputs[input.first]->getInputPrecision() != input.second->precision()) {
-            THROW_IE_EXCEPTION << "Different input precision for input " << input.first
-                               << " registered in IInferencePlugin::LoadNetwork network and IInferencePlugin::Infer. "
-                               << _networkInputs[input.first]->getInputPrecision() << " vs "
-                               << input.second->precision();
-        }*/
-
-
+        InferenceEngine::Blob::Ptr fused = bindings[i].preProcess ? bindings[i].preProcess->getFusedBlob() : nullptr;
+        if (fused) {
+            // the fused pre-processing has already converted the input to FP32 and subtracted the mean
+            GraphBinding fusedInput = graphInput;
+            fusedInput.meanImage = nullptr;
+            pushInput<float>(fusedInput, fused);
+            continue;
+        }
+        InferenceEngine::Blob::Ptr &input = *bindings[i].blob;
 
         InferenceEngine::Blob::Ptr iconv;
-        InferenceEngine::TBlob<float> *in_f = nullptr;
-        switch (input.second->precision()) {
+        switch (input->precision()) {
             case InferenceEngine::Precision::FP32:
-                pushInput<float>(input.first, input.second);
+                pushInput<float>(graphInput, input);
                 break;
             case InferenceEngine::Precision::U16:
+                if (graph->canConvertInput(graphInput.node, graphInput.meanImage, input)) {
+                    // The graph converts the blob to FP32 right into its memory
+                    pushInput<uint16_t>(graphInput, input);
+                    break;
+                }
                 // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                        InferenceEngine::Precision::FP32,
-                        input.second->getTensorDesc().getLayout(), input.second->dims());
+                iconv = allocateBlob({InferenceEngine::Precision::FP32, input->getTensorDesc().getDims(),
+                                      input->getTensorDesc().getLayout()});
                 convertedInputs.push_back(iconv);
-                iconv->allocate();
-                in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                pushInput<float>(input.first, iconv);
+                InferenceEngine::blob_copy(input, iconv);
+                pushInput<float>(graphInput, iconv);
                 break;
             case InferenceEngine::Precision::I16:
-                if (graph->hasMeanImageFor(input.first)) {
+                if (graphInput.meanImage && !graph->canConvertInput(graphInput.node, graphInput.meanImage, input)) {
                     // If a mean image exists, we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
+                    iconv = allocateBlob({InferenceEngine::Precision::FP32, input->getTensorDesc().getDims(),
+                                          input->getTensorDesc().getLayout()});
                     convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
+                    InferenceEngine::blob_copy(input, iconv);
+                    pushInput<float>(graphInput, iconv);
                 } else {
-                    // Instead we can send I16 directly
-                    pushInput<int16_t>(input.first, input.second);
+                    // Instead we can send I16 directly, the graph converts it and subtracts the mean if needed
+                    pushInput<int16_t>(graphInput, input);
                 }
                 break;
             case InferenceEngine::Precision::U8:
-                if (graph->hasMeanImageFor(input.first)) {
+                if (graphInput.meanImage && !graph->canConvertInput(graphInput.node, graphInput.meanImage, input)) {
                     // If a mean image exists, we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
+                    iconv = allocateBlob({InferenceEngine::Precision::FP32, input->getTensorDesc().getDims(),
+                                          input->getTensorDesc().getLayout()});
                     convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
+                    InferenceEngine::blob_copy(input, iconv);
+                    pushInput<float>(graphInput, iconv);
                 } else {
-                    // Instead we can send I8 directly
-                    pushInput<uint8_t>(input.first, input.second);
+                    // Instead we can send U8 directly, the graph converts it and subtracts the mean if needed
+                    pushInput<uint8_t>(graphInput, input);
                 }
                 break;
             default:
-                THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->precision();
+                THROW_IE_EXCEPTION << "Unsupported input precision " << input->precision();
         }
     }
-    graph->Infer(m_curBatch);
-    graph->PullOutputData(_outputs);
+    _timings.mark(&InferenceEngine::InferRequestTimings::preprocessed_uSec);
+    graph->Infer(m_curBatch, getSkippedNodes(graphBindings), &_cancellation);
+    _timings.mark(&InferenceEngine::InferRequestTimings::executed_uSec);
+    for (size_t i = 0; i < bindings.size(); i++) {
+        if (bindings[i].outputData && bindings[i].blob && graphBindings[i].node && !bindings[i].skipped)
+            graph->PullOutputData(graphBindings[i].node, *bindings[i].blob);
+    }
+    _timings.mark(&InferenceEngine::InferRequestTimings::outputsCopied_uSec);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
@@ -122,89 +163,95 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
     graph->GetPerfData(perfMap);
 }
 
+size_t MKLDNNPlugin::MKLDNNInferRequest::getBindingIndex(const char *name) const {
+    auto index = bindingIndices.find(name);
+    if (index == bindingIndices.end())
+        THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input or output with name: \'" << name << "\'";
+    return index->second;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine::Blob::Ptr &data) {
     if (!graph || !graph->IsReady())
         THROW_IE_EXCEPTION << "Graph is not ready!";
+    if (name == nullptr)
+        THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to get blob with empty name";
 
-    InferenceEngine::BlobMap blobs;
-    graph->getInputBlobs(blobs);
+    GetBlobByIndex(getBindingIndex(name), data);
+}
 
-    if (blobs.find(name) != blobs.end()) {
-        // ROI blob is returned only if it was set previously.
-        auto it = _preProcData.find(name);
-        if (it != _preProcData.end()) {
-            data = it->second.getRoiBlob();
-            return;
-        }
+void MKLDNNPlugin::MKLDNNInferRequest::GetBlobByIndex(size_t index, InferenceEngine::Blob::Ptr &data) {
+    if (!graph || !graph->IsReady())
+        THROW_IE_EXCEPTION << "Graph is not ready!";
+    if (index >= bindings.size())
+        THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input or output with index: " << index;
+
+    BlobBinding &binding = bindings[index];
+    const GraphBinding &graphBinding = getGraphBindings()[index];
+    if (!graphBinding.node)
+        THROW_IE_EXCEPTION << "Cannot find blob with name: " << binding.name;
 
-        if (_inputs.find(name) != _inputs.end()) {
-            data = _inputs[name];
-            checkBlob(data, name, true);
+    if (binding.inputInfo) {
+        // ROI blob is returned only if it was set previously.
+        if (binding.preProcess) {
+            data = binding.preProcess->getRoiBlob();
             return;
         }
 
-        InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
-        InferenceEngine::Precision originPrecision = blobs[name]->getTensorDesc().getPrecision();
-        if (_networkInputs.find(name) != _networkInputs.end()) {
-            desc = _networkInputs[name]->getTensorDesc();
-            desc.setPrecision(_networkInputs[name]->getInputPrecision());
-        }
+        if (!binding.blob) {
+            InferenceEngine::TensorDesc desc = binding.inputInfo->getTensorDesc();
+            desc.setPrecision(binding.inputInfo->getInputPrecision());
 
-        _inputs[name] = make_blob_with_precision(desc);
-        _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
-            externalPtr[name] = _inputs[name]->buffer();
+            binding.blob = &_inputs[binding.name];
+            *binding.blob = allocateBlob(desc);
+            if (isZeroCopyBlob(index, *binding.blob))
+                binding.externalPtr = (*binding.blob)->buffer();
         }
-        data = _inputs[name];
-        checkBlob(data, name, true);
+        data = *binding.blob;
+        checkBlob(data, binding.name, true);
         return;
     }
-    blobs.clear();
-    graph->getOutputBlobs(blobs);
-
-    if (blobs.find(name) != blobs.end()) {
-        if (_outputs.find(name) != _outputs.end()) {
-            data = _outputs[name];
-            checkBlob(data, name, false);
-            return;
-        }
 
-        _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
-        _outputs[name]->allocate();
-        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
-            externalPtr[name] = _outputs[name]->buffer();
-        }
-        data = _outputs[name];
-        checkBlob(data, name, false);
-        return;
+    if (!binding.blob) {
+        binding.blob = &_outputs[binding.name];
+        *binding.blob = allocateBlob(graphBinding.node->getParentEdgeAt(0)->getBlob()->getTensorDesc());
+        if (isZeroCopyBlob(index, *binding.blob))
+            binding.externalPtr = (*binding.blob)->buffer();
     }
-    THROW_IE_EXCEPTION << "Cannot find blob with name: " << name;
+    data = *binding.blob;
+    checkBlob(data, binding.name, false);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) {
-    if (!data)
-        THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty blob with name: \'" << name << "\'";
-    if (data->buffer() == nullptr)
-        THROW_IE_EXCEPTION << "Input data was not allocated. Input name: \'" << name << "\'";
     if (name == nullptr) {
         THROW_IE_EXCEPTION << NOT_FOUND_str + "Failed to set blob with empty name";
     }
-    InferenceEngine::InputInfo::Ptr foundInput;
-    InferenceEngine::DataPtr foundOutput;
+    SetBlobByIndex(getBindingIndex(name), data);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetBlobByIndex(size_t index, const InferenceEngine::Blob::Ptr &data) {
+    if (index >= bindings.size())
+        THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input or output with index: " << index;
+    BlobBinding &binding = bindings[index];
+
+    if (!data)
+        THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty blob with name: \'" << binding.name << "\'";
+    if (data->buffer() == nullptr)
+        THROW_IE_EXCEPTION << "Input data was not allocated. Input name: \'" << binding.name << "\'";
     size_t dataSize = data->size();
-    if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
-        // Only precision is checked for an input with ROI inside (resize algorithm was set for the input).
-        if (foundInput->getPreProcess().getResizeAlgorithm() != InferenceEngine::ResizeAlgorithm::NO_RESIZE) {
-            if (foundInput->getInputPrecision() != data->precision()) {
+    if (binding.inputInfo) {
+        // Only precision is checked for an input with ROI inside (resize algorithm or color format was set).
+        const InferenceEngine::PreProcessInfo &preProcessInfo = binding.inputInfo->getPreProcess();
+        if (preProcessInfo.getResizeAlgorithm() != InferenceEngine::ResizeAlgorithm::NO_RESIZE ||
+                preProcessInfo.getColorFormat() != InferenceEngine::ColorFormat::RAW) {
+            if (binding.inputInfo->getInputPrecision() != data->precision()) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set Blob with precision "
                                    << data->precision();
             }
             // Stores the given blob as ROI blob. It will be used to fill in a network input during pre-processing.
-            _preProcData[name].setRoiBlob(data);
+            binding.preProcess = &_preProcData[binding.name];
+            binding.preProcess->setRoiBlob(data);
         } else {
-            size_t inputSize = InferenceEngine::details::product(foundInput->getDims());
+            size_t inputSize = InferenceEngine::details::product(binding.inputInfo->getDims());
             if (dataSize != inputSize) {
                 THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
                                    << dataSize << "!=" << inputSize << ").";
@@ -224,123 +271,268 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
                                        << data->precision();
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
-                externalPtr[name] = data->buffer();
-            } else if (externalPtr.find(name) != externalPtr.end()) {
-                externalPtr.erase(name);
-            }
-            _inputs[name] = data;
+            binding.externalPtr = isZeroCopyBlob(index, data) ? MKLDNNExtensionUtils::getBlobData(data) : nullptr;
+            if (!binding.blob)
+                binding.blob = &_inputs[binding.name];
+            *binding.blob = data;
         }
     } else {
-        size_t outputSize = InferenceEngine::details::product(foundOutput->getDims());
+        size_t outputSize = InferenceEngine::details::product(binding.outputData->getDims());
         if (dataSize != outputSize) {
             THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
                                << dataSize << "!=" << outputSize << ").";
         }
-        if (foundOutput->getPrecision() != data->precision()) {
+        if (binding.outputData->getPrecision() != data->precision()) {
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                << "Failed to set Blob with precision not corresponding to user output precision";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
-            externalPtr[name] = data->buffer();
-        } else if (externalPtr.find(name) != externalPtr.end()) {
-            externalPtr.erase(name);
-        }
-        _outputs[name] = data;
+        binding.externalPtr = isZeroCopyBlob(index, data) ? MKLDNNExtensionUtils::getBlobData(data) : nullptr;
+        if (!binding.blob)
+            binding.blob = &_outputs[binding.name];
+        *binding.blob = data;
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetSkippedOutputs(const std::vector<std::string> &names) {
+    for (const auto &name : names) {
+        auto index = bindingIndices.find(name);
+        if (index == bindingIndices.end() || !bindings[index->second].outputData)
+            THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find output with name: \'" << name << "\'";
+    }
+
+    hasSkippedOutputs = !names.empty();
+    for (auto &binding : bindings) {
+        binding.skipped = binding.outputData && std::find(names.begin(), names.end(), binding.name) != names.end();
     }
+    graphsSkippedNodes.clear();
+}
+
+const std::vector<bool> *MKLDNNPlugin::MKLDNNInferRequest::getSkippedNodes(const std::vector<GraphBinding> &graphBindings) {
+    if (!hasSkippedOutputs)
+        return nullptr;
+
+    auto found = graphsSkippedNodes.find(graph);
+    if (found != graphsSkippedNodes.end())
+        return found->second;
+
+    // the nodes of the set of the outputs are found once for all the requests of the graph
+    std::vector<bool> skippedOutputs(graph->outputNodes.size(), false);
+    for (size_t i = 0; i < bindings.size(); i++) {
+        if (!bindings[i].skipped || !graphBindings[i].node)
+            continue;
+        auto output = std::find(graph->outputNodes.begin(), graph->outputNodes.end(), graphBindings[i].node);
+        if (output != graph->outputNodes.end())
+            skippedOutputs[output - graph->outputNodes.begin()] = true;
+    }
+    return graphsSkippedNodes[graph] = &graph->GetCachedSkippedNodes(skippedOutputs);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetRoiBlobs(const char *name, const std::vector<InferenceEngine::Blob::Ptr> &rois) {
+    if (name == nullptr)
+        THROW_IE_EXCEPTION << NOT_FOUND_str + "Failed to set blobs with empty name";
+    BlobBinding &binding = bindings[getBindingIndex(name)];
+    if (!binding.inputInfo)
+        THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input with name: \'" << name << "\'";
+
+    const InferenceEngine::PreProcessInfo &preProcessInfo = binding.inputInfo->getPreProcess();
+    if (preProcessInfo.getResizeAlgorithm() == InferenceEngine::ResizeAlgorithm::NO_RESIZE &&
+            preProcessInfo.getColorFormat() == InferenceEngine::ColorFormat::RAW)
+        THROW_IE_EXCEPTION << "Neither resize algorithm nor color format is set for the input \'" << name << "\'";
+
+    size_t batch = binding.inputInfo->getTensorDesc().getDims()[0];
+    if (rois.empty() || rois.size() > batch)
+        THROW_IE_EXCEPTION << "The number of ROIs " << rois.size() << " does not fit the batch " << batch
+                           << " of the input \'" << name << "\'";
+    for (const auto &roi : rois) {
+        if (!roi || roi->buffer() == nullptr)
+            THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty ROI blob for the input \'" << name << "\'";
+        if (roi->precision() != binding.inputInfo->getInputPrecision())
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set ROI blob with precision " << roi->precision();
+        if (roi->getTensorDesc().getDims().size() != 4 || roi->getTensorDesc().getDims()[0] != 1)
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Every ROI blob should be 4D with the batch 1";
+    }
+
+    binding.preProcess = &_preProcData[binding.name];
+    binding.preProcess->setRoiBlobs(rois);
 }
 
 static inline void changeEdgePtr(MKLDNNPlugin::MKLDNNEdgePtr edge, void *newPtr) {
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
-    for (auto& it : externalPtr) {
-        auto input = graph->inputNodes.find(it.first);
-        if (input != graph->inputNodes.end()) {
-            if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
-                }
-            }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
-            }
-            continue;
+static inline void *getEdgePtr(MKLDNNPlugin::MKLDNNEdgePtr edge) {
+    return edge->getMemory().GetPrimitive().get_data_handle();
+}
+
+// the edges may be bound to the memory of other requests, so the default pointer of the graph is the reference
+static bool canChangeInputPtr(const MKLDNNPlugin::MKLDNNNodePtr &input, void *defaultPtr) {
+    // Input cannot be in-place with other primitives
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto& child = input->getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            return false;
+        auto* concat = dynamic_cast<MKLDNNPlugin::MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        auto* split = dynamic_cast<MKLDNNPlugin::MKLDNNSplitNode *>(child.get());
+        if (split)
+            return false;
+
+        if (child->isInplace())
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (getEdgePtr(child->getChildEdgeAt(j)) == defaultPtr)
+                return false;
         }
+    }
+    return true;
+}
 
-        MKLDNNNodePtr output;
-        for (auto& out : graph->outputNodes) {
-            if (out->getName() == "out_" + it.first) {
-                output = out;
+static bool canChangeOutputPtr(const MKLDNNPlugin::MKLDNNNodePtr &output, void *defaultPtr) {
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = output->getParentEdgeAt(0)->getParent();
+    MKLDNNPlugin::MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace())
+            return false;
+
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (getEdgePtr(parent->getParentEdgeAt(i)) == defaultPtr) {
+                parent = parent->getParentEdgeAt(i)->getParent();
                 break;
             }
         }
-        if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
+    } while (previousParent != parent);
+    return true;
+}
+
+const std::vector<MKLDNNPlugin::MKLDNNInferRequest::GraphBinding> &MKLDNNPlugin::MKLDNNInferRequest::getGraphBindings() {
+    auto found = graphsBindings.find(graph);
+    if (found != graphsBindings.end())
+        return found->second;
+
+    std::vector<GraphBinding> &graphBindings = graphsBindings[graph];
+    for (auto &binding : bindings) {
+        GraphBinding graphBinding = {nullptr, nullptr, nullptr, false};
+        if (binding.inputInfo) {
+            auto input = graph->inputNodes.find(binding.name);
+            if (input != graph->inputNodes.end()) {
+                auto mean = graph->_meanImages.find(binding.name);
+                graphBinding.node = input->second;
+                graphBinding.meanImage = mean != graph->_meanImages.end() ? &mean->second : nullptr;
+                graphBinding.defaultPtr = graph->defaultInputPtrs[binding.name];
+                graphBinding.canChangePtr = canChangeInputPtr(input->second, graphBinding.defaultPtr);
+            }
+        } else {
+            for (auto& out : graph->outputNodes) {
+                if (out->getName() == "out_" + binding.name) {
+                    graphBinding.node = out;
+                    graphBinding.defaultPtr = graph->defaultOutputPtrs[binding.name];
+                    graphBinding.canChangePtr = canChangeOutputPtr(out, graphBinding.defaultPtr);
                     break;
                 }
+            }
+        }
+        graphBindings.push_back(graphBinding);
+    }
+    return graphBindings;
+}
 
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
+bool MKLDNNPlugin::MKLDNNInferRequest::IsZeroCopyBlob(const char *name, const InferenceEngine::Blob::Ptr &data) {
+    auto index = bindingIndices.find(name);
+    return index != bindingIndices.end() && isZeroCopyBlob(index->second, data);
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::isZeroCopyBlob(size_t index, const InferenceEngine::Blob::Ptr &data) {
+    if (!graph || !graph->IsReady() || !data || data->buffer() == nullptr)
+        return false;
+    // Only the part of the blob is processed, the rest of the graph memory may be not initialized
+    if (graph->getProperty().batchLimit)
+        return false;
+
+    const GraphBinding &graphBinding = getGraphBindings()[index];
+    if (!graphBinding.node || !graphBinding.canChangePtr)
+        return false;
+
+    MKLDNNEdgePtr edge;
+    if (bindings[index].inputInfo) {
+        // The data are modified or resized on the way to the graph
+        if (graphBinding.meanImage || bindings[index].preProcess)
+            return false;
+        edge = graphBinding.node->getChildEdgeAt(0);
+    } else {
+        edge = graphBinding.node->getParentEdgeAt(0);
+    }
+
+    // The user memory replaces the edge memory, so the data should be laid out exactly as the primitives expect.
+    // The crops are strided, while the slices of a batch are dense from the offset of their descriptors.
+    if (!InferenceEngine::blob_is_dense(data))
+        return false;
+    const InferenceEngine::TensorDesc userDesc = MKLDNNExtensionUtils::getDenseTensorDesc(data->getTensorDesc());
+    if (userDesc.getLayout() == InferenceEngine::Layout::ANY ||
+            !MKLDNNExtensionUtils::initTensorsAreEqual(userDesc, edge->getDesc()))
+        return false;
+
+    auto address = reinterpret_cast<uintptr_t>(MKLDNNExtensionUtils::getBlobData(data));
+    return address % userDesc.getPrecision().size() == 0;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr(const std::vector<GraphBinding> &graphBindings) {
+    // The graph may be shared with other requests, so every edge is bound either to the user memory
+    // of this request or back to the memory of the graph
+    for (size_t i = 0; i < bindings.size(); i++) {
+        const GraphBinding &graphBinding = graphBindings[i];
+        if (!graphBinding.node)
             continue;
+        void *ptr = bindings[i].externalPtr && graphBinding.canChangePtr ? bindings[i].externalPtr
+                                                                         : graphBinding.defaultPtr;
+
+        if (bindings[i].inputInfo) {
+            for (size_t j = 0; j < graphBinding.node->getChildEdges().size(); j++) {
+                if (getEdgePtr(graphBinding.node->getChildEdgeAt(j)) != ptr)
+                    changeEdgePtr(graphBinding.node->getChildEdgeAt(j), ptr);
+            }
+        } else {
+            if (getEdgePtr(graphBinding.node->getParentEdgeAt(0)) != ptr)
+                changeEdgePtr(graphBinding.node->getParentEdgeAt(0), ptr);
         }
-        THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::SetGraphPool(const MKLDNNPlugin::GraphPool::Ptr &pool) {
+    graphPool = pool;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetStreamsExecutor(const InferenceEngine::ITaskExecutor::Ptr &executor) {
+    streamsExecutor = executor;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph::Ptr &graph) {
     this->graph = graph;
 
-    InferenceEngine::BlobMap blobs;
-    this->graph->getInputBlobs(blobs);
-    for (const auto& it : blobs) {
-        InferenceEngine::Blob::Ptr blob;
-        GetBlob(it.first.c_str(), blob);
+    // the bindings are prepared once, so the inference and the access by index look up nothing by name
+    bindings.clear();
+    bindingIndices.clear();
+    graphsBindings.clear();
+    graphsSkippedNodes.clear();
+    hasSkippedOutputs = false;
+    for (const auto& input : _networkInputs) {
+        bindingIndices[input.first] = bindings.size();
+        bindings.push_back({input.first, input.second, nullptr, nullptr, nullptr, nullptr, false});
+    }
+    for (const auto& output : _networkOutputs) {
+        bindingIndices[output.first] = bindings.size();
+        bindings.push_back({output.first, nullptr, output.second, nullptr, nullptr, nullptr, false});
     }
-    blobs.clear();
-    this->graph->getOutputBlobs(blobs);
-    for (const auto& it : blobs) {
+
+    const std::vector<GraphBinding> &graphBindings = getGraphBindings();
+    for (size_t i = 0; i < bindings.size(); i++) {
+        if (!graphBindings[i].node)
+            continue;
         InferenceEngine::Blob::Ptr blob;
-        GetBlob(it.first.c_str(), blob);
+        GetBlobByIndex(i, blob);
     }
 }
 
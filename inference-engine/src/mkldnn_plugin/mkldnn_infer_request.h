@@ -6,9 +6,11 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_streams.h"
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <mkldnn_preprocess_data.hpp>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
@@ -38,31 +40,124 @@ public:
      */
     void GetBlob(const char *name, InferenceEngine::Blob::Ptr &data) override;
 
+    /**
+     * @brief Sets the blob by its index, without looking up the name (see IInferRequest::SetBlobByIndex)
+     * @param index - the index of input or output blob.
+     * @param data - a reference to input or output blob.
+     */
+    void SetBlobByIndex(size_t index, const InferenceEngine::Blob::Ptr &data) override;
+
+    /**
+     * @brief Gets the blob by its index, without looking up the name (see IInferRequest::GetBlobByIndex)
+     * @param index - the index of input or output blob.
+     * @param data - a reference to input or output blob.
+     */
+    void GetBlobByIndex(size_t index, InferenceEngine::Blob::Ptr &data) override;
+
+    /**
+     * @brief Sets the ROI blobs to be resized into the batch slots of the input (see IInferRequest::SetRoiBlobs)
+     * @param name - a name of the input.
+     * @param rois - the ROI blobs with the batch 1.
+     */
+    void SetRoiBlobs(const char *name, const std::vector<InferenceEngine::Blob::Ptr> &rois) override;
+
+    /**
+     * @brief Sets the outputs not needed by the following inferences (see IInferRequest::SetSkippedOutputs),
+     * the nodes computing only them are not executed and their blobs are not updated
+     * @param names - the names of the skipped outputs.
+     */
+    void SetSkippedOutputs(const std::vector<std::string> &names) override;
+
+    /**
+     * @brief Checks whether the blob set for the input or output will be used by the graph directly, without copying
+     * and conversion. It is true if precision and layout of the blob are the ones of the graph memory, the address
+     * is aligned to the element size and the node connected to the input/output may work on the external memory.
+     * @param name - a name of input or output blob.
+     * @param data - a blob to check.
+     * @return true if SetBlob() with these arguments gives the zero-copy binding
+     */
+    bool IsZeroCopyBlob(const char *name, const InferenceEngine::Blob::Ptr &data) override;
+
     void SetGraph(const MKLDNNGraph::Ptr& graph);
 
+    /**
+     * @brief Sets the graphs of the streams inferred on the executor shared with the other networks, the request
+     * is inferred by a free graph of the pool instead of the one of SetGraph(), null (default) disables the pool
+     */
+    void SetGraphPool(const GraphPool::Ptr& pool);
+
+    /**
+     * @brief Sets the executor of the streams owning their graphs, the inference called out of its workers
+     * is run by a worker and waited for, so it never shares the graph with the stream of the worker.
+     * Null (default) for the network with a single graph.
+     */
+    void SetStreamsExecutor(const InferenceEngine::ITaskExecutor::Ptr& executor);
+
+    /**
+     * @brief Sets the allocator of the input and output blobs created by the request and of the blobs converted
+     * for the inference, null for the system allocator
+     */
+    void SetBlobAllocator(const std::shared_ptr<InferenceEngine::IAllocator> &allocator);
+
     void SetBatch(int batch = -1) override;
 
     void execDataPreprocessing() {
-        for (auto &input : _inputs) {
+        for (auto &binding : bindings) {
             // If there is a pre-process entry for an input then it must be pre-processed
-            // using preconfigured resize algorithm.
-            auto it = _preProcData.find(input.first);
-            if (it != _preProcData.end()) {
-                _preProcData[input.first].execute(input.second,
-                                                  _networkInputs[input.first]->getPreProcess().getResizeAlgorithm());
+            // using preconfigured resize algorithm and color format.
+            if (binding.preProcess && binding.blob) {
+                binding.preProcess->execute(*binding.blob, binding.inputInfo->getPreProcess());
             }
         }
     }
 
 private:
-    template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
+    /**
+     * @brief The input or output of the request, the inputs go first in the order of the names and the outputs
+     * follow them in the order of the names (so the index is the one of GetBlobByIndex/SetBlobByIndex)
+     */
+    struct BlobBinding {
+        std::string name;
+        InferenceEngine::InputInfo::Ptr inputInfo;  // null for an output
+        InferenceEngine::DataPtr outputData;        // null for an input
+        InferenceEngine::Blob::Ptr *blob;           // the entry of _inputs or _outputs
+        MKLDNNPreProcessData *preProcess;           // the entry of _preProcData if the ROI blob is set
+        void *externalPtr;                          // the user memory bound to the edge without copying
+        bool skipped;                               // the output is not computed, see SetSkippedOutputs()
+    };
+
+    /**
+     * @brief The input or output node of the graph for the binding with the same index. The request is executed
+     * by the graphs of all the streams, so these data are prepared for each graph on its first inference.
+     */
+    struct GraphBinding {
+        MKLDNNNodePtr node;
+        MeanImage *meanImage;
+        void *defaultPtr;
+        bool canChangePtr;
+    };
+
+    template <typename T> void pushInput(const GraphBinding& input, InferenceEngine::Blob::Ptr& inputBlob);
+    InferenceEngine::Blob::Ptr allocateBlob(const InferenceEngine::TensorDesc &desc) const;
 
-    void changeDefaultPtr();
+    const std::vector<GraphBinding> &getGraphBindings();
+    size_t getBindingIndex(const char *name) const;
+    bool isZeroCopyBlob(size_t index, const InferenceEngine::Blob::Ptr &data);
+    void changeDefaultPtr(const std::vector<GraphBinding> &graphBindings);
+    const std::vector<bool> *getSkippedNodes(const std::vector<GraphBinding> &graphBindings);
     MKLDNNGraph::Ptr graph;
-    std::map<std::string, void*> externalPtr;
+    GraphPool::Ptr graphPool;
+    InferenceEngine::ITaskExecutor::Ptr streamsExecutor;
+    std::vector<BlobBinding> bindings;
+    std::map<std::string, size_t> bindingIndices;
+    std::map<MKLDNNGraph::Ptr, std::vector<GraphBinding>> graphsBindings;
+    // the nodes skipped for the skipped outputs, empty if all the outputs are computed
+    std::map<MKLDNNGraph::Ptr, const std::vector<bool> *> graphsSkippedNodes;
+    bool hasSkippedOutputs = false;
     // HOTFIX for openmp resize. Remove this line, execDataPreprocessing()
     // and mkldnn_preprocess_data files in order to disable this hotfix
     std::map<std::string, MKLDNNPreProcessData> _preProcData;  // pre-process data per input
+    std::shared_ptr<InferenceEngine::IAllocator> blobAllocator;
 
     int m_curBatch;
 };
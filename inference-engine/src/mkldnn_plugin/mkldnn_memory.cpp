@@ -13,6 +13,7 @@
 #include "mkldnn_memory.h"
 #include "mkldnn_node.h"
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_huge_pages.h"
 
 using namespace InferenceEngine;
 using namespace mkldnn;
@@ -31,7 +32,7 @@ size_t MKLDNNMemory::GetSize() const {
     return std::accumulate(std::begin(dims), std::end(dims), (size_t) 1, std::multiplies<size_t>()) * itemSize;
 }
 
-void MKLDNNMemory::Create(memory::dims dims, memory::data_type data_type, memory::format format, const void* data) {
+memory::desc MKLDNNMemory::CreateDesc(memory::dims dims, memory::data_type data_type, memory::format format) {
     if (!isConsistant(dims, format)) {
         THROW_IE_EXCEPTION << "dims and format are inconsistent.";
     }
@@ -45,11 +46,29 @@ void MKLDNNMemory::Create(memory::dims dims, memory::data_type data_type, memory
     if (format == memory::any) {
         CreateBlockingDesc(desc);
     }
+    return desc;
+}
+
+void MKLDNNMemory::Create(memory::dims dims, memory::data_type data_type, memory::format format, const void* data) {
+    Create(CreateDesc(dims, data_type, format), data);
+}
+
+void MKLDNNMemory::CreateOnHugePages(memory::dims dims, memory::data_type data_type, memory::format format,
+                                     size_t hugePageSize) {
+    CreateOnHugePages(CreateDesc(dims, data_type, format), hugePageSize);
+}
 
-    Create(desc, data);
+void MKLDNNMemory::CreateOnHugePages(const memory::desc& desc, size_t hugePageSize) {
+    std::shared_ptr<void> data;
+    if (hugePageSize != 0)
+        data = MKLDNNHugePages::allocate(memory::primitive_desc(desc, eng).get_size(), hugePageSize);
+    // the mapped pages are zeroed as the memory allocated by Create()
+    Create(desc, data.get());
+    hugePagesData = data;
 }
 
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data) {
+    ResetReorder();
     auto primitive_desc = memory::primitive_desc(desc, eng);
     uint8_t itemSize = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(desc.data.data_type));
 
@@ -71,6 +90,7 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data) {
         // MKLDNN accepts not a const data, probably need to remove some level of consteness in a call stack
         prim.reset(new memory(primitive_desc, const_cast<void*>(data)));
     }
+    hugePagesData.reset();
 }
 
 void MKLDNNMemory::CreateFrom(memory::dims dims, const MKLDNNMemory& src) {
@@ -83,11 +103,13 @@ void MKLDNNMemory::CreateFrom(memory::dims dims, const MKLDNNMemory& src) {
 }
 
 void MKLDNNMemory::CreateFrom(memory::primitive_desc &pdesc, const void* data) {
+    ResetReorder();
     if (data == nullptr) {
         prim = std::shared_ptr<memory>(new memory(pdesc));
     } else {
         prim = std::shared_ptr<memory>(new memory(pdesc, const_cast<void*>(data)));
     }
+    hugePagesData.reset();
 }
 
 void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, const void* data, size_t size, bool ftz) const {
@@ -95,19 +117,23 @@ void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, co
 
     if (static_cast<mkldnn_memory_format_t>(format) != GetDescriptor().data.format ||
             GetDataType() != dataType) {
-        auto memData = GetDescriptor().data;
+        if (!reorderPrim || reorderSrcFormat != format || reorderSrcDataType != dataType) {
+            auto memData = GetDescriptor().data;
 
-        std::vector<int> dims(memData.dims, memData.dims + memData.ndims);
+            std::vector<int> dims(memData.dims, memData.dims + memData.ndims);
 
-        auto dataType = GetDataType();
+            MKLDNNMemory src(eng);
+            src.Create(dims, dataType, format, data);
 
-        MKLDNNMemory src(eng);
-        src.Create(dims, dataType, format, data);
-
-        std::shared_ptr<mkldnn::reorder> pReorder =
-                std::shared_ptr<mkldnn::reorder>(new mkldnn::reorder(src.GetPrimitive(), GetPrimitive()));
+            reorderSrc = src.GetPrimitivePtr();
+            reorderPrim.reset(new mkldnn::reorder(*reorderSrc, GetPrimitive()));
+            reorderSrcFormat = format;
+            reorderSrcDataType = dataType;
+        } else {
+            reorderSrc->set_data_handle(const_cast<void*>(data));
+        }
 
-        mkldnn::stream(stream::kind::eager).submit({*pReorder});
+        mkldnn::stream(stream::kind::eager).submit({*reorderPrim});
     } else {
         uint8_t* dataPtr = static_cast<uint8_t*>(GetData());
         // We cannot support strides for i/o blobs because it affects performance.
@@ -115,7 +141,7 @@ void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, co
         memcpy(dataPtr, data, size);
     }
 
-    if (ftz && dataType == mkldnn_f32) {
+    if (ftz && GetDataType() == mkldnn_f32) {
         // Internal blobs haven't strides yet.
         auto *memData = static_cast<float *>(GetData());
         memData += prim->get_primitive_desc().desc().data.layout_desc.blocking.offset_padding;
@@ -132,17 +158,22 @@ void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, co
                            const std::vector<size_t>& size, bool ftz) const {
     size_t totalSize = static_cast<size_t >(std::accumulate(size.begin(), size.end(), 0));
 
-    char* buffer = new char[totalSize];
-    char* bufferPtr = buffer;
+    stagingBuffer.resize(totalSize);
+    char* bufferPtr = stagingBuffer.data();
 
     for (int i = 0; i < size.size(); i++) {
         memcpy(bufferPtr, data[i], size[i]);
         bufferPtr += size[i];
     }
 
-    SetData(dataType, format, buffer, totalSize, ftz);
+    SetData(dataType, format, stagingBuffer.data(), totalSize, ftz);
+}
 
-    delete [] buffer;
+void MKLDNNMemory::ResetReorder() const {
+    reorderPrim.reset();
+    reorderSrc.reset();
+    reorderSrcFormat = memory::format::format_undef;
+    reorderSrcDataType = memory::data_type::data_undef;
 }
 
 void MKLDNNMemory::FillZero() {
@@ -391,9 +422,15 @@ MKLDNNMemoryDesc::operator InferenceEngine::TensorDesc() const {
         case mkldnn_u8:
             precision = Precision::U8;
             break;
+        case mkldnn_s8:
+            precision = Precision::I8;
+            break;
         case mkldnn_s16:
             precision = Precision::I16;
             break;
+        case mkldnn_s32:
+            precision = Precision::I32;
+            break;
         default:
             THROW_IE_EXCEPTION << "Cannot cast to TensorDesc. Unsupported precision!";
     }
@@ -499,9 +536,15 @@ MKLDNNMemoryDesc::MKLDNNMemoryDesc(const TensorDesc& tDesc):
         case Precision::U8:
             data_type = mkldnn::memory::data_type::u8;
             break;
+        case Precision::I8:
+            data_type = mkldnn::memory::data_type::s8;
+            break;
         case Precision::I16:
             data_type = mkldnn::memory::data_type::s16;
             break;
+        case Precision::I32:
+            data_type = mkldnn::memory::data_type::s32;
+            break;
         default:
             THROW_IE_EXCEPTION << "Cannot create MKLDNNMemoryDesc from TensorDesc. Unsupported precision!";
     }
@@ -114,6 +114,14 @@ public:
     void CreateFrom(mkldnn::memory::dims dims, const MKLDNNMemory& src);
     void CreateFrom(mkldnn::memory::primitive_desc &pdesc, const void* data = nullptr);
 
+    /**
+     * @brief Creates the zeroed memory on the huge pages of the size (see MKLDNNHugePages), the memory is allocated
+     * as by Create() if hugePageSize is 0 or the huge pages are not available
+     */
+    void CreateOnHugePages(mkldnn::memory::dims dims, mkldnn::memory::data_type data_type,
+                           mkldnn::memory::format format, size_t hugePageSize);
+    void CreateOnHugePages(const mkldnn::memory::desc& desc, size_t hugePageSize);
+
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format format, const void* data, size_t size, bool ftz = true) const;
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format format, const std::vector<void*>& data,
                  const std::vector<size_t>& size, bool ftz = true) const;
@@ -131,8 +139,23 @@ public:
     static void CreateBlockingDesc(mkldnn::memory::desc& desc);
 
 private:
+    void ResetReorder() const;
+    static mkldnn::memory::desc CreateDesc(mkldnn::memory::dims dims, mkldnn::memory::data_type data_type,
+                                           mkldnn::memory::format format);
+
     std::shared_ptr<mkldnn::memory> prim;
+    // the huge pages the primitive works on, null if the memory is allocated by the primitive or by the user
+    std::shared_ptr<void> hugePagesData;
     mkldnn::engine eng;
+
+    // The reorder of the user data done by SetData() is kept while the user format and precision are the same,
+    // so the input data pushed on every inference doesn't create primitives
+    mutable std::shared_ptr<mkldnn::memory> reorderSrc;
+    mutable std::shared_ptr<mkldnn::reorder> reorderPrim;
+    mutable mkldnn::memory::format reorderSrcFormat = mkldnn::memory::format::format_undef;
+    mutable mkldnn::memory::data_type reorderSrcDataType = mkldnn::memory::data_type::data_undef;
+    // the data given by parts are gathered here before SetData()
+    mutable std::vector<char> stagingBuffer;
 };
 
 
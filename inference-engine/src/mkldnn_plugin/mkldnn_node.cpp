@@ -10,6 +10,7 @@
 #include <vector>
 #include <string>
 #include <limits>
+#include <algorithm>
 
 #include <nodes/mkldnn_batchnorm_node.h>
 #include <nodes/mkldnn_concat_node.h>
@@ -33,9 +34,11 @@
 #include <nodes/mkldnn_split_node.h>
 #include <nodes/mkldnn_permute_node.h>
 #include <nodes/mkldnn_memory_node.hpp>
+#include <nodes/mkldnn_rnn_node.h>
 #include <mkldnn_types.h>
 
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_weights_cache.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -65,6 +68,7 @@ MKLDNNNode::Register<MKLDNNTileNode> MKLDNNTileNode::reg;
 MKLDNNNode::Register<MKLDNNPermuteNode> MKLDNNPermuteNode::reg;
 MKLDNNNode::Register<MKLDNNMemoryInputNode> MKLDNNMemoryInputNode::reg;
 MKLDNNNode::Register<MKLDNNMemoryOutputNode> MKLDNNMemoryOutputNode::reg;
+MKLDNNNode::Register<MKLDNNRNNNode> MKLDNNRNNNode::reg;
 
 MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng)
         : cnnLayer(layer), name(layer->name), typeStr(layer->type), type(TypeFromName(layer->type)), engine(eng),
@@ -461,6 +465,27 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
             THROW_IE_EXCEPTION << "Cannot create internal buffer. Buffer can be overrun.";
         }
     };
+    // the blobs of the quantized layers are integer, the internal blobs always keep FP32 values
+    auto copyBlob = [&](char *dst, const InferenceEngine::Blob::Ptr &blb) {
+        switch (blb->precision()) {
+            case InferenceEngine::Precision::FP32:
+                memcpy(dst, blb->buffer(), blb->byteSize());
+                break;
+            case InferenceEngine::Precision::I8:
+                std::copy_n(blb->cbuffer().as<const int8_t *>(), blb->size(), reinterpret_cast<float *>(dst));
+                break;
+            case InferenceEngine::Precision::U8:
+                std::copy_n(blb->cbuffer().as<const uint8_t *>(), blb->size(), reinterpret_cast<float *>(dst));
+                break;
+            case InferenceEngine::Precision::I32:
+                std::copy_n(blb->cbuffer().as<const int32_t *>(), blb->size(), reinterpret_cast<float *>(dst));
+                break;
+            default:
+                THROW_IE_EXCEPTION << "Cannot create internal buffer for node " << getName()
+                                   << ". Unsupported precision " << blb->precision().name();
+        }
+        return blb->size() * sizeof(float);
+    };
     auto * wLayer = dynamic_cast<InferenceEngine::WeightableLayer*>(getCnnLayer().get());
     if (wLayer == nullptr)
         THROW_IE_EXCEPTION << "Cannot get weightable layer for node " << getName() << ".";
@@ -469,17 +494,17 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
 
     if (blb == nullptr)
         THROW_IE_EXCEPTION << "Cannot get internal blob layer for node " << getName() << ".";
+    const InferenceEngine::Blob::Ptr source = blb;
 
-    InferenceEngine::TensorDesc desc(blb->precision(), dims, InferenceEngine::TensorDesc::getLayoutByDims(dims));
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims));
     InferenceEngine::TBlob<float>::Ptr internalBlob = InferenceEngine::make_shared_blob<float>(desc);
     internalBlob->allocate();
     char *data = internalBlob->buffer();
     size_t intBuffSize = internalBlob->byteSize();
 
-    size_t offset = blb->byteSize();
+    size_t offset = blb->size() * sizeof(float);
     checkSize(intBuffSize, offset);
-    memcpy(data, blb->buffer(), blb->byteSize());
-    data += blb->byteSize();
+    data += copyBlob(data, blb);
     for (const auto &merged : getMergeWith()) {
         wLayer = dynamic_cast<InferenceEngine::WeightableLayer*>(merged->getCnnLayer().get());
         if (wLayer == nullptr)
@@ -489,12 +514,12 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
 
         if (blb == nullptr)
             THROW_IE_EXCEPTION << "Cannot get internal blob layer for node " << getName() << ".";
-        offset += blb->byteSize();
+        offset += blb->size() * sizeof(float);
         checkSize(intBuffSize, offset);
-        memcpy(data, blb->buffer(), blb->byteSize());
-        data += blb->byteSize();
+        data += copyBlob(data, blb);
     }
 
+    internalBlobSources[internalBlob.get()] = source;
     return internalBlob;
 }
 
@@ -517,8 +542,7 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
     internalBlobMemory.clear();
     for (size_t i = 0; i < internalBlobs.size(); i++) {
-        auto& internalBlob = internalBlobs[i];
-        internalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(engine)));
+        const auto& internalBlob = internalBlobs[i];
         MKLDNNDims blobDims = MKLDNNDims(internalBlob->getTensorDesc().getDims());
         memory::format format = memory::oihw;
 
@@ -529,15 +553,22 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
         } else if (blobDims.ndims() == 5) {
             format = memory::goihw;
         }
-        auto inDataType = MKLDNNMemoryDesc(getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc).getDataType();
+        // the internal blobs keep FP32 data, it is converted to the data type of the primitive (e.g. s8 weights
+        // of the quantized convolution) by the reorder
+        auto dataType = intDescs[i].getDataType();
 
         MKLDNNDims real_dims = intDescs[i].getDims();
-        if (blobDims == real_dims) {  // No auto blocking
-            // TODO: Cannot create memory from intDescs[i] because ScaleShift changes dims
-            internalBlobMemory[i]->Create(blobDims, inDataType, intDescs[i].getFormat());
-            internalBlobMemory[i]->SetData(inDataType, format, internalBlob->buffer(),
-                                           blobDims.size() * MKLDNNExtensionUtils::sizeOfDataType(inDataType));
-        } else {  // Auto blocking, logic and real dims are different
+
+        auto create = [&] () {
+            MKLDNNMemoryPtr memory(new MKLDNNMemory(engine));
+            if (blobDims == real_dims) {  // No auto blocking
+                // TODO: Cannot create memory from intDescs[i] because ScaleShift changes dims
+                memory->CreateOnHugePages(blobDims, dataType, intDescs[i].getFormat(), weightsHugePageSize);
+                memory->SetData(memory::f32, format, internalBlob->buffer(), blobDims.size() * sizeof(float));
+                return memory;
+            }
+
+            // Auto blocking, logic and real dims are different
             if (blobDims.ndims() != real_dims.ndims() || blobDims.ndims() > 5)
                 THROW_IE_EXCEPTION << getName() << " Error: CPU plugin supports auto blocking only "
                                    << "for blobs with a number of dimensions less than 6!";
@@ -585,9 +616,21 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
                 tmp_data[r_indx] = in_data[l_indx];
             }
-            internalBlobMemory[i]->Create(real_dims, inDataType, intDescs[i].getFormat());
-            internalBlobMemory[i]->SetData(inDataType, format, tmp_wght->buffer(), tmp_wght->byteSize());
+            memory->CreateOnHugePages(real_dims, dataType, intDescs[i].getFormat(), weightsHugePageSize);
+            memory->SetData(memory::f32, format, tmp_wght->buffer(), tmp_wght->byteSize());
+            return memory;
+        };
+
+        // Weights are read-only, so the graphs share the memory created from the same data of the same blob
+        auto source = internalBlobSources.find(internalBlob.get());
+        if (source == internalBlobSources.end()) {
+            internalBlobMemory.push_back(create());
+            continue;
         }
+        MKLDNNDims memDims = blobDims == real_dims ? blobDims : real_dims;
+        std::string key = MKLDNNWeightsSharing::makeKey(internalBlob->cbuffer(), internalBlob->byteSize(),
+                                                        MKLDNNMemoryDesc(memDims, dataType, intDescs[i].getFormat()));
+        internalBlobMemory.push_back(MKLDNNWeightsSharing::getInstance().findOrCreate(key, source->second, create));
     }
 }
 
@@ -645,6 +688,7 @@ MKLDNNNode::ConstantType MKLDNNNode::checkConstant(LOOK look, std::vector<MKLDNN
 
 void MKLDNNNode::cleanup() {
     internalBlobs.clear();
+    internalBlobSources.clear();
     cnnLayer.reset();
 
     for (auto it : fusedWith) {
@@ -716,6 +760,8 @@ std::string MKLDNNNode::typeToStr(Type type) {
             return "MemoryOutput";
         case MemoryInput:
             return "MemoryInput";
+        case RNN:
+            return "RNN";
         default:
             return "Unknown";
     }
@@ -59,6 +59,7 @@ enum Type {
     Copy,
     MemoryOutput,
     MemoryInput,
+    RNN,
 };
 
 static Type TypeFromName(const std::string type) {
@@ -103,6 +104,7 @@ static Type TypeFromName(const std::string type) {
             { "Copy", Copy },
             { "MemoryInput", MemoryInput},  // for construction from name ctor, arbitrary name is used
             { "Memory", MemoryOutput },  // for construction from layer ctor
+            { "RNN", RNN },
     };
 
     if (type_to_name_tbl.find(type) != type_to_name_tbl.end()) {
@@ -191,6 +193,10 @@ public:
         return mergedWith;
     }
 
+    const std::vector <MKLDNNNodePtr> &getFusedWith() {
+        return fusedWith;
+    }
+
     const std::string getName() const {
         return name;
     }
@@ -199,7 +205,7 @@ public:
         return type;
     }
 
-    const InferenceEngine::CNNLayerPtr &getCnnLayer() {
+    const InferenceEngine::CNNLayerPtr &getCnnLayer() const {
         return cnnLayer;
     }
 
@@ -231,11 +237,19 @@ public:
     std::string getPrimitiveDescriptorType();
 
     PerfCount &PerfCounter() { return perfCounter; }
+    PerfHistogram &PerfSamples() { return perfSamples; }
 
     InferenceEngine::ProfilingTask &GetProfilingTask() { return profilingTask; }
 
     virtual void setDynamicBatchLim(int lim);
 
+    /**
+     * @brief Places the weights prepared for the primitive on the huge pages of the size, 0 for the regular memory
+     */
+    void storeWeightsOnHugePages(size_t pageSize) {
+        weightsHugePageSize = pageSize;
+    }
+
     void resolveNotAllocatedEdges();
     virtual void execute(mkldnn::stream strm);
     virtual void initSupportedPrimitiveDescriptors();
@@ -340,6 +354,9 @@ protected:
     };
     ConstantType constant = ConstantType::Unknown;
     std::vector<InferenceEngine::Blob::Ptr> internalBlobs;
+    // the blobs of the layer the internal blobs of createInternalBlob() are read from, the memory of the internal
+    // blob is shared by the graphs reading the same blob (see MKLDNNWeightsSharing)
+    std::map<const InferenceEngine::Blob *, InferenceEngine::Blob::CPtr> internalBlobSources;
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     MKLDNNPrimitive prim;
@@ -386,7 +403,10 @@ private:
     std::string typeToStr(Type type);
 
     PerfCount perfCounter;
+    // the times of the sampled inferences (see Config::perfCountSampling)
+    PerfHistogram perfSamples;
     InferenceEngine::ProfilingTask profilingTask;
+    size_t weightsHugePageSize = 0;
 
     bool isEdgesEmpty(const std::vector<MKLDNNEdgeWeakPtr>& edges) const;
 
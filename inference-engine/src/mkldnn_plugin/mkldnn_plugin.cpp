@@ -48,6 +48,10 @@ Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network, const std::map
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+    // the networks shared by KEY_SHARE_EXECUTABLE_NETWORK are loaded with the same config of the plugin
+    for (auto &item : config) {
+        _config[item.first] = item.second;
+    }
 
     // Pass config to already loaded network
     // TODO: Clarify the behavior of SetConfig method. Should it pass data to already loaded networks?
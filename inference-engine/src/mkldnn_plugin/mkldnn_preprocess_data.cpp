@@ -4,18 +4,13 @@
 //
 
 #include <algorithm>
+#include <vector>
 #include <immintrin.h>
-#if defined(_OPENMP)
-#include <omp.h>
-#else
-inline int omp_get_max_threads() { return 1; }
-inline int omp_get_num_threads() { return 1; }
-inline int omp_get_thread_num() { return 0; }
-inline int omp_in_parallel() { return 0; }
-#endif
 
 #include "mkldnn_preprocess_data.hpp"
+#include "mkldnn_resize_kernels.h"
 #include "blob_transform.hpp"
+#include "ie_parallel.hpp"
 
 using namespace InferenceEngine;
 namespace MKLDNNPlugin {
@@ -66,8 +61,14 @@ ALWAYS_INLINE uint8_t saturateU32toU8(uint32_t v) {
     return static_cast<uint8_t>(v > UINT8_MAX ? UINT8_MAX : v);
 }
 
+// the index of the scratch rows of the thread, the sequential resize allocates the rows of the single thread
+template <bool IS_PARALLEL_EXEC>
+ALWAYS_INLINE int thread_slot() {
+    return IS_PARALLEL_EXEC ? parallel_get_thread_num() : 0;
+}
+
 template <bool IS_PARALLEL_EXEC>
-void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
+void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer, bool reuse_tabs) {
     Border border = {REPLICATE, 0};
 
     auto dstDims = outBlob->getTensorDesc().getDims();
@@ -116,9 +117,9 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
     auto *beta = reinterpret_cast<int16_t *>(yofs + dheight);
     auto *tptr = reinterpret_cast<uint8_t *>(beta + dheight);
 
-    int id_count = IS_PARALLEL_EXEC ? omp_get_max_threads() : 1;
+    int id_count = IS_PARALLEL_EXEC ? parallel_get_max_threads() : 1;
     for (int id = 0; id < id_count; id++) {
-        auto tptr_ = tptr + omp_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
+        auto tptr_ = tptr + id * (((swidth + 7) / 8) * 8 * 8);
 
         tptr_[0] = (uint8_t) border.value;
         tptr_[1] = (uint8_t) border.value;
@@ -134,7 +135,7 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
         tptr_[swidth * rows_block_size + 3 + 4] = (uint8_t) border.value;
     }
 
-    for (int dx = dst_go_x; dx < dst_go_x + dwidth; dx++) {
+    for (int dx = dst_go_x; dx < dst_go_x + dwidth && !reuse_tabs; dx++) {
         auto fx = static_cast<float>((dx + 0.5) * scale_x - 0.5);
         int32_t sx = floor(fx);
         fx -= sx;
@@ -158,7 +159,7 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
         }
     }
 
-    for (int dy = dst_go_y; dy < dst_go_y + dheight; dy++) {
+    for (int dy = dst_go_y; dy < dst_go_y + dheight && !reuse_tabs; dy++) {
         float fy = static_cast<float>((dy + 0.5) * scale_y - 0.5);
         int32_t sy = floor(fy);
         fy -= sy;
@@ -184,7 +185,7 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
         auto full_pass = [&](int c, int y) {
             auto sptr_ = sptr + c * origSrcW * origSrcH;
             auto dptr_ = dptr + c * origDstW * origDstH;
-            auto tptr_ = tptr + omp_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
+            auto tptr_ = tptr + thread_slot<IS_PARALLEL_EXEC>() * (((swidth + 7) / 8) * 8 * 8);
 
             for (int x = 0; x < swidth; x++) {
                 int val0 = (yofs[y] < 0) ? border.value : sptr_[yofs[y] + x + 0];
@@ -205,12 +206,9 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
         };
 
         if (IS_PARALLEL_EXEC) {
-            #pragma omp parallel for schedule(static) collapse(2)
-            for (int c = 0; c < channels; c++) {
-                for (int y = 0; y < dheight; y++) {
-                    full_pass(c, y);
-                }
-            }
+            parallel_for2d(channels, dheight, [&](int c, int y) {
+                full_pass(c, y);
+            });
         } else {
             for (int c = 0; c < channels; c++) {
                 for (int y = 0; y < dheight; y++) {
@@ -382,25 +380,23 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
     };
 
     if (IS_PARALLEL_EXEC) {
-        #pragma omp parallel for schedule(static) collapse(2)
-        for (int c = 0; c < channels; c++) {
-            for (int y = 0; y <= dheight - rows_block_size; y += rows_block_size) {
-                auto sptr_ = sptr + c * origSrcW * origSrcH;
-                auto dptr_ = dptr + c * origDstW * origDstH;
-                auto tptr_ = tptr + omp_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
+        parallel_for2d(channels, dheight / rows_block_size, [&](int c, int yb) {
+            const int y = yb * rows_block_size;
+            auto sptr_ = sptr + c * origSrcW * origSrcH;
+            auto dptr_ = dptr + c * origDstW * origDstH;
+            auto tptr_ = tptr + thread_slot<IS_PARALLEL_EXEC>() * (((swidth + 7) / 8) * 8 * 8);
 
-                full_pass_vec(sptr_, dptr_, tptr_, y);
+            full_pass_vec(sptr_, dptr_, tptr_, y);
 
-                if (y + rows_block_size > dheight - rows_block_size)
-                    full_pass_vec(sptr_, dptr_, tptr_, dheight - rows_block_size);
-            }
-        }
+            if (y + rows_block_size > dheight - rows_block_size)
+                full_pass_vec(sptr_, dptr_, tptr_, dheight - rows_block_size);
+        });
     } else {
         for (int c = 0; c < channels; c++) {
             for (int y = 0; y <= dheight - rows_block_size; y += rows_block_size) {
                 auto sptr_ = sptr + c * origSrcW * origSrcH;
                 auto dptr_ = dptr + c * origDstW * origDstH;
-                auto tptr_ = tptr + omp_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
+                auto tptr_ = tptr + thread_slot<IS_PARALLEL_EXEC>() * (((swidth + 7) / 8) * 8 * 8);
 
                 full_pass_vec(sptr_, dptr_, tptr_, y);
 
@@ -412,7 +408,7 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
 }
 
 template <bool IS_PARALLEL_EXEC>
-void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
+void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer, bool reuse_tabs) {
     Border border = {REPLICATE, 0};
 
     auto dstDims = outBlob->getTensorDesc().getDims();
@@ -452,7 +448,7 @@ void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* bu
     auto* beta = alpha + dwidth;
     auto* tptr = beta + dheight;
 
-    for (int dx = dst_go_x; dx < dst_go_x + dwidth; dx++) {
+    for (int dx = dst_go_x; dx < dst_go_x + dwidth && !reuse_tabs; dx++) {
         auto fx = static_cast<float>((dx + 0.5) * scale_x - 0.5);
         int32_t sx = floor(fx);
         fx -= sx;
@@ -472,7 +468,7 @@ void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* bu
         alpha[dx - dst_go_x] = fx;
     }
 
-    for (int dy = dst_go_y; dy < dst_go_y + dheight; dy++) {
+    for (int dy = dst_go_y; dy < dst_go_y + dheight && !reuse_tabs; dy++) {
         auto fy = static_cast<float>((dy + 0.5) * scale_y - 0.5);
         int32_t sy = floor(fy);
         fy -= sy;
@@ -492,19 +488,25 @@ void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* bu
         beta[dy - dst_go_y] = fy;
     }
 
+    const MKLDNNResizeKernels &kernels = MKLDNNResizeKernels::get();
+
     auto full_pass = [&](int c, int y) {
         auto sptr_ = sptr + c * origSrcW * origSrcH;
         auto dptr_ = dptr + c * origDstW * origDstH;
-        auto tptr_ = tptr + omp_get_thread_num() * (((swidth + 1) / 2) * 2 * 2);
+        auto tptr_ = tptr + thread_slot<IS_PARALLEL_EXEC>() * (((swidth + 1) / 2) * 2 * 2);
 
-        for (int x = 0; x < swidth; x++) {
-            bool use_constant0 = yofs[y] + 0 < 0 || yofs[y] + 0 >= src_full_height;
-            bool use_constant1 = yofs[y] + 1 < 0 || yofs[y] + 1 >= src_full_height;
-            float val0 = use_constant0 ? border.value : sptr_[(yofs[y] + 0) * sstep + x];
-            float val1 = use_constant1 ? border.value : sptr_[(yofs[y] + 1) * sstep + x];
+        bool use_constant0 = yofs[y] + 0 < 0 || yofs[y] + 0 >= src_full_height;
+        bool use_constant1 = yofs[y] + 1 < 0 || yofs[y] + 1 >= src_full_height;
+        if (!use_constant0 && !use_constant1) {
+            kernels.lerp(sptr_ + (yofs[y] + 0) * sstep, sptr_ + (yofs[y] + 1) * sstep, beta[y], tptr_, swidth);
+        } else {
+            for (int x = 0; x < swidth; x++) {
+                float val0 = use_constant0 ? border.value : sptr_[(yofs[y] + 0) * sstep + x];
+                float val1 = use_constant1 ? border.value : sptr_[(yofs[y] + 1) * sstep + x];
 
-            float res = val0 + beta[y] * (val1 - val0);
-            tptr_[x] = res;
+                float res = val0 + beta[y] * (val1 - val0);
+                tptr_[x] = res;
+            }
         }
 
         for (int x = 0; x < dwidth; x++) {
@@ -519,12 +521,9 @@ void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* bu
     };
 
     if (IS_PARALLEL_EXEC) {
-        #pragma omp parallel for schedule(static) collapse(2)
-        for (int c = 0; c < channels; c++) {
-            for (int y = 0; y < dheight; y++) {
-                full_pass(c, y);
-            }
-        }
+        parallel_for2d(channels, dheight, [&](int c, int y) {
+            full_pass(c, y);
+        });
     } else {
         for (int c = 0; c < channels; c++) {
             for (int y = 0; y < dheight; y++) {
@@ -640,7 +639,7 @@ void generate_alpha_and_id_arrays(int x_max_count, int dcols, const uint16_t* xa
 }
 
 template <bool IS_PARALLEL_EXEC>
-void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
+void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer, bool reuse_tabs) {
     auto dstDims = outBlob->getTensorDesc().getDims();
     auto srcDims = inBlob->getTensorDesc().getDims();
 
@@ -683,10 +682,12 @@ void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t
     auto* xalpha = ysi + dheight;
     auto* yalpha = xalpha + dwidth*x_max_count + 8*16;
 
-    computeResizeAreaTab(src_go_x, dst_go_x, src_full_width,   dwidth, scale_x, xsi, xalpha, x_max_count);
-    computeResizeAreaTab(src_go_y, dst_go_y, src_full_height, dheight, scale_y, ysi, yalpha, y_max_count);
+    if (!reuse_tabs) {
+        computeResizeAreaTab(src_go_x, dst_go_x, src_full_width,   dwidth, scale_x, xsi, xalpha, x_max_count);
+        computeResizeAreaTab(src_go_y, dst_go_y, src_full_height, dheight, scale_y, ysi, yalpha, y_max_count);
+    }
 
-    int vest_sum_size = IS_PARALLEL_EXEC ? 2*swidth*omp_get_max_threads() : 2*swidth;
+    int vest_sum_size = IS_PARALLEL_EXEC ? 2*swidth*parallel_get_max_threads() : 2*swidth;
     uint16_t* vert_sum = yalpha + dheight*y_max_count;
     uint16_t* alpha0 = vert_sum + vest_sum_size;
     uint16_t* alpha1 = alpha0 + dwidth;
@@ -699,11 +700,14 @@ void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t
 
     uint16_t* alpha[] = {alpha0, alpha1, alpha2, alpha3};
     uint16_t* sxid[] = {sxid0, sxid1, sxid2, sxid3};
-    generate_alpha_and_id_arrays(x_max_count, dwidth, xalpha, xsi, alpha, sxid);
+    if (!reuse_tabs)
+        generate_alpha_and_id_arrays(x_max_count, dwidth, xalpha, xsi, alpha, sxid);
+
+    const MKLDNNResizeKernels &kernels = MKLDNNResizeKernels::get();
 
     auto full_pass = [&](int c, int y) {
         uint8_t* pdst_row = dptr + (y * dstep) + c * origDstW * origDstH;
-        uint16_t* vert_sum_ = vert_sum + 2*swidth*omp_get_thread_num();
+        uint16_t* vert_sum_ = vert_sum + 2*swidth*thread_slot<IS_PARALLEL_EXEC>();
 
         int ysi_row = ysi[y];
 
@@ -714,29 +718,7 @@ void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t
             const uint8_t *sptr_dy = sptr + ((ysi_row + dy) * sstep) + c * origSrcW * origSrcH;
             if (ysi_row + dy >= sheight) break;
 
-            int x = 0;
-
-            __m128i yalpha_dy_sse = _mm_set1_epi16(yalpha_dy);
-            for (; x <= swidth - 16; x += 16) {
-                __m128i sval = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sptr_dy + x));
-
-                // sptr_dy[x] << 8
-                __m128i sval_Q16_lo = _mm_unpacklo_epi8(_mm_setzero_si128(), sval);
-                __m128i sval_Q16_hi = _mm_unpackhi_epi8(_mm_setzero_si128(), sval);
-
-                __m128i vert_sum_lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(vert_sum_ + x + 0));
-                __m128i vert_sum_hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(vert_sum_ + x + 8));
-
-                vert_sum_lo = _mm_add_epi16(vert_sum_lo, _mm_mulhi_epu16(yalpha_dy_sse, sval_Q16_lo));
-                vert_sum_hi = _mm_add_epi16(vert_sum_hi, _mm_mulhi_epu16(yalpha_dy_sse, sval_Q16_hi));
-
-                _mm_storeu_si128(reinterpret_cast<__m128i*>(vert_sum_ + x + 0), vert_sum_lo);
-                _mm_storeu_si128(reinterpret_cast<__m128i*>(vert_sum_ + x + 8), vert_sum_hi);
-            }
-
-            for (; x < swidth; x++) {
-                vert_sum_[x] += mulq16(yalpha_dy, static_cast<uint16_t>(sptr_dy[x] << 8));
-            }
+            kernels.accumulateQ16(sptr_dy, yalpha_dy, vert_sum_, swidth);
         }
 
         if (x_max_count == 2) {
@@ -963,12 +945,9 @@ void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t
     };
 
     if (IS_PARALLEL_EXEC) {
-        #pragma omp parallel for schedule(static) collapse(2)
-        for (int c = 0; c < channels; c++) {
-            for (int y = 0; y < dheight; y++) {
-                full_pass(c, y);
-            }
-        }
+        parallel_for2d(channels, dheight, [&](int c, int y) {
+            full_pass(c, y);
+        });
     } else {
         for (int c = 0; c < channels; c++) {
             for (int y = 0; y < dheight; y++) {
@@ -1015,7 +994,7 @@ int computeResizeAreaTabFP32(int src_go, int dst_go, int ssize, int dsize, float
 }
 
 template <bool IS_PARALLEL_EXEC>
-void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
+void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer, bool reuse_tabs) {
     auto dstDims = outBlob->getTensorDesc().getDims();
     auto srcDims = inBlob->getTensorDesc().getDims();
 
@@ -1051,7 +1030,7 @@ void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
     float scale_x = static_cast<float>(src_full_width) / dst_full_width;
     float scale_y = static_cast<float>(src_full_height) / dst_full_height;
 
-    int vert_sum_size = IS_PARALLEL_EXEC ? omp_get_max_threads() * swidth : swidth;
+    int vert_sum_size = IS_PARALLEL_EXEC ? parallel_get_max_threads() * swidth : swidth;
     int tabofs_size = std::max(2*swidth, 2*dwidth);
     int xsi_size = std::max(2*swidth, 2*dwidth);
     int xdi_size = std::max(2*swidth, 2*dwidth);
@@ -1059,7 +1038,9 @@ void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
     int ydi_size = std::max(2*sheight, 2*dheight);
     int xalpha_size = std::max(2*swidth, 2*dwidth);
 
-    auto vert_sum = reinterpret_cast<float*>(buffer);
+    // the sizes of the tables are kept with the tables
+    auto tab_sizes = reinterpret_cast<int*>(buffer);
+    auto vert_sum = reinterpret_cast<float*>(tab_sizes + 2);
     auto tabofs = reinterpret_cast<int*>(vert_sum + vert_sum_size);
     auto xsi = reinterpret_cast<uint16_t*>(tabofs + tabofs_size + 1);
     auto xdi = xsi + xsi_size;
@@ -1068,19 +1049,27 @@ void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
     auto xalpha = reinterpret_cast<float*>(ydi + ydi_size);
     auto yalpha = xalpha + xalpha_size;
 
-    int ytab_size = computeResizeAreaTabFP32(src_go_y, dst_go_y, src_full_height, dheight, scale_y, ysi, ydi, yalpha);
-    int xtab_size = computeResizeAreaTabFP32(src_go_x, dst_go_x, src_full_width,  dwidth,  scale_x, xsi, xdi, xalpha);
+    if (!reuse_tabs) {
+        tab_sizes[0] = computeResizeAreaTabFP32(src_go_y, dst_go_y, src_full_height, dheight, scale_y,
+                                                ysi, ydi, yalpha);
+        tab_sizes[1] = computeResizeAreaTabFP32(src_go_x, dst_go_x, src_full_width,  dwidth,  scale_x,
+                                                xsi, xdi, xalpha);
 
-    int dy_ = 0;
-    for (int i = 0; i < ytab_size && dy_ < dwidth*2; i++) {
-        if (i == 0 || ydi[i] != ydi[i-1]) {
-            tabofs[dy_++] = i;
+        int dy_ = 0;
+        for (int i = 0; i < tab_sizes[0] && dy_ < dwidth*2; i++) {
+            if (i == 0 || ydi[i] != ydi[i-1]) {
+                tabofs[dy_++] = i;
+            }
         }
+        tabofs[dy_] = tab_sizes[0];
     }
-    tabofs[dy_] = ytab_size;
+    const int ytab_size = tab_sizes[0];
+    const int xtab_size = tab_sizes[1];
+
+    const MKLDNNResizeKernels &kernels = MKLDNNResizeKernels::get();
 
     auto full_pass = [&](const float* sptr_, float* dptr_, int y) {
-        auto vert_sum_ = vert_sum + omp_get_thread_num() * swidth;
+        auto vert_sum_ = vert_sum + thread_slot<IS_PARALLEL_EXEC>() * swidth;
 
         memset(vert_sum_, 0, swidth * sizeof(float));
 
@@ -1091,9 +1080,7 @@ void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
             int sy = ysi[dy];
 
             const float *psrc = sptr_ + sy * sstep;
-            for (int x = 0; x < swidth; x++) {
-                vert_sum_[x] += beta * psrc[x];
-            }
+            kernels.accumulate(psrc, beta, vert_sum_, swidth);
         }
 
         int xtab_ind = 0;
@@ -1113,15 +1100,12 @@ void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
     };
 
     if (IS_PARALLEL_EXEC) {
-        #pragma omp parallel for schedule(static) collapse(2)
-        for (int ch = 0; ch < channels; ch++) {
-            for (int y = 0; y < dheight; y++) {
-                auto sptr_ = sptr + ch * origSrcH * origSrcW;
-                auto dptr_ = dptr + ch * origDstH * origDstW;
+        parallel_for2d(channels, dheight, [&](int ch, int y) {
+            auto sptr_ = sptr + ch * origSrcH * origSrcW;
+            auto dptr_ = dptr + ch * origDstH * origDstW;
 
-                full_pass(sptr_, dptr_, y);
-            }
-        }
+            full_pass(sptr_, dptr_, y);
+        });
     } else {
         for (int ch = 0; ch < channels; ch++) {
             for (int y = 0; y < dheight; y++) {
@@ -1191,7 +1175,7 @@ void VResizeLinear(float** src, data_t* dst, const float* beta, int width) {
 }
 
 template<typename data_t, bool IS_PARALLEL_EXEC>
-static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
+static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer, bool reuse_tabs) {
     auto dstDims = outBlob->getTensorDesc().getDims();
     auto srcDims = inBlob->getTensorDesc().getDims();
 
@@ -1228,13 +1212,16 @@ static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
     int ksize = 2;
     int ksize2 = ksize/2;
 
-    auto xofs = reinterpret_cast<int*>(buffer);
+    // the bounds of the columns with the full kernel are kept with the tables
+    auto xbounds = reinterpret_cast<int*>(buffer);
+    auto xofs = xbounds + 2;
     auto yofs = xofs + width;
     auto alpha = reinterpret_cast<float*>(yofs + dheight);
     auto beta = alpha + width*ksize;
+    auto rows_buffer = reinterpret_cast<uint8_t*>(beta + dheight*ksize);
     float cbuf[2] = {0};
 
-    for (int dx = 0; dx < dwidth; dx++) {
+    for (int dx = 0; dx < dwidth && !reuse_tabs; dx++) {
         int sx = floor(dx*scale_x);
         float fx = (dx+1) - (sx+1)*inv_scale_x;
         fx = fx <= 0 ? 0.f : fx - floor(fx);
@@ -1260,7 +1247,7 @@ static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
             alpha[dx*ksize + k] = cbuf[k];
     }
 
-    for (int dy = 0; dy < dheight; dy++) {
+    for (int dy = 0; dy < dheight && !reuse_tabs; dy++) {
         int sy = floor(dy*scale_y);
         float fy = (dy+1) - (sy+1)*inv_scale_y;
         fy = fy <= 0 ? 0.f : fy - floor(fy);
@@ -1273,6 +1260,14 @@ static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
             beta[dy*ksize + k] = cbuf[k];
     }
 
+    if (!reuse_tabs) {
+        xbounds[0] = xmin;
+        xbounds[1] = xmax;
+    } else {
+        xmin = xbounds[0];
+        xmax = xbounds[1];
+    }
+
     auto full_pass = [&](const data_t* sptr_, data_t* dptr_, int dy) {
         int bufstep = dwidth;
         const data_t* srows[MAX_ESIZE]={0};
@@ -1281,8 +1276,7 @@ static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
 
         for (int k = 0; k < ksize; k++) {
             prev_sy[k] = -1;
-            rows[k] = reinterpret_cast<float*>(buffer + (width + dheight)*(sizeof(int) + sizeof(float)*ksize))
-                      + k*bufstep + ksize*bufstep*omp_get_thread_num();
+            rows[k] = reinterpret_cast<float*>(rows_buffer) + k*bufstep + ksize*bufstep*thread_slot<IS_PARALLEL_EXEC>();
         }
 
         int sy0 = yofs[dy], k0 = ksize, k1 = 0;
@@ -1311,15 +1305,12 @@ static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
     };
 
     if (IS_PARALLEL_EXEC) {
-        #pragma omp parallel for schedule(static) collapse(2)
-        for (int ch = 0; ch < channels; ch++) {
-            for (int dy = 0; dy < dheight; dy++) {
-                auto sptr_ = sptr + ch * origSrcH * origSrcW;
-                auto dptr_ = dptr + ch * origDstH * origDstW;
+        parallel_for2d(channels, dheight, [&](int ch, int dy) {
+            auto sptr_ = sptr + ch * origSrcH * origSrcW;
+            auto dptr_ = dptr + ch * origDstH * origDstW;
 
-                full_pass(sptr_, dptr_, dy);
-            }
-        }
+            full_pass(sptr_, dptr_, dy);
+        });
     } else {
         for (int ch = 0; ch < channels; ch++) {
             for (int dy = 0; dy < dheight; dy++) {
@@ -1348,11 +1339,12 @@ size_t resize_get_buffer_size(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeA
     float scale_x = static_cast<float>(dstDims[3]) / srcDims[3];
     float scale_y = static_cast<float>(dstDims[2]) / srcDims[2];
 
-    int threads_count = is_parallel_exec ? omp_get_max_threads() : 1;
+    int threads_count = is_parallel_exec ? parallel_get_max_threads() : 1;
 
     size_t buffer_size;
     if ((scale_x >= 1 || scale_y >= 1) && algorithm == RESIZE_AREA) {
-        buffer_size = (dstDims[3] + dstDims[2])*(sizeof(int) + sizeof(float)*2) + 2*dstDims[3]*threads_count * sizeof(float);
+        buffer_size = 2*sizeof(int) + (dstDims[3] + dstDims[2])*(sizeof(int) + sizeof(float)*2) +
+                      2*dstDims[3]*threads_count * sizeof(float);
     } else if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
         if (algorithm == RESIZE_BILINEAR) {
             buffer_size = (sizeof(int16_t) * 4 + sizeof(uint8_t *)) * dstDims[3] +
@@ -1390,7 +1382,7 @@ size_t resize_get_buffer_size(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeA
                           (sizeof(int32_t) + sizeof(float)) * dstDims[2] +
                           (((srcDims[3] + 1) / 2) * 2 * 2)*threads_count * sizeof(float);
         } else {
-            buffer_size = sizeof(float) * (srcDims[3])*threads_count +
+            buffer_size = 2*sizeof(int) + sizeof(float) * (srcDims[3])*threads_count +
                           sizeof(uint32_t) * (dstDims[3] * 2 + 1) +
                           sizeof(float) * ((srcDims[3] + srcDims[2]) * 4) +
                           sizeof(float) * ((srcDims[3] + srcDims[2]) * 2);
@@ -1400,7 +1392,12 @@ size_t resize_get_buffer_size(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeA
     return buffer_size;
 }
 
-void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorithm) {
+/**
+ * The buffer of resize_get_buffer_size() holds the coefficient tables followed by the scratch rows, the tables
+ * computed by the previous call with the same shapes are reused if reuse_tabs is set.
+ */
+void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorithm, bool enable_parallel_execution,
+            uint8_t *buffer, bool reuse_tabs) {
     if (inBlob->getTensorDesc().getLayout() != NCHW || outBlob->getTensorDesc().getLayout() != NCHW)
         THROW_IE_EXCEPTION << "Resize supports only NCHW layout";
 
@@ -1411,12 +1408,6 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
     if (algorithm != RESIZE_BILINEAR && algorithm != RESIZE_AREA)
         THROW_IE_EXCEPTION << "Unsupported resize algorithm type";
 
-
-    bool enable_parallel_execution = true;
-
-    size_t buffer_size = resize_get_buffer_size(inBlob, outBlob, algorithm, enable_parallel_execution);
-    auto* buffer = static_cast<uint8_t *>(malloc(buffer_size));
-
     auto dstDims = outBlob->getTensorDesc().getDims();
     auto srcDims = inBlob->getTensorDesc().getDims();
     float scale_x = static_cast<float>(dstDims[3]) / srcDims[3];
@@ -1425,197 +1416,359 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
     if (enable_parallel_execution) {
         if (algorithm == RESIZE_BILINEAR) {
             if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
-                resize_bilinear_u8<true>(inBlob, outBlob, buffer);
+                resize_bilinear_u8<true>(inBlob, outBlob, buffer, reuse_tabs);
             } else {
-                resize_bilinear_fp32<true>(inBlob, outBlob, buffer);
+                resize_bilinear_fp32<true>(inBlob, outBlob, buffer, reuse_tabs);
             }
         } else if (algorithm == RESIZE_AREA) {
             if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
                 if (scale_x < 1 && scale_y < 1)
-                    resize_area_u8_downscale<true>(inBlob, outBlob, buffer);
+                    resize_area_u8_downscale<true>(inBlob, outBlob, buffer, reuse_tabs);
                 else
-                    resize_area_upscale<uint8_t, true>(inBlob, outBlob, buffer);
+                    resize_area_upscale<uint8_t, true>(inBlob, outBlob, buffer, reuse_tabs);
             } else {
                 if (scale_x < 1 && scale_y < 1)
-                    resize_area_fp32_downscale<true>(inBlob, outBlob, buffer);
+                    resize_area_fp32_downscale<true>(inBlob, outBlob, buffer, reuse_tabs);
                 else
-                    resize_area_upscale<float, true>(inBlob, outBlob, buffer);
+                    resize_area_upscale<float, true>(inBlob, outBlob, buffer, reuse_tabs);
             }
         }
     } else {
         if (algorithm == RESIZE_BILINEAR) {
             if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
-                resize_bilinear_u8<false>(inBlob, outBlob, buffer);
+                resize_bilinear_u8<false>(inBlob, outBlob, buffer, reuse_tabs);
             } else {
-                resize_bilinear_fp32<false>(inBlob, outBlob, buffer);
+                resize_bilinear_fp32<false>(inBlob, outBlob, buffer, reuse_tabs);
             }
         } else if (algorithm == RESIZE_AREA) {
             if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
                 if (scale_x < 1 && scale_y < 1)
-                    resize_area_u8_downscale<false>(inBlob, outBlob, buffer);
+                    resize_area_u8_downscale<false>(inBlob, outBlob, buffer, reuse_tabs);
                 else
-                    resize_area_upscale<uint8_t, false>(inBlob, outBlob, buffer);
+                    resize_area_upscale<uint8_t, false>(inBlob, outBlob, buffer, reuse_tabs);
             } else {
                 if (scale_x < 1 && scale_y < 1)
-                    resize_area_fp32_downscale<false>(inBlob, outBlob, buffer);
+                    resize_area_fp32_downscale<false>(inBlob, outBlob, buffer, reuse_tabs);
                 else
-                    resize_area_upscale<float, false>(inBlob, outBlob, buffer);
+                    resize_area_upscale<float, false>(inBlob, outBlob, buffer, reuse_tabs);
             }
         }
     }
+}
+
+// the coefficients of the bilinear interpolation with the replicated border, as in resize_bilinear_fp32
+void computeBilinearTab(int ssize, int dsize, int *sofs0, int *sofs1, float *alpha) {
+    auto scale = static_cast<float>(ssize) / dsize;
+    for (int d = 0; d < dsize; d++) {
+        auto f = static_cast<float>((d + 0.5) * scale - 0.5);
+        int s = floor(f);
+        f -= s;
+
+        int s0 = s;
+        if (s < 0) {
+            f = 0;
+            s0 = 0;
+        }
+        if (s >= ssize - 1) {
+            f = 1.f;
+            s0 = std::max(ssize - 2, 0);
+        }
 
-    free(buffer);
+        sofs0[d] = s0;
+        sofs1[d] = std::min(s0 + 1, ssize - 1);
+        alpha[d] = f;
+    }
 }
 
-}  // anonymous namespace
+// BT.601 conversion of the video range, as the decoders give it
+ALWAYS_INLINE void yuv2bgr(int y, int u, int v, float *bgr) {
+    float luma = 1.164f * static_cast<float>(std::max(y - 16, 0));
+    float cb = static_cast<float>(u - 128);
+    float cr = static_cast<float>(v - 128);
+    bgr[0] = std::min(std::max(luma + 2.018f * cb, 0.f), 255.f);
+    bgr[1] = std::min(std::max(luma - 0.813f * cr - 0.391f * cb, 0.f), 255.f);
+    bgr[2] = std::min(std::max(luma + 1.596f * cr, 0.f), 255.f);
+}
 
-void MKLDNNPreProcessData::setRoiBlob(const Blob::Ptr &blob) {
-    _roiBlob = blob;
+ALWAYS_INLINE float lerp(float v0, float v1, float alpha) {
+    return v0 + alpha * (v1 - v0);
 }
 
-Blob::Ptr MKLDNNPreProcessData::getRoiBlob() const {
-    return _roiBlob;
+// the offsets and the weights of computeBilinearTab() for the columns and the rows of the output
+size_t fused_get_tabs_size(Blob::Ptr outBlob) {
+    auto dstDims = outBlob->getTensorDesc().getDims();
+    return (dstDims[3] + dstDims[2]) * (2 * sizeof(int) + sizeof(float));
 }
 
 /**
- * Perform data copy with taking into account
- * layout and precision params
+ * The color conversion, the bilinear resize, the conversion of the layout and the precision and the subtraction
+ * of the mean in a single pass: every pixel of the FP32 NCHW output reads its four source pixels of the U8 ROI,
+ * so neither the converted nor the resized copy of the image is written to the memory.
+ * The tables of fused_get_tabs_size() computed by the previous call with the same shapes are reused
+ * if reuse_tabs is set.
  */
-static void parallel_blob_copy(Blob::Ptr src, Blob::Ptr dst);
-
-template <InferenceEngine::Precision::ePrecision PRC>
-static void parallel_blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
-    using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
-
-    data_t *src_ptr = src->buffer().as<data_t*>();
-    data_t *dst_ptr = dst->buffer().as<data_t*>();
-
-    auto dims = src->getTensorDesc().getDims();
-
-    int N = dims[0];
-    int C = dims[1];
-    int H = dims[2];
-    int W = dims[3];
-
-    const auto src_blk_desc = src->getTensorDesc().getBlockingDesc();
-    const auto src_strides = src_blk_desc.getStrides();
-    const auto src_order = src_blk_desc.getOrder();
-    int N_src_stride = src_strides[0];
-    int C_src_stride = src->layout() == NHWC ? src_strides[3] : src_strides[1];
-    int H_src_stride = src->layout() == NHWC ? src_strides[1] : src_strides[2];
-    int W_src_stride = src->layout() == NHWC ? src_strides[2] : src_strides[3];
-    int src_off = src_blk_desc.getOffsetPadding();
-
-    src_ptr += src_off;
-
-
-    const auto dst_blk_desc = dst->getTensorDesc().getBlockingDesc();
-    const auto dst_strides = dst_blk_desc.getStrides();
-    const auto dst_order = dst_blk_desc.getOrder();
-    int N_dst_stride = dst_strides[0];
-    int C_dst_stride = dst->layout() == NHWC ? dst_strides[3] : dst_strides[1];
-    int H_dst_stride = dst->layout() == NHWC ? dst_strides[1] : dst_strides[2];
-    int W_dst_stride = dst->layout() == NHWC ? dst_strides[2] : dst_strides[3];
-    int dst_off = dst_blk_desc.getOffsetPadding();
-
-    src_ptr += dst_off;
-
-    // WA. Because of wrong filler
-    int _N_dst_stride = C*H*W;
-    int _C_dst_stride = H*W;
-    int _W_dst_stride = C;
-
-    if (src->layout() == NHWC && dst->layout() == NCHW) {
-#       pragma omp parallel for collapse(2)
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t *dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t *src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t *src_ptr_l_l = src_ptr_l + h*H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
+void fused_resize_bilinear_u8_to_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, const PreProcessInfo &info,
+                                      uint8_t *tabs, bool reuse_tabs) {
+    const ColorFormat colorFormat = info.getColorFormat();
+    const auto &srcDesc = inBlob->getTensorDesc();
+    auto srcDims = srcDesc.getDims();
+    auto dstDims = outBlob->getTensorDesc().getDims();
+    if (srcDims.size() != 4 || dstDims.size() != 4)
+        THROW_IE_EXCEPTION << "Pre-processing supports only 4D blobs";
+
+    const int batch = static_cast<int>(dstDims[0]);
+    const int channels = static_cast<int>(dstDims[1]);
+    const int dheight = static_cast<int>(dstDims[2]);
+    const int dwidth = static_cast<int>(dstDims[3]);
+    if (static_cast<int>(srcDims[0]) != batch)
+        THROW_IE_EXCEPTION << "The batch of the input blob " << srcDims[0] << " differs from the network input "
+                           << batch;
+
+    const auto strides = srcDesc.getBlockingDesc().getStrides();
+    const bool interleaved = srcDesc.getLayout() == NHWC;
+    const int strideN = static_cast<int>(strides[0]);
+    const int strideC = static_cast<int>(interleaved ? strides[3] : strides[1]);
+    const int strideH = static_cast<int>(interleaved ? strides[1] : strides[2]);
+    const int strideW = static_cast<int>(interleaved ? strides[2] : strides[3]);
+
+    int swidth = static_cast<int>(srcDims[3]);
+    int sheight = static_cast<int>(srcDims[2]);
+    if (colorFormat == NV12) {
+        if (srcDims[1] != 1 || srcDims[2] % 3 != 0 || srcDims[3] % 2 != 0 || interleaved)
+            THROW_IE_EXCEPTION << "The NV12 input should be the planar U8 blob {N, 1, H * 3 / 2, W} "
+                               << "with the even height and width";
+        sheight = sheight / 3 * 2;
+    } else if (colorFormat != RAW && srcDims[1] != 3) {
+        THROW_IE_EXCEPTION << "The input with the RGB or BGR color format should have 3 channels";
+    } else if (colorFormat == RAW && static_cast<int>(srcDims[1]) != channels) {
+        THROW_IE_EXCEPTION << "The number of the channels of the input blob " << srcDims[1]
+                           << " differs from the network input " << channels;
+    }
+    if (colorFormat != RAW && channels != 3)
+        THROW_IE_EXCEPTION << "The network input should have 3 channels for the color conversion";
+    if (info.getResizeAlgorithm() == NO_RESIZE && (sheight != dheight || swidth != dwidth))
+        THROW_IE_EXCEPTION << "The input blob size differs from the network input, but no resize algorithm is set";
+
+    // the mean of the output channel c for the pixel i of the plane
+    std::vector<float> meanValues(channels, 0.f);
+    std::vector<const float *> meanImages(channels, nullptr);
+    if (info.getMeanVariant() != NONE && info.getNumberOfChannels()) {
+        if (info.getNumberOfChannels() != static_cast<size_t>(channels))
+            THROW_IE_EXCEPTION << "channels mismatch between mean and input";
+        for (int c = 0; c < channels; c++) {
+            if (info.getMeanVariant() == MEAN_VALUE) {
+                meanValues[c] = info[c]->meanValue;
+            } else {
+                const Blob::Ptr &meanData = info[c]->meanData;
+                if (!meanData || meanData->precision() != Precision::FP32 ||
+                        meanData->size() != static_cast<size_t>(dheight * dwidth))
+                    THROW_IE_EXCEPTION << "mean image size does not match expected network input, expecting "
+                                       << dwidth << " x " << dheight;
+                meanImages[c] = meanData->cbuffer().as<const float *>();
+            }
+        }
+    }
+
+    auto *xofs0 = reinterpret_cast<int *>(tabs);
+    auto *xofs1 = xofs0 + dwidth;
+    auto *yofs0 = xofs1 + dwidth;
+    auto *yofs1 = yofs0 + dheight;
+    auto *alpha = reinterpret_cast<float *>(yofs1 + dheight);
+    auto *beta = alpha + dwidth;
+    if (!reuse_tabs) {
+        computeBilinearTab(swidth, dwidth, xofs0, xofs1, alpha);
+        computeBilinearTab(sheight, dheight, yofs0, yofs1, beta);
+    }
+
+    auto sptr = inBlob->cbuffer().as<const uint8_t *>() + srcDesc.getBlockingDesc().getOffsetPadding();
+    auto dptr = outBlob->buffer().as<float *>() + outBlob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    const int dplane = dheight * dwidth;
+
+    // the output channels are in the BGR order, so the RGB input is read in the reverse order
+    std::vector<int> srcChannelOffset(channels);
+    for (int c = 0; c < channels; c++)
+        srcChannelOffset[c] = (colorFormat == RGB ? channels - 1 - c : c) * strideC;
+
+    parallel_for2d(batch, dheight, [&](int n, int dy) {
+        const uint8_t *simage = sptr + n * strideN;
+        float *drow = dptr + n * channels * dplane + dy * dwidth;
+        const float b = beta[dy];
+
+        if (colorFormat == NV12) {
+            const uint8_t *yrow[2] = {simage + yofs0[dy] * strideH, simage + yofs1[dy] * strideH};
+            const uint8_t *uvrow[2] = {simage + (sheight + yofs0[dy] / 2) * strideH,
+                                       simage + (sheight + yofs1[dy] / 2) * strideH};
+            for (int dx = 0; dx < dwidth; dx++) {
+                const int sx[2] = {xofs0[dx], xofs1[dx]};
+                float bgr[2][2][3];
+                for (int i = 0; i < 2; i++) {
+                    for (int j = 0; j < 2; j++) {
+                        const uint8_t *uv = uvrow[i] + (sx[j] / 2) * 2;
+                        yuv2bgr(yrow[i][sx[j] * strideW], uv[0], uv[1], bgr[i][j]);
                     }
                 }
+                for (int c = 0; c < channels; c++) {
+                    float v = lerp(lerp(bgr[0][0][c], bgr[0][1][c], alpha[dx]),
+                                   lerp(bgr[1][0][c], bgr[1][1][c], alpha[dx]), b);
+                    float mean = meanImages[c] ? meanImages[c][dy * dwidth + dx] : meanValues[c];
+                    drow[c * dplane + dx] = v - mean;
+                }
             }
-        }
-    } else if (src->layout() == NCHW && dst->layout() == NHWC) {
-#       pragma omp parallel for collapse(2)
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t *src_ptr_l = src_ptr + n * N_src_stride + c * H * W;
-                data_t *dst_ptr_l = dst_ptr + n * _N_dst_stride + c;
-                for (int hw = 0; hw < H*W; hw++) {
-                    *dst_ptr_l = *src_ptr_l;
-                    dst_ptr_l += _W_dst_stride;
-                    src_ptr_l++;
+        } else {
+            const uint8_t *srow0 = simage + yofs0[dy] * strideH;
+            const uint8_t *srow1 = simage + yofs1[dy] * strideH;
+            for (int c = 0; c < channels; c++) {
+                const uint8_t *s0 = srow0 + srcChannelOffset[c];
+                const uint8_t *s1 = srow1 + srcChannelOffset[c];
+                float *dst = drow + c * dplane;
+                for (int dx = 0; dx < dwidth; dx++) {
+                    const int sx0 = xofs0[dx] * strideW;
+                    const int sx1 = xofs1[dx] * strideW;
+                    float v = lerp(lerp(s0[sx0], s0[sx1], alpha[dx]), lerp(s1[sx0], s1[sx1], alpha[dx]), b);
+                    float mean = meanImages[c] ? meanImages[c][dy * dwidth + dx] : meanValues[c];
+                    dst[dx] = v - mean;
                 }
             }
         }
-    } else {
-#       pragma omp parallel for
-        for (int i = 0; i < N*C*H*W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
-    }
+    });
 }
 
-static inline void parallel_blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
-    switch (src->precision()) {
-        case Precision::FP32:
-        case Precision::I32:
-            parallel_blob_copy_4d_t<Precision::FP32>(src, dst);
-            break;
-
-        case Precision::FP16:
-        case Precision::U16:
-        case Precision::I16:
-            parallel_blob_copy_4d_t<Precision::U16>(src, dst);
-            break;
+/**
+ * The view of the batch slot n of the blob: the blob of the batch 1 over the memory of the slot with the strides
+ * of the whole blob, so the resize writes the ROI right into its slot of the batched input.
+ */
+template <typename data_t>
+Blob::Ptr make_batch_slot_t(const Blob::Ptr &blob, size_t n) {
+    const TensorDesc &desc = blob->getTensorDesc();
+    const BlockingDesc &blk = desc.getBlockingDesc();
+    SizeVector dims = desc.getDims();
+    SizeVector blkDims = blk.getBlockDims();
+    SizeVector dimOffsets = blk.getOffsetPaddingToData();
+    dims[0] = 1;
+    blkDims[0] = 1;
+    dimOffsets.resize(blkDims.size(), 0);
+    BlockingDesc slotBlk(blkDims, blk.getOrder(), blk.getOffsetPadding() + n * blk.getStrides()[0],
+                         dimOffsets, blk.getStrides());
+    return make_shared_blob<data_t>(TensorDesc(desc.getPrecision(), dims, slotBlk),
+                                    blob->buffer().as<data_t *>());
+}
 
+Blob::Ptr make_batch_slot(const Blob::Ptr &blob, size_t n) {
+    if (blob->getTensorDesc().getDims().size() != 4 || blob->getTensorDesc().getBlockingDesc().getOrder()[0] != 0)
+        THROW_IE_EXCEPTION << "The batched ROIs are supported only for the 4D input with the outermost batch";
+    switch (blob->precision()) {
+        case Precision::FP32:
+            return make_batch_slot_t<float>(blob, n);
         case Precision::U8:
-        case Precision::I8:
-            parallel_blob_copy_4d_t<Precision::U8>(src, dst);
-            break;
-
+            return make_batch_slot_t<uint8_t>(blob, n);
         default:
-            THROW_IE_EXCEPTION << "Unsupported blob transformation for precision " << src->precision();
+            THROW_IE_EXCEPTION << "The batched ROIs are not supported for precision " << blob->precision();
     }
 }
 
-static void parallel_blob_copy(Blob::Ptr src, Blob::Ptr dst) {
-    if (src->buffer() == nullptr)
-        THROW_IE_EXCEPTION << "Cannot copy blob data. Source is not allocated.";
+}  // anonymous namespace
+
+void MKLDNNPreProcessData::setRoiBlob(const Blob::Ptr &blob) {
+    _roiBlobs = {blob};
+}
+
+void MKLDNNPreProcessData::setRoiBlobs(const std::vector<Blob::Ptr> &blobs) {
+    _roiBlobs = blobs;
+}
 
-    if (dst->buffer() == nullptr)
-        THROW_IE_EXCEPTION << "Cannot copy blob data. Destination is not allocated.";
+Blob::Ptr MKLDNNPreProcessData::getRoiBlob() const {
+    return _roiBlobs.empty() ? nullptr : _roiBlobs.front();
+}
+
+MKLDNNPreProcessData::ResizeBuffer &MKLDNNPreProcessData::getResizeBuffer(size_t n, const Blob::Ptr &inBlob,
+        const Blob::Ptr &outBlob, ResizeAlgorithm algorithm, ColorFormat colorFormat, int threads, bool &reuseTabs) {
+    ResizeBuffer &buffer = _resizeBuffers[n];
+    const TensorDesc &inDesc = inBlob->getTensorDesc();
+    const TensorDesc &outDesc = outBlob->getTensorDesc();
+    reuseTabs = !buffer.data.empty() && buffer.algorithm == algorithm && buffer.colorFormat == colorFormat &&
+                buffer.threads == threads &&
+                buffer.inPrecision == inDesc.getPrecision() && buffer.outPrecision == outDesc.getPrecision() &&
+                buffer.inDims == inDesc.getDims() && buffer.outDims == outDesc.getDims() &&
+                buffer.inStrides == inDesc.getBlockingDesc().getStrides() &&
+                buffer.outStrides == outDesc.getBlockingDesc().getStrides();
+    if (!reuseTabs) {
+        buffer.inDims = inDesc.getDims();
+        buffer.inStrides = inDesc.getBlockingDesc().getStrides();
+        buffer.outDims = outDesc.getDims();
+        buffer.outStrides = outDesc.getBlockingDesc().getStrides();
+        buffer.inPrecision = inDesc.getPrecision();
+        buffer.outPrecision = outDesc.getPrecision();
+        buffer.algorithm = algorithm;
+        buffer.colorFormat = colorFormat;
+        buffer.threads = threads;
+    }
+    return buffer;
+}
 
-    if (src->precision() != dst->precision())
-        THROW_IE_EXCEPTION << "Unimplemented blob transformation from precision "
-                           << src->precision() << " to " << src->precision();
+void MKLDNNPreProcessData::resizeRoi(size_t n, const Blob::Ptr &inBlob, const Blob::Ptr &outBlob,
+                                     ResizeAlgorithm algorithm, bool parallel) {
+    bool reuseTabs = false;
+    ResizeBuffer &buffer = getResizeBuffer(n, inBlob, outBlob, algorithm, RAW,
+                                           parallel ? parallel_get_max_threads() : 1, reuseTabs);
+    if (!reuseTabs)
+        buffer.data.resize(resize_get_buffer_size(inBlob, outBlob, algorithm, parallel));
+    resize(inBlob, outBlob, algorithm, parallel, buffer.data.data(), reuseTabs);
+}
 
-    if (src->dims() != dst->dims())
-        THROW_IE_EXCEPTION << "Unimplemented blob transformation from different shapes ";
+void MKLDNNPreProcessData::fusedResizeRoi(size_t n, const Blob::Ptr &outBlob, const PreProcessInfo &info) {
+    const Blob::Ptr &roiBlob = _roiBlobs[n];
+    bool reuseTabs = false;
+    ResizeBuffer &buffer = getResizeBuffer(n, roiBlob, outBlob, RESIZE_BILINEAR, info.getColorFormat(), 1, reuseTabs);
+    if (!reuseTabs)
+        buffer.data.resize(fused_get_tabs_size(outBlob));
+    fused_resize_bilinear_u8_to_fp32(roiBlob, outBlob, info, buffer.data.data(), reuseTabs);
+}
 
-    if (src->dims().size() == 4)
-        parallel_blob_copy_4d(src, dst);
-    else
-        THROW_IE_EXCEPTION << "Unimplemented blob transformation. Only 4d supported.";
+Blob::Ptr MKLDNNPreProcessData::getFusedBlob() const {
+    return _isFused ? _fusedBlob : nullptr;
 }
 
-void MKLDNNPreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm) {
+void MKLDNNPreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo &info) {
     IE_PROFILING_AUTO_SCOPE_TASK(perf_preprocessing)
 
-    if (algorithm == NO_RESIZE) {
+    const ResizeAlgorithm algorithm = info.getResizeAlgorithm();
+    if (algorithm == NO_RESIZE && info.getColorFormat() == RAW) {
         THROW_IE_EXCEPTION << "Input pre-processing is called without resize algorithm set";
     }
 
-    if (_roiBlob == nullptr) {
+    if (_roiBlobs.empty() || _roiBlobs.front() == nullptr) {
         THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
     }
 
+    if (_resizeBuffers.size() < _roiBlobs.size())
+        _resizeBuffers.resize(_roiBlobs.size());
+
+    if (_roiBlobs.size() > 1) {
+        executeBatched(outBlob, info);
+        return;
+    }
+
+    const Blob::Ptr &_roiBlob = _roiBlobs.front();
+
+    // the U8 image in the other color format or layout is converted by the single pass right to the FP32 input
+    const TensorDesc &roiDesc = _roiBlob->getTensorDesc();
+    _isFused = roiDesc.getPrecision() == Precision::U8 && algorithm != RESIZE_AREA &&
+               (info.getColorFormat() != RAW || roiDesc.getLayout() == NHWC);
+    if (_isFused) {
+        const SizeVector &dims = outBlob->getTensorDesc().getDims();
+        if (!_fusedBlob || _fusedBlob->getTensorDesc().getDims() != dims) {
+            _fusedBlob = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, NCHW));
+            _fusedBlob->allocate();
+        }
+        IE_PROFILING_AUTO_SCOPE_TASK(perf_resize)
+        fusedResizeRoi(0, _fusedBlob, info);
+        return;
+    }
+
+    if (info.getColorFormat() != RAW) {
+        THROW_IE_EXCEPTION << "Color conversion is supported only for the U8 input with the bilinear resize";
+    }
+
     Blob::Ptr res_in, res_out;
     if (_roiBlob->getTensorDesc().getLayout() == NHWC) {
         if (_roiBlob->getTensorDesc().getPrecision() == Precision::FP32) {
@@ -1627,7 +1780,7 @@ void MKLDNNPreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &al
 
         {
             IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_before)
-            parallel_blob_copy(_roiBlob, _tmp1);
+            blob_copy(_roiBlob, _tmp1);
         }
         res_in = _tmp1;
     } else {
@@ -1649,12 +1802,59 @@ void MKLDNNPreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &al
 
     {
         IE_PROFILING_AUTO_SCOPE_TASK(perf_resize)
-        resize(res_in, res_out, algorithm);
+        resizeRoi(0, res_in, res_out, algorithm, true);
     }
 
     if (res_out == _tmp2) {
         IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_after)
-        parallel_blob_copy(_tmp2, outBlob);
+        blob_copy(_tmp2, outBlob);
+    }
+}
+
+void MKLDNNPreProcessData::executeBatched(Blob::Ptr &outBlob, const PreProcessInfo &info) {
+    const ResizeAlgorithm algorithm = info.getResizeAlgorithm();
+    const size_t batch = outBlob->getTensorDesc().getDims()[0];
+    if (_roiBlobs.size() > batch)
+        THROW_IE_EXCEPTION << "The number of ROIs " << _roiBlobs.size() << " exceeds the batch " << batch;
+
+    // the ROIs are all U8 or all FP32 as the input, so either all of them go the fused way or none
+    const TensorDesc &roiDesc = _roiBlobs.front()->getTensorDesc();
+    _isFused = roiDesc.getPrecision() == Precision::U8 && algorithm != RESIZE_AREA &&
+               (info.getColorFormat() != RAW || roiDesc.getLayout() == NHWC);
+    if (_isFused) {
+        const SizeVector &dims = outBlob->getTensorDesc().getDims();
+        if (!_fusedBlob || _fusedBlob->getTensorDesc().getDims() != dims) {
+            _fusedBlob = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, NCHW));
+            _fusedBlob->allocate();
+        }
+        IE_PROFILING_AUTO_SCOPE_TASK(perf_resize)
+        // every ROI is converted by the parallel pass over its rows
+        for (size_t n = 0; n < _roiBlobs.size(); n++)
+            fusedResizeRoi(n, make_batch_slot(_fusedBlob, n), info);
+        return;
+    }
+
+    if (info.getColorFormat() != RAW) {
+        THROW_IE_EXCEPTION << "Color conversion is supported only for the U8 input with the bilinear resize";
+    }
+    if (outBlob->getTensorDesc().getLayout() != NCHW) {
+        THROW_IE_EXCEPTION << "The batched ROIs are supported only for the NCHW input";
+    }
+    for (const auto &roi : _roiBlobs) {
+        if (!roi || roi->getTensorDesc().getLayout() != NCHW || roi->precision() != roiDesc.getPrecision())
+            THROW_IE_EXCEPTION << "The batched ROIs should be the NCHW blobs of the same precision";
+    }
+
+    IE_PROFILING_AUTO_SCOPE_TASK(perf_resize)
+    const int rois = static_cast<int>(_roiBlobs.size());
+    if (rois >= parallel_get_max_threads()) {
+        // enough ROIs to load all the threads: every thread resizes the whole ROIs without the sync inside
+        parallel_for(rois, [&](int n) {
+            resizeRoi(n, _roiBlobs[n], make_batch_slot(outBlob, n), algorithm, false);
+        });
+    } else {
+        for (int n = 0; n < rois; n++)
+            resizeRoi(n, _roiBlobs[n], make_batch_slot(outBlob, n), algorithm, true);
     }
 }
 
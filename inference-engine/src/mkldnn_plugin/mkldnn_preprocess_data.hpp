@@ -5,8 +5,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "ie_blob.h"
 #include "ie_input_info.hpp"
@@ -19,17 +21,59 @@ namespace MKLDNNPlugin {
  */
 class MKLDNNPreProcessData {
     /**
-     * @brief ROI blob.
+     * @brief ROI blobs, the ROI i is placed to the batch slot i of the input.
      */
-    InferenceEngine::Blob::Ptr _roiBlob = nullptr;
+    std::vector<InferenceEngine::Blob::Ptr> _roiBlobs;
     InferenceEngine::Blob::Ptr _tmp1 = nullptr;
     InferenceEngine::Blob::Ptr _tmp2 = nullptr;
+    /**
+     * @brief The FP32 NCHW input written by the fused pre-processing.
+     */
+    InferenceEngine::Blob::Ptr _fusedBlob = nullptr;
+    bool _isFused = false;
+
+    /**
+     * @brief The coefficient tables and the scratch rows of the resize of a ROI. The tables depend only on the
+     * shapes, so they are computed again only when the ROI or the input changes its shape.
+     */
+    struct ResizeBuffer {
+        InferenceEngine::SizeVector inDims;
+        InferenceEngine::SizeVector inStrides;
+        InferenceEngine::SizeVector outDims;
+        InferenceEngine::SizeVector outStrides;
+        InferenceEngine::Precision inPrecision;
+        InferenceEngine::Precision outPrecision;
+        InferenceEngine::ResizeAlgorithm algorithm = InferenceEngine::NO_RESIZE;
+        InferenceEngine::ColorFormat colorFormat = InferenceEngine::RAW;
+        int threads = 0;
+        std::vector<uint8_t> data;
+    };
+    /**
+     * @brief The resize buffers of the ROIs, the buffer i is used only by the ROI i.
+     */
+    std::vector<ResizeBuffer> _resizeBuffers;
 
     InferenceEngine::ProfilingTask perf_resize {"Resize"};
     InferenceEngine::ProfilingTask perf_reorder_before {"Reorder before"};
     InferenceEngine::ProfilingTask perf_reorder_after {"Reorder after"};
     InferenceEngine::ProfilingTask perf_preprocessing {"Preprocessing"};
 
+    void executeBatched(InferenceEngine::Blob::Ptr &outBlob, const InferenceEngine::PreProcessInfo &info);
+
+    /**
+     * @brief Gets the resize buffer of the ROI n and tells whether its tables were computed for the same shapes,
+     * otherwise the buffer takes the new shapes and should be filled again.
+     */
+    ResizeBuffer &getResizeBuffer(size_t n, const InferenceEngine::Blob::Ptr &inBlob,
+                                  const InferenceEngine::Blob::Ptr &outBlob, InferenceEngine::ResizeAlgorithm algorithm,
+                                  InferenceEngine::ColorFormat colorFormat, int threads, bool &reuseTabs);
+
+    void resizeRoi(size_t n, const InferenceEngine::Blob::Ptr &inBlob, const InferenceEngine::Blob::Ptr &outBlob,
+                   InferenceEngine::ResizeAlgorithm algorithm, bool parallel);
+
+    void fusedResizeRoi(size_t n, const InferenceEngine::Blob::Ptr &outBlob,
+                        const InferenceEngine::PreProcessInfo &info);
+
 public:
     /**
      * @brief Sets ROI blob to be resized and placed to the default input blob during pre-processing.
@@ -38,17 +82,33 @@ public:
     void setRoiBlob(const InferenceEngine::Blob::Ptr &blob);
 
     /**
-     * @brief Gets pointer to the ROI blob used for a given input.
+     * @brief Sets ROI blobs of the batch 1 to be resized and placed to the first batch slots of the input blob.
+     * The other batch slots keep their data.
+     * @param blobs ROI blobs.
+     */
+    void setRoiBlobs(const std::vector<InferenceEngine::Blob::Ptr> &blobs);
+
+    /**
+     * @brief Gets pointer to the first ROI blob used for a given input.
      * @return Blob pointer.
      */
     InferenceEngine::Blob::Ptr getRoiBlob() const;
 
     /**
-     * @brief Executes input pre-processing with a given resize algorithm.
+     * @brief Executes input pre-processing with a given resize algorithm and color format.
+     * The U8 ROI blob in the other color format or in the NHWC layout is converted to BGR, resized, converted
+     * to FP32 NCHW and the mean is subtracted by a single pass, the result is returned by getFusedBlob()
+     * instead of outBlob.
      * @param outBlob pre-processed output blob to be used for inference.
-     * @param algorithm resize algorithm.
+     * @param info pre-process information of the input.
+     */
+    void execute(InferenceEngine::Blob::Ptr &outBlob, const InferenceEngine::PreProcessInfo &info);
+
+    /**
+     * @brief Gets the result of the fused pre-processing done by the last execute().
+     * @return FP32 blob with the mean subtracted or nullptr if the result was written to the output blob.
      */
-    void execute(InferenceEngine::Blob::Ptr &outBlob, const InferenceEngine::ResizeAlgorithm &algorithm);
+    InferenceEngine::Blob::Ptr getFusedBlob() const;
 };
 
 }  // namespace MKLDNNPlugin
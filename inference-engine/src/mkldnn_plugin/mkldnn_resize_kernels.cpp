@@ -0,0 +1,248 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_resize_kernels.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include "jit_generator.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl::cpu;
+using namespace Xbyak;
+
+namespace {
+
+struct jit_resize_row_call_args {
+    const void *src0;
+    const void *src1;
+    void *dst;
+    // the number of the elements of the row, the multiple of the vector length
+    size_t work_amount;
+    // the weight in Q16 is followed by the FP32 one, so the broadcast of the low dword reads inside the struct
+    uint32_t beta_q16;
+    float beta;
+};
+
+#define GET_OFF(field) offsetof(jit_resize_row_call_args, field)
+
+enum class resize_row_kind {
+    lerp_f32,
+    accumulate_f32,
+    accumulate_u8
+};
+
+struct jit_resize_row_kernel : public jit_generator {
+    jit_resize_row_kernel(): jit_generator(nullptr, 4096) {}
+
+    void (*ker_)(const jit_resize_row_call_args *) = nullptr;
+    size_t simd_w = 1;
+    std::string isa_name;
+};
+
+template <cpu_isa_t isa>
+struct jit_resize_row_kernel_impl : public jit_resize_row_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_resize_row_kernel_impl)
+
+    explicit jit_resize_row_kernel_impl(resize_row_kind kind) {
+        simd_w = kind == resize_row_kind::accumulate_u8 ? vlen / sizeof(uint16_t) : vlen / sizeof(float);
+        isa_name = isa == sse42 ? "sse42" : isa == avx2 ? "avx2" : "avx512";
+
+        preamble();
+
+        mov(reg_src0, ptr[param1 + GET_OFF(src0)]);
+        mov(reg_src1, ptr[param1 + GET_OFF(src1)]);
+        mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[param1 + GET_OFF(work_amount)]);
+        if (kind == resize_row_kind::accumulate_u8)
+            uni_vpbroadcastd(vmm_beta, ptr[param1 + GET_OFF(beta_q16)]);
+        else
+            uni_vbroadcastss(vmm_beta, ptr[param1 + GET_OFF(beta)]);
+
+        Label l_loop, l_exit;
+        L(l_loop);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(l_exit, T_NEAR);
+
+            switch (kind) {
+            case resize_row_kind::lerp_f32: lerp_f32(); break;
+            case resize_row_kind::accumulate_f32: accumulate_f32(); break;
+            case resize_row_kind::accumulate_u8: accumulate_u8(); break;
+            }
+
+            sub(reg_work_amount, simd_w);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_exit);
+
+        postamble();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse42, Xmm, isa == avx2, Ymm, Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Reg64 reg_src0 = r8;
+    Reg64 reg_src1 = r9;
+    Reg64 reg_dst = r10;
+    Reg64 reg_work_amount = r11;
+
+    Vmm vmm_beta = Vmm(0);
+    Vmm vmm_val0 = Vmm(1);
+    Vmm vmm_val1 = Vmm(2);
+
+    // dst = src0 + beta * (src1 - src0)
+    void lerp_f32() {
+        uni_vmovups(vmm_val0, ptr[reg_src0]);
+        uni_vmovups(vmm_val1, ptr[reg_src1]);
+        uni_vsubps(vmm_val1, vmm_val1, vmm_val0);
+        uni_vfmadd231ps(vmm_val0, vmm_val1, vmm_beta);
+        uni_vmovups(ptr[reg_dst], vmm_val0);
+
+        add(reg_src0, vlen);
+        add(reg_src1, vlen);
+        add(reg_dst, vlen);
+    }
+
+    // dst += beta * src0
+    void accumulate_f32() {
+        uni_vmovups(vmm_val0, ptr[reg_dst]);
+        uni_vmovups(vmm_val1, ptr[reg_src0]);
+        uni_vfmadd231ps(vmm_val0, vmm_val1, vmm_beta);
+        uni_vmovups(ptr[reg_dst], vmm_val0);
+
+        add(reg_src0, vlen);
+        add(reg_dst, vlen);
+    }
+
+    // dst += mulhi(beta, src0 << 8) for the unsigned words, the bytes of the source are extended to the words
+    void accumulate_u8() {
+        if (isa == sse42) {
+            pmovzxbw(vmm_val1, ptr[reg_src0]);
+            psllw(vmm_val1, 8);
+            pmulhuw(vmm_val1, vmm_beta);
+            movdqu(vmm_val0, ptr[reg_dst]);
+            paddw(vmm_val0, vmm_val1);
+            movdqu(ptr[reg_dst], vmm_val0);
+        } else {
+            vpmovzxbw(vmm_val1, ptr[reg_src0]);
+            vpsllw(vmm_val1, vmm_val1, 8);
+            vpmulhuw(vmm_val1, vmm_val1, vmm_beta);
+            vpaddw(vmm_val1, vmm_val1, ptr[reg_dst]);
+            uni_vmovups(ptr[reg_dst], vmm_val1);
+        }
+
+        add(reg_src0, vlen / sizeof(uint16_t));
+        add(reg_dst, vlen);
+    }
+};
+
+jit_resize_row_kernel *create_f32_kernel(resize_row_kind kind) {
+    if (mayiuse(avx512_common))
+        return new jit_resize_row_kernel_impl<avx512_common>(kind);
+    if (mayiuse(avx2))
+        return new jit_resize_row_kernel_impl<avx2>(kind);
+    if (mayiuse(sse42))
+        return new jit_resize_row_kernel_impl<sse42>(kind);
+    return nullptr;
+}
+
+jit_resize_row_kernel *create_u8_kernel() {
+    // the words in the 512-bit registers need AVX512BW
+    if (mayiuse(avx512_core))
+        return new jit_resize_row_kernel_impl<avx512_core>(resize_row_kind::accumulate_u8);
+    if (mayiuse(avx2))
+        return new jit_resize_row_kernel_impl<avx2>(resize_row_kind::accumulate_u8);
+    if (mayiuse(sse42))
+        return new jit_resize_row_kernel_impl<sse42>(resize_row_kind::accumulate_u8);
+    return nullptr;
+}
+
+size_t vectorized(const jit_resize_row_kernel *jit, size_t width) {
+    return jit ? width / jit->simd_w * jit->simd_w : 0;
+}
+
+}  // namespace
+
+struct MKLDNNResizeKernels::Kernels {
+    std::unique_ptr<jit_resize_row_kernel> lerp;
+    std::unique_ptr<jit_resize_row_kernel> accumulate;
+    std::unique_ptr<jit_resize_row_kernel> accumulateQ16;
+};
+
+MKLDNNResizeKernels::MKLDNNResizeKernels(): kernels(new Kernels()) {
+    kernels->lerp.reset(create_f32_kernel(resize_row_kind::lerp_f32));
+    kernels->accumulate.reset(create_f32_kernel(resize_row_kind::accumulate_f32));
+    kernels->accumulateQ16.reset(create_u8_kernel());
+}
+
+MKLDNNResizeKernels::~MKLDNNResizeKernels() = default;
+
+const MKLDNNResizeKernels &MKLDNNResizeKernels::get() {
+    static const MKLDNNResizeKernels instance;
+    return instance;
+}
+
+std::string MKLDNNResizeKernels::getIsaName() const {
+    return kernels->lerp ? kernels->lerp->isa_name : "ref";
+}
+
+void MKLDNNResizeKernels::lerp(const float *src0, const float *src1, float beta, float *dst, size_t width) const {
+    const jit_resize_row_kernel *jit = kernels->lerp.get();
+    const size_t simd_width = vectorized(jit, width);
+    if (simd_width) {
+        jit_resize_row_call_args args;
+        args.src0 = src0;
+        args.src1 = src1;
+        args.dst = dst;
+        args.work_amount = simd_width;
+        args.beta_q16 = 0;
+        args.beta = beta;
+        jit->ker_(&args);
+    }
+
+    for (size_t x = simd_width; x < width; x++)
+        dst[x] = src0[x] + beta * (src1[x] - src0[x]);
+}
+
+void MKLDNNResizeKernels::accumulate(const float *src, float beta, float *acc, size_t width) const {
+    const jit_resize_row_kernel *jit = kernels->accumulate.get();
+    const size_t simd_width = vectorized(jit, width);
+    if (simd_width) {
+        jit_resize_row_call_args args;
+        args.src0 = src;
+        args.src1 = nullptr;
+        args.dst = acc;
+        args.work_amount = simd_width;
+        args.beta_q16 = 0;
+        args.beta = beta;
+        jit->ker_(&args);
+    }
+
+    for (size_t x = simd_width; x < width; x++)
+        acc[x] += beta * src[x];
+}
+
+void MKLDNNResizeKernels::accumulateQ16(const uint8_t *src, uint16_t beta, uint16_t *acc, size_t width) const {
+    const jit_resize_row_kernel *jit = kernels->accumulateQ16.get();
+    const size_t simd_width = vectorized(jit, width);
+    if (simd_width) {
+        jit_resize_row_call_args args;
+        args.src0 = src;
+        args.src1 = nullptr;
+        args.dst = acc;
+        args.work_amount = simd_width;
+        // the weight is repeated in both words of the dword
+        args.beta_q16 = (static_cast<uint32_t>(beta) << 16) | beta;
+        args.beta = 0.0f;
+        jit->ker_(&args);
+    }
+
+    for (size_t x = simd_width; x < width; x++)
+        acc[x] += static_cast<uint16_t>((static_cast<uint32_t>(beta) * static_cast<uint32_t>(src[x] << 8)) >> 16);
+}
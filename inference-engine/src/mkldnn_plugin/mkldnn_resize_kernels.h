@@ -0,0 +1,58 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The row kernels of the vertical passes of the resize in the pre-processing. The kernels are generated
+ * once for the best ISA of the machine (AVX-512, AVX2 or SSE4.2), so the same binary uses the wide vectors
+ * where they are available. The elements which do not fill the vector are computed by the scalar code
+ * with the same arithmetic.
+ */
+class MKLDNNResizeKernels {
+public:
+    /**
+     * @brief The kernels for the ISA of the current machine
+     */
+    static const MKLDNNResizeKernels &get();
+
+    ~MKLDNNResizeKernels();
+
+    /**
+     * @brief Computes dst[x] = src0[x] + beta * (src1[x] - src0[x]) for the interpolation of two rows
+     */
+    void lerp(const float *src0, const float *src1, float beta, float *dst, size_t width) const;
+
+    /**
+     * @brief Computes acc[x] += beta * src[x] for the weighted sum of the rows
+     */
+    void accumulate(const float *src, float beta, float *acc, size_t width) const;
+
+    /**
+     * @brief Computes acc[x] += (beta * (src[x] << 8)) >> 16 for the weighted sum of the rows in Q16
+     */
+    void accumulateQ16(const uint8_t *src, uint16_t beta, uint16_t *acc, size_t width) const;
+
+    /**
+     * @brief The name of the ISA of the compiled FP32 kernels or "ref"
+     */
+    std::string getIsaName() const;
+
+private:
+    MKLDNNResizeKernels();
+
+    struct Kernels;
+
+    std::shared_ptr<Kernels> kernels;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,169 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <details/ie_exception.hpp>
+#include "mkldnn_scheduler.h"
+#include "mkldnn_graph.h"
+#include "mkldnn/omp_manager.h"
+#include <omp.h>
+#include "ie_parallel.hpp"
+
+using namespace InferenceEngine;
+using namespace ::MKLDNNPlugin::cpu;
+
+namespace MKLDNNPlugin {
+
+MKLDNNScheduler::Executor::Executor(const MKLDNNScheduler::Ptr &scheduler, int priority, int weight)
+        : _scheduler(scheduler), _priority(priority), _weight(weight) {
+    if (weight < 1)
+        THROW_IE_EXCEPTION << "The weight of the network on the scheduler must be positive, got " << weight;
+    std::lock_guard<std::mutex> lock(_scheduler->_mutex);
+    _scheduler->_executors.push_back(this);
+}
+
+MKLDNNScheduler::Executor::~Executor() {
+    std::unique_lock<std::mutex> lock(_scheduler->_mutex);
+    _queue.clear();
+    _scheduler->_condVar.wait(lock, [this] { return _running == 0; });
+    _scheduler->_executors.remove(this);
+}
+
+bool MKLDNNScheduler::Executor::startTask(Task::Ptr task) {
+    if (!task->occupy()) return false;
+    std::lock_guard<std::mutex> lock(_scheduler->_mutex);
+    // the network idle for a while doesn't take the groups from the others to make up for it
+    if (_queue.empty() && _running == 0)
+        _virtualTime = std::max(_virtualTime, _scheduler->_virtualTime);
+    _queue.push_back(task);
+    _scheduler->_condVar.notify_all();
+    return true;
+}
+
+void MKLDNNScheduler::Executor::setContexts(const std::vector<MultiWorkerTaskContext> &contexts) {
+    std::lock_guard<std::mutex> lock(_scheduler->_mutex);
+    if (_running != 0)
+        THROW_IE_EXCEPTION << "The contexts of the network are set while its tasks are running";
+    _contexts = contexts;
+    _busyContexts.assign(contexts.size(), false);
+    _scheduler->_condVar.notify_all();
+}
+
+MKLDNNScheduler::Ptr MKLDNNScheduler::getInstance(int groups, bool bindThreads) {
+    static std::mutex instanceMutex;
+    static std::weak_ptr<MKLDNNScheduler> instance;
+
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    Ptr scheduler = instance.lock();
+    if (!scheduler) {
+        scheduler = std::make_shared<MKLDNNScheduler>(groups, bindThreads);
+        instance = scheduler;
+    } else if (scheduler->getGroupsNumber() != groups || scheduler->_bindThreads != bindThreads) {
+        THROW_IE_EXCEPTION << "The CPU scheduler of the process is already running with "
+                           << scheduler->getGroupsNumber() << " groups of threads" << (scheduler->_bindThreads ? " bound to the cores" : "")
+                           << ", cannot use it with " << groups << " groups"
+                           << (bindThreads ? " bound to the cores" : "");
+    }
+    return scheduler;
+}
+
+MKLDNNScheduler::MKLDNNScheduler(int groups, bool bindThreads) : _bindThreads(bindThreads) {
+    if (groups < 1)
+        THROW_IE_EXCEPTION << "The scheduler needs at least one group of threads, got " << groups;
+    const int cores = OpenMpManager::getOpenMpThreadNumber();
+    _threadsPerGroup = std::max(1, cores / groups);
+    for (int group = 0; group < groups; group++)
+        _groups.emplace_back([this, group, bindThreads] { runGroup(group, bindThreads); });
+}
+
+MKLDNNScheduler::~MKLDNNScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopped = true;
+        _condVar.notify_all();
+    }
+    for (auto &group : _groups) {
+        if (group.joinable())
+            group.join();
+    }
+}
+
+MKLDNNScheduler::Executor::Ptr MKLDNNScheduler::createExecutor(int priority, int weight) {
+    return std::make_shared<Executor>(shared_from_this(), priority, weight);
+}
+
+MKLDNNScheduler::Executor *MKLDNNScheduler::selectExecutor() {
+    Executor *selected = nullptr;
+    for (auto executor : _executors) {
+        const size_t slots = std::max<size_t>(1, executor->_contexts.size());
+        if (executor->_queue.empty() || executor->_running >= slots)
+            continue;
+        if (!selected || executor->_priority > selected->_priority ||
+                (executor->_priority == selected->_priority && executor->_virtualTime < selected->_virtualTime))
+            selected = executor;
+    }
+    return selected;
+}
+
+void MKLDNNScheduler::runGroup(int group, bool bindThreads) {
+#if !(defined(__APPLE__) || defined(_WIN32))
+    const int cores = OpenMpManager::getOpenMpThreadNumber();
+    if (bindThreads && (group + 1) * _threadsPerGroup <= cores)
+        OpenMpManager::bindOpenMpThreadsToCores(group * _threadsPerGroup, _threadsPerGroup);
+    else
+        omp_set_num_threads(_threadsPerGroup);
+#else
+    omp_set_num_threads(_threadsPerGroup);
+#endif
+#if IE_THREAD == IE_THREAD_TBB
+    tbb::task_arena arena(_threadsPerGroup);
+#endif
+
+    while (true) {
+        Executor *executor = nullptr;
+        Task::Ptr task;
+        size_t context = 0;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condVar.wait(lock, [&] { return (executor = selectExecutor()) != nullptr || _isStopped; });
+            // the scheduler is stopped after the last executor, so there are no tasks left
+            if (!executor)
+                break;
+            task = executor->_queue.front();
+            executor->_queue.pop_front();
+            if (!executor->_contexts.empty()) {
+                context = std::find(executor->_busyContexts.begin(), executor->_busyContexts.end(), false) -
+                          executor->_busyContexts.begin();
+                executor->_busyContexts[context] = true;
+                MultiWorkerTaskExecutor::ptrContext = executor->_contexts[context];
+            }
+            executor->_running++;
+            _virtualTime = executor->_virtualTime;
+            executor->_virtualTime += 1.0 / executor->_weight;
+        }
+
+#if IE_THREAD == IE_THREAD_TBB
+        arena.execute([&task] { task->runNoThrowNoBusyCheck(); });
+#else
+        task->runNoThrowNoBusyCheck();
+#endif
+        // the graph of the context is not held by the group after the task
+        MultiWorkerTaskExecutor::ptrContext.ptrGraph.reset();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!executor->_contexts.empty())
+                executor->_busyContexts[context] = false;
+            executor->_running--;
+            _condVar.notify_all();
+        }
+        // the executor may be released once the task is done, so it is not touched from now on
+        task.reset();
+    }
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,126 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cpp_interfaces/ie_itask_executor.hpp>
+#include "mkldnn_streams.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The CPU scheduler shared by the executable networks of the process (see KEY_CPU_SCHEDULER_GROUPS).
+ * It owns the cores split into the groups of threads, every group is a worker thread with its own OpenMP team
+ * bound to the cores of the group. The networks put their tasks to the scheduler by their executors, and the idle
+ * group runs the task of the network with the highest priority, the networks of the same priority share the groups
+ * in the proportion of their weights. So the models loaded in the same process don't oversubscribe the cores
+ * with their own teams and the latency of the high priority models does not depend on the load of the others.
+ * @note The task is run to its end, the priority orders the tasks waiting for the groups only.
+ */
+class MKLDNNScheduler : public std::enable_shared_from_this<MKLDNNScheduler> {
+public:
+    typedef std::shared_ptr<MKLDNNScheduler> Ptr;
+
+    /**
+     * @brief The executor of a network, the tasks of the network are run by the groups of the scheduler.
+     * Without the contexts the tasks run one by one, as the network has the single graph. With the contexts
+     * (the graphs of the network) as many tasks run at the same time, each task is run with its own context
+     * set to MultiWorkerTaskExecutor::ptrContext, as it's done by the streams.
+     */
+    class Executor : public InferenceEngine::ITaskExecutor {
+    public:
+        typedef std::shared_ptr<Executor> Ptr;
+
+        Executor(const MKLDNNScheduler::Ptr &scheduler, int priority, int weight);
+
+        /**
+         * @brief The queued tasks are dropped, the running ones are waited for
+         */
+        ~Executor();
+
+        bool startTask(InferenceEngine::Task::Ptr task) override;
+
+        /**
+         * @brief Sets the contexts of the tasks started from now on, the number of them limits the tasks run
+         * at the same time
+         */
+        void setContexts(const std::vector<MultiWorkerTaskContext> &contexts);
+
+        int getPriority() const {
+            return _priority;
+        }
+
+        int getWeight() const {
+            return _weight;
+        }
+
+    private:
+        friend class MKLDNNScheduler;
+
+        MKLDNNScheduler::Ptr _scheduler;
+        const int _priority;
+        const int _weight;
+        // the state below is guarded by the mutex of the scheduler
+        std::deque<InferenceEngine::Task::Ptr> _queue;
+        std::vector<MultiWorkerTaskContext> _contexts;
+        std::vector<bool> _busyContexts;
+        size_t _running = 0;
+        // the groups taken by the network weighted by its share, the least one goes first among the same priority
+        double _virtualTime = 0.0;
+    };
+
+    /**
+     * @brief Returns the scheduler of the process, it is created by the first call with the given groups and shared
+     * by the later calls with the same arguments, the other ones throw while it is alive. The scheduler is released
+     * with the last of its executors.
+     * @param groups - the number of the groups of threads the cores are split into
+     * @param bindThreads - the threads of a group are bound to its cores (Linux only)
+     */
+    static Ptr getInstance(int groups, bool bindThreads);
+
+    MKLDNNScheduler(int groups, bool bindThreads);
+
+    ~MKLDNNScheduler();
+
+    /**
+     * @brief Creates the executor of a network
+     * @param priority - the tasks of the higher priority are run first
+     * @param weight - the share of the groups (a positive number) the network gets among the networks of its priority
+     */
+    Executor::Ptr createExecutor(int priority, int weight);
+
+    int getGroupsNumber() const {
+        return static_cast<int>(_groups.size());
+    }
+
+    int getThreadsPerGroup() const {
+        return _threadsPerGroup;
+    }
+
+private:
+    void runGroup(int group, bool bindThreads);
+
+    // the executor with the task to run next, nullptr if there is no such one
+    Executor *selectExecutor();
+
+    std::vector<std::thread> _groups;
+    int _threadsPerGroup;
+    bool _bindThreads;
+    std::mutex _mutex;
+    std::condition_variable _condVar;
+    std::list<Executor *> _executors;
+    // the virtual time of the last started task, the networks which have been idle restart from it
+    double _virtualTime = 0.0;
+    bool _isStopped = false;
+};
+
+}  // namespace MKLDNNPlugin
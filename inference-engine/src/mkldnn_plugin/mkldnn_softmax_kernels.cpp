@@ -0,0 +1,482 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_softmax_kernels.h"
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include "jit_generator.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace Xbyak;
+
+namespace {
+
+// the number of the inner elements processed by one task of the softmax over the outer axes
+const size_t columnsBlock = 64;
+
+struct jit_softmax_call_args {
+    const float *src;
+    float *dst;
+    // the number of the elements of the row or of the columns, the multiple of the vector length
+    size_t work_amount;
+    size_t channels;
+    // the distance between the channels of the columns in bytes
+    size_t stride;
+    // the maximum subtracted before exp or the scale of the row
+    float value;
+    // the maximum or the sum of exp of the row
+    float result;
+};
+
+#define GET_OFF(field) offsetof(jit_softmax_call_args, field)
+
+enum class softmax_kind {
+    // result = max(src)
+    row_max,
+    // dst = exp(src - value), result = sum(dst)
+    row_exp,
+    // dst = src * value
+    row_scale,
+    // the whole softmax of the columns along the channels
+    columns
+};
+
+struct jit_softmax_kernel : public jit_generator {
+    jit_softmax_kernel(): jit_generator(nullptr, 4096) {}
+
+    void (*ker_)(jit_softmax_call_args *) = nullptr;
+    size_t simd_w = 1;
+    std::string isa_name;
+};
+
+template <cpu_isa_t isa>
+struct jit_softmax_kernel_f32 : public jit_softmax_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_softmax_kernel_f32)
+
+    explicit jit_softmax_kernel_f32(softmax_kind kind) {
+        simd_w = vlen / sizeof(float);
+        isa_name = isa == sse42 ? "sse42" : isa == avx2 ? "avx2" : "avx512";
+
+        preamble();
+
+        mov(reg_src, ptr[param1 + GET_OFF(src)]);
+        mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[param1 + GET_OFF(work_amount)]);
+        mov(reg_table, l_table);
+
+        switch (kind) {
+            case softmax_kind::row_max: row_max(); break;
+            case softmax_kind::row_exp: row_exp(); break;
+            case softmax_kind::row_scale: row_scale(); break;
+            case softmax_kind::columns: columns(); break;
+        }
+
+        postamble();
+
+        // every constant is repeated for the whole vector, so the operations take it from the memory
+        const uint32_t constants[] = {
+                0x3f800000,  // one
+                0x3f000000,  // 0.5f
+                0x3fb8aa3b,  // log2(e)
+                0x3f317218,  // ln(2)
+                0x0000007f,  // the bias of the exponent
+                0x3f800001,  // p0 = 1.0000001f
+                0x3efffe85,  // p2 = 0.4999887f
+                0x3e2aaa3e,  // p3 = 0.16666505f
+                0x3d2bb1b1,  // p4 = 0.041917507f
+                0x3c091ec1,  // p5 = 0.008369149f
+                0x42aeac50,  // the largest argument 87.3365402f
+                0xc2aeac50   // the smallest argument -87.3365402f, the result stays a normal number
+        };
+        align(64);
+        L(l_table);
+        for (uint32_t value : constants) {
+            for (size_t i = 0; i < simd_w; i++)
+                dd(value);
+        }
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse42, Xmm, isa == avx2, Ymm, Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    enum {
+        c_one, c_half, c_log2e, c_ln2, c_exp_bias, c_p0, c_p2, c_p3, c_p4, c_p5, c_exp_hi, c_exp_lo
+    };
+
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_work_amount = r10;
+    Reg64 reg_table = r11;
+    Reg64 reg_channels = r12;
+    Reg64 reg_stride = r13;
+    Reg64 reg_src_ch = r14;
+    Reg64 reg_dst_ch = r15;
+    Reg64 reg_count = rax;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_aux0 = Vmm(1);
+    Vmm vmm_aux1 = Vmm(2);
+    Vmm vmm_aux2 = Vmm(3);
+    Vmm vmm_max = Vmm(4);
+    Vmm vmm_sum = Vmm(5);
+    Vmm vmm_reduce = Vmm(6);
+
+    Label l_table;
+
+    Address table(int index) {
+        return ptr[reg_table + index * vlen];
+    }
+
+    void row_max() {
+        uni_vmovups(vmm_max, ptr[reg_src]);
+        add(reg_src, vlen);
+        sub(reg_work_amount, simd_w);
+
+        Label l_loop, l_exit;
+        L(l_loop);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(l_exit, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_src]);
+            uni_vmaxps(vmm_max, vmm_max, vmm_val);
+
+            add(reg_src, vlen);
+            sub(reg_work_amount, simd_w);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_exit);
+
+        horizontal(vmm_max, true);
+        store_result(vmm_max);
+    }
+
+    void row_exp() {
+        uni_vbroadcastss(vmm_max, ptr[param1 + GET_OFF(value)]);
+        uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+
+        Label l_loop, l_exit;
+        L(l_loop);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(l_exit, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_src]);
+            uni_vsubps(vmm_val, vmm_val, vmm_max);
+            simd_exp(vmm_val);
+            uni_vmovups(ptr[reg_dst], vmm_val);
+            uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+
+            add(reg_src, vlen);
+            add(reg_dst, vlen);
+            sub(reg_work_amount, simd_w);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_exit);
+
+        horizontal(vmm_sum, false);
+        store_result(vmm_sum);
+    }
+
+    void row_scale() {
+        uni_vbroadcastss(vmm_max, ptr[param1 + GET_OFF(value)]);
+
+        Label l_loop, l_exit;
+        L(l_loop);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(l_exit, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_src]);
+            uni_vmulps(vmm_val, vmm_val, vmm_max);
+            uni_vmovups(ptr[reg_dst], vmm_val);
+
+            add(reg_src, vlen);
+            add(reg_dst, vlen);
+            sub(reg_work_amount, simd_w);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_exit);
+    }
+
+    // one vector of the columns passes the channels three times: for the maximum, for exp and for the scale
+    void columns() {
+        mov(reg_channels, ptr[param1 + GET_OFF(channels)]);
+        mov(reg_stride, ptr[param1 + GET_OFF(stride)]);
+
+        Label l_columns, l_exit;
+        L(l_columns);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(l_exit, T_NEAR);
+
+            uni_vmovups(vmm_max, ptr[reg_src]);
+            mov(reg_src_ch, reg_src);
+            channels_loop([&]() {
+                uni_vmovups(vmm_val, ptr[reg_src_ch]);
+                uni_vmaxps(vmm_max, vmm_max, vmm_val);
+            });
+
+            uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+            mov(reg_src_ch, reg_src);
+            mov(reg_dst_ch, reg_dst);
+            channels_loop([&]() {
+                uni_vmovups(vmm_val, ptr[reg_src_ch]);
+                uni_vsubps(vmm_val, vmm_val, vmm_max);
+                simd_exp(vmm_val);
+                uni_vmovups(ptr[reg_dst_ch], vmm_val);
+                uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            });
+
+            uni_vmovups(vmm_max, table(c_one));
+            uni_vdivps(vmm_max, vmm_max, vmm_sum);
+            mov(reg_src_ch, reg_dst);
+            mov(reg_dst_ch, reg_dst);
+            channels_loop([&]() {
+                uni_vmovups(vmm_val, ptr[reg_src_ch]);
+                uni_vmulps(vmm_val, vmm_val, vmm_max);
+                uni_vmovups(ptr[reg_dst_ch], vmm_val);
+            });
+
+            add(reg_src, vlen);
+            add(reg_dst, vlen);
+            sub(reg_work_amount, simd_w);
+            jmp(l_columns, T_NEAR);
+        }
+        L(l_exit);
+    }
+
+    // calls the body for every channel, the body accesses the channel by reg_src_ch and reg_dst_ch
+    template <typename F>
+    void channels_loop(const F &body) {
+        mov(reg_count, reg_channels);
+
+        Label l_loop, l_exit;
+        L(l_loop);
+        {
+            cmp(reg_count, 0);
+            je(l_exit, T_NEAR);
+
+            body();
+
+            add(reg_src_ch, reg_stride);
+            add(reg_dst_ch, reg_stride);
+            sub(reg_count, 1);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_exit);
+    }
+
+    // exp(x) = 2^n * exp(r), where n = floor(x * log2(e) + 0.5) and r = x - n * ln(2) is in [-ln(2) / 2, ln(2) / 2]
+    void simd_exp(const Vmm &vmm_src) {
+        uni_vminps(vmm_src, vmm_src, table(c_exp_hi));
+        uni_vmaxps(vmm_src, vmm_src, table(c_exp_lo));
+        uni_vmovups(vmm_aux0, vmm_src);
+
+        uni_vmulps(vmm_src, vmm_src, table(c_log2e));
+        uni_vaddps(vmm_src, vmm_src, table(c_half));
+        if (isa == avx512_common)
+            vrndscaleps(vmm_aux1, vmm_src, 0x1);
+        else
+            uni_vroundps(vmm_aux1, vmm_src, 0x1);
+
+        // 2^n is built in the exponent bits
+        uni_vcvtps2dq(vmm_aux2, vmm_aux1);
+        uni_vpaddd(vmm_aux2, vmm_aux2, table(c_exp_bias));
+        uni_vpslld(vmm_aux2, vmm_aux2, 23);
+
+        uni_vfnmadd231ps(vmm_aux0, vmm_aux1, table(c_ln2));
+        uni_vmovups(vmm_src, table(c_p5));
+        uni_vfmadd213ps(vmm_src, vmm_aux0, table(c_p4));
+        uni_vfmadd213ps(vmm_src, vmm_aux0, table(c_p3));
+        uni_vfmadd213ps(vmm_src, vmm_aux0, table(c_p2));
+        uni_vfmadd213ps(vmm_src, vmm_aux0, table(c_one));
+        uni_vfmadd213ps(vmm_src, vmm_aux0, table(c_p0));
+        uni_vmulps(vmm_src, vmm_src, vmm_aux2);
+    }
+
+    // the maximum or the sum of the elements of the vector to its lowest element
+    void horizontal(const Vmm &vmm, bool max) {
+        const int idx = vmm.getIdx();
+        const int aux = vmm_reduce.getIdx();
+        if (isa == avx512_common) {
+            vextractf64x4(Ymm(aux), Zmm(idx), 1);
+            reduce_op(Ymm(idx), Ymm(aux), max);
+        }
+        if (isa != sse42) {
+            vextractf128(Xmm(aux), Ymm(idx), 1);
+            reduce_op(Xmm(idx), Xmm(aux), max);
+            vmovhlps(Xmm(aux), Xmm(aux), Xmm(idx));
+            reduce_op(Xmm(idx), Xmm(aux), max);
+            vpshufd(Xmm(aux), Xmm(idx), 0x1);
+        } else {
+            movhlps(Xmm(aux), Xmm(idx));
+            reduce_op(Xmm(idx), Xmm(aux), max);
+            pshufd(Xmm(aux), Xmm(idx), 0x1);
+        }
+        reduce_op(Xmm(idx), Xmm(aux), max);
+    }
+
+    void reduce_op(const Xmm &x, const Xmm &aux, bool max) {
+        if (isa == sse42) {
+            if (max)
+                maxps(x, aux);
+            else
+                addps(x, aux);
+        } else {
+            if (max)
+                vmaxps(x, x, aux);
+            else
+                vaddps(x, x, aux);
+        }
+    }
+
+    void store_result(const Vmm &vmm) {
+        if (isa == sse42)
+            movss(ptr[param1 + GET_OFF(result)], Xmm(vmm.getIdx()));
+        else
+            vmovss(ptr[param1 + GET_OFF(result)], Xmm(vmm.getIdx()));
+    }
+};
+
+jit_softmax_kernel *create_kernel(softmax_kind kind) {
+    if (mayiuse(avx512_common))
+        return new jit_softmax_kernel_f32<avx512_common>(kind);
+    if (mayiuse(avx2))
+        return new jit_softmax_kernel_f32<avx2>(kind);
+    if (mayiuse(sse42))
+        return new jit_softmax_kernel_f32<sse42>(kind);
+    return nullptr;
+}
+
+size_t vectorized(const jit_softmax_kernel *jit, size_t width) {
+    return jit ? width / jit->simd_w * jit->simd_w : 0;
+}
+
+}  // namespace
+
+struct MKLDNNSoftMaxKernels::Kernels {
+    std::unique_ptr<jit_softmax_kernel> rowMax;
+    std::unique_ptr<jit_softmax_kernel> rowExp;
+    std::unique_ptr<jit_softmax_kernel> rowScale;
+    std::unique_ptr<jit_softmax_kernel> columns;
+};
+
+MKLDNNSoftMaxKernels::MKLDNNSoftMaxKernels(): kernels(new Kernels()) {
+    kernels->rowMax.reset(create_kernel(softmax_kind::row_max));
+    kernels->rowExp.reset(create_kernel(softmax_kind::row_exp));
+    kernels->rowScale.reset(create_kernel(softmax_kind::row_scale));
+    kernels->columns.reset(create_kernel(softmax_kind::columns));
+}
+
+MKLDNNSoftMaxKernels::~MKLDNNSoftMaxKernels() = default;
+
+const MKLDNNSoftMaxKernels &MKLDNNSoftMaxKernels::get() {
+    static const MKLDNNSoftMaxKernels instance;
+    return instance;
+}
+
+std::string MKLDNNSoftMaxKernels::getIsaName() const {
+    return kernels->columns ? kernels->columns->isa_name : "ref";
+}
+
+void MKLDNNSoftMaxKernels::execute(const float *src, float *dst, size_t outer, size_t channels, size_t inner) const {
+    if (!outer || !channels || !inner)
+        return;
+
+    if (inner == 1) {
+        parallel_for(outer, [&](size_t o) {
+            row(src + o * channels, dst + o * channels, channels);
+        });
+        return;
+    }
+
+    const size_t blocks = (inner + columnsBlock - 1) / columnsBlock;
+    parallel_for2d(outer, blocks, [&](size_t o, size_t b) {
+        const size_t start = b * columnsBlock;
+        const size_t offset = o * channels * inner + start;
+        columns(src + offset, dst + offset, channels, inner, (std::min)(columnsBlock, inner - start));
+    });
+}
+
+void MKLDNNSoftMaxKernels::row(const float *src, float *dst, size_t channels) const {
+    const size_t simd_width = vectorized(kernels->rowMax.get(), channels);
+    jit_softmax_call_args args;
+    args.src = src;
+    args.dst = dst;
+    args.work_amount = simd_width;
+    args.channels = channels;
+    args.stride = 0;
+    args.value = 0.0f;
+    args.result = 0.0f;
+
+    float max = src[0];
+    if (simd_width) {
+        kernels->rowMax->ker_(&args);
+        max = args.result;
+    }
+    for (size_t c = simd_width; c < channels; c++)
+        max = (std::max)(max, src[c]);
+
+    float sum = 0.0f;
+    if (simd_width) {
+        args.value = max;
+        kernels->rowExp->ker_(&args);
+        sum = args.result;
+    }
+    for (size_t c = simd_width; c < channels; c++) {
+        dst[c] = std::exp(src[c] - max);
+        sum += dst[c];
+    }
+
+    const float scale = 1.0f / sum;
+    if (simd_width) {
+        args.src = dst;
+        args.value = scale;
+        kernels->rowScale->ker_(&args);
+    }
+    for (size_t c = simd_width; c < channels; c++)
+        dst[c] *= scale;
+}
+
+void MKLDNNSoftMaxKernels::columns(const float *src, float *dst, size_t channels, size_t inner, size_t width) const {
+    const size_t simd_width = vectorized(kernels->columns.get(), width);
+    if (simd_width) {
+        jit_softmax_call_args args;
+        args.src = src;
+        args.dst = dst;
+        args.work_amount = simd_width;
+        args.channels = channels;
+        args.stride = inner * sizeof(float);
+        args.value = 0.0f;
+        args.result = 0.0f;
+        kernels->columns->ker_(&args);
+    }
+
+    for (size_t i = simd_width; i < width; i++) {
+        float max = src[i];
+        for (size_t c = 1; c < channels; c++)
+            max = (std::max)(max, src[c * inner + i]);
+
+        float sum = 0.0f;
+        for (size_t c = 0; c < channels; c++) {
+            dst[c * inner + i] = std::exp(src[c * inner + i] - max);
+            sum += dst[c * inner + i];
+        }
+
+        const float scale = 1.0f / sum;
+        for (size_t c = 0; c < channels; c++)
+            dst[c * inner + i] *= scale;
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The softmax of the FP32 tensors of the plain layout. The kernels with the polynomial approximation of exp
+ * are generated once for the best ISA of the machine (AVX-512, AVX2 or SSE4.2). The softmax over the innermost
+ * dimension (the classes of the classifiers and of the SSD confidences) is vectorized along the rows, the other
+ * axes are vectorized across the inner elements. The elements which do not fill the vector are computed
+ * by the scalar code.
+ */
+class MKLDNNSoftMaxKernels {
+public:
+    /**
+     * @brief The kernels for the ISA of the current machine
+     */
+    static const MKLDNNSoftMaxKernels &get();
+
+    ~MKLDNNSoftMaxKernels();
+
+    /**
+     * @brief Computes the softmax of the tensor [outer][channels][inner] over the channels, the threads split
+     * the outer dimensions and the blocks of the inner ones. The destination may be the source
+     */
+    void execute(const float *src, float *dst, size_t outer, size_t channels, size_t inner) const;
+
+    /**
+     * @brief The name of the ISA of the compiled kernels or "ref"
+     */
+    std::string getIsaName() const;
+
+private:
+    MKLDNNSoftMaxKernels();
+
+    struct Kernels;
+
+    void row(const float *src, float *dst, size_t channels) const;
+    void columns(const float *src, float *dst, size_t channels, size_t inner, size_t width) const;
+
+    std::shared_ptr<Kernels> kernels;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,97 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_sparse_inner_product.h"
+#include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the number of the output channels computed by one task of the inner product
+const size_t channelsBlock = 16;
+
+}  // namespace
+
+// the value and the column of the weight are read instead of the dense vector of the weights, so the sparse
+// weights are smaller and faster up to about a third of the nonzero weights
+const float MKLDNNSparseInnerProduct::maxDensity = 0.3f;
+
+void MKLDNNSparseInnerProduct::init(const float *weights, size_t oc, size_t k) {
+    if (!weights || !oc || !k)
+        THROW_IE_EXCEPTION << "Cannot pack empty weights of the inner product.";
+    if (k > std::numeric_limits<uint32_t>::max())
+        return;
+
+    const size_t nonzeros = oc * k - std::count(weights, weights + oc * k, 0.0f);
+    if (static_cast<float>(nonzeros) >= maxDensity * static_cast<float>(oc * k))
+        return;
+
+    OC = oc;
+    K = k;
+    rowOffsets.resize(OC + 1);
+    columns.reserve(nonzeros);
+    values.reserve(nonzeros);
+    for (size_t c = 0; c < OC; c++) {
+        rowOffsets[c] = values.size();
+        const float *row = weights + c * K;
+        for (size_t i = 0; i < K; i++) {
+            if (row[i] == 0.0f)
+                continue;
+            columns.push_back(static_cast<uint32_t>(i));
+            values.push_back(row[i]);
+        }
+    }
+    rowOffsets[OC] = values.size();
+}
+
+float MKLDNNSparseInnerProduct::getDensity() const {
+    return empty() ? 1.0f : static_cast<float>(values.size()) / static_cast<float>(OC * K);
+}
+
+void MKLDNNSparseInnerProduct::execute(const float *src, const float *bias, float *dst, size_t MB) const {
+    if (empty())
+        THROW_IE_EXCEPTION << "The sparse weights of the inner product are not initialized.";
+
+    const size_t blocks = (OC + channelsBlock - 1) / channelsBlock;
+    // the nonzero weights of the block are read once for all the rows of the source
+    parallel_for(blocks, [&](size_t blk) {
+        const size_t end = (std::min)(OC, (blk + 1) * channelsBlock);
+        for (size_t n = 0; n < MB; n++) {
+            const float *s = src + n * K;
+            float *d = dst + n * OC;
+            for (size_t c = blk * channelsBlock; c < end; c++) {
+                float sum = bias ? bias[c] : 0.0f;
+                for (size_t i = rowOffsets[c]; i < rowOffsets[c + 1]; i++)
+                    sum += values[i] * s[columns[i]];
+                d[c] = sum;
+            }
+        }
+    });
+}
+
+void MKLDNNSparseInnerProduct::executeSpatial(const float *src, const float *bias, float *dst,
+                                              size_t MB, size_t spatial) const {
+    if (empty())
+        THROW_IE_EXCEPTION << "The sparse weights of the inner product are not initialized.";
+
+    parallel_for2d(MB, OC, [&](size_t n, size_t c) {
+        const float *s = src + n * K * spatial;
+        float *d = dst + (n * OC + c) * spatial;
+        std::fill_n(d, spatial, bias ? bias[c] : 0.0f);
+        for (size_t i = rowOffsets[c]; i < rowOffsets[c + 1]; i++) {
+            const float w = values[i];
+            const float *row = s + columns[i] * spatial;
+            for (size_t p = 0; p < spatial; p++)
+                d[p] += w * row[p];
+        }
+    });
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The inner product with the pruned weights. Only the nonzero weights are kept in the CSR format:
+ * the values and the columns of every output channel one after another, so the zeros are neither read nor
+ * multiplied. It pays off for the weights with the low density only, as every value carries its column and
+ * the source is read by the columns instead of the vectors.
+ * The same weights [OC][K] run the 1x1 convolution of the planar data, where the row of an output channel
+ * is accumulated from the rows of the source channels.
+ */
+class MKLDNNSparseInnerProduct {
+public:
+    /**
+     * @brief The share of the nonzero weights below which the sparse implementation is used
+     */
+    static const float maxDensity;
+
+    /**
+     * @brief Packs the nonzero weights [OC][K]. Nothing is packed if the density of the weights is not below
+     * maxDensity, so the inner product stays empty
+     */
+    void init(const float *weights, size_t OC, size_t K);
+
+    bool empty() const {
+        return rowOffsets.empty();
+    }
+
+    /**
+     * @brief Computes dst[n][oc] = bias[oc] + src[n] * weights[oc] for MB rows of the source with the stride K
+     * @param bias - the biases of the output channels or nullptr
+     */
+    void execute(const float *src, const float *bias, float *dst, size_t MB) const;
+
+    /**
+     * @brief Computes the 1x1 convolution dst[n][oc][p] = bias[oc] + sum of weights[oc][k] * src[n][k][p]
+     * for the planar source and destination of MB images with the spatial size of the image
+     * @param bias - the biases of the output channels or nullptr
+     */
+    void executeSpatial(const float *src, const float *bias, float *dst, size_t MB, size_t spatial) const;
+
+    /**
+     * @brief The share of the nonzero weights
+     */
+    float getDensity() const;
+
+private:
+    size_t OC = 0;
+    size_t K = 0;
+    // [OC + 1], the nonzero weights of the channel oc are [rowOffsets[oc], rowOffsets[oc + 1])
+    std::vector<size_t> rowOffsets;
+    std::vector<uint32_t> columns;
+    std::vector<float> values;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,135 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "mkldnn_streams.h"
+#include "mkldnn_graph.h"
+#include "ie_parallel.hpp"
+#include "mkldnn/omp_manager.h"
+#include <omp.h>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+thread_local MultiWorkerTaskContext MultiWorkerTaskExecutor::ptrContext;
+
+MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr> &initTasks, std::string name,
+                                                 int threadsPerWorker, std::vector<std::vector<int>> workerCores)
+        : _isStopped(false), _name(name), _threadsPerWorker(threadsPerWorker), _workerCores(workerCores),
+          _utilization(initTasks.size()) {
+    for (size_t worker = 0; worker < initTasks.size(); worker++) {
+        auto initTask = initTasks[worker];
+        initTask->occupy();
+        _threads.push_back(std::thread([this, initTask, worker] {
+#if !(defined(__APPLE__) || defined(_WIN32))
+            // the arena and the data of the worker are created on the cores of the worker already
+            if (worker < _workerCores.size())
+                cpu::OpenMpManager::bindCurrentThreadToCores(_workerCores[worker]);
+#endif
+#if IE_THREAD == IE_THREAD_TBB
+            tbb::task_arena arena(_threadsPerWorker > 0 ? _threadsPerWorker : tbb::task_arena::automatic);
+            auto run = [&arena](const Task::Ptr &task) {
+                arena.execute([&task] { task->runNoThrowNoBusyCheck(); });
+            };
+#else
+            auto run = [](const Task::Ptr &task) {
+                task->runNoThrowNoBusyCheck();
+            };
+#endif
+            // every worker thread runs its own initialization
+            run(initTask);
+
+            while (true) {
+                Task::Ptr currentTask;
+                {  // waiting for the new task or for stop signal
+                    std::unique_lock<std::mutex> lock(_queueMutex);
+                    _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
+                    if (_taskQueue.empty())
+                        break;
+                    currentTask = _taskQueue.front();
+                    _taskQueue.pop();
+                }
+                _utilization.taskStarted(worker);
+                run(currentTask);
+                _utilization.taskFinished(worker);
+            }
+            // the stream data is released by the thread which owns it
+            ptrContext.ptrGraph.reset();
+        }));
+    }
+}
+
+MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
+    {
+        // the workers drain the queue before they stop
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        _isStopped = true;
+        _queueCondVar.notify_all();
+    }
+    for (auto &thread : _threads) {
+        if (thread.joinable())
+            thread.join();
+    }
+}
+
+bool MultiWorkerTaskExecutor::startTask(Task::Ptr task) {
+    if (!task->occupy()) return false;
+    std::unique_lock<std::mutex> lock(_queueMutex);
+    _taskQueue.push(task);
+    _queueCondVar.notify_one();
+    return true;
+}
+
+ExecutorMetrics MultiWorkerTaskExecutor::getMetrics() const {
+    size_t queued;
+    {
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        queued = _taskQueue.size();
+    }
+    return _utilization.getTotal(queued);
+}
+
+size_t MultiWorkerTaskExecutor::getWorkersNumber() const {
+    return _utilization.getWorkersNumber();
+}
+
+ExecutorMetrics MultiWorkerTaskExecutor::getWorkerMetrics(size_t worker) const {
+    if (worker >= _utilization.getWorkersNumber())
+        THROW_IE_EXCEPTION << "The executor " << _name << " has no worker " << worker;
+    return _utilization.get(worker);
+}
+
+GraphPool::GraphPool(const std::vector<std::shared_ptr<MKLDNNGraph>> &graphs, int threadsPerGraph)
+        : _freeGraphs(graphs), _threadsPerGraph(threadsPerGraph) {
+}
+
+GraphPool::Lease::Lease(GraphPool &pool) : _pool(pool), _savedThreads(0) {
+    {
+        // the executor may have more workers than the graphs, if it was created by another network first
+        std::unique_lock<std::mutex> lock(_pool._mutex);
+        _pool._freeCondVar.wait(lock, [&]() { return !_pool._freeGraphs.empty(); });
+        _graph = _pool._freeGraphs.back();
+        _pool._freeGraphs.pop_back();
+    }
+#if IE_THREAD == IE_THREAD_OMP
+    // the worker is shared with the other networks, so its OpenMP team is restored after the inference
+    _savedThreads = omp_get_max_threads();
+    omp_set_num_threads(_pool._threadsPerGraph);
+#endif
+}
+
+GraphPool::Lease::~Lease() {
+#if IE_THREAD == IE_THREAD_OMP
+    omp_set_num_threads(_savedThreads);
+#endif
+    std::lock_guard<std::mutex> lock(_pool._mutex);
+    _pool._freeGraphs.push_back(_graph);
+    _pool._freeCondVar.notify_one();
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,122 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <queue>
+#include <string>
+#include <cpp_interfaces/ie_itask_executor.hpp>
+#include <cpp_interfaces/ie_executor_utilization.hpp>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNGraph;
+
+/**
+ * @brief Per worker thread data. The worker thread (stream) owns its own copy of the graph.
+ */
+struct MultiWorkerTaskContext {
+    std::shared_ptr<MKLDNNGraph> ptrGraph;
+};
+
+/**
+ * @brief CPU "streams" allow multiple infer requests of one executable network to be run simultaneously.
+ * Each stream is a worker thread that monitors the common (per executable network) queue of requests,
+ * owns a replica of the graph and executes it with its own OpenMP team bound to a subset of the cores.
+ * So the requests are not serialized on a single OpenMP team, which is beneficial for the topologies
+ * and batch sizes that do not scale well with the number of threads.
+ * With the TBB threading (see ie_parallel.hpp) every worker runs the tasks in its own task arena
+ * of threadsPerWorker threads, so the parallel loops of the streams do not oversubscribe the cores.
+ */
+class MultiWorkerTaskExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    typedef std::shared_ptr<MultiWorkerTaskExecutor> Ptr;
+
+    /**
+     * @brief Creates a worker thread per every init task. The init task is the first task run by the worker
+     * (e.g. to create the graph of the stream), it is occupied here, so the caller may wait for it.
+     * @param workerCores - the logical cores (see OpenMpManager) every worker thread is bound to when it starts,
+     * before its init task, no list (or the empty one) keeps the worker unbound. The binding is supported on Linux only
+     */
+    explicit MultiWorkerTaskExecutor(const std::vector<InferenceEngine::Task::Ptr> &initTasks,
+                                     std::string name = "Default", int threadsPerWorker = 0,
+                                     std::vector<std::vector<int>> workerCores = {});
+
+    ~MultiWorkerTaskExecutor();
+
+    /**
+     * @brief Adds the task to the common queue, it will be executed by the first idle worker
+     * @param task - shared pointer to the task to start
+     * @return true if succeed to add task, otherwise - false
+     */
+    bool startTask(InferenceEngine::Task::Ptr task) override;
+
+    InferenceEngine::ExecutorMetrics getMetrics() const override;
+
+    size_t getWorkersNumber() const;
+
+    /**
+     * @brief The metrics of a worker (stream), the queue is common, so its depth is reported by getMetrics() only
+     */
+    InferenceEngine::ExecutorMetrics getWorkerMetrics(size_t worker) const;
+
+    static thread_local MultiWorkerTaskContext ptrContext;
+
+private:
+    std::vector<std::thread> _threads;
+    mutable std::mutex _queueMutex;
+    std::condition_variable _queueCondVar;
+    std::queue<InferenceEngine::Task::Ptr> _taskQueue;
+    bool _isStopped;
+    std::string _name;
+    int _threadsPerWorker;
+    std::vector<std::vector<int>> _workerCores;
+    InferenceEngine::ExecutorUtilization _utilization;
+};
+
+/**
+ * @brief The streams of the network with the exclusive async requests. The requests are inferred by the workers
+ * of the executor shared with the other networks (see ExecutorManager), so the graphs are not owned by the workers,
+ * every request takes a free graph for the time of its inference instead.
+ */
+class GraphPool {
+public:
+    typedef std::shared_ptr<GraphPool> Ptr;
+
+    /**
+     * @brief The graph taken from the pool, the inference threads of the calling thread are limited
+     * to threadsPerGraph until the graph is returned
+     */
+    class Lease {
+    public:
+        explicit Lease(GraphPool &pool);
+        ~Lease();
+
+        Lease(const Lease &) = delete;
+        Lease &operator=(const Lease &) = delete;
+
+        const std::shared_ptr<MKLDNNGraph> &graph() const { return _graph; }
+
+    private:
+        GraphPool &_pool;
+        std::shared_ptr<MKLDNNGraph> _graph;
+        int _savedThreads;
+    };
+
+    GraphPool(const std::vector<std::shared_ptr<MKLDNNGraph>> &graphs, int threadsPerGraph);
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _freeCondVar;
+    std::vector<std::shared_ptr<MKLDNNGraph>> _freeGraphs;
+    int _threadsPerGraph;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,100 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tuning_cache.h"
+#include "mkldnn_extension_utils.h"
+
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include <chrono>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+const char tuningSignature[] = "MKLDNNTuningCache";
+
+}  // namespace
+
+MKLDNNTuningCache::MKLDNNTuningCache(const std::string &file): file(file), isa(MKLDNNExtensionUtils::getIsaName()) {}
+
+bool MKLDNNTuningCache::load() {
+    entries.clear();
+
+    std::ifstream stream(file);
+    if (!stream.is_open())
+        return false;
+
+    std::string signature, fileIsa;
+    stream >> signature >> fileIsa;
+    if (signature != tuningSignature || fileIsa != isa)
+        return false;
+
+    Entry entry;
+    std::string key;
+    while (stream >> key >> entry.index >> entry.implType >> entry.supportedNum) {
+        entries[key] = entry;
+    }
+    return true;
+}
+
+void MKLDNNTuningCache::save() const {
+    if (file.empty())
+        return;
+
+    // the file is written aside and renamed, so the processes started simultaneously never read partial data
+    std::string tmpFile = file + ".tmp" +
+            std::to_string(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    {
+        std::ofstream stream(tmpFile);
+        if (!stream.is_open())
+            return;
+
+        stream << tuningSignature << " " << isa << std::endl;
+        for (auto &entry : entries) {
+            stream << entry.first << " " << entry.second.index << " " << entry.second.implType << " "
+                   << entry.second.supportedNum << std::endl;
+        }
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpFile.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpFile.c_str(), file.c_str()) != 0) {
+        // rename doesn't replace the existing file on some platforms
+        std::remove(file.c_str());
+        if (std::rename(tmpFile.c_str(), file.c_str()) != 0)
+            std::remove(tmpFile.c_str());
+    }
+}
+
+bool MKLDNNTuningCache::select(const std::string &key, const MKLDNNNodePtr &node) const {
+    auto found = entries.find(key);
+    if (found == entries.end())
+        return false;
+
+    const Entry &entry = found->second;
+    const auto &supported = node->getSupportedPrimitiveDescriptors();
+    if (supported.size() != entry.supportedNum || entry.index < 0 || entry.index >= supported.size() ||
+            static_cast<int>(supported[entry.index].getImplementationType()) != entry.implType)
+        return false;
+
+    node->selectPrimitiveDescriptorByIndex(entry.index);
+    return true;
+}
+
+void MKLDNNTuningCache::store(const std::string &key, const MKLDNNNodePtr &node) {
+    auto *selected = node->getSelectedPrimitiveDescriptor();
+    if (!selected)
+        return;
+
+    Entry entry;
+    entry.index = static_cast<int>(selected - &node->getSupportedPrimitiveDescriptors()[0]);
+    entry.implType = static_cast<int>(selected->getImplementationType());
+    entry.supportedNum = node->getSupportedPrimitiveDescriptors().size();
+    entries[key] = entry;
+}
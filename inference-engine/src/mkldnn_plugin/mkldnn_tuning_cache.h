@@ -0,0 +1,66 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <map>
+#include <memory>
+#include "mkldnn_node.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Results of the timing of the primitive implementations (see Config::tuningMode).
+ * The entries are keyed by the signature of the node (shapes and parameters) rather than by its name,
+ * so one tuning file serves all the networks containing the same layers. The file is bound to the
+ * instruction set of the machine it was created on.
+ */
+class MKLDNNTuningCache {
+public:
+    typedef std::shared_ptr<MKLDNNTuningCache> Ptr;
+
+    explicit MKLDNNTuningCache(const std::string &file);
+
+    /**
+     * @brief Reads the tuning file
+     * @return false if the file doesn't exist or was created for another instruction set
+     */
+    bool load();
+
+    /**
+     * @brief Writes all the entries to the tuning file
+     */
+    void save() const;
+
+    /**
+     * @brief Selects the stored primitive descriptor for the node
+     * @return false if nothing is stored for the key or the entry doesn't match the
+     * supported primitive descriptors of the node
+     */
+    bool select(const std::string &key, const MKLDNNNodePtr &node) const;
+
+    /**
+     * @brief Remembers the primitive descriptor currently selected for the node
+     */
+    void store(const std::string &key, const MKLDNNNodePtr &node);
+
+    const std::string &getFile() const {
+        return file;
+    }
+
+private:
+    struct Entry {
+        int index;
+        int implType;
+        size_t supportedNum;
+    };
+
+    std::string file;
+    std::string isa;
+    std::map<std::string, Entry> entries;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,66 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_weights_cache.h"
+#include "mkldnn_extension_utils.h"
+#include "mkldnn/omp_manager.h"
+
+#include <cstdint>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+MKLDNNWeightsSharing& MKLDNNWeightsSharing::getInstance() {
+    static MKLDNNWeightsSharing instance;
+    return instance;
+}
+
+std::string MKLDNNWeightsSharing::makeKey(const void *data, size_t size, const mkldnn::memory::desc &desc) {
+    std::string key = std::to_string(MKLDNNExtensionUtils::hashData(data, size)) + "_" + std::to_string(size) + "_" +
+                      std::to_string(desc.data.format) + "_" + std::to_string(desc.data.data_type);
+    for (int i = 0; i < desc.data.ndims; i++)
+        key += "_" + std::to_string(desc.data.dims[i]);
+#if !(defined(__APPLE__) || defined(_WIN32))
+    // the graphs bound to the different NUMA nodes keep their own copies of the weights (see Config::numaNode)
+    int socket = cpu::OpenMpManager::getCurrentThreadSocket();
+    if (socket >= 0)
+        key += "_node" + std::to_string(socket);
+#endif
+    return key;
+}
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::findOrCreate(const std::string &key, const InferenceEngine::Blob::CPtr &source,
+                                                   const std::function<MKLDNNMemoryPtr()> &create) {
+    // the address of the live blob identifies it, the entry of a released blob of the same address is replaced
+    const std::string sourceKey = key + "_src" + std::to_string(reinterpret_cast<uintptr_t>(source.get()));
+    std::shared_ptr<Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        // forget the memory which was already released by the graphs unless a creation holds it
+        for (auto it = sharedWeights.begin(); it != sharedWeights.end();) {
+            if (it->second.use_count() == 1 && it->second->memory.expired())
+                it = sharedWeights.erase(it);
+            else
+                it++;
+        }
+        auto &found = sharedWeights[sourceKey];
+        if (!found)
+            found = std::make_shared<Entry>();
+        entry = found;
+    }
+
+    // the weights are reordered under the lock of their entry only, so the different weights are created
+    // in parallel and the same weights are created once
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    MKLDNNMemoryPtr memory = entry->memory.lock();
+    if (memory && entry->source.lock() == source)
+        return memory;
+    memory = create();
+    entry->memory = memory;
+    entry->source = source;
+    return memory;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,61 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <mutex>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <ie_blob.h>
+#include "mkldnn_memory.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Process-wide storage of the constant (weights and biases) memory, prepared for the primitives.
+ * The weights are read-only after a primitive is created, so graphs of the same network (streams, or the networks
+ * loaded several times) use the single copy of the reordered weights. The memory is shared only by the weights
+ * read from the same blob of the network, which is alive, so equal hashes of different data are never mixed up.
+ * The cache does not own the memory: it is released with the last graph which uses it.
+ */
+class MKLDNNWeightsSharing {
+public:
+    static MKLDNNWeightsSharing& getInstance();
+
+    /**
+     * @brief Builds the key of the memory from the source data and the desired layout of the weights
+     * @param data - the source (plain) weights
+     * @param size - size of the source weights in bytes
+     * @param desc - the descriptor of the memory to be created from the source weights
+     */
+    static std::string makeKey(const void *data, size_t size, const mkldnn::memory::desc &desc);
+
+    /**
+     * @brief Returns the memory cached for the key and the source blob or the memory produced by the create function.
+     * The concurrent calls for the same key and source wait for the first of them, so the memory is created once.
+     * @param key - the key of makeKey()
+     * @param source - the blob of the network the weights are read from
+     * @param create - creates the memory of the weights
+     */
+    MKLDNNMemoryPtr findOrCreate(const std::string &key, const InferenceEngine::Blob::CPtr &source,
+                                 const std::function<MKLDNNMemoryPtr()> &create);
+
+private:
+    MKLDNNWeightsSharing() = default;
+
+    struct Entry {
+        // held by the creation of the memory
+        std::mutex mutex;
+        std::weak_ptr<MKLDNNMemory> memory;
+        std::weak_ptr<const InferenceEngine::Blob> source;
+    };
+
+    std::mutex guard;
+    std::unordered_map<std::string, std::shared_ptr<Entry>> sharedWeights;
+};
+
+}  // namespace MKLDNNPlugin
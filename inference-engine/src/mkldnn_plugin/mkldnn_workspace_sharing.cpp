@@ -0,0 +1,45 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_workspace_sharing.h"
+
+#include <string>
+#include <unordered_map>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+MKLDNNWorkspaceGroup::Ptr MKLDNNWorkspaceGroup::get(const std::string &name) {
+    static std::mutex groupsGuard;
+    static std::unordered_map<std::string, std::weak_ptr<MKLDNNWorkspaceGroup>> groups;
+
+    std::lock_guard<std::mutex> lock(groupsGuard);
+    Ptr group = groups[name].lock();
+    if (!group) {
+        group = std::make_shared<MKLDNNWorkspaceGroup>();
+        groups[name] = group;
+    }
+    return group;
+}
+
+void MKLDNNWorkspaceGroup::reserve(size_t size, const mkldnn::engine &eng, size_t hugePageSize) {
+    std::lock_guard<std::mutex> lock(guard);
+    if (size <= this->size)
+        return;
+
+    const size_t floats = (size + sizeof(float) - 1) / sizeof(float);
+    MKLDNNMemoryPtr newMemory(new MKLDNNMemory(eng));
+    newMemory->CreateOnHugePages(MKLDNNMemoryDesc(TensorDesc(Precision::FP32, {1, floats}, Layout::NC)), hugePageSize);
+    memory = newMemory;
+    this->size = floats * sizeof(float);
+}
+
+void *MKLDNNWorkspaceGroup::getData() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return memory ? memory->GetData() : nullptr;
+}
+
+}  // namespace MKLDNNPlugin
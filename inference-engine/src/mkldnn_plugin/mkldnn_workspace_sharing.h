@@ -0,0 +1,44 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <mutex>
+#include <memory>
+#include "mkldnn_memory.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The memory for the intermediate data shared by the graphs of the networks which never run concurrently
+ * (see Config::workspaceGroup). The arena is as big as the biggest requirement of the graphs in the group. It may be
+ * reallocated when a bigger graph joins the group, so the graphs check the data pointer before the inference.
+ * The group is released with the last graph which uses it.
+ */
+class MKLDNNWorkspaceGroup {
+public:
+    typedef std::shared_ptr<MKLDNNWorkspaceGroup> Ptr;
+
+    /**
+     * @brief Returns the group of the name, the group is created if there are no graphs in it yet
+     */
+    static Ptr get(const std::string &name);
+
+    /**
+     * @brief Grows the arena up to the size in bytes, the data of the arena is not kept. The new arena is placed
+     * on the huge pages of the size (see MKLDNNHugePages), 0 for the regular memory
+     */
+    void reserve(size_t size, const mkldnn::engine &eng, size_t hugePageSize = 0);
+
+    void *getData() const;
+
+private:
+    mutable std::mutex guard;
+    MKLDNNMemoryPtr memory;
+    size_t size = 0;
+};
+
+}  // namespace MKLDNNPlugin
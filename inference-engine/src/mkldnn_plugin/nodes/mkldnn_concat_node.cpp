@@ -280,6 +280,15 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
             formatFrequency[outDesc.getFormat()] = 1;
     }
 
+    // nChw16c producers and consumers of the inputs which aren't aligned to 16 channels vote for nChw8c,
+    // the reorders between the blocked formats are cheaper than the copy of the concat and the reorders to planar
+    auto nChw16cFrequency = formatFrequency.find(memory::nChw16c);
+    if (nChw16cFrequency != formatFrequency.end() && !isAlignedToBlocks(memory::nChw16c) &&
+            isAlignedToBlocks(memory::nChw8c)) {
+        formatFrequency[memory::nChw8c] += nChw16cFrequency->second;
+        formatFrequency.erase(nChw16cFrequency);
+    }
+
     size_t maxCount = 0;
     mkldnn::memory::format convertTo = MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims());
     for (auto &it : formatFrequency) {
@@ -324,9 +333,31 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
         }
     }
 
+    // The format without the in-place descriptor (nhwc for example) is reordered to the planar one,
+    // the in-place descriptor of the planar format is the first one
+    if (!canSelectPrimitive.empty()) {
+        selectPrimitiveDescriptorByIndex(static_cast<int>(canSelectPrimitive[0]));
+        return;
+    }
+
     THROW_IE_EXCEPTION << "Cannot find optimal primitive desc for node: " << getName();
 }
 
+bool MKLDNNConcatNode::isAlignedToBlocks(mkldnn::memory::format fmt) const {
+    if (fmt != memory::nChw8c && fmt != memory::nChw16c)
+        return true;
+    if (getChildEdgeAt(0)->getDims().ndims() != 4)
+        return false;
+
+    if (MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), memory::f32, fmt).blocksExtended())
+        return false;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        if (MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), memory::f32, fmt).blocksExtended())
+            return false;
+    }
+    return true;
+}
+
 bool MKLDNNConcatNode::created() const {
     return getType() == Concatenation;
 }
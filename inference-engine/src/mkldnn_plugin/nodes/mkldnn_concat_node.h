@@ -26,6 +26,12 @@ public:
     bool isOptimized() const;
 
 private:
+    /**
+     * @brief Checks that the inputs and the output of the concat fill whole channel blocks of the format,
+     * so the inputs can be the slices of the output memory
+     */
+    bool isAlignedToBlocks(mkldnn::memory::format fmt) const;
+
     static Register<MKLDNNConcatNode> reg;
     size_t axis = 0;
 };
@@ -9,9 +9,15 @@
 #include "mkldnn_activation_node.h"
 #include "desc_iterator.hpp"
 #include "mkldnn_eltwise_node.h"
+#include "mkldnn_channel_linear.h"
 #include <ie_layers.h>
 #include <string>
 #include <vector>
+#include <memory>
+#include <sstream>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 
@@ -32,7 +38,7 @@ MKLDNNConvolutionNode::MKLDNNConvolutionNode(const InferenceEngine::CNNLayerPtr&
 }
 
 void MKLDNNConvolutionNode::getSupportedDescriptors() {
-    if (!descs.empty())
+    if (!descs.empty() || !sparseConvolution.empty())
         return;
 
     InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
@@ -86,10 +92,48 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
 
     withBiases = (convLayer->_biases != nullptr && convLayer->_biases->size() != 0);
 
+    if (isInt8()) {
+        // the accumulated values are dequantized by w-scale, the s8 output is quantized again by o-scale
+        auto wScale = convLayer->blobs["w-scale"];
+        auto oScaleIt = convLayer->blobs.find("o-scale");
+        bool toInt8 = oScaleIt != convLayer->blobs.end() && oScaleIt->second &&
+                      getCnnLayer()->outData[0]->getPrecision() == InferenceEngine::Precision::I8;
+        auto oScale = toInt8 ? oScaleIt->second : nullptr;
+
+        size_t scalesNum = std::max(wScale->size(), std::max(oScale ? oScale->size() : 1, requantizationScales.size()));
+        auto isConsistent = [&](size_t size) {
+            return size <= 1 || size == scalesNum;
+        };
+        if (!isConsistent(wScale->size()) || (oScale && !isConsistent(oScale->size())) ||
+                !isConsistent(requantizationScales.size()))
+            THROW_IE_EXCEPTION << "Convolution " << getName() << " has inconsistent sizes of the quantization scales.";
+
+        auto getScale = [](const float *scales, size_t size, size_t c) {
+            return size == 1 ? scales[0] : scales[c];
+        };
+        const float *wScaleData = wScale->cbuffer().as<const float *>();
+        outputScales.resize(scalesNum);
+        for (size_t c = 0; c < scalesNum; c++) {
+            outputScales[c] = getScale(wScaleData, wScale->size(), c);
+            if (oScale)
+                outputScales[c] /= getScale(oScale->cbuffer().as<const float *>(), oScale->size(), c);
+            if (!requantizationScales.empty())
+                outputScales[c] *= getScale(requantizationScales.data(), requantizationScales.size(), c);
+        }
+
+        inputDataType = memory::u8;
+        if (!requantizationScales.empty())
+            outputDataType = memory::u8;
+        else
+            outputDataType = toInt8 ? memory::s8 : memory::f32;
+    }
+
     internalBlobs.push_back(createInternalBlob(weightDims, true));
     if (withBiases) {
         internalBlobs.push_back(createInternalBlob(biasesDims, false));
     }
+    foldInputScaleShift();
+    foldScaleShift();
 
     stride = {static_cast<int>(convLayer->_stride_y), static_cast<int>(convLayer->_stride_x)};
     dilation = {static_cast<int>(convLayer->_dilation_y) - 1, static_cast<int>(convLayer->_dilation_x) - 1};
@@ -125,6 +169,17 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
         }
     }
 
+    if (initSparseConvolution())
+        return;
+
+    if (isInt8()) {
+        // the quantized implementations work with nhwc data only
+        MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType, memory::nhwc);
+        MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType, memory::nhwc);
+        createDescriptor({in_candidate}, {out_candidate});
+        return;
+    }
+
     MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType, memory::nchw);
     MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType, memory::nchw);
     createDescriptor({in_candidate}, {out_candidate});
@@ -145,10 +200,124 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
 }
 
 
+void MKLDNNConvolutionNode::addZeroBiases() {
+    TensorDesc desc(Precision::FP32, biasesDims, TensorDesc::getLayoutByDims(biasesDims));
+    auto zeroBiases = make_shared_blob<float>(desc);
+    zeroBiases->allocate();
+    std::fill_n(zeroBiases->buffer().as<float *>(), biasesDims[0], 0.0f);
+    internalBlobs.push_back(zeroBiases);
+    withBiases = true;
+}
+
+void MKLDNNConvolutionNode::foldScaleShift() {
+    size_t OC = biasesDims[0];
+    for (auto &node : fusedWith) {
+        if (node->getType() != Depthwise && node->getType() != BatchNormalization && node->getType() != Power)
+            continue;
+
+        MKLDNNChannelLinear linear;
+        if (!MKLDNNChannelLinear::fromNode(node, OC, linear))
+            THROW_IE_EXCEPTION << "Cannot fold layer " << node->getName() << " into convolution " << getName() << ".";
+
+        if (!withBiases && linear.hasShifts())
+            addZeroBiases();
+
+        float *weights = internalBlobs[0]->buffer().as<float *>();
+        float *biases = withBiases ? internalBlobs[1]->buffer().as<float *>() : nullptr;
+        size_t channelSize = internalBlobs[0]->size() / OC;
+        for (size_t c = 0; c < OC; c++) {
+            for (size_t i = 0; i < channelSize; i++)
+                weights[c * channelSize + i] *= linear.scales[c];
+            if (biases)
+                biases[c] = biases[c] * linear.scales[c] + linear.shifts[c];
+        }
+    }
+}
+
+void MKLDNNConvolutionNode::foldInputScaleShift() {
+    if (inputFolded.empty())
+        return;
+
+    // the weights are {groups, OC / groups, IC / groups, KH, KW}
+    size_t groups = weightDims.size() == 5 ? weightDims[0] : 1;
+    size_t groupOC = weightDims[weightDims.size() - 4];
+    size_t groupIC = weightDims[weightDims.size() - 3];
+    size_t kernelSize = weightDims[weightDims.size() - 2] * weightDims[weightDims.size() - 1];
+    size_t OC = biasesDims[0];
+
+    // the layer closest to the convolution goes first
+    for (auto &node : inputFolded) {
+        MKLDNNChannelLinear linear;
+        if (!MKLDNNChannelLinear::fromNode(node, groups * groupIC, linear))
+            THROW_IE_EXCEPTION << "Cannot fold layer " << node->getName() << " into convolution " << getName() << ".";
+
+        if (!withBiases && linear.hasShifts())
+            addZeroBiases();
+
+        float *weights = internalBlobs[0]->buffer().as<float *>();
+        float *biases = withBiases ? internalBlobs[1]->buffer().as<float *>() : nullptr;
+        for (size_t oc = 0; oc < OC; oc++) {
+            size_t g = oc / groupOC;
+            for (size_t ic = 0; ic < groupIC; ic++) {
+                float *w = weights + (oc * groupIC + ic) * kernelSize;
+                float scale = linear.scales[g * groupIC + ic];
+                float shift = linear.shifts[g * groupIC + ic];
+                for (size_t k = 0; k < kernelSize; k++) {
+                    if (biases)
+                        biases[oc] += w[k] * shift;
+                    w[k] *= scale;
+                }
+            }
+        }
+    }
+}
+
+bool MKLDNNConvolutionNode::initSparseConvolution() {
+    if (isInt8() || isGrouped || isMerged || withSum || weightDims.size() != 4 || weightDims[2] != 1 ||
+            weightDims[3] != 1)
+        return false;
+    for (int i = 0; i < 2; i++) {
+        if (stride[i] != 1 || dilation[i] != 0 || paddingL[i] != 0 || paddingR[i] != 0)
+            return false;
+    }
+    // the scale shifts are already folded into the weights, only the activation is left to the output
+    for (auto &node : fusedWith) {
+        if (dynamic_cast<MKLDNNEltwiseNode *>(node.get()) || dynamic_cast<MKLDNNConvolutionNode *>(node.get()))
+            return false;
+    }
+    if (internalBlobs[0]->precision() != Precision::FP32)
+        return false;
+
+    sparseConvolution.init(internalBlobs[0]->cbuffer().as<const float *>(), weightDims[0], weightDims[1]);
+    if (sparseConvolution.empty())
+        return false;
+
+    // the internal blobs are released after the primitives are created
+    if (withBiases) {
+        const float *biases = internalBlobs[1]->cbuffer().as<const float *>();
+        sparseBiases.assign(biases, biases + biasesDims[0]);
+    }
+    return true;
+}
+
 void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (!sparseConvolution.empty()) {
+        InferenceEngine::LayerConfig config;
+        config.dynBatchSupport = true;
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), memory::f32, memory::nchw);
+        config.inConfs.push_back(dataConfig);
+        dataConfig.desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), memory::f32, memory::nchw);
+        config.outConfs.push_back(dataConfig);
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+        return;
+    }
+
     mkldnn::post_ops ops;
     for (auto &node : fusedWith) {
         auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
@@ -183,6 +352,7 @@ void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
 
     mkldnn::primitive_attr attr;
     attr.set_post_ops(ops);
+    setOutputScales(attr);
 
     for (auto& desc : descs) {
         try {
@@ -226,13 +396,32 @@ void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
             continue;
         }
     }
+
+    if (supportedPrimitiveDescriptors.empty() && isInt8())
+        THROW_IE_EXCEPTION << "The quantized convolution " << getName() << " is not supported on this CPU.";
 }
 
 
 void MKLDNNConvolutionNode::createPrimitive() {
-    if (prim)
+    if (prim || activationPrim)
         return;
 
+    if (!sparseConvolution.empty()) {
+        for (auto &node : fusedWith) {
+            auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+            if (!activationNode)
+                continue;
+
+            auto &dst = getChildEdgeAt(0)->getMemory();
+            eltwise_forward::desc activationDesc(prop_kind::forward_scoring, activationNode->getAlgorithm(),
+                                                 dst.GetDescriptor(), activationNode->getAlpha(),
+                                                 activationNode->getBeta());
+            eltwise_forward::primitive_desc activationPD(activationDesc, getEngine());
+            activationPrim.reset(new eltwise_forward(activationPD, dst.GetPrimitive(), dst.GetPrimitive()));
+        }
+        return;
+    }
+
     mkldnn::post_ops ops;
     for (auto &node : fusedWith) {
         auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
@@ -282,6 +471,7 @@ void MKLDNNConvolutionNode::createPrimitive() {
 
     mkldnn::primitive_attr attr;
     attr.set_post_ops(ops);
+    setOutputScales(attr);
 
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
@@ -300,6 +490,26 @@ void MKLDNNConvolutionNode::createPrimitive() {
     }
 }
 
+void MKLDNNConvolutionNode::execute(mkldnn::stream strm) {
+    if (sparseConvolution.empty()) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+
+    auto &src = getParentEdgeAt(0)->getMemory();
+    auto &dst = getChildEdgeAt(0)->getMemory();
+    const float *src_data = reinterpret_cast<const float *>(src.GetData()) +
+            src.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_data = reinterpret_cast<float *>(dst.GetData()) +
+            dst.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const size_t spatial = static_cast<size_t>(dst.GetDims()[2]) * dst.GetDims()[3];
+
+    sparseConvolution.executeSpatial(src_data, sparseBiases.empty() ? nullptr : sparseBiases.data(), dst_data,
+                                     static_cast<size_t>(batchToProcess()), spatial);
+    if (activationPrim)
+        strm.submit({*activationPrim});
+}
+
 bool MKLDNNConvolutionNode::created() const {
     return getType() == Convolution || getType() == Convolution_Sum_Activation ||
            getType() == Convolution_Activation || getType() == Convolution_Sum;
@@ -349,12 +559,15 @@ void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::
         }
     }
 
-    MKLDNNMemoryDesc wgh_candidate{blocked_weightDims, in_candidate.getDataType(), memory::any};
+    auto wdt = isInt8() ? memory::s8 : in_candidate.getDataType();
+    auto bdt = isInt8() ? memory::s32 : in_candidate.getDataType();
+
+    MKLDNNMemoryDesc wgh_candidate{blocked_weightDims, wdt, memory::any};
 
     for (auto alg : {algorithm::convolution_winograd, algorithm::convolution_direct}) {
         std::shared_ptr<mkldnn::convolution_forward::desc> conv_desc;
         if (withBiases) {
-            MKLDNNMemoryDesc bias_candidate{blocked_biasesDims, in_candidate.getDataType(), memory::any};
+            MKLDNNMemoryDesc bias_candidate{blocked_biasesDims, bdt, memory::any};
 
             conv_desc.reset(new convolution_forward::desc(prop_kind::forward_scoring, alg, in_candidate,
                                                           wgh_candidate, bias_candidate, out_candidate,
@@ -369,9 +582,37 @@ void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::
     }
 }
 
+bool MKLDNNConvolutionNode::isWinogradPreferable() const {
+    // Winograd F(4x4, 3x3) pays off for the 3x3 convolutions with unit strides and enough channels to amortize
+    // the transforms of the tiles, the small images of the last stages have too few tiles per channel
+    const size_t minChannels = 64;
+    const size_t minTiles = 49;
+
+    if (isGrouped || isMerged || isDW || isInt8() || weightDims.size() != 4)
+        return false;
+    if (weightDims[2] != 3 || weightDims[3] != 3)
+        return false;
+    if (stride[0] != 1 || stride[1] != 1 || dilation[0] != 0 || dilation[1] != 0)
+        return false;
+    if (weightDims[0] < minChannels || weightDims[1] < minChannels)
+        return false;
+
+    auto dstDims = getChildEdgeAt(0)->getDims();
+    size_t tiles = static_cast<size_t>(dstDims[0]) * ((dstDims[2] + 3) / 4) * ((dstDims[3] + 3) / 4);
+    return tiles >= minTiles;
+}
+
+const std::vector<impl_desc_type>& MKLDNNConvolutionNode::getPrimitivesPriority() {
+    // the implementations from the PrimitivesPriority parameter are already in the list and go first
+    if (isWinogradPreferable() &&
+            std::find(implPriorities.begin(), implPriorities.end(), impl_desc_type::jit_avx512_winograd) == implPriorities.end())
+        implPriorities.push_back(impl_desc_type::jit_avx512_winograd);
+    return MKLDNNNode::getPrimitivesPriority();
+}
+
 void MKLDNNConvolutionNode::initDescriptor(const InferenceEngine::LayerConfig& config) {
     auto* selectedPD = getSelectedPrimitiveDescriptor();
-    if (!selectedPD) {
+    if (!selectedPD || !sparseConvolution.empty()) {
         return;
     }
     bool addedNewDesc = false;
@@ -415,6 +656,7 @@ void MKLDNNConvolutionNode::initDescriptor(const InferenceEngine::LayerConfig& c
 
     mkldnn::primitive_attr attr;
     attr.set_post_ops(ops);
+    setOutputScales(attr);
 
     InferenceEngine::LayerConfig rightConfig = selectedPD->getConfig();
     size_t selected_count = 0;
@@ -466,3 +708,186 @@ void MKLDNNConvolutionNode::initDescriptor(const InferenceEngine::LayerConfig& c
     }
     selectedPD->getConfig() = rightConfig;
 }
+
+mkldnn::primitive_attr MKLDNNConvolutionNode::initTuningAttr() const {
+    // the same post operations as in initSupportedPrimitiveDescriptors(), so the iterated implementations match
+    // the supported primitive descriptors one by one
+    mkldnn::post_ops ops;
+    for (auto &node : fusedWith) {
+        if (dynamic_cast<MKLDNNEltwiseNode *>(node.get())) {
+            ops.append_sum(1.0);
+            continue;
+        }
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            ops.append_eltwise(1.0, activationNode->getAlgorithm(), activationNode->getAlpha(),
+                               activationNode->getBeta());
+        }
+    }
+
+    mkldnn::primitive_attr attr;
+    attr.set_post_ops(ops);
+    setOutputScales(attr);
+    return attr;
+}
+
+std::string MKLDNNConvolutionNode::getTuningKey() const {
+    const PrimitiveDescInfo *selectedPD = getSelectedPrimitiveDescriptor();
+    // the sparse convolution has the only implementation
+    if (!selectedPD || !sparseConvolution.empty())
+        return "";
+
+    std::stringstream key;
+    auto addDims = [&](const std::string &name, const std::vector<size_t> &dims) {
+        key << "_" << name;
+        for (size_t i = 0; i < dims.size(); i++)
+            key << (i ? "x" : "") << dims[i];
+    };
+    auto addInts = [&](const std::string &name, const std::vector<int> &values) {
+        addDims(name, std::vector<size_t>(values.begin(), values.end()));
+    };
+
+    key << "conv";
+    addDims("src", getParentEdgeAt(0)->getDims().ToSizeVector());
+    addDims("dst", getChildEdgeAt(0)->getDims().ToSizeVector());
+    addDims("wei", weightDims);
+    addInts("s", stride);
+    addInts("d", dilation);
+    addInts("pl", paddingL);
+    addInts("pr", paddingR);
+    key << "_b" << withBiases;
+    if (isInt8())
+        key << "_i8";
+
+    for (auto &node : fusedWith) {
+        // the weights of the fused depthwise convolution are only available on the primitive creation
+        if (dynamic_cast<MKLDNNConvolutionNode *>(node.get()))
+            return "";
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode)
+            key << "_act" << static_cast<int>(activationNode->getAlgorithm());
+        else if (dynamic_cast<MKLDNNEltwiseNode *>(node.get()))
+            key << "_sum";
+    }
+
+    const auto &config = selectedPD->getConfig();
+    if (config.inConfs.empty() || config.outConfs.empty())
+        return "";
+    addDims("in", config.inConfs[0].desc.getBlockingDesc().getBlockDims());
+    addDims("o", config.inConfs[0].desc.getBlockingDesc().getOrder());
+    addDims("out", config.outConfs[0].desc.getBlockingDesc().getBlockDims());
+    addDims("o", config.outConfs[0].desc.getBlockingDesc().getOrder());
+    return key.str();
+}
+
+void MKLDNNConvolutionNode::selectFastestPrimitiveDescriptor() {
+    const PrimitiveDescInfo *selectedPD = getSelectedPrimitiveDescriptor();
+    if (!selectedPD)
+        return;
+
+    auto sameLayout = [](const InferenceEngine::TensorDesc &desc1, const InferenceEngine::TensorDesc &desc2) {
+        return desc1.getPrecision() == desc2.getPrecision() &&
+               desc1.getBlockingDesc().getOrder() == desc2.getBlockingDesc().getOrder() &&
+               desc1.getBlockingDesc().getBlockDims() == desc2.getBlockingDesc().getBlockDims();
+    };
+    const InferenceEngine::LayerConfig selectedConfig = selectedPD->getConfig();
+
+    const int warmupRuns = 1;
+    const int measuredRuns = 5;
+    auto bestTime = std::chrono::high_resolution_clock::duration::max();
+    int bestIndex = -1;
+
+    mkldnn::primitive_attr attr = initTuningAttr();
+    int index = 0;
+    for (auto &desc : descs) {
+        try {
+            primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(getEngine(), attr);
+            do {
+                int current = index++;
+                if (current >= static_cast<int>(supportedPrimitiveDescriptors.size()))
+                    break;
+                const auto &config = supportedPrimitiveDescriptors[current].getConfig();
+                if (!sameLayout(config.inConfs[0].desc, selectedConfig.inConfs[0].desc) ||
+                        !sameLayout(config.outConfs[0].desc, selectedConfig.outConfs[0].desc))
+                    continue;
+
+                try {
+                    std::shared_ptr<convolution_forward::desc> conv_desc = desc;
+                    convolution_forward::primitive_desc prim_desc(*conv_desc, getEngine());
+                    itpd.getPrimitiveDescriptor(prim_desc);
+
+                    // the content of the memory doesn't affect the speed, so it is just zeroed
+                    std::vector<mkldnn::memory> memories;
+                    memories.emplace_back(itpd.src_primitive_desc());
+                    memories.emplace_back(itpd.weights_primitive_desc(0));
+                    if (withBiases)
+                        memories.emplace_back(itpd.weights_primitive_desc(1));
+                    memories.emplace_back(itpd.dst_primitive_desc());
+                    for (auto &memory : memories)
+                        memset(memory.get_data_handle(), 0, memory.get_primitive_desc().get_size());
+
+                    std::shared_ptr<convolution_forward> conv;
+                    if (withBiases)
+                        conv.reset(new convolution_forward(prim_desc, memories[0], memories[1], memories[2],
+                                                           memories[3]));
+                    else
+                        conv.reset(new convolution_forward(prim_desc, memories[0], memories[1], memories[2]));
+
+                    for (int i = 0; i < warmupRuns; i++)
+                        mkldnn::stream(stream::kind::eager).submit({*conv}).wait();
+
+                    auto time = std::chrono::high_resolution_clock::duration::max();
+                    for (int i = 0; i < measuredRuns; i++) {
+                        auto start = std::chrono::high_resolution_clock::now();
+                        mkldnn::stream(stream::kind::eager).submit({*conv}).wait();
+                        time = std::min(time, std::chrono::high_resolution_clock::now() - start);
+                    }
+
+                    if (time < bestTime) {
+                        bestTime = time;
+                        bestIndex = current;
+                    }
+                } catch (std::exception& e) {
+                    // the implementation is not timed, it can't be chosen
+                    continue;
+                }
+            } while (itpd.next());
+        } catch (std::exception& e) {
+            // it throw exception in case of no implementation found
+            continue;
+        }
+    }
+
+    if (bestIndex >= 0)
+        selectPrimitiveDescriptorByIndex(bestIndex);
+}
+
+bool MKLDNNConvolutionNode::isInt8() const {
+    const auto &layer = getCnnLayer();
+    if (!layer || layer->precision != InferenceEngine::Precision::I8)
+        return false;
+    auto wScale = layer->blobs.find("w-scale");
+    return wScale != layer->blobs.end() && wScale->second && wScale->second->size() != 0;
+}
+
+void MKLDNNConvolutionNode::fuseRequantization(const std::vector<float> &scales) {
+    if (requantizationScales.empty()) {
+        requantizationScales = scales;
+        return;
+    }
+    if (scales.size() > 1 && requantizationScales.size() == 1)
+        requantizationScales.resize(scales.size(), requantizationScales[0]);
+    for (size_t c = 0; c < requantizationScales.size(); c++)
+        requantizationScales[c] *= scales[scales.size() == 1 ? 0 : c];
+}
+
+void MKLDNNConvolutionNode::setOutputScales(mkldnn::primitive_attr &attr) const {
+    if (outputScales.empty())
+        return;
+
+    // the scales are per output channel, the channels are the dimension 1 of the output
+    attr.set_int_output_round_mode(mkldnn::round_nearest);
+    attr.set_output_scales(outputScales.size() == 1 ? 0 : 1 << 1, outputScales);
+}
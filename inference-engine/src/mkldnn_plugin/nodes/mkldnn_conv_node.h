@@ -7,6 +7,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "mkldnn_sparse_inner_product.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -23,13 +24,69 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void initDescriptor(const InferenceEngine::LayerConfig& config) override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     void initSupportedPrimitiveDescriptors() override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
     }
+    const std::vector<impl_desc_type>& getPrimitivesPriority() override;
+
+    /**
+     * @brief Checks if the convolution was quantized by CNNNetworkInt8Normalizer, i.e. it has INT8 weights
+     * and the "w-scale" blob. Such convolution reads u8 data and produces s8 data quantized by "o-scale"
+     * or FP32 data if the output precision is FP32.
+     */
+    bool isInt8() const;
+    /**
+     * @brief Folds per-channel scales of the following layers into the output scales of the quantized
+     * convolution, the output becomes u8 data which can be read by the next quantized convolution directly
+     */
+    void fuseRequantization(const std::vector<float> &scales);
+
+    /**
+     * @brief Folds the per-channel linear layer of the input (see MKLDNNChannelLinear) into the weights and
+     * the biases: W' = W * scale[ic], B' = B + sum(W * shift[ic]). The shifts are only folded into the convolution
+     * without the padding, since the padded values are not shifted.
+     */
+    void foldInputWith(const MKLDNNNodePtr &node) {
+        inputFolded.push_back(node);
+    }
+
+    /**
+     * @brief Signature of the convolution used to store the tuning results, it has the shapes, the parameters,
+     * the fused operations and the layouts of the currently selected primitive descriptor
+     * @return empty string if the convolution can't be tuned
+     */
+    std::string getTuningKey() const;
+    /**
+     * @brief Times the implementations available for the layouts of the currently selected primitive descriptor
+     * and selects the fastest one. Other layouts are not considered, as they would change the reorders around
+     * the node which are not timed.
+     */
+    void selectFastestPrimitiveDescriptor();
 
 private:
+    mkldnn::primitive_attr initTuningAttr() const;
+    void setOutputScales(mkldnn::primitive_attr &attr) const;
+    /**
+     * @brief Multiplies the weights and the biases by the ScaleShift, BatchNormalization or Power fused
+     * into the convolution
+     */
+    void foldScaleShift();
+    void foldInputScaleShift();
+    void addZeroBiases();
+    /**
+     * @brief Checks if the shape of the convolution is known to run faster with Winograd than with the direct
+     * algorithm. The PrimitivesPriority parameter of the layer overrides the choice.
+     */
+    bool isWinogradPreferable() const;
+    /**
+     * @brief Packs the pruned weights of the 1x1 convolution without the strides and the paddings, such
+     * convolution of the planar data is computed by MKLDNNSparseInnerProduct instead of the primitive
+     */
+    bool initSparseConvolution();
+
     static Register<MKLDNNConvolutionNode> reg;
     bool withBiases;
     bool withSum;
@@ -51,6 +108,16 @@ private:
     int dw_conv_sh;
     int dw_conv_sw;
     std::vector<MKLDNNMemoryPtr> DWConvInternalBlobMemory;
+
+    std::vector<float> outputScales;
+    std::vector<float> requantizationScales;
+    // the linear layers of the input folded into the weights, see foldInputWith()
+    std::vector<MKLDNNNodePtr> inputFolded;
+
+    MKLDNNSparseInnerProduct sparseConvolution;
+    std::vector<float> sparseBiases;
+    // the sparse convolution has no post-ops, the fused activation is applied in place to the output
+    std::shared_ptr<mkldnn::primitive> activationPrim;
 };
 
 }  // namespace MKLDNNPlugin
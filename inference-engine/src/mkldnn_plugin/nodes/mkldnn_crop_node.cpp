@@ -7,8 +7,10 @@
 #include <ie_layers.h>
 #include <string>
 #include <algorithm>
+#include <limits>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -84,6 +86,8 @@ void MKLDNNCropNode::initSupportedPrimitiveDescriptors() {
     config.outConfs[0].constant = false;
     config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmt);
 
+    addInPlaceDescriptors(config);
+
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 
     if (channelAxis >= 0 && dims[channelAxis] % 8 == 0) {
@@ -100,6 +104,102 @@ void MKLDNNCropNode::initSupportedPrimitiveDescriptors() {
     }
 }
 
+void MKLDNNCropNode::addInPlaceDescriptors(const InferenceEngine::LayerConfig& copyConfig) {
+    auto srcDims = getParentEdgeAt(0)->getDims().ToSizeVector();
+    auto dstDims = getChildEdgeAt(0)->getDims().ToSizeVector();
+
+    // the innermost cropped dimension, the dimensions after it are kept whole
+    size_t axis = 0;
+    for (size_t i = 0; i < dstDims.size(); i++) {
+        if (offsets[i] != 0 || dstDims[i] != srcDims[i])
+            axis = i;
+    }
+    if (axis > 1 || getCnnLayer()->insData[0].lock()->getPrecision() != Precision::FP32)
+        return;
+
+    const size_t numOfDim = srcDims.size();
+    const size_t offset = std::numeric_limits<size_t>::max();
+
+    auto addConfig = [&](size_t blockSize) {
+        SizeVector srcBlkDims = srcDims;
+        SizeVector dstBlkDims = dstDims;
+        SizeVector order;
+        for (size_t i = 0; i < numOfDim; i++)
+            order.push_back(i);
+        if (blockSize > 1) {
+            if (srcDims[1] % blockSize || dstDims[1] % blockSize || offsets[1] % blockSize)
+                return;
+            srcBlkDims[1] /= blockSize;
+            dstBlkDims[1] /= blockSize;
+            srcBlkDims.push_back(blockSize);
+            dstBlkDims.push_back(blockSize);
+            order.push_back(1);
+        }
+
+        // the strides of the dimensions before the cropped one are taken from the parent memory
+        SizeVector strides(srcBlkDims.size());
+        SizeVector offsetsToData(srcBlkDims.size(), 0);
+        strides[strides.size() - 1] = 1;
+        for (size_t i = 2; i <= strides.size(); i++) {
+            if (strides.size() - i < axis) {
+                strides[strides.size() - i] = std::numeric_limits<size_t>::max();
+            } else {
+                strides[strides.size() - i] = strides[strides.size() - i + 1] * srcBlkDims[strides.size() - i + 1];
+            }
+        }
+
+        InferenceEngine::LayerConfig config = copyConfig;
+        config.inConfs[0].desc = TensorDesc(Precision::FP32, srcDims, {srcBlkDims, order, offset, offsetsToData, strides});
+        config.outConfs[0].inPlace = 0;
+        config.outConfs[0].desc = TensorDesc(Precision::FP32, dstDims, {dstBlkDims, order, offset, offsetsToData, strides});
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+    };
+
+    addConfig(1);
+    if (numOfDim == 4) {
+        addConfig(8);
+        addConfig(16);
+    }
+}
+
+bool MKLDNNCropNode::isOptimized() {
+    return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].inPlace >= 0;
+}
+
+void MKLDNNCropNode::initOptimalPrimitiveDescriptor() {
+    if (!isOptimized()) {
+        MKLDNNNode::initOptimalPrimitiveDescriptor();
+        return;
+    }
+
+    auto config = getSelectedPrimitiveDescriptor()->getConfig();
+    if (isInitConfig(config))
+        return;
+
+    for (size_t i = 0; i < config.inConfs.size(); i++) {
+        config.inConfs[i].desc = getConfiguredInputDesc(config, i);
+    }
+
+    const auto& inBlocking = config.inConfs[0].desc.getBlockingDesc();
+    const auto& outBlocking = config.outConfs[0].desc.getBlockingDesc();
+    size_t blockSize = inBlocking.getBlockDims().size() > offsets.size() ? inBlocking.getBlockDims().back() : 1;
+
+    // the output starts at the first cropped element of the input and walks it with the input strides
+    size_t offset = inBlocking.getOffsetPadding();
+    for (size_t i = 0; i < 2 && i < offsets.size(); i++) {
+        offset += (i == 1 ? offsets[i] / blockSize : offsets[i]) * inBlocking.getStrides()[i];
+    }
+    config.outConfs[0].desc = InferenceEngine::TensorDesc(config.outConfs[0].desc.getPrecision(),
+                                                          config.outConfs[0].desc.getDims(), {
+                                                                  outBlocking.getBlockDims(),
+                                                                  outBlocking.getOrder(),
+                                                                  offset,
+                                                                  inBlocking.getOffsetPaddingToData(),
+                                                                  inBlocking.getStrides()
+                                                          });
+    initDescriptor(config);
+}
+
 void MKLDNNCropNode::createPrimitive() {
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
@@ -112,6 +212,9 @@ void MKLDNNCropNode::createPrimitive() {
 }
 
 void MKLDNNCropNode::execute(mkldnn::stream strm) {
+    if (isOptimized())
+        return;
+
     auto& parentMem = getParentEdgeAt(0)->getMemory();
 
     int m_block_size = 1;
@@ -150,24 +253,22 @@ void MKLDNNCropNode::execute(mkldnn::stream strm) {
     float *dst_data = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
             getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-#   pragma omp parallel for collapse(2) schedule(static)
-    for (int n = 0; n < ON; ++n) {
-        for (int c = 0; c < OC; c += m_block_size) {
-            for (int h = 0; h < OH; ++h) {
-                int dst_ind =
-                        n*OC*OH*OW + c*OH*OW +
-                        h*OW*m_block_size;
-
-                int src_ind =
-                        (n+OFFSET_N)*IC*IH*IW +
-                        (c+OFFSET_C)*IH*IW +
-                        (h+OFFSET_H)*IW*m_block_size +
-                        OFFSET_W*m_block_size;
-
-                memcpy(dst_data + dst_ind, src_data + src_ind, m_inner_dim * sizeof(float));
-            }
+    InferenceEngine::parallel_for2d(ON, (OC + m_block_size - 1) / m_block_size, [&](int n, int cb) {
+        const int c = cb * m_block_size;
+        for (int h = 0; h < OH; ++h) {
+            int dst_ind =
+                    n*OC*OH*OW + c*OH*OW +
+                    h*OW*m_block_size;
+
+            int src_ind =
+                    (n+OFFSET_N)*IC*IH*IW +
+                    (c+OFFSET_C)*IH*IW +
+                    (h+OFFSET_H)*IW*m_block_size +
+                    OFFSET_W*m_block_size;
+
+            memcpy(dst_data + dst_ind, src_data + src_ind, m_inner_dim * sizeof(float));
         }
-    }
+    });
 }
 
 bool MKLDNNCropNode::created() const {
@@ -26,7 +26,16 @@ public:
         return false;
     }
 
+    bool isOptimized();
+    void initOptimalPrimitiveDescriptor() override;
+
 private:
+    /**
+     * @brief Adds the configurations whose output is a view on the input memory, they are possible when
+     * the crop keeps the inner dimensions, so the cropped region is a strided slice of the input
+     */
+    void addInPlaceDescriptors(const InferenceEngine::LayerConfig& copyConfig);
+
     static Register<MKLDNNCropNode> reg;
     int channelAxis = 1;
     std::vector<int> offsets;
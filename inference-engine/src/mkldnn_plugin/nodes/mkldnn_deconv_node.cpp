@@ -7,10 +7,13 @@
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <mkldnn.hpp>
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -56,6 +59,14 @@ void MKLDNNDeconvolutionNode::getSupportedDescriptors() {
     if (withBiases)
         biases = deconvLayer->_biases;
 
+    stride = {static_cast<int>(deconvLayer->_stride_y), static_cast<int>(deconvLayer->_stride_x)};
+    paddingL = {static_cast<int>(deconvLayer->_padding_y), static_cast<int>(deconvLayer->_padding_x)};
+
+    // the separable upsampling doesn't need the weights and the primitive of MKLDNN
+    isSeparable = initSeparableFilters(*deconvLayer);
+    if (isSeparable)
+        return;
+
     /* Original layout format for deconv weights is iohw (from Caffe).
      * We specify oihw, but mean iohw, because there are no more
      * suitable format in MKLDNN.
@@ -80,8 +91,6 @@ void MKLDNNDeconvolutionNode::getSupportedDescriptors() {
 
     internalBlobs.push_back(createInternalBlob(weightDims, true));
 
-    stride = {static_cast<int>(deconvLayer->_stride_y), static_cast<int>(deconvLayer->_stride_x)};
-    paddingL = {static_cast<int>(deconvLayer->_padding_y), static_cast<int>(deconvLayer->_padding_x)};
     dilation = {static_cast<int>(deconvLayer->_dilation_y) - 1, static_cast<int>(deconvLayer->_dilation_x) - 1};
     paddingR = {0, 0};
 
@@ -105,7 +114,159 @@ void MKLDNNDeconvolutionNode::getSupportedDescriptors() {
     }
 }
 
+bool MKLDNNDeconvolutionNode::initSeparableFilters(const DeconvolutionLayer &layer) {
+    if (!isDW || layer._dilation_x > 1 || layer._dilation_y > 1 || getParentEdgeAt(0)->getDims().ndims() != 4 ||
+            getChildEdgeAt(0)->getDims().ndims() != 4 || layer._weights->precision() != Precision::FP32)
+        return false;
+
+    const int C = static_cast<int>(layer._out_depth);
+    const int KH = static_cast<int>(layer._kernel_y);
+    const int KW = static_cast<int>(layer._kernel_x);
+    if (KH == 0 || KW == 0 || layer._weights->size() != static_cast<size_t>(C) * KH * KW)
+        return false;
+
+    // the filters are kept tap by tap for the channels padded to the biggest block
+    const int Cp = rnd_up(C, 16);
+    const float *weights = layer._weights->cbuffer().as<const float *>();
+    std::vector<float> fy(static_cast<size_t>(KH) * Cp, 0.0f);
+    std::vector<float> fx(static_cast<size_t>(KW) * Cp, 0.0f);
+    for (int c = 0; c < C; c++) {
+        const float *w = weights + c * KH * KW;
+        const int peak = static_cast<int>(std::max_element(w, w + KH * KW, [](float a, float b) {
+            return std::fabs(a) < std::fabs(b);
+        }) - w);
+        const float maxAbs = std::fabs(w[peak]);
+        if (maxAbs == 0.0f)
+            continue;
+
+        // the kernel of rank one is restored from its row and its column crossing the peak
+        const int ky0 = peak / KW;
+        const int kx0 = peak % KW;
+        for (int ky = 0; ky < KH; ky++)
+            fy[ky * Cp + c] = w[ky * KW + kx0] / w[peak];
+        for (int kx = 0; kx < KW; kx++)
+            fx[kx * Cp + c] = w[ky0 * KW + kx];
+
+        for (int ky = 0; ky < KH; ky++) {
+            for (int kx = 0; kx < KW; kx++) {
+                if (std::fabs(fy[ky * Cp + c] * fx[kx * Cp + c] - w[ky * KW + kx]) > 1e-5f * maxAbs)
+                    return false;
+            }
+        }
+    }
+
+    kernelH = KH;
+    kernelW = KW;
+    filterY.swap(fy);
+    filterX.swap(fx);
+    return true;
+}
+
+void MKLDNNDeconvolutionNode::initSupportedPrimitiveDescriptors() {
+    if (!isSeparable) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].constant = false;
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+    // the blocked layouts go first as the lanes of the block are processed together
+    for (auto format : {memory::nChw16c, memory::nChw8c, memory::nchw}) {
+        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), memory::f32, format);
+        config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), memory::f32, format);
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+    }
+}
+
+void MKLDNNDeconvolutionNode::executeSeparable() {
+    auto &src = getParentEdgeAt(0)->getMemory();
+    auto &dst = getChildEdgeAt(0)->getMemory();
+    const float *input = reinterpret_cast<const float *>(src.GetData()) +
+                         src.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *output = reinterpret_cast<float *>(dst.GetData()) +
+                    dst.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    memory::format fmt = MKLDNNMemoryDesc(getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc).getFormat();
+    const int blksize = fmt == memory::nChw16c ? 16 :
+                        fmt == memory::nChw8c ? 8 : 1;
+
+    const int MB = batchToProcess();
+    const int C = dst.GetDims()[1];
+    const int CB = div_up(C, blksize);
+    const int IH = src.GetDims()[2];
+    const int IW = src.GetDims()[3];
+    const int OH = dst.GetDims()[2];
+    const int OW = dst.GetDims()[3];
+    const int KH = kernelH;
+    const int KW = kernelW;
+    const int SY = stride[0];
+    const int SX = stride[1];
+    const int PY = paddingL[0];
+    const int PX = paddingL[1];
+    const int Cp = rnd_up(C, 16);
+    const float *bias = withBiases ? biases->buffer().as<const float *>() : nullptr;
+
+    // out[y][x] = sum of in[iy][ix] * fy[ky] * fx[kx] for y = iy * SY - PY + ky and x = ix * SX - PX + kx,
+    // so the input rows are upsampled horizontally first and the result is upsampled vertically
+    InferenceEngine::parallel_for2d(MB, CB, [&](int n, int cb) {
+        const float *in = input + static_cast<size_t>(n * CB + cb) * IH * IW * blksize;
+        float *out = output + static_cast<size_t>(n * CB + cb) * OH * OW * blksize;
+        const int c0 = cb * blksize;
+        std::vector<float> rows(static_cast<size_t>(IH) * OW * blksize, 0.0f);
+
+        for (int iy = 0; iy < IH; iy++) {
+            for (int x = 0; x < OW; x++) {
+                float *r = &rows[(iy * OW + x) * blksize];
+                for (int kx = (x + PX) % SX; kx < KW; kx += SX) {
+                    const int ix = (x + PX - kx) / SX;
+                    if (ix < 0)
+                        break;
+                    if (ix >= IW)
+                        continue;
+                    const float *i = in + (iy * IW + ix) * blksize;
+                    const float *f = &filterX[kx * Cp + c0];
+                    for (int bc = 0; bc < blksize; bc++)
+                        r[bc] += i[bc] * f[bc];
+                }
+            }
+        }
+
+        for (int y = 0; y < OH; y++) {
+            float *o = out + y * OW * blksize;
+            for (int x = 0; x < OW; x++) {
+                for (int bc = 0; bc < blksize; bc++)
+                    o[x * blksize + bc] = bias && c0 + bc < C ? bias[c0 + bc] : 0.0f;
+            }
+            for (int ky = (y + PY) % SY; ky < KH; ky += SY) {
+                const int iy = (y + PY - ky) / SY;
+                if (iy < 0)
+                    break;
+                if (iy >= IH)
+                    continue;
+                const float *r = &rows[iy * OW * blksize];
+                const float *f = &filterY[ky * Cp + c0];
+                for (int x = 0; x < OW; x++) {
+                    for (int bc = 0; bc < blksize; bc++)
+                        o[x * blksize + bc] += r[x * blksize + bc] * f[bc];
+                }
+            }
+        }
+    });
+}
+
 void MKLDNNDeconvolutionNode::execute(mkldnn::stream strm) {
+    if (isSeparable) {
+        executeSeparable();
+        return;
+    }
     if (prim) {
         strm.submit({*prim});
     }
@@ -129,11 +290,7 @@ void MKLDNNDeconvolutionNode::execute(mkldnn::stream strm) {
         const int blksize = fmt == memory::nChw16c ? 16 :
                             fmt == memory::nChw8c ? 8 : 1;
 
-#   pragma omp parallel for collapse(4) schedule(static)
-        for (int n = 0; n < N; ++n)
-        for (int c = 0; c < C / blksize; ++c)
-        for (int h = 0; h < H; ++h)
-        for (int w = 0; w < W; ++w) {
+        InferenceEngine::parallel_for4d(N, C / blksize, H, W, [&](int n, int c, int h, int w) {
             const int off =
                     n * C * H * W + c * H * W * blksize +
                     h * W * blksize + w * blksize;
@@ -141,7 +298,7 @@ void MKLDNNDeconvolutionNode::execute(mkldnn::stream strm) {
             for (int bc = 0; bc < blksize; ++bc) {
                 o[bc] += bias[c*blksize + bc];
             }
-        }
+        });
     }
 }
 
@@ -150,7 +307,7 @@ bool MKLDNNDeconvolutionNode::created() const {
 }
 
 void MKLDNNDeconvolutionNode::createPrimitive() {
-    if (prim)
+    if (prim || isSeparable)
         return;
 
     auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
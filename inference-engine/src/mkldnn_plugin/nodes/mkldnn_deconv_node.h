@@ -6,6 +6,7 @@
 #pragma once
 
 #include <ie_common.h>
+#include <ie_layers.h>
 #include <mkldnn_node.h>
 #include <memory>
 #include <string>
@@ -19,6 +20,7 @@ public:
     ~MKLDNNDeconvolutionNode() override = default;
 
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void createPrimitive() override;
@@ -32,9 +34,23 @@ public:
     MKLDNNMemoryDesc getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
 
 private:
+    /**
+     * @brief Checks if the kernel of every channel of the depthwise deconvolution is the outer product
+     * of a vertical and a horizontal filter (e.g. the bilinear upsampling) and keeps the filters if so
+     */
+    bool initSeparableFilters(const InferenceEngine::DeconvolutionLayer &layer);
+    void executeSeparable();
+
     bool withBiases;
     bool withGroups;
     bool isDW;
+    // the depthwise deconvolution is run as the horizontal and the vertical upsampling one after another
+    bool isSeparable = false;
+    int kernelH = 0;
+    int kernelW = 0;
+    // the filters of the channels padded to the block, C x KH and C x KW
+    std::vector<float> filterY;
+    std::vector<float> filterX;
     std::vector<int> stride;
     std::vector<int> paddingL;
     std::vector<int> dilation;
@@ -41,6 +41,15 @@ void MKLDNNDepthwiseNode::getSupportedDescriptors() {
     if (isWithBiases())
         internalBlobs.push_back(createInternalBlob(weightDims, false));
 
+    // The weights memory may be shared between graphs, so the broadcast is applied to the blobs it is created from
+    if (isBroadcast()) {
+        for (auto &blob : internalBlobs) {
+            auto *data = blob->buffer().as<float *>();
+            for (size_t i = 1; i < blob->size(); i++)
+                data[i] = data[0];
+        }
+    }
+
     for (auto format : getAvailableFormatsForDims(parentOutDims)) {
         MKLDNNMemoryDesc in_candidate{parentOutDims, inputDataType, format};
         createDescriptor({in_candidate}, {});
@@ -62,20 +71,6 @@ void MKLDNNDepthwiseNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<depthwise_forward::primitive_desc, depthwise_forward::desc>();
 
-    if (isBroadcast()) {
-        float broadcastValue = static_cast<float*>(internalBlobMemory[0]->GetData())[0];
-        for (int i = 1; i < internalBlobMemory[0]->GetPrimitiveDescriptor().desc().data.dims[0]; i++) {
-            static_cast<float*>(internalBlobMemory[0]->GetData())[i] = broadcastValue;
-        }
-
-        if (isWithBiases()) {
-            broadcastValue = static_cast<float*>(internalBlobMemory[1]->GetData())[0];
-            for (int i = 1; i < internalBlobMemory[1]->GetPrimitiveDescriptor().desc().data.dims[0]; i++) {
-                static_cast<float*>(internalBlobMemory[1]->GetData())[i] = broadcastValue;
-            }
-        }
-    }
-
     if (isWithBiases()) {
         prim.reset(new depthwise_forward(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
                                          internalBlobMemory[0]->GetPrimitive(),
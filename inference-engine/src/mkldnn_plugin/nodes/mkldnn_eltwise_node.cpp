@@ -4,6 +4,7 @@
 //
 
 #include "mkldnn_eltwise_node.h"
+#include "mkldnn_activation_node.h"
 #include <ie_layers.h>
 #include <string>
 #include <vector>
@@ -12,13 +13,174 @@
 #include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+MKLDNNElementwiseChain::OpType toChainOp(EltwiseLayer::eOperation op) {
+    switch (op) {
+        case EltwiseLayer::Sum:
+            return MKLDNNElementwiseChain::Sum;
+        case EltwiseLayer::Prod:
+            return MKLDNNElementwiseChain::Prod;
+        case EltwiseLayer::Max:
+            return MKLDNNElementwiseChain::Max;
+    }
+    THROW_IE_EXCEPTION << "Unsupported eltwise operation.";
+}
+
+std::vector<float> getScales(EltwiseLayer *eltwiseLayer) {
+    std::vector<float> scales = eltwiseLayer->coeff;
+    scales.resize(eltwiseLayer->insData.size(), 1.0f);
+    return scales;
+}
+
+/**
+ * Appends the operations of the Power or Activation node to the chain, only checks that the node is supported
+ * if chain is nullptr
+ */
+bool appendUnaryOps(MKLDNNElementwiseChain *chain, const MKLDNNNodePtr &node, bool onOperand) {
+    if (!node->getCnnLayer())
+        return false;
+
+    if (node->getType() == Power) {
+        auto *powerLayer = dynamic_cast<PowerLayer *>(node->getCnnLayer().get());
+        if (powerLayer == nullptr ||
+                (powerLayer->power != 1.0f && powerLayer->power != 2.0f && powerLayer->power != 0.5f))
+            return false;
+        if (chain) {
+            chain->addUnary(MKLDNNElementwiseChain::Linear, powerLayer->scale, powerLayer->offset, onOperand);
+            if (powerLayer->power == 2.0f)
+                chain->addUnary(MKLDNNElementwiseChain::Square, 1.0f, 0.0f, onOperand);
+            else if (powerLayer->power == 0.5f)
+                chain->addUnary(MKLDNNElementwiseChain::Sqrt, 1.0f, 0.0f, onOperand);
+        }
+        return true;
+    }
+
+    auto *activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+    if (activationNode == nullptr)
+        return false;
+
+    MKLDNNElementwiseChain::OpType type;
+    float alpha = activationNode->getAlpha();
+    float beta = activationNode->getBeta();
+    switch (activationNode->getAlgorithm()) {
+        case mkldnn::algorithm::eltwise_relu:
+            type = MKLDNNElementwiseChain::Relu;
+            break;
+        case mkldnn::algorithm::eltwise_bounded_relu:
+            type = MKLDNNElementwiseChain::Clamp;
+            beta = 0.0f;
+            break;
+        case mkldnn::algorithm::eltwise_clamp:
+            type = MKLDNNElementwiseChain::Clamp;
+            break;
+        case mkldnn::algorithm::eltwise_linear:
+            type = MKLDNNElementwiseChain::Linear;
+            break;
+        case mkldnn::algorithm::eltwise_abs:
+            type = MKLDNNElementwiseChain::Abs;
+            break;
+        case mkldnn::algorithm::eltwise_square:
+            type = MKLDNNElementwiseChain::Square;
+            break;
+        case mkldnn::algorithm::eltwise_sqrt:
+            type = MKLDNNElementwiseChain::Sqrt;
+            break;
+        default:
+            return false;
+    }
+    if (type == MKLDNNElementwiseChain::Clamp && beta > alpha)
+        return false;
+    if (chain)
+        chain->addUnary(type, alpha, beta, onOperand);
+    return true;
+}
+
+}  // namespace
+
 MKLDNNEltwiseNode::MKLDNNEltwiseNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
 
+bool MKLDNNEltwiseNode::isUnaryFusingSupported(const MKLDNNNodePtr& node) {
+    return appendUnaryOps(nullptr, node, false);
+}
+
+void MKLDNNEltwiseNode::fuseInputWith(size_t input, const MKLDNNNodePtr& node) {
+    fuseWith(node);
+    fusedInputs[node.get()] = {input, 0};
+}
+
+void MKLDNNEltwiseNode::fuseEltwise(const MKLDNNNodePtr& eltwise, size_t chainInput, size_t firstEdge) {
+    fuseWith(eltwise);
+    fusedInputs[eltwise.get()] = {chainInput, firstEdge};
+}
+
+void MKLDNNEltwiseNode::broadcastInput(size_t input, const MKLDNNDims& srcDims, int axis, int tiles) {
+    if (input >= inDims.size() || axis <= 0 || axis >= srcDims.ndims() || tiles <= 0)
+        THROW_IE_EXCEPTION << "Cannot broadcast the input " << input << " of " << getName();
+
+    size_t inner = 1;
+    for (int i = axis; i < srcDims.ndims(); i++)
+        inner *= srcDims[i];
+    inDims[input] = srcDims;
+    broadcasts[input] = {static_cast<size_t>(tiles), inner};
+}
+
+void MKLDNNEltwiseNode::initChain() {
+    chain.clear();
+
+    // the layers before the input are fused starting from the nearest one, so they are applied in reverse order
+    auto fuseInputs = [&](size_t input, bool onOperand) {
+        for (auto node_it = fusedWith.rbegin(); node_it != fusedWith.rend(); node_it++) {
+            const auto &node = *node_it;
+            auto it = fusedInputs.find(node.get());
+            if (node->getType() != Eltwise && it != fusedInputs.end() && it->second.chainInput == input)
+                appendUnaryOps(&chain, node, onOperand);
+        }
+    };
+
+    fuseInputs(0, false);
+    if (op == EltwiseLayer::Sum && sum_scales[0] != 1.0f)
+        chain.addUnary(MKLDNNElementwiseChain::Linear, sum_scales[0]);
+    for (size_t i = 1; i < sum_scales.size(); i++) {
+        chain.addLoad(i);
+        fuseInputs(i, true);
+        chain.addBinary(toChainOp(op), op == EltwiseLayer::Sum ? sum_scales[i] : 1.0f);
+    }
+
+    for (const auto &node : fusedWith) {
+        auto it = fusedInputs.find(node.get());
+        if (node->getType() != Eltwise) {
+            if (it == fusedInputs.end() && !appendUnaryOps(&chain, node, false))
+                THROW_IE_EXCEPTION << "Cannot fuse " << node->getName() << " to " << getName();
+            continue;
+        }
+
+        auto *eltwiseLayer = dynamic_cast<EltwiseLayer *>(node->getCnnLayer().get());
+        if (eltwiseLayer == nullptr || it == fusedInputs.end())
+            THROW_IE_EXCEPTION << "Cannot fuse " << node->getName() << " to " << getName();
+        auto scales = getScales(eltwiseLayer);
+        bool isSum = eltwiseLayer->_operation == EltwiseLayer::Sum;
+
+        if (isSum && scales[it->second.chainInput] != 1.0f)
+            chain.addUnary(MKLDNNElementwiseChain::Linear, scales[it->second.chainInput]);
+        for (size_t i = 0, edge = it->second.firstEdge; i < scales.size(); i++) {
+            if (i == it->second.chainInput)
+                continue;
+            chain.addLoad(edge++);
+            chain.addBinary(toChainOp(eltwiseLayer->_operation), isSum ? scales[i] : 1.0f);
+        }
+    }
+
+    if (chain.getInputsCount() != getParentEdges().size())
+        THROW_IE_EXCEPTION << "Incorrect number of input edges of the fused eltwise node " << getName();
+}
+
 bool MKLDNNEltwiseNode::isSum() {
     auto * eltwiseLayer = dynamic_cast<EltwiseLayer*>(getCnnLayer().get());
     return eltwiseLayer->_operation == EltwiseLayer::Sum;
@@ -50,10 +212,12 @@ void MKLDNNEltwiseNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         THROW_IE_EXCEPTION << "Incorrect number of output edges.";
 
-    auto outDims = getParentEdgeAt(0)->getDims();
-    for (size_t i = 1; i < getParentEdges().size(); i++) {
+    auto outDims = getChildEdgeAt(0)->getDims();
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
         auto oDims = getParentEdgeAt(i)->getDims();
-        if (outDims.size() != oDims.size() || outDims.ndims() != oDims.ndims())
+        auto it = broadcasts.find(i);
+        size_t tiles = it != broadcasts.end() ? it->second.tiles : 1;
+        if (outDims.size() != oDims.size() * tiles || outDims.ndims() != oDims.ndims())
             THROW_IE_EXCEPTION << "Dimentions of input layers are not equal for " << eltwiseLayer->name;
     }
 
@@ -61,12 +225,17 @@ void MKLDNNEltwiseNode::getSupportedDescriptors() {
     if (op != EltwiseLayer::Sum && with_coeffs)
         THROW_IE_EXCEPTION << "Only sum operation supports operands coefficients";
 
-    if (with_coeffs && eltwiseLayer->coeff.size() != getParentEdges().size())
+    // the inputs of the fused eltwise nodes follow the own inputs of the layer
+    size_t inputsNum = fusedWith.empty() ? getParentEdges().size() : eltwiseLayer->insData.size();
+    if (with_coeffs && eltwiseLayer->coeff.size() != inputsNum)
         THROW_IE_EXCEPTION << "Number of provided coefficients is not equal to number of operands";
 
     sum_scales.clear();
-    for (int i = 0; i < getParentEdges().size(); i++)
+    for (int i = 0; i < inputsNum; i++)
         sum_scales.push_back(with_coeffs ? eltwiseLayer->coeff[i] : 1.0f);
+
+    if (op != EltwiseLayer::Sum || !fusedWith.empty() || !broadcasts.empty())
+        initChain();
 }
 
 void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
@@ -101,6 +270,15 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         return {config, impl_desc_type::ref};
     };
 
+    // the broadcast inputs are indexed by the elements of the plain layout
+    if (!broadcasts.empty()) {
+        auto& dims = getChildEdgeAt(0)->getDims();
+        if (dims.ndims() != 2 && dims.ndims() != 4)
+            THROW_IE_EXCEPTION << "Eltwise " << getName() << " supports broadcasting only for 2d and 4d dimensions!";
+        supportedPrimitiveDescriptors.push_back(same(dims.ndims() == 2 ? memory::format::nc : memory::format::nchw));
+        return;
+    }
+
     for (const auto& format : getAvailableFormatsForDims(getChildEdgeAt(0)->getDims())) {
         supportedPrimitiveDescriptors.push_back(same(format));
     }
@@ -125,12 +303,14 @@ void MKLDNNEltwiseNode::createPrimitive() {
             THROW_IE_EXCEPTION << "Source memory from " << parent->getName() << " didn't allocate.";
         }
 
-        if (op == EltwiseLayer::Sum) {
+        if (op == EltwiseLayer::Sum && chain.empty()) {
             srcs_pd.push_back(srcMemPtr->GetPrimitiveDescriptor());
             srcs_p.emplace_back(srcMemPtr->GetPrimitive());
         }
     }
-    if (op == EltwiseLayer::Sum) {
+    if (!chain.empty()) {
+        chain.compile();
+    } else if (op == EltwiseLayer::Sum) {
         auto primitive_desc = sum::primitive_desc(dstMemPtr->GetDescriptor(), sum_scales, srcs_pd);
         prim = std::shared_ptr<sum>(new sum(primitive_desc, srcs_p, dstMemPtr->GetPrimitive()));
     }
@@ -140,46 +320,58 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
     if (prim) {
         MKLDNNNode::execute(strm);
     } else {
-        IE_ASSERT(getParentEdges().size() > 1);
-
-        auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
-        auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
-        const float *src0_ptr = reinterpret_cast<const float*>(srcMemory0.GetData()) +
-                srcMemory0.GetDescriptor().data.layout_desc.blocking.offset_padding;
-        const float *src1_ptr = reinterpret_cast<const float*>(srcMemory1.GetData()) +
-                srcMemory1.GetDescriptor().data.layout_desc.blocking.offset_padding;
-        float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
-                getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
-        const size_t data_size = srcMemory0.GetSize() / sizeof(float) / srcMemory0.GetDims()[0] * batchToProcess();
-
-        if (op == EltwiseLayer::Prod) {
-            #pragma omp parallel for
-            for (int i = 0; i < data_size; i++)
-                dst_ptr[i] = src0_ptr[i] * src1_ptr[i];
-
-            for (int j = 2; j < getParentEdges().size(); j++) {
-                const float *src_ptr = reinterpret_cast<const float *>(getParentEdgeAt(j)->getMemory().GetData()) +
-                        getParentEdgeAt(j)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-                #pragma omp parallel for
-                for (int i = 0; i < data_size; i++)
-                    dst_ptr[i] = dst_ptr[i] * src_ptr[i];
-            }
-        } else if (op == EltwiseLayer::Max)  {
-            #pragma omp parallel for
-            for (int i = 0; i < data_size; i++)
-                dst_ptr[i] = std::max(src0_ptr[i], src1_ptr[i]);
-
-            for (int j = 2; j < getParentEdges().size(); j++) {
-                const float *src_ptr = reinterpret_cast<const float*>(getParentEdgeAt(j)->getMemory().GetData()) +
-                        getParentEdgeAt(j)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-                #pragma omp parallel for
-                for (int i = 0; i < data_size; i++)
-                    dst_ptr[i] = std::max(dst_ptr[i], src_ptr[i]);
-            }
+        std::vector<const float *> src_ptrs;
+        for (size_t i = 0; i < getParentEdges().size(); i++) {
+            auto& srcMemory = getParentEdgeAt(i)->getMemory();
+            src_ptrs.push_back(reinterpret_cast<const float*>(srcMemory.GetData()) +
+                               srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding);
+        }
+        auto& dstMemory = getChildEdgeAt(0)->getMemory();
+        float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+                dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+        const size_t data_size = dstMemory.GetSize() / sizeof(float) / dstMemory.GetDims()[0] * batchToProcess();
+
+        if (broadcasts.empty())
+            chain.execute(src_ptrs, dst_ptr, data_size);
+        else
+            executeBroadcast(src_ptrs, dst_ptr, data_size);
+    }
+}
+
+void MKLDNNEltwiseNode::executeBroadcast(const std::vector<const float *>& src_ptrs, float *dst_ptr,
+                                         size_t data_size) const {
+    // every row of the output reads the contiguous elements of all the inputs
+    size_t row = 0;
+    for (const auto &broadcast : broadcasts) {
+        size_t a = row, b = broadcast.second.inner;
+        while (b) {
+            size_t t = a % b;
+            a = b;
+            b = t;
         }
+        row = a;
     }
+    const size_t rows = data_size / row;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(rows, nthr, ithr, start, end);
+
+        std::vector<const float *> ptrs(src_ptrs.size());
+        for (size_t r = start; r < end; r++) {
+            const size_t offset = r * row;
+            for (size_t i = 0; i < src_ptrs.size(); i++) {
+                auto it = broadcasts.find(i);
+                if (it == broadcasts.end()) {
+                    ptrs[i] = src_ptrs[i] + offset;
+                } else {
+                    const size_t inner = it->second.inner;
+                    ptrs[i] = src_ptrs[i] + offset / (it->second.tiles * inner) * inner + offset % inner;
+                }
+            }
+            chain.executeSequential(ptrs.data(), dst_ptr + offset, row);
+        }
+    });
 }
 
 bool MKLDNNEltwiseNode::created() const {
@@ -7,6 +7,8 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <mkldnn_elementwise_chain.h>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -27,10 +29,57 @@ public:
     bool isSum();
     bool isUnitScales();
 
+    /**
+     * @brief Checks that the Power or Activation node can be computed by the elementwise chain of the eltwise node
+     */
+    static bool isUnaryFusingSupported(const MKLDNNNodePtr& node);
+
+    /**
+     * @brief Applies the unary node (see isUnaryFusingSupported) to the input before it is combined with the others
+     */
+    void fuseInputWith(size_t input, const MKLDNNNodePtr& node);
+
+    /**
+     * @brief Fuses the eltwise node which consumes the result of the chain as the input chainInput,
+     * the other inputs of the fused node are connected to this node starting from the parent edge firstEdge
+     */
+    void fuseEltwise(const MKLDNNNodePtr& eltwise, size_t chainInput, size_t firstEdge);
+
+    /**
+     * @brief Reads the input of the shape srcDims as if it was tiled tiles times along the axis by the Tile layer,
+     * so the tiled tensor is not stored in the memory
+     */
+    void broadcastInput(size_t input, const MKLDNNDims& srcDims, int axis, int tiles);
+
+    bool isBroadcastInput(size_t input) const {
+        return broadcasts.find(input) != broadcasts.end();
+    }
+
 private:
+    struct FusedInputs {
+        // the input of the fused node which is the result of the chain (for Eltwise) or which is transformed
+        // by the fused unary node (for the nodes fused to the inputs)
+        size_t chainInput;
+        size_t firstEdge;
+    };
+
+    struct Broadcast {
+        size_t tiles;
+        // the number of the elements which are copied by every tile
+        size_t inner;
+    };
+
+    void initChain();
+    void executeBroadcast(const std::vector<const float *>& src_ptrs, float *dst_ptr, size_t data_size) const;
+
     static Register<MKLDNNEltwiseNode> reg;
     InferenceEngine::EltwiseLayer::eOperation op;
     std::vector<float> sum_scales;
+    // the nodes from fusedWith which are fused to the inputs or which are Eltwise
+    std::map<const MKLDNNNode *, FusedInputs> fusedInputs;
+    // the inputs which are read with broadcasting by their parent edges
+    std::map<size_t, Broadcast> broadcasts;
+    MKLDNNElementwiseChain chain;
 };
 
 }  // namespace MKLDNNPlugin
@@ -4,10 +4,14 @@
 //
 
 #include "mkldnn_fullyconnected_node.h"
+#include "mkldnn_activation_node.h"
+#include "mkldnn_channel_linear.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <string>
 #include <vector>
+#include <memory>
+#include <algorithm>
 #include <mkldnn_extension_utils.h>
 
 using namespace mkldnn;
@@ -72,6 +76,7 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         biasesDims.push_back(static_cast<int>(fcLayer->_out_num));
         internalBlobs.push_back(createInternalBlob(biasesDims, false));
     }
+    foldScaleShift();
 
     for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
         MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
@@ -81,13 +86,53 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::foldScaleShift() {
+    size_t OC = weightsDims[0];
+    for (auto &node : fusedWith) {
+        if (node->getType() != Depthwise && node->getType() != BatchNormalization && node->getType() != Power)
+            continue;
+
+        MKLDNNChannelLinear linear;
+        if (!MKLDNNChannelLinear::fromNode(node, OC, linear))
+            THROW_IE_EXCEPTION << "Cannot fold layer " << node->getName() << " into fully connected " << getName() << ".";
+
+        if (internalBlobs.size() <= 1 && linear.hasShifts()) {
+            biasesDims = {OC};
+            TensorDesc desc(Precision::FP32, biasesDims, TensorDesc::getLayoutByDims(biasesDims));
+            auto zeroBiases = make_shared_blob<float>(desc);
+            zeroBiases->allocate();
+            std::fill_n(zeroBiases->buffer().as<float *>(), OC, 0.0f);
+            internalBlobs.push_back(zeroBiases);
+        }
+
+        float *weights = internalBlobs[0]->buffer().as<float *>();
+        float *biases = internalBlobs.size() > 1 ? internalBlobs[1]->buffer().as<float *>() : nullptr;
+        size_t K = internalBlobs[0]->size() / OC;
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t k = 0; k < K; k++)
+                weights[oc * K + k] *= linear.scales[oc];
+            if (biases)
+                biases[oc] = biases[oc] * linear.scales[oc] + linear.shifts[oc];
+        }
+    }
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || !fp16InnerProduct.empty() || !gemvInnerProduct.empty() || !sparseInnerProduct.empty())
         return;
 
     auto prim_desc = createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>();
 
-    if (internalBlobs.size() > 1) {
+    if (fp16Weights && initFP16InnerProduct()) {
+        // the primitive is not created, so only the FP16 copy of the weights stays in the memory
+        internalBlobMemory[0].reset();
+    } else if (initSparseInnerProduct()) {
+        // the nonzero weights replace the weights of the primitive
+        internalBlobMemory[0].reset();
+    } else if (getChildEdgeAt(0)->getDims()[0] == 1 && initGemvInnerProduct()) {
+        // the packed copy replaces the weights of the primitive
+        internalBlobMemory[0].reset();
+    } else if (internalBlobs.size() > 1) {
         prim.reset(new inner_product_forward(prim_desc,
                                              getParentEdgeAt(0)->getMemory().GetPrimitive(),
                                              internalBlobMemory[0]->GetPrimitive(),
@@ -99,6 +144,93 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
                                              internalBlobMemory[0]->GetPrimitive(),
                                              getChildEdgeAt(0)->getMemory().GetPrimitive()));
     }
+
+    for (auto &node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (!activationNode)
+            continue;
+
+        auto &dst = getChildEdgeAt(0)->getMemory();
+        eltwise_forward::desc activationDesc(prop_kind::forward_scoring, activationNode->getAlgorithm(),
+                                             dst.GetDescriptor(), activationNode->getAlpha(),
+                                             activationNode->getBeta());
+        eltwise_forward::primitive_desc activationPD(activationDesc, getEngine());
+        activationPrim.reset(new eltwise_forward(activationPD, dst.GetPrimitive(), dst.GetPrimitive()));
+    }
+}
+
+bool MKLDNNFullyConnectedNode::hasDenseLayouts() {
+    auto &src = getParentEdgeAt(0)->getMemory();
+    auto &dst = getChildEdgeAt(0)->getMemory();
+    auto &weights = *internalBlobMemory[0];
+    const size_t MB = src.GetDims()[0];
+    const size_t OC = weightsDims[0];
+    const size_t K = weights.GetSize() / sizeof(float) / OC;
+
+    // the rows of the source must have the layout of the rows of the weights, the output must be dense
+    return weights.GetSize() == OC * K * sizeof(float) && src.GetSize() == MB * K * sizeof(float) &&
+           dst.GetSize() == MB * OC * sizeof(float) && !dst.GetDescriptor().data.layout_desc.blocking.offset_padding;
+}
+
+bool MKLDNNFullyConnectedNode::initFP16InnerProduct() {
+    if (!hasDenseLayouts())
+        return false;
+
+    auto &weights = *internalBlobMemory[0];
+    const size_t OC = weightsDims[0];
+    const size_t K = weights.GetSize() / sizeof(float) / OC;
+    fp16InnerProduct.init(reinterpret_cast<const float *>(weights.GetData()), OC, K);
+    return true;
+}
+
+bool MKLDNNFullyConnectedNode::initGemvInnerProduct() {
+    if (!hasDenseLayouts())
+        return false;
+
+    auto &weights = *internalBlobMemory[0];
+    const size_t OC = weightsDims[0];
+    const size_t K = weights.GetSize() / sizeof(float) / OC;
+    gemvInnerProduct.init(reinterpret_cast<const float *>(weights.GetData()), OC, K);
+    return !gemvInnerProduct.empty();
+}
+
+bool MKLDNNFullyConnectedNode::initSparseInnerProduct() {
+    if (!hasDenseLayouts())
+        return false;
+
+    auto &weights = *internalBlobMemory[0];
+    const size_t OC = weightsDims[0];
+    const size_t K = weights.GetSize() / sizeof(float) / OC;
+    sparseInnerProduct.init(reinterpret_cast<const float *>(weights.GetData()), OC, K);
+    return !sparseInnerProduct.empty();
+}
+
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (!fp16InnerProduct.empty() || !gemvInnerProduct.empty() || !sparseInnerProduct.empty()) {
+        auto &src = getParentEdgeAt(0)->getMemory();
+        const float *src_data = reinterpret_cast<const float *>(src.GetData()) +
+                src.GetDescriptor().data.layout_desc.blocking.offset_padding;
+        const float *bias = internalBlobMemory.size() > 1 ?
+                reinterpret_cast<const float *>(internalBlobMemory[1]->GetData()) : nullptr;
+        float *dst_data = reinterpret_cast<float *>(getChildEdgeAt(0)->getMemory().GetData());
+
+        if (!fp16InnerProduct.empty())
+            fp16InnerProduct.execute(src_data, bias, dst_data, static_cast<size_t>(batchToProcess()));
+        else if (!sparseInnerProduct.empty())
+            sparseInnerProduct.execute(src_data, bias, dst_data, static_cast<size_t>(batchToProcess()));
+        else
+            gemvInnerProduct.execute(src_data, bias, dst_data);
+        if (activationPrim)
+            strm.submit({*activationPrim});
+        return;
+    }
+
+    if (prim) {
+        if (activationPrim)
+            strm.submit({*prim, *activationPrim});
+        else
+            strm.submit({*prim});
+    }
 }
 
 bool MKLDNNFullyConnectedNode::created() const {
@@ -7,6 +7,9 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "mkldnn_fp16_inner_product.h"
+#include "mkldnn_gemv_inner_product.h"
+#include "mkldnn_sparse_inner_product.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -20,6 +23,7 @@ public:
 
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -29,11 +33,36 @@ public:
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
 
+    /**
+     * @brief Keeps the weights in FP16 instead of the inner product primitive, the result is accumulated in FP32.
+     * The layouts are chosen as for the primitive, the FP32 weights are released after the node is created.
+     */
+    void storeWeightsInFP16() {
+        fp16Weights = true;
+    }
+
 private:
     static Register<MKLDNNFullyConnectedNode> reg;
     InferenceEngine::SizeVector weightsDims;
     InferenceEngine::SizeVector biasesDims;
+    // inner product has no post-ops, the fused activation is applied in place to the output
+    std::shared_ptr<mkldnn::primitive> activationPrim;
+    bool fp16Weights = false;
+    MKLDNNFP16InnerProduct fp16InnerProduct;
+    bool initFP16InnerProduct();
+    // the inner product of the batch 1 with the packed weights
+    MKLDNNGemvInnerProduct gemvInnerProduct;
+    bool initGemvInnerProduct();
+    // the inner product of the pruned weights, see MKLDNNSparseInnerProduct::maxDensity
+    MKLDNNSparseInnerProduct sparseInnerProduct;
+    bool initSparseInnerProduct();
+    bool hasDenseLayouts();
     mkldnn::memory::format weightsFormatForSrcFormat(mkldnn::memory::format sourceFormat);
+    /**
+     * @brief Multiplies the weights and the biases by the ScaleShift, BatchNormalization or Power fused
+     * into the fully connected layer
+     */
+    void foldScaleShift();
 };
 
 }  // namespace MKLDNNPlugin
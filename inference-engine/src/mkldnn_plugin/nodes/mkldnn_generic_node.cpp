@@ -159,17 +159,21 @@ void MKLDNNGenericNode::createPrimitive() {
 
 void MKLDNNGenericNode::execute(mkldnn::stream strm) {
     if (genericPrimitive) {
-        for (size_t i = 0; i < getParentEdges().size(); i++) {
-            auto& mklMemory = getParentEdgeAt(i)->getMemory();
-            inputs.push_back(MKLDNNExtensionUtils::MKLMemoryToGenericMemory(mklMemory));
-        }
+        if (edgesPtrsChanged()) {
+            inputs.clear();
+            outputs.clear();
+            for (size_t i = 0; i < getParentEdges().size(); i++) {
+                auto& mklMemory = getParentEdgeAt(i)->getMemory();
+                inputs.push_back(MKLDNNExtensionUtils::MKLMemoryToGenericMemory(mklMemory));
+            }
 
-        for (size_t i = 0; i < getChildEdges().size(); i++) {
-            auto& mklMemory = getChildEdgeAt(i)->getMemory();
-            outputs.push_back(MKLDNNExtensionUtils::MKLMemoryToGenericMemory(mklMemory));
-        }
+            for (size_t i = 0; i < getChildEdges().size(); i++) {
+                auto& mklMemory = getChildEdgeAt(i)->getMemory();
+                outputs.push_back(MKLDNNExtensionUtils::MKLMemoryToGenericMemory(mklMemory));
+            }
 
-        genericPrimitive->SetMemory(inputs, outputs);
+            genericPrimitive->SetMemory(inputs, outputs);
+        }
         genericPrimitive->Execute();
     } else if (!impls.empty()) {
         execLayer();
@@ -201,9 +205,48 @@ void MKLDNNGenericNode::cleanup() {
     extFactory.reset();
 }
 
+bool MKLDNNGenericNode::edgesPtrsChanged() {
+    const size_t edgesNum = getParentEdges().size() + getChildEdges().size();
+    bool changed = edgesPtrs.size() != edgesNum;
+    edgesPtrs.resize(edgesNum);
+    for (size_t i = 0; i < edgesNum; i++) {
+        const size_t parentsNum = getParentEdges().size();
+        void *ptr = i < parentsNum ? getParentEdgeAt(i)->getMemory().GetData()
+                                   : getChildEdgeAt(i - parentsNum)->getMemory().GetData();
+        if (edgesPtrs[i] != ptr) {
+            edgesPtrs[i] = ptr;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
 void MKLDNNGenericNode::execLayer() {
+    if (edgesPtrsChanged())
+        layerBlobs.clear();
+
+    const int batch = batchToProcess();
+    auto found = layerBlobs.find(batch);
+    if (found == layerBlobs.end())
+        found = layerBlobs.emplace(batch, createLayerBlobs()).first;
+
+    if (!execImpl)
+        execImpl = dynamic_cast<InferenceEngine::ILayerExecImpl *>(impls[0].get());
+    if (execImpl != nullptr) {
+        InferenceEngine::ResponseDesc resp;
+        InferenceEngine::StatusCode rc = execImpl->execute(found->second.inputs, found->second.outputs, &resp);
+        if (rc != InferenceEngine::OK) {
+            THROW_IE_EXCEPTION << resp.msg;
+        }
+    }
+}
+
+MKLDNNGenericNode::LayerBlobs MKLDNNGenericNode::createLayerBlobs() {
+    LayerBlobs blobs;
+    std::vector<InferenceEngine::Blob::Ptr> &inputs = blobs.inputs;
+    std::vector<InferenceEngine::Blob::Ptr> &outputs = blobs.outputs;
+
     bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
     std::vector<InferenceEngine::TensorDesc> inputDescs;
     std::vector<InferenceEngine::TensorDesc> outputDescs;
     for (size_t i = 0; i < getParentEdges().size(); i++) {
@@ -230,7 +273,6 @@ void MKLDNNGenericNode::execLayer() {
             inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
         }
     }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
     for (size_t i = 0; i < getChildEdges().size(); i++) {
         if (isDynBatch) {
             size_t idx = i >= outputDescs.size() ? 0 : i;
@@ -241,14 +283,7 @@ void MKLDNNGenericNode::execLayer() {
             outputs.push_back(getChildEdgeAt(i)->getBlob());
         }
     }
-    auto * execImpl = dynamic_cast<InferenceEngine::ILayerExecImpl *>(impls[0].get());
-    if (execImpl != nullptr) {
-        InferenceEngine::ResponseDesc resp;
-        InferenceEngine::StatusCode rc = execImpl->execute(inputs, outputs, &resp);
-        if (rc != InferenceEngine::OK) {
-            THROW_IE_EXCEPTION << resp.msg;
-        }
-    }
+    return blobs;
 }
 
 MKLDNNGenericNode::~MKLDNNGenericNode() {
@@ -310,14 +345,26 @@ void MKLDNNGenericNode::initDescriptor(const InferenceEngine::LayerConfig &confi
             }
         }
 
+        // The extension may compute the output in the memory of the input, it is allowed when the input data is read
+        // by this layer only, is not the folded constant data and has the same dimensions as the output
+        auto canShare = [&](size_t inIdx, size_t outIdx) {
+            if (inIdx >= getParentEdges().size() || outIdx >= getChildEdges().size())
+                return false;
+            auto parentEdge = getParentEdgeAt(inIdx);
+            auto parent = parentEdge->getParent();
+            if (parent->getChildEdges().size() > 1 || (parent->isConstant() && !isConstant()))
+                return false;
+            return parentEdge->getDims() == getChildEdgeAt(outIdx)->getDims();
+        };
         for (size_t j = 0; j < rightConfig.inConfs.size(); j++) {
-            if (getParentEdgeAt(j)->getParent()->getChildEdges().size() > 1) {
-                rightConfig.inConfs[j].inPlace = -1;
+            auto &inConf = rightConfig.inConfs[j];
+            if (inConf.inPlace >= 0 && !canShare(j, static_cast<size_t>(inConf.inPlace))) {
+                inConf.inPlace = -1;
             }
         }
-        for (auto &outConf : rightConfig.outConfs) {
-            if (outConf.inPlace < getParentEdges().size() &&
-                getParentEdgeAt(static_cast<size_t>(outConf.inPlace))->getParent()->getChildEdges().size() > 1) {
+        for (size_t j = 0; j < rightConfig.outConfs.size(); j++) {
+            auto &outConf = rightConfig.outConfs[j];
+            if (outConf.inPlace >= 0 && !canShare(static_cast<size_t>(outConf.inPlace), j)) {
                 outConf.inPlace = -1;
             }
         }
@@ -325,6 +372,8 @@ void MKLDNNGenericNode::initDescriptor(const InferenceEngine::LayerConfig &confi
 
         impls.clear();
         impls.emplace_back(selectedImpl);
+        execImpl = nullptr;
+        layerBlobs.clear();
         rc = impls[0]->init(rightConfig, &resp);
         if (rc != InferenceEngine::OK) {
             THROW_IE_EXCEPTION << resp.msg;
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <map>
 
 namespace MKLDNNPlugin {
 
@@ -42,10 +43,24 @@ protected:
     std::vector<InferenceEngine::ILayerImpl::Ptr> impls;
 
 private:
+    struct LayerBlobs {
+        std::vector<InferenceEngine::Blob::Ptr> inputs;
+        std::vector<InferenceEngine::Blob::Ptr> outputs;
+    };
+
+    bool edgesPtrsChanged();
+    LayerBlobs createLayerBlobs();
+
     static Register<MKLDNNGenericNode> reg;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::MKLDNNPlugin::MKLDNNPrimitiveMemory> inputs;
     std::vector<InferenceEngine::MKLDNNPlugin::MKLDNNPrimitiveMemory> outputs;
+
+    // the blobs passed to the extension layer are created once per batch to process and reused by the next
+    // inferences, they are dropped when the memory of some edge is changed (e.g. by the zero-copy infer request)
+    std::vector<void*> edgesPtrs;
+    std::map<int, LayerBlobs> layerBlobs;
+    InferenceEngine::ILayerExecImpl *execImpl = nullptr;
 };
 
 }  // namespace MKLDNNPlugin
@@ -4,9 +4,12 @@
 //
 
 #include <string>
+#include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_memory_node.hpp"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -49,7 +52,64 @@ const MKLDNNEdgePtr MKLDNNMemoryOutputNode::getChildEdgeAt(size_t idx) const {
     return MKLDNNNode::getChildEdgeAt(idx);
 }
 
+// the nodes keeping the pointers to the memory or sharing it with other edges without offsets
+static bool canRebindMemoryOf(const MKLDNNNodePtr &node) {
+    if (node->getType() == Input || node->getType() == Output || node->isConstant())
+        return false;
+    auto* concat = dynamic_cast<MKLDNNConcatNode *>(node.get());
+    if (concat && concat->isOptimized())
+        return false;
+    return dynamic_cast<MKLDNNSplitNode *>(node.get()) == nullptr;
+}
+
+void MKLDNNMemoryOutputNode::initStateSwap(const std::vector<MKLDNNEdgePtr> &graphEdges) {
+    srcStateViews.clear();
+    dstStateViews.clear();
+    if (inputNode == nullptr)
+        return;
+
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    if (!(srcMemory.GetPrimitiveDescriptor() == dstMemory.GetPrimitiveDescriptor()))
+        return;
+
+    auto *src = static_cast<uint8_t *>(srcMemory.GetData());
+    auto *dst = static_cast<uint8_t *>(dstMemory.GetData());
+    const size_t size = srcMemory.GetSize();
+    if (src == dst || (src < dst + size && dst < src + size))
+        return;
+
+    std::vector<StateView> srcViews, dstViews;
+    for (auto &edge : graphEdges) {
+        auto *data = static_cast<uint8_t *>(edge->getMemory().GetData());
+        bool isSrcView = data >= src && data < src + size;
+        bool isDstView = data >= dst && data < dst + size;
+        if (!isSrcView && !isDstView)
+            continue;
+        if (edge->getParent().get() != inputNode && !canRebindMemoryOf(edge->getParent()))
+            return;
+        if (edge->getChild().get() != this && !canRebindMemoryOf(edge->getChild()))
+            return;
+        (isSrcView ? srcViews : dstViews).push_back({edge, static_cast<size_t>(data - (isSrcView ? src : dst))});
+    }
+
+    srcStateViews = srcViews;
+    dstStateViews = dstViews;
+}
+
 void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
+    if (!srcStateViews.empty()) {
+        // the buffers are taken from the edges every time, so they are valid after the memory of the graph is moved;
+        // the new state is read by the consumers of the input sibling, the previous one is overwritten next time
+        auto *srcState = static_cast<uint8_t *>(getParentEdgeAt(0)->getMemory().GetData());
+        auto *dstState = static_cast<uint8_t *>(getChildEdgeAt(0)->getMemory().GetData());
+        for (auto &view : srcStateViews)
+            view.edge.lock()->getMemory().GetPrimitivePtr()->set_data_handle(dstState + view.offset);
+        for (auto &view : dstStateViews)
+            view.edge.lock()->getMemory().GetPrimitivePtr()->set_data_handle(srcState + view.offset);
+        return;
+    }
+
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
     const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
@@ -83,6 +143,7 @@ MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
 }
 
 void MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
+    std::lock_guard<std::mutex> lock(getExistedMutex());
     // in case of output already registered
     auto sibling = MKLDNNMemoryNodeVirtualEdge::getByName(node->getId());
     if (sibling != nullptr) {
@@ -96,6 +157,7 @@ void MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
 }
 
 void MKLDNNMemoryNodeVirtualEdge::registerOutput(MKLDNNMemoryOutputNode * node) {
+    std::lock_guard<std::mutex> lock(getExistedMutex());
     // in case of output layer
     auto sibling = MKLDNNMemoryNodeVirtualEdge::getByName(node->getId());
     if (sibling != nullptr) {
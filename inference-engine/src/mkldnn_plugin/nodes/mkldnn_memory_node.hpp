@@ -12,6 +12,8 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <mutex>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -43,6 +45,12 @@ class MKLDNNMemoryNodeVirtualEdge {
         return existed;
     }
 
+    // the nodes are registered by the graphs of the networks which may be loaded concurrently
+    static std::mutex & getExistedMutex() {
+        static std::mutex existedMutex;
+        return existedMutex;
+    }
+
     static MKLDNNMemoryNode * getByName(std::string name) {
         auto result = getExisted().find(name);
         if (result != getExisted().end()) {
@@ -55,6 +63,7 @@ class MKLDNNMemoryNodeVirtualEdge {
     static void registerOutput(MKLDNNMemoryOutputNode * node);
     static void registerInput(MKLDNNMemoryInputNode * node);
     static void remove(MKLDNNMemoryNode * node) {
+        std::lock_guard<std::mutex> lock(getExistedMutex());
         InferenceEngine::details::erase_if(getExisted(), [&](const Holder::value_type & it){
             return it.second == node;
         });
@@ -78,11 +87,29 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     void setInputNode(MKLDNNNode* node) override {
         inputNode = node;
     }
+
+    /**
+     * @brief Makes the state written by the previous layer and the state read by the consumers of the input
+     * sibling node two buffers which are swapped on every execution instead of the copy of the state.
+     * The state is still copied if the memory of any edge viewing these buffers cannot be rebound.
+     * @param graphEdges all allocated edges of the graph
+     */
+    void initStateSwap(const std::vector<MKLDNNEdgePtr> &graphEdges);
+
  private:
+    // the edge is resolved on the execution, as the memory of the graph may be rebased after initStateSwap()
+    struct StateView {
+        MKLDNNEdgeWeakPtr edge;
+        size_t offset;
+    };
+
     /**
      * @brief keeps reference to input sibling node
      */
     MKLDNNNode* inputNode = nullptr;
+    // the edges using the state written by the previous layer and the state read by the consumers of inputNode
+    std::vector<StateView> srcStateViews;
+    std::vector<StateView> dstStateViews;
     static Register<MKLDNNMemoryOutputNode> reg;
 };
 
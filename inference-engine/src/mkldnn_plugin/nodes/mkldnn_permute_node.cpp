@@ -6,8 +6,13 @@
 #include "mkldnn_permute_node.h"
 #include <ie_layers.h>
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -126,89 +131,160 @@ static void permute_to_0231(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr&
     }
 }
 
-template <size_t scale_H = 0, size_t scale_W = 0>
-static void permute_to_014253(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-    const int C  = srcMemPtr->GetDims()[1];
-    const int CH  = scale_H > 0 ? static_cast<int>(scale_H) : srcMemPtr->GetDims()[2];
-    const int CW  = scale_W > 0 ? static_cast<int>(scale_W) : srcMemPtr->GetDims()[3];
-    const int H  = srcMemPtr->GetDims()[4];
-    const int W  = srcMemPtr->GetDims()[5];
+std::map<InferenceEngine::SizeVector, MKLDNNPermuteNode::PermuteImpl> MKLDNNPermuteNode::OptimizedCases = {
+        {{0, 2, 3, 1}, MKLDNNPermuteNode::PermuteImpl(permute_to_0231, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
+            return true;
+        })},  // NCHW -> NHWC case of the blocked layouts
+};
 
-    int src_off = 0;
-    int dst_off = 0;
+bool MKLDNNPermuteNode::prepareTransposePlan(int MB) {
+    if (plan.batch == MB)
+        return plan.applicable;
+
+    plan = TransposePlan();
+    plan.batch = MB;
+
+    const auto &srcDesc = getParentEdgeAt(0)->getMemory().GetDescriptor().data;
+    const auto &dstDesc = getChildEdgeAt(0)->getMemory().GetDescriptor().data;
+    const int ndims = srcDesc.ndims;
+    if (ndims != dstDesc.ndims || ndims != static_cast<int>(order.size()) ||
+            srcDesc.format == mkldnn_format_undef || srcDesc.format == mkldnn_any ||
+            dstDesc.format == mkldnn_format_undef || dstDesc.format == mkldnn_any)
+        return false;
+    // the inner blocks (e.g. nChw8c) are permuted by the special cases or by the reference code
+    for (int i = 0; i < ndims; i++) {
+        if (srcDesc.layout_desc.blocking.block_dims[i] != 1 || dstDesc.layout_desc.blocking.block_dims[i] != 1)
+            return false;
+    }
 
-    for (int n = 0; n < MB; n++) {
-        for (int c = 0; c < C; c++) {
-            for (int h = 0; h < H; h++) {
-                for (int ch = 0; ch < CH; ch++) {
-                    for (int w = 0; w < W; w++) {
-                        for (int cw = 0; cw < CW; cw++) {
-                            src_off = n * C * CH * CW * H * W +
-                                      c * CH * CW * H * W +
-                                      ch * CW * H * W +
-                                      cw * H * W +
-                                      h * W +
-                                      w;
-
-                            dst_data[dst_off] = src_data[src_off];
-                            dst_off++;
-                        }
-                    }
-                }
-            }
+    struct Dim {
+        size_t size;
+        size_t srcStride;
+        size_t dstStride;
+    };
+    std::vector<Dim> permDims;
+    for (int i = 0; i < ndims; i++) {
+        size_t size = order[i] == 0 ? static_cast<size_t>(MB) : static_cast<size_t>(srcDesc.dims[order[i]]);
+        if (size == 1)
+            continue;
+        permDims.push_back({size, static_cast<size_t>(srcDesc.layout_desc.blocking.strides[0][order[i]]),
+                            static_cast<size_t>(dstDesc.layout_desc.blocking.strides[0][i])});
+    }
+    std::stable_sort(permDims.begin(), permDims.end(), [](const Dim &a, const Dim &b) {
+        return a.dstStride > b.dstStride;
+    });
+    if (permDims.empty())
+        permDims.push_back({1, 1, 1});
+
+    for (const auto &dim : permDims) {
+        if (!plan.dims.empty() && plan.srcStrides.back() == dim.size * dim.srcStride &&
+                plan.dstStrides.back() == dim.size * dim.dstStride) {
+            plan.dims.back() *= dim.size;
+            plan.srcStrides.back() = dim.srcStride;
+            plan.dstStrides.back() = dim.dstStride;
+        } else {
+            plan.dims.push_back(dim.size);
+            plan.srcStrides.push_back(dim.srcStride);
+            plan.dstStrides.push_back(dim.dstStride);
         }
     }
+    for (size_t i = 0; i < plan.dims.size(); i++) {
+        if (plan.srcStrides[i] == 1)
+            plan.srcInner = static_cast<int>(i);
+    }
+    // both memories must have a contiguous dimension (the views with the strides are fine)
+    if (plan.dstStrides.back() != 1 || plan.srcInner < 0)
+        return false;
+
+    plan.srcOffset = srcDesc.layout_desc.blocking.offset_padding;
+    plan.dstOffset = dstDesc.layout_desc.blocking.offset_padding;
+    plan.applicable = true;
+    return true;
 }
 
-static void permute_to_3012(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-    const int C  = srcMemPtr->GetDims()[1];
-    const int H  = srcMemPtr->GetDims()[2];
-    const int W  = srcMemPtr->GetDims()[3];
-
-    int src_off = 0;
-    int dst_off = 0;
-
-    for (int w = 0; w < W; w++) {
-        for (int n = 0; n < MB; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int h = 0; h < H; h++) {
-                     src_off = n * C * H * W +
-                               c * H * W +
-                               h * W +
-                               w;
-
-                     dst_data[dst_off] = src_data[src_off];
-                     dst_off++;
-                }
-            }
+static inline void transpose_tile(const float *src, float *dst, size_t rows, size_t cols,
+                                  size_t src_stride, size_t dst_stride) {
+    // src is rows x cols with the contiguous rows, dst is cols x rows with the contiguous rows
+    size_t r = 0;
+    for (; r + 4 <= rows; r += 4) {
+        size_t c = 0;
+        for (; c + 4 <= cols; c += 4) {
+            __m128 row0 = _mm_loadu_ps(src + (r + 0) * src_stride + c);
+            __m128 row1 = _mm_loadu_ps(src + (r + 1) * src_stride + c);
+            __m128 row2 = _mm_loadu_ps(src + (r + 2) * src_stride + c);
+            __m128 row3 = _mm_loadu_ps(src + (r + 3) * src_stride + c);
+            _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+            _mm_storeu_ps(dst + (c + 0) * dst_stride + r, row0);
+            _mm_storeu_ps(dst + (c + 1) * dst_stride + r, row1);
+            _mm_storeu_ps(dst + (c + 2) * dst_stride + r, row2);
+            _mm_storeu_ps(dst + (c + 3) * dst_stride + r, row3);
+        }
+        for (; c < cols; c++) {
+            for (size_t rr = r; rr < r + 4; rr++)
+                dst[c * dst_stride + rr] = src[rr * src_stride + c];
         }
     }
+    for (; r < rows; r++) {
+        for (size_t c = 0; c < cols; c++)
+            dst[c * dst_stride + r] = src[r * src_stride + c];
+    }
 }
 
-std::map<InferenceEngine::SizeVector, MKLDNNPermuteNode::PermuteImpl> MKLDNNPermuteNode::OptimizedCases = {
-        {{0, 2, 3, 1}, MKLDNNPermuteNode::PermuteImpl(permute_to_0231, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return true;
-        })},  // NCHW -> NHWC case
-        {{0, 1, 4, 2, 5, 3}, MKLDNNPermuteNode::PermuteImpl(permute_to_014253<2, 2>, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat()) && srcMemPtr->GetDims()[2] == 2 && srcMemPtr->GetDims()[3] == 2;
-        })},  // Dense upsample convolution case (scale = 2)
-        {{0, 1, 4, 2, 5, 3}, MKLDNNPermuteNode::PermuteImpl(permute_to_014253<0, 0>, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat());
-        })},  // Dense upsample convolution case (generic)
-        {{3, 0, 1, 2}, MKLDNNPermuteNode::PermuteImpl(permute_to_3012, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat());
-        })},  // LPR case
-};
+void MKLDNNPermuteNode::transpose(const float *src_data, float *dst_data) {
+    src_data += plan.srcOffset;
+    dst_data += plan.dstOffset;
+
+    const auto &dims = plan.dims;
+    const auto &srcStrides = plan.srcStrides;
+    const auto &dstStrides = plan.dstStrides;
+    const int last = static_cast<int>(dims.size()) - 1;
+    const int inner = plan.srcInner;
+
+    // the offsets of the outer dimensions (all but the skipped ones) of the linear index
+    auto outerOffsets = [&](size_t idx, int skip0, int skip1, size_t &srcOff, size_t &dstOff) {
+        srcOff = 0;
+        dstOff = 0;
+        for (int d = last; d >= 0; d--) {
+            if (d == skip0 || d == skip1)
+                continue;
+            const size_t i = idx % dims[d];
+            idx /= dims[d];
+            srcOff += i * srcStrides[d];
+            dstOff += i * dstStrides[d];
+        }
+    };
+
+    size_t total = 1;
+    for (auto dim : dims)
+        total *= dim;
+
+    if (inner == last) {
+        // the innermost dimension is contiguous in both memories, so the rows are copied
+        const size_t rowSize = dims[last];
+        parallel_for(total / rowSize, [&](size_t row) {
+            size_t srcOff, dstOff;
+            outerOffsets(row, last, last, srcOff, dstOff);
+            memcpy(dst_data + dstOff, src_data + srcOff, rowSize * sizeof(float));
+        });
+    } else {
+        // the tiles of the two dimensions contiguous in one of the memories are transposed,
+        // the size of the tile keeps both the source and the destination lines in the cache
+        const size_t tile = 32;
+        const size_t rows = dims[last];
+        const size_t cols = dims[inner];
+        const size_t outer = total / rows / cols;
+        parallel_for3d(outer, div_up(rows, tile), div_up(cols, tile), [&](size_t o, size_t tr, size_t tc) {
+            size_t srcOff, dstOff;
+            outerOffsets(o, last, inner, srcOff, dstOff);
+            const size_t r = tr * tile;
+            const size_t c = tc * tile;
+            transpose_tile(src_data + srcOff + r * srcStrides[last] + c,
+                           dst_data + dstOff + c * dstStrides[inner] + r,
+                           std::min(tile, rows - r), std::min(tile, cols - c),
+                           srcStrides[last], dstStrides[inner]);
+        });
+    }
+}
 
 void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
@@ -217,7 +293,9 @@ void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
     auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
 
     auto perm = OptimizedCases.find(order);
-    if (perm != OptimizedCases.end() && perm->second.isValidParams(srcMemPtr, dstMemPtr)) {
+    if (prepareTransposePlan(batchToProcess())) {
+        transpose(src_data, dst_data);
+    } else if (perm != OptimizedCases.end() && perm->second.isValidParams(srcMemPtr, dstMemPtr)) {
         perm->second.execute(batchToProcess(), srcMemPtr, dstMemPtr);
     } else {
         auto srcBlob = getParentEdgeAt(0)->getBlob();
@@ -231,10 +309,9 @@ void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
         TensorDesc dstDesc(InferenceEngine::Precision::FP32, dims, {orderedDims, order});
 
         size_t dataSize = srcBlob->size() / srcDesc.getDims()[0] * batchToProcess();
-#pragma omp parallel for
-        for (size_t i = 0; i < dataSize; i++) {
+        InferenceEngine::parallel_for(dataSize, [&](size_t i) {
             dst_data[dstDesc.offset(i)] = src_data[srcDesc.offset(i)];
-        }
+        });
     }
 }
 
@@ -29,8 +29,29 @@ public:
     }
 
 private:
+    /**
+     * @brief The permutation of the non-blocked layouts as the copy of the contiguous rows or as the transpose
+     * of the 2D tiles, the dimensions of the permutation are merged where they stay contiguous in both memories
+     */
+    struct TransposePlan {
+        int batch = 0;
+        bool applicable = false;
+        // the merged dimensions sorted by the destination strides (the innermost is the last)
+        std::vector<size_t> dims;
+        std::vector<size_t> srcStrides;
+        std::vector<size_t> dstStrides;
+        // the dimension contiguous in the source memory
+        int srcInner = -1;
+        size_t srcOffset = 0;
+        size_t dstOffset = 0;
+    };
+
+    bool prepareTransposePlan(int MB);
+    void transpose(const float *src_data, float *dst_data);
+
     static Register<MKLDNNPermuteNode> reg;
     InferenceEngine::SizeVector order;
+    TransposePlan plan;
 
     typedef std::function<void(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr)> permuteImpl;
     typedef std::function<bool(MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr)> isApplicable;
@@ -10,6 +10,7 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <limits>
+#include <ie_parallel.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -84,6 +85,16 @@ void MKLDNNPowerNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Input memory didn't allocate.";
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+
+    chain.clear();
+    if (power == 1.0f || power == 2.0f || power == 0.5f) {
+        chain.addUnary(MKLDNNElementwiseChain::Linear, scale, shift);
+        if (power == 2.0f)
+            chain.addUnary(MKLDNNElementwiseChain::Square);
+        else if (power == 0.5f)
+            chain.addUnary(MKLDNNElementwiseChain::Sqrt);
+        chain.compile();
+    }
 }
 
 void MKLDNNPowerNode::execute(mkldnn::stream strm) {
@@ -96,14 +107,12 @@ void MKLDNNPowerNode::execute(mkldnn::stream strm) {
     float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
             dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-    if (power == 1.0f) {
-        #pragma omp parallel for
-        for (int i = 0; i < data_size; i++)
-            dst_ptr[i] = src_ptr[i] * scale + shift;
+    if (!chain.empty()) {
+        chain.execute({src_ptr}, dst_ptr, data_size);
     } else {
-        #pragma omp parallel for
-        for (int i = 0; i < data_size; i++)
+        InferenceEngine::parallel_for(data_size, [&](size_t i) {
             dst_ptr[i] = pow(src_ptr[i] * scale + shift, power);
+        });
     }
 }
 
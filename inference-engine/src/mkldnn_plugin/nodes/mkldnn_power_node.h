@@ -7,6 +7,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <mkldnn_elementwise_chain.h>
 #include <string>
 
 namespace MKLDNNPlugin {
@@ -27,6 +28,8 @@ private:
     float scale;
     float shift;
     float power;
+    // the powers 1, 2 and 0.5 are computed by the JIT kernel
+    MKLDNNElementwiseChain chain;
 };
 
 }  // namespace MKLDNNPlugin
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -133,16 +134,20 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
         const auto* src_data = srcBlbPtr->cbuffer().as<const float *>();
         auto* dst_data = dstBlbPtr->buffer().as<float *>();
 
-#   pragma omp parallel for
-        for (size_t i = 0; i < data_size; i++) {
+        InferenceEngine::parallel_for(data_size, [&](size_t i) {
             dst_data[dstBlbPtr->getTensorDesc().offset(i)] = src_data[srcBlbPtr->getTensorDesc().offset(i)];
-        }
+        });
     }
 }
 
 void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
     dynBatchLim = lim;
-    if (prim) {
+    if (!prim)
+        return;
+
+    const int batch = batchToProcess();
+    auto found = batchReorders.find(batch);
+    if (found == batchReorders.end()) {
         auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
         auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
         memory::desc src_d = srcMemPtr->GetDescriptor();
@@ -156,15 +161,23 @@ void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
             src_data_hdl = src_blocked->GetPrimitive().get_data_handle();
             dst_data_hdl = dst_blocked->GetPrimitive().get_data_handle();
         }
-        src_blocked = std::make_shared<MKLDNNMemory>(getEngine());
-        src_d.data.dims[0] = batchToProcess();
-        src_d.data.layout_desc.blocking.padding_dims[0] = batchToProcess();
-        src_blocked->Create(src_d, src_data_hdl);
-
-        dst_blocked = std::make_shared<MKLDNNMemory>(getEngine());
-        dst_d.data.dims[0] = batchToProcess();
-        dst_d.data.layout_desc.blocking.padding_dims[0] = batchToProcess();
-        dst_blocked->Create(dst_d, dst_data_hdl);
-        prim.reset(new mkldnn::reorder(src_blocked->GetPrimitive(), dst_blocked->GetPrimitive()));
+        BatchReorder batchReorder;
+        batchReorder.src_blocked = std::make_shared<MKLDNNMemory>(getEngine());
+        src_d.data.dims[0] = batch;
+        src_d.data.layout_desc.blocking.padding_dims[0] = batch;
+        batchReorder.src_blocked->Create(src_d, src_data_hdl);
+
+        batchReorder.dst_blocked = std::make_shared<MKLDNNMemory>(getEngine());
+        dst_d.data.dims[0] = batch;
+        dst_d.data.layout_desc.blocking.padding_dims[0] = batch;
+        batchReorder.dst_blocked->Create(dst_d, dst_data_hdl);
+        batchReorder.prim = std::make_shared<mkldnn::reorder>(batchReorder.src_blocked->GetPrimitive(),
+                                                              batchReorder.dst_blocked->GetPrimitive());
+        found = batchReorders.emplace(batch, batchReorder).first;
     }
+
+    // the data handles are set by execute()
+    src_blocked = found->second.src_blocked;
+    dst_blocked = found->second.dst_blocked;
+    prim = found->second.prim;
 }
@@ -8,6 +8,7 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 #include <string>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -43,6 +44,14 @@ private:
 
     MKLDNNMemoryPtr dst_blocked;
     MKLDNNMemoryPtr src_blocked;
+
+    // the reorders prepared for the batch limits (see setDynamicBatchLim), so switching between them is cheap
+    struct BatchReorder {
+        MKLDNNMemoryPtr src_blocked;
+        MKLDNNMemoryPtr dst_blocked;
+        std::shared_ptr<mkldnn::primitive> prim;
+    };
+    std::map<int, BatchReorder> batchReorders;
 };
 
 }  // namespace MKLDNNPlugin
@@ -130,36 +130,52 @@ void MKLDNNReshapeNode::createPrimitive() {
 
 void MKLDNNReshapeNode::setDynamicBatchLim(int lim) {
     dynBatchLim = lim;
-    if (srcPrim && dstPrim) {
+    if (!srcPrim || !dstPrim)
+        return;
+
+    // the reorders of createPrimitive() are kept for the full batch, they own the intermediate data
+    if (batchReorders.empty())
+        batchReorders[getMaxBatch()] = {srcMem, dstMem, src_blocked, dst_blocked, srcPrim, dstPrim};
+
+    const int batch = batchToProcess();
+    auto found = batchReorders.find(batch);
+    if (found == batchReorders.end()) {
+        auto withBatch = [batch](memory::desc desc) {
+            desc.data.dims[0] = batch;
+            desc.data.layout_desc.blocking.padding_dims[0] = batch;
+            return desc;
+        };
         auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
         auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
-        memory::desc src_d = srcMemPtr->GetDescriptor();
-        memory::desc dst_d = dstMemPtr->GetDescriptor();
-        void *src_data_hdl = srcMemPtr->GetPrimitive().get_data_handle();
-        void *dst_data_hdl = dstMemPtr->GetPrimitive().get_data_handle();
-        srcMem = std::make_shared<MKLDNNMemory>(getEngine());
-        src_d.data.dims[0] = batchToProcess();
-        srcMem->Create(src_d, src_data_hdl);
-        dstMemPtr = std::make_shared<MKLDNNMemory>(getEngine());
-        src_d.data.dims[0] = batchToProcess();
-        dstMemPtr->Create(src_d, src_data_hdl);
-
-        if (src_blocked && dst_blocked) {
-            src_d = src_blocked->GetDescriptor();
-            dst_d = dst_blocked->GetDescriptor();
-            src_data_hdl = src_blocked->GetPrimitive().get_data_handle();
-            dst_data_hdl = dst_blocked->GetPrimitive().get_data_handle();
-        }
-        src_blocked = std::make_shared<MKLDNNMemory>(getEngine());
-        src_d.data.dims[0] = batchToProcess();
-        src_blocked->Create(src_d, src_data_hdl);
-
-        dst_blocked = std::make_shared<MKLDNNMemory>(getEngine());
-        dst_d.data.dims[0] = batchToProcess();
-        dst_blocked->Create(dst_d, dst_data_hdl);
-        srcPrim = std::make_shared<mkldnn::reorder>(src_blocked->GetPrimitive(), srcMem->GetPrimitive());
-        dstPrim = std::make_shared<mkldnn::reorder>(dst_blocked->GetPrimitive(), dstMemPtr->GetPrimitive());
+        const MKLDNNMemoryPtr &srcSide = src_blocked ? src_blocked : srcMemPtr;
+        const MKLDNNMemoryPtr &dstSide = dst_blocked ? dst_blocked : dstMemPtr;
+
+        // the plain intermediate memories share the data, as the ones created by createPrimitive()
+        BatchReorders reorders;
+        reorders.srcMem = std::make_shared<MKLDNNMemory>(getEngine());
+        reorders.srcMem->Create(withBatch(srcMem->GetDescriptor()), srcMem->GetData());
+        reorders.dstMem = std::make_shared<MKLDNNMemory>(getEngine());
+        reorders.dstMem->Create(withBatch(dstMem->GetDescriptor()), srcMem->GetData());
+
+        reorders.src_blocked = std::make_shared<MKLDNNMemory>(getEngine());
+        reorders.src_blocked->Create(withBatch(srcSide->GetDescriptor()), srcSide->GetData());
+        reorders.dst_blocked = std::make_shared<MKLDNNMemory>(getEngine());
+        reorders.dst_blocked->Create(withBatch(dstSide->GetDescriptor()), dstSide->GetData());
+
+        reorders.srcPrim = std::make_shared<mkldnn::reorder>(reorders.src_blocked->GetPrimitive(),
+                                                             reorders.srcMem->GetPrimitive());
+        reorders.dstPrim = std::make_shared<mkldnn::reorder>(reorders.dstMem->GetPrimitive(),
+                                                             reorders.dst_blocked->GetPrimitive());
+        found = batchReorders.emplace(batch, reorders).first;
     }
+
+    // the data handles of the edges are set by execute()
+    srcMem = found->second.srcMem;
+    dstMem = found->second.dstMem;
+    src_blocked = found->second.src_blocked;
+    dst_blocked = found->second.dst_blocked;
+    srcPrim = found->second.srcPrim;
+    dstPrim = found->second.dstPrim;
 }
 
 void MKLDNNReshapeNode::execute(mkldnn::stream strm) {
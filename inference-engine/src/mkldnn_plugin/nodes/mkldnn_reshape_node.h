@@ -9,6 +9,7 @@
 #include <mkldnn_node.h>
 #include <string>
 #include <vector>
+#include <map>
 #include <memory>
 
 namespace MKLDNNPlugin {
@@ -34,6 +35,17 @@ private:
 
     MKLDNNMemoryPtr dst_blocked;
     MKLDNNMemoryPtr src_blocked;
+
+    // the reorders prepared for the batch limits (see setDynamicBatchLim), so switching between them is cheap
+    struct BatchReorders {
+        MKLDNNMemoryPtr srcMem;
+        MKLDNNMemoryPtr dstMem;
+        MKLDNNMemoryPtr src_blocked;
+        MKLDNNMemoryPtr dst_blocked;
+        std::shared_ptr<mkldnn::primitive> srcPrim;
+        std::shared_ptr<mkldnn::primitive> dstPrim;
+    };
+    std::map<int, BatchReorders> batchReorders;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,304 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_rnn_node.h"
+#include <ie_layers.h>
+#include <ie_parallel.hpp>
+#include <mkldnn.h>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the number of the elements of the hidden state processed by one task of the gates
+const int gatesBlock = 64;
+
+inline float logistic(float x) {
+    return 1.0f / (1.0f + std::exp(-x));
+}
+
+inline const float *getSrcData(const MKLDNNEdgePtr &edge) {
+    auto &memory = edge->getMemory();
+    return reinterpret_cast<const float *>(memory.GetData()) +
+           memory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+}
+
+inline float *getDstData(const MKLDNNEdgePtr &edge) {
+    auto &memory = edge->getMemory();
+    return reinterpret_cast<float *>(memory.GetData()) +
+           memory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+}
+
+}  // namespace
+
+MKLDNNRNNNode::MKLDNNRNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
+
+void MKLDNNRNNNode::getSupportedDescriptors() {
+    auto layer = getCnnLayer();
+    if (layer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get the CNN layer of RNN " << getName() << ".";
+
+    std::string cell = layer->GetParamAsString("cell_type", "LSTM");
+    if (cell == "LSTM") {
+        cellType = LSTM;
+        G = 4;
+    } else if (cell == "GRU") {
+        cellType = GRU;
+        G = 3;
+    } else {
+        THROW_IE_EXCEPTION << "RNN " << getName() << " has unsupported cell type " << cell << ".";
+    }
+
+    std::string direction = layer->GetParamAsString("direction", "Forward");
+    if (direction != "Forward" && direction != "Backward")
+        THROW_IE_EXCEPTION << "RNN " << getName() << " has unsupported direction " << direction << ".";
+    reverse = direction == "Backward";
+
+    int axis = layer->GetParamAsInt("axis", 1);
+    if (axis != 0 && axis != 1)
+        THROW_IE_EXCEPTION << "RNN " << getName() << " supports only the time axis 0 or 1.";
+    batchFirst = axis == 1;
+
+    S = layer->GetParamAsInt("hidden_size");
+    if (S <= 0)
+        THROW_IE_EXCEPTION << "RNN " << getName() << " has incorrect hidden size.";
+
+    size_t maxInputs = cellType == LSTM ? 3 : 2;
+    if (getParentEdges().empty() || getParentEdges().size() > maxInputs)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for RNN " << getName() << ".";
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for RNN " << getName() << ".";
+
+    auto inDims = getParentEdgeAt(0)->getDims();
+    if (inDims.ndims() != 3)
+        THROW_IE_EXCEPTION << "RNN " << getName() << " supports only 3D input.";
+    const int N = batchFirst ? inDims[0] : inDims[1];
+    T = batchFirst ? inDims[1] : inDims[0];
+    D = inDims[2];
+
+    for (size_t i = 1; i < getParentEdges().size(); i++) {
+        auto stateDims = getParentEdgeAt(i)->getDims();
+        if (stateDims.ndims() != 2 || stateDims[0] != N || stateDims[1] != S)
+            THROW_IE_EXCEPTION << "RNN " << getName() << " has incorrect dimensions of the initial state " << i << ".";
+    }
+
+    auto weightsIt = layer->blobs.find("weights");
+    if (weightsIt == layer->blobs.end() || !weightsIt->second ||
+            weightsIt->second->size() != static_cast<size_t>(G) * S * (D + S))
+        THROW_IE_EXCEPTION << "RNN " << getName() << " has incorrect weights.";
+    weights = weightsIt->second;
+
+    auto biasesIt = layer->blobs.find("biases");
+    if (biasesIt != layer->blobs.end() && biasesIt->second) {
+        if (biasesIt->second->size() != static_cast<size_t>(G) * S)
+            THROW_IE_EXCEPTION << "RNN " << getName() << " has incorrect biases.";
+        biases = biasesIt->second;
+    }
+}
+
+int MKLDNNRNNNode::getOutputPort(size_t childEdge) const {
+    auto edge = getChildEdgeAt(childEdge);
+    auto childLayer = edge->getChild()->getCnnLayer();
+    int num = edge->getOutputNum();
+    if (childLayer && num >= 0 && num < childLayer->insData.size()) {
+        auto data = childLayer->insData[num].lock();
+        auto &outData = getCnnLayer()->outData;
+        for (size_t i = 0; i < outData.size(); i++) {
+            if (outData[i].get() == data.get())
+                return static_cast<int>(i);
+        }
+    }
+    return 0;
+}
+
+void MKLDNNRNNNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    outPorts.resize(getChildEdges().size());
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        outPorts[i] = getOutputPort(i);
+        if (outPorts[i] > 2 || (outPorts[i] == 2 && cellType != LSTM))
+            THROW_IE_EXCEPTION << "RNN " << getName() << " has incorrect number of outputs.";
+    }
+
+    auto planarDesc = [](const MKLDNNDims &dims) {
+        return TensorDesc(Precision::FP32, dims.ToSizeVector(), TensorDesc::getLayoutByDims(dims.ToSizeVector()));
+    };
+
+    InferenceEngine::LayerConfig config;
+    // the batch is the outer dimension of all the tensors only when the time axis is 1
+    config.dynBatchSupport = batchFirst;
+    config.inConfs.resize(getParentEdges().size());
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        config.inConfs[i].inPlace = -1;
+        config.inConfs[i].constant = false;
+        config.inConfs[i].desc = planarDesc(getParentEdgeAt(i)->getDims());
+    }
+    config.outConfs.resize(getChildEdges().size());
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        config.outConfs[i].inPlace = -1;
+        config.outConfs[i].constant = false;
+        config.outConfs[i].desc = planarDesc(getChildEdgeAt(i)->getDims());
+    }
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+}
+
+void MKLDNNRNNNode::createPrimitive() {
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto &srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    }
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto &dstMemPtr = getChildEdgeAt(i)->getMemoryPtr();
+        if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+
+    auto inDims = getParentEdgeAt(0)->getDims();
+    const size_t N = batchFirst ? inDims[0] : inDims[1];
+    inputGates.resize(N * T * G * S);
+    hiddenGates.resize(N * G * S);
+    hiddenState.resize(N * S);
+    cellState.resize(cellType == LSTM ? N * S : 0);
+    resetState.resize(cellType == GRU ? N * S : 0);
+}
+
+void MKLDNNRNNNode::gemm(int M, int N, int K, const float *W, const float *X, int ldx, float beta, float *C) const {
+    // row-major C[N][M] = X[N][K] * W[M][K]^T, the rows of W are the rows of the weights blob
+    const int ldw = D + S;
+    const int ldc = G * S;
+    const float alpha = 1.0f;
+    if (mkldnn_sgemm("T", "N", &M, &N, &K, &alpha, W, &ldw, X, &ldx, &beta, C, &ldc) != mkldnn_success)
+        THROW_IE_EXCEPTION << "RNN " << getName() << " cannot compute GEMM.";
+}
+
+void MKLDNNRNNNode::execute(mkldnn::stream strm) {
+    auto inDims = getParentEdgeAt(0)->getDims();
+    const int N = batchFirst ? batchToProcess() : inDims[1];
+    const int GS = G * S;
+    const int rows = N * T;
+    const int blocks = (S + gatesBlock - 1) / gatesBlock;
+
+    const float *x = getSrcData(getParentEdgeAt(0));
+    const float *w = weights->cbuffer().as<const float *>();
+    const float *b = biases ? biases->cbuffer().as<const float *>() : nullptr;
+
+    // the projections of the inputs of all the time steps with the biases by one GEMM
+    float *ig = &inputGates[0];
+    parallel_for(rows, [&](int r) {
+        if (b)
+            memcpy(ig + r * GS, b, GS * sizeof(float));
+        else
+            memset(ig + r * GS, 0, GS * sizeof(float));
+    });
+    gemm(GS, rows, D, w, x, D, 1.0f, ig);
+
+    float *h = &hiddenState[0];
+    float *c = cellType == LSTM ? &cellState[0] : nullptr;
+    if (getParentEdges().size() > 1)
+        memcpy(h, getSrcData(getParentEdgeAt(1)), N * S * sizeof(float));
+    else
+        memset(h, 0, N * S * sizeof(float));
+    if (c) {
+        if (getParentEdges().size() > 2)
+            memcpy(c, getSrcData(getParentEdgeAt(2)), N * S * sizeof(float));
+        else
+            memset(c, 0, N * S * sizeof(float));
+    }
+
+    // Y is written to the first edge of the output 0, the other edges get the copy
+    float *y = nullptr;
+    for (size_t i = 0; i < outPorts.size() && !y; i++) {
+        if (outPorts[i] == 0)
+            y = getDstData(getChildEdgeAt(i));
+    }
+
+    float *hg = &hiddenGates[0];
+    const float *wh = w + D;
+    for (int step = 0; step < T; step++) {
+        const int t = reverse ? T - 1 - step : step;
+        auto row = [&](int n) {
+            return batchFirst ? n * T + t : t * N + n;
+        };
+
+        if (cellType == LSTM) {
+            gemm(GS, N, S, wh, h, S, 0.0f, hg);
+            parallel_for2d(N, blocks, [&](int n, int blk) {
+                const float *gx = ig + row(n) * GS;
+                const float *gh = hg + n * GS;
+                float *yn = y ? y + row(n) * S : nullptr;
+                const int end = (std::min)(S, (blk + 1) * gatesBlock);
+                for (int s = blk * gatesBlock; s < end; s++) {
+                    float gi = logistic(gx[s] + gh[s]);
+                    float gf = logistic(gx[S + s] + gh[S + s]);
+                    float gc = std::tanh(gx[2 * S + s] + gh[2 * S + s]);
+                    float go = logistic(gx[3 * S + s] + gh[3 * S + s]);
+                    float cs = gf * c[n * S + s] + gi * gc;
+                    float hs = go * std::tanh(cs);
+                    c[n * S + s] = cs;
+                    h[n * S + s] = hs;
+                    if (yn)
+                        yn[s] = hs;
+                }
+            });
+        } else {
+            float *rh = &resetState[0];
+            // the update and reset gates, then the candidate state from the reset hidden state
+            gemm(2 * S, N, S, wh, h, S, 0.0f, hg);
+            parallel_for2d(N, blocks, [&](int n, int blk) {
+                const float *gx = ig + row(n) * GS;
+                float *gh = hg + n * GS;
+                const int end = (std::min)(S, (blk + 1) * gatesBlock);
+                for (int s = blk * gatesBlock; s < end; s++) {
+                    gh[s] = logistic(gx[s] + gh[s]);
+                    float gr = logistic(gx[S + s] + gh[S + s]);
+                    rh[n * S + s] = gr * h[n * S + s];
+                }
+            });
+            gemm(S, N, S, wh + 2 * S * (D + S), rh, S, 0.0f, hg + 2 * S);
+            parallel_for2d(N, blocks, [&](int n, int blk) {
+                const float *gx = ig + row(n) * GS;
+                const float *gh = hg + n * GS;
+                float *yn = y ? y + row(n) * S : nullptr;
+                const int end = (std::min)(S, (blk + 1) * gatesBlock);
+                for (int s = blk * gatesBlock; s < end; s++) {
+                    float z = gh[s];
+                    float candidate = std::tanh(gx[2 * S + s] + gh[2 * S + s]);
+                    float hs = (1.0f - z) * candidate + z * h[n * S + s];
+                    h[n * S + s] = hs;
+                    if (yn)
+                        yn[s] = hs;
+                }
+            });
+        }
+    }
+
+    for (size_t i = 0; i < outPorts.size(); i++) {
+        float *dst = getDstData(getChildEdgeAt(i));
+        if (outPorts[i] == 0) {
+            if (dst != y)
+                memcpy(dst, y, rows * S * sizeof(float));
+        } else {
+            memcpy(dst, outPorts[i] == 1 ? h : c, N * S * sizeof(float));
+        }
+    }
+}
+
+bool MKLDNNRNNNode::created() const {
+    return getType() == RNN;
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The sequence of the LSTM or GRU cells computed over all the time steps by one node.
+ * The input projections of all the steps are computed by one GEMM before the time loop, so every step
+ * multiplies only the hidden state by the recurrent weights and applies the gates.
+ *
+ * The layer parameters:
+ *   cell_type   - "LSTM" (gates i, f, c, o) or "GRU" (gates z, r, h)
+ *   hidden_size - the size S of the hidden state
+ *   direction   - "Forward" or "Backward"
+ *   axis        - the dimension of the time steps: 1 for X [N, T, D] (default), 0 for X [T, N, D]
+ * The blob "weights" is [G * S][D + S], every row holds the input weights followed by the recurrent ones,
+ * the blob "biases" is [G * S]. The inputs are X and optional initial states h0 [N, S] and c0 [N, S] (LSTM),
+ * the outputs are Y and optional final states hT and cT.
+ */
+class MKLDNNRNNNode : public MKLDNNNode {
+public:
+    MKLDNNRNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
+    ~MKLDNNRNNNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+private:
+    enum CellType {
+        LSTM,
+        GRU
+    };
+
+    void gemm(int M, int N, int K, const float *W, const float *X, int ldx, float beta, float *C) const;
+    int getOutputPort(size_t childEdge) const;
+
+    static Register<MKLDNNRNNNode> reg;
+
+    CellType cellType = LSTM;
+    bool reverse = false;
+    bool batchFirst = true;
+    // the number of the gates, the time steps, the input and the hidden sizes
+    int G = 4;
+    int T = 0;
+    int D = 0;
+    int S = 0;
+
+    // the output of the layer written to every child edge
+    std::vector<int> outPorts;
+
+    InferenceEngine::Blob::Ptr weights;
+    InferenceEngine::Blob::Ptr biases;
+
+    // the projections of the inputs of all the steps [N * T][G * S] in the order of the rows of X
+    std::vector<float> inputGates;
+    // the projections of the hidden state of a step [N][G * S]
+    std::vector<float> hiddenGates;
+    std::vector<float> hiddenState;
+    std::vector<float> cellState;
+    // r * h of the GRU cell
+    std::vector<float> resetState;
+};
+
+}  // namespace MKLDNNPlugin
+
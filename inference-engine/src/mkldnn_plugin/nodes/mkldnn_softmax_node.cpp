@@ -4,6 +4,7 @@
 //
 
 #include "mkldnn_softmax_node.h"
+#include "mkldnn_softmax_kernels.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <string>
@@ -79,6 +80,38 @@ void MKLDNNSoftMaxNode::createPrimitive() {
 
     prim.reset(new softmax_forward(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
                                 getChildEdgeAt(0)->getMemory().GetPrimitive()));
+
+    // the logical order of the plain formats lets the kernels see the tensor as [outer][channels][inner]
+    auto &src = getParentEdgeAt(0)->getMemory();
+    auto &dst = getChildEdgeAt(0)->getMemory();
+    auto isPlain = [](const MKLDNNMemory &mem) {
+        memory::format format = mem.GetFormat();
+        return (format == memory::x || format == memory::nc || format == memory::nchw || format == memory::ncdhw) &&
+               !mem.GetDescriptor().data.layout_desc.blocking.offset_padding &&
+               mem.GetSize() == MKLDNNDims(mem.GetDims()).size() * sizeof(float);
+    };
+    bool refRequested = !implPriorities.empty() && (implPriorities[0] & impl_desc_type::ref);
+    useSoftMaxKernels = !refRequested && src.GetDataType() == memory::f32 && isPlain(src) && isPlain(dst);
+}
+
+void MKLDNNSoftMaxNode::execute(mkldnn::stream strm) {
+    if (!useSoftMaxKernels) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+
+    MKLDNNDims dims = getParentEdgeAt(0)->getDims();
+    size_t outer = 1, inner = 1;
+    for (int i = 0; i < axis; i++)
+        outer *= i == 0 ? static_cast<size_t>(batchToProcess()) : static_cast<size_t>(dims[i]);
+    for (int i = axis + 1; i < dims.ndims(); i++)
+        inner *= static_cast<size_t>(dims[i]);
+    // the softmax over the batch sees only the processed samples
+    size_t channels = axis == 0 ? static_cast<size_t>(batchToProcess()) : static_cast<size_t>(dims[axis]);
+
+    MKLDNNSoftMaxKernels::get().execute(reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemory().GetData()),
+                                        reinterpret_cast<float *>(getChildEdgeAt(0)->getMemory().GetData()),
+                                        outer, channels, inner);
 }
 
 bool MKLDNNSoftMaxNode::created() const {
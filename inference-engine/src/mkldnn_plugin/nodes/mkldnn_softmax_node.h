@@ -23,11 +23,14 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
 
 private:
     static Register<MKLDNNSoftMaxNode> reg;
     int axis = 0;
+    // the plain layouts are computed by MKLDNNSoftMaxKernels unless the reference implementation is requested
+    bool useSoftMaxKernels = false;
 };
 
 }  // namespace MKLDNNPlugin
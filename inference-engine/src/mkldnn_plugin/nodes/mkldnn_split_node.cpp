@@ -309,6 +309,15 @@ void MKLDNNSplitNode::selectOptimalPrimitiveDescriptor() {
             formatFrequency[outDesc.getFormat()] = 1;
     }
 
+    // nChw16c producers and consumers of the outputs which aren't aligned to 16 channels vote for nChw8c,
+    // the reorders between the blocked formats are cheaper than the copy of the split and the reorders to planar
+    auto nChw16cFrequency = formatFrequency.find(memory::nChw16c);
+    if (nChw16cFrequency != formatFrequency.end() && !isAlignedToBlocks(memory::nChw16c) &&
+            isAlignedToBlocks(memory::nChw8c)) {
+        formatFrequency[memory::nChw8c] += nChw16cFrequency->second;
+        formatFrequency.erase(nChw16cFrequency);
+    }
+
     size_t maxCount = 0;
     mkldnn::memory::format convertTo = MKLDNNMemory::GetPlainFormat(getParentEdgeAt(0)->getDims());
     for (auto &it : formatFrequency) {
@@ -354,6 +363,21 @@ void MKLDNNSplitNode::selectOptimalPrimitiveDescriptor() {
     selectPrimitiveDescriptorByIndex(0);
 }
 
+bool MKLDNNSplitNode::isAlignedToBlocks(mkldnn::memory::format fmt) const {
+    if (fmt != memory::nChw8c && fmt != memory::nChw16c)
+        return true;
+    if (getParentEdgeAt(0)->getDims().ndims() != 4)
+        return false;
+
+    if (MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), memory::f32, fmt).blocksExtended())
+        return false;
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        if (MKLDNNMemoryDesc(getChildEdgeAt(i)->getDims(), memory::f32, fmt).blocksExtended())
+            return false;
+    }
+    return true;
+}
+
 bool MKLDNNSplitNode::isOptimized() {
     return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].inPlace >= 0;
 }
@@ -27,6 +27,12 @@ public:
     void initOptimalPrimitiveDescriptor() override;
 
 private:
+    /**
+     * @brief Checks that the input and the outputs of the split fill whole channel blocks of the format,
+     * so the outputs can be the slices of the input memory
+     */
+    bool isAlignedToBlocks(mkldnn::memory::format fmt) const;
+
     static Register<MKLDNNSplitNode> reg;
     size_t axis = 1;
 };
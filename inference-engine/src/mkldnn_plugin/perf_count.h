@@ -5,21 +5,26 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
 class PerfCount {
     uint64_t duration;
     uint32_t num;
+    uint64_t last;
 
     std::chrono::high_resolution_clock::time_point __start;
     std::chrono::high_resolution_clock::time_point __finish;
 
 public:
-    PerfCount(): duration(0), num(0) {}
+    PerfCount(): duration(0), num(0), last(0) {}
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    uint64_t lastDuration() const { return last; }
 
 private:
     void start_itr() {
@@ -29,7 +34,8 @@ private:
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        last = std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        duration += last;
         num++;
     }
 
@@ -38,13 +44,84 @@ private:
 
 class PerfHelper {
     PerfCount &counter;
+    bool enabled;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, bool enable = true): counter(count), enabled(enable) {
+        if (enabled) counter.start_itr();
+    }
+
+    ~PerfHelper() {
+        if (enabled) counter.finish_itr();
+    }
+};
 
-    ~PerfHelper() { counter.finish_itr(); }
+/**
+ * The distribution of the sampled times in microseconds. The times below 16 us have the own buckets,
+ * the bucket of a greater time is shared with the times which differ from it by less than 1/8.
+ */
+class PerfHistogram {
+    static const size_t exactBuckets = 16;
+    static const size_t subBuckets = 8;
+
+    std::vector<uint32_t> buckets;
+    uint64_t total = 0;
+    uint64_t minValue = 0;
+    uint64_t maxValue = 0;
+    uint32_t num = 0;
+
+    static size_t bucketOf(uint64_t value) {
+        if (value < exactBuckets)
+            return static_cast<size_t>(value);
+        size_t exp = 4;
+        while ((value >> (exp + 1)) != 0) exp++;
+        return exactBuckets + (exp - 4) * subBuckets + ((value >> (exp - 3)) & (subBuckets - 1));
+    }
+
+    static uint64_t middleOf(size_t bucket) {
+        if (bucket < exactBuckets)
+            return bucket;
+        size_t exp = (bucket - exactBuckets) / subBuckets + 4;
+        uint64_t lower = static_cast<uint64_t>(subBuckets + (bucket - exactBuckets) % subBuckets) << (exp - 3);
+        return lower + ((1ull << (exp - 3)) - 1) / 2;
+    }
+
+public:
+    void add(uint64_t value) {
+        size_t bucket = bucketOf(value);
+        if (bucket >= buckets.size())
+            buckets.resize(bucket + 1, 0);
+        buckets[bucket]++;
+
+        minValue = num == 0 ? value : std::min(minValue, value);
+        maxValue = num == 0 ? value : std::max(maxValue, value);
+        total += value;
+        num++;
+    }
+
+    uint32_t count() const { return num; }
+    uint64_t min() const { return minValue; }
+    uint64_t max() const { return maxValue; }
+    uint64_t avg() const { return (num == 0) ? 0 : total / num; }
+
+    /**
+     * @brief The time which is not exceeded by the given part of the samples, e.g. 0.99 for p99
+     */
+    uint64_t percentile(double part) const {
+        if (num == 0)
+            return 0;
+        uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(part * num + 0.5));
+        uint64_t passed = 0;
+        for (size_t i = 0; i < buckets.size(); i++) {
+            passed += buckets[i];
+            if (passed >= rank)
+                return std::min(maxValue, std::max(minValue, middleOf(i)));
+        }
+        return maxValue;
+    }
 };
 
 }  // namespace MKLDNNPlugin
 
 #define PERF(_counter) PerfHelper __helper##__counter (_counter->PerfCounter());
+#define PERF_IF(_counter, _enabled) PerfHelper __helper##__counter (_counter->PerfCounter(), _enabled);
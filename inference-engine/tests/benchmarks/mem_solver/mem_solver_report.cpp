@@ -0,0 +1,136 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * The report of the MemorySolver on the real models: the live times and the sizes of the data are the ones of
+ * the workspace of the MKLDNN graph (see MKLDNNGraph::AllocateWithReuse), every strategy of the solver places
+ * them and the solve time, the peak memory and its lower bound are printed as the comma separated values.
+ *
+ * Usage: MemorySolverReport [-r <repeats>] <model.xml> [<model.xml> ...]
+ * The weights are read from the .bin file next to the .xml one.
+ */
+
+#include <inference_engine.hpp>
+#include <memory_solver.hpp>
+#include <mkldnn_plugin/mkldnn_graph.h>
+#include <mkldnn_plugin/mkldnn_extension_mngr.h>
+#include <extension/ext_list.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using InferenceEngine::MemorySolver;
+
+namespace {
+
+/**
+ * @brief The graph gives the boxes of its workspace
+ */
+class MemoryReportGraph : public MKLDNNPlugin::MKLDNNGraph {
+public:
+    void Load(const std::string &modelPath) {
+        InferenceEngine::CNNNetReader reader;
+        reader.ReadNetwork(modelPath);
+        std::string weightsPath = modelPath.substr(0, modelPath.rfind('.')) + ".bin";
+        reader.ReadWeights(weightsPath);
+
+        MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+        extMgr->AddExtension(std::make_shared<InferenceEngine::Extensions::Cpu::CpuExtensions>());
+        InferenceEngine::CNNNetwork network = reader.getNetwork();
+        CreateGraph(network, extMgr);
+    }
+
+    const std::vector<MemorySolver::Box> &getBoxes() const {
+        return workspaceBoxes;
+    }
+
+    static size_t getBoxUnit() {
+        return workspaceAlignment * sizeof(float);
+    }
+};
+
+struct StrategyInfo {
+    MemorySolver::Strategy strategy;
+    const char *name;
+};
+
+const StrategyInfo strategies[] = {
+    {MemorySolver::Greedy, "Greedy"},
+    {MemorySolver::BestFit, "BestFit"}
+};
+
+// the fastest of the repeats, the slower ones are disturbed by the rest of the system
+double measureSolve(const std::vector<MemorySolver::Box> &boxes, MemorySolver::Strategy strategy, int repeats,
+                    int &size) {
+    double best = 0;
+    for (int i = 0; i < repeats; i++) {
+        MemorySolver solver(boxes, strategy);
+        auto start = std::chrono::steady_clock::now();
+        size = solver.solve();
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        best = i == 0 ? elapsed.count() : std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+void report(const std::string &modelPath, int repeats) {
+    MemoryReportGraph graph;
+    graph.Load(modelPath);
+    const std::vector<MemorySolver::Box> &boxes = graph.getBoxes();
+    const size_t unit = MemoryReportGraph::getBoxUnit();
+
+    MemorySolver bounds(boxes);
+    const size_t lowerBound = static_cast<size_t>(bounds.maxDepth()) * unit;
+    size_t sum = 0;
+    for (auto &box : boxes)
+        sum += static_cast<size_t>(box.size) * unit;
+
+    for (auto &info : strategies) {
+        int size = 0;
+        double time = measureSolve(boxes, info.strategy, repeats, size);
+        const size_t peak = static_cast<size_t>(size) * unit;
+        std::cout << modelPath << "," << boxes.size() << "," << info.name << "," << time << "," << peak << ","
+                  << lowerBound << "," << sum << ","
+                  << (lowerBound ? 100.0 * (static_cast<double>(peak) / lowerBound - 1.0) : 0.0) << std::endl;
+    }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    int repeats = 10;
+    std::vector<std::string> models;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-r" && i + 1 < argc) {
+            repeats = std::max(1, std::atoi(argv[++i]));
+        } else {
+            models.push_back(arg);
+        }
+    }
+    if (models.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [-r <repeats>] <model.xml> [<model.xml> ...]" << std::endl;
+        return 1;
+    }
+
+    // the overhead is the excess of the peak memory over the lower bound, the sum is the memory without the reuse
+    std::cout << "model,boxes,strategy,solve_us,peak_bytes,lower_bound_bytes,no_reuse_bytes,overhead_percent"
+              << std::endl;
+    int failed = 0;
+    for (auto &model : models) {
+        try {
+            report(model, repeats);
+        } catch (const std::exception &e) {
+            std::cerr << model << ": " << e.what() << std::endl;
+            failed++;
+        }
+    }
+    return failed ? 1 : 0;
+}
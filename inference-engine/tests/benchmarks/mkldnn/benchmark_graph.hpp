@@ -0,0 +1,188 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <inference_engine.hpp>
+#include <mkldnn_plugin/mkldnn_graph.h>
+#include <mkldnn_plugin/mkldnn_extension_mngr.h>
+#include <extension/ext_list.hpp>
+#include <xml_net_builder.hpp>
+
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNBenchmarks {
+
+/**
+ * @brief The ISA the measured layers are asked for through their PrimitivesPriority,
+ * the benchmark is skipped when the node has selected an other implementation
+ */
+enum Isa {
+    IsaDefault,
+    IsaAvx512,
+    IsaAvx2,
+    IsaSse42,
+    IsaRef
+};
+
+inline std::string getIsaPriority(int isa) {
+    auto jit = [](const std::string &name) {
+        return "cpu:jit_" + name + "_1x1,cpu:jit_" + name + "_dw,cpu:jit_" + name + ",cpu:gemm_" + name;
+    };
+    switch (isa) {
+        case IsaAvx512: return jit("avx512");
+        case IsaAvx2: return jit("avx2");
+        case IsaSse42: return jit("sse42");
+        case IsaRef: return "cpu:ref_any,cpu:ref";
+        default: return "";
+    }
+}
+
+inline MKLDNNPlugin::impl_desc_type getIsaType(int isa) {
+    switch (isa) {
+        case IsaAvx512: return MKLDNNPlugin::impl_desc_type::avx512;
+        case IsaAvx2: return MKLDNNPlugin::impl_desc_type::avx2;
+        case IsaSse42: return MKLDNNPlugin::impl_desc_type::sse42;
+        case IsaRef: return MKLDNNPlugin::impl_desc_type::ref;
+        default: return MKLDNNPlugin::impl_desc_type::unknown;
+    }
+}
+
+/**
+ * @brief Adds the priority of the ISA to the parameters of a layer
+ */
+inline std::map<std::string, std::string> withIsa(std::map<std::string, std::string> params, int isa) {
+    std::string priority = getIsaPriority(isa);
+    if (!priority.empty())
+        params["PrimitivesPriority"] = priority;
+    return params;
+}
+
+/**
+ * @brief The graph of the benchmarks, it runs either all the nodes or only the measured ones
+ */
+class MKLDNNBenchmarkGraph: public MKLDNNPlugin::MKLDNNGraph {
+public:
+    using NodeFilter = std::function<bool (const MKLDNNPlugin::MKLDNNNodePtr&)>;
+
+    static InferenceEngine::TBlob<uint8_t>::Ptr makeWeights(size_t byteSize) {
+        InferenceEngine::TBlob<uint8_t>::Ptr weights(new InferenceEngine::TBlob<uint8_t>(
+                InferenceEngine::Precision::U8, InferenceEngine::C, {byteSize}));
+        weights->allocate();
+        fillData(weights->buffer().as<float *>(), byteSize / sizeof(float));
+        return weights;
+    }
+
+    static InferenceEngine::CNNNetwork readNetwork(const std::string &model, size_t weightsSize) {
+        InferenceEngine::CNNNetReader reader;
+        reader.ReadNetwork(model.data(), model.length());
+        if (weightsSize)
+            reader.SetWeights(makeWeights(weightsSize));
+        return reader.getNetwork();
+    }
+
+    static MKLDNNPlugin::MKLDNNExtensionManager::Ptr makeExtensionManager(bool withExtensions) {
+        MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+        if (withExtensions)
+            extMgr->AddExtension(std::make_shared<InferenceEngine::Extensions::Cpu::CpuExtensions>());
+        return extMgr;
+    }
+
+    void Load(const std::string &model, size_t weightsSize = 0, bool withExtensions = false) {
+        InferenceEngine::CNNNetwork network = readNetwork(model, weightsSize);
+        CreateGraph(network, makeExtensionManager(withExtensions));
+
+        InferenceEngine::BlobMap inputs;
+        getInputBlobs(inputs);
+        for (auto &input : inputs)
+            fillData(input.second->buffer().as<float *>(), input.second->size());
+    }
+
+    /**
+     * @brief Runs only the nodes accepted by the filter in the next inferences
+     * @return false if there is no such node or one of them has not selected the implementation of the ISA
+     */
+    bool Select(const NodeFilter &filter, int isa = IsaDefault) {
+        skipped.assign(graphNodes.size(), true);
+        selectedTypes.clear();
+        bool found = false;
+        const MKLDNNPlugin::impl_desc_type isaType = getIsaType(isa);
+        for (size_t i = 0; i < graphNodes.size(); i++) {
+            const MKLDNNPlugin::MKLDNNNodePtr &node = graphNodes[i];
+            if (!filter(node))
+                continue;
+            skipped[i] = false;
+            found = true;
+            if (!selectedTypes.empty())
+                selectedTypes += ",";
+            selectedTypes += node->getPrimitiveDescriptorType();
+
+            auto selected = node->getSelectedPrimitiveDescriptor();
+            if (isaType != MKLDNNPlugin::impl_desc_type::unknown &&
+                    (selected == nullptr || (selected->getImplementationType() & isaType) != isaType))
+                return false;
+        }
+        return found;
+    }
+
+    static NodeFilter byName(const std::string &name) {
+        return [name](const MKLDNNPlugin::MKLDNNNodePtr &node) { return node->getName() == name; };
+    }
+
+    static NodeFilter byType(MKLDNNPlugin::Type type) {
+        return [type](const MKLDNNPlugin::MKLDNNNodePtr &node) { return node->getType() == type; };
+    }
+
+    void Run() {
+        Infer(-1, skipped.empty() ? nullptr : &skipped);
+    }
+
+    const std::string &getSelectedTypes() const {
+        return selectedTypes;
+    }
+
+private:
+    static void fillData(float *data, size_t size) {
+        for (size_t i = 0; i < size; i++)
+            data[i] = static_cast<float>(std::sin(static_cast<double>(i))) * 0.5f;
+    }
+
+    std::vector<bool> skipped;
+    std::string selectedTypes;
+};
+
+/**
+ * @brief Measures the nodes of the graph accepted by the filter, the label reports their implementations
+ */
+inline void runNodes(benchmark::State &state, const std::string &model, size_t weightsSize,
+                     const MKLDNNBenchmarkGraph::NodeFilter &filter, int isa, bool withExtensions = false) {
+    MKLDNNBenchmarkGraph graph;
+    try {
+        graph.Load(model, weightsSize, withExtensions);
+    } catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    if (!graph.Select(filter, isa)) {
+        state.SkipWithError(("the measured nodes are not found or do not use the ISA: " + graph.getSelectedTypes()).c_str());
+        return;
+    }
+
+    for (auto _ : state)
+        graph.Run();
+    state.SetLabel(graph.getSelectedTypes());
+}
+
+inline size_t getConvOutput(size_t in, size_t kernel, size_t stride, size_t pad) {
+    return (in + 2 * pad - kernel) / stride + 1;
+}
+
+}  // namespace MKLDNNBenchmarks
@@ -0,0 +1,63 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark_graph.hpp"
+
+using namespace MKLDNNBenchmarks;
+using InferenceEngine::SizeVector;
+
+// the layers of the CPU extensions run as the generic nodes of the graph, the arguments are C, H, W
+static void ExtensionArgs(benchmark::internal::Benchmark *b) {
+    b->Args({64, 56, 56})->Args({256, 28, 28})->Args({3, 227, 227})->Args({17, 33, 65});
+}
+
+static std::string getExtensionModel(const std::string &type, std::map<std::string, std::string> &params,
+                                     const SizeVector &in, const SizeVector &out) {
+    return testing::V2NetBuilder::buildNetworkWithOneInput(type, in, "FP32")
+            .addLayer(type, "FP32", &params, {{in}, {out}})
+            .finish(false);
+}
+
+static void BM_MVN(benchmark::State &state) {
+    const SizeVector dims = {1, static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)),
+                             static_cast<size_t>(state.range(2))};
+    std::map<std::string, std::string> params = {
+            {"across_channels", std::to_string(state.range(3))}, {"normalize_variance", "1"}, {"eps", "0.00001"}};
+
+    runNodes(state, getExtensionModel("MVN", params, dims, dims), 0, MKLDNNBenchmarkGraph::byName("MVN1"),
+             IsaDefault, true);
+    state.SetBytesProcessed(state.iterations() * 2 * dims[1] * dims[2] * dims[3] * sizeof(float));
+}
+BENCHMARK(BM_MVN)->Apply([](benchmark::internal::Benchmark *b) {
+    for (int64_t across = 0; across <= 1; across++)
+        b->Args({64, 56, 56, across})->Args({256, 28, 28, across})->Args({17, 33, 65, across});
+})->Unit(benchmark::kMicrosecond);
+
+static void BM_GRN(benchmark::State &state) {
+    const SizeVector dims = {1, static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)),
+                             static_cast<size_t>(state.range(2))};
+    std::map<std::string, std::string> params = {{"bias", "1.0"}};
+
+    runNodes(state, getExtensionModel("GRN", params, dims, dims), 0, MKLDNNBenchmarkGraph::byName("GRN1"),
+             IsaDefault, true);
+    state.SetBytesProcessed(state.iterations() * 2 * dims[1] * dims[2] * dims[3] * sizeof(float));
+}
+BENCHMARK(BM_GRN)->Apply(ExtensionArgs)->Unit(benchmark::kMicrosecond);
+
+static void BM_Resample(benchmark::State &state) {
+    const size_t C = state.range(0), H = state.range(1), W = state.range(2);
+    const bool linear = state.range(3) != 0;
+    std::map<std::string, std::string> params = {
+            {"type", linear ? "caffe.ResampleParameter.LINEAR" : "caffe.ResampleParameter.NEAREST"},
+            {"antialias", "0"}, {"factor", "2"}};
+
+    runNodes(state, getExtensionModel("Resample", params, {1, C, H, W}, {1, C, 2 * H, 2 * W}), 0,
+             MKLDNNBenchmarkGraph::byName("Resample1"), IsaDefault, true);
+    state.SetBytesProcessed(state.iterations() * 5 * C * H * W * sizeof(float));
+}
+BENCHMARK(BM_Resample)->Apply([](benchmark::internal::Benchmark *b) {
+    for (int64_t linear = 0; linear <= 1; linear++)
+        b->Args({64, 56, 56, linear})->Args({256, 14, 14, linear})->Args({17, 33, 65, linear});
+})->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,116 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark_graph.hpp"
+
+#include <algorithm>
+
+using namespace MKLDNNBenchmarks;
+using InferenceEngine::SizeVector;
+
+namespace {
+
+struct BlockModel {
+    std::string xml;
+    size_t weightsSize;
+};
+
+std::map<std::string, std::string> getConvParams(size_t kernel, size_t output) {
+    return {{"kernel-x", std::to_string(kernel)}, {"kernel-y", std::to_string(kernel)},
+            {"stride-x", "1"}, {"stride-y", "1"},
+            {"pad-x", std::to_string(kernel / 2)}, {"pad-y", std::to_string(kernel / 2)},
+            {"output", std::to_string(output)}, {"group", "1"}};
+}
+
+size_t getConvWeightsSize(size_t kernel, size_t IC, size_t OC) {
+    return (OC * IC * kernel * kernel + OC) * sizeof(float);
+}
+
+// convolution, ReLU and pooling, the convolution and the activation are fused by the optimizer
+BlockModel getConvReluPoolModel(size_t C, size_t H, size_t W) {
+    std::map<std::string, std::string> conv = getConvParams(3, C);
+    std::map<std::string, std::string> relu;
+    std::map<std::string, std::string> pool = {{"kernel-x", "2"}, {"kernel-y", "2"}, {"stride-x", "2"},
+                                               {"stride-y", "2"}, {"pool-method", "max"}};
+    const SizeVector dims = {1, C, H, W};
+    const SizeVector pooled = {1, C, H / 2, W / 2};
+    const size_t weightsSize = getConvWeightsSize(3, C, C);
+
+    std::string xml = testing::V2NetBuilder::buildNetworkWithOneInput("ConvReluPool", dims, "FP32")
+            .addLayer("Convolution", "FP32", &conv, {{dims}, {dims}}, weightsSize - C * sizeof(float), C * sizeof(float))
+            .addLayer("ReLU", "FP32", &relu, {{dims}, {dims}})
+            .addLayer("Pooling", "FP32", &pool, {{dims}, {pooled}})
+            .finish(false);
+    return {xml, weightsSize};
+}
+
+// the bottleneck of ResNet with the shortcut as the second input, the optimizer fuses the sum into the last convolution
+BlockModel getBottleneckModel(size_t C, size_t H, size_t W) {
+    const size_t inner = C / 4;
+    std::map<std::string, std::string> reduce = getConvParams(1, inner);
+    std::map<std::string, std::string> conv = getConvParams(3, inner);
+    std::map<std::string, std::string> expand = getConvParams(1, C);
+    std::map<std::string, std::string> relu;
+    std::map<std::string, std::string> sum = {{"operation", "sum"}};
+    const SizeVector dims = {1, C, H, W};
+    const SizeVector innerDims = {1, inner, H, W};
+
+    // the weights of all the convolutions start at the offset 0, it is enough for the measurements
+    const size_t weightsSize = std::max(getConvWeightsSize(1, C, inner),
+                                        std::max(getConvWeightsSize(3, inner, inner), getConvWeightsSize(1, inner, C)));
+
+    std::string xml = testing::V2NetBuilder::buildNetworkWithOneInput("Bottleneck", dims, "FP32")
+            .addInputLayer("FP32", dims)
+            .addLayer("Convolution", "FP32", &reduce, {{dims}, {innerDims}}, inner * C * sizeof(float), inner * sizeof(float))
+            .addLayer("ReLU", "FP32", &relu, {{innerDims}, {innerDims}})
+            .addLayer("Convolution", "FP32", &conv, {{innerDims}, {innerDims}}, 9 * inner * inner * sizeof(float),
+                      inner * sizeof(float))
+            .addLayer("ReLU", "FP32", &relu, {{innerDims}, {innerDims}})
+            .addLayer("Convolution", "FP32", &expand, {{innerDims}, {dims}}, C * inner * sizeof(float), C * sizeof(float))
+            .addLayer("Eltwise", "FP32", &sum, {{dims, dims}, {dims}})
+            .addLayer("ReLU", "FP32", &relu, {{dims}, {dims}})
+            .havingEdges().connect(0, 2).connect(2, 3).connect(3, 4).connect(4, 5).connect(5, 6).connect(6, 7)
+                    .connect(1, 7).connect(7, 8).finish();
+    return {xml, weightsSize};
+}
+
+BlockModel getBlockModel(benchmark::State &state) {
+    const size_t C = state.range(1), H = state.range(2), W = state.range(3);
+    return state.range(0) == 0 ? getConvReluPoolModel(C, H, W) : getBottleneckModel(C, H, W);
+}
+
+void BlockArgs(benchmark::internal::Benchmark *b) {
+    for (int64_t block = 0; block <= 1; block++)
+        b->Args({block, 64, 56, 56})->Args({block, 256, 56, 56})->Args({block, 512, 28, 28})->Args({block, 1024, 14, 14});
+}
+
+}  // namespace
+
+// the inference of the whole block, the fused nodes and the reorders between them
+static void BM_BlockInfer(benchmark::State &state) {
+    BlockModel model = getBlockModel(state);
+    runNodes(state, model.xml, model.weightsSize, [](const MKLDNNPlugin::MKLDNNNodePtr &) { return true; }, IsaDefault);
+}
+BENCHMARK(BM_BlockInfer)->Apply(BlockArgs)->Unit(benchmark::kMicrosecond);
+
+// the creation of the graph: the optimizer passes, the choice of the layouts, the reorders and the allocation
+static void BM_BlockCreateGraph(benchmark::State &state) {
+    BlockModel model = getBlockModel(state);
+    auto extMgr = MKLDNNBenchmarkGraph::makeExtensionManager(false);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        InferenceEngine::CNNNetwork network = MKLDNNBenchmarkGraph::readNetwork(model.xml, model.weightsSize);
+        std::unique_ptr<MKLDNNBenchmarkGraph> graph(new MKLDNNBenchmarkGraph());
+        state.ResumeTiming();
+
+        graph->CreateGraph(network, extMgr);
+
+        state.PauseTiming();
+        graph.reset();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_BlockCreateGraph)->Apply(BlockArgs)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,168 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark_graph.hpp"
+
+using namespace MKLDNNBenchmarks;
+using InferenceEngine::SizeVector;
+
+// the arguments of the convolutions: IC, IH, IW, OC, kernel, stride, group, ISA
+static void ConvolutionArgs(benchmark::internal::Benchmark *b) {
+    const std::vector<std::vector<int64_t>> shapes = {
+            {3, 224, 224, 64, 7, 2, 1},
+            {64, 56, 56, 64, 3, 1, 1},
+            {64, 56, 56, 256, 1, 1, 1},
+            {256, 56, 56, 64, 1, 1, 1},
+            {128, 56, 56, 128, 3, 1, 128},
+            {256, 14, 14, 256, 3, 1, 1},
+            {512, 7, 7, 512, 3, 1, 1},
+    };
+    for (const auto &shape : shapes) {
+        for (int isa = IsaDefault; isa <= IsaRef; isa++) {
+            std::vector<int64_t> args(shape);
+            args.push_back(isa);
+            b->Args(args);
+        }
+    }
+}
+
+static void BM_Convolution(benchmark::State &state) {
+    const size_t IC = state.range(0), IH = state.range(1), IW = state.range(2), OC = state.range(3);
+    const size_t K = state.range(4), S = state.range(5), G = state.range(6);
+    const size_t P = K / 2;
+    const size_t OH = getConvOutput(IH, K, S, P), OW = getConvOutput(IW, K, S, P);
+
+    std::map<std::string, std::string> params = withIsa({
+            {"kernel-x", std::to_string(K)}, {"kernel-y", std::to_string(K)},
+            {"stride-x", std::to_string(S)}, {"stride-y", std::to_string(S)},
+            {"pad-x", std::to_string(P)}, {"pad-y", std::to_string(P)},
+            {"output", std::to_string(OC)}, {"group", std::to_string(G)}}, static_cast<int>(state.range(7)));
+    const size_t weightsSize = OC * IC / G * K * K * sizeof(float);
+    const size_t biasesSize = OC * sizeof(float);
+
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Convolution", {1, IC, IH, IW}, "FP32")
+            .addLayer("Convolution", "FP32", &params, {{{1, IC, IH, IW}}, {{1, OC, OH, OW}}}, weightsSize, biasesSize)
+            .finish(false);
+    runNodes(state, model, weightsSize + biasesSize, MKLDNNBenchmarkGraph::byName("Convolution1"),
+             static_cast<int>(state.range(7)));
+    state.SetItemsProcessed(state.iterations() * 2 * OC * IC / G * K * K * OH * OW);
+}
+BENCHMARK(BM_Convolution)->Apply(ConvolutionArgs)->Unit(benchmark::kMicrosecond);
+
+// the arguments of the poolings: C, H, W, kernel, stride, average, ISA
+static void PoolingArgs(benchmark::internal::Benchmark *b) {
+    const std::vector<std::vector<int64_t>> shapes = {
+            {64, 112, 112, 3, 2},
+            {256, 28, 28, 2, 2},
+            {512, 14, 14, 3, 1},
+            {3, 227, 227, 2, 2},
+    };
+    for (const auto &shape : shapes) {
+        for (int average = 0; average <= 1; average++) {
+            for (int isa = IsaDefault; isa <= IsaRef; isa++) {
+                std::vector<int64_t> args(shape);
+                args.push_back(average);
+                args.push_back(isa);
+                b->Args(args);
+            }
+        }
+    }
+}
+
+static void BM_Pooling(benchmark::State &state) {
+    const size_t C = state.range(0), IH = state.range(1), IW = state.range(2);
+    const size_t K = state.range(3), S = state.range(4);
+    const size_t OH = getConvOutput(IH, K, S, 0), OW = getConvOutput(IW, K, S, 0);
+
+    std::map<std::string, std::string> params = withIsa({
+            {"kernel-x", std::to_string(K)}, {"kernel-y", std::to_string(K)},
+            {"stride-x", std::to_string(S)}, {"stride-y", std::to_string(S)},
+            {"pad-x", "0"}, {"pad-y", "0"},
+            {"pool-method", state.range(5) ? "avg" : "max"}}, static_cast<int>(state.range(6)));
+
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Pooling", {1, C, IH, IW}, "FP32")
+            .addLayer("Pooling", "FP32", &params, {{{1, C, IH, IW}}, {{1, C, OH, OW}}})
+            .finish(false);
+    runNodes(state, model, 0, MKLDNNBenchmarkGraph::byName("Pooling1"), static_cast<int>(state.range(6)));
+    state.SetBytesProcessed(state.iterations() * (C * IH * IW + C * OH * OW) * sizeof(float));
+}
+BENCHMARK(BM_Pooling)->Apply(PoolingArgs)->Unit(benchmark::kMicrosecond);
+
+// the arguments of the layers of the memory bound nodes: C, H, W and the variant of the layer
+static void PlanarArgs(benchmark::internal::Benchmark *b, int64_t variants) {
+    for (int64_t variant = 0; variant < variants; variant++)
+        b->Args({64, 56, 56, variant})->Args({256, 28, 28, variant})->Args({1024, 14, 14, variant})
+                ->Args({3, 227, 227, variant})->Args({17, 33, 65, variant});
+}
+
+// builds a graph of the two inputs of the layer
+static std::string getTwoInputsModel(const std::string &type, std::map<std::string, std::string> &params,
+                                     const SizeVector &in, const SizeVector &out) {
+    return testing::V2NetBuilder::buildNetworkWithOneInput(type, in, "FP32")
+            .addInputLayer("FP32", in)
+            .addLayer(type, "FP32", &params, {{in, in}, {out}})
+            .havingEdges().connect(0, 2).connect(1, 2).finish();
+}
+
+static void BM_Eltwise(benchmark::State &state) {
+    const size_t C = state.range(0), H = state.range(1), W = state.range(2);
+    const SizeVector dims = {1, C, H, W};
+    std::map<std::string, std::string> params = {{"operation", state.range(3) ? "prod" : "sum"}};
+
+    runNodes(state, getTwoInputsModel("Eltwise", params, dims, dims), 0, MKLDNNBenchmarkGraph::byName("Eltwise2"),
+             IsaDefault);
+    state.SetBytesProcessed(state.iterations() * 3 * C * H * W * sizeof(float));
+}
+BENCHMARK(BM_Eltwise)->Apply([](benchmark::internal::Benchmark *b) { PlanarArgs(b, 2); })->Unit(benchmark::kMicrosecond);
+
+static void BM_Concat(benchmark::State &state) {
+    const size_t C = state.range(0), H = state.range(1), W = state.range(2);
+    const size_t axis = state.range(3) + 1;
+    std::map<std::string, std::string> params = {{"axis", std::to_string(axis)}};
+    SizeVector out = {1, C, H, W};
+    out[axis] *= 2;
+
+    runNodes(state, getTwoInputsModel("Concat", params, {1, C, H, W}, out), 0, MKLDNNBenchmarkGraph::byName("Concat2"),
+             IsaDefault);
+    state.SetBytesProcessed(state.iterations() * 4 * C * H * W * sizeof(float));
+}
+BENCHMARK(BM_Concat)->Apply([](benchmark::internal::Benchmark *b) { PlanarArgs(b, 3); })->Unit(benchmark::kMicrosecond);
+
+static void BM_Permute(benchmark::State &state) {
+    const size_t C = state.range(0), H = state.range(1), W = state.range(2);
+    // nchw to nhwc and nchw to nwhc, the second one has no optimized kernel
+    const bool toNhwc = state.range(3) == 0;
+    std::map<std::string, std::string> params = {{"order", toNhwc ? "0,2,3,1" : "0,3,2,1"}};
+    const SizeVector out = toNhwc ? SizeVector{1, H, W, C} : SizeVector{1, W, H, C};
+
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Permute", {1, C, H, W}, "FP32")
+            .addLayer("Permute", "FP32", &params, {{{1, C, H, W}}, {out}})
+            .finish(false);
+    runNodes(state, model, 0, MKLDNNBenchmarkGraph::byName("Permute1"), IsaDefault);
+    state.SetBytesProcessed(state.iterations() * 2 * C * H * W * sizeof(float));
+}
+BENCHMARK(BM_Permute)->Apply([](benchmark::internal::Benchmark *b) { PlanarArgs(b, 2); })->Unit(benchmark::kMicrosecond);
+
+// the reorders the plugin inserts between the planar input and output and the blocked layout of the convolution,
+// the ISA of the convolution sets the size of the block
+static void BM_Reorder(benchmark::State &state) {
+    const size_t C = state.range(0), H = state.range(1), W = state.range(2);
+    std::map<std::string, std::string> params = withIsa({
+            {"kernel-x", "1"}, {"kernel-y", "1"}, {"stride-x", "1"}, {"stride-y", "1"},
+            {"pad-x", "0"}, {"pad-y", "0"}, {"output", std::to_string(C)}, {"group", "1"}},
+            static_cast<int>(state.range(3)));
+    const size_t weightsSize = C * C * sizeof(float);
+
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Reorder", {1, C, H, W}, "FP32")
+            .addLayer("Convolution", "FP32", &params, {{{1, C, H, W}}, {{1, C, H, W}}}, weightsSize, C * sizeof(float))
+            .finish(false);
+    runNodes(state, model, weightsSize + C * sizeof(float), MKLDNNBenchmarkGraph::byType(MKLDNNPlugin::Reorder),
+             IsaDefault);
+    state.SetBytesProcessed(state.iterations() * 4 * C * H * W * sizeof(float));
+}
+BENCHMARK(BM_Reorder)->Apply([](benchmark::internal::Benchmark *b) {
+    for (int64_t isa = IsaAvx512; isa <= IsaSse42; isa++)
+        b->Args({64, 56, 56, isa})->Args({256, 14, 14, isa})->Args({24, 227, 227, isa})->Args({17, 33, 65, isa});
+})->Unit(benchmark::kMicrosecond);
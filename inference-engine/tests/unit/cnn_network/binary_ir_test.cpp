@@ -0,0 +1,142 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <inference_engine/parsers.h>
+#include <inference_engine/ie_cnn_net_reader_impl.h>
+#include <inference_engine/ie_binary_ir.hpp>
+#include <ie_layers.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include "cnn_network_impl.hpp"
+
+using namespace testing;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+using namespace std;
+
+class BinaryIRTest : public ::testing::Test {
+public:
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="2" group="1"/>
+            <weights offset="0" size="24"/>
+            <biases offset="24" size="8"/>
+            <input><port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>2</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="act" type="Activation" precision="FP32" id="2">
+            <data type="sigmoid"/>
+            <input><port id="1"><dim>1</dim><dim>2</dim><dim>4</dim><dim>4</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>2</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="crop" type="Crop" precision="FP32" id="3">
+            <data><crop axis="2" offset="1"/></data>
+            <input><port id="1"><dim>1</dim><dim>2</dim><dim>4</dim><dim>4</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>2</dim><dim>3</dim><dim>4</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+    std::string fileName = "binary_ir_test.ieb";
+    ResponseDesc resp;
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+    }
+
+    void writeBinaryIR() {
+        CNNNetReaderImpl reader(std::make_shared<V2FormatParserCreator>());
+        ASSERT_EQ(OK, reader.ReadNetwork(model.data(), model.length(), &resp)) << resp.msg;
+
+        TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>(Precision::U8, C, {32}));
+        weights->allocate();
+        float *data = weights->buffer().as<float *>();
+        for (size_t i = 0; i < 8; i++)
+            data[i] = i + 0.5f;
+        ASSERT_EQ(OK, reader.SetWeights(weights, &resp)) << resp.msg;
+
+        ASSERT_NO_THROW(BinaryIR::write(*reader.getNetwork(&resp), fileName));
+    }
+
+    void checkNetwork(ICNNNetwork *network) {
+        ASSERT_NE(nullptr, network);
+        ASSERT_EQ(4, network->layerCount());
+
+        CNNLayerPtr layer;
+        ASSERT_EQ(OK, network->getLayerByName("conv", layer, &resp));
+        auto *conv = dynamic_cast<ConvolutionLayer *>(layer.get());
+        ASSERT_NE(nullptr, conv);
+        ASSERT_EQ(1, conv->_kernel_x);
+        ASSERT_EQ(2, conv->_out_depth);
+        ASSERT_EQ(6, conv->_weights->size());
+        ASSERT_EQ(2, conv->_biases->size());
+        ASSERT_FLOAT_EQ(2.5f, conv->_weights->buffer().as<float *>()[2]);
+        ASSERT_FLOAT_EQ(7.5f, conv->_biases->buffer().as<float *>()[1]);
+
+        ASSERT_EQ(OK, network->getLayerByName("act", layer, &resp));
+        ASSERT_EQ("sigmoid", layer->type);
+
+        ASSERT_EQ(OK, network->getLayerByName("crop", layer, &resp));
+        auto *crop = dynamic_cast<CropLayer *>(layer.get());
+        ASSERT_NE(nullptr, crop);
+        ASSERT_EQ(std::vector<int>({2}), crop->axis);
+        ASSERT_EQ(std::vector<int>({1}), crop->offset);
+
+        InputsDataMap inputs;
+        network->getInputsInfo(inputs);
+        ASSERT_EQ(1, inputs.size());
+        ASSERT_EQ(SizeVector({1, 3, 4, 4}), inputs["data"]->getTensorDesc().getDims());
+
+        OutputsDataMap outputs;
+        network->getOutputsInfo(outputs);
+        ASSERT_EQ(1, outputs.size());
+        ASSERT_EQ(Precision::FP32, outputs["crop"]->getPrecision());
+    }
+};
+
+TEST_F(BinaryIRTest, canReadWrittenNetworkFromFile) {
+    writeBinaryIR();
+    ASSERT_TRUE(BinaryIR::isBinaryIR(fileName.c_str()));
+
+    CNNNetReaderImpl reader(std::make_shared<V2FormatParserCreator>());
+    ASSERT_EQ(OK, reader.ReadNetwork(fileName.c_str(), &resp)) << resp.msg;
+    // the weights are read with the network
+    ASSERT_EQ(OK, reader.ReadWeights("missing_weights.bin", &resp));
+    checkNetwork(reader.getNetwork(&resp));
+}
+
+TEST_F(BinaryIRTest, canReadWrittenNetworkFromMemory) {
+    writeBinaryIR();
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    CNNNetReaderImpl reader(std::make_shared<V2FormatParserCreator>());
+    ASSERT_EQ(OK, reader.ReadNetwork(content.data(), content.size(), &resp)) << resp.msg;
+    content.assign(content.size(), 0);
+    checkNetwork(reader.getNetwork(&resp));
+}
+
+TEST_F(BinaryIRTest, truncatedBinaryIRIsNotRead) {
+    writeBinaryIR();
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    content.resize(content.size() / 2);
+
+    CNNNetReaderImpl reader(std::make_shared<V2FormatParserCreator>());
+    ASSERT_NE(OK, reader.ReadNetwork(content.data(), content.size(), &resp));
+}
@@ -268,4 +268,69 @@ TEST_F(CNNNetworkImplTest, cycleIsDetectedInNetwork) {
     })));
 
     ASSERT_THROW(network.validateNetwork(), InferenceEngineException);
-}
\ No newline at end of file
+}
+
+TEST_F(CNNNetworkImplTest, layersAreKeptInOrderOfAddition) {
+    CNNNetworkImpl net;
+    const std::vector<std::string> names = {"zeta", "alpha", "mu"};
+    for (const auto& name : names)
+        net.addLayer(std::make_shared<CNNLayer>(LayerParams{name, "dummy", Precision::FP32}));
+    // the layer of the same name replaces the previous one in its place
+    auto replaced = std::make_shared<CNNLayer>(LayerParams{"alpha", "other", Precision::FP32});
+    net.addLayer(replaced);
+
+    ASSERT_EQ(names.size(), net.layerCount());
+    size_t i = 0;
+    for (const auto& kvp : net.allLayers()) {
+        ASSERT_EQ(names[i], kvp.first);
+        ASSERT_EQ(i, net.allLayers().indexOf(kvp.first));
+        ASSERT_EQ(kvp.second, net.allLayers().at(i));
+        i++;
+    }
+
+    CNNLayerPtr layer;
+    ASSERT_EQ(OK, net.getLayerByName("alpha", layer, nullptr));
+    ASSERT_EQ(replaced, layer);
+    ASSERT_EQ(NOT_FOUND, net.getLayerByName("beta", layer, nullptr));
+    ASSERT_EQ(IndexedMap<CNNLayerPtr>::npos, net.allLayers().indexOf("beta"));
+}
+
+TEST_F(CNNNetworkImplTest, dataReferencesStayValidWhenDataAreAdded) {
+    CNNNetworkImpl net;
+    DataPtr& first = net.getData("data0");
+    ASSERT_EQ(nullptr, first);
+    for (size_t i = 1; i < 1000; i++)
+        net.getData("data" + std::to_string(i)) = std::make_shared<Data>("data" + std::to_string(i), Precision::FP32);
+
+    auto data = std::make_shared<Data>("data0", Precision::FP32);
+    first = data;
+    ASSERT_EQ(data, net.getData("data0"));
+    ASSERT_EQ("data999", net.getData("data999")->name);
+}
+
+TEST_F(CNNNetworkImplTest, removedLayersAreSkippedAndOthersKeepOrder) {
+    CNNNetworkImpl net;
+    const size_t count = 100;
+    for (size_t i = 0; i < count; i++)
+        net.addLayer(std::make_shared<CNNLayer>(LayerParams{"layer" + std::to_string(i), "dummy", Precision::FP32}));
+    // the odd layers are removed, the removed ones are compacted on the way
+    std::weak_ptr<CNNLayer> removed;
+    for (size_t i = 1; i < count; i += 2) {
+        CNNLayerPtr layer;
+        ASSERT_EQ(OK, net.getLayerByName(("layer" + std::to_string(i)).c_str(), layer, nullptr));
+        removed = layer;
+        layer.reset();
+        net.removeLayer("layer" + std::to_string(i));
+        ASSERT_TRUE(removed.expired());
+    }
+
+    ASSERT_EQ(count / 2, net.layerCount());
+    size_t i = 0;
+    for (const auto& kvp : net.allLayers()) {
+        ASSERT_EQ("layer" + std::to_string(2 * i), kvp.first);
+        ASSERT_EQ(kvp.second, net.allLayers().at(net.allLayers().indexOf(kvp.first)));
+        i++;
+    }
+    ASSERT_EQ(count / 2, i);
+    ASSERT_EQ(IndexedMap<CNNLayerPtr>::npos, net.allLayers().indexOf("layer1"));
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+#include <inference_engine.hpp>
+#include <xml_net_builder.hpp>
+#include "mkldnn_plugin/mkldnn_plugin.h"
+
+using namespace InferenceEngine;
+
+namespace {
+const size_t kChannels = 3, kHeight = 4, kWidth = 5;
+}  // namespace
+
+class MKLDNNAutoBatchTests : public ::testing::Test {
+protected:
+    // the network of the batch computes 2 * x + 1
+    ExecutableNetwork load(const std::map<std::string, std::string> &config, size_t batch = 1) {
+        std::map<std::string, std::string> params = {{"power", "1"}, {"scale", "2"}, {"shift", "1"}};
+        const SizeVector dims = {batch, kChannels, kHeight, kWidth};
+        std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Power", dims, "FP32")
+                .addLayer("Power", "FP32", &params, {{dims}, {dims}})
+                .finish(false);
+        CNNNetReader reader;
+        reader.ReadNetwork(model.data(), model.length());
+
+        IExecutableNetwork::Ptr network;
+        engine->LoadNetwork(network, reader.getNetwork(), config);
+        return ExecutableNetwork(network);
+    }
+
+    static void fill(InferRequest &request, const std::string &input, float base) {
+        float *data = request.GetBlob(input)->buffer().as<float *>();
+        for (size_t i = 0; i < kChannels * kHeight * kWidth; i++)
+            data[i] = base + static_cast<float>(i);
+    }
+
+    static void check(InferRequest &request, const std::string &output, float base) {
+        const float *data = request.GetBlob(output)->cbuffer().as<const float *>();
+        for (size_t i = 0; i < kChannels * kHeight * kWidth; i++)
+            ASSERT_FLOAT_EQ(2.0f * (base + static_cast<float>(i)) + 1.0f, data[i]) << "at " << i;
+    }
+
+    std::shared_ptr<::MKLDNNPlugin::Engine> engine = std::make_shared<::MKLDNNPlugin::Engine>();
+};
+
+TEST_F(MKLDNNAutoBatchTests, concurrentRequestsAreInferredByBatches) {
+    ExecutableNetwork network = load({{PluginConfigParams::KEY_AUTO_BATCH, "4"},
+                                      {PluginConfigParams::KEY_AUTO_BATCH_TIMEOUT, "100000"}});
+    const std::string input = network.GetInputsInfo().begin()->first;
+    const std::string output = network.GetOutputsInfo().begin()->first;
+    ASSERT_EQ(1, network.GetInputsInfo().begin()->second->getTensorDesc().getDims()[0]);
+
+    // the full batch, the partial batch of the rest is inferred after the timeout
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < 6; i++) {
+        requests.push_back(network.CreateInferRequest());
+        fill(requests.back(), input, 100.0f * i);
+    }
+    for (auto &request : requests)
+        request.StartAsync();
+    for (size_t i = 0; i < requests.size(); i++) {
+        ASSERT_EQ(OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+        check(requests[i], output, 100.0f * i);
+    }
+}
+
+TEST_F(MKLDNNAutoBatchTests, callbacksAreCalledAndRequestsRestarted) {
+    ExecutableNetwork network = load({{PluginConfigParams::KEY_AUTO_BATCH, "2"},
+                                      {PluginConfigParams::KEY_AUTO_BATCH_TIMEOUT, "0"}});
+    const std::string input = network.GetInputsInfo().begin()->first;
+    const std::string output = network.GetOutputsInfo().begin()->first;
+
+    std::atomic<int> calls(0);
+    InferRequest request = network.CreateInferRequest();
+    fill(request, input, 1.0f);
+    request.SetCompletionCallback([&]() {
+        if (++calls < 3) request.StartAsync();
+    });
+    request.StartAsync();
+    while (calls < 3)
+        request.Wait(IInferRequest::WaitMode::RESULT_READY);
+    ASSERT_EQ(OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+    check(request, output, 1.0f);
+}
+
+TEST_F(MKLDNNAutoBatchTests, syncInferIsBatchOfOne) {
+    ExecutableNetwork network = load({{PluginConfigParams::KEY_AUTO_BATCH, "8"},
+                                      {PluginConfigParams::KEY_AUTO_BATCH_TIMEOUT, "0"}});
+    const std::string input = network.GetInputsInfo().begin()->first;
+    const std::string output = network.GetOutputsInfo().begin()->first;
+
+    InferRequest request = network.CreateInferRequest();
+    fill(request, input, -7.0f);
+    ASSERT_NO_THROW(request.Infer());
+    check(request, output, -7.0f);
+}
+
+TEST_F(MKLDNNAutoBatchTests, throwsOnInvalidConfig) {
+    ASSERT_THROW(load({{PluginConfigParams::KEY_AUTO_BATCH, "0"}}), details::InferenceEngineException);
+    ASSERT_THROW(load({{PluginConfigParams::KEY_AUTO_BATCH, "four"}}), details::InferenceEngineException);
+    ASSERT_THROW(load({{PluginConfigParams::KEY_AUTO_BATCH, "4"}, {PluginConfigParams::KEY_AUTO_BATCH_TIMEOUT, "-1"}}),
+                 details::InferenceEngineException);
+    // the network of the batch 2 is not batched
+    ASSERT_THROW(load({{PluginConfigParams::KEY_AUTO_BATCH, "4"}}, 2), details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNAutoBatchTests, batchOfOneLoadsPlainNetwork) {
+    ExecutableNetwork network = load({{PluginConfigParams::KEY_AUTO_BATCH, "1"}});
+    const std::string input = network.GetInputsInfo().begin()->first;
+    const std::string output = network.GetOutputsInfo().begin()->first;
+
+    InferRequest request = network.CreateInferRequest();
+    fill(request, input, 3.0f);
+    request.Infer();
+    check(request, output, 3.0f);
+}
@@ -0,0 +1,99 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_plugin_config.hpp>
+#include <details/ie_exception.hpp>
+#include <vector>
+#include "mkldnn_plugin/config.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+TEST(MKLDNNConfigTests, threadsNumIsRead) {
+    Config config;
+    config.readProperties({{PluginConfigParams::KEY_CPU_THREADS_NUM, "4"}});
+    ASSERT_EQ(4, config.threadsNum);
+
+    ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_CPU_THREADS_NUM, "-1"}}),
+                 details::InferenceEngineException);
+    ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_CPU_THREADS_NUM, "four"}}),
+                 details::InferenceEngineException);
+}
+
+TEST(MKLDNNConfigTests, bindCoresAreParsed) {
+    Config config;
+    config.readProperties({{PluginConfigParams::KEY_CPU_BIND_CORES, "0-3,8,10-11"}});
+    ASSERT_EQ(std::vector<int>({0, 1, 2, 3, 8, 10, 11}), config.bindCores);
+
+    config.readProperties({{PluginConfigParams::KEY_CPU_BIND_CORES, PluginConfigParams::NO}});
+    ASSERT_TRUE(config.bindCores.empty());
+}
+
+TEST(MKLDNNConfigTests, wrongBindCoresThrow) {
+    Config config;
+    for (const char *value : {"", "a", "1,", "3-1", "1-2-3", "-1", "0,0", "1-", "2x"}) {
+        ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_CPU_BIND_CORES, value}}),
+                     details::InferenceEngineException) << "value = \"" << value << "\"";
+    }
+}
+
+TEST(MKLDNNConfigTests, schedulerIsRead) {
+    Config config;
+    config.readProperties({{PluginConfigParams::KEY_CPU_SCHEDULER_GROUPS, "4"},
+                           {PluginConfigParams::KEY_CPU_SCHEDULER_PRIORITY, "-2"},
+                           {PluginConfigParams::KEY_CPU_SCHEDULER_WEIGHT, "3"}});
+    ASSERT_EQ(4, config.schedulerGroups);
+    ASSERT_EQ(-2, config.schedulerPriority);
+    ASSERT_EQ(3, config.schedulerWeight);
+
+    config.readProperties({{PluginConfigParams::KEY_CPU_SCHEDULER_GROUPS, PluginConfigParams::NO}});
+    ASSERT_EQ(0, config.schedulerGroups);
+}
+
+TEST(MKLDNNConfigTests, wrongSchedulerThrows) {
+    Config config;
+    for (const char *value : {"", "a", "0", "-1"}) {
+        ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_CPU_SCHEDULER_GROUPS, value}}),
+                     details::InferenceEngineException) << "value = \"" << value << "\"";
+        ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_CPU_SCHEDULER_WEIGHT, value}}),
+                     details::InferenceEngineException) << "value = \"" << value << "\"";
+    }
+    ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_CPU_SCHEDULER_PRIORITY, "high"}}),
+                 details::InferenceEngineException);
+}
+
+TEST(MKLDNNConfigTests, asyncThreadsAreRead) {
+    Config config;
+    config.readProperties({{PluginConfigParams::KEY_ASYNC_THREADS_CORES, "4-5,7"},
+                           {PluginConfigParams::KEY_ASYNC_THREADS_PRIORITY, "-1"}});
+    ASSERT_EQ(std::vector<int>({4, 5, 7}), config.asyncThreads.cpus);
+    ASSERT_EQ(-1, config.asyncThreads.priority);
+
+    config.readProperties({{PluginConfigParams::KEY_ASYNC_THREADS_CORES, PluginConfigParams::NO}});
+    ASSERT_TRUE(config.asyncThreads.cpus.empty());
+
+    ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_ASYNC_THREADS_CORES, "1,1"}}),
+                 details::InferenceEngineException);
+    ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_ASYNC_THREADS_PRIORITY, "5"}}),
+                 details::InferenceEngineException);
+}
+
+TEST(MKLDNNConfigTests, memorySolverIsRead) {
+    Config config;
+    ASSERT_EQ(Config::MemorySolverBestFit, config.memorySolver);
+
+    config.readProperties({{PluginConfigParams::KEY_CPU_MEMORY_SOLVER,
+                            PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY}});
+    ASSERT_EQ(Config::MemorySolverGreedy, config.memorySolver);
+
+    config.readProperties({{PluginConfigParams::KEY_CPU_MEMORY_SOLVER,
+                            PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT}});
+    ASSERT_EQ(Config::MemorySolverBestFit, config.memorySolver);
+
+    ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_CPU_MEMORY_SOLVER, "OPTIMAL"}}),
+                 details::InferenceEngineException);
+}
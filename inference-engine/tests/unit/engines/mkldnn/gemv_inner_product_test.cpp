@@ -0,0 +1,52 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <tuple>
+#include <vector>
+#include "mkldnn_plugin/mkldnn_gemv_inner_product.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+// the number of the output channels and the length of the dot product
+using GemvParams = std::tuple<size_t, size_t>;
+
+class MKLDNNGemvInnerProductTests : public ::testing::TestWithParam<GemvParams> {};
+
+TEST_P(MKLDNNGemvInnerProductTests, executeMatchesReference) {
+    const size_t OC = std::get<0>(GetParam());
+    const size_t K = std::get<1>(GetParam());
+    std::vector<float> weights(OC * K), src(K), bias(OC), dst(OC, -1.0f);
+    for (size_t i = 0; i < weights.size(); i++)
+        weights[i] = static_cast<float>(i % 7) * 0.25f - 0.5f;
+    for (size_t k = 0; k < K; k++)
+        src[k] = static_cast<float>(k % 5) - 1.0f;
+    for (size_t c = 0; c < OC; c++)
+        bias[c] = static_cast<float>(c % 3);
+
+    MKLDNNGemvInnerProduct ip;
+    ip.init(weights.data(), OC, K);
+    // the machine without AVX2 and the short sources are left to the primitive
+    if (ip.empty())
+        return;
+
+    ip.execute(src.data(), bias.data(), dst.data());
+
+    for (size_t c = 0; c < OC; c++) {
+        float ref = bias[c];
+        for (size_t k = 0; k < K; k++)
+            ref += src[k] * weights[c * K + k];
+        ASSERT_NEAR(ref, dst[c], 1e-4f * (1.0f + std::fabs(ref))) << "c = " << c << " isa = " << ip.getIsaName();
+    }
+}
+
+// the channels cover the partial groups and blocks, the lengths cover the tails after the vectors of all ISAs
+INSTANTIATE_TEST_CASE_P(
+        TestsGemvInnerProduct, MKLDNNGemvInnerProductTests,
+        ::testing::Combine(
+                ::testing::Values(1, 3, 4, 33, 100),
+                ::testing::Values(8, 16, 23, 48, 1000)));
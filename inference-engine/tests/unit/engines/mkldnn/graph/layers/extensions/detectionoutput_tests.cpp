@@ -0,0 +1,399 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct detectionoutput_test_params {
+    struct {
+        size_t n;
+        // the priors are two boxes of different sizes at each cell of the grid
+        size_t cells_h;
+        size_t cells_w;
+    } in;
+
+    int num_classes;
+    bool share_location;
+    int background_label_id;
+    int top_k;
+    int keep_top_k;
+    float nms_threshold;
+    float confidence_threshold;
+    std::string code_type;
+    // the confidences are the logits of the classes
+    bool input_logits;
+
+    size_t num_prim_desc;
+
+    int selectedType;
+
+    std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+};
+
+static size_t detectionoutput_num_priors(const detectionoutput_test_params &prm) {
+    return 2 * prm.in.cells_h * prm.in.cells_w;
+}
+
+// the serial DetectionOutput: the candidates of a class are sorted by the score, the lower prior first on the equal
+// scores, and suppressed one by one against all the kept boxes; the keep_top_k best detections of an image are kept
+void ref_detectionoutput(const float *loc, const float *conf, const float *priors, float *dst,
+                         detectionoutput_test_params prm) {
+    const int N = static_cast<int>(prm.in.n);
+    const int P = static_cast<int>(detectionoutput_num_priors(prm));
+    const int C = prm.num_classes;
+    const int L = prm.share_location ? 1 : C;
+    const bool center_size = prm.code_type == "caffe.PriorBoxParameter.CENTER_SIZE";
+    const float *variances = priors + 4 * P;
+
+    std::vector<float> scores(conf, conf + N * P * C);
+    if (prm.input_logits) {
+        for (int np = 0; np < N * P; np++) {
+            float *pscores = &scores[np * C];
+            const float max_logit = *std::max_element(pscores, pscores + C);
+            float sum = 0.0f;
+            for (int c = 0; c < C; c++) {
+                pscores[c] = std::exp(pscores[c] - max_logit);
+                sum += pscores[c];
+            }
+            for (int c = 0; c < C; c++)
+                pscores[c] /= sum;
+        }
+    }
+
+    std::vector<float> boxes(N * L * P * 4);
+    for (int n = 0; n < N; n++) {
+        for (int l = 0; l < L; l++) {
+            for (int p = 0; p < P; p++) {
+                const float *prior = priors + 4 * p;
+                const float *var = variances + 4 * p;
+                const float *d = loc + ((n * P + p) * L + l) * 4;
+                float *box = &boxes[((n * L + l) * P + p) * 4];
+                if (center_size) {
+                    const float w = prior[2] - prior[0];
+                    const float h = prior[3] - prior[1];
+                    const float cx = var[0] * d[0] * w + 0.5f * (prior[0] + prior[2]);
+                    const float cy = var[1] * d[1] * h + 0.5f * (prior[1] + prior[3]);
+                    const float bw = std::exp(var[2] * d[2]) * w;
+                    const float bh = std::exp(var[3] * d[3]) * h;
+                    box[0] = cx - 0.5f * bw;
+                    box[1] = cy - 0.5f * bh;
+                    box[2] = cx + 0.5f * bw;
+                    box[3] = cy + 0.5f * bh;
+                } else {
+                    for (int k = 0; k < 4; k++)
+                        box[k] = prior[k] + var[k] * d[k];
+                }
+            }
+        }
+    }
+
+    auto jaccard = [](const float *a, const float *b) {
+        if (b[0] > a[2] || b[2] < a[0] || b[1] > a[3] || b[3] < a[1])
+            return 0.0f;
+        const float width = std::min(a[2], b[2]) - std::max(a[0], b[0]);
+        const float height = std::min(a[3], b[3]) - std::max(a[1], b[1]);
+        const float intersection = width * height;
+        return intersection / ((a[2] - a[0]) * (a[3] - a[1]) + (b[2] - b[0]) * (b[3] - b[1]) - intersection);
+    };
+
+    const int rows = N * prm.keep_top_k;
+    for (int i = 0; i < rows * 7; i++)
+        dst[i] = 0.0f;
+
+    int count = 0;
+    for (int n = 0; n < N; n++) {
+        // (score, class, prior) of the kept detections, the classes follow each other
+        std::vector<std::tuple<float, int, int>> detections;
+        for (int c = 0; c < C; c++) {
+            if (c == prm.background_label_id)
+                continue;
+
+            std::vector<std::pair<float, int>> candidates;
+            for (int p = 0; p < P; p++) {
+                const float score = scores[(n * P + p) * C + c];
+                if (score > prm.confidence_threshold)
+                    candidates.push_back(std::make_pair(score, p));
+            }
+            std::stable_sort(candidates.begin(), candidates.end(),
+                             [](const std::pair<float, int> &a, const std::pair<float, int> &b) {
+                                 return a.first > b.first;
+                             });
+            if (prm.top_k != -1 && static_cast<int>(candidates.size()) > prm.top_k)
+                candidates.resize(prm.top_k);
+
+            const float *class_boxes = &boxes[(n * L + (prm.share_location ? 0 : c)) * P * 4];
+            std::vector<int> kept;
+            for (const auto &candidate : candidates) {
+                bool keep = true;
+                for (size_t k = 0; k < kept.size() && keep; k++)
+                    keep = jaccard(class_boxes + 4 * candidate.second, class_boxes + 4 * kept[k]) <= prm.nms_threshold;
+                if (keep) {
+                    kept.push_back(candidate.second);
+                    detections.push_back(std::make_tuple(candidate.first, c, candidate.second));
+                }
+            }
+        }
+
+        if (prm.keep_top_k > -1 && static_cast<int>(detections.size()) > prm.keep_top_k) {
+            std::stable_sort(detections.begin(), detections.end(),
+                             [](const std::tuple<float, int, int> &a, const std::tuple<float, int, int> &b) {
+                                 return std::get<0>(a) > std::get<0>(b);
+                             });
+            detections.resize(prm.keep_top_k);
+            std::stable_sort(detections.begin(), detections.end(),
+                             [](const std::tuple<float, int, int> &a, const std::tuple<float, int, int> &b) {
+                                 return std::get<1>(a) < std::get<1>(b);
+                             });
+        }
+
+        for (const auto &detection : detections) {
+            const int c = std::get<1>(detection);
+            const float *box = &boxes[((n * L + (prm.share_location ? 0 : c)) * P + std::get<2>(detection)) * 4];
+            float *row = dst + 7 * count++;
+            row[0] = static_cast<float>(n);
+            row[1] = static_cast<float>(c);
+            row[2] = std::get<0>(detection);
+            for (int k = 0; k < 4; k++)
+                row[3 + k] = box[k];
+        }
+    }
+    if (count < rows)
+        dst[7 * count] = -1.0f;
+}
+
+class MKLDNNCPUExtDetectionOutputTests: public TestsCommon, public WithParamInterface<detectionoutput_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="DetectionOutput_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="loc" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conf" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="priors" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_PRIORS_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="detection_out" id="3" type="DetectionOutput" precision="FP32">
+            <data num_classes="_NC_" share_location="_SL_" background_label_id="_BG_" top_k="_TK_"
+                  keep_top_k="_KTK_" nms_threshold="_NMS_" confidence_threshold="_CT_" code_type="_CODE_"
+                  variance_encoded_in_target="0" input_logits="_IL_"/>
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_PRIORS_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>_ROWS_</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="2"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(detectionoutput_test_params p) {
+        std::string model = model_t;
+        const size_t num_priors = detectionoutput_num_priors(p);
+        const size_t num_loc_classes = p.share_location ? 1 : p.num_classes;
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+        REPLACE_WITH_NUM(model, "_LOC_", num_priors * num_loc_classes * 4);
+        REPLACE_WITH_NUM(model, "_CONF_", num_priors * p.num_classes);
+        REPLACE_WITH_NUM(model, "_PRIORS_", num_priors * 4);
+        REPLACE_WITH_NUM(model, "_ROWS_", p.in.n * p.keep_top_k);
+
+        REPLACE_WITH_NUM(model, "_NC_", p.num_classes);
+        REPLACE_WITH_NUM(model, "_SL_", p.share_location ? 1 : 0);
+        REPLACE_WITH_NUM(model, "_BG_", p.background_label_id);
+        REPLACE_WITH_NUM(model, "_TK_", p.top_k);
+        REPLACE_WITH_NUM(model, "_KTK_", p.keep_top_k);
+        REPLACE_WITH_NUM(model, "_NMS_", p.nms_threshold);
+        REPLACE_WITH_NUM(model, "_CT_", p.confidence_threshold);
+        REPLACE_WITH_STR(model, "_CODE_", p.code_type);
+        REPLACE_WITH_NUM(model, "_IL_", p.input_logits ? 1 : 0);
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            detectionoutput_test_params p = ::testing::WithParamInterface<detectionoutput_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            auto& nodes = graph.getNodes();
+            for (auto &node : nodes) {
+                if (node->getName() == "detection_out") {
+                    ASSERT_LE(p.num_prim_desc, node->getSupportedPrimitiveDescriptors().size());
+                    for (size_t j = 0; j < p.num_prim_desc && j < p.comp.size(); j++) {
+                        p.comp.at(j)(node->getSupportedPrimitiveDescriptors().at(j));
+                    }
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.selectedType,
+                              node->getSelectedPrimitiveDescriptor()->getImplementationType() & p.selectedType);
+                }
+            }
+
+            InferenceEngine::InputsDataMap in = net_reader.getNetwork().getInputsInfo();
+            InferenceEngine::BlobMap srcs;
+            for (auto &input : in) {
+                InferenceEngine::Blob::Ptr src =
+                        InferenceEngine::make_shared_blob<float>(input.second->getTensorDesc());
+                src->allocate();
+                srcs[input.first] = src;
+            }
+
+            // the boxes of a cell overlap much more than the NMS threshold, the boxes of the neighbour cells much less
+            const size_t num_priors = detectionoutput_num_priors(p);
+            float *priors = srcs["priors"]->buffer().as<float *>();
+            const float variances[4] = {0.1f, 0.1f, 0.2f, 0.2f};
+            for (size_t prior = 0; prior < num_priors; prior++) {
+                const size_t cell = prior / 2;
+                const float center_x = (cell % p.in.cells_w + 0.5f) / p.in.cells_w;
+                const float center_y = (cell / p.in.cells_w + 0.5f) / p.in.cells_h;
+                const float half_w = (prior % 2 ? 0.4f : 0.5f) / p.in.cells_w;
+                const float half_h = (prior % 2 ? 0.4f : 0.5f) / p.in.cells_h;
+                priors[4 * prior + 0] = center_x - half_w;
+                priors[4 * prior + 1] = center_y - half_h;
+                priors[4 * prior + 2] = center_x + half_w;
+                priors[4 * prior + 3] = center_y + half_h;
+                for (size_t k = 0; k < 4; k++)
+                    priors[4 * (num_priors + prior) + k] = variances[k];
+            }
+
+            float *loc = srcs["loc"]->buffer().as<float *>();
+            for (size_t i = 0; i < srcs["loc"]->size(); i++)
+                loc[i] = 0.1f * sin(static_cast<float>(i));
+
+            // the scores of an image are distinct, so the order of the detections is independent of the sort;
+            // the logits span [-3, 3), so the softmax of many priors doesn't pass the threshold
+            float *conf = srcs["conf"]->buffer().as<float *>();
+            const size_t conf_size = num_priors * p.num_classes;
+            for (size_t i = 0; i < srcs["conf"]->size(); i++) {
+                conf[i] = static_cast<float>((i * 7919) % conf_size) / conf_size;
+                if (p.input_logits)
+                    conf[i] = 6.0f * conf[i] - 3.0f;
+            }
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_detectionoutput(loc, conf, priors, dst_ref.data(), p);
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtDetectionOutputTests, TestsDetectionOutput) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsDetectionOutput, MKLDNNCPUExtDetectionOutputTests,
+        ::testing::Values(
+                detectionoutput_test_params{{1, 4, 4}, 4, true, 0, -1, 100, 0.45f, 0.01f,
+                                            "caffe.PriorBoxParameter.CORNER", false, 1,
+                                            MKLDNNPlugin::impl_desc_type::unknown },
+                // top_k and keep_top_k cut the detections of all the images
+                detectionoutput_test_params{{2, 4, 4}, 5, false, 0, 10, 20, 0.45f, 0.1f,
+                                            "caffe.PriorBoxParameter.CENTER_SIZE", false, 1,
+                                            MKLDNNPlugin::impl_desc_type::unknown },
+                // a class keeps more boxes than a block of the overlaps, so the kept ones span several blocks
+                detectionoutput_test_params{{2, 6, 7}, 3, true, -1, -1, 200, 0.3f, 0.0f,
+                                            "caffe.PriorBoxParameter.CORNER", false, 1,
+                                            MKLDNNPlugin::impl_desc_type::unknown },
+                detectionoutput_test_params{{3, 5, 3}, 4, false, 0, 12, 25, 0.5f, 0.2f,
+                                            "caffe.PriorBoxParameter.CORNER", false, 1,
+                                            MKLDNNPlugin::impl_desc_type::unknown },
+                // the softmax is computed by the layer, only for the priors whose classes may pass the threshold
+                detectionoutput_test_params{{2, 4, 4}, 4, true, 0, -1, 50, 0.45f, 0.3f,
+                                            "caffe.PriorBoxParameter.CORNER", true, 1,
+                                            MKLDNNPlugin::impl_desc_type::unknown },
+                detectionoutput_test_params{{2, 5, 3}, 5, false, 0, 8, 20, 0.5f, 0.15f,
+                                            "caffe.PriorBoxParameter.CENTER_SIZE", true, 1,
+                                            MKLDNNPlugin::impl_desc_type::unknown },
+                // no threshold, the softmax of all the priors is computed
+                detectionoutput_test_params{{1, 4, 5}, 3, true, 0, -1, 100, 0.45f, 0.0f,
+                                            "caffe.PriorBoxParameter.CORNER", true, 1,
+                                            MKLDNNPlugin::impl_desc_type::unknown }));
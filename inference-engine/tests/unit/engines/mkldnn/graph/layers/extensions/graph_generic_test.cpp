@@ -1282,6 +1282,98 @@ TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveWithDynamicBatch) {
     compare(*output, dst_ref2);
 }
 
+TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveReusesBlobsOfTheBatch) {
+    std::string model = R"V0G0N(
+        <Net Name="DoubleLayer_Only" version="2" precision="FP32" batch="2">
+            <layers>
+                <layer name="in1" type="Input" precision="FP32" id="0">
+                    <output>
+                        <port id="0">
+                            <dim>2</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+                <layer name="double_layer" id="1" type="NewDoubleLayer" precision="FP32">
+                    <input>
+                        <port id="1">
+                            <dim>2</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </input>
+                    <output>
+                        <port id="2">
+                            <dim>2</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+            </layers>
+            <edges>
+                <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+            </edges>
+        </Net>
+        )V0G0N";
+    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+    extMgr->AddExtension(extension);
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+    InferenceEngine::SizeVector dims_src = {2, 3, 5, 5};
+
+    InferenceEngine::TBlob<float>::Ptr src =
+            InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+    src->allocate();
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+    InferenceEngine::OutputsDataMap out;
+    out = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::BlobMap outputBlobs;
+
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output;
+    output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    // the blobs of the extension layer created for each batch must see the data of the next inferences
+    const char *limits[] = {"2", "1", "2", "1"};
+    for (size_t n = 0; n < sizeof(limits) / sizeof(limits[0]); n++) {
+        graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, limits[n]}});
+
+        float *srcData = src->data();
+        for (size_t i = 0; i < src->size(); i++)
+            srcData[i] = static_cast<float>(n * 100 + i % 50);
+        float *dstData = output->data();
+        for (size_t i = 0; i < output->size(); i++)
+            dstData[i] = 0;
+
+        graph.Infer(srcs, outputBlobs);
+
+        InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+        dst_ref.allocate();
+        if (std::string(limits[n]) == "1")
+            ref_double_batch1(*src, dst_ref);
+        else
+            ref_double(*src, dst_ref);
+
+        compare(*output, dst_ref);
+    }
+}
+
 TEST_F(MKLDNNGraphGenericTests, ExecuteNotInLineGRN) {
     std::string model = R"V0G0N(
 <net name="default" version="2" batch="1">
@@ -259,4 +259,8 @@ INSTANTIATE_TEST_CASE_P(
         TestsInterp, MKLDNNCPUExtInterpTests,
         ::testing::Values(
                 interp_test_params{{1, 256, 1, 1}, {33, 65}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown },
-                interp_test_params{{1, 2, 33, 65}, {33, 65}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown }));
+                interp_test_params{{1, 2, 33, 65}, {33, 65}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 3, 10, 20}, {15, 33}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{3, 19, 16, 24}, {7, 11}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 5, 12, 14}, {21, 9}, -1, -1, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{1, 11, 17, 13}, {17, 13}, -2, -1, 1, MKLDNNPlugin::impl_desc_type::unknown }));
@@ -308,4 +308,20 @@ INSTANTIATE_TEST_CASE_P(
                 mvn_test_params{{2, 64, 15, 15}, 1, 0, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
                 mvn_test_params{{2,  2, 33, 65}, 1, 0, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
                 mvn_test_params{{2, 64, 15, 15}, 1, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                mvn_test_params{{2,  2, 33, 65}, 1, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown }));
+                mvn_test_params{{2,  2, 33, 65}, 1, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{1,  5, 70, 70}, 0, 0, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{1,  5, 70, 70}, 0, 1, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{1,  5, 70, 70}, 1, 0, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{1,  5, 70, 70}, 1, 1, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{3, 19,  9, 13}, 0, 0, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{3, 19,  9, 13}, 0, 1, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{3, 19,  9, 13}, 1, 0, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{3, 19,  9, 13}, 1, 1, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{1,  5, 70, 70}, 0, 0, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{1,  5, 70, 70}, 0, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{1,  5, 70, 70}, 1, 0, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{1,  5, 70, 70}, 1, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{3, 19,  9, 13}, 0, 0, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{3, 19,  9, 13}, 0, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{3, 19,  9, 13}, 1, 0, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{3, 19,  9, 13}, 1, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown }));
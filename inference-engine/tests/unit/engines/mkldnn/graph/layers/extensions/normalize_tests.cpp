@@ -0,0 +1,289 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct normalize_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    int across_spatial;
+    int channel_shared;
+    float eps;
+
+    size_t num_prim_desc;
+    bool isBlockedFormat;
+    int selectedType;
+
+    std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+};
+
+template <typename data_t>
+void ref_normalize(const InferenceEngine::TBlob<data_t> &src, const data_t *scales, InferenceEngine::TBlob<data_t> &dst,
+                   normalize_test_params prm) {
+    const data_t *src_data = src.readOnly();
+    data_t *dst_data = dst.data();
+
+    size_t N = prm.in.n;
+    size_t C = prm.in.c;
+    size_t H = prm.in.h;
+    size_t W = prm.in.w;
+
+    float eps = prm.eps;
+
+    for (size_t b = 0; b < N; b++) {
+        const data_t *psrc = src_data + b*C*H*W;
+        data_t *pdst = dst_data + b*C*H*W;
+
+        if (prm.across_spatial) {
+            double sum = 0;
+            for (size_t i = 0; i < C*H*W; i++) {
+                sum += psrc[i] * psrc[i];
+            }
+            float norm = 1.0f / std::sqrt(eps + static_cast<float>(sum));
+
+            for (size_t c = 0; c < C; c++) {
+                for (size_t hw = 0; hw < H*W; hw++) {
+                    pdst[c*H*W + hw] = psrc[c*H*W + hw] * norm * (prm.channel_shared ? scales[0] : scales[c]);
+                }
+            }
+        } else {
+            for (size_t hw = 0; hw < H*W; hw++) {
+                double sum = eps;
+                for (size_t c = 0; c < C; c++) {
+                    sum += psrc[c*H*W + hw] * psrc[c*H*W + hw];
+                }
+                float norm = 1.0f / std::sqrt(static_cast<float>(sum));
+
+                for (size_t c = 0; c < C; c++) {
+                    pdst[c*H*W + hw] = psrc[c*H*W + hw] * norm * (prm.channel_shared ? scales[0] : scales[c]);
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtNormalizeTests: public TestsCommon, public WithParamInterface<normalize_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="Normalize_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="normalize" id="2" type="Normalize" precision="FP32">
+            <data across_spatial="_AS_" channel_shared="_CS_" eps="_EPS_"/>
+            <weights offset="0" size="_WS_"/>
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(normalize_test_params p) {
+        std::string model = model_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_AS_", p.across_spatial);
+        REPLACE_WITH_NUM(model, "_CS_", p.channel_shared);
+        REPLACE_WITH_NUM(model, "_EPS_", p.eps);
+        REPLACE_WITH_NUM(model, "_WS_", (p.channel_shared ? 1 : p.in.c) * sizeof(float));
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            normalize_test_params p = ::testing::WithParamInterface<normalize_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t weightSize = (p.channel_shared ? 1 : p.in.c) * sizeof(float);
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {weightSize});
+            weights->allocate();
+            float *scales = weights->data().as<float*>();
+            for (size_t i = 0; i < weights->size() / sizeof(float); i++) {
+                scales[i] = 0.5f + 0.25f * (i % 7);
+            }
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            auto& nodes = graph.getNodes();
+            nodes = graph.getNodes();
+
+            for (auto &node : nodes) {
+                if (node->getName() == "normalize") {
+                    ASSERT_EQ(p.num_prim_desc, node->getSupportedPrimitiveDescriptors().size());
+                    for (size_t j = 0; j < p.num_prim_desc && j < p.comp.size(); j++) {
+                        p.comp.at(j)(node->getSupportedPrimitiveDescriptors().at(j));
+                    }
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.selectedType,
+                              node->getSelectedPrimitiveDescriptor()->getImplementationType() & p.selectedType);
+                }
+            }
+            if (p.isBlockedFormat)
+                ASSERT_EQ(6, nodes.size());
+            else
+                ASSERT_EQ(5, nodes.size()); // TODO: should be 4 (redudant reorder in case of both layers are inplace)
+
+            InferenceEngine::SizeVector dims_src = {p.in.w, p.in.h, p.in.c, p.in.n};
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NHWC, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_normalize(*srcPtr, weights->readOnly().as<const float*>(), dst_ref, p);
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtNormalizeTests, TestsNormalize) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsNormalize, MKLDNNCPUExtNormalizeTests,
+        ::testing::Values(
+                normalize_test_params{{2, 5, 15, 15}, 0, 0, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 5, 15, 15}, 0, 1, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 5, 15, 15}, 1, 0, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 5, 15, 15}, 1, 1, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{3, 19, 9, 13}, 0, 0, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{3, 19, 9, 13}, 0, 1, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{3, 19, 9, 13}, 1, 0, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{3, 19, 9, 13}, 1, 1, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 64, 33, 65}, 0, 0, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 64, 33, 65}, 0, 1, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 64, 33, 65}, 1, 0, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 64, 33, 65}, 1, 1, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 3, 1, 1}, 0, 0, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 3, 1, 1}, 0, 1, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 3, 1, 1}, 1, 0, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 3, 1, 1}, 1, 1, 0.000001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 5, 15, 15}, 0, 0, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 5, 15, 15}, 0, 1, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 5, 15, 15}, 1, 0, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 5, 15, 15}, 1, 1, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{3, 19, 9, 13}, 0, 0, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{3, 19, 9, 13}, 0, 1, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{3, 19, 9, 13}, 1, 0, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{3, 19, 9, 13}, 1, 1, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 64, 33, 65}, 0, 0, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 64, 33, 65}, 0, 1, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 64, 33, 65}, 1, 0, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 64, 33, 65}, 1, 1, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 3, 1, 1}, 0, 0, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 3, 1, 1}, 0, 1, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 3, 1, 1}, 1, 0, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 3, 1, 1}, 1, 1, 0.000001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown }));
@@ -0,0 +1,375 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct proposal_test_params {
+    struct {
+        size_t n;
+        size_t h;
+        size_t w;
+    } in;
+
+    std::string framework;
+    int pre_nms_topn;
+    int post_nms_topn;
+    float nms_thresh;
+
+    size_t num_prim_desc;
+
+    int selectedType;
+
+    std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+};
+
+static const std::vector<float> proposal_ratios = {0.5f, 1.0f, 2.0f};
+static const std::vector<float> proposal_scales = {8.0f, 16.0f};
+static const int proposal_feat_stride = 16;
+static const int proposal_base_size = 16;
+static const int proposal_min_size = 1;
+
+struct ref_proposal_box {
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    float score;
+};
+
+// the serial Proposal: all the proposals are partially sorted and suppressed by the greedy NMS box by box
+void ref_proposal(const float *cls_prob, const float *bbox_pred, const float *im_info, float *rois,
+                  proposal_test_params prm) {
+    const bool tf = prm.framework == "tensorflow";
+    const float coordinates_offset = tf ? 0.0f : 1.0f;
+    const int H = static_cast<int>(prm.in.h);
+    const int W = static_cast<int>(prm.in.w);
+    const int A = static_cast<int>(proposal_ratios.size() * proposal_scales.size());
+    const int num_proposals = A * H * W;
+    const int pre_nms_topn = std::min(num_proposals, prm.pre_nms_topn);
+
+    std::vector<float> anchors(4 * A);
+    const float base_area = static_cast<float>(proposal_base_size * proposal_base_size);
+    const float center = 0.5f * (proposal_base_size - coordinates_offset);
+    for (size_t r = 0; r < proposal_ratios.size(); r++) {
+        float ratio_w = std::sqrt(base_area / proposal_ratios[r]);
+        float ratio_h = ratio_w * proposal_ratios[r];
+        if (!tf) {
+            ratio_w = std::roundf(std::sqrt(base_area / proposal_ratios[r]));
+            ratio_h = std::roundf(ratio_w * proposal_ratios[r]);
+        }
+        for (size_t s = 0; s < proposal_scales.size(); s++) {
+            const int a = static_cast<int>(r * proposal_scales.size() + s);
+            const float scale_w = 0.5f * (ratio_w * proposal_scales[s] - coordinates_offset);
+            const float scale_h = 0.5f * (ratio_h * proposal_scales[s] - coordinates_offset);
+            const float shift = tf ? 0.5f * proposal_base_size : 0.0f;
+            anchors[0 * A + a] = center - scale_w - shift;
+            anchors[1 * A + a] = center - scale_h - shift;
+            anchors[2 * A + a] = center + scale_w - shift;
+            anchors[3 * A + a] = center + scale_h - shift;
+        }
+    }
+
+    for (size_t n = 0; n < prm.in.n; n++) {
+        const float *score = cls_prob + (2 * n + 1) * num_proposals;
+        const float *delta = bbox_pred + 4 * n * num_proposals;
+        const float img_H = im_info[3 * n + 0];
+        const float img_W = im_info[3 * n + 1];
+        const float min_box = proposal_min_size * im_info[3 * n + 2];
+
+        std::vector<ref_proposal_box> proposals(num_proposals);
+        for (int h = 0; h < H; h++) {
+            for (int w = 0; w < W; w++) {
+                const float x = (tf ? h : w) * proposal_feat_stride;
+                const float y = (tf ? w : h) * proposal_feat_stride;
+                for (int a = 0; a < A; a++) {
+                    const float dx = delta[((a * 4 + 0) * H + h) * W + w];
+                    const float dy = delta[((a * 4 + 1) * H + h) * W + w];
+                    const float d_log_w = delta[((a * 4 + 2) * H + h) * W + w];
+                    const float d_log_h = delta[((a * 4 + 3) * H + h) * W + w];
+
+                    float x0 = x + anchors[0 * A + a];
+                    float y0 = y + anchors[1 * A + a];
+                    float x1 = x + anchors[2 * A + a];
+                    float y1 = y + anchors[3 * A + a];
+                    if (tf) {
+                        x0 = std::max<float>(0.0f, std::min<float>(x0, img_W));
+                        y0 = std::max<float>(0.0f, std::min<float>(y0, img_H));
+                        x1 = std::max<float>(0.0f, std::min<float>(x1, img_W));
+                        y1 = std::max<float>(0.0f, std::min<float>(y1, img_H));
+                    }
+
+                    const float ww = x1 - x0 + coordinates_offset;
+                    const float hh = y1 - y0 + coordinates_offset;
+                    const float ctr_x = dx * ww + (x0 + 0.5f * ww);
+                    const float ctr_y = dy * hh + (y0 + 0.5f * hh);
+                    const float pred_w = std::exp(d_log_w) * ww;
+                    const float pred_h = std::exp(d_log_h) * hh;
+
+                    ref_proposal_box &box = proposals[(h * W + w) * A + a];
+                    box.x0 = std::max<float>(0.0f, std::min<float>(ctr_x - 0.5f * pred_w, img_W - coordinates_offset));
+                    box.y0 = std::max<float>(0.0f, std::min<float>(ctr_y - 0.5f * pred_h, img_H - coordinates_offset));
+                    box.x1 = std::max<float>(0.0f, std::min<float>(ctr_x + 0.5f * pred_w, img_W - coordinates_offset));
+                    box.y1 = std::max<float>(0.0f, std::min<float>(ctr_y + 0.5f * pred_h, img_H - coordinates_offset));
+
+                    const float box_w = box.x1 - box.x0 + coordinates_offset;
+                    const float box_h = box.y1 - box.y0 + coordinates_offset;
+                    box.score = (min_box <= box_w) * (min_box <= box_h) * score[(a * H + h) * W + w];
+                }
+            }
+        }
+
+        std::partial_sort(proposals.begin(), proposals.begin() + pre_nms_topn, proposals.end(),
+                          [](const ref_proposal_box &box1, const ref_proposal_box &box2) {
+                              return box1.score > box2.score;
+                          });
+
+        std::vector<int> is_dead(pre_nms_topn, 0);
+        std::vector<int> kept;
+        for (int i = 0; i < pre_nms_topn && static_cast<int>(kept.size()) < prm.post_nms_topn; i++) {
+            if (is_dead[i])
+                continue;
+            kept.push_back(i);
+
+            const ref_proposal_box &A_box = proposals[i];
+            for (int j = i + 1; j < pre_nms_topn; j++) {
+                const ref_proposal_box &B_box = proposals[j];
+                float iou = 0.0f;
+                if (A_box.x0 <= B_box.x1 && A_box.y0 <= B_box.y1 && B_box.x0 <= A_box.x1 && B_box.y0 <= A_box.y1) {
+                    const float width = std::max<float>(0.0f, std::min(A_box.x1, B_box.x1) -
+                                                              std::max(A_box.x0, B_box.x0) + coordinates_offset);
+                    const float height = std::max<float>(0.0f, std::min(A_box.y1, B_box.y1) -
+                                                               std::max(A_box.y0, B_box.y0) + coordinates_offset);
+                    const float area = width * height;
+                    const float A_area = (A_box.x1 - A_box.x0 + coordinates_offset) *
+                                         (A_box.y1 - A_box.y0 + coordinates_offset);
+                    const float B_area = (B_box.x1 - B_box.x0 + coordinates_offset) *
+                                         (B_box.y1 - B_box.y0 + coordinates_offset);
+                    iou = area / (A_area + B_area - area);
+                }
+                if (prm.nms_thresh < iou)
+                    is_dead[j] = 1;
+            }
+        }
+
+        float *dst = rois + n * prm.post_nms_topn * 5;
+        for (int i = 0; i < 5 * prm.post_nms_topn; i++)
+            dst[i] = 0.0f;
+        for (size_t roi = 0; roi < kept.size(); roi++) {
+            const ref_proposal_box &box = proposals[kept[roi]];
+            dst[roi * 5 + 0] = static_cast<float>(n);
+            dst[roi * 5 + 1] = box.x0;
+            dst[roi * 5 + 2] = box.y0;
+            dst[roi * 5 + 3] = box.x1;
+            dst[roi * 5 + 4] = box.y1;
+        }
+        if (static_cast<int>(kept.size()) < prm.post_nms_topn)
+            dst[kept.size() * 5] = -1.0f;
+    }
+}
+
+class MKLDNNCPUExtProposalTests: public TestsCommon, public WithParamInterface<proposal_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="Proposal_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="cls_prob" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_CLS_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="bbox_pred" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_BBOX_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="im_info" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="proposal" id="3" type="Proposal" precision="FP32">
+            <data feat_stride="_FS_" base_size="_BS_" min_size="_MS_" ratio="0.5,1,2" scale="8,16"
+                  pre_nms_topn="_PRE_" post_nms_topn="_POST_" nms_thresh="_NMS_" framework="_FW_"/>
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_CLS_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_BBOX_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_ROIS_</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="2"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(proposal_test_params p) {
+        std::string model = model_t;
+        const size_t num_anchors = proposal_ratios.size() * proposal_scales.size();
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+        REPLACE_WITH_NUM(model, "_CLS_", 2 * num_anchors);
+        REPLACE_WITH_NUM(model, "_BBOX_", 4 * num_anchors);
+        REPLACE_WITH_NUM(model, "_ROIS_", p.in.n * p.post_nms_topn);
+
+        REPLACE_WITH_NUM(model, "_FS_", proposal_feat_stride);
+        REPLACE_WITH_NUM(model, "_BS_", proposal_base_size);
+        REPLACE_WITH_NUM(model, "_MS_", proposal_min_size);
+        REPLACE_WITH_NUM(model, "_PRE_", p.pre_nms_topn);
+        REPLACE_WITH_NUM(model, "_POST_", p.post_nms_topn);
+        REPLACE_WITH_NUM(model, "_NMS_", p.nms_thresh);
+        REPLACE_WITH_STR(model, "_FW_", p.framework);
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            proposal_test_params p = ::testing::WithParamInterface<proposal_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            auto& nodes = graph.getNodes();
+            for (auto &node : nodes) {
+                if (node->getName() == "proposal") {
+                    ASSERT_LE(p.num_prim_desc, node->getSupportedPrimitiveDescriptors().size());
+                    for (size_t j = 0; j < p.num_prim_desc && j < p.comp.size(); j++) {
+                        p.comp.at(j)(node->getSupportedPrimitiveDescriptors().at(j));
+                    }
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.selectedType,
+                              node->getSelectedPrimitiveDescriptor()->getImplementationType() & p.selectedType);
+                }
+            }
+
+            InferenceEngine::InputsDataMap in = net_reader.getNetwork().getInputsInfo();
+            InferenceEngine::BlobMap srcs;
+            for (auto &input : in) {
+                InferenceEngine::Blob::Ptr src =
+                        InferenceEngine::make_shared_blob<float>(input.second->getTensorDesc());
+                src->allocate();
+                srcs[input.first] = src;
+            }
+
+            // the distinct scores keep the order of the proposals independent of the sort
+            float *cls_prob = srcs["cls_prob"]->buffer().as<float *>();
+            const size_t cls_size = srcs["cls_prob"]->size();
+            for (size_t i = 0; i < cls_size; i++)
+                cls_prob[i] = static_cast<float>((i * 7919) % cls_size) / cls_size;
+
+            float *bbox_pred = srcs["bbox_pred"]->buffer().as<float *>();
+            for (size_t i = 0; i < srcs["bbox_pred"]->size(); i++)
+                bbox_pred[i] = 0.2f * sin(static_cast<float>(i));
+
+            // the images of the batch are of different sizes
+            float *im_info = srcs["im_info"]->buffer().as<float *>();
+            for (size_t n = 0; n < p.in.n; n++) {
+                im_info[3 * n + 0] = static_cast<float>(p.in.h * proposal_feat_stride - 20 * n);
+                im_info[3 * n + 1] = static_cast<float>(p.in.w * proposal_feat_stride - 12 * n);
+                im_info[3 * n + 2] = 1.0f;
+            }
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_proposal(cls_prob, bbox_pred, im_info, dst_ref.data(), p);
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtProposalTests, TestsProposal) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsProposal, MKLDNNCPUExtProposalTests,
+        ::testing::Values(
+                // the top-n of the proposals is selected, the NMS runs over several tiles and fills the output
+                proposal_test_params{{1, 12, 12}, "", 300, 30, 0.7f, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                // fewer rois than post_nms_topn survive, the output ends with the marker
+                proposal_test_params{{1, 6, 8}, "", 6000, 300, 0.5f, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                proposal_test_params{{1, 9, 7}, "tensorflow", 200, 50, 0.7f, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                proposal_test_params{{2, 12, 12}, "", 300, 30, 0.7f, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                proposal_test_params{{2, 9, 7}, "tensorflow", 6000, 300, 0.6f, 1,
+                                     MKLDNNPlugin::impl_desc_type::unknown }));
@@ -0,0 +1,331 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct psroi_test_params {
+    struct {
+        size_t n;
+        size_t h;
+        size_t w;
+    } in;
+
+    size_t output_dim;
+    size_t group_size;
+    float spatial_scale;
+
+    // the rois after the real ones are marked by the batch index -1
+    size_t rois;
+    size_t real_rois;
+};
+
+void ref_psroi(const float *src, const float *rois, float *dst, psroi_test_params prm) {
+    const int C = static_cast<int>(prm.output_dim * prm.group_size * prm.group_size);
+    const int H = static_cast<int>(prm.in.h);
+    const int W = static_cast<int>(prm.in.w);
+    const int G = static_cast<int>(prm.group_size);
+    const int OC = static_cast<int>(prm.output_dim);
+
+    std::fill(dst, dst + prm.rois * OC * G * G, 0.0f);
+    for (size_t n = 0; n < prm.rois; n++) {
+        const float *roi = rois + n * 5;
+        const int batch = static_cast<int>(roi[0]);
+        if (batch == -1)
+            break;
+
+        const float roi_start_w = static_cast<float>(round(roi[1])) * prm.spatial_scale;
+        const float roi_start_h = static_cast<float>(round(roi[2])) * prm.spatial_scale;
+        const float roi_end_w = static_cast<float>(round(roi[3]) + 1.0f) * prm.spatial_scale;
+        const float roi_end_h = static_cast<float>(round(roi[4]) + 1.0f) * prm.spatial_scale;
+
+        const float bin_size_h = std::max<float>(roi_end_h - roi_start_h, 0.1f) / G;
+        const float bin_size_w = std::max<float>(roi_end_w - roi_start_w, 0.1f) / G;
+
+        for (int c = 0; c < OC; c++) {
+            for (int h = 0; h < G; h++) {
+                int hstart = floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h);
+                int hend = ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h);
+                hstart = std::min<int>(std::max<int>(hstart, 0), H);
+                hend = std::min<int>(std::max<int>(hend, 0), H);
+
+                for (int w = 0; w < G; w++) {
+                    int wstart = floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w);
+                    int wend = ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w);
+                    wstart = std::min<int>(std::max<int>(wstart, 0), W);
+                    wend = std::min<int>(std::max<int>(wend, 0), W);
+
+                    const float bin_area = (hend - hstart) * (wend - wstart);
+                    if (!bin_area)
+                        continue;
+
+                    const int gc = (c * G + h) * G + w;
+                    const float *map = src + (batch * C + gc) * H * W;
+                    float sum = 0.0f;
+                    for (int hh = hstart; hh < hend; hh++)
+                        for (int ww = wstart; ww < wend; ww++)
+                            sum += map[hh * W + ww];
+                    dst[((n * OC + c) * G + h) * G + w] = sum / bin_area;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * The score maps are pooled by two PSROIPooling layers: the first one reads them from the identity 1x1 convolution,
+ * which produces them in the blocked layout, the second one reads the planar input of the network
+ */
+class MKLDNNCPUExtPSROIPoolingTests: public TestsCommon, public WithParamInterface<psroi_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="PSROIPooling_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="rois" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_NR_</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" id="2" type="Convolution" precision="FP32">
+            <convolution stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1"
+                         output="_IC_" group="1"/>
+
+            <weights offset="0" size="_S1_" />
+            <biases offset="_S1_" size="_S2_" />
+
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="psroi_blk" id="3" type="PSROIPooling" precision="FP32">
+            <data output_dim="_OD_" group_size="_GS_" spatial_scale="_SS_"/>
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+                <port id="1">
+                    <dim>_NR_</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_NR_</dim>
+                    <dim>_OD_</dim>
+                    <dim>_GS_</dim>
+                    <dim>_GS_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="psroi_pln" id="4" type="PSROIPooling" precision="FP32">
+            <data output_dim="_OD_" group_size="_GS_" spatial_scale="_SS_"/>
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+                <port id="1">
+                    <dim>_NR_</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_NR_</dim>
+                    <dim>_OD_</dim>
+                    <dim>_GS_</dim>
+                    <dim>_GS_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="4" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="4" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    size_t channels(const psroi_test_params &p) {
+        return p.output_dim * p.group_size * p.group_size;
+    }
+
+    std::string getModel(psroi_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", channels(p));
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+        REPLACE_WITH_NUM(model, "_NR_", p.rois);
+
+        REPLACE_WITH_NUM(model, "_OD_", p.output_dim);
+        REPLACE_WITH_NUM(model, "_GS_", p.group_size);
+        REPLACE_WITH_NUM(model, "_SS_", p.spatial_scale);
+
+        REPLACE_WITH_NUM(model, "_S1_", channels(p) * channels(p) * sizeof(float));
+        REPLACE_WITH_NUM(model, "_S2_", channels(p) * sizeof(float));
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            psroi_test_params p = ::testing::WithParamInterface<psroi_test_params>::GetParam();
+            std::string model = getModel(p);
+            const size_t C = channels(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            // the identity convolution copies the input to its blocked output
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(
+                    InferenceEngine::Precision::U8, InferenceEngine::C, {(C * C + C) * sizeof(float)});
+            weights->allocate();
+            float *weights_data = reinterpret_cast<float *>(weights->buffer().as<uint8_t *>());
+            std::fill(weights_data, weights_data + C * C + C, 0.0f);
+            for (size_t c = 0; c < C; c++)
+                weights_data[c * C + c] = 1.0f;
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            MKLDNNPlugin::MKLDNNNodePtr convNode, blkNode;
+            for (auto &node : graph.getNodes()) {
+                ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                if (node->getName() == "conv")
+                    convNode = node;
+                if (node->getName() == "psroi_blk")
+                    blkNode = node;
+                if (node->getName() == "psroi_pln")
+                    ASSERT_EQ(InferenceEngine::NCHW,
+                              node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout());
+            }
+            ASSERT_NE(nullptr, convNode);
+            ASSERT_NE(nullptr, blkNode);
+
+            // the score maps of the convolution are read without the reorder if their layout is supported
+            const auto &convDesc = convNode->getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].desc;
+            const auto &blkDesc = blkNode->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc;
+            for (auto &supported : blkNode->getSupportedPrimitiveDescriptors()) {
+                if (MKLDNNPlugin::MKLDNNExtensionUtils::initTensorsAreEqual(supported.getConfig().inConfs[0].desc,
+                                                                             convDesc))
+                    ASSERT_TRUE(MKLDNNPlugin::MKLDNNExtensionUtils::initTensorsAreEqual(blkDesc, convDesc));
+            }
+
+            InferenceEngine::InputsDataMap in = net_reader.getNetwork().getInputsInfo();
+            InferenceEngine::BlobMap srcs;
+            for (auto &input : in) {
+                InferenceEngine::Blob::Ptr src =
+                        InferenceEngine::make_shared_blob<float>(input.second->getTensorDesc());
+                src->allocate();
+                srcs[input.first] = src;
+            }
+            fill_data(srcs["data"]->buffer(), srcs["data"]->size());
+
+            // the rois of the different sizes, some of them cross the borders of the image
+            float *rois = srcs["rois"]->buffer().as<float *>();
+            const size_t img_w = static_cast<size_t>(p.in.w / p.spatial_scale);
+            const size_t img_h = static_cast<size_t>(p.in.h / p.spatial_scale);
+            for (size_t r = 0; r < p.rois; r++) {
+                rois[r * 5 + 0] = r < p.real_rois ? static_cast<float>(r % p.in.n) : -1.0f;
+                rois[r * 5 + 1] = static_cast<float>((r * 37) % img_w);
+                rois[r * 5 + 2] = static_cast<float>((r * 53) % img_h);
+                rois[r * 5 + 3] = rois[r * 5 + 1] + static_cast<float>((r * 71) % img_w);
+                rois[r * 5 + 4] = rois[r * 5 + 2] + static_cast<float>((r * 29) % img_h);
+            }
+
+            InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            ASSERT_EQ(2, out.size());
+            InferenceEngine::BlobMap outputBlobs;
+            for (auto &output : out) {
+                InferenceEngine::TBlob<float>::Ptr dst =
+                        InferenceEngine::make_shared_blob<float>(output.second->getTensorDesc());
+                dst->allocate();
+                outputBlobs[output.first] = dst;
+            }
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(out["psroi_pln"]->getTensorDesc());
+            dst_ref.allocate();
+            ref_psroi(srcs["data"]->buffer().as<const float *>(), rois, dst_ref.data(), p);
+            compare(*outputBlobs["psroi_pln"], dst_ref);
+            compare(*outputBlobs["psroi_blk"], dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtPSROIPoolingTests, TestsPSROIPooling) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsPSROIPooling, MKLDNNCPUExtPSROIPoolingTests,
+        ::testing::Values(
+                psroi_test_params{{1, 14, 14}, 8, 3, 0.0625f, 16, 16 },
+                // the channels are not a multiple of the block, the block of the last channels is padded
+                psroi_test_params{{1, 9, 11}, 3, 7, 0.0625f, 10, 10 },
+                psroi_test_params{{2, 10, 12}, 4, 2, 0.125f, 12, 9 }));
@@ -0,0 +1,308 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct regionyolo_test_params {
+    struct {
+        size_t n;
+        size_t h;
+        size_t w;
+    } in;
+
+    int classes;
+    int coords;
+    int num;
+    // the softmax of the classes of YOLOv2, the mask of the anchors of YOLOv3 otherwise
+    bool do_softmax;
+    std::vector<int> mask;
+};
+
+static size_t regionyolo_anchors(const regionyolo_test_params &prm) {
+    return prm.do_softmax ? prm.num : prm.mask.size();
+}
+
+static size_t regionyolo_channels(const regionyolo_test_params &prm) {
+    return regionyolo_anchors(prm) * (prm.classes + prm.coords + 1);
+}
+
+void ref_regionyolo(const float *src, float *dst, regionyolo_test_params prm) {
+    const int B = static_cast<int>(prm.in.n);
+    const int A = static_cast<int>(regionyolo_anchors(prm));
+    const int S = static_cast<int>(prm.in.h * prm.in.w);
+    const int E = prm.classes + prm.coords + 1;
+
+    std::copy(src, src + B * A * E * S, dst);
+
+    auto logistic = [](float x) { return 1.0f / (1.0f + std::exp(-x)); };
+    for (int b = 0; b < B; b++) {
+        for (int a = 0; a < A; a++) {
+            float *anchor = dst + (b * A + a) * E * S;
+            // x and y, then the objectness of YOLOv2 or the objectness and the classes of YOLOv3
+            for (int i = 0; i < 2 * S; i++)
+                anchor[i] = logistic(anchor[i]);
+            const int activated = prm.do_softmax ? 1 : prm.classes + 1;
+            for (int i = prm.coords * S; i < (prm.coords + activated) * S; i++)
+                anchor[i] = logistic(anchor[i]);
+
+            if (!prm.do_softmax)
+                continue;
+            float *classes = anchor + (prm.coords + 1) * S;
+            for (int i = 0; i < S; i++) {
+                float max = classes[i];
+                for (int c = 1; c < prm.classes; c++)
+                    max = std::max(max, classes[c * S + i]);
+                float sum = 0.0f;
+                for (int c = 0; c < prm.classes; c++) {
+                    classes[c * S + i] = std::exp(classes[c * S + i] - max);
+                    sum += classes[c * S + i];
+                }
+                for (int c = 0; c < prm.classes; c++)
+                    classes[c * S + i] /= sum;
+            }
+        }
+    }
+}
+
+/**
+ * The input is activated by two RegionYolo layers: the first one reads it from the identity 1x1 convolution,
+ * which produces it in the blocked layout, the second one reads the planar input of the network
+ */
+class MKLDNNCPUExtRegionYoloTests: public TestsCommon, public WithParamInterface<regionyolo_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="RegionYolo_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" id="1" type="Convolution" precision="FP32">
+            <convolution stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1"
+                         output="_IC_" group="1"/>
+
+            <weights offset="0" size="_S1_" />
+            <biases offset="_S1_" size="_S2_" />
+
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="region_blk" id="2" type="RegionYolo" precision="FP32">
+            <data classes="_CL_" coords="_CO_" num="_NUM_" do_softmax="_SM_"_MASK_/>
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">_OUT_
+                </port>
+            </output>
+        </layer>
+        <layer name="region_pln" id="3" type="RegionYolo" precision="FP32">
+            <data classes="_CL_" coords="_CO_" num="_NUM_" do_softmax="_SM_"_MASK_/>
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">_OUT_
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(regionyolo_test_params p) {
+        std::string model = model_t;
+        const size_t C = regionyolo_channels(p);
+
+        // the output of YOLOv2 is flattened, the output of YOLOv3 keeps the shape of the input
+        std::string out_dims = "\n                    <dim>" + std::to_string(p.in.n) + "</dim>";
+        if (p.do_softmax) {
+            out_dims += "\n                    <dim>" + std::to_string(C * p.in.h * p.in.w) + "</dim>";
+        } else {
+            out_dims += "\n                    <dim>" + std::to_string(C) + "</dim>";
+            out_dims += "\n                    <dim>" + std::to_string(p.in.h) + "</dim>";
+            out_dims += "\n                    <dim>" + std::to_string(p.in.w) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "_OUT_", out_dims);
+
+        std::string mask;
+        for (size_t i = 0; i < p.mask.size(); i++)
+            mask += (i ? "," : "") + std::to_string(p.mask[i]);
+        REPLACE_WITH_STR(model, "_MASK_", mask.empty() ? "" : " mask=\"" + mask + "\"");
+
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", C);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_CL_", p.classes);
+        REPLACE_WITH_NUM(model, "_CO_", p.coords);
+        REPLACE_WITH_NUM(model, "_NUM_", p.num);
+        REPLACE_WITH_NUM(model, "_SM_", p.do_softmax ? 1 : 0);
+
+        REPLACE_WITH_NUM(model, "_S1_", C * C * sizeof(float));
+        REPLACE_WITH_NUM(model, "_S2_", C * sizeof(float));
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            regionyolo_test_params p = ::testing::WithParamInterface<regionyolo_test_params>::GetParam();
+            std::string model = getModel(p);
+            const size_t C = regionyolo_channels(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            // the identity convolution copies the input to its blocked output
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(
+                    InferenceEngine::Precision::U8, InferenceEngine::C, {(C * C + C) * sizeof(float)});
+            weights->allocate();
+            float *weights_data = reinterpret_cast<float *>(weights->buffer().as<uint8_t *>());
+            std::fill(weights_data, weights_data + C * C + C, 0.0f);
+            for (size_t c = 0; c < C; c++)
+                weights_data[c * C + c] = 1.0f;
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            MKLDNNPlugin::MKLDNNNodePtr convNode, blkNode;
+            for (auto &node : graph.getNodes()) {
+                ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                if (node->getName() == "conv")
+                    convNode = node;
+                if (node->getName() == "region_blk")
+                    blkNode = node;
+                if (node->getName() == "region_pln")
+                    ASSERT_EQ(InferenceEngine::NCHW,
+                              node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout());
+            }
+            ASSERT_NE(nullptr, convNode);
+            ASSERT_NE(nullptr, blkNode);
+
+            // the output of the convolution is read without the reorder if its layout is supported
+            const auto &convDesc = convNode->getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].desc;
+            const auto &blkDesc = blkNode->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc;
+            for (auto &supported : blkNode->getSupportedPrimitiveDescriptors()) {
+                if (MKLDNNPlugin::MKLDNNExtensionUtils::initTensorsAreEqual(supported.getConfig().inConfs[0].desc,
+                                                                             convDesc))
+                    ASSERT_TRUE(MKLDNNPlugin::MKLDNNExtensionUtils::initTensorsAreEqual(blkDesc, convDesc));
+            }
+
+            InferenceEngine::InputsDataMap in = net_reader.getNetwork().getInputsInfo();
+            InferenceEngine::BlobMap srcs;
+            for (auto &input : in) {
+                InferenceEngine::Blob::Ptr src =
+                        InferenceEngine::make_shared_blob<float>(input.second->getTensorDesc());
+                src->allocate();
+                srcs[input.first] = src;
+            }
+
+            // the logits of both signs and of the large magnitudes check the range of the fast exponent
+            float *data = srcs["data"]->buffer().as<float *>();
+            for (size_t i = 0; i < srcs["data"]->size(); i++)
+                data[i] = 8.0f * sin(static_cast<float>(i));
+
+            InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            ASSERT_EQ(2, out.size());
+            InferenceEngine::BlobMap outputBlobs;
+            for (auto &output : out) {
+                InferenceEngine::TBlob<float>::Ptr dst =
+                        InferenceEngine::make_shared_blob<float>(output.second->getTensorDesc());
+                dst->allocate();
+                outputBlobs[output.first] = dst;
+            }
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(out["region_pln"]->getTensorDesc());
+            dst_ref.allocate();
+            ref_regionyolo(data, dst_ref.data(), p);
+            compare(*outputBlobs["region_pln"], dst_ref);
+            compare(*outputBlobs["region_blk"], dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtRegionYoloTests, TestsRegionYolo) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsRegionYolo, MKLDNNCPUExtRegionYoloTests,
+        ::testing::Values(
+                // YOLOv2, the spatial size is not a multiple of the vector
+                regionyolo_test_params{{1, 13, 13}, 20, 4, 5, true, {}},
+                // the activations and the softmax span several blocks of the threads
+                regionyolo_test_params{{2, 26, 26}, 3, 4, 2, true, {}},
+                // YOLOv3
+                regionyolo_test_params{{1, 13, 13}, 80, 4, 9, false, {6, 7, 8}},
+                // the channels are not a multiple of the block, the block of the last channels is padded
+                regionyolo_test_params{{2, 19, 23}, 2, 4, 6, false, {0, 2, 4}}));
@@ -294,19 +294,38 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Values(
                 resample_test_params{{2, 64, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 64, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 64, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 64, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 3, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 3, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 3, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown }));
+                resample_test_params{{2, 3, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 5, 15, 25}, 1.f, 0, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{1, 5, 15, 25}, 0.4f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{1, 5, 15, 25}, 0.4f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{1, 5, 15, 25}, 0.4f, 0, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{1, 5, 15, 25}, 0.4f, 0, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 5, 20, 30}, 2.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 5, 20, 30}, 2.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 5, 20, 30}, 2.f, 0, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 5, 20, 30}, 2.f, 0, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 5, 20, 30}, 2.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 5, 20, 30}, 2.f, 1, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 19, 15, 27}, 1.5f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 19, 15, 27}, 1.5f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 19, 15, 27}, 1.5f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 19, 15, 27}, 1.5f, 1, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 11, 10, 20}, 0.5f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 11, 10, 20}, 0.5f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown }));
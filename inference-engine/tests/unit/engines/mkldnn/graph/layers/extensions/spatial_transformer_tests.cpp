@@ -0,0 +1,220 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include <algorithm>
+#include <cmath>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct spatial_transformer_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    struct {
+        size_t h;
+        size_t w;
+    } out;
+
+    // the 2x3 affine transformations of the images one after another
+    std::vector<float> theta;
+};
+
+void ref_spatial_transformer(const float *src, const float *theta, float *dst, spatial_transformer_test_params prm) {
+    const int N = static_cast<int>(prm.in.n);
+    const int C = static_cast<int>(prm.in.c);
+    const int H = static_cast<int>(prm.in.h);
+    const int W = static_cast<int>(prm.in.w);
+    const int OH = static_cast<int>(prm.out.h);
+    const int OW = static_cast<int>(prm.out.w);
+
+    for (int n = 0; n < N; n++) {
+        const float *th = theta + 6 * n;
+        for (int s = 0; s < OH; s++) {
+            for (int t = 0; t < OW; t++) {
+                // the output pixel in [-1, 1) is mapped to the input picture and sampled bilinearly
+                const float gx = static_cast<float>(s * 1.0 / OH * 2 - 1);
+                const float gy = static_cast<float>(t * 1.0 / OW * 2 - 1);
+                const float x = (th[0] * gx + th[1] * gy + th[2] + 1) / 2 * H;
+                const float y = (th[3] * gx + th[4] * gy + th[5] + 1) / 2 * W;
+                const int m0 = static_cast<int>(std::floor(x));
+                const int n0 = static_cast<int>(std::floor(y));
+
+                for (int c = 0; c < C; c++) {
+                    const float *pic = src + (n * C + c) * H * W;
+                    float res = 0.0f;
+                    for (int m = m0; m <= m0 + 1; m++) {
+                        for (int k = n0; k <= n0 + 1; k++) {
+                            if (m < 0 || m >= H || k < 0 || k >= W)
+                                continue;
+                            res += std::max(0.0f, 1 - std::abs(x - m)) * std::max(0.0f, 1 - std::abs(y - k)) *
+                                   pic[m * W + k];
+                        }
+                    }
+                    dst[((n * C + c) * OH + s) * OW + t] = res;
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtSpatialTransformerTests: public TestsCommon,
+                                           public WithParamInterface<spatial_transformer_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="SpatialTransformer_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="theta" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>6</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="st" id="2" type="SpatialTransformer" precision="FP32">
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>6</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(spatial_transformer_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_OH_", p.out.h);
+        REPLACE_WITH_NUM(model, "_OW_", p.out.w);
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            spatial_transformer_test_params p = ::testing::WithParamInterface<spatial_transformer_test_params>::GetParam();
+            std::string model = getModel(p);
+            ASSERT_EQ(6 * p.in.n, p.theta.size());
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            for (auto &node : graph.getNodes()) {
+                ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                if (node->getName() == "st")
+                    ASSERT_EQ(InferenceEngine::NCHW,
+                              node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout());
+            }
+
+            InferenceEngine::InputsDataMap in = net_reader.getNetwork().getInputsInfo();
+            InferenceEngine::BlobMap srcs;
+            for (auto &input : in) {
+                InferenceEngine::Blob::Ptr src =
+                        InferenceEngine::make_shared_blob<float>(input.second->getTensorDesc());
+                src->allocate();
+                srcs[input.first] = src;
+            }
+            fill_data(srcs["data"]->buffer(), srcs["data"]->size());
+            float *theta = srcs["theta"]->buffer().as<float *>();
+            std::copy(p.theta.begin(), p.theta.end(), theta);
+
+            InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_spatial_transformer(srcs["data"]->buffer().as<const float *>(), theta, dst_ref.data(), p);
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtSpatialTransformerTests, TestsSpatialTransformer) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsSpatialTransformer, MKLDNNCPUExtSpatialTransformerTests,
+        ::testing::Values(
+                spatial_transformer_test_params{{1, 3, 24, 94}, {24, 94}, {1.f, 0.f, 0.f, 0.f, 1.f, 0.f}},
+                // the output is smaller than the input in height and larger in width, some taps are out of the picture
+                spatial_transformer_test_params{{2, 5, 16, 20}, {12, 30}, {0.9f, -0.2f, 0.1f, 0.3f, 0.8f, -0.1f,
+                                                                           1.2f, 0.1f, -0.3f, -0.1f, 1.3f, 0.2f}},
+                // the rows are not a multiple of the vector, the single channel is sampled in the scalar tail
+                spatial_transformer_test_params{{1, 1, 7, 9}, {5, 11}, {0.5f, 0.f, 0.25f, 0.f, 0.5f, -0.25f}},
+                spatial_transformer_test_params{{3, 2, 10, 13}, {10, 13}, {0.8f, 0.f, 0.f, 0.f, 0.8f, 0.f,
+                                                                           1.f, 0.5f, 0.f, -0.5f, 1.f, 0.f,
+                                                                           2.f, 0.f, 1.f, 0.f, 2.f, -1.f}}));
@@ -197,19 +197,19 @@ protected:
             net_reader.SetWeights(weights_ptr);
 
             MKLDNNGraphTestClass graph;
-            graph.CreateGraph(net_reader.getNetwork());
+            graph.CreateRewrittenGraph(net_reader.getNetwork());
             auto& nodes = graph.getNodes();
+            // the BatchNorm is folded into the ScaleShift after it
+            size_t scaleShifts = 0;
             for (int i = 0; i < nodes.size(); i++) {
-                if ((nodes[i]->getType() == MKLDNNPlugin::Depthwise && nodes[i]->getCnnLayer()->type == "ScaleShift")
-                    || nodes[i]->getType() == MKLDNNPlugin::BatchNormalization) {
-                    ASSERT_LE(p.num_prim_desc, nodes[i]->getSupportedPrimitiveDescriptors().size());
-                    for (size_t j = 0; j < p.num_prim_desc && j < p.comp.size(); j++) {
-                        p.comp.at(j)(nodes[i]->getSupportedPrimitiveDescriptors().at(j));
-                    }
+                ASSERT_NE(MKLDNNPlugin::BatchNormalization, nodes[i]->getType());
+                if (nodes[i]->getType() == MKLDNNPlugin::Depthwise && nodes[i]->getCnnLayer()->type == "ScaleShift") {
+                    scaleShifts++;
                     ASSERT_NE(nullptr, nodes[i]->getSelectedPrimitiveDescriptor());
                     ASSERT_TRUE(nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType() | p.selectedType);
                 }
             }
+            ASSERT_EQ(1, scaleShifts);
 
             InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
             InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
@@ -293,7 +293,7 @@ protected:
 
             MKLDNNGraphTestClass graph;
             graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_ENABLED, InferenceEngine::PluginConfigParams::YES}});
-            graph.CreateGraph(net_reader.getNetwork());
+            graph.CreateRewrittenGraph(net_reader.getNetwork());
 
             InferenceEngine::SizeVector dims_src = {MB, p.in.c, p.in.h, p.in.w};
             InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
@@ -47,6 +47,15 @@ struct conv_test_params {
     std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
 };
 
+// the Winograd convolution is implemented for AVX-512 only
+static bool isAvx512Available() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_cpu_supports("avx512f");
+#else
+    return false;
+#endif
+}
+
 template <typename data_t>
 void ref_conv(const InferenceEngine::TBlob<data_t> &src, const data_t *weights, const size_t weightsSize,
                 InferenceEngine::TBlob<data_t> &dst, conv_test_params prm) {
@@ -193,6 +202,8 @@ protected:
         try {
             TestsCommon::SetUp();
             conv_test_params p = ::testing::WithParamInterface<conv_test_params>::GetParam();
+            if ((p.selectedType & MKLDNNPlugin::impl_desc_type::winograd) && !isAvx512Available())
+                GTEST_SKIP();
             std::string model = getModel(p);
 
             InferenceEngine::CNNNetReader net_reader;
@@ -279,6 +290,9 @@ INSTANTIATE_TEST_CASE_P(
                                  3, 3, 1, 2, 0, 0, 20, 1, 5, MKLDNNPlugin::impl_desc_type::jit },
                 conv_test_params{{1, 1, 32, 16},
                                  2, 4, 2, 1, 0, 0, 17, 1, 5, MKLDNNPlugin::impl_desc_type::jit },
+                // Winograd by default on AVX-512, skipped without it
+                conv_test_params{{1, 64, 28, 28},
+                                 3, 3, 1, 1, 1, 1, 64, 1, 5, MKLDNNPlugin::impl_desc_type::jit_avx512_winograd },
                 conv_test_params{{1, 9, 16, 32},
                                  1, 1, 1, 1, 0, 0, 17, 1, 7, MKLDNNPlugin::impl_desc_type::gemm,
                                  {MKLDNNPlugin::impl_desc_type::gemm_any,
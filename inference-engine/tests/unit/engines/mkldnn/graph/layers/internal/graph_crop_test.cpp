@@ -252,7 +252,27 @@ INSTANTIATE_TEST_CASE_P(
                             ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().outConfs.at(0).desc.getLayout());
                         }} },
                 crop_test_params{{1, 5, 32, 32}, {3}, {10}, {20}, 1, MKLDNNPlugin::impl_desc_type::unknown },
-                crop_test_params{{1, 5, 32, 20}, {2, 3}, {30, 10}, {2, 10}, 1, MKLDNNPlugin::impl_desc_type::unknown }));
+                crop_test_params{{1, 5, 32, 20}, {2, 3}, {30, 10}, {2, 10}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                crop_test_params{{1, 16, 8, 8}, {1}, {8}, {8}, 4, MKLDNNPlugin::impl_desc_type::unknown, {
+                        [](MKLDNNPlugin::PrimitiveDescInfo impl) {
+                            ASSERT_EQ(1, impl.getConfig().outConfs.size());
+                            ASSERT_EQ(0, impl.getConfig().outConfs.at(0).inPlace);
+                        },
+                        [](MKLDNNPlugin::PrimitiveDescInfo impl) {
+                            ASSERT_EQ(1, impl.getConfig().outConfs.size());
+                            ASSERT_EQ(0, impl.getConfig().outConfs.at(0).inPlace);
+                        },
+                        [](MKLDNNPlugin::PrimitiveDescInfo impl) {
+                            ASSERT_EQ(1, impl.getConfig().outConfs.size());
+                            ASSERT_EQ(-1, impl.getConfig().outConfs.at(0).inPlace);
+                            ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().outConfs.at(0).desc.getLayout());
+                        }}},
+                crop_test_params{{3, 8, 16, 16}, {0}, {1}, {2}, 4, MKLDNNPlugin::impl_desc_type::unknown, {
+                        [](MKLDNNPlugin::PrimitiveDescInfo impl) {
+                            ASSERT_EQ(1, impl.getConfig().outConfs.size());
+                            ASSERT_EQ(0, impl.getConfig().outConfs.at(0).inPlace);
+                        }}},
+                crop_test_params{{2, 24, 4, 4}, {0, 1}, {1, 8}, {1, 8}, 4, MKLDNNPlugin::impl_desc_type::unknown }));
 
 class MKLDNNGraphDynBatchCropTests: public MKLDNNGraphCropTests {
 protected:
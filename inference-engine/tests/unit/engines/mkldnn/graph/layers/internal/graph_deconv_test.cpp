@@ -14,6 +14,7 @@
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
 #include <inference_engine/cnn_network_impl.hpp>
 #include "tests_common.hpp"
+#include <cmath>
 
 
 using namespace ::testing;
@@ -197,6 +198,10 @@ protected:
         return model;
     }
 
+    virtual void fillWeights(float *data, size_t size, const deconv_test_params &p) {
+        fill_data(data, size);
+    }
+
     virtual void TearDown() {
     }
 
@@ -214,7 +219,7 @@ protected:
             InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, dims_weights);
 
             weights->allocate();
-            fill_data(weights->data().as<float*>(), weights->size() / sizeof(float));
+            fillWeights(weights->data().as<float*>(), weights->size() / sizeof(float), p);
 
             InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
 
@@ -294,6 +299,34 @@ INSTANTIATE_TEST_CASE_P(
                 deconv_test_params{{2, 8, 5, 5}, 4, 8, 2, 4, 1, 1, 8, 8, 4, {MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::_dw}}
         ));
 
+class MKLDNNGraphBilinearDeconvolutionalTests: public MKLDNNGraphDeconvolutionalTests {
+protected:
+    // the kernels of the bilinear upsampling (as the bilinear filler of Caffe does) scaled by the channel
+    void fillWeights(float *data, size_t size, const deconv_test_params &p) override {
+        auto bilinear = [](size_t k, size_t i) {
+            float f = std::ceil(k / 2.0f);
+            float c = (2 * f - 1 - static_cast<int>(f) % 2) / (2 * f);
+            return 1 - std::fabs(i / f - c);
+        };
+        for (size_t i = 0; i < size; i++) {
+            size_t kw = i % p.krn_w;
+            size_t kh = i / p.krn_w % p.krn_h;
+            size_t c = i / (p.krn_w * p.krn_h);
+            data[i] = (1.0f + 0.1f * c) * bilinear(p.krn_h, kh) * bilinear(p.krn_w, kw);
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphBilinearDeconvolutionalTests, TestsBilinearDeconvolution) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestBilinearDeconvolution, MKLDNNGraphBilinearDeconvolutionalTests,
+        ::testing::Values(
+                deconv_test_params{{2, 8, 5, 5}, 4, 4, 2, 2, 1, 1, 8, 8, 3, {MKLDNNPlugin::impl_desc_type::unknown}},
+                deconv_test_params{{1, 19, 5, 7}, 3, 3, 2, 2, 1, 1, 19, 19, 3, {MKLDNNPlugin::impl_desc_type::unknown}},
+                deconv_test_params{{2, 16, 4, 4}, 8, 4, 4, 2, 2, 1, 16, 16, 3, {MKLDNNPlugin::impl_desc_type::unknown}}
+        ));
+
 class MKLDNNGraphDynBatchDeconvolutionalTests: public MKLDNNGraphDeconvolutionalTests {
 protected:
     virtual void SetUp() {
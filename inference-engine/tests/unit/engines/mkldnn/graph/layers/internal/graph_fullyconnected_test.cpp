@@ -304,3 +304,72 @@ INSTANTIATE_TEST_CASE_P(
                 fc_test_params{{1, 3, 227, 227}, 96, 6, MKLDNNPlugin::impl_desc_type::ref, {MKLDNNPlugin::impl_desc_type::ref_any}},
                 fc_test_params{{1, 4, 227, 227}, 8, 6, MKLDNNPlugin::impl_desc_type::ref, {MKLDNNPlugin::impl_desc_type::ref_any}},
                 fc_test_params{{1, 4, 227, 227}, 10, 6, MKLDNNPlugin::impl_desc_type::ref, {MKLDNNPlugin::impl_desc_type::ref_any}}));
+
+class MKLDNNGraphFP16WeightsFullyConnectedTests: public MKLDNNGraphFullyConnectedTests {
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            fc_test_params p = ::testing::WithParamInterface<fc_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {(p.in.w * p.in.h * p.in.c * p.out_c + p.out_c) * sizeof(float)});
+            weights->allocate();
+            fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            MKLDNNGraphTestClass graph;
+            graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_FP16_WEIGHTS, InferenceEngine::PluginConfigParams::YES}});
+            graph.CreateGraph(net_reader.getNetwork());
+
+            InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            InferenceEngine::TBlob<float>* srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+
+            ref_innerproduct(*srcPtr, (const float *)weights->buffer(), weights->size() / sizeof(float), dst_ref, p);
+
+            // the weights are rounded to FP16, the sums are accumulated in FP32
+            compare(*output, dst_ref, 0.05f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphFP16WeightsFullyConnectedTests, TestsFP16WeightsFullyConnected) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsFP16WeightsFullyConnected, MKLDNNGraphFP16WeightsFullyConnectedTests,
+        ::testing::Values(
+                fc_test_params{{1, 16, 8, 8}, 64, 6, MKLDNNPlugin::impl_desc_type::gemm },
+                fc_test_params{{2, 3, 5, 7}, 10, 6, MKLDNNPlugin::impl_desc_type::gemm },
+                fc_test_params{{3, 20, 4, 4}, 33, 6, MKLDNNPlugin::impl_desc_type::gemm }));
@@ -0,0 +1,245 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <inference_engine/cnn_network_impl.hpp>
+#include "tests_common.hpp"
+#include <cmath>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct rnn_test_params {
+    std::string cell_type;
+    std::string direction;
+    // the dimension of the time steps
+    size_t axis;
+
+    size_t n;
+    size_t t;
+    size_t d;
+    size_t s;
+};
+
+static float ref_logistic(float x) {
+    return 1.0f / (1.0f + std::exp(-x));
+}
+
+void ref_rnn(const InferenceEngine::TBlob<float> &src, const float *weights, const float *biases,
+             InferenceEngine::TBlob<float> &dst_blob, rnn_test_params prm) {
+    const float *x = src.readOnly();
+    float *y = dst_blob.data();
+    const bool lstm = prm.cell_type == "LSTM";
+    const size_t G = lstm ? 4 : 3;
+    const size_t S = prm.s;
+    const size_t D = prm.d;
+
+    for (size_t n = 0; n < prm.n; n++) {
+        std::vector<float> h(S, 0.0f), c(S, 0.0f), gates(G * S);
+        for (size_t step = 0; step < prm.t; step++) {
+            size_t t = prm.direction == "Backward" ? prm.t - 1 - step : step;
+            size_t row = prm.axis == 1 ? n * prm.t + t : t * prm.n + n;
+
+            for (size_t g = 0; g < G * S; g++) {
+                const float *w = weights + g * (D + S);
+                float value = biases[g];
+                for (size_t k = 0; k < D; k++)
+                    value += w[k] * x[row * D + k];
+                // the candidate of the GRU cell takes the recurrent part from the reset state below
+                if (lstm || g < 2 * S) {
+                    for (size_t k = 0; k < S; k++)
+                        value += w[D + k] * h[k];
+                }
+                gates[g] = value;
+            }
+
+            if (lstm) {
+                for (size_t k = 0; k < S; k++) {
+                    c[k] = ref_logistic(gates[S + k]) * c[k] + ref_logistic(gates[k]) * std::tanh(gates[2 * S + k]);
+                    h[k] = ref_logistic(gates[3 * S + k]) * std::tanh(c[k]);
+                }
+            } else {
+                std::vector<float> rh(S);
+                for (size_t k = 0; k < S; k++)
+                    rh[k] = ref_logistic(gates[S + k]) * h[k];
+                for (size_t k = 0; k < S; k++) {
+                    const float *w = weights + (2 * S + k) * (D + S) + D;
+                    float value = gates[2 * S + k];
+                    for (size_t j = 0; j < S; j++)
+                        value += w[j] * rh[j];
+                    float z = ref_logistic(gates[k]);
+                    h[k] = (1.0f - z) * std::tanh(value) + z * h[k];
+                }
+            }
+
+            for (size_t k = 0; k < S; k++)
+                y[row * S + k] = h[k];
+        }
+    }
+}
+
+class MKLDNNGraphRNNTests: public TestsCommon,
+                           public WithParamInterface<rnn_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="RNN_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_I0_</dim>
+                    <dim>_I1_</dim>
+                    <dim>_ID_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="rnn" id="1" type="RNN" precision="FP32">
+            <data cell_type="_CELL_" direction="_DIR_" axis="_AX_" hidden_size="_HS_"/>
+
+            <weights offset="0" size="_S1_" />
+            <biases offset="_S1_" size="_S2_" />
+
+            <input>
+                <port id="1">
+                    <dim>_I0_</dim>
+                    <dim>_I1_</dim>
+                    <dim>_ID_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_I0_</dim>
+                    <dim>_I1_</dim>
+                    <dim>_HS_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+
+protected:
+    size_t getGates(const rnn_test_params &p) {
+        return p.cell_type == "LSTM" ? 4 : 3;
+    }
+
+    std::string getModel(rnn_test_params p) {
+        std::string model = model_t;
+
+        REPLACE_WITH_NUM(model, "_I0_", p.axis == 1 ? p.n : p.t);
+        REPLACE_WITH_NUM(model, "_I1_", p.axis == 1 ? p.t : p.n);
+        REPLACE_WITH_NUM(model, "_ID_", p.d);
+        REPLACE_WITH_NUM(model, "_HS_", p.s);
+        REPLACE_WITH_NUM(model, "_AX_", p.axis);
+        REPLACE_WITH_STR(model, "_CELL_", p.cell_type);
+        REPLACE_WITH_STR(model, "_DIR_", p.direction);
+
+        size_t G = getGates(p);
+        REPLACE_WITH_NUM(model, "_S1_", G * p.s * (p.d + p.s) * sizeof(float));
+        REPLACE_WITH_NUM(model, "_S2_", G * p.s * sizeof(float));
+
+        return model;
+    }
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            rnn_test_params p = ::testing::WithParamInterface<rnn_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t G = getGates(p);
+            size_t w_size = G * p.s * (p.d + p.s);
+            size_t b_size = G * p.s;
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {(w_size + b_size) * sizeof(float)});
+            weights->allocate();
+            fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+            net_reader.SetWeights(weights_ptr);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+            auto& nodes = graph.getNodes();
+            bool found = false;
+            for (int i = 0; i < nodes.size(); i++) {
+                if (nodes[i]->getType() == MKLDNNPlugin::RNN) {
+                    found = true;
+                    ASSERT_EQ(1, nodes[i]->getSupportedPrimitiveDescriptors().size());
+                    ASSERT_NE(nullptr, nodes[i]->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(MKLDNNPlugin::impl_desc_type::unknown,
+                              nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
+                }
+            }
+            ASSERT_TRUE(found);
+
+            InferenceEngine::SizeVector dims_src = {p.axis == 1 ? p.n : p.t, p.axis == 1 ? p.t : p.n, p.d};
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::CHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            InferenceEngine::TBlob<float>* srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+
+            const float *w_data = (const float *) weights->buffer();
+            ref_rnn(*srcPtr, w_data, w_data + w_size, dst_ref, p);
+
+            compare(*output, dst_ref, 0.001f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphRNNTests, TestsRNN) {}
+
+
+INSTANTIATE_TEST_CASE_P(
+        TestsRNN, MKLDNNGraphRNNTests,
+        ::testing::Values(
+                rnn_test_params{"LSTM", "Forward", 1, 2, 5, 7, 16},
+                rnn_test_params{"LSTM", "Backward", 1, 3, 4, 16, 70},
+                rnn_test_params{"LSTM", "Forward", 0, 3, 6, 8, 9},
+                rnn_test_params{"GRU", "Forward", 1, 2, 5, 7, 16},
+                rnn_test_params{"GRU", "Backward", 0, 4, 3, 12, 65}));
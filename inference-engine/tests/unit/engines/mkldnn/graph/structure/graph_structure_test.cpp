@@ -10,9 +10,15 @@
 
 #include "single_layer_common.hpp"
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <mkldnn_plugin/mkldnn_infer_request.h>
 #include "tests_common.hpp"
 #include "../test_graph.hpp"
 #include <ext_list.hpp>
+#include <cnn_network_int8_normalizer.hpp>
+#include <cnn_network_stats_impl.hpp>
+#include <chrono>
+#include <thread>
+#include <fstream>
 
 using namespace ::testing;
 using namespace std;
@@ -293,7 +299,7 @@ TEST_F(MKLDNNGraphStructureTests, TestRedundantReorderBeforeConvWithC_3) {
 
 
     MKLDNNGraphTestClass graph;
-    graph.CreateGraph(net_reader.getNetwork());
+    graph.CreateRewrittenGraph(net_reader.getNetwork());
 
     size_t reorders_num = 0;
     auto& nodes = graph.getNodes();
@@ -5579,4 +5585,2338 @@ TEST_F(MKLDNNGraphStructureTests, TestRefPoolingWithConcat) {
 
     graphInfer(net_reader.getNetwork(), inputBlobs, outputBlobs2, "cpu:ref_any");
     compare(*outputBlobs1.begin()->second, *outputBlobs2.begin()->second);
-}
\ No newline at end of file
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestThroughputStreamsExecution) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::Config cfg;
+    cfg.throughputStreams = 2;
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), cfg, {}));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    const size_t requestsNum = 4;
+    InferenceEngine::ResponseDesc resp;
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(requestsNum);
+    std::vector<InferenceEngine::Blob::Ptr> srcs(requestsNum), dsts(requestsNum);
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+    for (size_t i = 0; i < requestsNum; i++) {
+        execNetwork->CreateInferRequest(requests[i]);
+
+        srcs[i] = InferenceEngine::make_shared_blob<float>(desc);
+        srcs[i]->allocate();
+        float *src_data = srcs[i]->buffer().as<float *>();
+        for (size_t j = 0; j < srcs[i]->size(); j++)
+            src_data[j] = static_cast<float>(i * 100 + j);
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->SetBlob("data", srcs[i], &resp)) << resp.msg;
+
+        dsts[i] = InferenceEngine::make_shared_blob<float>(desc);
+        dsts[i]->allocate();
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->SetBlob("power", dsts[i], &resp)) << resp.msg;
+    }
+
+    auto checkOutputs = [&]() {
+        for (size_t i = 0; i < requestsNum; i++) {
+            const float *src_data = srcs[i]->cbuffer().as<const float *>();
+            const float *dst_data = dsts[i]->cbuffer().as<const float *>();
+            for (size_t j = 0; j < dsts[i]->size(); j++)
+                ASSERT_FLOAT_EQ(2.0f * src_data[j] + 1.0f, dst_data[j]);
+        }
+    };
+
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->StartAsync(&resp)) << resp.msg;
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp))
+                                    << resp.msg;
+    checkOutputs();
+
+    // the sync inference is run by a stream as well, so it does not share a graph with the async requests
+    for (size_t i = 0; i < requestsNum; i++)
+        std::fill_n(dsts[i]->buffer().as<float *>(), dsts[i]->size(), 0.0f);
+    for (size_t i = 1; i < requestsNum; i++)
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->StartAsync(&resp)) << resp.msg;
+    for (int n = 0; n < 10; n++)
+        ASSERT_EQ(InferenceEngine::OK, requests[0]->Infer(&resp)) << resp.msg;
+    for (size_t i = 1; i < requestsNum; i++)
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp))
+                                    << resp.msg;
+    checkOutputs();
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestParallelBranchesExecution) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power2" type="Power" precision="FP32" id="2">
+            <power_data power="1" scale="3" shift="0"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="3">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="3"/>
+        <edge from-layer="1" from-port="2" to-layer="3" to-port="5"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="6"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::Config cfg;
+    cfg.parallelBranches = true;
+    MKLDNNGraphTestClass graph;
+    graph.setConfig(cfg);
+    graph.CreateGraph(net_reader.getNetwork());
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    float *src_data = src->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++)
+        src_data[i] = static_cast<float>(i);
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::BlobMap outputBlobs;
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output;
+    output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    // the result should not depend on the order the branches are finished in
+    for (int iter = 0; iter < 10; iter++) {
+        graph.Infer(srcs, outputBlobs);
+
+        const float *dst_data = output->cbuffer().as<const float *>();
+        for (size_t i = 0; i < output->size(); i++)
+            ASSERT_FLOAT_EQ(5.0f * src_data[i] + 1.0f, dst_data[i]);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestZeroCopyBlobs) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::MKLDNNGraph::Ptr graph(new MKLDNNPlugin::MKLDNNGraph());
+    graph->CreateGraph(net_reader.getNetwork(), {});
+
+    InferenceEngine::InputsDataMap inputs = net_reader.getNetwork().getInputsInfo();
+    InferenceEngine::OutputsDataMap outputs = net_reader.getNetwork().getOutputsInfo();
+    MKLDNNPlugin::MKLDNNInferRequest zeroCopyRequest(inputs, outputs);
+    MKLDNNPlugin::MKLDNNInferRequest copyRequest(inputs, outputs);
+    zeroCopyRequest.SetGraph(graph);
+    copyRequest.SetGraph(graph);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    InferenceEngine::Blob::Ptr dst = InferenceEngine::make_shared_blob<float>(desc);
+    dst->allocate();
+    ASSERT_TRUE(zeroCopyRequest.IsZeroCopyBlob("data", src));
+    ASSERT_TRUE(zeroCopyRequest.IsZeroCopyBlob("power", dst));
+
+    InferenceEngine::TensorDesc nhwcDesc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NHWC);
+    InferenceEngine::Blob::Ptr nhwcSrc = InferenceEngine::make_shared_blob<float>(nhwcDesc);
+    nhwcSrc->allocate();
+    ASSERT_FALSE(zeroCopyRequest.IsZeroCopyBlob("data", nhwcSrc));
+
+    std::vector<uint8_t> buffer(src->byteSize() + 1);
+    InferenceEngine::Blob::Ptr unalignedSrc = InferenceEngine::make_shared_blob<float>(desc,
+            reinterpret_cast<float *>(buffer.data() + 1));
+    ASSERT_FALSE(zeroCopyRequest.IsZeroCopyBlob("data", unalignedSrc));
+
+    InferenceEngine::TensorDesc u8Desc(InferenceEngine::Precision::U8, {1, 3, 4, 4}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr u8Src = InferenceEngine::make_shared_blob<uint8_t>(u8Desc);
+    u8Src->allocate();
+    ASSERT_FALSE(zeroCopyRequest.IsZeroCopyBlob("data", u8Src));
+
+    float *src_data = src->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++)
+        src_data[i] = static_cast<float>(i);
+    uint8_t *u8_data = u8Src->buffer().as<uint8_t *>();
+    for (size_t i = 0; i < u8Src->size(); i++)
+        u8_data[i] = static_cast<uint8_t>(100 + i);
+
+    zeroCopyRequest.SetBlob("data", src);
+    zeroCopyRequest.SetBlob("power", dst);
+    copyRequest.SetBlob("data", u8Src);
+
+    // the requests share the graph, so the copying request must not write to the memory of the zero-copy one
+    zeroCopyRequest.Infer();
+    copyRequest.Infer();
+
+    InferenceEngine::Blob::Ptr copyDst;
+    copyRequest.GetBlob("power", copyDst);
+    const float *dst_data = dst->cbuffer().as<const float *>();
+    const float *copy_dst_data = copyDst->cbuffer().as<const float *>();
+    for (size_t i = 0; i < src->size(); i++) {
+        ASSERT_FLOAT_EQ(static_cast<float>(i), src_data[i]);
+        ASSERT_FLOAT_EQ(2.0f * i + 1.0f, dst_data[i]);
+        ASSERT_FLOAT_EQ(2.0f * (100 + i) + 1.0f, copy_dst_data[i]);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestU8InputWithMeanValuesConvertedInPlace) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>64</dim>
+                    <dim>80</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>64</dim>
+                    <dim>80</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>64</dim>
+                    <dim>80</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::InputsDataMap inputs = net_reader.getNetwork().getInputsInfo();
+    InferenceEngine::PreProcessInfo &preProcess = inputs["data"]->getPreProcess();
+    const float meanValues[] = {10.f, 20.f, 30.f};
+    preProcess.init(3);
+    for (size_t c = 0; c < 3; c++)
+        preProcess[c]->meanValue = meanValues[c];
+    preProcess.setVariant(InferenceEngine::MEAN_VALUE);
+
+    MKLDNNPlugin::MKLDNNGraph::Ptr graph(new MKLDNNPlugin::MKLDNNGraph());
+    graph->CreateGraph(net_reader.getNetwork(), {});
+
+    MKLDNNPlugin::MKLDNNInferRequest request(inputs, net_reader.getNetwork().getOutputsInfo());
+    request.SetGraph(graph);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::U8, {1, 3, 64, 80}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<uint8_t>(desc);
+    src->allocate();
+    uint8_t *src_data = src->buffer().as<uint8_t *>();
+    for (size_t i = 0; i < src->size(); i++)
+        src_data[i] = static_cast<uint8_t>(i % 256);
+    ASSERT_TRUE(graph->canConvertInput("data", src));
+
+    request.SetBlob("data", src);
+    request.Infer();
+
+    InferenceEngine::Blob::Ptr dst;
+    request.GetBlob("power", dst);
+    const float *dst_data = dst->cbuffer().as<const float *>();
+    const size_t planeSize = 64 * 80;
+    for (size_t i = 0; i < dst->size(); i++)
+        ASSERT_FLOAT_EQ(2.0f * (src_data[i] - meanValues[i / planeSize]) + 1.0f, dst_data[i]);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestGraphCacheReusesSelectedDescriptors) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::Config cfg;
+    cfg.graphCacheDir = ".";
+    std::string cachePath = MKLDNNPlugin::MKLDNNGraphCache(cfg.graphCacheDir, net_reader.getNetwork(), cfg).getPath();
+    std::remove(cachePath.c_str());
+
+    MKLDNNGraphTestClass graph;
+    graph.setConfig(cfg);
+    graph.CreateGraph(net_reader.getNetwork());
+
+    MKLDNNPlugin::MKLDNNGraphCache cache(cfg.graphCacheDir, net_reader.getNetwork(), cfg);
+    ASSERT_TRUE(cache.load());
+
+    MKLDNNGraphTestClass cachedGraph;
+    cachedGraph.setConfig(cfg);
+    cachedGraph.CreateGraph(net_reader.getNetwork());
+
+    auto& nodes = graph.getNodes();
+    auto& cachedNodes = cachedGraph.getNodes();
+    ASSERT_EQ(nodes.size(), cachedNodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_EQ(nodes[i]->getName(), cachedNodes[i]->getName());
+        ASSERT_EQ(nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType(),
+                  cachedNodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
+        auto& outConfs = nodes[i]->getSelectedPrimitiveDescriptor()->getConfig().outConfs;
+        auto& cachedOutConfs = cachedNodes[i]->getSelectedPrimitiveDescriptor()->getConfig().outConfs;
+        ASSERT_EQ(outConfs.size(), cachedOutConfs.size());
+        for (size_t j = 0; j < outConfs.size(); j++)
+            ASSERT_EQ(outConfs[j].desc.getLayout(), cachedOutConfs[j].desc.getLayout());
+    }
+
+    // the file of another key is ignored and written again by the next load
+    {
+        std::ofstream file(cachePath);
+        file << "MKLDNNGraphCache 0_generic" << std::endl;
+    }
+    ASSERT_FALSE(MKLDNNPlugin::MKLDNNGraphCache(cfg.graphCacheDir, net_reader.getNetwork(), cfg).load());
+
+    MKLDNNGraphTestClass rewrittenGraph;
+    rewrittenGraph.setConfig(cfg);
+    rewrittenGraph.CreateGraph(net_reader.getNetwork());
+    ASSERT_TRUE(MKLDNNPlugin::MKLDNNGraphCache(cfg.graphCacheDir, net_reader.getNetwork(), cfg).load());
+
+    std::remove(cachePath.c_str());
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestTuningFileReusesFastestConvolution) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="9216"/>
+            <biases offset="9216" size="64"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {9280});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNPlugin::Config cfg;
+    cfg.tuningFile = "mkldnn_tuning_test.txt";
+    std::remove(cfg.tuningFile.c_str());
+
+    cfg.tuningMode = MKLDNNPlugin::Config::TuningUseExisting;
+    MKLDNNGraphTestClass missingFileGraph;
+    missingFileGraph.setConfig(cfg);
+    ASSERT_THROW(missingFileGraph.CreateGraph(net_reader.getNetwork()), InferenceEngine::details::InferenceEngineException);
+
+    cfg.tuningMode = MKLDNNPlugin::Config::TuningCreate;
+    MKLDNNGraphTestClass tunedGraph;
+    tunedGraph.setConfig(cfg);
+    tunedGraph.CreateGraph(net_reader.getNetwork());
+
+    ASSERT_TRUE(MKLDNNPlugin::MKLDNNTuningCache(cfg.tuningFile).load());
+
+    cfg.tuningMode = MKLDNNPlugin::Config::TuningUseExisting;
+    MKLDNNGraphTestClass graph;
+    graph.setConfig(cfg);
+    graph.CreateGraph(net_reader.getNetwork());
+
+    auto& tunedNodes = tunedGraph.getNodes();
+    auto& nodes = graph.getNodes();
+    ASSERT_EQ(tunedNodes.size(), nodes.size());
+    bool hasConvolution = false;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_EQ(tunedNodes[i]->getName(), nodes[i]->getName());
+        if (nodes[i]->getType() != MKLDNNPlugin::Convolution)
+            continue;
+        hasConvolution = true;
+        ASSERT_EQ(tunedNodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType(),
+                  nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
+    }
+    ASSERT_TRUE(hasConvolution);
+
+    std::remove(cfg.tuningFile.c_str());
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestInt8ConvolutionsAreRequantized) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="1728"/>
+            <biases offset="1728" size="64"/>
+        </layer>
+        <layer name="relu1" type="ReLU" precision="FP32" id="2">
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv2" type="Convolution" precision="FP32" id="3">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="16" group="1"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="1792" size="1024"/>
+            <biases offset="2816" size="64"/>
+        </layer>
+        <layer name="relu2" type="ReLU" precision="FP32" id="4">
+            <input>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {2880});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    auto makeStats = [](size_t channels, float min, float max) {
+        InferenceEngine::NetworkNodeStatsPtr stats(new InferenceEngine::NetworkNodeStats(channels));
+        stats->_minOutputs.assign(channels, min);
+        stats->_maxOutputs.assign(channels, max);
+        return stats;
+    };
+    std::map<std::string, InferenceEngine::NetworkNodeStatsPtr> nodesStats;
+    nodesStats["data"] = makeStats(3, 0.f, 1.f);
+    nodesStats["conv1"] = makeStats(16, -4.f, 4.f);
+    nodesStats["relu1"] = makeStats(16, 0.f, 4.f);
+    nodesStats["conv2"] = makeStats(16, -8.f, 8.f);
+    InferenceEngine::details::CNNNetworkStatsImpl stats(nodesStats);
+
+    InferenceEngine::CNNNetwork network = net_reader.getNetwork();
+    InferenceEngine::details::CNNNetworkInt8Normalizer normalizer;
+    ASSERT_NO_THROW(normalizer.NormalizeNetwork(network, stats));
+
+    for (auto &layer : network) {
+        if (layer->type != "Convolution")
+            continue;
+        auto *convLayer = dynamic_cast<InferenceEngine::ConvolutionLayer *>(layer.get());
+        ASSERT_NE(nullptr, convLayer);
+        ASSERT_EQ(InferenceEngine::Precision::I8, convLayer->precision);
+        ASSERT_EQ(InferenceEngine::Precision::I8, convLayer->_weights->precision());
+        ASSERT_EQ(InferenceEngine::Precision::I32, convLayer->_biases->precision());
+    }
+
+    // the quantized implementations require AVX512 with byte and word instructions
+    std::string isa = MKLDNNPlugin::MKLDNNExtensionUtils::getIsaName();
+    if (isa.find("avx512bw") == std::string::npos || isa.find("avx512vl") == std::string::npos)
+        return;
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(network));
+
+    size_t scaleShifts = 0;
+    for (auto &node : graph.getNodes()) {
+        if (node->getType() == MKLDNNPlugin::Depthwise)
+            scaleShifts++;
+        if (node->getName() == "conv1") {
+            // the ScaleShifts between the convolutions are folded into the output scales of conv1
+            auto &config = node->getSelectedPrimitiveDescriptor()->getConfig();
+            ASSERT_EQ(InferenceEngine::Precision::U8, config.inConfs[0].desc.getPrecision());
+            ASSERT_EQ(InferenceEngine::Precision::U8, config.outConfs[0].desc.getPrecision());
+            ASSERT_EQ(node->getChildEdgeAt(0)->getChild()->getName(), "conv2");
+        } else if (node->getName() == "conv2") {
+            // the output of the network is dequantized by the convolution
+            auto &config = node->getSelectedPrimitiveDescriptor()->getConfig();
+            ASSERT_EQ(InferenceEngine::Precision::U8, config.inConfs[0].desc.getPrecision());
+            ASSERT_EQ(InferenceEngine::Precision::FP32, config.outConfs[0].desc.getPrecision());
+        }
+    }
+    // only the ScaleShift which quantizes the input of the network is left
+    ASSERT_EQ(1, scaleShifts);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestScaleShiftAndActivationsAreFusedIntoConvolutionAndFC) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="2" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+            <weights offset="0" size="16"/>
+            <biases offset="16" size="8"/>
+        </layer>
+        <layer name="scale" type="ScaleShift" precision="FP32" id="2">
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+            <weights offset="24" size="8"/>
+            <biases offset="32" size="8"/>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="3">
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fc" type="FullyConnected" precision="FP32" id="4">
+            <fc_data out-size="3"/>
+            <input>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+            <weights offset="40" size="96"/>
+            <biases offset="136" size="12"/>
+        </layer>
+        <layer name="fc_relu" type="ReLU" precision="FP32" id="5">
+            <input>
+                <port id="9">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="10">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>
+        <edge from-layer="4" from-port="8" to-layer="5" to-port="9"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {148});
+    weights->allocate();
+    float *w = weights->buffer().as<float *>();
+    const float convWeights[] = {1.0f, -1.0f, 0.5f, 2.0f};
+    const float convBiases[] = {0.5f, -1.0f};
+    const float scales[] = {2.0f, -0.5f};
+    const float shifts[] = {1.0f, 0.25f};
+    const float fcBiases[] = {0.1f, -0.2f, 0.3f};
+    std::copy_n(convWeights, 4, w);
+    std::copy_n(convBiases, 2, w + 4);
+    std::copy_n(scales, 2, w + 6);
+    std::copy_n(shifts, 2, w + 8);
+    float *fcWeights = w + 10;
+    for (size_t i = 0; i < 24; i++)
+        fcWeights[i] = (static_cast<int>(i % 5) - 2) * 0.25f;
+    std::copy_n(fcBiases, 3, w + 34);
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    for (auto &node : graph.getNodes()) {
+        ASSERT_NE(MKLDNNPlugin::Depthwise, node->getType());
+        ASSERT_NE(MKLDNNPlugin::Activation, node->getType());
+        if (node->getName() == "conv")
+            ASSERT_EQ(MKLDNNPlugin::Convolution_Activation, node->getType());
+    }
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 2, 2, 2}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    float *src_data = src->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++)
+        src_data[i] = (static_cast<int>(i % 7) - 3) * 0.5f;
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    // the reference of the unfused layers, the pixels are in nchw order
+    float hidden[8];
+    for (size_t c = 0; c < 2; c++) {
+        for (size_t p = 0; p < 4; p++) {
+            float value = convBiases[c];
+            for (size_t ic = 0; ic < 2; ic++)
+                value += convWeights[c * 2 + ic] * src_data[ic * 4 + p];
+            hidden[c * 4 + p] = std::max(value * scales[c] + shifts[c], 0.0f);
+        }
+    }
+    const float *dst_data = output->buffer().as<const float *>();
+    for (size_t o = 0; o < 3; o++) {
+        float value = fcBiases[o];
+        for (size_t i = 0; i < 8; i++)
+            value += fcWeights[o * 8 + i] * hidden[i];
+        ASSERT_NEAR(std::max(value, 0.0f), dst_data[o], 1e-5f);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestConstantSubgraphIsFoldedOnLoad) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="const" type="Const" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="0" size="48"/>
+            </blobs>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="2">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power2" type="Power" precision="FP32" id="3">
+            <power_data power="1" scale="0.5" shift="0.25"/>
+            <input>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="4">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="2"/>
+        <edge from-layer="2" from-port="3" to-layer="3" to-port="4"/>
+        <edge from-layer="0" from-port="0" to-layer="4" to-port="6"/>
+        <edge from-layer="3" from-port="5" to-layer="4" to-port="7"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {48});
+    weights->allocate();
+    float *constData = weights->buffer().as<float *>();
+    for (size_t i = 0; i < 12; i++)
+        constData[i] = static_cast<float>(i);
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    // only the last node of the constant subgraph keeps the computed data
+    bool hasFoldedResult = false;
+    for (auto &node : graph.getNodes()) {
+        ASSERT_NE("const", node->getName());
+        ASSERT_NE("power1", node->getName());
+        if (node->getName() == "power2") {
+            ASSERT_TRUE(node->getParentEdges().empty());
+            hasFoldedResult = true;
+        }
+    }
+    ASSERT_TRUE(hasFoldedResult);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 2, 2}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    float *src_data = src->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++)
+        src_data[i] = 100.0f * i;
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    // the folded data must survive several inferences
+    for (int iter = 0; iter < 2; iter++) {
+        graph.Infer(srcs, outputBlobs);
+
+        const float *dst_data = output->buffer().as<const float *>();
+        for (size_t i = 0; i < output->size(); i++)
+            ASSERT_FLOAT_EQ(src_data[i] + (2.0f * constData[i] + 1.0f) * 0.5f + 0.25f, dst_data[i]);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestInputReorderIsReusedBetweenInferences) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="1" shift="0.5"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    // the same NHWC input is pushed with the different data, then the format changes
+    const InferenceEngine::Layout layouts[] = {InferenceEngine::NHWC, InferenceEngine::NHWC, InferenceEngine::NCHW};
+    for (int iter = 0; iter < 3; iter++) {
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 5}, layouts[iter]);
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+        src->allocate();
+        float *src_data = src->buffer().as<float *>();
+        for (size_t i = 0; i < src->size(); i++)
+            src_data[i] = static_cast<float>(i + 100 * iter);
+
+        InferenceEngine::BlobMap srcs;
+        srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+        graph.Infer(srcs, outputBlobs);
+
+        const float *dst_data = output->buffer().as<const float *>();
+        for (size_t i = 0; i < output->size(); i++) {
+            ASSERT_FLOAT_EQ(src_data[src->getTensorDesc().offset(i)] + 0.5f,
+                            dst_data[output->getTensorDesc().offset(i)]);
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestWorkspaceGroupIsSharedBetweenGraphs) {
+    auto makeModel = [](size_t h, size_t w) {
+        std::string dims = "<dim>1</dim><dim>3</dim><dim>" + std::to_string(h) + "</dim><dim>" +
+                           std::to_string(w) + "</dim>";
+        return R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0">)V0G0N" + dims + R"V0G0N(</port></output>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input><port id="1">)V0G0N" + dims + R"V0G0N(</port></input>
+            <output><port id="2">)V0G0N" + dims + R"V0G0N(</port></output>
+        </layer>
+        <layer name="power2" type="Power" precision="FP32" id="2">
+            <power_data power="1" scale="1" shift="1"/>
+            <input><port id="3">)V0G0N" + dims + R"V0G0N(</port></input>
+            <output><port id="4">)V0G0N" + dims + R"V0G0N(</port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+    };
+
+    MKLDNNPlugin::Config cfg;
+    cfg.workspaceGroup = "pipeline";
+
+    // the second graph is bigger, so it reallocates the memory of the group
+    InferenceEngine::CNNNetReader smallReader, bigReader;
+    std::string smallModel = makeModel(4, 5), bigModel = makeModel(16, 20);
+    ASSERT_NO_THROW(smallReader.ReadNetwork(smallModel.data(), smallModel.length()));
+    ASSERT_NO_THROW(bigReader.ReadNetwork(bigModel.data(), bigModel.length()));
+
+    MKLDNNGraphTestClass smallGraph, bigGraph;
+    smallGraph.setConfig(cfg);
+    smallGraph.CreateGraph(smallReader.getNetwork());
+    bigGraph.setConfig(cfg);
+    bigGraph.CreateGraph(bigReader.getNetwork());
+
+    auto intermediateData = [](MKLDNNGraphTestClass &graph) -> void* {
+        for (auto &node : graph.GetNodes()) {
+            if (node->getName() == "power2")
+                return node->getParentEdgeAt(0)->getMemory().GetData();
+        }
+        return nullptr;
+    };
+
+    auto infer = [](MKLDNNGraphTestClass &graph, InferenceEngine::CNNNetReader &reader, size_t h, size_t w) {
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, h, w}, InferenceEngine::NCHW);
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+        src->allocate();
+        float *src_data = src->buffer().as<float *>();
+        for (size_t i = 0; i < src->size(); i++)
+            src_data[i] = static_cast<float>(i % 97);
+
+        InferenceEngine::BlobMap srcs;
+        srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+        InferenceEngine::OutputsDataMap out = reader.getNetwork().getOutputsInfo();
+        std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        InferenceEngine::BlobMap outputBlobs;
+        outputBlobs[item.first] = output;
+
+        graph.Infer(srcs, outputBlobs);
+
+        const float *dst_data = output->buffer().as<const float *>();
+        for (size_t i = 0; i < output->size(); i++)
+            ASSERT_FLOAT_EQ(src_data[i] * 2.0f + 1.0f, dst_data[i]);
+    };
+
+    infer(smallGraph, smallReader, 4, 5);
+    infer(bigGraph, bigReader, 16, 20);
+    infer(smallGraph, smallReader, 4, 5);
+
+    ASSERT_NE(nullptr, intermediateData(smallGraph));
+    ASSERT_EQ(intermediateData(bigGraph), intermediateData(smallGraph));
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestDynamicBatchSwitchesWithReshape) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="reshape" type="Reshape" precision="FP32" id="2">
+            <data dim="2,160" axis="0" num_axes="-1"/>
+            <input>
+                <port id="3">
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>2</dim>
+                    <dim>160</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power2" type="Power" precision="FP32" id="3">
+            <power_data power="1" scale="1" shift="1"/>
+            <input>
+                <port id="5">
+                    <dim>2</dim>
+                    <dim>160</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>2</dim>
+                    <dim>160</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_ENABLED, InferenceEngine::PluginConfigParams::YES}});
+    graph.CreateGraph(net_reader.getNetwork());
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    // the batch goes back and forth, the states of the nodes prepared for each batch are reused
+    const int batches[] = {2, 1, 1, 2, 1};
+    for (int iter = 0; iter < 5; iter++) {
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {2, 8, 4, 5}, InferenceEngine::NCHW);
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+        src->allocate();
+        float *src_data = src->buffer().as<float *>();
+        for (size_t i = 0; i < src->size(); i++)
+            src_data[i] = static_cast<float>((i + 7 * iter) % 41);
+
+        float *dst_data = output->buffer().as<float *>();
+        for (size_t i = 0; i < output->size(); i++)
+            dst_data[i] = -1.0f;
+
+        InferenceEngine::BlobMap srcs;
+        srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+        graph.Infer(srcs, outputBlobs, batches[iter]);
+
+        const size_t processed = output->size() / 2 * batches[iter];
+        for (size_t i = 0; i < processed; i++)
+            ASSERT_FLOAT_EQ(src_data[i] * 2.0f + 1.0f, dst_data[i]) << "iteration " << iter;
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestSelectionIsReusedForOtherInputShapes) {
+    auto makeModel = [](size_t h, size_t w) {
+        std::string dims = "<dim>1</dim><dim>3</dim><dim>" + std::to_string(h) + "</dim><dim>" +
+                           std::to_string(w) + "</dim>";
+        return R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0">)V0G0N" + dims + R"V0G0N(</port></output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="1"/>
+            <input><port id="1">)V0G0N" + dims + R"V0G0N(</port></input>
+            <output><port id="2">)V0G0N" + dims + R"V0G0N(</port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+    };
+
+    InferenceEngine::CNNNetReader smallReader, bigReader;
+    std::string smallModel = makeModel(4, 5), bigModel = makeModel(16, 20);
+    ASSERT_NO_THROW(smallReader.ReadNetwork(smallModel.data(), smallModel.length()));
+    ASSERT_NO_THROW(bigReader.ReadNetwork(bigModel.data(), bigModel.length()));
+
+    MKLDNNGraphTestClass smallGraph, bigGraph;
+    smallGraph.CreateGraph(smallReader.getNetwork());
+    bigGraph.setSelectionFrom(smallGraph);
+    bigGraph.CreateGraph(bigReader.getNetwork());
+
+    std::map<std::string, MKLDNNPlugin::impl_desc_type> selected;
+    for (auto &node : smallGraph.GetNodes())
+        selected[node->getName()] = node->getSelectedPrimitiveDescriptor()->getImplementationType();
+
+    for (auto &node : bigGraph.GetNodes()) {
+        auto found = selected.find(node->getName());
+        ASSERT_NE(selected.end(), found) << node->getName();
+        ASSERT_EQ(found->second, node->getSelectedPrimitiveDescriptor()->getImplementationType()) << node->getName();
+    }
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 16, 20}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    float *src_data = src->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++)
+        src_data[i] = static_cast<float>(i % 97);
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = bigReader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    bigGraph.Infer(srcs, outputBlobs);
+
+    float *dst_data = output->buffer().as<float *>();
+    for (size_t i = 0; i < output->size(); i++)
+        ASSERT_FLOAT_EQ(src_data[i] * 2.0f + 1.0f, dst_data[i]);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestSampledPerfCountsAreGroupedByLayerType) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>16</dim><dim>20</dim></port></output>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input><port id="1"><dim>1</dim><dim>3</dim><dim>16</dim><dim>20</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>3</dim><dim>16</dim><dim>20</dim></port></output>
+        </layer>
+        <layer name="power2" type="Power" precision="FP32" id="2">
+            <power_data power="1" scale="1" shift="1"/>
+            <input><port id="3"><dim>1</dim><dim>3</dim><dim>16</dim><dim>20</dim></port></input>
+            <output><port id="4"><dim>1</dim><dim>3</dim><dim>16</dim><dim>20</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_PERF_COUNT_SAMPLING, "3"},
+                       {InferenceEngine::PluginConfigParams::KEY_CPU_PERF_COUNT_STATISTIC,
+                        InferenceEngine::PluginConfigParams::PERF_COUNT_MAX},
+                       {InferenceEngine::PluginConfigParams::KEY_CPU_PERF_COUNT_BY_LAYER_TYPE,
+                        InferenceEngine::PluginConfigParams::YES}});
+    graph.CreateGraph(net_reader.getNetwork());
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 16, 20}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    // the inferences 0, 3 and 6 are timed
+    for (int i = 0; i < 7; i++)
+        graph.Infer(srcs, outputBlobs);
+
+    for (auto &node : graph.GetNodes()) {
+        if (node->getType() != MKLDNNPlugin::Input)
+            ASSERT_EQ(3, node->PerfSamples().count()) << node->getName();
+    }
+
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+    graph.GetPerfData(perfMap);
+    ASSERT_EQ(perfMap.end(), perfMap.find("power1"));
+    ASSERT_NE(perfMap.end(), perfMap.find("Power"));
+    ASSERT_STREQ("Power", perfMap["Power"].layer_type);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestInferRequestBlobsAreAccessedByIndex) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data1" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="data2" type="Input" precision="FP32" id="1">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="2">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port>
+                <port id="2"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port>
+            </input>
+            <output><port id="3"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::MKLDNNGraph::Ptr graph(new MKLDNNPlugin::MKLDNNGraph());
+    graph->CreateGraph(net_reader.getNetwork(), {});
+
+    MKLDNNPlugin::MKLDNNInferRequest request(net_reader.getNetwork().getInputsInfo(),
+                                             net_reader.getNetwork().getOutputsInfo());
+    request.SetGraph(graph);
+
+    // the inputs go first in the order of the names, the outputs follow them
+    InferenceEngine::Blob::Ptr byName, byIndex;
+    request.GetBlob("data2", byName);
+    request.GetBlobByIndex(1, byIndex);
+    ASSERT_EQ(byName, byIndex);
+    request.GetBlob("sum", byName);
+    request.GetBlobByIndex(2, byIndex);
+    ASSERT_EQ(byName, byIndex);
+    ASSERT_THROW(request.GetBlobByIndex(3, byIndex), InferenceEngine::details::InferenceEngineException);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src1 = InferenceEngine::make_shared_blob<float>(desc);
+    src1->allocate();
+    InferenceEngine::Blob::Ptr src2 = InferenceEngine::make_shared_blob<float>(desc);
+    src2->allocate();
+    float *src1_data = src1->buffer().as<float *>();
+    float *src2_data = src2->buffer().as<float *>();
+    for (size_t i = 0; i < src1->size(); i++) {
+        src1_data[i] = static_cast<float>(i);
+        src2_data[i] = static_cast<float>(100 + 2 * i);
+    }
+
+    request.SetBlobByIndex(0, src1);
+    request.SetBlobByIndex(1, src2);
+    request.Infer();
+
+    InferenceEngine::Blob::Ptr dst;
+    request.GetBlobByIndex(2, dst);
+    const float *dst_data = dst->cbuffer().as<const float *>();
+    for (size_t i = 0; i < dst->size(); i++)
+        ASSERT_FLOAT_EQ(src1_data[i] + src2_data[i], dst_data[i]);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestConcatOfBlockedInputsNotAlignedTo16IsInPlace) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>1</dim><dim>16</dim><dim>5</dim><dim>5</dim></port></output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="16" group="1"/>
+            <input><port id="1"><dim>1</dim><dim>16</dim><dim>5</dim><dim>5</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>16</dim><dim>5</dim><dim>5</dim></port></output>
+            <weights offset="0" size="1024"/>
+            <biases offset="1024" size="64"/>
+        </layer>
+        <layer name="conv2" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="24" group="1"/>
+            <input><port id="3"><dim>1</dim><dim>16</dim><dim>5</dim><dim>5</dim></port></input>
+            <output><port id="4"><dim>1</dim><dim>24</dim><dim>5</dim><dim>5</dim></port></output>
+            <weights offset="1088" size="1536"/>
+            <biases offset="2624" size="96"/>
+        </layer>
+        <layer name="concat" type="Concat" precision="FP32" id="3">
+            <concat_data axis="1"/>
+            <input>
+                <port id="5"><dim>1</dim><dim>16</dim><dim>5</dim><dim>5</dim></port>
+                <port id="6"><dim>1</dim><dim>24</dim><dim>5</dim><dim>5</dim></port>
+            </input>
+            <output><port id="7"><dim>1</dim><dim>40</dim><dim>5</dim><dim>5</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="3"/>
+        <edge from-layer="1" from-port="2" to-layer="3" to-port="5"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="6"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    // conv1 copies the input channels, the output channel c of conv2 is the input channel c % 16
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {2720});
+    weights->allocate();
+    float *data = weights->buffer().as<float *>();
+    std::fill(data, data + weights->size() / sizeof(float), 0.f);
+    for (size_t c = 0; c < 16; c++)
+        data[c * 16 + c] = 1.f;
+    for (size_t c = 0; c < 24; c++)
+        data[272 + c * 16 + c % 16] = 1.f;
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    // the convolutions write to the channel blocks of the concat output, with nChw16c they are reordered to nChw8c
+    for (auto &node : graph.GetNodes()) {
+        if (node->getType() != MKLDNNPlugin::Concatenation)
+            continue;
+        auto config = node->getSelectedPrimitiveDescriptor()->getConfig();
+        ASSERT_LE(0, config.inConfs[0].inPlace);
+        for (auto &inConf : config.inConfs) {
+            auto format = MKLDNNPlugin::MKLDNNMemoryDesc(inConf.desc).getFormat();
+            ASSERT_TRUE(format == memory::nChw8c || format == memory::nChw16c);
+        }
+    }
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 16, 5, 5}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float>::Ptr dstRef = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    dstRef->allocate();
+    const float *src_data = src->buffer().as<const float *>();
+    float *ref_data = dstRef->buffer().as<float *>();
+    for (size_t c = 0; c < 40; c++) {
+        size_t src_c = c < 16 ? c : (c - 16) % 16;
+        for (size_t i = 0; i < 25; i++)
+            ref_data[c * 25 + i] = src_data[src_c * 25 + i];
+    }
+
+    compare(*output, *dstRef);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestElementwiseChainIsFusedToOneEltwiseNode) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data1" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></output>
+        </layer>
+        <layer name="data2" type="Input" precision="FP32" id="1">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="2">
+            <power_data power="2" scale="2" shift="1"/>
+            <input><port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="3">
+            <data coeff="1,-0.5" operation="sum"/>
+            <input>
+                <port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port>
+                <port id="2"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port>
+            </input>
+            <output><port id="3"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="4">
+            <input><port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></output>
+        </layer>
+        <layer name="prod" type="Eltwise" precision="FP32" id="5">
+            <data operation="mul"/>
+            <input>
+                <port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port>
+                <port id="2"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port>
+            </input>
+            <output><port id="3"><dim>1</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="1"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="2"/>
+        <edge from-layer="3" from-port="3" to-layer="4" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="5" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="5" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    // the power, the relu and the prod are computed by the kernel of the sum
+    size_t eltwiseNodes = 0;
+    for (auto &node : graph.GetNodes()) {
+        ASSERT_NE(MKLDNNPlugin::Power, node->getType());
+        ASSERT_NE(MKLDNNPlugin::Activation, node->getType());
+        if (node->getType() == MKLDNNPlugin::Eltwise) {
+            ASSERT_EQ(3, node->getParentEdges().size());
+            eltwiseNodes++;
+        }
+    }
+    ASSERT_EQ(1, eltwiseNodes);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 5}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src1 = InferenceEngine::make_shared_blob<float>(desc);
+    src1->allocate();
+    fill_data(src1->buffer(), src1->size());
+    InferenceEngine::Blob::Ptr src2 = InferenceEngine::make_shared_blob<float>(desc);
+    src2->allocate();
+    fill_data(src2->buffer(), src2->size());
+    float *src2_data = src2->buffer().as<float *>();
+    for (size_t i = 0; i < src2->size(); i++)
+        src2_data[i] *= (i % 2) ? 10.f : -10.f;
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data1", src1));
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data2", src2));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float>::Ptr dstRef = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    dstRef->allocate();
+    const float *src1_data = src1->buffer().as<const float *>();
+    float *ref_data = dstRef->buffer().as<float *>();
+    for (size_t i = 0; i < dstRef->size(); i++) {
+        float power = (2.f * src1_data[i] + 1.f) * (2.f * src1_data[i] + 1.f);
+        ref_data[i] = src1_data[i] * (std::max)(power - 0.5f * src2_data[i], 0.f);
+    }
+
+    compare(*output, *dstRef);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestTileIsFusedToBroadcastInputOfEltwise) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data1" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>2</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></output>
+        </layer>
+        <layer name="data2" type="Input" precision="FP32" id="1">
+            <output><port id="0"><dim>2</dim><dim>1</dim><dim>4</dim><dim>5</dim></port></output>
+        </layer>
+        <layer name="tile" type="Tile" precision="FP32" id="2">
+            <data axis="1" tiles="3"/>
+            <input><port id="1"><dim>2</dim><dim>1</dim><dim>4</dim><dim>5</dim></port></input>
+            <output><port id="2"><dim>2</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></output>
+        </layer>
+        <layer name="prod" type="Eltwise" precision="FP32" id="3">
+            <data operation="mul"/>
+            <input>
+                <port id="1"><dim>2</dim><dim>3</dim><dim>4</dim><dim>5</dim></port>
+                <port id="2"><dim>2</dim><dim>3</dim><dim>4</dim><dim>5</dim></port>
+            </input>
+            <output><port id="3"><dim>2</dim><dim>3</dim><dim>4</dim><dim>5</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    // the tiled tensor is not stored, the eltwise reads data2 for every tile
+    size_t eltwiseNodes = 0;
+    for (auto &node : graph.GetNodes()) {
+        ASSERT_NE(MKLDNNPlugin::Tile, node->getType());
+        if (node->getType() == MKLDNNPlugin::Eltwise)
+            eltwiseNodes++;
+    }
+    ASSERT_EQ(1, eltwiseNodes);
+
+    InferenceEngine::Blob::Ptr src1 = InferenceEngine::make_shared_blob<float>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {2, 3, 4, 5}, InferenceEngine::NCHW));
+    src1->allocate();
+    fill_data(src1->buffer(), src1->size());
+    InferenceEngine::Blob::Ptr src2 = InferenceEngine::make_shared_blob<float>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {2, 1, 4, 5}, InferenceEngine::NCHW));
+    src2->allocate();
+    fill_data(src2->buffer(), src2->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data1", src1));
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data2", src2));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float>::Ptr dstRef = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    dstRef->allocate();
+    const float *src1_data = src1->buffer().as<const float *>();
+    const float *src2_data = src2->buffer().as<const float *>();
+    float *ref_data = dstRef->buffer().as<float *>();
+    for (size_t n = 0; n < 2; n++) {
+        for (size_t c = 0; c < 3; c++) {
+            for (size_t i = 0; i < 4 * 5; i++) {
+                size_t idx = (n * 3 + c) * 4 * 5 + i;
+                ref_data[idx] = src1_data[idx] * src2_data[n * 4 * 5 + i];
+            }
+        }
+    }
+
+    compare(*output, *dstRef);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestSkippedOutputsAreNotComputed) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="main" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input><port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="aux" type="Power" precision="FP32" id="2">
+            <power_data power="1" scale="3" shift="0"/>
+            <input><port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::MKLDNNGraph::Ptr graph(new MKLDNNPlugin::MKLDNNGraph());
+    graph->CreateGraph(net_reader.getNetwork(), {});
+
+    // only the nodes of the auxiliary head are skipped
+    std::vector<MKLDNNPlugin::MKLDNNNodePtr> skippedOutputs;
+    for (auto &output : graph->GetOutputNodes()) {
+        if (output->getName() == "out_aux")
+            skippedOutputs.push_back(output);
+    }
+    ASSERT_EQ(1, skippedOutputs.size());
+    std::vector<bool> skippedNodes = graph->GetSkippedNodes(skippedOutputs);
+    ASSERT_EQ(graph->GetNodes().size(), skippedNodes.size());
+    for (size_t i = 0; i < graph->GetNodes().size(); i++) {
+        const std::string &name = graph->GetNodes()[i]->getName();
+        ASSERT_EQ(name == "aux" || name == "out_aux", skippedNodes[i]) << name;
+    }
+
+    // the sets of the outputs are cached by the graph
+    std::vector<bool> skippedMask(graph->GetOutputNodes().size(), false);
+    for (size_t i = 0; i < graph->GetOutputNodes().size(); i++)
+        skippedMask[i] = graph->GetOutputNodes()[i] == skippedOutputs[0];
+    const std::vector<bool> &cached = graph->GetCachedSkippedNodes(skippedMask);
+    ASSERT_EQ(skippedNodes, cached);
+    ASSERT_EQ(&cached, &graph->GetCachedSkippedNodes(skippedMask));
+
+    MKLDNNPlugin::MKLDNNInferRequest request(net_reader.getNetwork().getInputsInfo(),
+                                             net_reader.getNetwork().getOutputsInfo());
+    request.SetGraph(graph);
+    ASSERT_THROW(request.SetSkippedOutputs({"data"}), InferenceEngine::details::InferenceEngineException);
+
+    InferenceEngine::Blob::Ptr src, main, aux;
+    request.GetBlob("data", src);
+    request.GetBlob("main", main);
+    request.GetBlob("aux", aux);
+    float *src_data = src->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++)
+        src_data[i] = static_cast<float>(i);
+    request.Infer();
+
+    request.SetSkippedOutputs({"aux"});
+    for (size_t i = 0; i < src->size(); i++)
+        src_data[i] = static_cast<float>(100 + i);
+    request.Infer();
+
+    // the skipped output keeps the result of the first inference
+    const float *main_data = main->cbuffer().as<const float *>();
+    const float *aux_data = aux->cbuffer().as<const float *>();
+    for (size_t i = 0; i < src->size(); i++) {
+        ASSERT_FLOAT_EQ(2.f * (100 + i), main_data[i]);
+        ASSERT_FLOAT_EQ(3.f * i, aux_data[i]);
+    }
+
+    request.SetSkippedOutputs({});
+    request.Infer();
+    for (size_t i = 0; i < src->size(); i++)
+        ASSERT_FLOAT_EQ(3.f * (100 + i), aux_data[i]);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestLinearLayersAreFoldedIntoConvolutionAndFC) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="norm" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="0.5" shift="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="2" group="1"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+            <weights offset="0" size="16"/>
+        </layer>
+        <layer name="bn" type="BatchNormalization" precision="FP32" id="3">
+            <batch_norm_data epsilon="0.25"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+            <biases offset="16" size="8"/>
+            <weights offset="24" size="8"/>
+        </layer>
+        <layer name="scale" type="ScaleShift" precision="FP32" id="4">
+            <input>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+            <weights offset="32" size="8"/>
+            <biases offset="40" size="8"/>
+        </layer>
+        <layer name="fc" type="FullyConnected" precision="FP32" id="5">
+            <fc_data out-size="3"/>
+            <input>
+                <port id="9">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="10">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+            <weights offset="48" size="96"/>
+        </layer>
+        <layer name="fc_scale" type="ScaleShift" precision="FP32" id="6">
+            <input>
+                <port id="11">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="12">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+            <weights offset="144" size="12"/>
+            <biases offset="156" size="12"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>
+        <edge from-layer="4" from-port="8" to-layer="5" to-port="9"/>
+        <edge from-layer="5" from-port="10" to-layer="6" to-port="11"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {168});
+    weights->allocate();
+    float *w = weights->buffer().as<float *>();
+    const float convWeights[] = {1.0f, -1.0f, 0.5f, 2.0f};
+    const float means[] = {0.5f, -1.0f};
+    const float variances[] = {0.75f, 3.75f};
+    const float scales[] = {2.0f, -0.5f};
+    const float shifts[] = {1.0f, 0.25f};
+    const float fcScales[] = {0.5f, 2.0f, -1.0f};
+    const float fcShifts[] = {0.1f, -0.2f, 0.3f};
+    std::copy_n(convWeights, 4, w);
+    std::copy_n(means, 2, w + 4);
+    std::copy_n(variances, 2, w + 6);
+    std::copy_n(scales, 2, w + 8);
+    std::copy_n(shifts, 2, w + 10);
+    float *fcWeights = w + 12;
+    for (size_t i = 0; i < 24; i++)
+        fcWeights[i] = (static_cast<int>(i % 5) - 2) * 0.25f;
+    std::copy_n(fcScales, 3, w + 36);
+    std::copy_n(fcShifts, 3, w + 39);
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    for (auto &node : graph.getNodes()) {
+        ASSERT_NE(MKLDNNPlugin::Power, node->getType());
+        ASSERT_NE(MKLDNNPlugin::BatchNormalization, node->getType());
+        ASSERT_NE(MKLDNNPlugin::Depthwise, node->getType());
+    }
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 2, 2, 2}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    float *src_data = src->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++)
+        src_data[i] = (static_cast<int>(i % 7) - 3) * 0.5f;
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    // the reference of the unfolded layers, the pixels are in nchw order
+    float hidden[8];
+    for (size_t c = 0; c < 2; c++) {
+        for (size_t p = 0; p < 4; p++) {
+            float value = 0.0f;
+            for (size_t ic = 0; ic < 2; ic++)
+                value += convWeights[c * 2 + ic] * (src_data[ic * 4 + p] * 0.5f + 1.0f);
+            value = (value - means[c]) / std::sqrt(variances[c] + 0.25f);
+            hidden[c * 4 + p] = value * scales[c] + shifts[c];
+        }
+    }
+    const float *dst_data = output->buffer().as<const float *>();
+    for (size_t o = 0; o < 3; o++) {
+        float value = 0.0f;
+        for (size_t i = 0; i < 8; i++)
+            value += fcWeights[o * 8 + i] * hidden[i];
+        ASSERT_NEAR(value * fcScales[o] + fcShifts[o], dst_data[o], 1e-5f);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestReordersOfOneOutputAreShared) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="16" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="0" size="1024"/>
+        </layer>
+        <layer name="conv2" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="16" group="1"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="1024" size="1024"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {2048});
+    weights->allocate();
+    float *w = weights->buffer().as<float *>();
+    for (size_t i = 0; i < 512; i++)
+        w[i] = (static_cast<int>(i % 9) - 4) * 0.125f;
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    // both convolutions take the input in the same layout, so it is reordered once at most
+    size_t reorders = 0, inputReorders = 0;
+    for (auto &node : graph.getNodes()) {
+        if (node->getType() != MKLDNNPlugin::Reorder)
+            continue;
+        reorders++;
+        if (node->getParentEdgeAt(0)->getParent()->getType() == MKLDNNPlugin::Input)
+            inputReorders++;
+    }
+    ASSERT_GE(1, inputReorders);
+
+    size_t reorderCount = 0, reorderBytes = 0;
+    graph.GetReorderStatistics(reorderCount, reorderBytes);
+    ASSERT_EQ(reorders, reorderCount);
+    ASSERT_EQ(reorders == 0, reorderBytes == 0);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 16, 4, 4}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    float *src_data = src->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++)
+        src_data[i] = (static_cast<int>(i % 7) - 3) * 0.5f;
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::BlobMap outputBlobs;
+    for (auto &item : out) {
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+    }
+
+    graph.Infer(srcs, outputBlobs);
+
+    const float *convWeights[] = {w, w + 256};
+    const char *names[] = {"conv1", "conv2"};
+    for (size_t n = 0; n < 2; n++) {
+        const float *dst_data = outputBlobs[names[n]]->buffer().as<const float *>();
+        for (size_t oc = 0; oc < 16; oc++) {
+            for (size_t p = 0; p < 16; p++) {
+                float value = 0.0f;
+                for (size_t ic = 0; ic < 16; ic++)
+                    value += convWeights[n][oc * 16 + ic] * src_data[ic * 16 + p];
+                ASSERT_NEAR(value, dst_data[oc * 16 + p], 1e-4f);
+            }
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestCancelledInferenceIsStopped) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input><port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="power2" type="Power" precision="FP32" id="2">
+            <power_data power="1" scale="3" shift="0"/>
+            <input><port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></input>
+            <output><port id="2"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::MKLDNNGraph::Ptr graph(new MKLDNNPlugin::MKLDNNGraph());
+    graph->CreateGraph(net_reader.getNetwork(), {});
+
+    InferenceEngine::InferCancellation cancellation;
+    cancellation.start();
+    ASSERT_NO_THROW(graph->Infer(-1, nullptr, &cancellation));
+
+    cancellation.cancel();
+    try {
+        graph->Infer(-1, nullptr, &cancellation);
+        FAIL() << "the cancelled inference is not stopped";
+    } catch (const InferenceEngine::details::InferenceEngineException &iex) {
+        ASSERT_EQ(InferenceEngine::INFER_CANCELLED, iex.getStatus());
+    }
+
+    // the next inference drops the cancellation
+    cancellation.start();
+    ASSERT_NO_THROW(graph->Infer(-1, nullptr, &cancellation));
+
+    // the request stops the inference which has missed its deadline
+    MKLDNNPlugin::MKLDNNInferRequest request(net_reader.getNetwork().getInputsInfo(),
+                                             net_reader.getNetwork().getOutputsInfo());
+    request.SetGraph(graph);
+    ASSERT_THROW(request.SetDeadline(-1), InferenceEngine::details::InferenceEngineException);
+    request.SetDeadline(1);
+    request.getCancellation().start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_THROW(request.Infer(), InferenceEngine::details::InferenceEngineException);
+    request.SetDeadline(0);
+    request.getCancellation().start();
+    ASSERT_NO_THROW(request.Infer());
+}
@@ -10,6 +10,7 @@
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
 #include <mkldnn_plugin/mkldnn_graph_optimizer.h>
 #include <mkldnn_plugin/nodes/mkldnn_input_node.h>
+#include <ie_util_internal.hpp>
 #include <functional>
 
 #define GARB_VAL(x) ((x + 100.0f + sin(x)) / (x + 150.f))
@@ -146,6 +147,15 @@ public:
         CreateGraph(network, extMgr);
     }
 
+    /**
+     * @brief Creates the graph as MKLDNNExecNetwork does, from the copy of the network with the rewritten layers
+     */
+    void CreateRewrittenGraph(InferenceEngine::ICNNNetwork &network) {
+        rewrittenNetwork = InferenceEngine::cloneNet(network);
+        MKLDNNPlugin::MKLDNNGraphOptimizer::RewriteNetwork(*rewrittenNetwork);
+        CreateGraph(*rewrittenNetwork);
+    }
+
     void checkDynBatch(InferenceEngine::BlobMap& srcs, InferenceEngine::BlobMap& outputBlobs, int batch, size_t MB,
                        const std::function<bool (const MKLDNNPlugin::MKLDNNNodePtr&)>& comp, CheckDynBatchType type = CheckDynBatchType::Both) {
         for (auto &node : getNodes()) {
@@ -207,4 +217,7 @@ public:
             }
         }
     }
+
+private:
+    InferenceEngine::details::CNNNetworkImplPtr rewrittenNetwork;
 };
@@ -0,0 +1,51 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include "mkldnn_plugin/mkldnn_huge_pages.h"
+#include "mkldnn_plugin/mkldnn_memory.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+class MKLDNNHugePagesTests : public ::testing::Test {};
+
+// the huge pages may be unavailable on the test machine, the memory is checked only if it is allocated
+TEST_F(MKLDNNHugePagesTests, memoryIsZeroedAndAligned) {
+    for (size_t size : {100, 3 * 1024 * 1024}) {
+        std::shared_ptr<void> data = MKLDNNHugePages::allocate(size, MKLDNNHugePages::size2MB);
+        if (!data)
+            continue;
+        auto *bytes = static_cast<uint8_t *>(data.get());
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(bytes) % 64);
+        for (size_t i = 0; i < size; i++)
+            ASSERT_EQ(0, bytes[i]) << "i = " << i;
+        bytes[size - 1] = 1;
+    }
+}
+
+TEST_F(MKLDNNHugePagesTests, smallAllocationsShareChunk) {
+    std::shared_ptr<void> first = MKLDNNHugePages::allocate(100, MKLDNNHugePages::size2MB);
+    std::shared_ptr<void> second = MKLDNNHugePages::allocate(100, MKLDNNHugePages::size2MB);
+    if (!first || !second)
+        return;
+    ASSERT_EQ(static_cast<uint8_t *>(first.get()) + 128, static_cast<uint8_t *>(second.get()));
+}
+
+TEST_F(MKLDNNHugePagesTests, unsupportedPageSizeIsNotAllocated) {
+    ASSERT_EQ(nullptr, MKLDNNHugePages::allocate(100, 4096));
+}
+
+TEST_F(MKLDNNHugePagesTests, memoryOnHugePagesIsZeroed) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNMemory memory(eng);
+    memory.CreateOnHugePages({1000}, mkldnn::memory::f32, mkldnn::memory::x, MKLDNNHugePages::size2MB);
+
+    auto *data = static_cast<float *>(memory.GetData());
+    for (size_t i = 0; i < 1000; i++)
+        ASSERT_EQ(0.f, data[i]) << "i = " << i;
+}
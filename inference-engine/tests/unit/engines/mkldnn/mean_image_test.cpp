@@ -0,0 +1,86 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <tuple>
+#include <vector>
+#include "mkldnn_plugin/mean_image.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+// the format, the dims of the input and the use of the mean image instead of the mean values
+using MeanImageParams = std::tuple<mkldnn::memory::format, SizeVector, bool>;
+
+class MKLDNNMeanImageTests : public ::testing::TestWithParam<MeanImageParams> {};
+
+TEST_P(MKLDNNMeanImageTests, subtractMatchesReference) {
+    const mkldnn::memory::format format = std::get<0>(GetParam());
+    const SizeVector dims = std::get<1>(GetParam());
+    const bool withImage = std::get<2>(GetParam());
+    const size_t MB = dims[0], C = dims[1], H = dims[2], W = dims[3];
+    const size_t blockSize = format == mkldnn::memory::nChw8c ? 8 : format == mkldnn::memory::nChw16c ? 16 : 1;
+    const size_t paddedC = (C + blockSize - 1) / blockSize * blockSize;
+
+    InputInfo::Ptr info(new InputInfo());
+    PreProcessInfo &pp = info->getPreProcess();
+    pp.init(C);
+    std::vector<float> means(C * H * W);
+    for (size_t i = 0; i < means.size(); i++)
+        means[i] = static_cast<float>(i % 11) * 0.5f;
+    if (withImage) {
+        for (size_t c = 0; c < C; c++) {
+            Blob::Ptr meanData = make_shared_blob<float>(TensorDesc(Precision::FP32, {H, W}, Layout::HW));
+            meanData->allocate();
+            std::copy_n(means.data() + c * H * W, H * W, meanData->buffer().as<float *>());
+            pp.setMeanImageForChannel(meanData, c);
+        }
+        pp.setVariant(MEAN_IMAGE);
+    } else {
+        for (size_t c = 0; c < C; c++)
+            pp[c]->meanValue = means[c];
+        pp.setVariant(MEAN_VALUE);
+    }
+
+    MKLDNNDims inputDims(dims);
+    MeanImage mean;
+    mean.Load(inputDims, info);
+    mean.setFormat(format);
+
+    // the offset of the element in the memory of the format
+    auto offset = [&](size_t n, size_t c, size_t h, size_t w) {
+        if (format == mkldnn::memory::nhwc)
+            return ((n * H + h) * W + w) * C + c;
+        return (((n * (paddedC / blockSize) + c / blockSize) * H + h) * W + w) * blockSize + c % blockSize;
+    };
+
+    std::vector<float> data(MB * paddedC * H * W);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<float>(i % 23);
+    std::vector<float> ref(data);
+
+    mean.Subtract(inputDims, data.data());
+
+    for (size_t n = 0; n < MB; n++) {
+        for (size_t c = 0; c < C; c++) {
+            for (size_t h = 0; h < H; h++) {
+                for (size_t w = 0; w < W; w++) {
+                    size_t i = offset(n, c, h, w);
+                    float m = withImage ? means[(c * H + h) * W + w] : means[c];
+                    ASSERT_FLOAT_EQ(ref[i] - m, data[i]) << "n = " << n << " c = " << c << " h = " << h << " w = " << w;
+                }
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsMeanImage, MKLDNNMeanImageTests,
+        ::testing::Combine(
+                ::testing::Values(mkldnn::memory::nchw, mkldnn::memory::nhwc, mkldnn::memory::nChw8c,
+                                  mkldnn::memory::nChw16c),
+                ::testing::Values(SizeVector{1, 3, 5, 7}, SizeVector{2, 20, 9, 67}),
+                ::testing::Bool()));
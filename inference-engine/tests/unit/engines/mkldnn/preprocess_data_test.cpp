@@ -0,0 +1,253 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include <details/ie_exception.hpp>
+#include "mkldnn_plugin/mkldnn_preprocess_data.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+class MKLDNNPreProcessDataTests : public ::testing::Test {
+protected:
+    Blob::Ptr createU8(const SizeVector &dims, Layout layout, const std::vector<uint8_t> &data) {
+        auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, dims, layout));
+        blob->allocate();
+        std::copy(data.begin(), data.end(), blob->buffer().as<uint8_t *>());
+        return blob;
+    }
+
+    Blob::Ptr createNetworkInput(const SizeVector &dims) {
+        auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, dims, NCHW));
+        blob->allocate();
+        return blob;
+    }
+
+    Blob::Ptr execute(const Blob::Ptr &roi, const SizeVector &dims, const PreProcessInfo &info) {
+        MKLDNNPreProcessData preProcess;
+        preProcess.setRoiBlob(roi);
+        Blob::Ptr out = createNetworkInput(dims);
+        preProcess.execute(out, info);
+        return preProcess.getFusedBlob();
+    }
+};
+
+TEST_F(MKLDNNPreProcessDataTests, convertsInterleavedRGBToPlanarBGR) {
+    // 1x2 image: the pixels (R, G, B) = (10, 20, 30) and (40, 50, 60)
+    auto roi = createU8({1, 3, 1, 2}, NHWC, {10, 20, 30, 40, 50, 60});
+    PreProcessInfo info;
+    info.setColorFormat(RGB);
+
+    Blob::Ptr fused = execute(roi, {1, 3, 1, 2}, info);
+    ASSERT_NE(nullptr, fused);
+    ASSERT_EQ(Precision::FP32, fused->precision());
+    std::vector<float> ref = {30, 60, 20, 50, 10, 40};
+    const float *data = fused->cbuffer().as<const float *>();
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_FLOAT_EQ(ref[i], data[i]) << "i = " << i;
+}
+
+TEST_F(MKLDNNPreProcessDataTests, resizesInterleavedBGRAndSubtractsMeanValues) {
+    // every row of the 4x4 image is constant, so the bilinear downscale keeps the average of each pair of rows
+    std::vector<uint8_t> image;
+    for (int y = 0; y < 4; y++)
+        for (int x = 0; x < 4; x++)
+            image.insert(image.end(), {static_cast<uint8_t>(y * 10), 100, 200});
+    auto roi = createU8({1, 3, 4, 4}, NHWC, image);
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    info.setColorFormat(BGR);
+    info.init(3);
+    info[0]->meanValue = 1.f;
+    info[1]->meanValue = 2.f;
+    info[2]->meanValue = 3.f;
+    info.setVariant(MEAN_VALUE);
+
+    Blob::Ptr fused = execute(roi, {1, 3, 2, 2}, info);
+    ASSERT_NE(nullptr, fused);
+    std::vector<float> ref = {4, 4, 24, 24, 98, 98, 98, 98, 197, 197, 197, 197};
+    const float *data = fused->cbuffer().as<const float *>();
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_FLOAT_EQ(ref[i], data[i]) << "i = " << i;
+}
+
+TEST_F(MKLDNNPreProcessDataTests, convertsNV12ToBGR) {
+    // 2x2 frame of the uniform color: Y = 81, U = 90, V = 240 is the pure red of BT.601
+    auto roi = createU8({1, 1, 3, 2}, NCHW, {81, 81, 81, 81, 90, 240});
+    PreProcessInfo info;
+    info.setColorFormat(NV12);
+
+    Blob::Ptr fused = execute(roi, {1, 3, 2, 2}, info);
+    ASSERT_NE(nullptr, fused);
+    const float *data = fused->cbuffer().as<const float *>();
+    for (int i = 0; i < 4; i++) {
+        ASSERT_NEAR(0.f, data[0 * 4 + i], 1.f);
+        ASSERT_NEAR(0.f, data[1 * 4 + i], 1.f);
+        ASSERT_NEAR(255.f, data[2 * 4 + i], 1.f);
+    }
+}
+
+TEST_F(MKLDNNPreProcessDataTests, throwsForNV12OfOddHeight) {
+    auto roi = createU8({1, 1, 4, 2}, NCHW, std::vector<uint8_t>(8, 0));
+    PreProcessInfo info;
+    info.setColorFormat(NV12);
+    MKLDNNPreProcessData preProcess;
+    preProcess.setRoiBlob(roi);
+    Blob::Ptr out = createNetworkInput({1, 3, 2, 2});
+    ASSERT_THROW(preProcess.execute(out, info), details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNPreProcessDataTests, throwsForSizeMismatchWithoutResize) {
+    auto roi = createU8({1, 3, 2, 2}, NHWC, std::vector<uint8_t>(12, 0));
+    PreProcessInfo info;
+    info.setColorFormat(BGR);
+    MKLDNNPreProcessData preProcess;
+    preProcess.setRoiBlob(roi);
+    Blob::Ptr out = createNetworkInput({1, 3, 1, 1});
+    ASSERT_THROW(preProcess.execute(out, info), details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNPreProcessDataTests, planarRawInputIsResizedToOutputBlob) {
+    auto roi = createU8({1, 1, 2, 2}, NCHW, {10, 10, 10, 10});
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    MKLDNNPreProcessData preProcess;
+    preProcess.setRoiBlob(roi);
+    Blob::Ptr out = createNetworkInput({1, 1, 1, 1});
+    preProcess.execute(out, info);
+
+    ASSERT_EQ(nullptr, preProcess.getFusedBlob());
+    ASSERT_EQ(10, out->cbuffer().as<const uint8_t *>()[0]);
+}
+
+TEST_F(MKLDNNPreProcessDataTests, batchedRoisAreResizedToTheirBatchSlots) {
+    auto roi0 = createU8({1, 1, 2, 2}, NCHW, {10, 10, 10, 10});
+    auto roi1 = createU8({1, 1, 4, 4}, NCHW, std::vector<uint8_t>(16, 20));
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    MKLDNNPreProcessData preProcess;
+    preProcess.setRoiBlobs({roi0, roi1});
+    Blob::Ptr out = createNetworkInput({3, 1, 1, 1});
+    out->buffer().as<uint8_t *>()[2] = 7;
+    preProcess.execute(out, info);
+
+    ASSERT_EQ(nullptr, preProcess.getFusedBlob());
+    const uint8_t *data = out->cbuffer().as<const uint8_t *>();
+    ASSERT_EQ(10, data[0]);
+    ASSERT_EQ(20, data[1]);
+    // the slot without the ROI keeps its data
+    ASSERT_EQ(7, data[2]);
+}
+
+TEST_F(MKLDNNPreProcessDataTests, batchedRoisAreConvertedToTheirBatchSlotsOfFusedBlob) {
+    auto roi0 = createU8({1, 3, 1, 1}, NHWC, {1, 2, 3});
+    auto roi1 = createU8({1, 3, 1, 2}, NHWC, {4, 5, 6, 4, 5, 6});
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    info.setColorFormat(RGB);
+    MKLDNNPreProcessData preProcess;
+    preProcess.setRoiBlobs({roi0, roi1});
+    Blob::Ptr out = createNetworkInput({2, 3, 1, 1});
+    preProcess.execute(out, info);
+
+    Blob::Ptr fused = preProcess.getFusedBlob();
+    ASSERT_NE(nullptr, fused);
+    std::vector<float> ref = {3, 2, 1, 6, 5, 4};
+    const float *data = fused->cbuffer().as<const float *>();
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_FLOAT_EQ(ref[i], data[i]) << "i = " << i;
+}
+
+TEST_F(MKLDNNPreProcessDataTests, throwsForMoreRoisThanBatch) {
+    auto roi = createU8({1, 1, 2, 2}, NCHW, std::vector<uint8_t>(4, 0));
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    MKLDNNPreProcessData preProcess;
+    preProcess.setRoiBlobs({roi, roi, roi});
+    Blob::Ptr out = createNetworkInput({2, 1, 1, 1});
+    ASSERT_THROW(preProcess.execute(out, info), details::InferenceEngineException);
+}
+
+struct ResizeCase {
+    Precision precision;
+    ResizeAlgorithm algorithm;
+    SizeVector srcDims;
+    SizeVector dstDims;
+};
+
+class MKLDNNPreProcessDataResizeTests : public ::testing::TestWithParam<ResizeCase> {
+protected:
+    static Blob::Ptr createImage(Precision precision, const SizeVector &dims, int seed) {
+        Blob::Ptr blob;
+        if (precision == Precision::FP32)
+            blob = make_shared_blob<float>(TensorDesc(precision, dims, NCHW));
+        else
+            blob = make_shared_blob<uint8_t>(TensorDesc(precision, dims, NCHW));
+        blob->allocate();
+        for (size_t i = 0; i < blob->size(); i++) {
+            int value = static_cast<int>((i * 37 + seed * 11) % 251);
+            if (precision == Precision::FP32)
+                blob->buffer().as<float *>()[i] = static_cast<float>(value);
+            else
+                blob->buffer().as<uint8_t *>()[i] = static_cast<uint8_t>(value);
+        }
+        return blob;
+    }
+
+    static void execute(MKLDNNPreProcessData &preProcess, const Blob::Ptr &roi, Blob::Ptr &out,
+                        ResizeAlgorithm algorithm) {
+        PreProcessInfo info;
+        info.setResizeAlgorithm(algorithm);
+        preProcess.setRoiBlob(roi);
+        preProcess.execute(out, info);
+    }
+
+    static void compare(const Blob::Ptr &ref, const Blob::Ptr &out) {
+        ASSERT_EQ(ref->byteSize(), out->byteSize());
+        const uint8_t *refData = ref->cbuffer().as<const uint8_t *>();
+        const uint8_t *outData = out->cbuffer().as<const uint8_t *>();
+        for (size_t i = 0; i < ref->byteSize(); i++)
+            ASSERT_EQ(refData[i], outData[i]) << "byte " << i;
+    }
+};
+
+TEST_P(MKLDNNPreProcessDataResizeTests, cachedTablesGiveSameResultAsComputedOnes) {
+    const ResizeCase param = GetParam();
+    MKLDNNPreProcessData cached;
+
+    Blob::Ptr out = createImage(param.precision, param.dstDims, 0);
+    execute(cached, createImage(param.precision, param.srcDims, 1), out, param.algorithm);
+
+    // the second frame of the same shapes reuses the tables of the first one
+    Blob::Ptr roi = createImage(param.precision, param.srcDims, 2);
+    execute(cached, roi, out, param.algorithm);
+    MKLDNNPreProcessData fresh;
+    Blob::Ptr ref = createImage(param.precision, param.dstDims, 0);
+    execute(fresh, roi, ref, param.algorithm);
+    compare(ref, out);
+
+    // the frame of another shape computes the tables again
+    SizeVector otherDims = param.srcDims;
+    otherDims[2] += 3;
+    otherDims[3] += 5;
+    roi = createImage(param.precision, otherDims, 3);
+    execute(cached, roi, out, param.algorithm);
+    MKLDNNPreProcessData otherFresh;
+    execute(otherFresh, roi, ref, param.algorithm);
+    compare(ref, out);
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsResizeTables, MKLDNNPreProcessDataResizeTests,
+        ::testing::Values(
+                ResizeCase{Precision::U8, RESIZE_BILINEAR, {1, 3, 40, 56}, {1, 3, 17, 23}},
+                ResizeCase{Precision::FP32, RESIZE_BILINEAR, {1, 3, 40, 56}, {1, 3, 17, 23}},
+                ResizeCase{Precision::U8, RESIZE_AREA, {1, 3, 40, 56}, {1, 3, 17, 23}},
+                ResizeCase{Precision::FP32, RESIZE_AREA, {1, 3, 40, 56}, {1, 3, 17, 23}},
+                ResizeCase{Precision::U8, RESIZE_AREA, {1, 3, 10, 12}, {1, 3, 17, 23}},
+                ResizeCase{Precision::FP32, RESIZE_AREA, {1, 3, 10, 12}, {1, 3, 17, 23}}));
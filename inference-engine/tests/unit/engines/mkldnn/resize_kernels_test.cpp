@@ -0,0 +1,61 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include "mkldnn_plugin/mkldnn_resize_kernels.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+class MKLDNNResizeKernelsTests : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(MKLDNNResizeKernelsTests, lerpMatchesReference) {
+    const size_t width = GetParam();
+    std::vector<float> src0(width), src1(width), dst(width);
+    for (size_t x = 0; x < width; x++) {
+        src0[x] = static_cast<float>(x % 17);
+        src1[x] = static_cast<float>(x % 5) - 2.0f;
+    }
+
+    MKLDNNResizeKernels::get().lerp(src0.data(), src1.data(), 0.25f, dst.data(), width);
+
+    for (size_t x = 0; x < width; x++)
+        ASSERT_NEAR(src0[x] + 0.25f * (src1[x] - src0[x]), dst[x], 1e-5f) << "x = " << x;
+}
+
+TEST_P(MKLDNNResizeKernelsTests, accumulateMatchesReference) {
+    const size_t width = GetParam();
+    std::vector<float> src(width), acc(width, 1.0f);
+    for (size_t x = 0; x < width; x++)
+        src[x] = static_cast<float>(x % 13);
+
+    MKLDNNResizeKernels::get().accumulate(src.data(), 0.5f, acc.data(), width);
+
+    for (size_t x = 0; x < width; x++)
+        ASSERT_NEAR(1.0f + 0.5f * src[x], acc[x], 1e-5f) << "x = " << x;
+}
+
+TEST_P(MKLDNNResizeKernelsTests, accumulateQ16MatchesReference) {
+    const size_t width = GetParam();
+    const uint16_t beta = 40000;
+    std::vector<uint8_t> src(width);
+    std::vector<uint16_t> acc(width, 3);
+    for (size_t x = 0; x < width; x++)
+        src[x] = static_cast<uint8_t>(x * 7);
+
+    MKLDNNResizeKernels::get().accumulateQ16(src.data(), beta, acc.data(), width);
+
+    for (size_t x = 0; x < width; x++) {
+        uint16_t ref = static_cast<uint16_t>(3 + ((static_cast<uint32_t>(beta) * (src[x] << 8)) >> 16));
+        ASSERT_EQ(ref, acc[x]) << "x = " << x;
+    }
+}
+
+// the widths cover the rows shorter than a vector and the tails after the vectors of all ISAs
+INSTANTIATE_TEST_CASE_P(
+        TestsResizeKernels, MKLDNNResizeKernelsTests,
+        ::testing::Values(1, 7, 16, 33, 64, 300, 1919));
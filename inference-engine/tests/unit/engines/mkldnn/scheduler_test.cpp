@@ -0,0 +1,236 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <inference_engine.hpp>
+#include <xml_net_builder.hpp>
+#include "mkldnn_plugin/mkldnn_plugin.h"
+#include "mkldnn_plugin/mkldnn_scheduler.h"
+
+using namespace InferenceEngine;
+
+namespace {
+const size_t kChannels = 3, kHeight = 4, kWidth = 5;
+}  // namespace
+
+class MKLDNNSchedulerTests : public ::testing::Test {
+protected:
+    // the task of the executor which keeps the single group busy until the gate is opened
+    void block(const ::MKLDNNPlugin::MKLDNNScheduler::Executor::Ptr &executor) {
+        std::promise<void> started;
+        gateTask = std::make_shared<Task>([this, &started]() {
+            started.set_value();
+            gate.get_future().wait();
+        });
+        ASSERT_TRUE(executor->startTask(gateTask));
+        started.get_future().wait();
+    }
+
+    void open() {
+        gate.set_value();
+        gateTask->wait(IInferRequest::WaitMode::RESULT_READY);
+    }
+
+    // the task records the name of its network to the order of the tasks run
+    Task::Ptr record(const std::string &name) {
+        return std::make_shared<Task>([this, name]() {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(name);
+        });
+    }
+
+    static void waitAll(const std::vector<Task::Ptr> &tasks) {
+        for (auto &task : tasks)
+            ASSERT_EQ(Task::TS_DONE, task->wait(IInferRequest::WaitMode::RESULT_READY));
+    }
+
+    std::promise<void> gate;
+    Task::Ptr gateTask;
+    std::mutex orderMutex;
+    std::vector<std::string> order;
+};
+
+TEST_F(MKLDNNSchedulerTests, higherPriorityIsRunFirst) {
+    auto scheduler = std::make_shared<::MKLDNNPlugin::MKLDNNScheduler>(1, false);
+    auto low = scheduler->createExecutor(0, 1);
+    auto high = scheduler->createExecutor(1, 1);
+    block(low);
+
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 3; i++) {
+        tasks.push_back(record("low"));
+        ASSERT_TRUE(low->startTask(tasks.back()));
+    }
+    for (int i = 0; i < 3; i++) {
+        tasks.push_back(record("high"));
+        ASSERT_TRUE(high->startTask(tasks.back()));
+    }
+    open();
+    waitAll(tasks);
+
+    ASSERT_EQ(std::vector<std::string>({"high", "high", "high", "low", "low", "low"}), order);
+}
+
+TEST_F(MKLDNNSchedulerTests, groupsAreSharedByWeights) {
+    auto scheduler = std::make_shared<::MKLDNNPlugin::MKLDNNScheduler>(1, false);
+    auto light = scheduler->createExecutor(0, 1);
+    auto heavy = scheduler->createExecutor(0, 3);
+    auto blocker = scheduler->createExecutor(0, 1);
+    block(blocker);
+
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 8; i++) {
+        tasks.push_back(record("light"));
+        ASSERT_TRUE(light->startTask(tasks.back()));
+        tasks.push_back(record("heavy"));
+        ASSERT_TRUE(heavy->startTask(tasks.back()));
+    }
+    open();
+    waitAll(tasks);
+
+    // the heavy network gets three tasks for each task of the light one while both of them have the tasks to run
+    ASSERT_EQ(6, std::count(order.begin(), order.begin() + 8, "heavy"));
+}
+
+TEST_F(MKLDNNSchedulerTests, tasksOfNetworkWithoutContextsAreNotRunConcurrently) {
+    auto scheduler = std::make_shared<::MKLDNNPlugin::MKLDNNScheduler>(2, false);
+    auto executor = scheduler->createExecutor(0, 1);
+
+    std::atomic<int> running(0), maxRunning(0);
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 8; i++) {
+        tasks.push_back(std::make_shared<Task>([&]() {
+            int current = ++running;
+            for (int seen = maxRunning; seen < current && !maxRunning.compare_exchange_weak(seen, current);) {}
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            running--;
+        }));
+        ASSERT_TRUE(executor->startTask(tasks.back()));
+    }
+    waitAll(tasks);
+
+    ASSERT_EQ(1, maxRunning);
+}
+
+TEST_F(MKLDNNSchedulerTests, tasksAreRunWithContexts) {
+    auto scheduler = std::make_shared<::MKLDNNPlugin::MKLDNNScheduler>(2, false);
+    auto executor = scheduler->createExecutor(0, 1);
+    std::vector<::MKLDNNPlugin::MultiWorkerTaskContext> contexts(2);
+    for (auto &context : contexts)
+        context.ptrGraph = std::make_shared<::MKLDNNPlugin::MKLDNNGraph>();
+    executor->setContexts(contexts);
+
+    std::mutex graphsMutex;
+    std::vector<::MKLDNNPlugin::MKLDNNGraph *> busyGraphs;
+    std::atomic<int> failures(0);
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 8; i++) {
+        tasks.push_back(std::make_shared<Task>([&]() {
+            auto graph = ::MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph.get();
+            {
+                std::lock_guard<std::mutex> lock(graphsMutex);
+                // the graph of the context is never given to two tasks at the same time
+                if (graph == nullptr || std::count(busyGraphs.begin(), busyGraphs.end(), graph) != 0)
+                    failures++;
+                busyGraphs.push_back(graph);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            std::lock_guard<std::mutex> lock(graphsMutex);
+            busyGraphs.erase(std::find(busyGraphs.begin(), busyGraphs.end(), graph));
+        }));
+        ASSERT_TRUE(executor->startTask(tasks.back()));
+    }
+    waitAll(tasks);
+
+    ASSERT_EQ(0, failures);
+}
+
+TEST_F(MKLDNNSchedulerTests, wrongSchedulerThrows) {
+    ASSERT_THROW(std::make_shared<::MKLDNNPlugin::MKLDNNScheduler>(0, false), details::InferenceEngineException);
+    auto scheduler = std::make_shared<::MKLDNNPlugin::MKLDNNScheduler>(1, false);
+    ASSERT_THROW(scheduler->createExecutor(0, 0), details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNSchedulerTests, instanceWithOtherGroupsThrows) {
+    auto scheduler = ::MKLDNNPlugin::MKLDNNScheduler::getInstance(2, false);
+    ASSERT_EQ(scheduler, ::MKLDNNPlugin::MKLDNNScheduler::getInstance(2, false));
+    ASSERT_THROW(::MKLDNNPlugin::MKLDNNScheduler::getInstance(3, false), details::InferenceEngineException);
+    ASSERT_THROW(::MKLDNNPlugin::MKLDNNScheduler::getInstance(2, true), details::InferenceEngineException);
+
+    scheduler.reset();
+    ASSERT_EQ(3, ::MKLDNNPlugin::MKLDNNScheduler::getInstance(3, false)->getGroupsNumber());
+}
+
+class MKLDNNSchedulerNetworkTests : public ::testing::Test {
+protected:
+    // the network computes 2 * x + 1
+    ExecutableNetwork load(const std::map<std::string, std::string> &config) {
+        std::map<std::string, std::string> params = {{"power", "1"}, {"scale", "2"}, {"shift", "1"}};
+        const SizeVector dims = {1, kChannels, kHeight, kWidth};
+        std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Power", dims, "FP32")
+                .addLayer("Power", "FP32", &params, {{dims}, {dims}})
+                .finish(false);
+        CNNNetReader reader;
+        reader.ReadNetwork(model.data(), model.length());
+
+        IExecutableNetwork::Ptr network;
+        engine->LoadNetwork(network, reader.getNetwork(), config);
+        return ExecutableNetwork(network);
+    }
+
+    static void fill(InferRequest &request, const std::string &input, float base) {
+        float *data = request.GetBlob(input)->buffer().as<float *>();
+        for (size_t i = 0; i < kChannels * kHeight * kWidth; i++)
+            data[i] = base + static_cast<float>(i);
+    }
+
+    static void check(InferRequest &request, const std::string &output, float base) {
+        const float *data = request.GetBlob(output)->cbuffer().as<const float *>();
+        for (size_t i = 0; i < kChannels * kHeight * kWidth; i++)
+            ASSERT_FLOAT_EQ(2.0f * (base + static_cast<float>(i)) + 1.0f, data[i]) << "at " << i;
+    }
+
+    std::shared_ptr<::MKLDNNPlugin::Engine> engine = std::make_shared<::MKLDNNPlugin::Engine>();
+};
+
+TEST_F(MKLDNNSchedulerNetworkTests, networksSharingSchedulerAreInferred) {
+    std::vector<ExecutableNetwork> networks;
+    networks.push_back(load({{PluginConfigParams::KEY_CPU_SCHEDULER_GROUPS, "2"},
+                             {PluginConfigParams::KEY_CPU_SCHEDULER_PRIORITY, "1"}}));
+    networks.push_back(load({{PluginConfigParams::KEY_CPU_SCHEDULER_GROUPS, "2"},
+                             {PluginConfigParams::KEY_CPU_SCHEDULER_WEIGHT, "2"},
+                             {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}}));
+
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < 8; i++) {
+        ExecutableNetwork &network = networks[i % networks.size()];
+        requests.push_back(network.CreateInferRequest());
+        fill(requests.back(), network.GetInputsInfo().begin()->first, 100.0f * i);
+    }
+    for (int iteration = 0; iteration < 3; iteration++) {
+        for (auto &request : requests)
+            request.StartAsync();
+        for (size_t i = 0; i < requests.size(); i++) {
+            ASSERT_EQ(OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+            check(requests[i], networks[i % networks.size()].GetOutputsInfo().begin()->first, 100.0f * i);
+        }
+    }
+}
+
+TEST_F(MKLDNNSchedulerNetworkTests, schedulerWithThreadsOfNetworkThrows) {
+    ASSERT_THROW(load({{PluginConfigParams::KEY_CPU_SCHEDULER_GROUPS, "2"},
+                       {PluginConfigParams::KEY_CPU_THREADS_NUM, "2"}}), details::InferenceEngineException);
+    ASSERT_THROW(load({{PluginConfigParams::KEY_CPU_SCHEDULER_GROUPS, "2"},
+                       {PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, PluginConfigParams::YES}}),
+                 details::InferenceEngineException);
+}
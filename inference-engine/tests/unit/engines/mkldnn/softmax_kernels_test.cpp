@@ -0,0 +1,76 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+#include "mkldnn_plugin/mkldnn_softmax_kernels.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+// the outer, the channels and the inner dimensions of the tensor
+using SoftMaxKernelsParams = std::tuple<size_t, size_t, size_t>;
+
+class MKLDNNSoftMaxKernelsTests : public ::testing::TestWithParam<SoftMaxKernelsParams> {};
+
+TEST_P(MKLDNNSoftMaxKernelsTests, executeMatchesReference) {
+    const size_t outer = std::get<0>(GetParam());
+    const size_t channels = std::get<1>(GetParam());
+    const size_t inner = std::get<2>(GetParam());
+    std::vector<float> src(outer * channels * inner), dst(src.size());
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 37) * 0.75f - 10.0f;
+
+    MKLDNNSoftMaxKernels::get().execute(src.data(), dst.data(), outer, channels, inner);
+
+    for (size_t o = 0; o < outer; o++) {
+        for (size_t i = 0; i < inner; i++) {
+            const float *s = &src[o * channels * inner + i];
+            const float *d = &dst[o * channels * inner + i];
+            float max = s[0];
+            for (size_t c = 1; c < channels; c++)
+                max = std::max(max, s[c * inner]);
+            double sum = 0.0;
+            for (size_t c = 0; c < channels; c++)
+                sum += std::exp(s[c * inner] - max);
+            for (size_t c = 0; c < channels; c++) {
+                float ref = static_cast<float>(std::exp(s[c * inner] - max) / sum);
+                ASSERT_NEAR(ref, d[c * inner], 1e-5f + 1e-4f * ref) << "o = " << o << " c = " << c << " i = " << i
+                                                                    << " isa = " << MKLDNNSoftMaxKernels::get().getIsaName();
+            }
+        }
+    }
+}
+
+TEST_F(MKLDNNSoftMaxKernelsTests, executeInPlace) {
+    const size_t channels = 1000;
+    std::vector<float> data(channels);
+    for (size_t c = 0; c < channels; c++)
+        data[c] = static_cast<float>(c % 13);
+    std::vector<float> ref(channels);
+    MKLDNNSoftMaxKernels::get().execute(data.data(), ref.data(), 1, channels, 1);
+
+    MKLDNNSoftMaxKernels::get().execute(data.data(), data.data(), 1, channels, 1);
+
+    for (size_t c = 0; c < channels; c++)
+        ASSERT_FLOAT_EQ(ref[c], data[c]) << "c = " << c;
+}
+
+// the innermost softmax covers the rows shorter than a vector and the tails of all ISAs,
+// the other axes cover the partial blocks of the columns
+INSTANTIATE_TEST_CASE_P(
+        TestsSoftMaxKernels, MKLDNNSoftMaxKernelsTests,
+        ::testing::Values(
+                SoftMaxKernelsParams{1, 21841, 1},
+                SoftMaxKernelsParams{100, 21, 1},
+                SoftMaxKernelsParams{7, 3, 1},
+                SoftMaxKernelsParams{3, 16, 1},
+                SoftMaxKernelsParams{2, 21, 100},
+                SoftMaxKernelsParams{1, 3, 67},
+                SoftMaxKernelsParams{4, 5, 16},
+                SoftMaxKernelsParams{2, 10, 3}));
@@ -0,0 +1,98 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <tuple>
+#include <vector>
+#include "mkldnn_plugin/mkldnn_sparse_inner_product.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+// the number of the output channels, the length of the dot product and the number of the nonzero weights of 10
+using SparseParams = std::tuple<size_t, size_t, size_t>;
+
+class MKLDNNSparseInnerProductTests : public ::testing::TestWithParam<SparseParams> {
+protected:
+    void SetUp() override {
+        OC = std::get<0>(GetParam());
+        K = std::get<1>(GetParam());
+        const size_t nonzeros = std::get<2>(GetParam());
+        // the values of i % 7 give zero at 2, so the kept weights have some zeros as well
+        weights.resize(OC * K);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = (i * 7) % 10 < nonzeros ? static_cast<float>(i % 7) * 0.25f - 0.5f : 0.0f;
+        bias.resize(OC);
+        for (size_t c = 0; c < OC; c++)
+            bias[c] = static_cast<float>(c % 3);
+    }
+
+    size_t OC = 0;
+    size_t K = 0;
+    std::vector<float> weights, bias;
+};
+
+TEST_P(MKLDNNSparseInnerProductTests, executeMatchesReference) {
+    const size_t MB = 3;
+    std::vector<float> src(MB * K), dst(MB * OC, -1.0f);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 5) - 1.0f;
+
+    MKLDNNSparseInnerProduct ip;
+    ip.init(weights.data(), OC, K);
+    // the weights of the high density are left to the primitive
+    if (std::get<2>(GetParam()) >= 3) {
+        ASSERT_TRUE(ip.empty());
+        return;
+    }
+    ASSERT_FALSE(ip.empty());
+    ASSERT_LT(ip.getDensity(), MKLDNNSparseInnerProduct::maxDensity);
+
+    ip.execute(src.data(), bias.data(), dst.data(), MB);
+
+    for (size_t n = 0; n < MB; n++) {
+        for (size_t c = 0; c < OC; c++) {
+            float ref = bias[c];
+            for (size_t k = 0; k < K; k++)
+                ref += src[n * K + k] * weights[c * K + k];
+            ASSERT_NEAR(ref, dst[n * OC + c], 1e-4f * (1.0f + std::fabs(ref))) << "n = " << n << " c = " << c;
+        }
+    }
+}
+
+TEST_P(MKLDNNSparseInnerProductTests, executeSpatialMatchesReference) {
+    const size_t MB = 2, spatial = 13;
+    std::vector<float> src(MB * K * spatial), dst(MB * OC * spatial, -1.0f);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 5) - 1.0f;
+
+    MKLDNNSparseInnerProduct ip;
+    ip.init(weights.data(), OC, K);
+    if (ip.empty())
+        return;
+
+    ip.executeSpatial(src.data(), nullptr, dst.data(), MB, spatial);
+
+    for (size_t n = 0; n < MB; n++) {
+        for (size_t c = 0; c < OC; c++) {
+            for (size_t p = 0; p < spatial; p++) {
+                float ref = 0.0f;
+                for (size_t k = 0; k < K; k++)
+                    ref += weights[c * K + k] * src[(n * K + k) * spatial + p];
+                ASSERT_NEAR(ref, dst[(n * OC + c) * spatial + p], 1e-4f * (1.0f + std::fabs(ref)))
+                        << "n = " << n << " c = " << c << " p = " << p;
+            }
+        }
+    }
+}
+
+// the channels cover the partial blocks, the densities are below and above the threshold
+INSTANTIATE_TEST_CASE_P(
+        TestsSparseInnerProduct, MKLDNNSparseInnerProductTests,
+        ::testing::Combine(
+                ::testing::Values(1, 17, 64),
+                ::testing::Values(10, 100, 1000),
+                ::testing::Values(1, 2, 5)));
@@ -0,0 +1,105 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "mkldnn_plugin/mkldnn_weights_cache.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+class MKLDNNWeightsSharingTests : public ::testing::Test {
+protected:
+    mkldnn::engine eng = mkldnn::engine(mkldnn::engine::kind::cpu, 0);
+
+    static InferenceEngine::Blob::Ptr makeBlob(const std::vector<float> &data) {
+        auto blob = InferenceEngine::make_shared_blob<float>(InferenceEngine::Precision::FP32, InferenceEngine::C,
+                                                             {data.size()});
+        blob->allocate();
+        std::copy(data.begin(), data.end(), blob->buffer().as<float *>());
+        return blob;
+    }
+
+    MKLDNNMemoryPtr create(const InferenceEngine::Blob::Ptr &blob, mkldnn::memory::format format,
+                           std::atomic<int> &created) {
+        MKLDNNMemoryDesc desc({static_cast<int>(blob->size())}, mkldnn::memory::f32, format);
+        std::string key = MKLDNNWeightsSharing::makeKey(blob->cbuffer(), blob->byteSize(), desc);
+        return MKLDNNWeightsSharing::getInstance().findOrCreate(key, blob, [&]() {
+            created++;
+            MKLDNNMemoryPtr memory(new MKLDNNMemory(eng));
+            memory->Create(desc, blob->cbuffer());
+            return memory;
+        });
+    }
+};
+
+TEST_F(MKLDNNWeightsSharingTests, sameWeightsAreCreatedOnce) {
+    auto weights = makeBlob({1.f, 2.f, 3.f, 4.f});
+    std::atomic<int> created(0);
+
+    MKLDNNMemoryPtr first = create(weights, mkldnn::memory::x, created);
+    MKLDNNMemoryPtr second = create(weights, mkldnn::memory::x, created);
+
+    ASSERT_EQ(1, created);
+    ASSERT_EQ(first.get(), second.get());
+}
+
+TEST_F(MKLDNNWeightsSharingTests, differentWeightsAreNotShared) {
+    auto weights = makeBlob({1.f, 2.f, 3.f, 4.f});
+    auto otherWeights = makeBlob({1.f, 2.f, 3.f, 5.f});
+    std::atomic<int> created(0);
+
+    MKLDNNMemoryPtr first = create(weights, mkldnn::memory::x, created);
+    MKLDNNMemoryPtr second = create(otherWeights, mkldnn::memory::x, created);
+
+    ASSERT_EQ(2, created);
+    ASSERT_NE(first.get(), second.get());
+}
+
+TEST_F(MKLDNNWeightsSharingTests, equalWeightsOfDifferentBlobsAreNotShared) {
+    auto weights = makeBlob({1.f, 2.f, 3.f, 4.f});
+    auto weightsCopy = makeBlob({1.f, 2.f, 3.f, 4.f});
+    std::atomic<int> created(0);
+
+    MKLDNNMemoryPtr first = create(weights, mkldnn::memory::x, created);
+    MKLDNNMemoryPtr second = create(weightsCopy, mkldnn::memory::x, created);
+
+    ASSERT_EQ(2, created);
+    ASSERT_NE(first.get(), second.get());
+}
+
+TEST_F(MKLDNNWeightsSharingTests, releasedWeightsAreCreatedAgain) {
+    auto weights = makeBlob({6.f, 7.f, 8.f, 9.f});
+    std::atomic<int> created(0);
+
+    create(weights, mkldnn::memory::x, created);
+    MKLDNNMemoryPtr second = create(weights, mkldnn::memory::x, created);
+
+    ASSERT_EQ(2, created);
+    ASSERT_NE(nullptr, second.get());
+}
+
+TEST_F(MKLDNNWeightsSharingTests, concurrentRequestsOfSameWeightsCreateThemOnce) {
+    auto weights = makeBlob({10.f, 11.f, 12.f, 13.f});
+    std::atomic<int> created(0);
+    std::vector<MKLDNNMemoryPtr> memories(4);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < memories.size(); i++) {
+        threads.emplace_back([&, i]() {
+            memories[i] = create(weights, mkldnn::memory::x, created);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(1, created);
+    for (auto &memory : memories) {
+        ASSERT_EQ(memories[0].get(), memory.get());
+    }
+}
@@ -478,3 +478,68 @@ TEST_F(BlobTests, makeRoiBlobWrongSize) {
     ROI roi = {0, 1, 1, 4, 4};  // cropped picture with: id = 0, (x,y) = (1,1), sizeX (W) = 4, sizeY (H) = 4
     ASSERT_THROW(make_shared_blob(blob, roi), InferenceEngine::details::InferenceEngineException);
 }
+
+TEST_F(BlobTests, makeRoiBlobOfBatchImage) {
+    SizeVector dims = {3, 3, 6, 5};
+    Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, dims, NCHW));
+    blob->allocate();
+
+    // the image 2 of the batch, the offset of the image is added to the one of the crop
+    ROI roi = {2, 2, 1, 2, 4};
+    Blob::Ptr roiBlob = make_shared_blob(blob, roi);
+    ASSERT_EQ(2 * 90 + 7, roiBlob->getTensorDesc().getBlockingDesc().getOffsetPadding());
+    ASSERT_EQ(blob->buffer().as<uint8_t *>(), roiBlob->buffer().as<uint8_t *>());
+
+    ASSERT_THROW(make_shared_blob(blob, ROI{3, 0, 0, 1, 1}), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BlobTests, makeRoiBlobOfRoiBlob) {
+    SizeVector dims = {1, 3, 6, 5};
+    Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, dims, NCHW));
+    blob->allocate();
+
+    Blob::Ptr roiBlob = make_shared_blob(blob, ROI{0, 1, 1, 4, 5});
+    Blob::Ptr nestedBlob = make_shared_blob(roiBlob, ROI{0, 1, 2, 2, 2});
+    SizeVector refStrides = {90, 30, 5, 1};
+    ASSERT_EQ(6 + 2 * 5 + 1, nestedBlob->getTensorDesc().getBlockingDesc().getOffsetPadding());
+    ASSERT_EQ(nestedBlob->getTensorDesc().getBlockingDesc().getStrides(), refStrides);
+}
+
+TEST_F(BlobTests, makeBatchSliceBlob) {
+    SizeVector dims = {4, 3, 2, 2};
+    Blob::Ptr blob = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, NCHW));
+    blob->allocate();
+
+    Blob::Ptr slice = make_shared_blob(blob, 1, 2);
+    SizeVector refDims = {2, 3, 2, 2};
+    SizeVector refStrides = {12, 4, 2, 1};
+    ASSERT_EQ(slice->getTensorDesc().getDims(), refDims);
+    ASSERT_EQ(slice->getTensorDesc().getBlockingDesc().getStrides(), refStrides);
+    ASSERT_EQ(12, slice->getTensorDesc().getBlockingDesc().getOffsetPadding());
+    ASSERT_EQ(NCHW, slice->getTensorDesc().getLayout());
+    ASSERT_EQ(24, slice->size());
+}
+
+TEST_F(BlobTests, batchSliceBlobKeepsParentAlive) {
+    Blob::Ptr blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {2, 3}, NC));
+    blob->allocate();
+    std::weak_ptr<Blob> parent = blob;
+    blob->buffer().as<float *>()[3] = 42.0f;
+
+    Blob::Ptr slice = make_shared_blob(blob, 1, 1);
+    blob.reset();
+    ASSERT_FALSE(parent.expired());
+    ASSERT_EQ(42.0f, slice->buffer().as<float *>()[slice->getTensorDesc().getBlockingDesc().getOffsetPadding()]);
+
+    slice.reset();
+    ASSERT_TRUE(parent.expired());
+}
+
+TEST_F(BlobTests, makeBatchSliceBlobWrongRange) {
+    Blob::Ptr blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {4, 3}, NC));
+    blob->allocate();
+
+    ASSERT_THROW(make_shared_blob(blob, 0, 0), InferenceEngine::details::InferenceEngineException);
+    ASSERT_THROW(make_shared_blob(blob, 4, 1), InferenceEngine::details::InferenceEngineException);
+    ASSERT_THROW(make_shared_blob(blob, 2, 3), InferenceEngine::details::InferenceEngineException);
+}
@@ -0,0 +1,151 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include <blob_transform.hpp>
+#include <precision_utils.h>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class BlobTransformTests : public ::testing::Test {
+protected:
+    // the blob of the dims with the memory order of the dims given by order
+    template <typename T>
+    typename TBlob<T>::Ptr makeBlob(Precision precision, const SizeVector &dims, const SizeVector &order) {
+        SizeVector blockedDims;
+        for (size_t axis : order)
+            blockedDims.push_back(dims[axis]);
+        TensorDesc desc(precision, dims, BlockingDesc(blockedDims, order));
+        auto blob = make_shared_blob<T>(desc);
+        blob->allocate();
+        return blob;
+    }
+
+    // the offset of the element of the logical (dims-ordered) index in the blob
+    static size_t offset(const Blob::Ptr &blob, const SizeVector &index) {
+        const BlockingDesc &desc = blob->getTensorDesc().getBlockingDesc();
+        size_t offset = desc.getOffsetPadding();
+        for (size_t i = 0; i < desc.getOrder().size(); i++)
+            offset += index[desc.getOrder()[i]] * desc.getStrides()[i];
+        return offset;
+    }
+
+    static bool next(SizeVector &index, const SizeVector &dims) {
+        for (size_t i = dims.size(); i-- > 0;) {
+            if (++index[i] < dims[i])
+                return true;
+            index[i] = 0;
+        }
+        return false;
+    }
+
+    template <typename S, typename D, typename F>
+    void checkCopy(Precision srcPrecision, Precision dstPrecision, const SizeVector &dims,
+                   const SizeVector &srcOrder, const SizeVector &dstOrder, const F &reference) {
+        auto src = makeBlob<S>(srcPrecision, dims, srcOrder);
+        auto dst = makeBlob<D>(dstPrecision, dims, dstOrder);
+        S *srcData = src->data();
+        for (size_t i = 0; i < src->size(); i++)
+            srcData[i] = static_cast<S>(i % 251);
+
+        blob_copy(src, dst);
+
+        SizeVector index(dims.size(), 0);
+        do {
+            ASSERT_EQ(reference(srcData[offset(src, index)]), dst->data()[offset(dst, index)]);
+        } while (next(index, dims));
+    }
+};
+
+TEST_F(BlobTransformTests, copiesNCHWToNHWC) {
+    checkCopy<float, float>(Precision::FP32, Precision::FP32, {2, 3, 5, 7}, {0, 1, 2, 3}, {0, 2, 3, 1},
+                            [](float v) { return v; });
+}
+
+TEST_F(BlobTransformTests, copiesNHWCToNCHW) {
+    checkCopy<uint8_t, uint8_t>(Precision::U8, Precision::U8, {2, 3, 37, 70}, {0, 2, 3, 1}, {0, 1, 2, 3},
+                                [](uint8_t v) { return v; });
+}
+
+TEST_F(BlobTransformTests, copiesNCDHWToNDHWC) {
+    checkCopy<int16_t, int16_t>(Precision::I16, Precision::I16, {2, 19, 3, 5, 33}, {0, 1, 2, 3, 4}, {0, 2, 3, 4, 1},
+                                [](int16_t v) { return v; });
+}
+
+TEST_F(BlobTransformTests, copiesHWCToCHW) {
+    checkCopy<float, float>(Precision::FP32, Precision::FP32, {3, 40, 50}, {1, 2, 0}, {0, 1, 2},
+                            [](float v) { return v; });
+}
+
+TEST_F(BlobTransformTests, copiesBigBlobInParallel) {
+    checkCopy<float, float>(Precision::FP32, Precision::FP32, {1, 3, 300, 400}, {0, 2, 3, 1}, {0, 1, 2, 3},
+                            [](float v) { return v; });
+    checkCopy<float, float>(Precision::FP32, Precision::FP32, {1, 3, 300, 400}, {0, 1, 2, 3}, {0, 1, 2, 3},
+                            [](float v) { return v; });
+}
+
+TEST_F(BlobTransformTests, convertsU8ToFP32WithLayout) {
+    checkCopy<uint8_t, float>(Precision::U8, Precision::FP32, {1, 3, 9, 11}, {0, 2, 3, 1}, {0, 1, 2, 3},
+                              [](uint8_t v) { return static_cast<float>(v); });
+}
+
+TEST_F(BlobTransformTests, convertsFP32ToFP16) {
+    checkCopy<float, ie_fp16>(Precision::FP32, Precision::FP16, {1, 3, 9, 11}, {0, 1, 2, 3}, {0, 2, 3, 1},
+                              [](float v) { return PrecisionUtils::f32tof16(v); });
+}
+
+TEST_F(BlobTransformTests, roundsAndSaturatesConversionToIntegers) {
+    TensorDesc desc(Precision::FP32, {4}, Layout::C);
+    auto src = make_shared_blob<float>(desc);
+    src->allocate();
+    src->data()[0] = -3.f;
+    src->data()[1] = 2.6f;
+    src->data()[2] = 255.4f;
+    src->data()[3] = 1000.f;
+    auto dst = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {4}, Layout::C));
+    dst->allocate();
+
+    blob_copy(src, dst);
+
+    ASSERT_EQ(0, dst->data()[0]);
+    ASSERT_EQ(3, dst->data()[1]);
+    ASSERT_EQ(255, dst->data()[2]);
+    ASSERT_EQ(255, dst->data()[3]);
+}
+
+TEST_F(BlobTransformTests, copiesRoiOfBlob) {
+    auto full = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 2, 6, 8}, Layout::NHWC));
+    full->allocate();
+    for (size_t i = 0; i < full->size(); i++)
+        full->data()[i] = static_cast<float>(i);
+    auto roi = make_shared_blob(full, ROI{0, 2, 1, 4, 3});
+    auto dst = makeBlob<float>(Precision::FP32, {1, 2, 3, 4}, {0, 1, 2, 3});
+
+    blob_copy(roi, dst);
+
+    SizeVector index(4, 0);
+    do {
+        SizeVector fullIndex = {0, index[1], index[2] + 1, index[3] + 2};
+        ASSERT_EQ(full->data()[offset(full, fullIndex)], dst->data()[offset(dst, index)]);
+    } while (next(index, dst->getTensorDesc().getDims()));
+}
+
+TEST_F(BlobTransformTests, throwsForDifferentShapes) {
+    auto src = makeBlob<float>(Precision::FP32, {1, 3, 4, 4}, {0, 1, 2, 3});
+    auto dst = makeBlob<float>(Precision::FP32, {1, 3, 4, 5}, {0, 1, 2, 3});
+    ASSERT_THROW(blob_copy(src, dst), details::InferenceEngineException);
+}
+
+TEST_F(BlobTransformTests, detectsDenseBlobs) {
+    auto full = make_shared_blob<float>(TensorDesc(Precision::FP32, {4, 2, 6, 8}, Layout::NCHW));
+    full->allocate();
+
+    ASSERT_TRUE(blob_is_dense(full));
+    ASSERT_TRUE(blob_is_dense(make_shared_blob(full, 1, 2)));
+    ASSERT_FALSE(blob_is_dense(make_shared_blob(full, ROI{1, 2, 1, 4, 3})));
+}
@@ -0,0 +1,138 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <cpp/ie_cnn_net_reader.h>
+#include <cnn_network_int8_normalizer.hpp>
+#include <cnn_network_stats_impl.hpp>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class CNNNetworkInt8NormalizerTests : public ::testing::Test {
+protected:
+    static constexpr size_t channels = 4;
+
+    // the chain of the 1x1 convolutions with 4 channels, each layer is given by its type
+    static std::string chain(const std::vector<std::string> &types) {
+        std::string dims = "<dim>1</dim><dim>4</dim><dim>8</dim><dim>8</dim>";
+        std::string layers = "<layer name=\"data\" type=\"Input\" precision=\"FP32\" id=\"0\">"
+                             "<output><port id=\"1\">" + dims + "</port></output></layer>";
+        std::string edges;
+        size_t offset = 0;
+        std::map<std::string, size_t> counts;
+        for (size_t i = 1; i <= types.size(); i++) {
+            const std::string &type = types[i - 1];
+            std::string name = type == "Convolution" ? "conv" : type == "ReLU" ? "relu" : "pool";
+            std::string id = std::to_string(i);
+            layers += "<layer name=\"" + name + std::to_string(++counts[name]) + "\" type=\"" + type +
+                      "\" precision=\"FP32\" id=\"" + id + "\">";
+            if (type == "Convolution") {
+                layers += "<convolution_data stride-x=\"1\" stride-y=\"1\" pad-x=\"0\" pad-y=\"0\" kernel-x=\"1\" "
+                          "kernel-y=\"1\" output=\"4\" group=\"1\"/>";
+            } else if (type == "Pooling") {
+                layers += "<pooling_data kernel-x=\"1\" kernel-y=\"1\" pad-x=\"0\" pad-y=\"0\" stride-x=\"1\" "
+                          "stride-y=\"1\" rounding-type=\"ceil\" pool-method=\"max\"/>";
+            }
+            layers += "<input><port id=\"0\">" + dims + "</port></input>"
+                      "<output><port id=\"1\">" + dims + "</port></output>";
+            if (type == "Convolution") {
+                layers += "<weights offset=\"" + std::to_string(offset) + "\" size=\"64\"/>"
+                          "<biases offset=\"" + std::to_string(offset + 64) + "\" size=\"16\"/>";
+                offset += 80;
+            }
+            layers += "</layer>";
+            edges += "<edge from-layer=\"" + std::to_string(i - 1) + "\" from-port=\"1\" to-layer=\"" + id +
+                     "\" to-port=\"0\"/>";
+        }
+        return "<net name=\"net\" version=\"2\" batch=\"1\"><layers>" + layers + "</layers><edges>" + edges +
+               "</edges></net>";
+    }
+
+    CNNNetReader reader;
+    std::map<std::string, NetworkNodeStatsPtr> nodesStats;
+
+    CNNNetwork readChain(const std::vector<std::string> &types) {
+        std::string model = chain(types);
+        reader.ReadNetwork(model.data(), model.length());
+        auto weights = make_shared_blob<uint8_t>(Precision::U8, Layout::C, {80 * types.size()});
+        weights->allocate();
+        float *data = reinterpret_cast<float *>(weights->buffer().as<uint8_t *>());
+        for (size_t i = 0; i < weights->size() / sizeof(float); i++)
+            data[i] = static_cast<float>(i % 7) - 3.f;
+        reader.SetWeights(weights);
+
+        CNNNetwork network = reader.getNetwork();
+        for (auto &layer : network) {
+            NetworkNodeStatsPtr stats(new NetworkNodeStats(channels));
+            stats->_minOutputs.assign(channels, layer->type == "Convolution" ? -4.f : 0.f);
+            stats->_maxOutputs.assign(channels, 4.f);
+            nodesStats[layer->name] = stats;
+        }
+        return network;
+    }
+};
+
+constexpr size_t CNNNetworkInt8NormalizerTests::channels;
+
+TEST_F(CNNNetworkInt8NormalizerTests, selectsConvolutionsFollowedByReLU) {
+    CNNNetwork network = readChain({"Convolution", "ReLU", "Convolution", "Pooling", "Convolution", "ReLU"});
+    CNNNetworkInt8Normalizer normalizer;
+
+    ASSERT_EQ(std::set<std::string>({"conv1", "conv3"}), normalizer.SelectInt8Layers(network, nodesStats, {}, false));
+}
+
+TEST_F(CNNNetworkInt8NormalizerTests, skipsConvolutionsWithoutStatistics) {
+    CNNNetwork network = readChain({"Convolution", "ReLU", "Convolution", "ReLU"});
+    nodesStats.erase("conv2");
+    CNNNetworkInt8Normalizer normalizer;
+
+    ASSERT_EQ(std::set<std::string>({"conv1"}), normalizer.SelectInt8Layers(network, nodesStats, {}, false));
+}
+
+TEST_F(CNNNetworkInt8NormalizerTests, keepsGivenLayersInFP32) {
+    CNNNetwork network = readChain({"Convolution", "ReLU", "Convolution", "ReLU", "Pooling",
+                                    "Convolution", "ReLU", "Convolution", "ReLU"});
+    CNNNetworkInt8Normalizer normalizer;
+
+    ASSERT_EQ(std::set<std::string>({"conv1", "conv3", "conv4"}),
+              normalizer.SelectInt8Layers(network, nodesStats, {"conv2"}, false));
+}
+
+TEST_F(CNNNetworkInt8NormalizerTests, keepsIsolatedConvolutionsInFP32ToMinimizeBoundaries) {
+    CNNNetwork network = readChain({"Convolution", "ReLU", "Convolution", "ReLU", "Pooling",
+                                    "Convolution", "ReLU", "Convolution", "ReLU"});
+    CNNNetworkInt8Normalizer normalizer;
+
+    ASSERT_EQ(std::set<std::string>({"conv1", "conv2", "conv3", "conv4"}),
+              normalizer.SelectInt8Layers(network, nodesStats, {}, true));
+    // conv1 would be quantized alone between the input and conv2
+    ASSERT_EQ(std::set<std::string>({"conv3", "conv4"}),
+              normalizer.SelectInt8Layers(network, nodesStats, {"conv2"}, true));
+}
+
+TEST_F(CNNNetworkInt8NormalizerTests, normalizesOnlySelectedLayers) {
+    CNNNetwork network = readChain({"Convolution", "ReLU", "Convolution", "ReLU", "Pooling",
+                                    "Convolution", "ReLU", "Convolution", "ReLU"});
+    CNNNetworkStatsImpl stats(nodesStats);
+    CNNNetworkInt8Normalizer normalizer;
+
+    ASSERT_NO_THROW(normalizer.NormalizeNetwork(network, stats, {"conv2"}, true));
+
+    std::set<std::string> int8Layers;
+    for (auto &layer : network) {
+        if (layer->precision == Precision::I8)
+            int8Layers.insert(layer->name);
+    }
+    ASSERT_EQ(std::set<std::string>({"conv3", "conv4"}), int8Layers);
+    auto *conv2 = dynamic_cast<ConvolutionLayer *>(network.getLayerByName("conv2").get());
+    ASSERT_NE(nullptr, conv2);
+    ASSERT_EQ(Precision::FP32, conv2->_weights->precision());
+}
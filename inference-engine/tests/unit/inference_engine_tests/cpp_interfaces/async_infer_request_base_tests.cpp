@@ -142,6 +142,19 @@ TEST_F(InferRequestBaseTests, canCatchUnknownErrorInGetPerformanceCounts) {
     ASSERT_EQ(UNEXPECTED, request->GetPerformanceCounts(info, nullptr));
 }
 
+// GetTimings
+TEST_F(InferRequestBaseTests, canForwardGetTimings) {
+    InferenceEngine::InferRequestTimings timings;
+    EXPECT_CALL(*mock_impl.get(), GetTimings(Ref(timings))).Times(1);
+    ASSERT_EQ(OK, request->GetTimings(timings, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canCatchUnknownErrorInGetTimings) {
+    InferenceEngine::InferRequestTimings timings;
+    EXPECT_CALL(*mock_impl.get(), GetTimings(_)).WillOnce(Throw(5));
+    ASSERT_EQ(UNEXPECTED, request->GetTimings(timings, nullptr));
+}
+
 // GetBlob
 TEST_F(InferRequestBaseTests, canForwardGetBlob) {
     Blob::Ptr data;
@@ -163,6 +176,99 @@ TEST_F(InferRequestBaseTests, canCatchUnknownErrorInGetBlob) {
     ASSERT_EQ(UNEXPECTED, request->GetBlob(nullptr, data, nullptr));
 }
 
+// GetBlobByIndex
+TEST_F(InferRequestBaseTests, canForwardGetBlobByIndex) {
+    Blob::Ptr data;
+    EXPECT_CALL(*mock_impl.get(), GetBlobByIndex(1, Ref(data))).Times(1);
+    ASSERT_EQ(OK, request->GetBlobByIndex(1, data, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canReportErrorInGetBlobByIndex) {
+    EXPECT_CALL(*mock_impl.get(), GetBlobByIndex(_, _)).WillOnce(Throw(std::runtime_error("compare")));
+    Blob::Ptr data;
+    ASSERT_NE(request->GetBlobByIndex(0, data, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
+// SetBlobByIndex
+TEST_F(InferRequestBaseTests, canForwardSetBlobByIndex) {
+    Blob::Ptr data;
+    EXPECT_CALL(*mock_impl.get(), SetBlobByIndex(1, Ref(data))).Times(1);
+    ASSERT_EQ(OK, request->SetBlobByIndex(1, data, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canCatchUnknownErrorInSetBlobByIndex) {
+    Blob::Ptr data;
+    EXPECT_CALL(*mock_impl.get(), SetBlobByIndex(_, _)).WillOnce(Throw(5));
+    ASSERT_EQ(UNEXPECTED, request->SetBlobByIndex(0, data, nullptr));
+}
+
+// SetRoiBlobs
+TEST_F(InferRequestBaseTests, canForwardSetRoiBlobs) {
+    std::vector<Blob::Ptr> rois(2);
+    const char *name = "";
+    EXPECT_CALL(*mock_impl.get(), SetRoiBlobs(name, Ref(rois))).Times(1);
+    ASSERT_EQ(OK, request->SetRoiBlobs(name, rois, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canCatchUnknownErrorInSetRoiBlobs) {
+    std::vector<Blob::Ptr> rois;
+    EXPECT_CALL(*mock_impl.get(), SetRoiBlobs(_, _)).WillOnce(Throw(5));
+    ASSERT_EQ(UNEXPECTED, request->SetRoiBlobs("", rois, nullptr));
+}
+
+// SetSkippedOutputs
+TEST_F(InferRequestBaseTests, canForwardSetSkippedOutputs) {
+    std::vector<std::string> names = {"aux"};
+    EXPECT_CALL(*mock_impl.get(), SetSkippedOutputs(Ref(names))).Times(1);
+    ASSERT_EQ(OK, request->SetSkippedOutputs(names, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canCatchUnknownErrorInSetSkippedOutputs) {
+    std::vector<std::string> names;
+    EXPECT_CALL(*mock_impl.get(), SetSkippedOutputs(_)).WillOnce(Throw(5));
+    ASSERT_EQ(UNEXPECTED, request->SetSkippedOutputs(names, nullptr));
+}
+
+// IsZeroCopyBlob
+TEST_F(InferRequestBaseTests, canForwardIsZeroCopyBlob) {
+    Blob::Ptr data;
+    const char *name = "";
+    bool zeroCopy = false;
+    EXPECT_CALL(*mock_impl.get(), IsZeroCopyBlob(name, Ref(data))).WillOnce(Return(true));
+    ASSERT_EQ(OK, request->IsZeroCopyBlob(name, data, zeroCopy, &dsc));
+    ASSERT_TRUE(zeroCopy);
+}
+
+TEST_F(InferRequestBaseTests, canCatchUnknownErrorInIsZeroCopyBlob) {
+    Blob::Ptr data;
+    bool zeroCopy = false;
+    EXPECT_CALL(*mock_impl.get(), IsZeroCopyBlob(_, _)).WillOnce(Throw(5));
+    ASSERT_EQ(UNEXPECTED, request->IsZeroCopyBlob("", data, zeroCopy, nullptr));
+}
+
+// Cancel
+TEST_F(InferRequestBaseTests, canForwardCancel) {
+    EXPECT_CALL(*mock_impl.get(), Cancel()).Times(1);
+    ASSERT_EQ(OK, request->Cancel(&dsc));
+}
+
+TEST_F(InferRequestBaseTests, canCatchUnknownErrorInCancel) {
+    EXPECT_CALL(*mock_impl.get(), Cancel()).WillOnce(Throw(5));
+    ASSERT_EQ(UNEXPECTED, request->Cancel(nullptr));
+}
+
+// SetDeadline
+TEST_F(InferRequestBaseTests, canForwardSetDeadline) {
+    EXPECT_CALL(*mock_impl.get(), SetDeadline(100)).Times(1);
+    ASSERT_EQ(OK, request->SetDeadline(100, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canCatchUnknownErrorInSetDeadline) {
+    EXPECT_CALL(*mock_impl.get(), SetDeadline(_)).WillOnce(Throw(5));
+    ASSERT_EQ(UNEXPECTED, request->SetDeadline(0, nullptr));
+}
+
 // SetBlob
 TEST_F(InferRequestBaseTests, canForwardSetBlob) {
     Blob::Ptr data;
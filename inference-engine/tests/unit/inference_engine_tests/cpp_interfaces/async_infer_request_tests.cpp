@@ -177,6 +177,21 @@ TEST_F(InferRequestTests, canForwardGetBlob) {
     ASSERT_NO_THROW(requestWrapper->GetBlob(name));
 }
 
+TEST_F(InferRequestTests, canForwardGetBlobByIndex) {
+    Blob::Ptr blob = make_shared_blob<float>(Precision::FP32, NCHW, {});
+    blob->allocate();
+
+    EXPECT_CALL(*mock_request.get(), GetBlobByIndex(2, _, _)).WillOnce(DoAll(SetArgReferee<1>(blob), Return(OK)));
+    ASSERT_NO_THROW(requestWrapper->GetBlob(size_t(2)));
+}
+
+TEST_F(InferRequestTests, throwsIfGetBlobByIndexReturnNotOK) {
+    Blob::Ptr blob;
+
+    EXPECT_CALL(*mock_request.get(), GetBlobByIndex(_, _, _)).WillOnce(Return(NOT_IMPLEMENTED));
+    ASSERT_THROW(blob = requestWrapper->GetBlob(size_t(0)), InferenceEngineException);
+}
+
 TEST_F(InferRequestTests, throwsIfGetBlobReturnNotOK) {
     Blob::Ptr blob;
     std::string name = "blob1";
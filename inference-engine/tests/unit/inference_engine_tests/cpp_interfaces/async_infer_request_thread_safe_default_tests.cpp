@@ -12,6 +12,12 @@
 #include <cpp_interfaces/mock_task_synchronizer.hpp>
 #include <cpp_interfaces/mock_task_executor.hpp>
 #include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <cpp_interfaces/ie_executor_manager.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
 
 using namespace ::testing;
 using namespace std;
@@ -23,8 +29,10 @@ public:
     TestAsyncInferRequestThreadSafeDefault(const InferRequestInternal::Ptr &request,
                                            const ITaskExecutor::Ptr &taskExecutor,
                                            const TaskSynchronizer::Ptr &taskSynchronizer,
-                                           const ITaskExecutor::Ptr &callbackExecutor)
-            : AsyncInferRequestThreadSafeDefault(request, taskExecutor, taskSynchronizer, callbackExecutor) {}
+                                           const ITaskExecutor::Ptr &callbackExecutor,
+                                           const ITaskExecutor::Ptr &preprocessExecutor = nullptr)
+            : AsyncInferRequestThreadSafeDefault(request, taskExecutor, taskSynchronizer, callbackExecutor,
+                                                 preprocessExecutor) {}
 
     void setRequestBusy() {
         AsyncInferRequestThreadSafeDefault::setIsRequestBusy(true);
@@ -138,6 +146,76 @@ TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnGetPerformanceCoun
     }, REQUEST_BUSY_str));
 }
 
+// GetTimings
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnGetTimings) {
+    testRequest->setRequestBusy();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() {
+        InferRequestTimings timings;
+        testRequest->GetTimings(timings);
+    }, REQUEST_BUSY_str));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, timingsOfStagesAreOrderedAndReadByCallback) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    InferRequestTimings inCallback;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                inCallback = request.GetTimings();
+            };
+    cppRequest.SetCompletionCallback(callback);
+    auto &timings = mockInferRequestInternal->getTimings();
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([&]() {
+        timings.mark(&InferRequestTimings::preprocessed_uSec);
+        timings.mark(&InferRequestTimings::executed_uSec);
+        timings.mark(&InferRequestTimings::outputsCopied_uSec);
+    }));
+
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    InferRequestTimings last = cppRequest.GetTimings();
+
+    ASSERT_NE(0, last.enqueued_uSec);
+    ASSERT_LE(last.enqueued_uSec, last.started_uSec);
+    ASSERT_LE(last.started_uSec, last.preprocessed_uSec);
+    ASSERT_LE(last.preprocessed_uSec, last.executed_uSec);
+    ASSERT_LE(last.executed_uSec, last.outputsCopied_uSec);
+    ASSERT_LE(last.outputsCopied_uSec, last.callback_uSec);
+    ASSERT_EQ(last.callback_uSec, inCallback.callback_uSec);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, timingsAreResetByNextInference) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    auto &timings = mockInferRequestInternal->getTimings();
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([&]() {
+        timings.mark(&InferRequestTimings::executed_uSec);
+    })).WillOnce(Return());
+    EXPECT_CALL(*mockTaskSync.get(), lock()).Times(AnyNumber());
+    EXPECT_CALL(*mockTaskSync.get(), unlock()).Times(AnyNumber());
+
+    testRequest->Infer();
+    InferRequestTimings first;
+    testRequest->GetTimings(first);
+    testRequest->Infer();
+    InferRequestTimings second;
+    testRequest->GetTimings(second);
+
+    ASSERT_NE(0, first.executed_uSec);
+    ASSERT_EQ(0, second.executed_uSec);
+    ASSERT_EQ(0, second.callback_uSec);
+    ASSERT_LE(first.started_uSec, second.enqueued_uSec);
+    ASSERT_LE(second.enqueued_uSec, second.started_uSec);
+}
+
 // GetBlob
 TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnGetBlob) {
     testRequest->setRequestBusy();
@@ -217,3 +295,266 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnEnableInlineCompletion) {
+    testRequest->setRequestBusy();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->EnableInlineCompletion(true); },
+                                               REQUEST_BUSY_str));
+    ASSERT_FALSE(testRequest->isInlineCompletionEnabled());
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, inlineCompletionRunsCallbackOnInferThread) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    auto callbackExecutor = make_shared<MockTaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, callbackExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+    testRequest->EnableInlineCompletion(true);
+
+    std::thread::id inferThread, callbackThread;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                callbackThread = std::this_thread::get_id();
+                ASSERT_EQ(StatusCode::OK, status);
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([&]() {
+        inferThread = std::this_thread::get_id();
+    }));
+    EXPECT_CALL(*callbackExecutor.get(), startTask(_)).Times(0);
+
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(inferThread, callbackThread);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, inlineCallbackIsCalledIfAsyncRequestFailed) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    auto callbackExecutor = make_shared<MockTaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, callbackExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+    testRequest->EnableInlineCompletion(true);
+
+    bool wasCalled = false;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                wasCalled = true;
+                ASSERT_EQ(StatusCode::GENERAL_ERROR, status);
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Throw(std::exception()));
+    EXPECT_CALL(*callbackExecutor.get(), startTask(_)).Times(0);
+
+    testRequest->StartAsync();
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
+    ASSERT_TRUE(wasCalled);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canStartRequestFromInlineCallback) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+    testRequest->EnableInlineCompletion(true);
+
+    int callbacks = 0;
+    std::promise<void> lastCallback;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                ASSERT_EQ(StatusCode::OK, status);
+                if (++callbacks < 3) {
+                    request.StartAsync();
+                } else {
+                    lastCallback.set_value();
+                }
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(3);
+
+    testRequest->StartAsync();
+    lastCallback.get_future().wait();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(3, callbacks);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, pipelinedRequestRunsStagesOnDifferentExecutors) {
+    auto preprocessExecutor = std::make_shared<TaskExecutor>();
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    auto callbackExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, callbackExecutor,
+                                                                      preprocessExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    std::thread::id preprocessThread, inferThread, postprocessThread;
+    {
+        InSequence s;
+        EXPECT_CALL(*mockInferRequestInternal.get(), Preprocess()).WillOnce(Invoke([&]() {
+            preprocessThread = std::this_thread::get_id();
+        }));
+        EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([&]() {
+            inferThread = std::this_thread::get_id();
+        }));
+        EXPECT_CALL(*mockInferRequestInternal.get(), Postprocess()).WillOnce(Invoke([&]() {
+            postprocessThread = std::this_thread::get_id();
+        }));
+    }
+
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_NE(preprocessThread, inferThread);
+    ASSERT_NE(postprocessThread, inferThread);
+    ASSERT_NE(preprocessThread, postprocessThread);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, pipelinedRequestSkipsPostprocessIfInferFailed) {
+    auto preprocessExecutor = std::make_shared<TaskExecutor>();
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor,
+                                                                      preprocessExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    bool wasCalled = false;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                wasCalled = true;
+                ASSERT_EQ(StatusCode::GENERAL_ERROR, status);
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), Preprocess()).Times(1);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Throw(std::exception()));
+    EXPECT_CALL(*mockInferRequestInternal.get(), Postprocess()).Times(0);
+
+    testRequest->StartAsync();
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
+    ASSERT_TRUE(wasCalled);
+}
+
+// Cancel
+TEST_F(InferRequestThreadSafeDefaultTests, cancelledRequestCompletesWithInferCancelled) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    bool wasCalled = false;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                wasCalled = true;
+                ASSERT_EQ(StatusCode::INFER_CANCELLED, status);
+            };
+    cppRequest.SetCompletionCallback(callback);
+    // the request is cancelled while it is running, the plugin stops at its next check
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([&]() {
+        cppRequest.Cancel();
+        mockInferRequestInternal->getCancellation().check();
+    }));
+
+    cppRequest.StartAsync();
+    ASSERT_EQ(INFER_CANCELLED, asyncRequest->Wait(IInferRequest::WaitMode::RESULT_READY, &dsc));
+    ASSERT_TRUE(wasCalled);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, cancellationIsDroppedByNextInference) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([&]() {
+        mockInferRequestInternal->getCancellation().check();
+    }));
+
+    testRequest->Cancel();
+    testRequest->StartAsync();
+    ASSERT_EQ(OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+}
+
+// SetDeadline
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetDeadline) {
+    testRequest->setRequestBusy();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->SetDeadline(10); }, REQUEST_BUSY_str));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, throwsOnNegativeDeadline) {
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->SetDeadline(-1); }, PARAMETER_MISMATCH_str));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, lateRequestIsNotInferred) {
+    auto preprocessExecutor = std::make_shared<TaskExecutor>();
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor,
+                                                                      preprocessExecutor);
+    // the deadline is missed by the pre-processing stage, so the inference is shed before it is run
+    EXPECT_CALL(*mockInferRequestInternal.get(), Preprocess()).WillOnce(Invoke([]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }));
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(0);
+
+    testRequest->SetDeadline(1);
+    testRequest->StartAsync();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() {
+        testRequest->Wait(IInferRequest::WaitMode::RESULT_READY);
+    }, INFER_CANCELLED_str));
+}
+
+// the in-flight requests are inferred at once by the several workers of the shared executor
+TEST_F(InferRequestThreadSafeDefaultTests, inFlightRequestsRunConcurrentlyOnSeveralWorkers) {
+    ExecutorManagerImpl manager;
+    auto taskExecutor = manager.getExecutor("CPU", 2);
+    auto taskSynchronizer = std::make_shared<TaskSynchronizer>();
+
+    std::mutex mutex;
+    std::condition_variable arrivedCondVar;
+    int arrived = 0;
+    std::atomic<int> metOther(0);
+    // every inference waits for the other one, so both complete in time only if they run at the same time
+    auto infer = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        arrived++;
+        arrivedCondVar.notify_all();
+        if (arrivedCondVar.wait_for(lock, std::chrono::seconds(5), [&]() { return arrived == 2; }))
+            metOther++;
+    };
+
+    InputsDataMap inputsInfo;
+    OutputsDataMap outputsInfo;
+    std::vector<shared_ptr<MockInferRequestInternal>> internals;
+    std::vector<shared_ptr<TestAsyncInferRequestThreadSafeDefault>> requests;
+    for (int i = 0; i < 2; i++) {
+        internals.push_back(make_shared<MockInferRequestInternal>(inputsInfo, outputsInfo));
+        EXPECT_CALL(*internals.back().get(), InferImpl()).WillOnce(Invoke(infer));
+        requests.push_back(make_shared<TestAsyncInferRequestThreadSafeDefault>(internals.back(), taskExecutor,
+                                                                               taskSynchronizer, taskExecutor));
+    }
+
+    for (auto &request : requests)
+        request->StartAsync();
+    for (auto &request : requests)
+        ASSERT_EQ(OK, request->Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(2, metOther.load());
+}
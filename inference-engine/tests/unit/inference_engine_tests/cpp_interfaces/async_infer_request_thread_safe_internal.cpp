@@ -112,6 +112,15 @@ TEST_F(AsyncInferRequestThreadSafeInternalTests, returnRequestBusyOnGetBlob) {
     }, REQUEST_BUSY_str));
 }
 
+// GetBlobByIndex
+TEST_F(AsyncInferRequestThreadSafeInternalTests, returnRequestBusyOnGetBlobByIndex) {
+    testRequest->setRequestBusy();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() {
+        Blob::Ptr data;
+        testRequest->GetBlobByIndex(0, data);
+    }, REQUEST_BUSY_str));
+}
+
 // SetBlob
 TEST_F(AsyncInferRequestThreadSafeInternalTests, returnRequestBusyOnSetBlob) {
     testRequest->setRequestBusy();
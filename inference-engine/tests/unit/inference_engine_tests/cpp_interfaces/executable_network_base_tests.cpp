@@ -89,3 +89,34 @@ TEST_F(ExecutableNetworkBaseTests, canCatchUnknownErrorInGetMappedTopology) {
     std::map<std::string, std::vector<PrimitiveInfo::Ptr>> deployedTopology;
     ASSERT_EQ(UNEXPECTED, exeNetwork->GetMappedTopology(deployedTopology, nullptr));
 }
+
+// Reshape
+TEST_F(ExecutableNetworkBaseTests, canForwardReshape) {
+    std::map<std::string, SizeVector> inputShapes = {{"data", {1, 3, 32, 32}}};
+    EXPECT_CALL(*mock_impl.get(), Reshape(Ref(inputShapes))).Times(1);
+    ASSERT_EQ(OK, exeNetwork->Reshape(inputShapes, &dsc));
+}
+
+TEST_F(ExecutableNetworkBaseTests, canReportErrorInReshape) {
+    EXPECT_CALL(*mock_impl.get(), Reshape(_)).WillOnce(Throw(std::runtime_error("compare")));
+    ASSERT_NE(exeNetwork->Reshape({}, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
+TEST_F(ExecutableNetworkBaseTests, canCatchUnknownErrorInReshape) {
+    EXPECT_CALL(*mock_impl.get(), Reshape(_)).WillOnce(Throw(5));
+    ASSERT_EQ(UNEXPECTED, exeNetwork->Reshape({}, nullptr));
+}
+
+// GetExecutorMetrics
+TEST_F(ExecutableNetworkBaseTests, canForwardGetExecutorMetrics) {
+    std::map<std::string, ExecutorMetrics> metrics;
+    EXPECT_CALL(*mock_impl.get(), GetExecutorMetrics(Ref(metrics))).Times(1);
+    ASSERT_EQ(OK, exeNetwork->GetExecutorMetrics(metrics, &dsc));
+}
+
+TEST_F(ExecutableNetworkBaseTests, canCatchUnknownErrorInGetExecutorMetrics) {
+    std::map<std::string, ExecutorMetrics> metrics;
+    EXPECT_CALL(*mock_impl.get(), GetExecutorMetrics(_)).WillOnce(Throw(5));
+    ASSERT_EQ(UNEXPECTED, exeNetwork->GetExecutorMetrics(metrics, nullptr));
+}
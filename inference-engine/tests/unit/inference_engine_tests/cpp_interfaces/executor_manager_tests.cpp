@@ -4,6 +4,8 @@
 //
 
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 #include <cpp_interfaces/ie_executor_manager.hpp>
 #include <ie_device.hpp>
 
@@ -47,3 +49,23 @@ TEST_F(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST_F(ExecutorManagerTests, returnTheSameExecutorForConcurrentRequests) {
+    auto device = TargetDeviceInfo::name(TargetDevice::eCPU);
+    const size_t threadsNumber = 8;
+    std::vector<ITaskExecutor::Ptr> executors(threadsNumber);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsNumber; i++) {
+        threads.emplace_back([&, i]() {
+            executors[i] = _manager.getExecutor(device);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (auto &executor : executors) {
+        ASSERT_EQ(executors[0], executor);
+    }
+    ASSERT_EQ(1, _manager.getExecutorsNumber());
+}
@@ -5,6 +5,9 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include <ie_version.hpp>
 #include <inference_engine/cnn_network_impl.hpp>
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
@@ -101,6 +104,105 @@ TEST_F(InferenceEnginePluginInternalTest, loadExeNetworkCallsSetNetworkIO) {
     EXPECT_NO_THROW(plugin->LoadNetwork(exeNetwork, mockNotEmptyNet, config, nullptr));
 }
 
+TEST_F(InferenceEnginePluginInternalTest, canLoadExeNetworksConcurrently) {
+    const size_t threadsNumber = 8;
+    vector<shared_ptr<MockExecutableNetworkInternal>> exeNetworksInternal;
+    for (size_t i = 0; i < threadsNumber; i++) {
+        exeNetworksInternal.push_back(make_shared<MockExecutableNetworkInternal>());
+        EXPECT_CALL(*exeNetworksInternal.back().get(), setNetworkInputs(_)).Times(1);
+        EXPECT_CALL(*exeNetworksInternal.back().get(), setNetworkOutputs(_)).Times(1);
+    }
+    atomic<size_t> loaded(0);
+    EXPECT_CALL(*mock_plugin_impl.get(), LoadExeNetworkImpl(_, _)).Times(threadsNumber).WillRepeatedly(
+            InvokeWithoutArgs([&]() -> shared_ptr<ExecutableNetworkInternal> {
+                return exeNetworksInternal[loaded++];
+            }));
+
+    vector<IExecutableNetwork::Ptr> exeNetworks(threadsNumber);
+    vector<StatusCode> statuses(threadsNumber, GENERAL_ERROR);
+    vector<thread> threads;
+    for (size_t i = 0; i < threadsNumber; i++) {
+        threads.emplace_back([&, i]() {
+            statuses[i] = plugin->LoadNetwork(exeNetworks[i], mockNotEmptyNet, {}, nullptr);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < threadsNumber; i++) {
+        ASSERT_EQ(OK, statuses[i]);
+        ASSERT_NE(nullptr, exeNetworks[i]);
+    }
+    ASSERT_EQ(threadsNumber, loaded);
+}
+
+TEST_F(InferenceEnginePluginInternalTest, sharedLoadsOfSameNetworkAndConfigShareExeNetwork) {
+    map<string, string> config = {{PluginConfigParams::KEY_SHARE_EXECUTABLE_NETWORK, PluginConfigParams::YES},
+                                  {"SOME_KEY", "1"}};
+    // the key of the sharing is not passed to the plugin
+    map<string, string> pluginConfig = {{"SOME_KEY", "1"}};
+    EXPECT_CALL(*mockExeNetworkInternal.get(), setNetworkInputs(_)).Times(1);
+    EXPECT_CALL(*mockExeNetworkInternal.get(), setNetworkOutputs(_)).Times(1);
+    EXPECT_CALL(*mock_plugin_impl.get(), LoadExeNetworkImpl(Ref(mockNotEmptyNet), Eq(pluginConfig))).WillOnce(
+            Return(mockExeNetworkInternal));
+
+    IExecutableNetwork::Ptr first, second;
+    ASSERT_EQ(OK, plugin->LoadNetwork(first, mockNotEmptyNet, config, &dsc)) << dsc.msg;
+    ASSERT_EQ(OK, plugin->LoadNetwork(second, mockNotEmptyNet, config, &dsc)) << dsc.msg;
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_NE(first, second);
+}
+
+TEST_F(InferenceEnginePluginInternalTest, sharedLoadsWithDifferentConfigsLoadNetworkAgain) {
+    auto loaded = make_shared<MockExecutableNetworkInternal>();
+    EXPECT_CALL(*mock_plugin_impl.get(), LoadExeNetworkImpl(_, _)).Times(3)
+            .WillOnce(Return(mockExeNetworkInternal))
+            .WillRepeatedly(Return(loaded));
+
+    IExecutableNetwork::Ptr first, second, notShared;
+    ASSERT_EQ(OK, plugin->LoadNetwork(first, mockNotEmptyNet, {
+            {PluginConfigParams::KEY_SHARE_EXECUTABLE_NETWORK, PluginConfigParams::YES}, {"SOME_KEY", "1"}}, &dsc));
+    ASSERT_EQ(OK, plugin->LoadNetwork(second, mockNotEmptyNet, {
+            {PluginConfigParams::KEY_SHARE_EXECUTABLE_NETWORK, PluginConfigParams::YES}, {"SOME_KEY", "2"}}, &dsc));
+    ASSERT_EQ(OK, plugin->LoadNetwork(notShared, mockNotEmptyNet, {{"SOME_KEY", "1"}}, &dsc));
+}
+
+TEST_F(InferenceEnginePluginInternalTest, sharedLoadsWithDifferentPluginConfigsLoadNetworkAgain) {
+    const map<string, string> config = {{PluginConfigParams::KEY_SHARE_EXECUTABLE_NETWORK, PluginConfigParams::YES}};
+    auto loaded = make_shared<MockExecutableNetworkInternal>();
+    EXPECT_CALL(*mock_plugin_impl.get(), LoadExeNetworkImpl(_, _)).Times(2)
+            .WillOnce(Return(mockExeNetworkInternal))
+            .WillOnce(Return(loaded));
+
+    IExecutableNetwork::Ptr first, second;
+    mock_plugin_impl->setPluginConfig({{"SOME_KEY", "1"}});
+    ASSERT_EQ(OK, plugin->LoadNetwork(first, mockNotEmptyNet, config, &dsc)) << dsc.msg;
+    mock_plugin_impl->setPluginConfig({{"SOME_KEY", "2"}});
+    ASSERT_EQ(OK, plugin->LoadNetwork(second, mockNotEmptyNet, config, &dsc)) << dsc.msg;
+}
+
+TEST_F(InferenceEnginePluginInternalTest, sharedNetworkIsLoadedAgainAfterRelease) {
+    const map<string, string> config = {{PluginConfigParams::KEY_SHARE_EXECUTABLE_NETWORK, PluginConfigParams::YES}};
+    EXPECT_CALL(*mock_plugin_impl.get(), LoadExeNetworkImpl(_, _)).Times(2).WillRepeatedly(
+            InvokeWithoutArgs([]() -> shared_ptr<ExecutableNetworkInternal> {
+                return make_shared<NiceMock<MockExecutableNetworkInternal>>();
+            }));
+
+    IExecutableNetwork::Ptr exeNetwork;
+    ASSERT_EQ(OK, plugin->LoadNetwork(exeNetwork, mockNotEmptyNet, config, &dsc)) << dsc.msg;
+    exeNetwork.reset();
+    ASSERT_EQ(OK, plugin->LoadNetwork(exeNetwork, mockNotEmptyNet, config, &dsc)) << dsc.msg;
+}
+
+TEST_F(InferenceEnginePluginInternalTest, wrongValueOfSharingFailsLoad) {
+    IExecutableNetwork::Ptr exeNetwork;
+    EXPECT_CALL(*mock_plugin_impl.get(), LoadExeNetworkImpl(_, _)).Times(0);
+    ASSERT_NE(OK, plugin->LoadNetwork(exeNetwork, mockNotEmptyNet,
+                                      {{PluginConfigParams::KEY_SHARE_EXECUTABLE_NETWORK, "MAYBE"}}, &dsc));
+}
+
 TEST_F(InferenceEnginePluginInternalTest, failToSetBlobWithInCorrectName) {
     Blob::Ptr inBlob = make_shared_blob<float>(Precision::FP32, NCHW, {});
     inBlob->allocate();
@@ -7,6 +7,9 @@
 #include <gmock/gmock-spec-builders.h>
 #include <cpp_interfaces/ie_task_executor.hpp>
 #include <ie_common.h>
+#include <chrono>
+#include <future>
+#include <thread>
 #include "task_tests_utils.hpp"
 
 using namespace ::testing;
@@ -20,6 +23,41 @@ TEST_F(TaskExecutorTests, canCreateTaskExecutor) {
     EXPECT_NO_THROW(std::make_shared<TaskExecutor>());
 }
 
+TEST_F(TaskExecutorTests, metricsReportQueueDepthAndBusyTime) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> started;
+    auto blocking = std::make_shared<Task>([&]() {
+        started.set_value();
+        released.wait();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+    auto queued = std::make_shared<Task>();
+    taskExecutor->startTask(blocking);
+    taskExecutor->startTask(queued);
+    started.get_future().wait();
+
+    ExecutorMetrics running = taskExecutor->getMetrics();
+    ASSERT_EQ(1, running.workers);
+    ASSERT_EQ(1, running.runningTasks);
+    ASSERT_EQ(1, running.queueDepth);
+    ASSERT_EQ(0, running.completedTasks);
+
+    release.set_value();
+    ASSERT_EQ(Task::Status::TS_DONE, blocking->wait(-1));
+    ASSERT_EQ(Task::Status::TS_DONE, queued->wait(-1));
+    // the task is done before the worker marks its end
+    ExecutorMetrics done;
+    do {
+        done = taskExecutor->getMetrics();
+    } while (done.completedTasks < 2);
+    ASSERT_EQ(0, done.runningTasks);
+    ASSERT_EQ(0, done.queueDepth);
+    ASSERT_GE(done.busy_uSec, 2000);
+    ASSERT_GE(done.idle_uSec, 0);
+}
+
 TEST_F(TaskExecutorTests, canCatchException) {
     auto taskExecutor = std::make_shared<TaskExecutor>();
     auto task = std::make_shared<Task>([]() {
@@ -6,6 +6,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
 #include <thread>
+#include <atomic>
+#include <chrono>
 
 #include <ie_common.h>
 #include <details/ie_exception.hpp>
@@ -80,3 +82,27 @@ TEST_F(TaskTests, canSyncNThreadsUsingTaskSync) {
     for (auto &status : statuses) ASSERT_NE(Task::Status::TS_BUSY, status);
     ASSERT_EQ(sharedVar, THREAD_NUMBER * NUM_INTERNAL_ITERATIONS);
 }
+
+TEST_F(TaskTests, canWaitWithSpinTime) {
+    std::atomic<bool> release(false);
+    auto task = std::make_shared<Task>([&release]() {
+        while (!release) std::this_thread::yield();
+    });
+    task->setWaitSpinTime(std::chrono::microseconds(1000));
+    ASSERT_TRUE(task->occupy());
+    std::thread worker([&task]() { task->runNoThrowNoBusyCheck(); });
+    // the task is completed either during the active waiting or after the waiting thread is parked
+    std::thread releaser([&release]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        release = true;
+    });
+    ASSERT_EQ(Task::TS_DONE, task->wait(-1));
+    worker.join();
+    releaser.join();
+}
+
+TEST_F(TaskTests, occupyReturnsFalseForBusyTask) {
+    ASSERT_TRUE(_task->occupy());
+    ASSERT_FALSE(_task->occupy());
+    ASSERT_EQ(Task::TS_BUSY, _task->getStatus());
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <cpp_interfaces/ie_executor_manager.hpp>
+#include <cpp_interfaces/ie_task_executor.hpp>
+#include <cpp_interfaces/ie_work_stealing_task_executor.hpp>
+#include <cpp_interfaces/ie_thread_affinity.hpp>
+
+#if !(defined(__APPLE__) || defined(_WIN32))
+#include <sched.h>
+#endif
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+TEST(ThreadAffinityTests, cpuListIsParsed) {
+    ASSERT_EQ(std::vector<int>({0, 1, 2, 3, 8, 10, 11}), parseCpuList("KEY", "0-3,8,10-11"));
+    for (const char *value : {"", "a", "1,", "3-1", "1-2-3", "-1", "0,0", "1-", "2x"}) {
+        ASSERT_THROW(parseCpuList("KEY", value), InferenceEngineException) << "value = \"" << value << "\"";
+    }
+}
+
+TEST(ThreadAffinityTests, priorityIsParsed) {
+    ASSERT_EQ(-2, parseThreadsPriority("KEY", "-2"));
+    ASSERT_EQ(1, parseThreadsPriority("KEY", "1"));
+    for (const char *value : {"", "3", "-3", "low", "1x"}) {
+        ASSERT_THROW(parseThreadsPriority("KEY", value), InferenceEngineException) << "value = \"" << value << "\"";
+    }
+}
+
+TEST(ThreadAffinityTests, wrongConfigThrows) {
+    TaskExecutorConfig config;
+    config.priority = 3;
+    ASSERT_THROW(std::make_shared<TaskExecutor>("Test", config), InferenceEngineException);
+
+    config.priority = 0;
+    config.cpus = {-1};
+    ASSERT_THROW(std::make_shared<WorkStealingTaskExecutor>(2, "Test", config), InferenceEngineException);
+}
+
+#if !(defined(__APPLE__) || defined(_WIN32))
+TEST(ThreadAffinityTests, executorThreadsAreBound) {
+    // the first processor available to the process
+    cpu_set_t available;
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(available), &available));
+    int first = 0;
+    while (!CPU_ISSET(first, &available))
+        first++;
+
+    TaskExecutorConfig config;
+    config.cpus = {first};
+    config.priority = -1;
+
+    std::vector<ITaskExecutor::Ptr> executors = {std::make_shared<TaskExecutor>("Test", config),
+                                                 std::make_shared<WorkStealingTaskExecutor>(2, "Test", config)};
+    for (auto &executor : executors) {
+        int cpus = 0;
+        bool bound = false;
+        auto task = std::make_shared<Task>([&]() {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+                cpus = CPU_COUNT(&set);
+                bound = CPU_ISSET(first, &set);
+            }
+        });
+        executor->startTask(task);
+        ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+        ASSERT_EQ(1, cpus);
+        ASSERT_TRUE(bound);
+    }
+}
+#endif
+
+TEST(ThreadAffinityTests, managerCreatesExecutorOfConfig) {
+    ExecutorManagerImpl manager;
+    TaskExecutorConfig config;
+    config.priority = -1;
+    auto executor = manager.getExecutor("placed", 1, config);
+    ASSERT_NE(nullptr, std::dynamic_pointer_cast<TaskExecutor>(executor));
+    // the first request defines the executor
+    ASSERT_EQ(executor, manager.getExecutor("placed"));
+    ASSERT_EQ(1, manager.getExecutorsNumber());
+}
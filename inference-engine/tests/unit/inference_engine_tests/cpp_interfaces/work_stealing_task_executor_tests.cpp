@@ -0,0 +1,136 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include <cpp_interfaces/ie_work_stealing_task_executor.hpp>
+#include <cpp_interfaces/ie_executor_manager.hpp>
+#include <ie_common.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <vector>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class WorkStealingTaskExecutorTests : public ::testing::Test {};
+
+TEST_F(WorkStealingTaskExecutorTests, canCreateTaskExecutorWithZeroWorkers) {
+    WorkStealingTaskExecutor::Ptr taskExecutor;
+    ASSERT_NO_THROW(taskExecutor = std::make_shared<WorkStealingTaskExecutor>(0));
+    ASSERT_EQ(1, taskExecutor->getWorkersNumber());
+}
+
+TEST_F(WorkStealingTaskExecutorTests, metricsAreSummedOverWorkers) {
+    const size_t workers = 2;
+    auto taskExecutor = std::make_shared<WorkStealingTaskExecutor>(workers);
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 4; i++) {
+        tasks.push_back(std::make_shared<Task>([]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }));
+        taskExecutor->startTask(tasks.back());
+    }
+    for (auto &task : tasks) {
+        ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+    }
+    // the task is done before the worker marks its end
+    ExecutorMetrics metrics;
+    do {
+        metrics = taskExecutor->getMetrics();
+    } while (metrics.completedTasks < tasks.size());
+
+    ASSERT_EQ(workers, metrics.workers);
+    ASSERT_EQ(0, metrics.queueDepth);
+    ASSERT_EQ(0, metrics.runningTasks);
+    ASSERT_GE(metrics.busy_uSec, 4000);
+}
+
+TEST_F(WorkStealingTaskExecutorTests, canCatchException) {
+    auto taskExecutor = std::make_shared<WorkStealingTaskExecutor>(2);
+    auto task = std::make_shared<Task>([]() {
+        THROW_IE_EXCEPTION;
+    });
+    taskExecutor->startTask(task);
+    auto status = task->wait(-1);
+    ASSERT_EQ(status, Task::Status::TS_ERROR);
+    EXPECT_THROW(task->checkException(), InferenceEngineException);
+}
+
+TEST_F(WorkStealingTaskExecutorTests, canNotStartBusyTask) {
+    auto taskExecutor = std::make_shared<WorkStealingTaskExecutor>(2);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto task = std::make_shared<Task>([released]() { released.wait(); });
+    ASSERT_TRUE(taskExecutor->startTask(task));
+    ASSERT_FALSE(taskExecutor->startTask(task));
+    release.set_value();
+    ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+}
+
+TEST_F(WorkStealingTaskExecutorTests, canRunTasksConcurrently) {
+    auto taskExecutor = std::make_shared<WorkStealingTaskExecutor>(2);
+    std::promise<void> first, second;
+    auto firstStarted = first.get_future().share();
+    auto secondStarted = second.get_future().share();
+    // every task waits for the other one, so they complete only if they run at the same time
+    auto task1 = std::make_shared<Task>([&first, secondStarted]() {
+        first.set_value();
+        if (secondStarted.wait_for(std::chrono::seconds(10)) != std::future_status::ready) THROW_IE_EXCEPTION;
+    });
+    auto task2 = std::make_shared<Task>([&second, firstStarted]() {
+        second.set_value();
+        if (firstStarted.wait_for(std::chrono::seconds(10)) != std::future_status::ready) THROW_IE_EXCEPTION;
+    });
+    taskExecutor->startTask(task1);
+    taskExecutor->startTask(task2);
+    ASSERT_EQ(Task::Status::TS_DONE, task1->wait(-1));
+    ASSERT_EQ(Task::Status::TS_DONE, task2->wait(-1));
+}
+
+TEST_F(WorkStealingTaskExecutorTests, canStealTasksStartedFromWorker) {
+    auto taskExecutor = std::make_shared<WorkStealingTaskExecutor>(2);
+    std::promise<void> stolen;
+    auto stolenDone = stolen.get_future().share();
+    auto child = std::make_shared<Task>([&stolen]() { stolen.set_value(); });
+    // the child goes to the deque of the busy worker and can be finished only by the other one
+    auto parent = std::make_shared<Task>([&taskExecutor, &child, stolenDone]() {
+        taskExecutor->startTask(child);
+        if (stolenDone.wait_for(std::chrono::seconds(10)) != std::future_status::ready) THROW_IE_EXCEPTION;
+    });
+    taskExecutor->startTask(parent);
+    ASSERT_EQ(Task::Status::TS_DONE, parent->wait(-1));
+    ASSERT_EQ(Task::Status::TS_DONE, child->wait(-1));
+}
+
+TEST_F(WorkStealingTaskExecutorTests, destructorWaitsForAllTasks) {
+    std::atomic<int> counter(0);
+    std::vector<Task::Ptr> tasks;
+    {
+        WorkStealingTaskExecutor taskExecutor(3);
+        for (int i = 0; i < 100; i++) {
+            tasks.push_back(std::make_shared<Task>([&counter]() { counter++; }));
+            taskExecutor.startTask(tasks.back());
+        }
+    }
+    ASSERT_EQ(100, counter);
+    for (auto &task : tasks) {
+        ASSERT_EQ(Task::Status::TS_DONE, task->getStatus());
+    }
+}
+
+TEST_F(WorkStealingTaskExecutorTests, executorManagerCreatesPoolForSeveralWorkers) {
+    ExecutorManagerImpl manager;
+    auto pool = manager.getExecutor("pool", 4);
+    auto single = manager.getExecutor("single", 1);
+
+    ASSERT_NE(nullptr, std::dynamic_pointer_cast<WorkStealingTaskExecutor>(pool));
+    ASSERT_EQ(nullptr, std::dynamic_pointer_cast<WorkStealingTaskExecutor>(single));
+    ASSERT_EQ(pool, manager.getExecutor("pool"));
+    ASSERT_EQ(2, manager.getExecutorsNumber());
+}
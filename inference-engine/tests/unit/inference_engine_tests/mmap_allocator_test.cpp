@@ -0,0 +1,136 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <mmap_allocator.hpp>
+#include <file_utils.h>
+#include <cnn_network_impl.hpp>
+#include <ie_util_internal.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class MmapAllocatorTests: public ::testing::Test {
+protected:
+    virtual void TearDown() {
+        std::remove(fileName.c_str());
+    }
+
+    virtual void SetUp() {
+        content.resize(10000);
+        for (size_t i = 0; i < content.size(); i++)
+            content[i] = static_cast<char>(i % 251);
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(content.data(), content.size());
+    }
+
+    std::string fileName = "mmap_allocator_test.bin";
+    std::vector<char> content;
+};
+
+TEST_F(MmapAllocatorTests, canMapTheContentOfFile) {
+    auto allocator = details::shared_from_irelease(new MmapAllocator(fileName));
+    void *handle = allocator->alloc(content.size());
+    ASSERT_NE(nullptr, handle);
+    char *ptr = reinterpret_cast<char *>(allocator->lock(handle));
+    for (size_t i = 0; i < content.size(); i++)
+        ASSERT_EQ(content[i], ptr[i]);
+    ASSERT_TRUE(allocator->free(handle));
+}
+
+TEST_F(MmapAllocatorTests, writeDoesNotChangeTheFile) {
+    auto allocator = details::shared_from_irelease(new MmapAllocator(fileName));
+    void *handle = allocator->alloc(content.size());
+    ASSERT_NE(nullptr, handle);
+    char *ptr = reinterpret_cast<char *>(allocator->lock(handle));
+    ptr[9999] = 11;
+    ASSERT_EQ(11, ptr[9999]);
+    ASSERT_TRUE(allocator->free(handle));
+
+    std::vector<char> fromFile(content.size());
+    FileUtils::readAllFile(fileName, fromFile.data(), fromFile.size());
+    ASSERT_EQ(content, fromFile);
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMoreThanFileSize) {
+    auto allocator = details::shared_from_irelease(new MmapAllocator(fileName));
+    ASSERT_EQ(nullptr, allocator->alloc(content.size() + 1));
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMissingFile) {
+    auto allocator = details::shared_from_irelease(new MmapAllocator("missing_file.bin"));
+    ASSERT_EQ(nullptr, allocator->alloc(1));
+}
+
+TEST_F(MmapAllocatorTests, segmentIsReadOnFirstLock) {
+    auto allocator = details::shared_from_irelease(new FileSegmentAllocator(fileName, 1000));
+    void *handle = allocator->alloc(500);
+    ASSERT_NE(nullptr, handle);
+
+    // the file is changed before the first lock, so the segment is not read by alloc
+    content[1000] = 42;
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(content.data(), content.size());
+    }
+
+    const char *ptr = reinterpret_cast<const char *>(allocator->lock(handle, LOCK_FOR_READ));
+    ASSERT_NE(nullptr, ptr);
+    for (size_t i = 0; i < 500; i++)
+        ASSERT_EQ(content[1000 + i], ptr[i]);
+    ASSERT_EQ(ptr, allocator->lock(handle, LOCK_FOR_READ));
+    ASSERT_TRUE(allocator->free(handle));
+}
+
+TEST_F(MmapAllocatorTests, segmentBeyondFileIsNotRead) {
+    auto allocator = details::shared_from_irelease(new FileSegmentAllocator(fileName, 9900));
+    void *handle = allocator->alloc(200);
+    ASSERT_NE(nullptr, handle);
+    ASSERT_EQ(nullptr, allocator->lock(handle));
+}
+
+TEST_F(MmapAllocatorTests, failedReadOfSegmentIsReported) {
+    auto allocator = details::shared_from_irelease(new FileSegmentAllocator(fileName, 9900));
+    void *handle = allocator->alloc(200);
+    ASSERT_NE(nullptr, handle);
+    ASSERT_TRUE(allocator->getError().empty());
+    ASSERT_EQ(nullptr, allocator->lock(handle));
+    ASSERT_NE(std::string::npos, allocator->getError().find(fileName));
+}
+
+TEST_F(MmapAllocatorTests, checkOfNetworkReportsFailedReadOfWeights) {
+    CNNLayerPtr inputLayer(new CNNLayer({"data", "Input", Precision::FP32}));
+    CNNLayerPtr layer(new CNNLayer({"conv", "Convolution", Precision::FP32}));
+    layer->blobs["weights"].reset(new FileSegmentBlob<uint8_t>(Precision::U8, Layout::C, {200}, fileName, 9900));
+    layer->blobs["weights"]->allocate();
+
+    DataPtr data(new Data("data", {1, 3, 4, 4}, Precision::FP32, Layout::NCHW));
+    data->creatorLayer = inputLayer;
+    data->inputTo[layer->name] = layer;
+    inputLayer->outData.push_back(data);
+    layer->insData.push_back(data);
+    InputInfo::Ptr input(new InputInfo());
+    input->setInputData(data);
+
+    details::CNNNetworkImpl network;
+    network.addLayer(inputLayer);
+    network.addLayer(layer);
+    network.setInputInfo(input);
+
+    try {
+        checkNetworkBlobs(network);
+        FAIL() << "the failed read is not reported";
+    } catch (const details::InferenceEngineException &ex) {
+        ASSERT_NE(std::string::npos, std::string(ex.what()).find("conv"));
+        ASSERT_NE(std::string::npos, std::string(ex.what()).find(fileName));
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_parallel.hpp>
+#include <atomic>
+#include <vector>
+
+using namespace InferenceEngine;
+
+class ParallelTests : public ::testing::Test {};
+
+TEST_F(ParallelTests, splitterCoversTheRangeWithoutOverlaps) {
+    const size_t n = 17;
+    for (int team = 1; team <= 20; team++) {
+        size_t expected_start = 0;
+        for (int tid = 0; tid < team; tid++) {
+            size_t start = 0, end = 0;
+            splitter(n, team, tid, start, end);
+            ASSERT_EQ(expected_start, start);
+            ASSERT_LE(start, end);
+            ASSERT_LE(end - start, (n + team - 1) / team);
+            expected_start = end;
+        }
+        ASSERT_EQ(n, expected_start);
+    }
+}
+
+TEST_F(ParallelTests, parallelForVisitsEveryIndexOnce) {
+    const int D0 = 7, D1 = 5, D2 = 3, D3 = 2;
+    std::vector<std::atomic<int>> visits(D0 * D1 * D2 * D3);
+    for (auto &v : visits) v = 0;
+
+    parallel_for(D0 * D1 * D2 * D3, [&](int i) {
+        visits[i]++;
+    });
+    parallel_for2d(D0 * D1, D2 * D3, [&](int i, int j) {
+        visits[i * D2 * D3 + j]++;
+    });
+    parallel_for3d(D0, D1, D2 * D3, [&](int i, int j, int k) {
+        visits[(i * D1 + j) * D2 * D3 + k]++;
+    });
+    parallel_for4d(D0, D1, D2, D3, [&](int i, int j, int k, int l) {
+        visits[((i * D1 + j) * D2 + k) * D3 + l]++;
+    });
+
+    for (auto &v : visits)
+        ASSERT_EQ(4, v);
+}
+
+TEST_F(ParallelTests, parallelForDoesNothingForEmptyRange) {
+    std::atomic<int> calls(0);
+    parallel_for(0, [&](int) { calls++; });
+    parallel_for2d(3, 0, [&](int, int) { calls++; });
+    parallel_for3d(0, 3, 3, [&](int, int, int) { calls++; });
+    ASSERT_EQ(0, calls);
+}
+
+TEST_F(ParallelTests, parallelSumAddsToInitialValue) {
+    ASSERT_DOUBLE_EQ(1.0 + 999 * 1000 / 2, parallel_sum(1000, 1.0, [](int i) -> double { return i; }));
+    ASSERT_EQ(10 * 20, parallel_sum2d(10, 20, 0, [](int, int) -> int { return 1; }));
+}
+
+TEST_F(ParallelTests, threadNumIsLessThanMaxThreads) {
+    std::atomic<bool> valid(true);
+    parallel_nt(0, [&](int ithr, int nthr) {
+        if (ithr < 0 || ithr >= nthr || parallel_get_thread_num() >= parallel_get_max_threads())
+            valid = false;
+    });
+    ASSERT_TRUE(valid);
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+
+#include <cstdint>
+#include <pooled_allocator.hpp>
+#include "ie_blob.h"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class PooledAllocatorTests: public ::testing::Test {};
+
+TEST_F(PooledAllocatorTests, sizeClassesWasteAtMostQuarterOfBlock) {
+    ASSERT_EQ(64, PooledMemoryAllocator::sizeClass(0));
+    ASSERT_EQ(64, PooledMemoryAllocator::sizeClass(64));
+    ASSERT_EQ(80, PooledMemoryAllocator::sizeClass(65));
+    ASSERT_EQ(128, PooledMemoryAllocator::sizeClass(128));
+    for (size_t size = 65; size < 100000; size += 997) {
+        size_t capacity = PooledMemoryAllocator::sizeClass(size);
+        ASSERT_GE(capacity, size);
+        ASSERT_LE(capacity - size, capacity / 4) << "size = " << size;
+    }
+}
+
+TEST_F(PooledAllocatorTests, blocksAreAlignedToCacheLine) {
+    auto allocator = details::shared_from_irelease(new PooledMemoryAllocator());
+    for (size_t size : {1, 100, 10000, 3 * 1024 * 1024}) {
+        void *handle = allocator->alloc(size);
+        ASSERT_NE(nullptr, handle);
+        char *ptr = static_cast<char *>(allocator->lock(handle));
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % PooledMemoryAllocator::alignment);
+        ptr[size - 1] = 11;
+        ASSERT_EQ(11, ptr[size - 1]);
+        allocator->unlock(handle);
+        ASSERT_TRUE(allocator->free(handle));
+    }
+}
+
+TEST_F(PooledAllocatorTests, freedBlockIsReusedBySameSizeClass) {
+    auto allocator = details::shared_from_irelease(new PooledMemoryAllocator(true));
+    void *handle = allocator->alloc(4 * 1024 * 1024);
+    ASSERT_TRUE(allocator->free(handle));
+    ASSERT_EQ(4 * 1024 * 1024, static_cast<PooledMemoryAllocator *>(allocator.get())->cachedBytes());
+
+    ASSERT_EQ(handle, allocator->alloc(4 * 1024 * 1024 - 100));
+    ASSERT_EQ(0, static_cast<PooledMemoryAllocator *>(allocator.get())->cachedBytes());
+    ASSERT_TRUE(allocator->free(handle));
+}
+
+TEST_F(PooledAllocatorTests, blocksOverLimitAreReleased) {
+    auto allocator = details::shared_from_irelease(new PooledMemoryAllocator(false, 1000));
+    void *small = allocator->alloc(512);
+    void *large = allocator->alloc(4096);
+    ASSERT_TRUE(allocator->free(small));
+    ASSERT_TRUE(allocator->free(large));
+    ASSERT_EQ(512, static_cast<PooledMemoryAllocator *>(allocator.get())->cachedBytes());
+}
+
+TEST_F(PooledAllocatorTests, blobsOfDestroyedRequestReuseMemory) {
+    std::shared_ptr<IAllocator> allocator = details::shared_from_irelease(CreatePooledAllocator(false));
+    TensorDesc desc(Precision::FP32, {1, 3, 32, 32}, Layout::NCHW);
+    void *data = nullptr;
+    {
+        auto blob = make_shared_blob<float>(desc, allocator);
+        blob->allocate();
+        data = blob->buffer();
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % PooledMemoryAllocator::alignment);
+    }
+    auto blob = make_shared_blob<float>(desc, allocator);
+    blob->allocate();
+    ASSERT_EQ(data, blob->buffer().as<void *>());
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "precision_utils.h"
+
+using namespace InferenceEngine;
+
+class PrecisionUtilsTests : public ::testing::Test {
+protected:
+    static uint32_t bits(float value) {
+        uint32_t u;
+        std::memcpy(&u, &value, sizeof(u));
+        return u;
+    }
+
+    static float fromBits(uint32_t u) {
+        float value;
+        std::memcpy(&value, &u, sizeof(value));
+        return value;
+    }
+};
+
+TEST_F(PrecisionUtilsTests, f16tof32ArraysMatchesScalarConversionOfAllValues) {
+    // the odd length leaves the tail to the scalar code
+    std::vector<ie_fp16> src(65536 + 3);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<ie_fp16>(i);
+    std::vector<float> dst(src.size());
+
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size(), 2.f, -1.f);
+
+    for (size_t i = 0; i < src.size(); i++) {
+        float ref = PrecisionUtils::f16tof32(src[i]) * 2.f - 1.f;
+        ASSERT_EQ(bits(ref), bits(dst[i])) << "f16 = 0x" << std::hex << (src[i] & 0xFFFF);
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16ArraysMatchesScalarConversion) {
+    std::vector<float> src = {0.f, -0.f, 1.f, -1.f, 0.5f, 65504.f, 65519.f, 65520.f, 1e10f, -1e10f,
+                              6.1e-5f, 3.1e-5f, 2.9e-5f, 1e-10f,
+                              std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                              std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::denorm_min()};
+    // the exponents of all the ranges with the rounding ties and the mantissas around them
+    for (uint32_t e = 90; e < 160; e++)
+        for (uint32_t m = 0; m < 64; m++)
+            src.push_back(fromBits((e << 23) | (m << 12) | (m & 1 ? 0x1000 - 1 : 0)));
+    src.push_back(1.f);
+    std::vector<ie_fp16> dst(src.size());
+    const float scale = 1.f, bias = 0.f;
+
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size(), scale, bias);
+
+    for (size_t i = 0; i < src.size(); i++)
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * scale + bias), dst[i]) << "f32 = 0x" << std::hex << bits(src[i]);
+}
+
+TEST_F(PrecisionUtilsTests, convertsLongArraysByChunks) {
+    const size_t size = 300 * 1000 + 7;
+    std::vector<float> src(size), back(size);
+    std::vector<ie_fp16> half(size);
+    for (size_t i = 0; i < size; i++)
+        src[i] = static_cast<float>(i % 2048);
+
+    PrecisionUtils::f32tof16Arrays(half.data(), src.data(), size, 0.5f, 0.f);
+    PrecisionUtils::f16tof32Arrays(back.data(), half.data(), size, 2.f, 0.f);
+
+    for (size_t i = 0; i < size; i++)
+        ASSERT_EQ(src[i], back[i]) << "i = " << i;
+}
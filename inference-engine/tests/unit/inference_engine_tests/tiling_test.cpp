@@ -0,0 +1,198 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <cpp/ie_cnn_net_reader.h>
+#include <ie_tiling.hpp>
+#include <mock_iasync_infer_request.hpp>
+#include <xml_net_builder.hpp>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class TilingInfoTests : public ::testing::Test {
+protected:
+    CNNNetwork read(const std::string &model) {
+        reader.ReadNetwork(model.data(), model.length());
+        auto weights = make_shared_blob<uint8_t>(Precision::U8, Layout::C, {4096});
+        weights->allocate();
+        reader.SetWeights(weights);
+        return reader.getNetwork();
+    }
+
+    static std::map<std::string, std::string> window(const std::string &kernel, const std::string &stride,
+                                                     const std::string &pad, const std::string &output) {
+        return {{"kernel-x", kernel}, {"kernel-y", kernel}, {"stride-x", stride}, {"stride-y", stride},
+                {"pad-x", pad}, {"pad-y", pad}, {"output", output}, {"group", "1"}};
+    }
+
+    CNNNetReader reader;
+};
+
+TEST_F(TilingInfoTests, haloIsReceptiveFieldAlignedToLargestStride) {
+    auto conv1 = window("3", "1", "1", "4");
+    auto conv2 = window("3", "2", "1", "4");
+    auto deconv = window("4", "2", "1", "3");
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Conv", {1, 3, 32, 32}, "FP32")
+            .addLayer("Convolution", "FP32", &conv1, {{{1, 3, 32, 32}}, {{1, 4, 32, 32}}}, 432, 16)
+            .addLayer("Convolution", "FP32", &conv2, {{{1, 4, 32, 32}}, {{1, 4, 16, 16}}}, 576, 16)
+            .addLayer("Deconvolution", "FP32", &deconv, {{{1, 4, 16, 16}}, {{1, 3, 32, 32}}}, 768, 12)
+            .addLayer("ReLU", "FP32", nullptr, {{{1, 3, 32, 32}}, {{1, 3, 32, 32}}})
+            .finish(false);
+
+    TilingInfo tiling = getTilingInfo(read(model));
+
+    // the convolutions reach 1 and 2 pixels, the deconvolution reaches one element of the stride 2
+    ASSERT_EQ(2, tiling.alignX);
+    ASSERT_EQ(2, tiling.alignY);
+    ASSERT_EQ(4, tiling.haloX);
+    ASSERT_EQ(4, tiling.haloY);
+}
+
+TEST_F(TilingInfoTests, haloIsComputedByAxis) {
+    std::map<std::string, std::string> conv = {{"kernel-x", "5"}, {"kernel-y", "1"}, {"stride-x", "1"},
+                                               {"stride-y", "1"}, {"pad-x", "2"}, {"pad-y", "0"},
+                                               {"output", "3"}, {"group", "1"}};
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Conv", {1, 3, 16, 16}, "FP32")
+            .addLayer("Convolution", "FP32", &conv, {{{1, 3, 16, 16}}, {{1, 3, 16, 16}}}, 180, 12)
+            .finish(false);
+
+    TilingInfo tiling = getTilingInfo(read(model));
+
+    ASSERT_EQ(2, tiling.haloX);
+    ASSERT_EQ(0, tiling.haloY);
+    ASSERT_EQ(1, tiling.alignX);
+    ASSERT_EQ(1, tiling.alignY);
+}
+
+TEST_F(TilingInfoTests, throwsForNotFullyConvolutionalNetwork) {
+    std::map<std::string, std::string> fc = {{"out-size", "10"}};
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("FC", {1, 3, 4, 4}, "FP32")
+            .addLayer("FullyConnected", "FP32", &fc, {{{1, 3, 4, 4}}, {{1, 10}}}, 1920, 40)
+            .finish(false);
+
+    ASSERT_THROW(getTilingInfo(read(model)), details::InferenceEngineException);
+}
+
+TEST(TileDimsTests, tileIsAlignedAndExtendedByHalo) {
+    TilingInfo tiling;
+    tiling.haloX = 4;
+    tiling.haloY = 2;
+    tiling.alignX = 4;
+    tiling.alignY = 2;
+
+    ASSERT_EQ(SizeVector({3, 5, 20, 20}), getTileDims(tiling, {1, 5, 100, 200}, 3, 15, 9));
+}
+
+// the scale of the output, the height and the width of the image and the number of the tiles in the batch
+using TiledInferParams = std::tuple<size_t, size_t, size_t, size_t>;
+
+class TiledInferTests : public ::testing::TestWithParam<TiledInferParams> {
+protected:
+    // the network of the tests: the sum of the pixels 3x3 with the zero padding upsampled by the scale,
+    // so its halo is 1
+    static void boxUpsample(const float *src, size_t N, size_t C, size_t H, size_t W, size_t scale, float *dst) {
+        for (size_t nc = 0; nc < N * C; nc++) {
+            for (size_t y = 0; y < H * scale; y++) {
+                for (size_t x = 0; x < W * scale; x++) {
+                    const int cy = static_cast<int>(y / scale), cx = static_cast<int>(x / scale);
+                    float sum = 0.0f;
+                    for (int iy = cy - 1; iy <= cy + 1; iy++) {
+                        for (int ix = cx - 1; ix <= cx + 1; ix++) {
+                            if (iy >= 0 && ix >= 0 && iy < static_cast<int>(H) && ix < static_cast<int>(W))
+                                sum += src[(nc * H + iy) * W + ix];
+                        }
+                    }
+                    dst[(nc * H * scale + y) * W * scale + x] = sum;
+                }
+            }
+        }
+    }
+
+    static Blob::Ptr makeBlob(const SizeVector &dims) {
+        Blob::Ptr blob = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, Layout::NCHW));
+        blob->allocate();
+        return blob;
+    }
+};
+
+TEST_P(TiledInferTests, stitchedOutputMatchesWholeImage) {
+    const size_t scale = std::get<0>(GetParam()), H = std::get<1>(GetParam()), W = std::get<2>(GetParam());
+    const size_t batch = std::get<3>(GetParam());
+    const size_t N = 2, C = 2;
+    TilingInfo tiling;
+    tiling.haloX = tiling.haloY = 1;
+
+    const SizeVector tileDims = getTileDims(tiling, {1, C, H, W}, batch, 6, 5);
+    Blob::Ptr tileInput = makeBlob(tileDims);
+    Blob::Ptr tileOutput = makeBlob({tileDims[0], C, tileDims[2] * scale, tileDims[3] * scale});
+    Blob::Ptr image = makeBlob({N, C, H, W});
+    Blob::Ptr result = makeBlob({N, C, H * scale, W * scale});
+    float *imageData = image->buffer().as<float *>();
+    for (size_t i = 0; i < image->size(); i++)
+        imageData[i] = static_cast<float>((i * 37) % 101) * 0.125f - 4.0f;
+    float *resultData = result->buffer().as<float *>();
+    std::fill(resultData, resultData + result->size(), -1000.0f);
+
+    auto request = std::make_shared<MockIInferRequest>();
+    EXPECT_CALL(*request, GetBlob(_, _, _)).WillRepeatedly(Invoke([&](const char *name, Blob::Ptr &blob,
+                                                                       ResponseDesc *) {
+        blob = std::string(name) == "input" ? tileInput : tileOutput;
+        return OK;
+    }));
+    size_t inferences = 0;
+    EXPECT_CALL(*request, Infer(_)).WillRepeatedly(Invoke([&](ResponseDesc *) {
+        boxUpsample(tileInput->cbuffer().as<const float *>(), tileDims[0], C, tileDims[2], tileDims[3], scale,
+                    tileOutput->buffer().as<float *>());
+        inferences++;
+        return OK;
+    }));
+
+    inferTiled(request, "input", image, "output", result, tiling);
+
+    std::vector<float> reference(result->size());
+    boxUpsample(imageData, N, C, H, W, scale, reference.data());
+    for (size_t i = 0; i < reference.size(); i++)
+        ASSERT_EQ(reference[i], resultData[i]) << "at " << i;
+
+    const size_t rows = H <= 8 ? 1 : (H - 8 + 5) / 6 + 1;
+    const size_t columns = W <= 7 ? 1 : (W - 7 + 4) / 5 + 1;
+    ASSERT_EQ((N * rows * columns + batch - 1) / batch, inferences);
+}
+
+TEST_P(TiledInferTests, throwsForWrongResult) {
+    const size_t scale = std::get<0>(GetParam()), H = std::get<1>(GetParam()), W = std::get<2>(GetParam());
+    TilingInfo tiling;
+    tiling.haloX = tiling.haloY = 1;
+    const SizeVector tileDims = getTileDims(tiling, {1, 1, H, W}, 1, 6, 5);
+    Blob::Ptr tileInput = makeBlob(tileDims);
+    Blob::Ptr tileOutput = makeBlob({1, 1, tileDims[2] * scale, tileDims[3] * scale});
+
+    auto request = std::make_shared<MockIInferRequest>();
+    EXPECT_CALL(*request, GetBlob(_, _, _)).WillRepeatedly(Invoke([&](const char *name, Blob::Ptr &blob,
+                                                                       ResponseDesc *) {
+        blob = std::string(name) == "input" ? tileInput : tileOutput;
+        return OK;
+    }));
+    EXPECT_CALL(*request, Infer(_)).Times(0);
+
+    ASSERT_THROW(inferTiled(request, "input", makeBlob({1, 1, H, W}), "output",
+                            makeBlob({1, 1, H * scale + 1, W * scale}), tiling), details::InferenceEngineException);
+}
+
+// the images fit a single tile, need several tiles and end with a part of a tile
+INSTANTIATE_TEST_CASE_P(
+        TestsTiledInfer, TiledInferTests,
+        ::testing::Values(
+                TiledInferParams(1, 5, 4, 1),
+                TiledInferParams(1, 20, 17, 1),
+                TiledInferParams(1, 37, 23, 3),
+                TiledInferParams(2, 14, 12, 2),
+                TiledInferParams(2, 37, 23, 4)));
@@ -0,0 +1,103 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <ie_profiling.hpp>
+#include <cpp_interfaces/ie_task.hpp>
+#include <cpp_interfaces/ie_task_executor.hpp>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class TraceCollectorTests : public ::testing::Test {
+protected:
+    std::string traceFile = "trace_collector_test.json";
+
+    void TearDown() override {
+        TraceCollector::stop();
+        std::remove(traceFile.c_str());
+    }
+
+    std::string readTrace() {
+        std::ifstream file(traceFile);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    static size_t count(const std::string &text, const std::string &pattern) {
+        size_t result = 0;
+        for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+            result++;
+        return result;
+    }
+};
+
+TEST_F(TraceCollectorTests, writesScopesOfAllThreads) {
+    ASSERT_TRUE(TraceCollector::start(traceFile));
+    ASSERT_TRUE(TraceCollector::isEnabled());
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([] {
+            // more than a chunk of the events of a thread
+            for (int i = 0; i < 1500; i++) {
+                IE_PROFILING_AUTO_SCOPE(TestScope)
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    TraceCollector::stop();
+
+    std::string trace = readTrace();
+    ASSERT_EQ('[', trace[0]);
+    ASSERT_EQ(4 * 1500, count(trace, "{\"name\":\"TestScope\",\"cat\":\"IE\",\"ph\":\"X\""));
+    ASSERT_EQ(4 * 1500, count(trace, "},\n"));
+}
+
+TEST_F(TraceCollectorTests, escapesNames) {
+    ASSERT_TRUE(TraceCollector::start(traceFile));
+    std::string name = "layer \"1\"\\a";
+    {
+        IE_TRACE_SCOPE(name);
+    }
+    TraceCollector::stop();
+
+    ASSERT_EQ(1, count(readTrace(), "\"name\":\"layer \\\"1\\\"\\\\a\""));
+}
+
+TEST_F(TraceCollectorTests, doesNotWriteAfterStop) {
+    ASSERT_TRUE(TraceCollector::start(traceFile));
+    TraceCollector::stop();
+    ASSERT_FALSE(TraceCollector::isEnabled());
+    {
+        IE_TRACE_SCOPE("Stopped");
+    }
+    TraceCollector::flush();
+
+    ASSERT_EQ(0, count(readTrace(), "Stopped"));
+}
+
+TEST_F(TraceCollectorTests, tracesWaitOfTaskInQueue) {
+    ASSERT_TRUE(TraceCollector::start(traceFile));
+    {
+        TaskExecutor executor("trace");
+        Task::Ptr task = std::make_shared<Task>([] {});
+        ASSERT_TRUE(executor.startTask(task));
+        task->wait(-1);
+    }
+    TraceCollector::stop();
+
+    std::string trace = readTrace();
+    ASSERT_EQ(1, count(trace, "\"name\":\"TaskQueueWait\""));
+    ASSERT_EQ(1, count(trace, "\"name\":\"TaskExecution\""));
+}
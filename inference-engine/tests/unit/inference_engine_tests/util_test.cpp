@@ -13,6 +13,7 @@
 #include <unordered_map>
 
 #include <ie_util_internal.hpp>
+#include <ie_graph_splitter.hpp>
 #include <tests_common.hpp>
 #include <graph_transformer.h>
 #include "ie_utils.hpp"
@@ -839,6 +840,63 @@ TEST(UtilTests, cloneNet_const) {
     ASSERT_EQ("custom_val3", getLayer(cloned, "input3")->params["custom_param3"]);
 }
 
+namespace {
+struct DerivedConvolutionLayer : public IE::ConvolutionLayer {
+    using IE::ConvolutionLayer::ConvolutionLayer;
+};
+}  // namespace
+
+TEST(UtilTests, cloneLayerOfUnlistedDerivedType) {
+    DerivedConvolutionLayer srcLayer(IE::LayerParams{"layer","Convolution",IE::Precision::FP32});
+    srcLayer._kernel_x = 3;
+    auto cloned = std::dynamic_pointer_cast<IE::ConvolutionLayer>(IE::clonelayer(srcLayer));
+    ASSERT_NE(nullptr, cloned);
+    EXPECT_EQ(3, cloned->_kernel_x);
+}
+
+TEST(UtilTests, cloneNet_longChain) {
+    //
+    // I-d0->L0->d1->L1-> ... ->Ln-1->dn->O
+    //
+    const size_t layersCount = 3000;
+    auto weights = std::make_shared<IE::TBlob<float>>(IE::Precision::FP32, IE::C, IE::SizeVector{16});
+    weights->allocate();
+
+    NetBuilder builder;
+    builder.data("data0",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW);
+    for (size_t i = 0; i < layersCount; i++) {
+        auto layerName = "layer" + std::to_string(i);
+        builder.data("data" + std::to_string(i + 1),IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .layer<IE::WeightableLayer>(IE::LayerParams{layerName,"dummy",IE::Precision::UNSPECIFIED})
+               .linkData("data" + std::to_string(i), "data" + std::to_string(i + 1), layerName);
+    }
+    auto net = builder.finalize();
+    for (auto&& layer : net->allLayers()) {
+        std::static_pointer_cast<IE::WeightableLayer>(layer.second)->_weights = weights;
+        layer.second->blobs["weights"] = weights;
+    }
+
+    auto cloned = IE::cloneNet(*net);
+
+    ASSERT_EQ(layersCount + 1, cloned->layerCount());
+    IE::OutputsDataMap outputs;
+    cloned->getOutputsInfo(outputs);
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_TRUE(IE::contains(outputs, "data" + std::to_string(layersCount)));
+
+    size_t visited = 0;
+    IE::traverse::traverse(static_cast<IE::ICNNNetwork&>(*cloned), [&](IE::CNNLayerPtr& layer) {
+        auto srcLayer = getLayer(net, layer->name.c_str());
+        ASSERT_NE(nullptr, srcLayer);
+        EXPECT_NE(srcLayer, layer);
+        // the weights are shared with the source network
+        EXPECT_EQ(weights, layer->blobs["weights"]);
+        EXPECT_EQ(weights, std::dynamic_pointer_cast<IE::WeightableLayer>(layer)->_weights);
+        visited++;
+    });
+    EXPECT_EQ(layersCount, visited);
+}
+
 TEST(UtilTests, getRootDataObjects) {
     //
     // I1-d1-L1-d7
@@ -1710,3 +1768,173 @@ TEST(UtilTests, replaceLayerWithNewLayer) {
                     layer3Check->insData[1].lock() == data.find("data3")->second);
     }
 }
+
+namespace {
+IE::GraphRewriter convReluRewriter() {
+    IE::GraphRewriter rewriter;
+    rewriter.addRule("ConvolutionReLU", {{"Convolution", nullptr}, {"relu", nullptr}},
+                     [](const std::vector<IE::CNNLayerPtr>& chain) {
+        return std::make_shared<IE::CNNLayer>(IE::LayerParams{chain[0]->name, "ConvolutionReLU",
+                                                              IE::Precision::UNSPECIFIED});
+    });
+    return rewriter;
+}
+}  // namespace
+
+TEST(UtilTests, graphRewriterReplacesChain) {
+    //
+    // I->conv->relu->L3->O
+    //
+    NetBuilder netBuilder;
+    auto net = netBuilder
+               .data("data1", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data2", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data3", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data4", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .layer<IE::CNNLayer>(IE::LayerParams{"conv", "Convolution", IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"relu", "ReLU", IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer3", "dummy", IE::Precision::UNSPECIFIED})
+               .linkData("data1", "data2", "conv")
+               .linkData("data2", "data3", "relu")
+               .linkData("data3", "data4", "layer3")
+               .finalize();
+    const auto& data = netBuilder.getDataMap();
+
+    ASSERT_EQ(1, convReluRewriter().run(*net));
+
+    ASSERT_EQ(2, net->layerCount());
+    IE::CNNLayerPtr fused;
+    ASSERT_EQ(IE::OK, net->getLayerByName("conv", fused, nullptr));
+    ASSERT_EQ("ConvolutionReLU", fused->type);
+    IE::CNNLayerPtr relu;
+    ASSERT_NE(IE::OK, net->getLayerByName("relu", relu, nullptr));
+    ASSERT_EQ(1, fused->insData.size());
+    ASSERT_EQ(data.find("data1")->second, fused->insData[0].lock());
+    ASSERT_EQ(fused, data.find("data1")->second->getInputTo().at("conv"));
+    ASSERT_EQ(1, fused->outData.size());
+    ASSERT_EQ(data.find("data3")->second, fused->outData[0]);
+    ASSERT_EQ(fused, data.find("data3")->second->getCreatorLayer().lock());
+    ASSERT_EQ(nullptr, net->getData("data2"));
+}
+
+TEST(UtilTests, graphRewriterSkipsChainWithSharedData) {
+    //
+    // I->conv->relu->O
+    //       |
+    //       +->L3->O
+    //
+    NetBuilder netBuilder;
+    auto net = netBuilder
+               .data("data1", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data2", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data3", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data4", IE::SizeVector{1, 1, 1}, IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .layer<IE::CNNLayer>(IE::LayerParams{"conv", "Convolution", IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"relu", "ReLU", IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer3", "dummy", IE::Precision::UNSPECIFIED})
+               .linkData("data1", "data2", "conv")
+               .linkData("data2", "data3", "relu")
+               .linkData("data2", "data4", "layer3")
+               .finalize();
+
+    ASSERT_EQ(0, convReluRewriter().run(*net));
+    ASSERT_EQ(3, net->layerCount());
+}
+
+namespace {
+// the layers of the subgraph have the same affinity, and the inputs of the layers are produced by the same or the previous subgraphs
+void checkSubgraphsOrder(const std::vector<IE::LayersSet>& subgraphs) {
+    std::unordered_map<IE::CNNLayer*, size_t> layerSubgraphs;
+    for (size_t i = 0; i < subgraphs.size(); i++) {
+        ASSERT_FALSE(subgraphs[i].empty());
+        for (auto&& layer : subgraphs[i]) {
+            ASSERT_EQ((*subgraphs[i].begin())->affinity, layer->affinity);
+            layerSubgraphs[layer.get()] = i;
+        }
+    }
+    for (size_t i = 0; i < subgraphs.size(); i++) {
+        for (auto&& layer : subgraphs[i]) {
+            for (auto&& data : layer->insData) {
+                auto prevLayer = data.lock()->getCreatorLayer().lock();
+                if (nullptr != prevLayer) {
+                    ASSERT_LE(layerSubgraphs.at(prevLayer.get()), i) << layer->name;
+                }
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST(UtilTests, splitGraphMergesLayersOfSameAffinity) {
+    auto net = NetBuilder()
+               .data("data1",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data2",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data3",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data4",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer1","dummy",IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer2","dummy",IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer3","dummy",IE::Precision::UNSPECIFIED})
+               .linkData("data1","data2","layer1")
+               .linkData("data2","data3","layer2")
+               .linkData("data2","data4","layer3")
+               .finalize();
+    for (auto&& it : net->allLayers()) {
+        it.second->affinity = "CPU";
+    }
+
+    auto subgraphs = IE::splitGraph(*net, {"CPU"});
+    ASSERT_EQ(1, subgraphs.size());
+    ASSERT_EQ(3, subgraphs.front().size());
+}
+
+TEST(UtilTests, splitGraphDoesNotMakeCycles) {
+    //
+    // d1-L1(CPU)-d2-L2(GPU)-d3-L3(CPU)-d5
+    //             \             /
+    //              L4(CPU)---d4
+    //
+    // L1 and L4 or L4 and L3 can be merged, while all of them can't, as the subgraph would depend on L2
+    auto net = NetBuilder()
+               .data("data1",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data2",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data3",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data4",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data5",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer1","dummy",IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer2","dummy",IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer3","dummy",IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer4","dummy",IE::Precision::UNSPECIFIED})
+               .linkData("data1","data2","layer1")
+               .linkData("data2","data3","layer2")
+               .linkData("data2","data4","layer4")
+               .linkDataTo("data3","layer3")
+               .linkDataTo("data4","layer3")
+               .linkToData("layer3","data5")
+               .finalize();
+    auto& layers = net->allLayers();
+    layers.find("layer1")->second->affinity = "CPU";
+    layers.find("layer2")->second->affinity = "GPU";
+    layers.find("layer3")->second->affinity = "CPU";
+    layers.find("layer4")->second->affinity = "CPU";
+
+    auto subgraphs = IE::splitGraph(*net, {"GPU", "CPU"});
+    ASSERT_EQ(3, subgraphs.size());
+    checkSubgraphsOrder(subgraphs);
+
+    // the order of the subgraphs is kept by the sort
+    IE::sortSubgraphs(subgraphs);
+    ASSERT_EQ(3, subgraphs.size());
+    checkSubgraphsOrder(subgraphs);
+}
+
+TEST(UtilTests, splitGraphThrowsOnUnknownAffinity) {
+    auto net = NetBuilder()
+               .data("data1",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .data("data2",IE::SizeVector{1,1,1},IE::Precision::UNSPECIFIED, IE::Layout::CHW)
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer1","dummy",IE::Precision::UNSPECIFIED})
+               .linkData("data1","data2","layer1")
+               .finalize();
+    net->allLayers().find("layer1")->second->affinity = "FPGA";
+
+    ASSERT_THROW(IE::splitGraph(*net, {"CPU"}), IE::details::InferenceEngineException);
+}
@@ -39,6 +39,8 @@ public:
     MOCK_CONST_METHOD1(GetPerformanceCounts_ThreadUnsafe, void(std::map<std::string, InferenceEngineProfileInfo>
             &));
 
+    MOCK_CONST_METHOD1(GetTimings_ThreadUnsafe, void(InferRequestTimings &));
+
     MOCK_METHOD2(GetBlob_ThreadUnsafe, void(
             const char *name, Blob::Ptr
             &));
@@ -47,6 +49,15 @@ public:
             const char *name,
             const Blob::Ptr &));
 
+    MOCK_METHOD2(GetBlobByIndex_ThreadUnsafe, void(size_t index, Blob::Ptr &));
+    MOCK_METHOD2(SetRoiBlobs_ThreadUnsafe, void(const char *name, const std::vector<Blob::Ptr> &));
+    MOCK_METHOD1(SetSkippedOutputs_ThreadUnsafe, void(const std::vector<std::string> &));
+    MOCK_METHOD2(IsZeroCopyBlob_ThreadUnsafe, bool(const char *name, const Blob::Ptr &));
+    MOCK_METHOD0(Cancel, void());
+    MOCK_METHOD1(SetDeadline_ThreadUnsafe, void(int64_t));
+
+    MOCK_METHOD2(SetBlobByIndex_ThreadUnsafe, void(size_t index, const Blob::Ptr &));
+
     MOCK_METHOD1(SetCompletionCallback_ThreadUnsafe, void(IInferRequest::CompletionCallback));
 
 	MOCK_METHOD1(SetBatch, void(int));
@@ -21,5 +21,7 @@ public:
     using InferRequestInternal::SetBlob;
     using InferRequestInternal::GetBlob;
     MOCK_METHOD0(InferImpl, void());
+    MOCK_METHOD0(Preprocess, void());
+    MOCK_METHOD0(Postprocess, void());
     MOCK_CONST_METHOD1(GetPerformanceCounts, void(std::map<std::string, InferenceEngineProfileInfo> &));
 };
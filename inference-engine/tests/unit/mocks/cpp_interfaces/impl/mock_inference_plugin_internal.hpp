@@ -36,6 +36,10 @@ public:
     MOCK_METHOD2(Infer, void(const InferenceEngine::BlobMap &, InferenceEngine::BlobMap&));
     MOCK_METHOD1(AddExtension, void(InferenceEngine::IExtensionPtr ext_ptr));
     MOCK_METHOD1(SetConfig, void ( const std::map <std::string, std::string> &));
+
+    void setPluginConfig(const std::map<std::string, std::string> &config) {
+        _config = config;
+    }
 };
 
 class MockInferencePluginInternal3 : public InferenceEngine::InferencePluginInternal {
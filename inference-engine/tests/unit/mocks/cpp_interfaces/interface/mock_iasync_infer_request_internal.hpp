@@ -19,8 +19,16 @@ public:
     MOCK_METHOD1(SetUserData, void(void *));
     MOCK_METHOD0(Infer, void());
     MOCK_CONST_METHOD1(GetPerformanceCounts, void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &));
+    MOCK_CONST_METHOD1(GetTimings, void(InferenceEngine::InferRequestTimings &));
     MOCK_METHOD2(SetBlob, void(const char *name, const InferenceEngine::Blob::Ptr &));
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
+    MOCK_METHOD2(SetBlobByIndex, void(size_t index, const InferenceEngine::Blob::Ptr &));
+    MOCK_METHOD2(GetBlobByIndex, void(size_t index, InferenceEngine::Blob::Ptr &));
+    MOCK_METHOD2(SetRoiBlobs, void(const char *name, const std::vector<InferenceEngine::Blob::Ptr> &));
+    MOCK_METHOD1(SetSkippedOutputs, void(const std::vector<std::string> &));
+    MOCK_METHOD2(IsZeroCopyBlob, bool(const char *name, const InferenceEngine::Blob::Ptr &));
+    MOCK_METHOD0(Cancel, void());
+    MOCK_METHOD1(SetDeadline, void(int64_t));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
 	MOCK_METHOD1(SetBatch, void(int));
 };
@@ -29,4 +29,6 @@ public:
     MOCK_METHOD1(Export, void(const std::string &));
     MOCK_METHOD1(GetMappedTopology, void(std::map<std::string, std::vector<PrimitiveInfo::Ptr>> &));
     MOCK_METHOD0(QueryState, std::vector<IMemoryStateInternal::Ptr>());
+    MOCK_METHOD1(Reshape, void(const std::map<std::string, SizeVector> &));
+    MOCK_CONST_METHOD1(GetExecutorMetrics, void(std::map<std::string, ExecutorMetrics> &));
 };
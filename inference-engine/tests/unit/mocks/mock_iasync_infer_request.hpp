@@ -26,7 +26,15 @@ public:
     MOCK_QUALIFIED_METHOD1(Infer, noexcept, StatusCode(ResponseDesc*));
     MOCK_QUALIFIED_METHOD2(GetPerformanceCounts, const noexcept,
                            StatusCode(std::map<std::string, InferenceEngineProfileInfo> &perfMap, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(GetTimings, const noexcept, StatusCode(InferRequestTimings &, ResponseDesc*));
     MOCK_QUALIFIED_METHOD3(GetBlob, noexcept, StatusCode(const char*, Blob::Ptr&, ResponseDesc*));
     MOCK_QUALIFIED_METHOD3(SetBlob, noexcept, StatusCode(const char*, const Blob::Ptr&, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD3(GetBlobByIndex, noexcept, StatusCode(size_t, Blob::Ptr&, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD3(SetRoiBlobs, noexcept, StatusCode(const char*, const std::vector<Blob::Ptr>&, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(SetSkippedOutputs, noexcept, StatusCode(const std::vector<std::string>&, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD4(IsZeroCopyBlob, noexcept, StatusCode(const char*, const Blob::Ptr&, bool&, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD1(Cancel, noexcept, StatusCode(ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(SetDeadline, noexcept, StatusCode(int64_t, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD3(SetBlobByIndex, noexcept, StatusCode(size_t, const Blob::Ptr&, ResponseDesc*));
 	MOCK_QUALIFIED_METHOD2(SetBatch, noexcept, StatusCode(int batch, ResponseDesc*));
 };
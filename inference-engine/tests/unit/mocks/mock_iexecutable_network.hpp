@@ -23,4 +23,7 @@ public:
     MOCK_QUALIFIED_METHOD2(GetMappedTopology, noexcept, StatusCode(std::map<std::string, std::vector<PrimitiveInfo::Ptr>> &, ResponseDesc*));
     MOCK_QUALIFIED_METHOD0(Release, noexcept, void ());
     MOCK_QUALIFIED_METHOD3(QueryState, noexcept, StatusCode(IMemoryState::Ptr &, size_t  , ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(Reshape, noexcept, StatusCode(const std::map<std::string, SizeVector> &, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(GetExecutorMetrics, const noexcept,
+                           StatusCode(std::map<std::string, ExecutorMetrics> &, ResponseDesc*));
 };
@@ -138,6 +138,43 @@ TEST_F(ReshapeLauncherTest, canApplyChanges) {
     ASSERT_EQ(outDims, out0Data->getDims());
 }
 
+TEST_F(ReshapeLauncherTest, implIsNotCalledForKnownShapes) {
+    CNNLayer layer({});
+    layer.outData = {getNotEmptyData()};
+    layer.insData = {notEmptyData};
+    ReshapeLauncher launcher(&layer, impl);
+    SizeVector otherInDims{3};
+
+    EXPECT_CALL(*impl.get(), inferShapes(_, _, _, _, _)).Times(2).
+            WillRepeatedly(DoAll(
+            WithArg<3>(Invoke([&](std::vector<SizeVector>& outShape) { outShape.push_back(outDims); })), Return(OK)));
+    for (const auto& dims : {inDims, inDims, otherInDims, inDims, otherInDims}) {
+        launcher.reset();
+        launcher.setShapeByName(dims, TEST_NAME);
+        launcher.reshape({});
+        launcher.applyChanges(&layer);
+        ASSERT_EQ(dims, layer.insData[0].lock()->getDims());
+        ASSERT_EQ(outDims, layer.outData[0]->getDims());
+    }
+}
+
+TEST_F(ReshapeLauncherTest, implIsCalledAgainForChangedParams) {
+    CNNLayer layer({});
+    layer.outData = {getNotEmptyData()};
+    layer.insData = {notEmptyData};
+    ReshapeLauncher launcher(&layer, impl);
+
+    EXPECT_CALL(*impl.get(), inferShapes(_, _, _, _, _)).Times(2).
+            WillRepeatedly(DoAll(
+            WithArg<3>(Invoke([&](std::vector<SizeVector>& outShape) { outShape.push_back(outDims); })), Return(OK)));
+    launcher.setShapeByName(inDims, TEST_NAME);
+    launcher.reshape({});
+    layer.params = changedParams;
+    launcher.reset();
+    launcher.setShapeByName(inDims, TEST_NAME);
+    launcher.reshape({});
+}
+
 TEST_F(ReshapeLauncherTest, throwOnApplyingWithNotEnoughOutput) {
     CNNLayer layer({});
     layer.outData = {notEmptyData};
@@ -0,0 +1,304 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include <inference_engine.hpp>
+#include <hetero/hetero_plugin_config.hpp>
+#include <xml_net_builder.hpp>
+
+using namespace InferenceEngine;
+
+#ifdef ENABLE_STRESS_UNIT_TESTS
+namespace {
+
+const size_t kChannels = 16, kHeight = 32, kWidth = 32;
+const size_t kImageSize = kChannels * kHeight * kWidth;
+
+// the duration of the measurement of a point of the throughput
+const std::chrono::milliseconds kMeasureTime(1000);
+
+// the value of the element of the input, the requests of the different threads and iterations differ by the base
+float inputValue(float base, size_t i) {
+    return base + static_cast<float>(i % 256);
+}
+
+}  // namespace
+
+/**
+ * @brief The networks and the requests of the plugin of the device are inferred concurrently by several threads.
+ * The network computes 2 * x + 1, so the outputs of the requests are checked against their own inputs, the outputs
+ * mixed up by the requests sharing the executors or the graphs are caught by it.
+ * The devices not available in the environment are skipped.
+ */
+class AsyncStressTests : public ::testing::TestWithParam<std::string> {
+protected:
+    void SetUp() override {
+        try {
+            plugin = PluginDispatcher({"", "./", "./lib"}).getPluginByDevice(GetParam());
+            loaded = true;
+        } catch (const std::exception &ex) {
+            std::cout << "[ SKIPPED  ] the plugin of " << GetParam() << " is not available: " << ex.what() << std::endl;
+        }
+    }
+
+    bool available() const {
+        return loaded;
+    }
+
+    // the output of the flattened network is [1, batch * kImageSize], so it doesn't hold the batch
+    ExecutableNetwork load(const std::map<std::string, std::string> &config = {}, size_t batch = 1,
+                           bool flatten = false) {
+        std::map<std::string, std::string> params = {{"power", "1"}, {"scale", "2"}, {"shift", "1"}};
+        std::map<std::string, std::string> reshapeParams = {{"axis", "0"}, {"num_axes", "-1"},
+                                                            {"dim", "1," + std::to_string(batch * kImageSize)}};
+        const SizeVector dims = {batch, kChannels, kHeight, kWidth};
+        auto builder = testing::V2NetBuilder::buildNetworkWithOneInput("Power", dims, "FP32")
+                .addLayer("Power", "FP32", &params, {{dims}, {dims}});
+        if (flatten)
+            builder.addLayer("Reshape", "FP32", &reshapeParams, {{dims}, {{1, batch * kImageSize}}});
+        std::string model = builder.finish(false);
+        CNNNetReader reader;
+        reader.ReadNetwork(model.data(), model.length());
+        return plugin.LoadNetwork(reader.getNetwork(), config);
+    }
+
+    static void fill(InferRequest &request, const std::string &input, float base) {
+        auto blob = request.GetBlob(input);
+        float *data = blob->buffer().as<float *>();
+        for (size_t i = 0; i < blob->size(); i++)
+            data[i] = inputValue(base, i);
+    }
+
+    // the full check is done by the correctness tests, the throughput tests check the edges of the output only
+    static bool check(InferRequest &request, const std::string &output, float base, bool full = true) {
+        auto blob = request.GetBlob(output);
+        const float *data = blob->cbuffer().as<const float *>();
+        for (size_t i = 0; i < blob->size(); i += full ? 1 : kImageSize - 1) {
+            if (data[i] != 2.0f * inputValue(base, i) + 1.0f)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns the requests per second inferred by the threads, each of them keeps its requests in flight
+     */
+    double measureThroughput(ExecutableNetwork &network, size_t threadsNumber, size_t requestsPerThread) {
+        const std::string input = network.GetInputsInfo().begin()->first;
+        const std::string output = network.GetOutputsInfo().begin()->first;
+
+        std::atomic<size_t> inferred(0);
+        std::atomic<bool> failed(false);
+        std::atomic<bool> stop(false);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threadsNumber; t++) {
+            threads.emplace_back([&, t]() {
+                std::vector<InferRequest> requests;
+                for (size_t r = 0; r < requestsPerThread; r++) {
+                    requests.push_back(network.CreateInferRequest());
+                    fill(requests.back(), input, static_cast<float>(t * requestsPerThread + r));
+                }
+                while (!stop && !failed) {
+                    for (auto &request : requests)
+                        request.StartAsync();
+                    for (size_t r = 0; r < requests.size(); r++) {
+                        if (requests[r].Wait(IInferRequest::WaitMode::RESULT_READY) != OK ||
+                                !check(requests[r], output, static_cast<float>(t * requestsPerThread + r), false))
+                            failed = true;
+                    }
+                    inferred += requests.size();
+                }
+            });
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(kMeasureTime);
+        stop = true;
+        for (auto &thread : threads)
+            thread.join();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        EXPECT_FALSE(failed) << "the wrong output of " << threadsNumber << " threads with " << requestsPerThread
+                             << " requests each";
+        return static_cast<double>(inferred) / elapsed.count();
+    }
+
+    InferencePlugin plugin;
+    bool loaded = false;
+};
+
+TEST_P(AsyncStressTests, concurrentRequestsOfManyNetworksAreCorrect) {
+    if (!available()) return;
+
+    const size_t networksNumber = 4, threadsNumber = 8, requestsPerThread = 2, iterations = 50;
+    std::vector<ExecutableNetwork> networks;
+    for (size_t n = 0; n < networksNumber; n++)
+        networks.push_back(load());
+
+    std::atomic<size_t> callbacks(0);
+    std::atomic<size_t> failures(0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadsNumber; t++) {
+        threads.emplace_back([&, t]() {
+            // the threads share the networks, so the requests of a network are started by several threads
+            ExecutableNetwork &network = networks[t % networksNumber];
+            const std::string input = network.GetInputsInfo().begin()->first;
+            const std::string output = network.GetOutputsInfo().begin()->first;
+
+            std::vector<InferRequest> requests;
+            for (size_t r = 0; r < requestsPerThread; r++) {
+                requests.push_back(network.CreateInferRequest());
+                requests.back().SetCompletionCallback([&]() { callbacks++; });
+            }
+            for (size_t i = 0; i < iterations; i++) {
+                for (size_t r = 0; r < requests.size(); r++)
+                    fill(requests[r], input, static_cast<float>((t * requestsPerThread + r) * iterations + i));
+                for (auto &request : requests)
+                    request.StartAsync();
+                for (size_t r = 0; r < requests.size(); r++) {
+                    if (requests[r].Wait(IInferRequest::WaitMode::RESULT_READY) != OK ||
+                            !check(requests[r], output, static_cast<float>((t * requestsPerThread + r) * iterations + i)))
+                        failures++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    ASSERT_EQ(0, failures);
+    // the wait returns once the outputs are ready, the callbacks may be still running
+    const size_t expected = threadsNumber * requestsPerThread * iterations;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (callbacks < expected && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ASSERT_EQ(expected, callbacks);
+}
+
+TEST_P(AsyncStressTests, networksAreLoadedAndReleasedConcurrently) {
+    if (!available()) return;
+
+    const size_t threadsNumber = 4, rounds = 5;
+    std::atomic<size_t> failures(0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadsNumber; t++) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < rounds; i++) {
+                ExecutableNetwork network = load();
+                InferRequest request = network.CreateInferRequest();
+                const std::string input = network.GetInputsInfo().begin()->first;
+                const std::string output = network.GetOutputsInfo().begin()->first;
+                fill(request, input, static_cast<float>(t * rounds + i));
+                request.StartAsync();
+                if (request.Wait(IInferRequest::WaitMode::RESULT_READY) != OK ||
+                        !check(request, output, static_cast<float>(t * rounds + i)))
+                    failures++;
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    ASSERT_EQ(0, failures);
+}
+
+// the pipelined hetero request completes Wait() after its callback, so the request destroyed right after Wait()
+// is not used by the callback any more
+TEST_P(AsyncStressTests, pipelinedRequestIsDestroyedRightAfterWait) {
+    if (!available() || GetParam().compare(0, 6, "HETERO") != 0) return;
+
+    ExecutableNetwork network = load({{HETERO_CONFIG_KEY(PIPELINE_DEPTH), "2"}});
+    const std::string input = network.GetInputsInfo().begin()->first;
+    const std::string output = network.GetOutputsInfo().begin()->first;
+    for (size_t i = 0; i < 100; i++) {
+        std::atomic<bool> callbackDone(false);
+        {
+            InferRequest request = network.CreateInferRequest();
+            request.SetCompletionCallback([&]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                callbackDone = true;
+            });
+            fill(request, input, static_cast<float>(i));
+            request.StartAsync();
+            ASSERT_EQ(OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+            ASSERT_TRUE(callbackDone) << "Wait() has returned before the callback at the iteration " << i;
+            ASSERT_TRUE(check(request, output, static_cast<float>(i)));
+        }
+    }
+}
+
+// the batch split request infers the parts of its batch on the devices in place, so each image of the output
+// matches its own input; the speeds are given, so the split of 5 images is 3 and 2
+TEST_P(AsyncStressTests, batchSplitRequestIsCorrect) {
+    if (!available() || GetParam().compare(0, 6, "HETERO") != 0) return;
+
+    ExecutableNetwork network = load({{HETERO_CONFIG_KEY(BATCH_SPLIT), CONFIG_VALUE(YES)},
+                                      {"TARGET_FALLBACK", "CPU,CPU"},
+                                      {HETERO_CONFIG_KEY(DEVICE_SPEEDS), "CPU:1"}}, 5);
+    const std::string input = network.GetInputsInfo().begin()->first;
+    const std::string output = network.GetOutputsInfo().begin()->first;
+    for (size_t i = 0; i < 10; i++) {
+        InferRequest request = network.CreateInferRequest();
+        fill(request, input, static_cast<float>(i));
+        request.StartAsync();
+        ASSERT_EQ(OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+        ASSERT_TRUE(check(request, output, static_cast<float>(i))) << "the wrong output at the iteration " << i;
+    }
+}
+
+// the output which doesn't hold the batch in its first dimension can't be merged from the parts of the batch
+TEST_P(AsyncStressTests, batchSplitRejectsOutputWithoutBatch) {
+    if (!available() || GetParam().compare(0, 6, "HETERO") != 0) return;
+
+    ASSERT_THROW(load({{HETERO_CONFIG_KEY(BATCH_SPLIT), CONFIG_VALUE(YES)},
+                       {"TARGET_FALLBACK", "CPU"},
+                       {HETERO_CONFIG_KEY(DEVICE_SPEEDS), "CPU:1"}}, 2, true), details::InferenceEngineException);
+}
+
+// the throughput of the asynchronous requests must not drop when more of them are in flight: the drop
+// means the requests wait for each other on the locks of the infrastructure or oversubscribe the cores
+TEST_P(AsyncStressTests, throughputScalesWithRequests) {
+    if (!available()) return;
+
+    ExecutableNetwork network = load();
+    double single = 0;
+    for (size_t requests : {1, 2, 4, 8}) {
+        double throughput = measureThroughput(network, 1, requests);
+        std::cout << "[          ] " << GetParam() << " " << requests << " requests: " << throughput << " fps" << std::endl;
+        RecordProperty(GetParam() + "_requests_" + std::to_string(requests), std::to_string(throughput));
+        if (requests == 1)
+            single = throughput;
+        else
+            EXPECT_GT(throughput, 0.5 * single) << requests << " requests in flight";
+    }
+}
+
+TEST_P(AsyncStressTests, throughputScalesWithThreads) {
+    if (!available()) return;
+
+    ExecutableNetwork network = load();
+    const size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    double single = 0;
+    for (size_t threads = 1; threads <= 2 * hardwareThreads; threads *= 2) {
+        double throughput = measureThroughput(network, threads, 1);
+        std::cout << "[          ] " << GetParam() << " " << threads << " threads: " << throughput << " fps" << std::endl;
+        RecordProperty(GetParam() + "_threads_" + std::to_string(threads), std::to_string(throughput));
+        if (threads == 1)
+            single = throughput;
+        else
+            EXPECT_GT(throughput, 0.5 * single) << threads << " threads";
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(Devices, AsyncStressTests, ::testing::Values("CPU", "GPU", "HETERO:CPU"));
+#endif  // ENABLE_STRESS_UNIT_TESTS
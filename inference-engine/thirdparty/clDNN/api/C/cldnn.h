@@ -157,8 +157,12 @@ typedef struct
     const char* engine_log;                             ///< Specifies a file to which engine log should be dumped. Null/empty values means no logging.
     const char* sources_dumps_dir;                      ///< Specifies a directory where sources of cldnn::program objects should be dumped. Null/empty values means no loggins.
     /*cldnn_priority_mode_type*/ int16_t priority_mode; ///< Priority mode (support of OpenCL priority hints in command queue).
-    /*cldnn_throttle_mode_type*/ int16_t throttle_mode; ///< Placeholder for throttle mode (support of throttle hints in command queue). It has no effect for now and should be set to cldnn_throttle_disabled.
+    /*cldnn_throttle_mode_type*/ int16_t throttle_mode; ///< Throttle mode (support of cl_khr_throttle_hints in command queue). If the extension is not supported by current OpenCL implementation, the value must be set to cldnn_throttle_disabled.
     uint32_t enable_memory_pool;                        ///< Enables memory usage optimization. memory objects will be reused when possible. 
+    const char* kernels_cache_dir;                      ///< Specifies a directory where the compiled OpenCL programs are cached between the runs. Null/empty values means no caching.
+    void* context;                                      ///< OpenCL context (cl_context) used by the engine instead of creating its own one. Its buffers can be attached to the engine. Null value means the engine creates the context.
+    uint64_t memory_pool_limit;                         ///< Limit in bytes of the memory the memory pool allocates for the intermediate buffers. The pool reuses the buffers more aggressively near the limit and fails to build the network over it. Zero means no limit.
+    uint32_t enable_constants_cache;                    ///< Keeps the host copies of the constants computed by the programs, e.g. the reordered weights, the programs built later for the same constants take the copies instead of computing them.
 }  cldnn_engine_configuration;
 
 /// @brief Information about the engine returned by cldnn_get_engine_info().
@@ -180,7 +184,36 @@ typedef struct
     uint8_t supports_fp16_denorms;     ///< Does engine support denormalized FP16.
     uint8_t supports_subgroups_short;  ///< Does engine support cl_intel_subgroups_short.
     uint8_t supports_image;           ///< Does engine support images (CL_DEVICE_IMAGE_SUPPORT cap).
+    uint8_t supports_host_unified_memory; ///< Does the device share the memory with the host (CL_DEVICE_HOST_UNIFIED_MEMORY cap).
 }  cldnn_engine_info;
+
+/// @brief Statistics of the kernels selected by the auto tuner in the programs built by the engine returned by cldnn_get_engine_tuning_statistics().
+typedef struct
+{
+    uint64_t online_cache_hits;        ///< Number of the kernels found in the tuning file.
+    uint64_t offline_cache_hits;       ///< Number of the kernels found in the offline tuning cache of the device.
+    uint64_t cache_misses;             ///< Number of the kernels tuned on-line or selected by the default path.
+}  cldnn_tuning_statistics;
+
+/// @brief Time spent in the phases of the build of the programs of the engine returned by cldnn_get_engine_build_statistics(). The times are in microseconds.
+typedef struct
+{
+    uint64_t programs;                 ///< Number of the programs built by the engine.
+    uint64_t graph_optimization_time;  ///< Creation of the graphs of the programs from their topologies and the optimization passes.
+    uint64_t kernels_selection_time;   ///< Selection of the kernels of the primitives, the lookups of @ref tuning_lookup_time are mostly a part of it.
+    uint64_t tuning_lookup_time;       ///< Lookups of the kernels in the tuning file and the offline tuning cache, the internal programs included.
+    uint64_t kernels_compilation_time; ///< Compilation of the kernels or the load of their binaries set by cldnn_set_engine_programs_binaries().
+}  cldnn_build_statistics;
+
+/// @brief Device memory allocated by the engine returned by cldnn_get_engine_memory_statistics(). The sizes are in bytes.
+typedef struct
+{
+    uint64_t current_used;             ///< Memory allocated by the engine at the moment.
+    uint64_t peak_used;                ///< Maximum of the memory allocated by the engine at once.
+    uint64_t pool_used;                ///< Memory allocated by the memory pool for the intermediate buffers, it is a part of @ref current_used.
+    uint64_t pool_requested;           ///< Total size of the intermediate buffers taken from the memory pool. It exceeds @ref pool_used by the memory saved by reusing the buffers.
+    uint64_t pool_limit;               ///< Limit of @ref pool_used set in @ref cldnn_engine_configuration::memory_pool_limit, zero means no limit.
+}  cldnn_memory_statistics;
 /// @}
 
 /// @addtogroup c_network
@@ -218,6 +251,7 @@ typedef enum /*:int32_t*/
     cldnn_tuning_disabled,          ///< Tuning is disabled.
     cldnn_tuning_use_cache,         ///< Tuning using the cached data (no on-line tuning for non-existing data).
     cldnn_tuning_tune_and_cache,    ///< Tuning using the cached data if exist, tune and update cache otherwise.
+    cldnn_tuning_tune_network_and_cache, ///< Tuning as cldnn_tuning_tune_and_cache, also the layouts of the whole network are tuned with the cost of the reorders between the primitives.
 } cldnn_tuning_mode_type;
 
 /// @brief Tuning config.
@@ -505,7 +539,7 @@ CLDNN_API void cldnn_release_topology(cldnn_topology topology, cldnn_status* sta
 /// @addtogroup c_engine
 /// @{
 
-/// @brief number of available engines of the particular type
+/// @brief number of available engines of the particular type, i.e. the number of the GPU devices of the engines
 CLDNN_API uint32_t cldnn_get_engine_count(/*cldnn_engine_type*/ int32_t type, cldnn_status* status);
 
 /// @brief Release pending memory allocated in OpenCL context.
@@ -516,7 +550,8 @@ CLDNN_API void cldnn_release_pending_memory(cldnn_engine engine, cldnn_status* s
 
 /// @brief Create new engine of the specified @p type, @p engine_num, and @p configuration options.
 /// @param[in] type Engine type @ref cldnn_engine_type. Only OCL engine is supported.
-/// @param[in] engine_num Engine index. Should be 0.
+/// @param[in] engine_num Engine index, the index of the GPU device among the ones counted by @ref cldnn_get_engine_count.
+/// The engine which runs in the context of the user takes the device of the context.
 /// @param[in] configuration Pointer to engine configuration options.
 CLDNN_API cldnn_engine cldnn_create_engine(/*cldnn_engine_type*/ int32_t type, uint32_t engine_num, const cldnn_engine_configuration* configuration, cldnn_status* status);
 
@@ -539,6 +574,35 @@ CLDNN_API int64_t cldnn_get_temp_used_device_memory_size(cldnn_engine engine, cl
 /// @brief Returns max size of resources allocated using given engine
 CLDNN_API int64_t cldnn_get_max_used_device_memory_size(cldnn_engine engine, cldnn_status* status);
 
+/// @brief Copies the binaries of the OpenCL programs compiled by the @p engine as an opaque blob to the @p data.
+/// @details If the @p size is less than the size of the blob returned in @p size_ret, the status is set to CLDNN_INVALID_ARG.
+CLDNN_API void cldnn_get_engine_programs_binaries(cldnn_engine engine, char* data, size_t size, size_t* size_ret, cldnn_status* status);
+
+/// @brief Gives the @p engine the binaries of the blob returned by cldnn_get_engine_programs_binaries().
+/// @details The programs of the same sources are loaded from the binaries instead of being compiled.
+CLDNN_API void cldnn_set_engine_programs_binaries(cldnn_engine engine, const char* data, size_t size, cldnn_status* status);
+
+/// @brief Copies the constants kept by the @p engine created with @ref cldnn_engine_configuration::enable_constants_cache as an opaque blob to the @p data.
+/// @details If the @p size is less than the size of the blob returned in @p size_ret, the status is set to CLDNN_INVALID_ARG.
+CLDNN_API void cldnn_get_engine_constants_data(cldnn_engine engine, char* data, size_t size, size_t* size_ret, cldnn_status* status);
+
+/// @brief Gives the @p engine the constants of the blob returned by cldnn_get_engine_constants_data().
+/// @details The programs built for the same constants take them instead of computing them, if the @p engine keeps the constants.
+CLDNN_API void cldnn_set_engine_constants_data(cldnn_engine engine, const char* data, size_t size, cldnn_status* status);
+
+/// @brief Returns the OpenCL context (cl_context) of the @p engine.
+/// @details The engines created with this context in @ref cldnn_engine_configuration::context share the constant data of their networks in place.
+CLDNN_API void* cldnn_get_engine_cl_context(cldnn_engine engine, cldnn_status* status);
+
+/// @brief Returns the statistics of the kernels selected by the auto tuner in all programs built by the @p engine. See @ref cldnn_tuning_statistics for details.
+CLDNN_API cldnn_tuning_statistics cldnn_get_engine_tuning_statistics(cldnn_engine engine, cldnn_status* status);
+
+/// @brief Returns the time spent in the phases of the build of all programs built by the @p engine. See @ref cldnn_build_statistics for details.
+CLDNN_API cldnn_build_statistics cldnn_get_engine_build_statistics(cldnn_engine engine, cldnn_status* status);
+
+/// @brief Returns the memory allocated by the @p engine and its memory pool. See @ref cldnn_memory_statistics for details.
+CLDNN_API cldnn_memory_statistics cldnn_get_engine_memory_statistics(cldnn_engine engine, cldnn_status* status);
+
 /// @addtogroup c_network
 /// @{
 
@@ -677,6 +741,16 @@ CLDNN_API                 void cldnn_get_network_all_primitive_org_names(cldnn_n
 /// @param deps_num Number of elements in the @p dependencies array.
 CLDNN_API                 void cldnn_execute_network(cldnn_network network, cldnn_event* dependencies, size_t deps_num, cldnn_status* status);
 
+/// @brief Executes the networks one after another.
+/// @details Every network waits for the outputs of the previous one, so the outputs of a network may be set as the inputs of the next one.
+/// The networks are submitted without the flush of the queue after each of them, the queue is flushed after the last network.
+/// Function returns immediately, even if @p dependencies are not set yet.
+/// @param networks Pointer to an array of @ref cldnn_network objects in the order of execution.
+/// @param networks_num Number of elements in the @p networks array.
+/// @params dependencies Pointer to an array of @ref cldnn_events to be waited for the execution of every network.
+/// @param deps_num Number of elements in the @p dependencies array.
+CLDNN_API                 void cldnn_execute_networks(cldnn_network* networks, size_t networks_num, cldnn_event* dependencies, size_t deps_num, cldnn_status* status);
+
 /// @brief Returns executed network output information.
 /// @details User should call this function after cldnn_execute_network() to get result of network execution.
 /// @param name Output name to get the result.
@@ -706,6 +780,22 @@ CLDNN_API cldnn_memory cldnn_allocate_memory(cldnn_engine engine, cldnn_layout l
 /// @brief Create memory object attached to the buffer allocated by user.
 /// @note User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
 CLDNN_API cldnn_memory cldnn_attach_memory(cldnn_layout layout, void* pointer, size_t size, cldnn_status* status);
+/// @brief Create memory object on @p engine which uses the buffer allocated by user as its storage.
+/// @details The primitives access the buffer in place. On the devices which share the memory with the host
+/// no copy is made if the buffer is aligned to 4096 bytes and its size is a multiple of 64 bytes.
+/// @note User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
+CLDNN_API cldnn_memory cldnn_share_host_memory(cldnn_engine engine, cldnn_layout layout, void* pointer, size_t size, cldnn_status* status);
+/// @brief Allocate the pinned host memory on @p engine, it is mapped for its whole life.
+/// @details The memory set as the input of a network is written to the device by the non-blocking transfer which runs
+/// at the full speed of the bus, see also cldnn_download_memory(). The lock returns the same pointer and waits for
+/// the last transfer. It is useful for the discrete devices, the other devices access the host memory in place.
+CLDNN_API cldnn_memory cldnn_allocate_staging_memory(cldnn_engine engine, cldnn_layout layout, cldnn_status* status);
+/// @brief Enqueues the non-blocking read of @p memory of the engine to @p staging allocated by cldnn_allocate_staging_memory()
+/// after the commands enqueued before, the lock of @p staging waits for it.
+CLDNN_API void cldnn_download_memory(cldnn_memory staging, cldnn_memory memory, cldnn_status* status);
+/// @brief Create memory object on @p engine which uses the OpenCL buffer (cl_mem) of the context the engine was created with.
+/// @note User is responsible for buffer release. Buffer lifetime should be bigger than lifetime of the memory object.
+CLDNN_API cldnn_memory cldnn_attach_cl_buffer(cldnn_engine engine, cldnn_layout layout, void* cl_buffer, cldnn_status* status);
 /// @brief Checks if two memory objects refer to the same underlaying buffer.
 CLDNN_API int32_t cldnn_is_the_same_buffer(cldnn_memory mem1, cldnn_memory mem2, cldnn_status* status);
 /// @brief Increment reference counter for the memory object.
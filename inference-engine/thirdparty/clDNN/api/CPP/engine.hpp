@@ -63,8 +63,12 @@ struct engine_configuration
     const std::string engine_log;               ///< Specifies a file to which engine log should be dumped. Empty by default (means no logging).
     const std::string sources_dumps_dir;        ///< Specifies a directory where sources of cldnn::program objects should be dumped. Empty by default (means no dumping).
     const priority_mode_types priority_mode;    ///< Priority mode (support of priority hints in command queue). If cl_khr_priority_hints extension is not supported by current OpenCL implementation, the value must be set to cldnn_priority_disabled.
-    const throttle_mode_types throttle_mode;    ///< Placeholder for throttle mode (support of throttle hints in command queue). It has no effect for now and should be set to cldnn_throttle_disabled.
+    const throttle_mode_types throttle_mode;    ///< Throttle mode (support of throttle hints in command queue). If cl_khr_throttle_hints extension is not supported by current OpenCL implementation, the value must be set to cldnn_throttle_disabled.
     bool enable_memory_pool;              ///< Enables memory usage optimization. memory objects will be reused when possible (switched off for older drivers then NEO).
+    const std::string kernels_cache_dir;        ///< Specifies a directory where the compiled OpenCL programs are cached between the runs. Empty by default (means no caching).
+    void* context;                              ///< OpenCL context (cl_context) used by the engine instead of creating its own one. Null by default (means the engine creates the context).
+    const uint64_t memory_pool_limit;           ///< Limit in bytes of the memory the memory pool allocates for the intermediate buffers. Zero by default (means no limit).
+    const bool enable_constants_cache;          ///< Keeps the host copies of the constants computed by the programs, the programs built later for the same constants take them. Disabled by default.
 
     /// @brief Constructs engine configuration with specified options.
     /// @param profiling Enable per-primitive profiling.
@@ -72,6 +76,10 @@ struct engine_configuration
     /// @param dump_custom_program Dump the custom OpenCL programs to files
     /// @param options OpenCL compiler options string.
     /// @param single_kernel If provided, runs specific layer.
+    /// @param kernels_cache_dir If provided, the compiled OpenCL programs are stored to and loaded from the directory.
+    /// @param context If provided, the engine uses the OpenCL context, the buffers of the context can be attached to the engine.
+    /// @param memory_pool_limit If provided, the memory pool reuses the buffers more aggressively near the limit and fails to allocate over it.
+    /// @param constants_cache If true, the constants computed by the programs, e.g. the reordered weights, are kept to be reused by the programs built later.
     engine_configuration(
             bool profiling = false,
             bool decorate_kernel_names = false,
@@ -83,7 +91,11 @@ struct engine_configuration
             const std::string& sources_dumps_dir = std::string(),
             priority_mode_types priority_mode = priority_mode_types::disabled,
             throttle_mode_types throttle_mode = throttle_mode_types::disabled,
-            bool memory_pool = true)
+            bool memory_pool = true,
+            const std::string& kernels_cache_dir = std::string(),
+            void* context = nullptr,
+            uint64_t memory_pool_limit = 0,
+            bool constants_cache = false)
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
         , dump_custom_program(dump_custom_program)
@@ -95,6 +107,10 @@ struct engine_configuration
         , priority_mode(priority_mode)
         , throttle_mode(throttle_mode)
         , enable_memory_pool(memory_pool)
+        , kernels_cache_dir(kernels_cache_dir)
+        , context(context)
+        , memory_pool_limit(memory_pool_limit)
+        , enable_constants_cache(constants_cache)
     {}
 
     engine_configuration(const cldnn_engine_configuration& c_conf)
@@ -109,6 +125,10 @@ struct engine_configuration
         , priority_mode(static_cast<priority_mode_types>(c_conf.priority_mode))
         , throttle_mode(static_cast<throttle_mode_types>(c_conf.throttle_mode))
         , enable_memory_pool(c_conf.enable_memory_pool != 0)
+        , kernels_cache_dir(c_conf.kernels_cache_dir ? c_conf.kernels_cache_dir : "")
+        , context(c_conf.context)
+        , memory_pool_limit(c_conf.memory_pool_limit)
+        , enable_constants_cache(c_conf.enable_constants_cache != 0)
     {}
 
     /// @brief Implicit conversion to C API @ref ::cldnn_engine_configuration
@@ -125,7 +145,11 @@ struct engine_configuration
             sources_dumps_dir.c_str(),
             static_cast<int16_t>(priority_mode),
             static_cast<int16_t>(throttle_mode),
-            enable_memory_pool
+            enable_memory_pool,
+            kernels_cache_dir.c_str(),
+            context,
+            memory_pool_limit,
+            enable_constants_cache
         };
     }
 };
@@ -134,6 +158,17 @@ struct engine_configuration
 /// @details Look into @ref ::cldnn_engine_info for details.
 using engine_info = ::cldnn_engine_info;
 
+/// @brief Statistics of the kernels selected by the auto tuner in the programs built by the engine.
+using tuning_statistics = ::cldnn_tuning_statistics;
+
+/// @brief Time spent in the phases of the build of the programs of the engine.
+/// @details Look into @ref ::cldnn_build_statistics for details.
+using build_statistics = ::cldnn_build_statistics;
+
+/// @brief Device memory allocated by the engine and its memory pool.
+/// @details Look into @ref ::cldnn_memory_statistics for details.
+using memory_statistics = ::cldnn_memory_statistics;
+
 /// @brief Represents clDNN engine object.
 struct engine
 {
@@ -144,7 +179,8 @@ struct engine
 
     /// @brief Construct engine of the specified @p type, @p engine_num, and @p configuration options.
     /// @param[in] type Engine type @ref cldnn_engine_type. Only OCL engine is supported.
-    /// @param[in] engine_num Engine index. Should be 0.
+    /// @param[in] engine_num Engine index, the index of the GPU device among the ones counted by @ref engine_count().
+    /// The engine which runs in the context of the user takes the device of the context.
     /// @param[in] configuration Pointer to engine configuration options.
     engine(engine_types type, uint32_t engine_num, const engine_configuration& configuration = engine_configuration())
         :_impl(check_status<::cldnn_engine>("failed to create engine", [&](status_t* status)
@@ -177,7 +213,7 @@ struct engine
     friend bool operator==(const engine& lhs, const engine& rhs) { return lhs._impl == rhs._impl; }
     friend bool operator!=(const engine& lhs, const engine& rhs) { return !(lhs == rhs); }
 
-    /// @brief Returns number of available engines of the particular @p type.
+    /// @brief Returns number of available engines of the particular @p type, i.e. the number of the GPU devices.
     static uint32_t engine_count(engine_types type)
     {
         return check_status<uint32_t>("engine_count failed", [=](status_t* status)
@@ -224,6 +260,95 @@ struct engine
         });
     }
 
+    /// @brief Returns the binaries of the OpenCL programs compiled by the engine as an opaque blob.
+    std::vector<char> get_programs_binaries() const
+    {
+        size_t size_ret = 0;
+        status_t err_invalid_arg = CLDNN_SUCCESS;
+
+        cldnn_get_engine_programs_binaries(_impl, nullptr, 0, &size_ret, &err_invalid_arg);
+        std::vector<char> blob(size_ret);
+
+        check_status<void>("get programs binaries failed", [&](status_t* status)
+        {
+            cldnn_get_engine_programs_binaries(_impl, blob.data(), blob.size(), &size_ret, status);
+        });
+        return blob;
+    }
+
+    /// @brief Gives the engine the binaries returned by @ref get_programs_binaries(), possibly by another engine.
+    /// @details The programs of the same sources are loaded from the binaries instead of being compiled.
+    void set_programs_binaries(const std::vector<char>& blob) const
+    {
+        check_status<void>("set programs binaries failed", [&](status_t* status)
+        {
+            cldnn_set_engine_programs_binaries(_impl, blob.data(), blob.size(), status);
+        });
+    }
+
+    /// @brief Returns the constants kept by the engine created with @ref engine_configuration::enable_constants_cache as an opaque blob.
+    std::vector<char> get_constants_data() const
+    {
+        size_t size_ret = 0;
+        status_t err_invalid_arg = CLDNN_SUCCESS;
+
+        cldnn_get_engine_constants_data(_impl, nullptr, 0, &size_ret, &err_invalid_arg);
+        std::vector<char> blob(size_ret);
+
+        check_status<void>("get constants data failed", [&](status_t* status)
+        {
+            cldnn_get_engine_constants_data(_impl, blob.data(), blob.size(), &size_ret, status);
+        });
+        return blob;
+    }
+
+    /// @brief Gives the engine the constants returned by @ref get_constants_data(), possibly by another engine.
+    /// @details The programs built for the same constants take them instead of computing them, if the engine keeps the constants.
+    void set_constants_data(const std::vector<char>& blob) const
+    {
+        check_status<void>("set constants data failed", [&](status_t* status)
+        {
+            cldnn_set_engine_constants_data(_impl, blob.data(), blob.size(), status);
+        });
+    }
+
+    /// @brief Returns the OpenCL context (cl_context) of the engine.
+    /// @details The engines created with this context in @ref engine_configuration::context share the constant data of their networks in place.
+    void* get_cl_context() const
+    {
+        return check_status<void*>("get engine OpenCL context failed", [=](status_t* status)
+        {
+            return cldnn_get_engine_cl_context(_impl, status);
+        });
+    }
+
+    /// @brief Returns the statistics of the kernels selected by the auto tuner in all programs built by the engine.
+    tuning_statistics get_tuning_statistics() const
+    {
+        return check_status<tuning_statistics>("get engine tuning statistics failed", [=](status_t* status)
+        {
+            return cldnn_get_engine_tuning_statistics(_impl, status);
+        });
+    }
+
+    /// @brief Returns the time spent in the phases of the build of all programs built by the engine.
+    build_statistics get_build_statistics() const
+    {
+        return check_status<build_statistics>("get engine build statistics failed", [=](status_t* status)
+        {
+            return cldnn_get_engine_build_statistics(_impl, status);
+        });
+    }
+
+    /// @brief Returns the memory allocated by the engine and its memory pool.
+    memory_statistics get_memory_statistics() const
+    {
+        return check_status<memory_statistics>("get engine memory statistics failed", [=](status_t* status)
+        {
+            return cldnn_get_engine_memory_statistics(_impl, status);
+        });
+    }
+
     /// @brief Returns type of the engine.
     engine_types get_type() const
     {
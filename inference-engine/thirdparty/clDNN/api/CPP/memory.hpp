@@ -78,6 +78,61 @@ struct memory
         });
     }
 
+    /// Create memory object on @p engine which uses the buffer allocated by user as its storage.
+    /// @param ptr  The pointer to user allocated buffer.
+    /// @param size Size (in bytes) of the buffer. Should be equal to @p layout.data_size()
+    /// @note The primitives access the buffer in place, on the devices which share the memory with the host
+    /// (see engine_info::supports_host_unified_memory) no copy is made if the buffer is aligned to 4096 bytes
+    /// and its size is a multiple of 64 bytes.
+    /// User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
+    template<typename T>
+    static memory share(const engine& engine, const cldnn::layout& layout, T* ptr, size_t size)
+    {
+        if (!ptr) throw std::invalid_argument("pointer should not be null");
+        size_t data_size = size * sizeof(T);
+        if (data_size != layout.bytes_count()) {
+            std::string err_str("buffer size mismatch - input size " + std::to_string(data_size) + " layout size " + std::to_string(layout.bytes_count()));
+            throw std::invalid_argument(err_str);
+        }
+
+        return check_status<cldnn_memory>("memory share failed", [&](status_t* status)
+        {
+            return cldnn_share_host_memory(engine.get(), layout, ptr, data_size, status);
+        });
+    }
+
+    /// Allocate the pinned host memory on @p engine which is mapped for its whole life, the memory set as the input
+    /// of a network and the memory downloaded by download() are transferred by the non-blocking copies which run
+    /// at the full speed of the bus. The pointer of the memory is the same, its lock waits for the last transfer.
+    static memory allocate_staging(const engine& engine, const layout& layout)
+    {
+        return check_status<cldnn_memory>("staging memory allocation failed", [&](status_t* status)
+        {
+            return cldnn_allocate_staging_memory(engine.get(), layout, status);
+        });
+    }
+
+    /// Enqueues the non-blocking read of the @p device memory of the engine to this staging memory after the commands
+    /// enqueued before, the next pointer() waits for it.
+    void download(const memory& device) const
+    {
+        check_status<void>("memory download failed", [&](status_t* status)
+        {
+            cldnn_download_memory(_impl, device._impl, status);
+        });
+    }
+
+    /// Create memory object on @p engine which uses the OpenCL buffer (cl_mem) of the context the engine was created with.
+    /// @note User is responsible for buffer release. Buffer lifetime should be bigger than lifetime of the memory object.
+    static memory attach_cl_buffer(const engine& engine, const cldnn::layout& layout, void* cl_buffer)
+    {
+        if (!cl_buffer) throw std::invalid_argument("buffer should not be null");
+        return check_status<cldnn_memory>("OpenCL buffer attach failed", [&](status_t* status)
+        {
+            return cldnn_attach_cl_buffer(engine.get(), layout, cl_buffer, status);
+        });
+    }
+
     memory(const memory& other)
         :_impl(other._impl), _layout(other._layout)
         ,_size(other._size), _count(other._count)
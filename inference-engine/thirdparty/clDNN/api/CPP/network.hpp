@@ -277,6 +277,30 @@ struct network
         return result;
     }
 
+    /// @brief Executes the networks one after another without the flush of the queue after each of them.
+    /// @param networks List of @ref network objects in the order of execution, each of them waits for the outputs of the previous one.
+    /// @param dependencies List of @ref event objects to be waited before the execution of every network.
+    /// @note The outputs of the executed networks are taken by get_output() of each network.
+    static void execute_sequence(const std::vector<network>& networks, const std::vector<event>& dependencies = {})
+    {
+        std::vector<cldnn_network> network_refs(networks.size());
+        for (decltype(networks.size()) i = 0; i < networks.size(); i++)
+        {
+            network_refs[i] = networks[i].get();
+        }
+
+        std::vector<cldnn_event> dep_refs(dependencies.size());
+        for (decltype(dependencies.size()) i = 0; i < dependencies.size(); i++)
+        {
+            dep_refs[i] = dependencies[i].get();
+        }
+
+        check_status<void>("networks execute failed", [&](status_t* status)
+        {
+            return cldnn_execute_networks(network_refs.data(), network_refs.size(), dep_refs.data(), dep_refs.size(), status);
+        });
+    }
+
     /// @brief Returns wrapped C API @ref cldnn_network handler.
     cldnn_network get() const { return _impl; }
 
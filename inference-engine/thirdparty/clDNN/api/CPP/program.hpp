@@ -76,7 +76,12 @@ enum class tuning_mode
     tuning_use_cache = cldnn_tuning_use_cache,
 
     /// @brief Tuning using the cached data if exist, tune and update cache otherwise.
-    tuning_tune_and_cache = cldnn_tuning_tune_and_cache
+    tuning_tune_and_cache = cldnn_tuning_tune_and_cache,
+
+    /// @brief Tuning as @ref tuning_tune_and_cache, also the layouts of the whole network are tuned.
+    /// @details The network is executed with each layout plan, so the cost of the reorders between the primitives is taken into account.
+    /// The chosen plan is stored in the cache and used in the other tuning modes.
+    tuning_tune_network_and_cache = cldnn_tuning_tune_network_and_cache
 };
 
 /// @brief Tuning configuration.
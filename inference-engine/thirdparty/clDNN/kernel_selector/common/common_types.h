@@ -36,6 +36,8 @@ namespace kernel_selector
         NORMALIZE,
         POOLING,
         ROI_POOLING,
+        DETECTION_OUTPUT,
+        PROPOSAL,
         FULLY_CONNECTED,
         ACTIVATION,
         SOFT_MAX,
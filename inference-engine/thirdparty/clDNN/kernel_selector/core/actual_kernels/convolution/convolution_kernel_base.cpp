@@ -65,6 +65,7 @@ namespace kernel_selector
             MakeJitConstant("INPUT0_OFFSET_WITH_PADDING",   input_offset_with_padding),
             MakeJitConstant("DEPTHWISE_SEPARABLE_OPT",      params.depthwiseSeparableOpt),
             MakeJitConstant("QUANTIZATION_TERM",            params.int8_quantization),
+            MakeJitConstant("FUSED_ELTWISE",                params.fused_eltwise),
         });
 
         if (params.int8_quantization)
@@ -243,6 +244,10 @@ namespace kernel_selector
         auto& kernel = kd.kernels[0];
         FillCLKernelData(kernel, runInfo, finalKernelName, jit, entryPoint, exeMode, true, !newParams.bias.empty(), 1, newParams.int8_quantization, newParams.output_calibration);
         kernel.arguments.push_back({ ArgumentDescriptor::Types::SPLIT, 0 });
+        if (newParams.fused_eltwise)
+        {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 1 });
+        }
 
         kd.estimatedTime = runInfo.effiency;
         kd.autoTuneIndex = autoTuneIndex;
@@ -0,0 +1,94 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "convolution_kernel_bfyx_1x1_eltwise.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector {
+
+    ParamsKey ConvolutionKernel_bfyx_1x1_eltwise::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputWeightsType(WeightsType::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBiasPerFeature();
+        k.EnableNonBiasTerm();
+        k.EnableBatching();
+        k.EnableSubGroup();
+        k.EnableFusedEltwise();
+        return k;
+    }
+
+    ConvolutionKernelBase::DispatchData ConvolutionKernel_bfyx_1x1_eltwise::SetDefault(const convolution_params& params, int) const
+    {
+        DispatchData kd = ConvolutionKernelBase::SetDefault(params);
+
+        const auto& out = params.output;
+
+        // the sub-group computes 16 output features of 16 positions, each work item loads one of the positions
+        kd.gws0 = Align(out.X().v * out.Y().v, 16) / 16;
+        kd.gws1 = Align(out.Feature().v, 16);
+        kd.gws2 = out.Batch().v;
+
+        kd.lws0 = 1;
+        kd.lws1 = 16;
+        kd.lws2 = 1;
+
+        kd.effiency = FORCE_PRIORITY_2;
+
+        return kd;
+    }
+
+    bool ConvolutionKernel_bfyx_1x1_eltwise::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!ConvolutionKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const convolution_params&>(p);
+
+        const auto &input = params.inputs[0];
+        const auto &output = params.output;
+
+        // the kernel computes the convolutions with the fused sum only
+        const bool bFusedEltwise = params.fused_eltwise && params.inputs.size() == 2;
+        const bool bOutputSizes = output.X().v != input.X().v || output.Y().v != input.Y().v;
+        const bool bFilterSize = params.filterSize.x != 1 || params.filterSize.y != 1;
+        const bool bStride = params.stride.x != 1 || params.stride.y != 1;
+        const bool bPadding = params.padding.x != 0 || params.padding.y != 0;
+
+        if (!bFusedEltwise || bOutputSizes || bFilterSize || bStride || bPadding)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    KernelsData ConvolutionKernel_bfyx_1x1_eltwise::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options);
+    }
+}
@@ -0,0 +1,108 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "convolution_kernel_bfyx_1x1_image.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector {
+
+    namespace
+    {
+        // a texel of the weights holds 4 input features of an output feature, a work item computes 4 output features
+        constexpr size_t featuresPerItem = 4;
+        constexpr size_t outputBlockWidth = 4;
+    }
+
+    ParamsKey ConvolutionKernel_bfyx_1x1_image::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputWeightsType(WeightsType::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBiasPerFeature();
+        k.EnableNonBiasTerm();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool ConvolutionKernel_bfyx_1x1_image::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!Parent::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const convolution_params&>(p);
+
+        const bool bFilterSize = params.filterSize.x != 1 || params.filterSize.y != 1;
+        const bool bPadding = params.padding.x != 0 || params.padding.y != 0;
+        // the texels are not split between the work items, the input features are read by 4
+        const bool bInputFeatures = params.inputs[0].Feature().v % featuresPerItem != 0;
+
+        if (bFilterSize || bPadding || bInputFeatures || params.split != 1)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    JitConstants ConvolutionKernel_bfyx_1x1_image::GetJitConstants(const convolution_params& params, const DispatchData& kd) const
+    {
+        auto jit = Parent::GetJitConstants(params, kd);
+        jit.AddConstant(MakeJitConstant("OUTPUT_BLOCK_WIDTH", kd.cldnnStyle.blockWidth));
+        jit.AddConstant(MakeJitConstant("FEATURES_PER_ITEM", featuresPerItem));
+        return jit;
+    }
+
+    ConvolutionKernelBase::DispatchData ConvolutionKernel_bfyx_1x1_image::SetDefault(const convolution_params& params, int) const
+    {
+        DispatchData kd = Parent::SetDefault(params);
+
+        const auto& out = params.output;
+
+        kd.cldnnStyle.blockWidth = std::min(outputBlockWidth, out.X().v);
+
+        std::vector<size_t> global = { CeilDiv(out.X().v, kd.cldnnStyle.blockWidth), out.Y().v,
+                                       CeilDiv(out.Feature().v, featuresPerItem) * out.Batch().v };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        // the gain of the image depends on the device and the sizes, so the kernel is left to the tuning
+        kd.effiency = FORCE_PRIORITY_9;
+
+        return kd;
+    }
+
+    KernelsData ConvolutionKernel_bfyx_1x1_image::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options);
+    }
+}
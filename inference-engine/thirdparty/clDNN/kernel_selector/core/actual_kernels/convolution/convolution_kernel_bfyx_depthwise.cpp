@@ -0,0 +1,111 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "convolution_kernel_bfyx_depthwise.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector {
+
+    namespace
+    {
+        // the groups with more input features are computed faster by the kernels which share the input between the filters
+        constexpr uint32_t maxGroupInputFeatures = 8;
+        constexpr size_t outputBlockWidth = 4;
+    }
+
+    ParamsKey ConvolutionKernel_bfyx_depthwise::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputWeightsType(WeightsType::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableDilation();
+        k.EnableBiasPerFeature();
+        k.EnableNonBiasTerm();
+        k.EnableBatching();
+        k.EnableSplitSupport();
+        k.EnableDepthwiseSeparableOpt();
+        k.DisableTuning();
+        return k;
+    }
+
+    bool ConvolutionKernel_bfyx_depthwise::Validate(const Params& p, const optional_params& o) const
+    {
+        // the kernel checks the borders of the input, so its padding is not required
+        if (!Parent::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const convolution_params&>(p);
+
+        // the input features of the group are given by the weights, they are concatenated for all the groups with the depthwise separable optimization
+        const bool bGrouped = params.split > 1;
+        const bool bGroupInputFeatures = params.weights.IFM().v <= maxGroupInputFeatures;
+
+        if (!bGrouped || !bGroupInputFeatures)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    JitConstants ConvolutionKernel_bfyx_depthwise::GetJitConstants(const convolution_params& params, const DispatchData& kd) const
+    {
+        auto jit = Parent::GetJitConstants(params, kd);
+        jit.AddConstant(MakeJitConstant("OUTPUT_BLOCK_WIDTH", kd.cldnnStyle.blockWidth));
+        return jit;
+    }
+
+    ConvolutionKernelBase::DispatchData ConvolutionKernel_bfyx_depthwise::SetDefault(const convolution_params& params, int) const
+    {
+        DispatchData kd = Parent::SetDefault(params);
+
+        const auto& out = params.output;
+
+        // each work item computes a block of the outputs of the row, the filter values are loaded once for the block
+        kd.cldnnStyle.blockWidth = std::min(outputBlockWidth, out.X().v);
+
+        std::vector<size_t> global = { CeilDiv(out.X().v, kd.cldnnStyle.blockWidth), out.Y().v, out.Feature().v * out.Batch().v };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        // the 3x3 depthwise kernel is faster for the cases it supports
+        kd.effiency = FORCE_PRIORITY_6;
+
+        return kd;
+    }
+
+    KernelsData ConvolutionKernel_bfyx_depthwise::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options);
+    }
+}
@@ -26,9 +26,12 @@
 #include "convolution_kernel_yxfb_yxio_b1_block_multiple_x.h"
 #include "convolution_kernel_tutorial.h"
 #include "convolution_kernel_bfyx_3x3_dw_opt.h"
+#include "convolution_kernel_bfyx_depthwise.h"
 #include "convolution_kernel_winograd_2x3_s1.h"
 #include "convolution_kernel_bfyx_1x1.h"
 #include "convolution_kernel_bfyx_1x1_gemm_buf.h"
+#include "convolution_kernel_bfyx_1x1_eltwise.h"
+#include "convolution_kernel_bfyx_1x1_image.h"
 #include "convolution_kernel_winograd_2x3_s1_fused.h"
 #include "convolution_kernel_winograd_6x3_s1_fused.h"
 #include "convolution_kernel_MMAD.h"
@@ -52,11 +55,14 @@ namespace kernel_selector
         //Attach<ConvolutionKernel_yxfb_yxio_b1_block>(); // TODO: need to finish integration
         Attach<ConvolutionKernel_yxfb_yxio_b1_block_mulitple_x>();
         Attach<ConvolutionKernel_bfyx_3x3_dw_opt>();
+        Attach<ConvolutionKernel_bfyx_depthwise>();
         Attach<ConvolutionKernel_Winograd_2x3_s1>();
         Attach<ConvolutionKernel_Winograd_2x3_s1_fused>();
         Attach<ConvolutionKernel_Winograd_6x3_s1_fused>();
         Attach<ConvolutionKernel_bfyx_1x1>();
         Attach<ConvolutionKernel_bfyx_1x1_gemm_buf>();
+        Attach<ConvolutionKernel_bfyx_1x1_eltwise>();
+        Attach<ConvolutionKernel_bfyx_1x1_image>();
         Attach<ConvolutionKernel_MMAD>();
         Attach<ConvolutionKernel_MMAD_blocks>();
         Attach<ConvolutionKernel_1x1_gemm_MMAD>();
@@ -37,6 +37,10 @@ namespace kernel_selector
         s << dilation.x << "_" << dilation.y << "_";
         s << padding.x << "_" << padding.y << "_";
         s << split;
+        if (fused_eltwise)
+        {
+            s << "_fused_eltwise";
+        }
 
         return s.str();
     }
@@ -76,6 +80,11 @@ namespace kernel_selector
             k.EnableOutputCalibration();
         }
 
+        if (fused_eltwise)
+        {
+            k.EnableFusedEltwise();
+        }
+
         return k;
     }
 }
\ No newline at end of file
@@ -37,6 +37,7 @@ namespace kernel_selector
         bool     transposed = false;
         bool     int8_quantization = false;
         bool     output_calibration = false;
+        bool     fused_eltwise = false;         // the sum with inputs[1] is fused, it is added before the activation
         float    input_quantization_factor = 1.0f;
         float    output_quantization_factor = 1.0f;
 
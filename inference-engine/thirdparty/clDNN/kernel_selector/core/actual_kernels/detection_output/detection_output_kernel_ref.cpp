@@ -0,0 +1,194 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "detection_output_kernel_ref.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector 
+{
+    namespace
+    {
+        enum class Stage
+        {
+            DECODE_BOXES,
+            SELECT_PER_CLASS,
+            SELECT_PER_IMAGE,
+            WRITE_OUTPUT
+        };
+
+        struct Sizes
+        {
+            size_t batch;
+            size_t priors;
+            size_t loc_classes;
+            size_t max_per_class;   // the size of the list of the candidates of a class after top_k
+        };
+
+        Sizes GetSizes(const detection_output_params& params)
+        {
+            Sizes sizes;
+            sizes.batch = params.inputs[0].Batch().v;
+            sizes.priors = params.inputs[2].Y().v / params.prior_info_size;
+            sizes.loc_classes = params.share_location ? 1 : params.num_classes;
+            sizes.max_per_class = (params.top_k > 0 && (size_t)params.top_k < sizes.priors) ? params.top_k : sizes.priors;
+            return sizes;
+        }
+
+        DetectionOutputKernelRef::DispatchData SetDefault(const detection_output_params& params, Stage stage)
+        {
+            DetectionOutputKernelRef::DispatchData kd;
+
+            kd.fp16UnitUsed = (params.inputs[0].GetDType() == Datatype::F16);
+
+            const Sizes sizes = GetSizes(params);
+            std::vector<size_t> global;
+            switch (stage)
+            {
+            case Stage::DECODE_BOXES:
+                global = { sizes.priors, sizes.loc_classes, sizes.batch };
+                break;
+            case Stage::SELECT_PER_CLASS:
+                global = { params.num_classes, sizes.batch, 1 };
+                break;
+            case Stage::SELECT_PER_IMAGE:
+                global = { sizes.batch, 1, 1 };
+                break;
+            case Stage::WRITE_OUTPUT:
+                global = { sizes.batch * params.keep_top_k, 1, 1 };
+                break;
+            }
+
+            kd.gws0 = global[0];
+            kd.gws1 = global[1];
+            kd.gws2 = global[2];
+
+            auto local = GetOptimalLocalWorkGroupSizes(global);
+
+            kd.lws0 = local[0];
+            kd.lws1 = local[1];
+            kd.lws2 = local[2];
+
+            return kd;
+        }
+    }
+
+    ParamsKey DetectionOutputKernelRef::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool DetectionOutputKernelRef::Validate(const Params& p, const optional_params& o) const
+    {
+        if (p.GetType() != KernelType::DETECTION_OUTPUT ||
+            o.GetType() != KernelType::DETECTION_OUTPUT)
+        {
+            return false;
+        }
+
+        const detection_output_params& params = static_cast<const detection_output_params&>(p);
+        if (params.inputs.size() != 3 || params.num_classes == 0 || params.keep_top_k <= 0 || params.prior_info_size <= 0)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    JitConstants DetectionOutputKernelRef::GetJitConstants(const detection_output_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+
+        const Sizes sizes = GetSizes(params);
+        jit.AddConstants({
+            MakeJitConstant("NUM_IMAGES", sizes.batch),
+            MakeJitConstant("NUM_PRIORS", sizes.priors),
+            MakeJitConstant("NUM_CLASSES", params.num_classes),
+            MakeJitConstant("NUM_LOC_CLASSES", sizes.loc_classes),
+            MakeJitConstant("MAX_PER_CLASS", sizes.max_per_class),
+            MakeJitConstant("KEEP_TOP_K", params.keep_top_k),
+            MakeJitConstant("SHARE_LOCATION", params.share_location),
+            MakeJitConstant("BACKGROUND_LABEL_ID", params.background_label_id),
+            MakeJitConstant("NMS_THRESHOLD", params.nms_threshold),
+            MakeJitConstant("ETA", params.eta),
+            MakeJitConstant("CODE_TYPE", params.code_type),
+            MakeJitConstant("VARIANCE_ENCODED_IN_TARGET", params.variance_encoded_in_target),
+            MakeJitConstant("CONFIDENCE_THRESHOLD", params.confidence_threshold),
+            MakeJitConstant("PRIOR_INFO_SIZE", params.prior_info_size),
+            MakeJitConstant("PRIOR_COORDINATES_OFFSET", params.prior_coordinates_offset),
+            MakeJitConstant("PRIOR_IS_NORMALIZED", params.prior_is_normalized),
+            MakeJitConstant("IMAGE_WIDTH", params.input_width),
+            MakeJitConstant("IMAGE_HEIGHT", params.input_height),
+            MakeJitConstant("DECREASE_LABEL_ID", params.decrease_label_id),
+            MakeJitConstant("CLIP", params.clip),
+        });
+
+        return jit;
+    }
+
+    KernelsData DetectionOutputKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const detection_output_params& orgParams = static_cast<const detection_output_params&>(params);
+        const Stage stages[] = { Stage::DECODE_BOXES, Stage::SELECT_PER_CLASS, Stage::SELECT_PER_IMAGE, Stage::WRITE_OUTPUT };
+        constexpr size_t stagesCount = sizeof(stages) / sizeof(stages[0]);
+
+        KernelData kd = KernelData::Default<detection_output_params>(params, stagesCount);
+
+        // the decoded boxes, the scores and the priors of the candidates of the classes, the numbers of the candidates
+        // of the classes followed by the numbers of the detections of the images
+        const Sizes sizes = GetSizes(orgParams);
+        const size_t candidates = sizes.batch * orgParams.num_classes * sizes.max_per_class;
+        kd.internalBufferSizes.push_back(sizes.batch * sizes.loc_classes * sizes.priors * 4 * sizeof(float));
+        kd.internalBufferSizes.push_back(candidates * sizeof(float));
+        kd.internalBufferSizes.push_back(candidates * sizeof(int32_t));
+        kd.internalBufferSizes.push_back((sizes.batch * orgParams.num_classes + sizes.batch) * sizeof(int32_t));
+
+        for (size_t i = 0; i < stagesCount; i++)
+        {
+            DispatchData runInfo = SetDefault(orgParams, stages[i]);
+
+            auto cldnn_jit = GetJitConstants(orgParams);
+            cldnn_jit.AddConstant(MakeJitConstant("STAGE", static_cast<int>(stages[i])));
+            auto entry_point = GetEntryPoint(kernelName, orgParams.layerID, options);
+            auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+            auto& kernel = kd.kernels[i];
+            FillCLKernelData(kernel, runInfo, kernelName, jit, entry_point, ROUND_ROBIN, false, false, 3);
+            for (uint32_t buffer = 0; buffer < kd.internalBufferSizes.size(); buffer++)
+            {
+                kernel.arguments.push_back({ ArgumentDescriptor::Types::INTERNAL_BUFFER, buffer });
+            }
+        }
+
+        kd.estimatedTime = FORCE_PRIORITY_9;
+
+        return{ kd };
+    }
+}
@@ -0,0 +1,84 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "common_kernel_base.h"
+#include "kernel_selector_params.h"
+
+namespace kernel_selector 
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // detection_output_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct detection_output_params : public base_params
+    {
+        detection_output_params() : base_params(KernelType::DETECTION_OUTPUT) {}
+
+        uint32_t num_classes = 0;
+        int32_t keep_top_k = 0;
+        bool share_location = true;
+        int32_t background_label_id = 0;
+        float nms_threshold = 0.f;
+        int32_t top_k = -1;
+        float eta = 1.f;
+        int32_t code_type = 0;      // the value of cldnn::prior_box_code_type
+        bool variance_encoded_in_target = false;
+        float confidence_threshold = 0.f;
+        int32_t prior_info_size = 4;
+        int32_t prior_coordinates_offset = 0;
+        bool prior_is_normalized = true;
+        int32_t input_width = 0;
+        int32_t input_height = 0;
+        bool decrease_label_id = false;
+        bool clip = false;
+
+        virtual ParamsKey GetParamsKey() const
+        {
+            return base_params::GetParamsKey();
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // detection_output_optional_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct detection_output_optional_params : optional_params
+    {
+        detection_output_optional_params() : optional_params(KernelType::DETECTION_OUTPUT) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // DetectionOutputKernelRef
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The inputs are the locations, the confidences and the prior boxes. The detections are computed by four kernels
+    // run one after another: the decoding of the boxes, the per-class top-k and NMS, the per-image keep_top_k and
+    // the writing of the output rows. The intermediate results stay in the internal buffers.
+    class DetectionOutputKernelRef : public common_kernel_base
+    {
+    public:
+        DetectionOutputKernelRef() : common_kernel_base("detection_output_gpu_ref") {}
+        virtual ~DetectionOutputKernelRef() {}
+
+        using DispatchData = CommonDispatchData;
+
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        virtual bool Validate(const Params& p, const optional_params& o) const override;
+        virtual JitConstants GetJitConstants(const detection_output_params& params) const;
+    };
+}
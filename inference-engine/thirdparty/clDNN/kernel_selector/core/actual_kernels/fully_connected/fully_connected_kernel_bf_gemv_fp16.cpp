@@ -0,0 +1,113 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "fully_connected_kernel_bf_gemv_fp16.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector 
+{
+    // the subgroup computes the 16 outputs of a slice of os_i_osv16__ai8
+    static const size_t sub_group_size = 16;
+    // the input features are split between the subgroups of the work group at most this many times
+    static const size_t max_input_split = 8;
+    // the input features are split while the work groups are fewer, so the device has enough reads in flight
+    static const size_t min_work_groups = 64;
+    // a subgroup gets at least this many steps of sub_group_size input features
+    static const size_t min_steps_per_sub_group = 4;
+
+    static size_t get_input_elements(const fully_connected_params& params)
+    {
+        const auto& input = params.inputs[0];
+        return input.LogicalSize() / input.Batch().v;
+    }
+
+    ParamsKey FullyConnected_bf_gemv_fp16::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputLayout(DataLayout::bf);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bf);
+        k.EnableBiasPerFeature();
+        k.EnableNonBiasTerm();
+        k.EnableSubGroup();
+        k.EnableSubGroupShort();
+        return k;
+    }
+
+    bool FullyConnected_bf_gemv_fp16::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!FullyConnectedKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const fully_connected_params&>(p);
+
+        // the weights are read by the block reads of the shorts
+        if (!params.engineInfo.bSubGroupShortSupport || params.weights.GetDType() != WeightsType::F16)
+        {
+            return false;
+        }
+
+        if (params.inputs[0].Batch().v != 1 || params.int8_quantization)
+        {
+            return false;
+        }
+
+        return params.engineInfo.maxWorkGroupSize >= sub_group_size * max_input_split &&
+               params.engineInfo.maxLocalMemSize >= sub_group_size * max_input_split * sizeof(float);
+    }
+
+    JitConstants FullyConnected_bf_gemv_fp16::GetJitConstants(const fully_connected_params& params, const FullyConnectedKernelBase::DispatchData& run_info) const
+    {
+        auto jit = FullyConnectedKernelBase::GetJitConstants(params, run_info);
+        jit.AddConstants({
+            MakeJitConstant("SUB_GROUP_SIZE",         run_info.lws0),
+            MakeJitConstant("INPUT_SPLIT",            run_info.lws1),
+            MakeJitConstant("INPUT_ELEMENTS_ALIGNED", RoundUp(get_input_elements(params), 8)),
+        });
+        return jit;
+    }
+
+    std::unique_ptr<FullyConnectedKernelBase::DispatchData> FullyConnected_bf_gemv_fp16::SetDefault(const fully_connected_params& arg) const
+    {
+        auto run_info = FullyConnectedKernelBase::SetDefault(arg);
+
+        const size_t slices = CeilDiv(arg.output.Feature().v, sub_group_size);
+        const size_t steps = CeilDiv(RoundUp(get_input_elements(arg), 8), sub_group_size);
+        size_t split = 1;
+        while (split < max_input_split && slices * split < min_work_groups &&
+               steps >= split * 2 * min_steps_per_sub_group)
+        {
+            split *= 2;
+        }
+
+        run_info->gws0 = slices * sub_group_size;
+        run_info->lws0 = sub_group_size;
+        run_info->gws1 = run_info->lws1 = split;
+        run_info->gws2 = run_info->lws2 = 1;
+
+        return run_info;
+    }
+
+    KernelsData FullyConnected_bf_gemv_fp16::GetKernelsData(const Params& params, const optional_params& optParams) const
+    {
+        return GetCommonKernelsData(params, optParams, DataLayout::bf, { WeightsLayout::os_i_osv16__ai8 }, FORCE_PRIORITY_3);
+    }
+}
@@ -18,6 +18,7 @@
 #include "fully_connected_kernel_bfyx_ref.h"
 #include "fully_connected_kernel_bf_io_gemm.h"
 #include "fully_connected_kernel_bs_f_bsv16_b1.h"
+#include "fully_connected_kernel_bf_gemv_fp16.h"
 #include "fully_connected_kernel_bs_f_bsv16_af8.h"
 #include "fully_connected_kernel_bs_f_bsv8_af8.h"
 #include "fully_connected_kernel_yxfb_ref.h"
@@ -38,6 +39,7 @@ namespace kernel_selector {
         Attach<FullyConnected_bfyx_Ref>();
         Attach<FullyConnected_bf_io_GEMM>();
         Attach<FullyConnected_bs_f_bsv16_b1>();
+        Attach<FullyConnected_bf_gemv_fp16>();
         Attach<FullyConnected_bs_f_bsv16_af8>();
         Attach<FullyConnected_bs_f_bsv8_af8>();
         Attach<FullyConnected_yxfb_ref>();
@@ -0,0 +1,184 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "proposal_kernel_ref.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector 
+{
+    namespace
+    {
+        enum class Stage
+        {
+            GENERATE,
+            SORT,
+            NMS
+        };
+
+        // the proposals are sorted in place by one work group, so their number is limited
+        constexpr size_t maxProposals = 1 << 20;
+        constexpr size_t maxWorkGroupSize = 256;
+
+        size_t GetProposalsCount(const proposal_params& params)
+        {
+            const auto& scores = params.inputs[0];
+            return scores.X().v * scores.Y().v * (params.anchors.size() / 4);
+        }
+
+        size_t GetSortSize(const proposal_params& params)
+        {
+            size_t size = 1;
+            while (size < GetProposalsCount(params))
+                size <<= 1;
+            return size;
+        }
+
+        size_t GetWorkGroupSize(const proposal_params& params)
+        {
+            size_t size = maxWorkGroupSize;
+            while (size > 1 && params.engineInfo.maxWorkGroupSize != 0 && size > params.engineInfo.maxWorkGroupSize)
+                size >>= 1;
+            return size;
+        }
+
+        ProposalKernelRef::DispatchData SetDefault(const proposal_params& params, Stage stage)
+        {
+            ProposalKernelRef::DispatchData kd;
+
+            kd.fp16UnitUsed = (params.inputs[0].GetDType() == Datatype::F16);
+
+            if (stage == Stage::GENERATE)
+            {
+                std::vector<size_t> global = { GetProposalsCount(params), 1, 1 };
+                auto local = GetOptimalLocalWorkGroupSizes(global);
+
+                kd.gws0 = global[0];
+                kd.lws0 = local[0];
+            }
+            else
+            {
+                kd.gws0 = kd.lws0 = GetWorkGroupSize(params);
+            }
+            kd.gws1 = kd.gws2 = 1;
+            kd.lws1 = kd.lws2 = 1;
+
+            return kd;
+        }
+    }
+
+    ParamsKey ProposalKernelRef::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool ProposalKernelRef::Validate(const Params& p, const optional_params& o) const
+    {
+        if (p.GetType() != KernelType::PROPOSAL ||
+            o.GetType() != KernelType::PROPOSAL)
+        {
+            return false;
+        }
+
+        const proposal_params& params = static_cast<const proposal_params&>(p);
+        if (params.inputs.size() != 3 || params.anchors.empty() || params.anchors.size() % 4 != 0 ||
+            params.pre_nms_topn <= 0 || params.post_nms_topn <= 0)
+        {
+            return false;
+        }
+
+        const size_t count = GetProposalsCount(params);
+        if (count == 0 || count > maxProposals)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    JitConstants ProposalKernelRef::GetJitConstants(const proposal_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+
+        jit.AddConstants({
+            MakeJitConstant("ANCHORS", params.anchors),
+            MakeJitConstant("NUM_ANCHORS", params.anchors.size() / 4),
+            MakeJitConstant("NUM_PROPOSALS", GetProposalsCount(params)),
+            MakeJitConstant("SORT_SIZE", GetSortSize(params)),
+            MakeJitConstant("WORK_GROUP_SIZE", GetWorkGroupSize(params)),
+            MakeJitConstant("IOU_THRESHOLD", params.iou_threshold),
+            MakeJitConstant("MIN_BBOX_SIZE", params.min_bbox_size),
+            MakeJitConstant("FEATURE_STRIDE", params.feature_stride),
+            MakeJitConstant("PRE_NMS_TOPN", params.pre_nms_topn),
+            MakeJitConstant("POST_NMS_TOPN", params.post_nms_topn),
+        });
+
+        return jit;
+    }
+
+    KernelsData ProposalKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const proposal_params& orgParams = static_cast<const proposal_params&>(params);
+        const Stage stages[] = { Stage::GENERATE, Stage::SORT, Stage::NMS };
+        constexpr size_t stagesCount = sizeof(stages) / sizeof(stages[0]);
+
+        KernelData kd = KernelData::Default<proposal_params>(params, stagesCount);
+
+        // the boxes and the scores of the proposals, the sorted scores and indices of the proposals, the kept boxes
+        const size_t count = GetProposalsCount(orgParams);
+        const size_t sortSize = GetSortSize(orgParams);
+        kd.internalBufferSizes.push_back(count * 4 * sizeof(float));
+        kd.internalBufferSizes.push_back(count * sizeof(float));
+        kd.internalBufferSizes.push_back(sortSize * sizeof(float));
+        kd.internalBufferSizes.push_back(sortSize * sizeof(int32_t));
+        kd.internalBufferSizes.push_back(orgParams.post_nms_topn * 4 * sizeof(float));
+
+        for (size_t i = 0; i < stagesCount; i++)
+        {
+            DispatchData runInfo = SetDefault(orgParams, stages[i]);
+
+            auto cldnn_jit = GetJitConstants(orgParams);
+            cldnn_jit.AddConstant(MakeJitConstant("STAGE", static_cast<int>(stages[i])));
+            auto entry_point = GetEntryPoint(kernelName, orgParams.layerID, options);
+            auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+            auto& kernel = kd.kernels[i];
+            FillCLKernelData(kernel, runInfo, kernelName, jit, entry_point, ROUND_ROBIN, false, false, 3);
+            for (uint32_t buffer = 0; buffer < kd.internalBufferSizes.size(); buffer++)
+            {
+                kernel.arguments.push_back({ ArgumentDescriptor::Types::INTERNAL_BUFFER, buffer });
+            }
+        }
+
+        kd.estimatedTime = FORCE_PRIORITY_9;
+
+        return{ kd };
+    }
+}
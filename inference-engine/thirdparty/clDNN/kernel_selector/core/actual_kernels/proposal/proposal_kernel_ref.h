@@ -0,0 +1,72 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "common_kernel_base.h"
+#include "kernel_selector_params.h"
+
+namespace kernel_selector 
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // proposal_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct proposal_params : public base_params
+    {
+        proposal_params() : base_params(KernelType::PROPOSAL) {}
+
+        std::vector<float> anchors;     // [start_x, start_y, end_x, end_y] of each anchor
+        float iou_threshold = 0.f;
+        int32_t min_bbox_size = 0;
+        int32_t feature_stride = 1;
+        int32_t pre_nms_topn = 0;
+        int32_t post_nms_topn = 0;
+
+        virtual ParamsKey GetParamsKey() const
+        {
+            return base_params::GetParamsKey();
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // proposal_optional_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct proposal_optional_params : optional_params
+    {
+        proposal_optional_params() : optional_params(KernelType::PROPOSAL) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ProposalKernelRef
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The inputs are the class scores, the box deltas and the image info. The proposals are generated for all the
+    // anchors in parallel, then a single work group sorts them (bitonic sort) and runs the NMS over the best ones.
+    class ProposalKernelRef : public common_kernel_base
+    {
+    public:
+        ProposalKernelRef() : common_kernel_base("proposal_gpu_ref") {}
+        virtual ~ProposalKernelRef() {}
+
+        using DispatchData = CommonDispatchData;
+
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        virtual bool Validate(const Params& p, const optional_params& o) const override;
+        virtual JitConstants GetJitConstants(const proposal_params& params) const;
+    };
+}
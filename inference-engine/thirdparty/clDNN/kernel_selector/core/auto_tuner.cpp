@@ -19,6 +19,8 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <cstdlib>
+#include <vector>
 
  
 namespace kernel_selector 
@@ -34,57 +36,73 @@ namespace kernel_selector
             // Load tuning file to cache
             onlineCache[tuningFilePath] = {};
 
+            const std::string sectionHeader = "device " + deviceID + " " + driverVersion + " " + hostVersion;
             std::ifstream tuningFile(tuningFilePath);
-            std::string cachedDeviceId;
-            std::string cachedDriverVersion;
-            std::string cachedHostVersion;
-            std::string cachedhash;
-            std::string cachedkernelName;
-            int cachedIndex;
-            std::string line;
 
             if (tuningFile) // Tuning file exists
             {
-                // Read device ID
-                tuningFile >> cachedDeviceId;
-                if (!tuningFile.good() || (cachedDeviceId.compare(deviceID) != 0))
-                {
-                    throw std::runtime_error("Tuning file bad structure or wrong device ID. Re-generate cache in TUNE_AND_CACHE mode.");
-                }
+                std::string lastSectionHeader;
+                std::vector<std::string> legacyHeader;
+                bool deviceSection = false;
+                std::string line;
 
-                // Read driver version
-                tuningFile >> cachedDriverVersion;
-                if (!tuningFile.good() || (cachedDriverVersion.compare(driverVersion) != 0))
+                // Read optimal kernel/config data of the sections of this device
+                while (std::getline(tuningFile, line))
                 {
-                    throw std::runtime_error("Tuning file bad structure or wrong driver version. Re-generate cache in TUNE_AND_CACHE mode.");
-                }
+                    std::istringstream iss(line);
+                    std::vector<std::string> tokens;
+                    std::string token;
+                    while (iss >> token)
+                    {
+                        tokens.push_back(token);
+                    }
 
-                // Read host version
-                tuningFile >> cachedHostVersion;
-                if (!tuningFile.good() || (cachedHostVersion.compare(hostVersion) != 0))
-                {
-                    throw std::runtime_error("Tuning file bad structure or wrong host version. Re-generate cache in TUNE_AND_CACHE mode.");
-                }
+                    if (tokens.empty())
+                    {
+                        continue;
+                    }
 
-                // Read optimal kernel/config data 
-                while (std::getline(tuningFile, line))
-                {
-                    if (line.empty())
+                    if (tokens.size() == 4 && tokens[0] == "device")
                     {
+                        lastSectionHeader = line;
+                        deviceSection = (tokens[1] == deviceID);
                         continue;
                     }
-                    std::istringstream iss(line);
-                    iss >> cachedhash >> cachedkernelName >> cachedIndex;
-                    if (iss.fail())
+
+                    // The header of the old format: device ID, driver version and host version on separate lines
+                    if (tokens.size() == 1)
+                    {
+                        legacyHeader.push_back(tokens[0]);
+                        if (legacyHeader.size() == 3)
+                        {
+                            lastSectionHeader = "device " + legacyHeader[0] + " " + legacyHeader[1] + " " + legacyHeader[2];
+                            deviceSection = (legacyHeader[0] == deviceID);
+                            legacyHeader.clear();
+                        }
+                        continue;
+                    }
+
+                    char* indexEnd = nullptr;
+                    const long cachedIndex = tokens.size() == 3 ? std::strtol(tokens[2].c_str(), &indexEnd, 10) : 0;
+                    if (tokens.size() != 3 || !legacyHeader.empty() || lastSectionHeader.empty() || *indexEnd != '\0')
                     {
                         throw std::runtime_error("Tuning file bad structure. Re-generate cache in TUNE_AND_CACHE mode.");
                     }
 
                     // Update tuning cache 
-                    onlineCache[tuningFilePath].td[cachedhash] = std::make_tuple(cachedkernelName, cachedIndex);
+                    if (deviceSection)
+                    {
+                        onlineCache[tuningFilePath].td[tokens[0]] = std::make_tuple(tokens[1], static_cast<int>(cachedIndex));
+                    }
                 }
 
                 tuningFile.close();
+
+                // The kernels tuned here are stored in a section of their own
+                if (lastSectionHeader != sectionHeader)
+                {
+                    pendingSections[tuningFilePath] = sectionHeader;
+                }
             }
             else // Tuning file doesn't exist
             {
@@ -96,9 +114,7 @@ namespace kernel_selector
                 // Create a new tuning file and write the versions
                 std::ofstream newTuningFile(tuningFilePath, std::ofstream::out);
 
-                newTuningFile << deviceID << "\n";
-                newTuningFile << driverVersion << "\n";
-                newTuningFile << hostVersion << "\n";
+                newTuningFile << sectionHeader << "\n";
             }
         }
 
@@ -130,6 +146,12 @@ namespace kernel_selector
         {
             throw std::runtime_error("Tuning file: " + tuningFilePath + " could not be written!");
         }
+        auto const& pendingSection = pendingSections.find(tuningFilePath);
+        if (pendingSection != pendingSections.end())
+        {
+            cachedKernelsFile << pendingSection->second << "\n";
+            pendingSections.erase(pendingSection);
+        }
         cachedKernelsFile << hash << " ";
         cachedKernelsFile << implementationName << " ";
         cachedKernelsFile << tuneIndex << "\n";
@@ -154,4 +176,10 @@ namespace kernel_selector
             return hashData->second;
         }
     }
+
+    tuning_statistics& AutoTuner::GetStatistics()
+    {
+        static thread_local tuning_statistics statistics;
+        return statistics;
+    }
 }
@@ -27,6 +27,15 @@ namespace kernel_selector
         std::map<std::string, std::tuple<std::string, int>> td;
     };
 
+    // Counts how the kernels selected by the auto tuner were found, per thread
+    struct tuning_statistics
+    {
+        uint64_t onlineCacheHits = 0;   // found in the tuning file
+        uint64_t offlineCacheHits = 0;  // found in the offline cache of the device
+        uint64_t cacheMisses = 0;       // tuned on-line or taken from the default path
+        uint64_t lookupTime = 0;        // nanoseconds spent in the lookups of the tuning file and the offline cache
+    };
+
     class AutoTuner
     {
     public:
@@ -35,10 +44,25 @@ namespace kernel_selector
         void StoreKernel(const std::string& tuningFilePath, const std::string& hash, const std::string& implementationName, const int tuneIndex);
         std::tuple<std::string, int> LoadKernelOffline(const std::string& deviceID, const std::string& hash);
 
+        // The statistics of the kernels selected by the calling thread so far
+        static tuning_statistics& GetStatistics();
+
     private:    
         std::map<std::string, tuning_data> onlineCache; // Tuning file name -> kernel/config per hash (hash -> [implementation name, tuning index])
+        std::map<std::string, std::string> pendingSections; // Tuning file name -> section header to write before the first stored kernel
         std::mutex mutex; // Mutex to synchronize cache updates
         
+        /*
+            The tuning file consists of the sections of the devices, so the files tuned on several machines can be merged by concatenating them:
+               device <device ID> <driver version> <host version>
+               <hash> <implementation name> <tuning index>
+               ...
+            Only the sections of the current device ID are loaded, the later entries of a hash override the earlier ones.
+            The kernels tuned with another driver or host version are still used, since a kernel which is no longer valid falls back to the default path.
+            The plans of the network-level tuning are stored as entries too, their hash is network_<key of the topology>.
+            The files written by the previous versions (the device ID, driver version and host version on three lines followed by the entries) are read as one section.
+        */
+
         /*
             The offline cache contains for each hash (that is based on the node params) the best kernel/config per device id.
             This cache can be ignored by setting ENABLE_OFFLINE_TUNING_CACHE to 0 in kernel_selector.cpp (in this case the default path will be chosen).
@@ -0,0 +1,86 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "include/include_all.cl"
+
+#define SIMD_SIZE 16
+
+// The sub-group computes 16 output features (a feature per work item) of 16 positions of the flattened x and y.
+// Each work item loads the input of one of the positions, the input is shared by the shuffles, so the weights and
+// the input are read once per sub-group. The eltwise input is added to the result before the activation.
+__attribute__((intel_reqd_sub_group_size(SIMD_SIZE)))
+__attribute__((reqd_work_group_size(1, SIMD_SIZE, 1)))
+KERNEL(convolution_gpu_bfyx_1x1_eltwise)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global FILTER_TYPE* weights,
+#if BIAS_TERM
+    const __global BIAS_TYPE* biases,
+#endif
+    uint split_idx,
+    const __global INPUT1_TYPE* eltw_input)
+{
+    const uint xy_block = get_group_id(0) * SIMD_SIZE;
+    const uint lane = get_sub_group_local_id();
+    const uint f = get_global_id(1);
+    const uint b = get_global_id(2);
+
+    const uint xy = xy_block + lane;
+    const bool xy_valid = xy < OUTPUT_SIZE_X * OUTPUT_SIZE_Y;
+    uint input_idx = INPUT0_OFFSET + b * INPUT0_BATCH_PITCH + (xy / INPUT0_SIZE_X) * INPUT0_Y_PITCH + (xy % INPUT0_SIZE_X) * INPUT0_X_PITCH;
+    // os_iyx_osv16 of the 1x1 filter: the features of the block are interleaved for each input feature
+    uint filter_idx = (f / SIMD_SIZE) * FILTER_IFM_NUM * SIMD_SIZE + f % SIMD_SIZE;
+
+    UNIT_TYPE dotProd[SIMD_SIZE] = { 0 };
+    for (uint k = 0; k < FILTER_IFM_NUM; ++k)
+    {
+        const UNIT_TYPE in = xy_valid ? input[input_idx] : 0;
+        const UNIT_TYPE w = weights[filter_idx];
+        __attribute__((opencl_unroll_hint(SIMD_SIZE)))
+        for (uint i = 0; i < SIMD_SIZE; ++i)
+        {
+            dotProd[i] = mad(w, intel_sub_group_shuffle(in, i), dotProd[i]);
+        }
+        input_idx += INPUT0_FEATURE_PITCH;
+        filter_idx += SIMD_SIZE;
+    }
+
+    // the features of the padded filter are computed for the shuffles only
+    if (f >= OUTPUT_FEATURE_NUM)
+        return;
+
+#if BIAS_TERM
+    const UNIT_TYPE bias = biases[f];
+#endif
+    for (uint i = 0; i < SIMD_SIZE; ++i)
+    {
+        const uint out_xy = xy_block + i;
+        if (out_xy >= OUTPUT_SIZE_X * OUTPUT_SIZE_Y)
+            break;
+
+        const uint x = out_xy % OUTPUT_SIZE_X;
+        const uint y = out_xy / OUTPUT_SIZE_X;
+        UNIT_TYPE result = dotProd[i];
+#if BIAS_TERM
+        result += bias;
+#endif
+        result += eltw_input[INPUT1_OFFSET + b * INPUT1_BATCH_PITCH + f * INPUT1_FEATURE_PITCH + y * INPUT1_Y_PITCH + x * INPUT1_X_PITCH];
+        output[OUTPUT_OFFSET + b * OUTPUT_BATCH_PITCH + f * OUTPUT_FEATURE_PITCH + y * OUTPUT_Y_PITCH + x * OUTPUT_X_PITCH] = ACTIVATION(result, NL_M, NL_N);
+    }
+}
+
+#undef SIMD_SIZE
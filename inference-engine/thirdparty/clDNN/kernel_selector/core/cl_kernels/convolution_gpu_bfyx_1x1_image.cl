@@ -0,0 +1,100 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "include/include_all.cl"
+
+__constant sampler_t weights_sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP | CLK_FILTER_NEAREST;
+
+#if FP16_UNIT_USED
+    #define READ_WEIGHTS(coord) read_imageh(weights, weights_sampler, (coord))
+#else
+    #define READ_WEIGHTS(coord) read_imagef(weights, weights_sampler, (coord))
+#endif
+
+// The weights are the image_2d_weights_c4_fyx_b: the texel (o, k / 4) holds the input features k .. k + 3 of the output feature o.
+// Each work item computes OUTPUT_BLOCK_WIDTH consecutive outputs of a row for FEATURES_PER_ITEM output features, so the input
+// is loaded once for all of them. The texels beyond the output features are read as zeros by the clamp of the sampler.
+KERNEL(convolution_gpu_bfyx_1x1_image)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    __read_only image2d_t weights,
+#if BIAS_TERM
+    const __global BIAS_TYPE* biases,
+#endif
+    uint split_idx)
+{
+    const uint x_block = get_global_id(0) * OUTPUT_BLOCK_WIDTH;
+    const uint y = get_global_id(1);
+    const uint f_blocks = (OUTPUT_FEATURE_NUM + FEATURES_PER_ITEM - 1) / FEATURES_PER_ITEM;
+    const uint f = (get_global_id(2) % f_blocks) * FEATURES_PER_ITEM;
+    const uint b = get_global_id(2) / f_blocks;
+
+    const uint input_offset = INPUT0_OFFSET + b * INPUT0_BATCH_PITCH + y * STRIDE_SIZE_Y * INPUT0_Y_PITCH;
+
+    MAKE_VECTOR_TYPE(UNIT_TYPE, 4) dotProd[OUTPUT_BLOCK_WIDTH] = { 0 };
+    for (uint k = 0; k < INPUT0_FEATURE_NUM; k += 4)
+    {
+        const MAKE_VECTOR_TYPE(UNIT_TYPE, 4) w0 = READ_WEIGHTS((int2)(f, k / 4));
+        const MAKE_VECTOR_TYPE(UNIT_TYPE, 4) w1 = READ_WEIGHTS((int2)(f + 1, k / 4));
+        const MAKE_VECTOR_TYPE(UNIT_TYPE, 4) w2 = READ_WEIGHTS((int2)(f + 2, k / 4));
+        const MAKE_VECTOR_TYPE(UNIT_TYPE, 4) w3 = READ_WEIGHTS((int2)(f + 3, k / 4));
+
+        const uint input_row = input_offset + k * INPUT0_FEATURE_PITCH;
+        __attribute__((opencl_unroll_hint(OUTPUT_BLOCK_WIDTH)))
+        for (uint o = 0; o < OUTPUT_BLOCK_WIDTH; ++o)
+        {
+            const uint in_x = min((x_block + o) * STRIDE_SIZE_X, (uint)(INPUT0_SIZE_X - 1));
+            const uint idx = input_row + in_x * INPUT0_X_PITCH;
+            const MAKE_VECTOR_TYPE(UNIT_TYPE, 4) in = (MAKE_VECTOR_TYPE(UNIT_TYPE, 4))(
+                input[idx],
+                input[idx + INPUT0_FEATURE_PITCH],
+                input[idx + 2 * INPUT0_FEATURE_PITCH],
+                input[idx + 3 * INPUT0_FEATURE_PITCH]);
+            dotProd[o].s0 += dot(in, w0);
+            dotProd[o].s1 += dot(in, w1);
+            dotProd[o].s2 += dot(in, w2);
+            dotProd[o].s3 += dot(in, w3);
+        }
+    }
+
+    for (uint i = 0; i < FEATURES_PER_ITEM; ++i)
+    {
+        const uint out_f = f + i;
+        if (out_f >= OUTPUT_FEATURE_NUM)
+            break;
+
+#if BIAS_TERM
+        const UNIT_TYPE bias = biases[out_f];
+#endif
+        const uint output_offset = OUTPUT_OFFSET + b * OUTPUT_BATCH_PITCH + out_f * OUTPUT_FEATURE_PITCH + y * OUTPUT_Y_PITCH;
+        for (uint o = 0; o < OUTPUT_BLOCK_WIDTH; ++o)
+        {
+            const uint x = x_block + o;
+            if (x >= OUTPUT_SIZE_X)
+                break;
+
+            const MAKE_VECTOR_TYPE(UNIT_TYPE, 4) acc = dotProd[o];
+            UNIT_TYPE result = i == 0 ? acc.s0 : i == 1 ? acc.s1 : i == 2 ? acc.s2 : acc.s3;
+#if BIAS_TERM
+            result += bias;
+#endif
+            output[output_offset + x * OUTPUT_X_PITCH] = ACTIVATION(result, NL_M, NL_N);
+        }
+    }
+}
+
+#undef READ_WEIGHTS
@@ -0,0 +1,91 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "include/include_all.cl"
+
+// Each work item computes OUTPUT_BLOCK_WIDTH consecutive outputs of a row of one output feature. The group of the
+// convolution has a few input features, so every filter value is loaded once for all the outputs of the block.
+// The borders of the input are checked, the input needs no padding for any filter size, stride and dilation.
+KERNEL(convolution_gpu_bfyx_depthwise)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global FILTER_TYPE* weights,
+#if BIAS_TERM
+    const __global BIAS_TYPE* biases,
+#endif
+    uint split_idx)
+{
+    const uint x_block = get_global_id(0) * OUTPUT_BLOCK_WIDTH;
+    const uint y = get_global_id(1);
+    const uint f = get_global_id(2) % OUTPUT_FEATURE_NUM;
+    const uint b = get_global_id(2) / OUTPUT_FEATURE_NUM;
+
+#if DEPTHWISE_SEPARABLE_OPT
+    // the filters of all the groups are concatenated and the kernel is run once for all of them
+    const uint in_f = (f / (OUTPUT_FEATURE_NUM / FILTER_ARRAY_NUM)) * FILTER_IFM_NUM;
+    const uint out_f = f;
+#else
+    const uint in_f = split_idx * FILTER_IFM_NUM;
+    const uint out_f = split_idx * OUTPUT_FEATURE_NUM + f;
+#endif
+
+    const int input_x = (int)(x_block * STRIDE_SIZE_X) - PADDING_SIZE_X;
+    const int input_y = (int)(y * STRIDE_SIZE_Y) - PADDING_SIZE_Y;
+    const uint input_offset = INPUT0_OFFSET + b * INPUT0_BATCH_PITCH + in_f * INPUT0_FEATURE_PITCH;
+    const uint filter_offset = f * FILTER_OFM_PITCH;
+
+    UNIT_TYPE dotProd[OUTPUT_BLOCK_WIDTH] = { 0 };
+    for (uint k = 0; k < FILTER_IFM_NUM; ++k)
+    {
+        for (uint j = 0; j < FILTER_SIZE_Y; ++j)
+        {
+            const int in_y = input_y + (int)(j * DILATION_SIZE_Y);
+            if (in_y < 0 || in_y >= INPUT0_SIZE_Y)
+                continue;
+
+            const uint input_row = input_offset + k * INPUT0_FEATURE_PITCH + in_y * INPUT0_Y_PITCH;
+            for (uint i = 0; i < FILTER_SIZE_X; ++i)
+            {
+                const UNIT_TYPE w = weights[filter_offset + k * FILTER_IFM_PITCH + j * FILTER_Y_PITCH + i * FILTER_X_PITCH];
+                __attribute__((opencl_unroll_hint(OUTPUT_BLOCK_WIDTH)))
+                for (uint o = 0; o < OUTPUT_BLOCK_WIDTH; ++o)
+                {
+                    const int in_x = input_x + (int)(o * STRIDE_SIZE_X + i * DILATION_SIZE_X);
+                    if (in_x >= 0 && in_x < INPUT0_SIZE_X)
+                        dotProd[o] = mad(input[input_row + in_x * INPUT0_X_PITCH], w, dotProd[o]);
+                }
+            }
+        }
+    }
+
+#if BIAS_TERM
+    const UNIT_TYPE bias = biases[f];
+#endif
+    const uint output_offset = OUTPUT_OFFSET + b * OUTPUT_BATCH_PITCH + out_f * OUTPUT_FEATURE_PITCH + y * OUTPUT_Y_PITCH;
+    for (uint o = 0; o < OUTPUT_BLOCK_WIDTH; ++o)
+    {
+        const uint x = x_block + o;
+        if (x >= OUTPUT_SIZE_X)
+            break;
+
+        UNIT_TYPE result = dotProd[o];
+#if BIAS_TERM
+        result += bias;
+#endif
+        output[output_offset + x * OUTPUT_X_PITCH] = ACTIVATION(result, NL_M, NL_N);
+    }
+}
@@ -0,0 +1,331 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "include/include_all.cl"
+
+// The stages of the detection output, each stage is a kernel run after the previous one
+#define STAGE_DECODE_BOXES      0
+#define STAGE_SELECT_PER_CLASS  1
+#define STAGE_SELECT_PER_IMAGE  2
+#define STAGE_WRITE_OUTPUT      3
+
+// The values of cldnn::prior_box_code_type
+#define CODE_TYPE_CORNER        0
+#define CODE_TYPE_CENTER_SIZE   1
+#define CODE_TYPE_CORNER_SIZE   2
+
+#define PRIOR_BOX_SIZE          4
+#define OUTPUT_ROW_SIZE         7
+
+// The candidate a is worse than b: a lower score, the later prior of the equal scores
+inline bool FUNC(is_worse)(float score_a, int prior_a, float score_b, int prior_b)
+{
+    return score_a < score_b || (score_a == score_b && prior_a > prior_b);
+}
+
+// Restores the min-heap (the worst candidate at the root) of the size below the node
+inline void FUNC(sift_down)(__global float* scores, __global int* priors, int node, int size)
+{
+    const float score = scores[node];
+    const int prior = priors[node];
+    for (int child = 2 * node + 1; child < size; child = 2 * node + 1)
+    {
+        if (child + 1 < size && FUNC_CALL(is_worse)(scores[child + 1], priors[child + 1], scores[child], priors[child]))
+            child++;
+        if (!FUNC_CALL(is_worse)(scores[child], priors[child], score, prior))
+            break;
+        scores[node] = scores[child];
+        priors[node] = priors[child];
+        node = child;
+    }
+    scores[node] = score;
+    priors[node] = prior;
+}
+
+inline void FUNC(sift_up)(__global float* scores, __global int* priors, int node)
+{
+    const float score = scores[node];
+    const int prior = priors[node];
+    while (node > 0)
+    {
+        const int parent = (node - 1) / 2;
+        if (!FUNC_CALL(is_worse)(score, prior, scores[parent], priors[parent]))
+            break;
+        scores[node] = scores[parent];
+        priors[node] = priors[parent];
+        node = parent;
+    }
+    scores[node] = score;
+    priors[node] = prior;
+}
+
+inline float FUNC(overlap)(__global const float* box1, __global const float* box2)
+{
+    const bool intersecting = (box1[0] < box2[2]) & (box2[0] < box1[2]) & (box1[1] < box2[3]) & (box2[1] < box1[3]);
+    if (!intersecting)
+        return 0.0f;
+
+    const float intersect_width = fmin(box1[2], box2[2]) - fmax(box1[0], box2[0]);
+    const float intersect_height = fmin(box1[3], box2[3]) - fmax(box1[1], box2[1]);
+    const float intersect_size = intersect_width * intersect_height;
+    const float area1 = (box1[2] - box1[0]) * (box1[3] - box1[1]);
+    const float area2 = (box2[2] - box2[0]) * (box2[3] - box2[1]);
+    return intersect_size / (area1 + area2 - intersect_size);
+}
+
+KERNEL (detection_output_gpu_ref)(
+    const __global INPUT0_TYPE* input_location,
+    const __global INPUT1_TYPE* input_confidence,
+    const __global INPUT2_TYPE* input_prior_box,
+    __global OUTPUT_TYPE* output,
+    __global float* boxes,
+    __global float* candidate_scores,
+    __global int* candidate_priors,
+    __global int* counts)
+{
+#if STAGE == STAGE_DECODE_BOXES
+    // boxes: image -> location class -> prior -> [xmin, ymin, xmax, ymax]
+    const int prior = get_global_id(0);
+    const int cls = get_global_id(1);
+    const int image = get_global_id(2);
+
+    const int location_idx = INPUT0_OFFSET + image * INPUT0_BATCH_PITCH + ((prior * NUM_LOC_CLASSES + cls) * PRIOR_BOX_SIZE) * INPUT0_FEATURE_PITCH;
+    float bbox[PRIOR_BOX_SIZE];
+    for (int i = 0; i < PRIOR_BOX_SIZE; i++)
+        bbox[i] = (float)input_location[location_idx + i * INPUT0_FEATURE_PITCH];
+
+    const int prior_idx = INPUT2_OFFSET + prior * PRIOR_INFO_SIZE + PRIOR_COORDINATES_OFFSET;
+    float prior_box[PRIOR_BOX_SIZE];
+    float variance[PRIOR_BOX_SIZE];
+    for (int i = 0; i < PRIOR_BOX_SIZE; i++)
+    {
+        prior_box[i] = (float)input_prior_box[prior_idx + i];
+#if VARIANCE_ENCODED_IN_TARGET
+        variance[i] = 1.0f;
+#else
+        // the variances follow the boxes of all the priors
+        variance[i] = (float)input_prior_box[prior_idx + NUM_PRIORS * PRIOR_INFO_SIZE + i];
+#endif
+    }
+#if !PRIOR_IS_NORMALIZED
+    prior_box[0] /= IMAGE_WIDTH;
+    prior_box[1] /= IMAGE_HEIGHT;
+    prior_box[2] /= IMAGE_WIDTH;
+    prior_box[3] /= IMAGE_HEIGHT;
+#endif
+
+    float decoded[PRIOR_BOX_SIZE];
+#if CODE_TYPE == CODE_TYPE_CORNER
+    for (int i = 0; i < PRIOR_BOX_SIZE; i++)
+        decoded[i] = prior_box[i] + variance[i] * bbox[i];
+#else
+    const float prior_width = prior_box[2] - prior_box[0];
+    const float prior_height = prior_box[3] - prior_box[1];
+#if CODE_TYPE == CODE_TYPE_CENTER_SIZE
+    const float prior_center_x = (prior_box[0] + prior_box[2]) / 2.0f;
+    const float prior_center_y = (prior_box[1] + prior_box[3]) / 2.0f;
+    const float center_x = variance[0] * bbox[0] * prior_width + prior_center_x;
+    const float center_y = variance[1] * bbox[1] * prior_height + prior_center_y;
+    const float width = exp(variance[2] * bbox[2]) * prior_width;
+    const float height = exp(variance[3] * bbox[3]) * prior_height;
+    decoded[0] = center_x - width / 2.0f;
+    decoded[1] = center_y - height / 2.0f;
+    decoded[2] = center_x + width / 2.0f;
+    decoded[3] = center_y + height / 2.0f;
+#else
+    decoded[0] = prior_box[0] + variance[0] * bbox[0] * prior_width;
+    decoded[1] = prior_box[1] + variance[1] * bbox[1] * prior_height;
+    decoded[2] = prior_box[2] + variance[2] * bbox[2] * prior_width;
+    decoded[3] = prior_box[3] + variance[3] * bbox[3] * prior_height;
+#endif
+#endif
+
+    __global float* box = boxes + ((image * NUM_LOC_CLASSES + cls) * NUM_PRIORS + prior) * PRIOR_BOX_SIZE;
+    for (int i = 0; i < PRIOR_BOX_SIZE; i++)
+    {
+#if CLIP
+        box[i] = fmax(0.0f, fmin(1.0f, decoded[i]));
+#else
+        box[i] = decoded[i];
+#endif
+    }
+
+#elif STAGE == STAGE_SELECT_PER_CLASS
+    // the candidates of a class sorted by the score, at most MAX_PER_CLASS of them, and the NMS over them
+    const int cls = get_global_id(0);
+    const int image = get_global_id(1);
+
+    __global float* scores = candidate_scores + (image * NUM_CLASSES + cls) * MAX_PER_CLASS;
+    __global int* priors = candidate_priors + (image * NUM_CLASSES + cls) * MAX_PER_CLASS;
+    if (cls == BACKGROUND_LABEL_ID)
+    {
+        counts[image * NUM_CLASSES + cls] = 0;
+        return;
+    }
+
+    // the heap keeps the best MAX_PER_CLASS candidates with the worst of them at the root
+    int count = 0;
+    const int confidence_idx = INPUT1_OFFSET + image * INPUT1_BATCH_PITCH + cls * INPUT1_FEATURE_PITCH;
+    for (int prior = 0; prior < NUM_PRIORS; prior++)
+    {
+        const float score = (float)input_confidence[confidence_idx + prior * NUM_CLASSES * INPUT1_FEATURE_PITCH];
+        if (score <= CONFIDENCE_THRESHOLD)
+            continue;
+
+        if (count < MAX_PER_CLASS)
+        {
+            scores[count] = score;
+            priors[count] = prior;
+            FUNC_CALL(sift_up)(scores, priors, count);
+            count++;
+        }
+        else if (FUNC_CALL(is_worse)(scores[0], priors[0], score, prior))
+        {
+            scores[0] = score;
+            priors[0] = prior;
+            FUNC_CALL(sift_down)(scores, priors, 0, count);
+        }
+    }
+
+    // the heap sort moves the worst candidates to the end, so the best candidate is the first one
+    for (int last = count - 1; last > 0; last--)
+    {
+        const float score = scores[last];
+        const int prior = priors[last];
+        scores[last] = scores[0];
+        priors[last] = priors[0];
+        scores[0] = score;
+        priors[0] = prior;
+        FUNC_CALL(sift_down)(scores, priors, 0, last);
+    }
+
+    __global const float* class_boxes = boxes + (image * NUM_LOC_CLASSES + (SHARE_LOCATION ? 0 : cls)) * NUM_PRIORS * PRIOR_BOX_SIZE;
+    float adaptive_threshold = NMS_THRESHOLD;
+    int kept = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const int prior = priors[i];
+        bool keep = true;
+        for (int j = 0; j < kept && keep; j++)
+        {
+            keep = FUNC_CALL(overlap)(class_boxes + prior * PRIOR_BOX_SIZE, class_boxes + priors[j] * PRIOR_BOX_SIZE) <= adaptive_threshold;
+        }
+        if (keep)
+        {
+            scores[kept] = scores[i];
+            priors[kept] = prior;
+            kept++;
+            if (ETA < 1.0f && adaptive_threshold > 0.5f)
+                adaptive_threshold *= ETA;
+        }
+    }
+    counts[image * NUM_CLASSES + cls] = kept;
+
+#elif STAGE == STAGE_SELECT_PER_IMAGE
+    // keeps the KEEP_TOP_K best detections of all the classes, the lists of the classes are cut to the kept ones
+    const int image = get_global_id(0);
+    __global int* class_counts = counts + image * NUM_CLASSES;
+
+    int total = 0;
+    for (int cls = 0; cls < NUM_CLASSES; cls++)
+        total += class_counts[cls];
+
+    if (total > KEEP_TOP_K)
+    {
+        // each class list is sorted, so the best detections are taken from the heads of the lists
+        int taken[NUM_CLASSES];
+        for (int cls = 0; cls < NUM_CLASSES; cls++)
+            taken[cls] = 0;
+
+        for (int i = 0; i < KEEP_TOP_K; i++)
+        {
+            int best = -1;
+            float best_score = 0.0f;
+            for (int cls = 0; cls < NUM_CLASSES; cls++)
+            {
+                if (taken[cls] == class_counts[cls])
+                    continue;
+                const float score = candidate_scores[(image * NUM_CLASSES + cls) * MAX_PER_CLASS + taken[cls]];
+                if (best == -1 || score > best_score)
+                {
+                    best = cls;
+                    best_score = score;
+                }
+            }
+            taken[best]++;
+        }
+
+        for (int cls = 0; cls < NUM_CLASSES; cls++)
+            class_counts[cls] = taken[cls];
+        total = KEEP_TOP_K;
+    }
+    counts[NUM_IMAGES * NUM_CLASSES + image] = total;
+
+#elif STAGE == STAGE_WRITE_OUTPUT
+    // the detections of the images follow each other, ordered by the label, the rest of the rows is marked by image -1
+    const int row = get_global_id(0);
+    __global OUTPUT_TYPE* out = output + OUTPUT_OFFSET + row * OUTPUT_ROW_SIZE;
+
+    int first = 0;
+    int image = 0;
+    for (; image < NUM_IMAGES; image++)
+    {
+        const int total = counts[NUM_IMAGES * NUM_CLASSES + image];
+        if (row < first + total)
+            break;
+        first += total;
+    }
+
+    if (image == NUM_IMAGES)
+    {
+        out[0] = TO_OUTPUT_TYPE(-1.0f);
+        for (int i = 1; i < OUTPUT_ROW_SIZE; i++)
+            out[i] = TO_OUTPUT_TYPE(0.0f);
+        return;
+    }
+
+    int idx = row - first;
+    int cls = 0;
+    for (; cls < NUM_CLASSES - 1; cls++)
+    {
+        const int count = counts[image * NUM_CLASSES + cls];
+        if (idx < count)
+            break;
+        idx -= count;
+    }
+
+    const int candidate = (image * NUM_CLASSES + cls) * MAX_PER_CLASS + idx;
+    const int prior = candidate_priors[candidate];
+    __global const float* box = boxes + ((image * NUM_LOC_CLASSES + (SHARE_LOCATION ? 0 : cls)) * NUM_PRIORS + prior) * PRIOR_BOX_SIZE;
+
+    out[0] = TO_OUTPUT_TYPE((float)image);
+    out[1] = TO_OUTPUT_TYPE(DECREASE_LABEL_ID ? (float)cls - 1.0f : (float)cls);
+    out[2] = TO_OUTPUT_TYPE(candidate_scores[candidate]);
+    for (int i = 0; i < PRIOR_BOX_SIZE; i++)
+        out[3 + i] = TO_OUTPUT_TYPE(box[i]);
+#endif
+}
+
+#undef STAGE_DECODE_BOXES
+#undef STAGE_SELECT_PER_CLASS
+#undef STAGE_SELECT_PER_IMAGE
+#undef STAGE_WRITE_OUTPUT
+#undef CODE_TYPE_CORNER
+#undef CODE_TYPE_CENTER_SIZE
+#undef CODE_TYPE_CORNER_SIZE
+#undef PRIOR_BOX_SIZE
+#undef OUTPUT_ROW_SIZE
@@ -0,0 +1,98 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "include/include_all.cl"
+
+// the weights w of the 8 input features starting at k, the lane n of the subgroup holds the input feature k + n in x
+#define MAD8(acc, w, x, k)                                               \
+    acc = mad((float)(w).s0, (float)intel_sub_group_shuffle(x, (k) + 0), acc); \
+    acc = mad((float)(w).s1, (float)intel_sub_group_shuffle(x, (k) + 1), acc); \
+    acc = mad((float)(w).s2, (float)intel_sub_group_shuffle(x, (k) + 2), acc); \
+    acc = mad((float)(w).s3, (float)intel_sub_group_shuffle(x, (k) + 3), acc); \
+    acc = mad((float)(w).s4, (float)intel_sub_group_shuffle(x, (k) + 4), acc); \
+    acc = mad((float)(w).s5, (float)intel_sub_group_shuffle(x, (k) + 5), acc); \
+    acc = mad((float)(w).s6, (float)intel_sub_group_shuffle(x, (k) + 6), acc); \
+    acc = mad((float)(w).s7, (float)intel_sub_group_shuffle(x, (k) + 7), acc);
+
+// The weights are os_i_osv16__ai8: the 16 output features of a slice are interleaved for every input feature and the input
+// features are padded by zeros to a multiple of 8. The subgroup computes the 16 outputs of a slice, a lane per output: a block
+// read brings every lane the weights of its output for 8 input features and the subgroup reads them as 256 contiguous bytes.
+// The input features are split between the INPUT_SPLIT subgroups of the work group, the partial sums are added in the local
+// memory. The sums are accumulated in float, the large input features don't lose the precision.
+__attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE)))
+__attribute__((reqd_work_group_size(SUB_GROUP_SIZE, INPUT_SPLIT, 1)))
+KERNEL(fully_connected_gpu_bf_gemv_fp16)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global FILTER_TYPE* weights
+#if BIAS_TERM
+    , const __global BIAS_TYPE* biases
+#endif
+    )
+{
+    const uint lane = get_sub_group_local_id();
+    const uint slice = get_group_id(0);
+    const uint split = get_local_id(1);
+
+    const __global ushort* slice_weights = (const __global ushort*)weights + slice * INPUT_ELEMENTS_ALIGNED * SUB_GROUP_SIZE;
+    const __global INPUT0_TYPE* in = input + INPUT0_OFFSET;
+
+    float acc = 0.0f;
+    // the steps of SUB_GROUP_SIZE input features are interleaved between the subgroups
+    for (uint k = split * SUB_GROUP_SIZE; k + SUB_GROUP_SIZE <= INPUT_ELEMENTS_ALIGNED; k += INPUT_SPLIT * SUB_GROUP_SIZE)
+    {
+        const UNIT_TYPE x = k + lane < INPUT0_ELEMENTS_COUNT ? in[k + lane] : (UNIT_TYPE)0;
+        const half8 w0 = as_half8(intel_sub_group_block_read_us8(slice_weights + k * SUB_GROUP_SIZE));
+        const half8 w1 = as_half8(intel_sub_group_block_read_us8(slice_weights + (k + 8) * SUB_GROUP_SIZE));
+        MAD8(acc, w0, x, 0);
+        MAD8(acc, w1, x, 8);
+    }
+
+#if INPUT_ELEMENTS_ALIGNED % SUB_GROUP_SIZE != 0
+    // the last 8 input features are taken by the subgroup of the next step
+    const uint tail = INPUT_ELEMENTS_ALIGNED - 8;
+    if (split == (tail / SUB_GROUP_SIZE) % INPUT_SPLIT)
+    {
+        const UNIT_TYPE x = tail + lane < INPUT0_ELEMENTS_COUNT ? in[tail + lane] : (UNIT_TYPE)0;
+        const half8 w = as_half8(intel_sub_group_block_read_us8(slice_weights + tail * SUB_GROUP_SIZE));
+        MAD8(acc, w, x, 0);
+    }
+#endif
+
+#if INPUT_SPLIT > 1
+    __local float partial_sums[INPUT_SPLIT][SUB_GROUP_SIZE];
+    partial_sums[split][lane] = acc;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    if (split != 0)
+        return;
+
+    for (uint s = 1; s < INPUT_SPLIT; ++s)
+        acc += partial_sums[s][lane];
+#endif
+
+    const uint f = slice * SUB_GROUP_SIZE + lane;
+    if (f >= OUTPUT_FEATURE_NUM)
+        return;
+
+#if BIAS_TERM
+    acc += (float)biases[f];
+#endif
+    const UNIT_TYPE result = (UNIT_TYPE)acc;
+    output[OUTPUT_OFFSET + f * OUTPUT_FEATURE_PITCH] = ACTIVATION(result, NL_M, NL_N);
+}
+
+#undef MAD8
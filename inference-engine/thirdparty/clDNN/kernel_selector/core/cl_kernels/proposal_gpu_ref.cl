@@ -0,0 +1,218 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#include "include/include_all.cl"
+
+// The stages of the proposal, each stage is a kernel run after the previous one
+#define STAGE_GENERATE  0
+#define STAGE_SORT      1
+#define STAGE_NMS       2
+
+#define EPSILON         0.00001f
+
+// The proposal a is better than b: a higher score, the later proposal of the equal scores
+inline bool FUNC(is_better)(float score_a, int idx_a, float score_b, int idx_b)
+{
+    return score_a > score_b || (score_a == score_b && idx_a > idx_b);
+}
+
+inline float FUNC(area)(__global const float* box)
+{
+    return fmax(0.0f, box[3] - box[1] + 1.0f) * fmax(0.0f, box[2] - box[0] + 1.0f);
+}
+
+inline float FUNC(overlap)(__global const float* box1, __global const float* box2)
+{
+    const bool intersecting = (box1[0] < box2[2]) & (box2[0] < box1[2]) & (box1[1] < box2[3]) & (box2[1] < box1[3]);
+    if (!intersecting)
+        return 0.0f;
+
+    const float intersect_width = fmin(box1[2], box2[2]) - fmax(box1[0], box2[0]) + 1.0f;
+    const float intersect_height = fmin(box1[3], box2[3]) - fmax(box1[1], box2[1]) + 1.0f;
+    const float intersect_size = intersect_width * intersect_height;
+    return intersect_size / (FUNC_CALL(area)(box1) + FUNC_CALL(area)(box2) - intersect_size);
+}
+
+inline float FUNC(read_image_info)(const __global INPUT2_TYPE* image_info, int idx)
+{
+    return (float)image_info[INPUT2_OFFSET + idx * INPUT2_X_PITCH];
+}
+
+KERNEL (proposal_gpu_ref)(
+    const __global INPUT0_TYPE* cls_scores,
+    const __global INPUT1_TYPE* bbox_pred,
+    const __global INPUT2_TYPE* image_info,
+    __global OUTPUT_TYPE* output,
+    __global float* boxes,
+    __global float* scores,
+    __global float* sorted_scores,
+    __global int* sorted_indices,
+    __global float* kept_boxes)
+{
+#if STAGE == STAGE_GENERATE
+    // the proposals are ordered by the location of the feature map, then by the anchor
+    const int idx = get_global_id(0);
+    const int anchor = idx % NUM_ANCHORS;
+    const int x = (idx / NUM_ANCHORS) % INPUT0_SIZE_X;
+    const int y = (idx / NUM_ANCHORS) / INPUT0_SIZE_X;
+
+    // the image info is either { height, width, depth[, scale_min_bbox_y, scale_min_bbox_x, scale_depth] }
+    // or { height, width, scale_min_bbox_y, scale_min_bbox_x }
+    const int img_h = (int)(FUNC_CALL(read_image_info)(image_info, 0) + EPSILON);
+    const int img_w = (int)(FUNC_CALL(read_image_info)(image_info, 1) + EPSILON);
+#if INPUT2_SIZE_X == 4
+    const int min_bbox_x = (int)(MIN_BBOX_SIZE * FUNC_CALL(read_image_info)(image_info, 3));
+    const int min_bbox_y = (int)(MIN_BBOX_SIZE * FUNC_CALL(read_image_info)(image_info, 2));
+#else
+    const int img_z = (int)(FUNC_CALL(read_image_info)(image_info, 2) + EPSILON);
+    const int scaled_min_bbox_size = MIN_BBOX_SIZE * img_z;
+#if INPUT2_SIZE_X > 4
+    const int min_bbox_x = (int)(scaled_min_bbox_size * FUNC_CALL(read_image_info)(image_info, 4));
+#else
+    const int min_bbox_x = scaled_min_bbox_size;
+#endif
+#if INPUT2_SIZE_X > 3
+    const int min_bbox_y = (int)(scaled_min_bbox_size * FUNC_CALL(read_image_info)(image_info, 3));
+#else
+    const int min_bbox_y = scaled_min_bbox_size;
+#endif
+#endif
+
+    const int bbox_idx = INPUT1_OFFSET + y * INPUT1_Y_PITCH + x * INPUT1_X_PITCH + anchor * 4 * INPUT1_FEATURE_PITCH;
+    const float shift_x = (float)bbox_pred[bbox_idx];
+    const float shift_y = (float)bbox_pred[bbox_idx + INPUT1_FEATURE_PITCH];
+    const float log_w = (float)bbox_pred[bbox_idx + 2 * INPUT1_FEATURE_PITCH];
+    const float log_h = (float)bbox_pred[bbox_idx + 3 * INPUT1_FEATURE_PITCH];
+
+    const float anchor_start_x = ANCHORS[anchor * 4];
+    const float anchor_start_y = ANCHORS[anchor * 4 + 1];
+    const float anchor_w = ANCHORS[anchor * 4 + 2] - anchor_start_x + 1.0f;
+    const float anchor_h = ANCHORS[anchor * 4 + 3] - anchor_start_y + 1.0f;
+    const float center_x = anchor_start_x + anchor_w * 0.5f;
+    const float center_y = anchor_start_y + anchor_h * 0.5f;
+
+    const float pred_center_x = shift_x * anchor_w + center_x + x * FEATURE_STRIDE;
+    const float pred_center_y = shift_y * anchor_h + center_y + y * FEATURE_STRIDE;
+    const float half_pred_w = exp(log_w) * anchor_w * 0.5f;
+    const float half_pred_h = exp(log_h) * anchor_h * 0.5f;
+
+    __global float* box = boxes + idx * 4;
+    box[0] = clamp(pred_center_x - half_pred_w, 0.0f, img_w - 1.0f);
+    box[1] = clamp(pred_center_y - half_pred_h, 0.0f, img_h - 1.0f);
+    box[2] = clamp(pred_center_x + half_pred_w, 0.0f, img_w - 1.0f);
+    box[3] = clamp(pred_center_y + half_pred_h, 0.0f, img_h - 1.0f);
+
+    const float score = (float)cls_scores[INPUT0_OFFSET + y * INPUT0_Y_PITCH + x * INPUT0_X_PITCH + (NUM_ANCHORS + anchor) * INPUT0_FEATURE_PITCH];
+    const int bbox_w = (int)box[2] - (int)box[0] + 1;
+    const int bbox_h = (int)box[3] - (int)box[1] + 1;
+
+    // the filtered out proposals get a negative score, they are sorted after all the valid ones
+    scores[idx] = (bbox_w >= min_bbox_x && bbox_h >= min_bbox_y && score > 0.0f) ? score : -1.0f;
+
+#elif STAGE == STAGE_SORT
+    // the bitonic sort of the proposals by one work group, the best proposal becomes the first one
+    const int lid = get_local_id(0);
+
+    for (int i = lid; i < SORT_SIZE; i += WORK_GROUP_SIZE)
+    {
+        sorted_scores[i] = i < NUM_PROPOSALS ? scores[i] : -1.0f;
+        sorted_indices[i] = i;
+    }
+    barrier(CLK_GLOBAL_MEM_FENCE);
+
+    for (int size = 2; size <= SORT_SIZE; size <<= 1)
+    {
+        for (int stride = size >> 1; stride > 0; stride >>= 1)
+        {
+            for (int i = lid; i < SORT_SIZE; i += WORK_GROUP_SIZE)
+            {
+                const int j = i ^ stride;
+                if (j <= i)
+                    continue;
+
+                const float score_i = sorted_scores[i];
+                const int idx_i = sorted_indices[i];
+                const float score_j = sorted_scores[j];
+                const int idx_j = sorted_indices[j];
+                // the blocks are sorted to the best first and to the best last alternately
+                const bool best_first = (i & size) == 0;
+                if (best_first == FUNC_CALL(is_better)(score_j, idx_j, score_i, idx_i))
+                {
+                    sorted_scores[i] = score_j;
+                    sorted_indices[i] = idx_j;
+                    sorted_scores[j] = score_i;
+                    sorted_indices[j] = idx_i;
+                }
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+    }
+
+#elif STAGE == STAGE_NMS
+    // the proposals are taken in the order of the scores, every work item checks the overlaps with a part of the kept ones
+    const int lid = get_local_id(0);
+    __local int kept_count;
+    __local int suppressed;
+
+    if (lid == 0)
+        kept_count = 0;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    const int candidates = NUM_PROPOSALS < PRE_NMS_TOPN ? NUM_PROPOSALS : PRE_NMS_TOPN;
+    for (int i = 0; i < candidates; i++)
+    {
+        const int count = kept_count;
+        if (count == POST_NMS_TOPN || sorted_scores[i] <= 0.0f)
+            break;
+
+        __global const float* box = boxes + sorted_indices[i] * 4;
+        if (lid == 0)
+            suppressed = 0;
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (int j = lid; j < count; j += WORK_GROUP_SIZE)
+        {
+            if (FUNC_CALL(overlap)(box, kept_boxes + j * 4) > IOU_THRESHOLD)
+                suppressed = 1;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        if (lid == 0 && !suppressed)
+        {
+            for (int k = 0; k < 4; k++)
+                kept_boxes[count * 4 + k] = box[k];
+            kept_count = count + 1;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE | CLK_GLOBAL_MEM_FENCE);
+    }
+
+    // the rows after the kept proposals are zeros
+    const int count = kept_count;
+    for (int row = lid; row < POST_NMS_TOPN; row += WORK_GROUP_SIZE)
+    {
+        __global OUTPUT_TYPE* roi = output + OUTPUT_OFFSET + row * OUTPUT_BATCH_PITCH;
+        roi[0] = TO_OUTPUT_TYPE(0.0f);
+        for (int k = 0; k < 4; k++)
+            roi[(1 + k) * OUTPUT_X_PITCH] = TO_OUTPUT_TYPE(row < count ? kept_boxes[row * 4 + k] : 0.0f);
+    }
+#endif
+}
+
+#undef STAGE_GENERATE
+#undef STAGE_SORT
+#undef STAGE_NMS
+#undef EPSILON
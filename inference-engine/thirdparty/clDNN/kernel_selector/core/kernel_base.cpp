@@ -19,5 +19,33 @@
 namespace kernel_selector
 {
     const primitive_db KernelBase::db;
-    size_t KernelBase::counter = 0;
+    std::atomic<size_t> KernelBase::counter{ 0 };
+
+    namespace
+    {
+        // the block of the calling thread, it's empty while next == end
+        thread_local size_t blockNext = 0;
+        thread_local size_t blockEnd = 0;
+    }
+
+    size_t KernelBase::UniqeID()
+    {
+        if (blockNext < blockEnd)
+        {
+            return blockNext++;
+        }
+        return counter++;
+    }
+
+    UniqueIDBlock::UniqueIDBlock(size_t first) : prevNext(blockNext), prevEnd(blockEnd)
+    {
+        blockNext = first;
+        blockEnd = first + size;
+    }
+
+    UniqueIDBlock::~UniqueIDBlock()
+    {
+        blockNext = prevNext;
+        blockEnd = prevEnd;
+    }
 }
\ No newline at end of file
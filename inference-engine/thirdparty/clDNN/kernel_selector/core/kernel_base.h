@@ -18,6 +18,7 @@
 
 #include "kernel_selector_common.h"
 #include "kernel_selector_params.h"
+#include <atomic>
  
 namespace kernel_selector 
 {
@@ -46,9 +47,34 @@ namespace kernel_selector
         static const primitive_db db;
         const std::string kernelName;
 
-        static size_t UniqeID() { return counter++; } // TODO: use interlocked
+        // the ID of the block of the calling thread if it's set (see UniqueIDBlock), the next ID of the counter otherwise
+        static size_t UniqeID();
         
     private:
-        static size_t counter;
+        static std::atomic<size_t> counter;
+        friend class UniqueIDBlock;
+    };
+
+    // The kernels selected for a node on a thread take their IDs from the block of the node, so the entry points
+    // of the nodes selected in parallel don't depend on the order the threads take the nodes in. The block running out
+    // of IDs takes the next ones from the counter, the IDs stay unique then.
+    class UniqueIDBlock
+    {
+    public:
+        static const size_t size = 1024;
+
+        // Reserves the consecutive blocks, returns the first ID of the first block
+        static size_t Reserve(size_t blocks) { return KernelBase::counter.fetch_add(blocks * size); }
+
+        // The IDs of the calling thread are taken from the block starting at the first ID while the object lives
+        explicit UniqueIDBlock(size_t first);
+        ~UniqueIDBlock();
+
+        UniqueIDBlock(const UniqueIDBlock&) = delete;
+        UniqueIDBlock& operator=(const UniqueIDBlock&) = delete;
+
+    private:
+        size_t prevNext;
+        size_t prevEnd;
     };
 }
\ No newline at end of file
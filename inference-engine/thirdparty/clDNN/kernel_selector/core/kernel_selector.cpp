@@ -17,6 +17,7 @@
 #include "kernel_selector_common.h"
 #include "kernel_selector.h"
 #include <type_traits>
+#include <chrono>
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -154,10 +155,13 @@ namespace kernel_selector {
             ParamsKey requireKey = params.GetParamsKey().Merge(options.GetSupportedKey());
             
             std::tuple<std::string, int> cachedKernelConfig;
+            bool offlineCacheUsed = false;
+            const auto lookupBegin = std::chrono::steady_clock::now();
             if (options.tuningParams.mode == TuningMode::TUNING_DISABLED) // Try to load kernel/config from offline cache
             {
 #if ENABLE_OFFLINE_TUNING_CACHE
                 cachedKernelConfig = autoTuner.LoadKernelOffline(params.engineInfo.deviceId, hash);
+                offlineCacheUsed = true;
 #else
                 return  GetNaiveBestKernel(params, options, kType);
 #endif
@@ -165,7 +169,17 @@ namespace kernel_selector {
             else // Try to load kernel/config from on-line cache
             {
                 cachedKernelConfig = autoTuner.LoadKernelOnline(options.tuningParams.mode, options.tuningParams.cacheFilePath, params.engineInfo.deviceId, params.engineInfo.driverVersion, params.engineInfo.hostVersion, hash);
+#if ENABLE_OFFLINE_TUNING_CACHE
+                // The tuning file may be shared by the machines which don't run all the layers, the rest is taken from offline cache
+                if (std::get<0>(cachedKernelConfig).empty() && options.tuningParams.mode == TuningMode::TUNING_USE_CACHE)
+                {
+                    cachedKernelConfig = autoTuner.LoadKernelOffline(params.engineInfo.deviceId, hash);
+                    offlineCacheUsed = true;
+                }
+#endif
             }       
+            AutoTuner::GetStatistics().lookupTime += static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - lookupBegin).count());
             bool hashFoundInCache = !std::get<0>(cachedKernelConfig).empty();
 
             if (hashFoundInCache)
@@ -191,10 +205,14 @@ namespace kernel_selector {
 
                 if (!kernelsData.empty())
                 {
+                    auto& statistics = AutoTuner::GetStatistics();
+                    ++(offlineCacheUsed ? statistics.offlineCacheHits : statistics.onlineCacheHits);
                     return kernelsData;
                 }
             }
 
+            ++AutoTuner::GetStatistics().cacheMisses;
+
             if( hashFoundInCache || // Cache is not valid - hash exists in cache but kernelsData was empty or kernel doesn't support the required key.
                 (options.tuningParams.mode != TuningMode::TUNING_TUNE_AND_CACHE) || // On-line tuning is not allowed.
                 !options.tuningParams.runner ) // Runner is invalid - can't run on-line tuning
@@ -35,6 +35,9 @@ namespace kernel_selector
 
         virtual KernelsData GetBestKernels(const Params& params, const optional_params& options) const = 0;
 
+        // The tuner which keeps the tuning files, the network-level tuning stores its plans in them as well
+        static AutoTuner& GetAutoTuner() { return autoTuner; }
+
     protected:
         template<typename T>
         inline void Attach()
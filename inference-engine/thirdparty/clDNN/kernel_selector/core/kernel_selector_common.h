@@ -340,6 +340,8 @@ namespace kernel_selector {
         case KernelType::LRN:               return "LRN";
         case KernelType::POOLING:           return "POOLING";
         case KernelType::ROI_POOLING:       return "ROI_POOLING";
+        case KernelType::DETECTION_OUTPUT:  return "DETECTION_OUTPUT";
+        case KernelType::PROPOSAL:          return "PROPOSAL";
         case KernelType::FULLY_CONNECTED:   return "FULLY_CONNECTED";
         case KernelType::ACTIVATION:        return "ACTIVATION";
         case KernelType::SOFT_MAX:          return "SOFT_MAX";
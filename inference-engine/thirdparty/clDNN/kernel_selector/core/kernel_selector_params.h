@@ -122,6 +122,7 @@ namespace kernel_selector
                             uint32_t transposed : 1;
                             uint32_t quantization : 1;
                             uint32_t calibration : 1;
+                            uint32_t fusedEltwise : 1;
                         } conv;
                         struct fc_t {} fc;
                         struct softmax_t 
@@ -612,6 +613,11 @@ namespace kernel_selector
             key.restrict.val.dedicated.conv.calibration = 1;
         }
 
+        void EnableFusedEltwise()
+        {
+            key.restrict.val.dedicated.conv.fusedEltwise = 1;
+        }
+
         void EnableWinogradReorder()
         {
             key.restrict.val.dedicated.reorder.winograd = 1;
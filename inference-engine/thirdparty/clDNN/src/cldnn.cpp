@@ -188,8 +188,10 @@ uint32_t cldnn_get_engine_count(/*cldnn_engine_type*/ int32_t type, cldnn_status
 {
     if (type == cldnn_engine_type::cldnn_engine_ocl)
     {
-        if (status) *status = CLDNN_SUCCESS;
-        return 1;
+        return exception_handler<uint32_t>(CLDNN_ERROR, status, 0, [&]()
+        {
+            return cldnn::engine_impl::count();
+        });
     }
     else
     {
@@ -209,7 +211,7 @@ void cldnn_release_pending_memory(cldnn_engine engine, cldnn_status* status)
 
 cldnn_engine cldnn_create_engine(/*cldnn_engine_type*/ int32_t type, uint32_t engine_num, const cldnn_engine_configuration* configuration, cldnn_status* status)
 {
-    if (engine_num > 0 || (type != cldnn_engine_type::cldnn_engine_ocl))
+    if (type != cldnn_engine_type::cldnn_engine_ocl)
     {
         if (status)
             *status = CLDNN_DEVICE_ERROR;
@@ -218,7 +220,7 @@ cldnn_engine cldnn_create_engine(/*cldnn_engine_type*/ int32_t type, uint32_t en
 
     return exception_handler<cldnn_engine>(CLDNN_ERROR, status, nullptr, [&]()
     {
-        return api_cast(new cldnn::engine_impl(configuration ? cldnn::engine_configuration(*configuration) : cldnn::engine_configuration()));
+        return api_cast(new cldnn::engine_impl(configuration ? cldnn::engine_configuration(*configuration) : cldnn::engine_configuration(), engine_num));
     });
 }
 
@@ -242,7 +244,7 @@ void cldnn_release_engine(cldnn_engine engine, cldnn_status* status)
 
 cldnn_engine_info cldnn_get_engine_info(cldnn_engine engine, cldnn_status* status)
 {
-    return exception_handler<cldnn_engine_info>(CLDNN_ERROR, status, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, [&]() -> cldnn_engine_info
+    return exception_handler<cldnn_engine_info>(CLDNN_ERROR, status, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, [&]() -> cldnn_engine_info
     {
         SHOULD_NOT_BE_NULL(engine, "Engine");
         auto info = api_cast(engine)->get_engine_info();
@@ -259,7 +261,8 @@ cldnn_engine_info cldnn_get_engine_info(cldnn_engine engine, cldnn_status* statu
             info.supports_fp16,
             info.supports_fp16_denorms,
             info.supports_subgroups_short,
-            info.supports_image
+            info.supports_image,
+            info.supports_host_unified_memory
        };
     });
 }
@@ -275,19 +278,111 @@ cldnn_engine_info cldnn_get_engine_info(cldnn_engine engine, cldnn_status* statu
 
 int64_t cldnn_get_max_used_device_memory_size(cldnn_engine engine, cldnn_status* status)
 {
-    return exception_handler<int32_t>(CLDNN_ERROR, status, cldnn_engine_ocl, [&]()
+    return exception_handler<int64_t>(CLDNN_ERROR, status, 0, [&]()
     {
         SHOULD_NOT_BE_NULL(engine, "Engine");
-        return static_cast<int32_t>(api_cast(engine)->get_max_used_device_memory());
+        return static_cast<int64_t>(api_cast(engine)->get_max_used_device_memory());
     });
 }
 
 int64_t cldnn_get_temp_used_device_memory_size(cldnn_engine engine, cldnn_status* status)
 {
-    return exception_handler<int32_t>(CLDNN_ERROR, status, cldnn_engine_ocl, [&]()
+    return exception_handler<int64_t>(CLDNN_ERROR, status, 0, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        return static_cast<int64_t>(api_cast(engine)->get_used_device_memory());
+    });
+}
+
+void cldnn_get_engine_programs_binaries(cldnn_engine engine, char* data, size_t size, size_t* size_ret, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        SHOULD_NOT_BE_NULL(size_ret, "Size");
+        auto blob = api_cast(engine)->get_context()->get_kernels_cache().get_programs_binaries();
+        *size_ret = blob.size();
+
+        if (size < *size_ret)
+        {
+            if (status) *status = CLDNN_INVALID_ARG;
+            return;
+        }
+
+        std::copy(blob.begin(), blob.end(), data);
+    });
+}
+
+void cldnn_set_engine_programs_binaries(cldnn_engine engine, const char* data, size_t size, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        api_cast(engine)->get_context()->get_kernels_cache().set_programs_binaries(data, size);
+    });
+}
+
+void cldnn_get_engine_constants_data(cldnn_engine engine, char* data, size_t size, size_t* size_ret, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        SHOULD_NOT_BE_NULL(size_ret, "Size");
+        auto blob = api_cast(engine)->get_constants_data();
+        *size_ret = blob.size();
+
+        if (size < *size_ret)
+        {
+            if (status) *status = CLDNN_INVALID_ARG;
+            return;
+        }
+
+        std::copy(blob.begin(), blob.end(), data);
+    });
+}
+
+void cldnn_set_engine_constants_data(cldnn_engine engine, const char* data, size_t size, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        api_cast(engine)->set_constants_data(data, size);
+    });
+}
+
+void* cldnn_get_engine_cl_context(cldnn_engine engine, cldnn_status* status)
+{
+    return exception_handler<void*>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        return static_cast<void*>(api_cast(engine)->get_context()->context()());
+    });
+}
+
+cldnn_tuning_statistics cldnn_get_engine_tuning_statistics(cldnn_engine engine, cldnn_status* status)
+{
+    return exception_handler<cldnn_tuning_statistics>(CLDNN_ERROR, status, { 0, 0, 0 }, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        return api_cast(engine)->get_tuning_statistics();
+    });
+}
+
+cldnn_build_statistics cldnn_get_engine_build_statistics(cldnn_engine engine, cldnn_status* status)
+{
+    return exception_handler<cldnn_build_statistics>(CLDNN_ERROR, status, { 0, 0, 0, 0, 0 }, [&]()
     {
         SHOULD_NOT_BE_NULL(engine, "Engine");
-        return static_cast<int32_t>(api_cast(engine)->get_used_device_memory());
+        return api_cast(engine)->get_build_statistics();
+    });
+}
+
+cldnn_memory_statistics cldnn_get_engine_memory_statistics(cldnn_engine engine, cldnn_status* status)
+{
+    return exception_handler<cldnn_memory_statistics>(CLDNN_ERROR, status, { 0, 0, 0, 0, 0 }, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        return api_cast(engine)->get_memory_pool().get_statistics();
     });
 }
 
@@ -712,6 +807,30 @@ void cldnn_execute_network(cldnn_network network, cldnn_event* dependencies, siz
     });
 }
 
+void cldnn_execute_networks(cldnn_network* networks, size_t networks_num, cldnn_event* dependencies, size_t deps_num, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(networks, "Networks");
+        std::vector<cldnn::network_impl*> impls;
+        impls.reserve(networks_num);
+        for (size_t i = 0; i < networks_num; i++)
+        {
+            SHOULD_NOT_BE_NULL(networks[i], "Network");
+            impls.push_back(api_cast(networks[i]));
+        }
+
+        std::vector<cldnn::refcounted_obj_ptr<cldnn::event_impl>> deps;
+        deps.reserve(deps_num);
+        for (size_t i = 0; i < deps_num; i++)
+        {
+            deps.emplace_back(api_cast(dependencies[i]));
+        }
+
+        cldnn::network_impl::execute_sequence(impls, deps);
+    });
+}
+
 cldnn_network_output cldnn_get_network_output(cldnn_network network, const char* name, cldnn_status* status)
 {
     cldnn_network_output error_result = { nullptr, nullptr };
@@ -783,6 +902,51 @@ cldnn_memory cldnn_attach_memory(cldnn_layout layout, void* pointer, size_t size
     });
 }
 
+cldnn_memory cldnn_share_host_memory(cldnn_engine engine, cldnn_layout layout, void* pointer, size_t size, cldnn_status* status)
+{
+    return exception_handler<cldnn_memory>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        SHOULD_NOT_BE_NULL(pointer, "Pointer");
+        cldnn::layout layout_obj(layout);
+        if (layout_obj.bytes_count() > size)
+            throw std::invalid_argument("buffer size does not match layout size");
+        return init_external_from_internal(api_cast(engine)->share_host_memory(layout_obj, pointer));
+    });
+}
+
+cldnn_memory cldnn_allocate_staging_memory(cldnn_engine engine, cldnn_layout layout, cldnn_status* status)
+{
+    return exception_handler<cldnn_memory>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        return init_external_from_internal(api_cast(engine)->allocate_staging_memory(layout));
+    });
+}
+
+void cldnn_download_memory(cldnn_memory staging, cldnn_memory memory, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(staging, "Staging memory");
+        SHOULD_NOT_BE_NULL(memory, "Memory");
+        auto engine = api_cast(staging)->get_engine();
+        if (engine == nullptr)
+            throw std::invalid_argument("the staging memory is not allocated by an engine");
+        engine->download_memory(*api_cast(staging), *api_cast(memory));
+    });
+}
+
+cldnn_memory cldnn_attach_cl_buffer(cldnn_engine engine, cldnn_layout layout, void* cl_buffer, cldnn_status* status)
+{
+    return exception_handler<cldnn_memory>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        SHOULD_NOT_BE_NULL(cl_buffer, "OpenCL buffer");
+        return init_external_from_internal(api_cast(engine)->attach_cl_buffer(layout, cl_buffer));
+    });
+}
+
 CLDNN_API int32_t cldnn_is_the_same_buffer(cldnn_memory mem1, cldnn_memory mem2, cldnn_status* status)
 {
     return static_cast<int32_t>(exception_handler<bool>(CLDNN_ERROR, status, false, [&]()
@@ -19,11 +19,113 @@
 #include "program_impl.h"
 #include "network_impl.h"
 #include "memory_impl.h"
+#include "generic_layer_inst.h"
+#include "reorder_inst.h"
+#include "reshape_inst.h"
+#include "eltwise_inst.h"
+#include "scale_inst.h"
 
 #include "api/CPP/input_layout.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <set>
+#include <sstream>
+#include <typeinfo>
+
 using namespace cldnn;
 
+namespace
+{
+    std::string to_string(const layout& l)
+    {
+        std::stringstream ss;
+        ss << static_cast<int>(l.data_type) << ":" << static_cast<int>(l.format.value) << ":" << l.size.to_string()
+           << ":" << l.data_padding.lower_size().to_string() << ":" << l.data_padding.upper_size().to_string();
+        return ss.str();
+    }
+
+    //FNV-1a hash of the data of the constant
+    uint64_t hash_data(memory_impl& memory)
+    {
+        mem_lock<uint8_t> ptr(memory);
+        uint64_t hash = 14695981039346656037ull;
+        for (auto byte : ptr)
+        {
+            hash ^= byte;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    //the entry points of the kernels are unique in the process, so they are removed from the key
+    std::string remove_entry_point(std::string jit, const std::string& entry_point)
+    {
+        if (entry_point.empty())
+            return jit;
+        for (auto pos = jit.find(entry_point); pos != std::string::npos; pos = jit.find(entry_point, pos))
+            jit.erase(pos, entry_point.size());
+        return jit;
+    }
+
+    //the layouts the host evaluation reads and writes: the plain formats of the floating point data
+    bool is_host_layout(const layout& l)
+    {
+        return (l.data_type == data_types::f32 || l.data_type == data_types::f16) &&
+            (l.format == format::bfyx || l.format == format::yxfb || l.format == format::byxf || l.format == format::fyxb);
+    }
+
+    //the elements of the locked memory of a host layout, addressed by their coordinates and converted to float
+    class host_buffer
+    {
+    public:
+        explicit host_buffer(memory_impl& memory)
+            : _layout(memory.get_layout())
+            , _lock(memory)
+        {}
+
+        const layout& get_layout() const { return _layout; }
+
+        //the coordinates are wrapped by the sizes, so the dimensions of size 1 are broadcast
+        float get(int b, int f, int y, int x) const
+        {
+            const auto& size = _layout.size;
+            auto offset = _layout.get_linear_offset({ b % size.batch[0], f % size.feature[0], x % size.spatial[0], y % size.spatial[1] });
+            if (_layout.data_type == data_types::f16)
+                return half_to_float(reinterpret_cast<const uint16_t*>(_lock.data())[offset]);
+            return reinterpret_cast<const float*>(_lock.data())[offset];
+        }
+
+        void set(int b, int f, int y, int x, float value)
+        {
+            auto offset = _layout.get_linear_offset({ b, f, x, y });
+            if (_layout.data_type == data_types::f16)
+                reinterpret_cast<uint16_t*>(_lock.data())[offset] = float_to_half(value);
+            else
+                reinterpret_cast<float*>(_lock.data())[offset] = value;
+        }
+
+    private:
+        layout _layout;
+        mem_lock<uint8_t> _lock;
+    };
+
+    float eltwise_op(eltwise_mode mode, float lhs, float rhs)
+    {
+        switch (mode)
+        {
+        case eltwise_mode::sum: return lhs + rhs;
+        case eltwise_mode::sub: return lhs - rhs;
+        case eltwise_mode::max: return std::max(lhs, rhs);
+        case eltwise_mode::prod: return lhs * rhs;
+        case eltwise_mode::div: return lhs / rhs;
+        case eltwise_mode::min: return std::min(lhs, rhs);
+        default: throw std::logic_error("the eltwise mode is not evaluated on the host");
+        }
+    }
+}
+
 constants_propagator::constants_propagator(program_impl::ptr program) : prog(program)
 {
 }
@@ -39,24 +141,185 @@ std::list<std::pair<primitive_id, memory_impl::ptr>> constants_propagator::calcu
     if (!has_non_trivial_constants)
         return{};
 
-    build_options bo;
-    bo.set_option(build_option::optimize_data(false));
-    bo.set_option(build_option::outputs(const_outputs));
-    network_impl::ptr net = prog->get_engine().build_network(tpl, bo, true);
-    for (auto& cin : const_inputs)
-        net->set_input_data(cin->id(), cin->get_attached_memory());
+    //the outputs of the same computations of the same data are taken from the engine if all of them are kept
+    auto& engine = prog->get_engine();
+    const bool use_cache = engine.configuration().enable_constants_cache;
+    std::map<primitive_id, std::string> cache_keys;
+    if (use_cache)
+    {
+        std::map<program_node*, std::string> node_keys;
+        for (auto& id : const_outputs)
+            cache_keys[id] = get_cache_key(prog->get_node(id), node_keys);
 
-    net->execute({});
-    net->reset_execution(true); //wait for computations to complete
-    auto outputs = net->get_outputs();
+        std::list<std::pair<primitive_id, memory_impl::ptr>> cached;
+        for (auto& key : cache_keys)
+        {
+            auto mem = key.second.empty() ? nullptr : engine.get_cached_constant(key.second, prog->get_node(key.first).get_output_layout());
+            if (!mem)
+                break;
+            cached.push_back({ key.first, mem });
+        }
+        if (cached.size() == cache_keys.size())
+            return cached;
+    }
 
     std::list<std::pair<primitive_id, memory_impl::ptr>> ret;
-    for (auto& out : outputs)
-        ret.push_back({ out->id(), &out->output_memory() });
+    if (!calculate_on_host(ret))
+    {
+        build_options bo;
+        bo.set_option(build_option::optimize_data(false));
+        bo.set_option(build_option::outputs(const_outputs));
+        network_impl::ptr net = prog->get_engine().build_network(tpl, bo, true);
+        for (auto& cin : const_inputs)
+            net->set_input_data(cin->id(), cin->get_attached_memory());
+
+        net->execute({});
+        net->reset_execution(true); //wait for computations to complete
+        for (auto& out : net->get_outputs())
+            ret.push_back({ out->id(), &out->output_memory() });
+    }
+
+    if (use_cache)
+    {
+        for (auto& out : ret)
+            if (!cache_keys[out.first].empty())
+                engine.store_constant(cache_keys[out.first], *out.second);
+    }
 
     return ret;
 }
 
+//the simple constants (the reorders and the reshapes of the data, the eltwise and the scale of them) are computed by the
+//host code, as building the network would compile the kernels run only once. If any of the constants can't be computed
+//on the host, none of them is, and the network computes all of them.
+bool constants_propagator::calculate_on_host(std::list<std::pair<primitive_id, memory_impl::ptr>>& outputs) const
+{
+    for (auto node : const_nodes)
+        if (!can_calculate_on_host(*node))
+            return false;
+
+    auto& engine = prog->get_engine();
+    std::map<program_node*, memory_impl::ptr> values;
+    for (auto node : const_nodes)
+    {
+        auto output = engine.allocate_memory(node->get_output_layout());
+        {
+            mem_lock<uint8_t> ptr(*output);
+            std::memset(ptr.data(), 0, ptr.size());
+        }
+
+        std::vector<memory_impl::ptr> inputs;
+        for (auto dep : node->get_dependencies())
+            inputs.push_back(dep->is_type<data>() ? memory_impl::ptr(&dep->as<data>().get_attached_memory()) : values.at(dep));
+
+        if (node->is_type<generic_layer>())
+        {
+            mem_lock<uint8_t> input(*inputs[0]);
+            mem_lock<uint8_t> result(*output);
+            node->as<generic_layer>().get_primitive()->generic_params.cpuKernel->Execute(input.data(), input.size(), result.data(), result.size());
+        }
+        else if (node->is_type<reshape>())
+        {
+            mem_lock<uint8_t> input(*inputs[0]);
+            mem_lock<uint8_t> result(*output);
+            std::memcpy(result.data(), input.data(), result.size());
+        }
+        else
+        {
+            std::vector<std::unique_ptr<host_buffer>> in;
+            for (auto& input : inputs)
+                in.emplace_back(new host_buffer(*input));
+            host_buffer out(*output);
+            const auto& size = out.get_layout().size;
+            for (int b = 0; b < size.batch[0]; b++)
+            for (int f = 0; f < size.feature[0]; f++)
+            for (int y = 0; y < size.spatial[1]; y++)
+            for (int x = 0; x < size.spatial[0]; x++)
+            {
+                float value = 0.f;
+                if (node->is_type<reorder>())
+                {
+                    const auto& subtract = node->as<reorder>().get_primitive()->subtract_per_feature;
+                    value = in[0]->get(b, f, y, x) - (subtract.empty() ? 0.f : subtract[f]);
+                }
+                else if (node->is_type<scale>())
+                {
+                    value = in[0]->get(b, f, y, x) * in[1]->get(b, f, y, x) + (in.size() > 2 ? in[2]->get(b, f, y, x) : 0.f);
+                }
+                else
+                {
+                    const auto& prim = *node->as<eltwise>().get_primitive();
+                    auto input_value = [&](size_t i) { return in[i]->get(b, f, y, x) * (prim.coefficients.empty() ? 1.f : prim.coefficients[i]); };
+                    value = input_value(0);
+                    for (size_t i = 1; i < in.size(); i++)
+                        value = eltwise_op(prim.mode, value, input_value(i));
+                    if (prim.with_activation && value < 0.f)
+                        value *= prim.activation_negative_slope;
+                }
+                out.set(b, f, y, x, value);
+            }
+        }
+        values[node] = output;
+    }
+
+    std::set<primitive_id> added;
+    for (auto& id : const_outputs)
+        if (added.insert(id).second)
+            outputs.push_back({ id, values.at(&prog->get_node(id)) });
+    return true;
+}
+
+bool constants_propagator::can_calculate_on_host(program_node& node) const
+{
+    if (node.get_fused_activation_func() != activation_none)
+        return false;
+
+    if (node.is_type<generic_layer>())
+    {
+        const auto& params = node.as<generic_layer>().get_primitive()->generic_params;
+        return params.engine == kernel_selector::generic_kernel_params::Engine::CPU && params.cpuKernel &&
+            !node.get_output_layout().format.is_image_2d() && !node.get_dependency(0).get_output_layout().format.is_image_2d();
+    }
+
+    const auto& output_layout = node.get_output_layout();
+    if (node.is_type<reshape>())
+    {
+        const auto& input_layout = node.get_dependency(0).get_output_layout();
+        return input_layout.format == output_layout.format && input_layout.data_type == output_layout.data_type &&
+            !input_layout.data_padding && !output_layout.data_padding && !output_layout.format.is_image_2d();
+    }
+
+    if (node.is_type<reorder>())
+    {
+        if (node.as<reorder>().has_mean())
+            return false;
+        const auto& subtract = node.as<reorder>().get_primitive()->subtract_per_feature;
+        if (!subtract.empty() && subtract.size() < static_cast<size_t>(output_layout.size.feature[0]))
+            return false;
+    }
+    else if (node.is_type<eltwise>())
+    {
+        const auto& prim = *node.as<eltwise>().get_primitive();
+        if (!prim.output_calibration_factors.empty() || (prim.mode != eltwise_mode::sum && prim.mode != eltwise_mode::sub &&
+            prim.mode != eltwise_mode::max && prim.mode != eltwise_mode::prod && prim.mode != eltwise_mode::div && prim.mode != eltwise_mode::min))
+            return false;
+        if (!prim.coefficients.empty() && prim.coefficients.size() != node.get_dependencies().size())
+            return false;
+    }
+    else if (!node.is_type<scale>())
+    {
+        return false;
+    }
+
+    //the padding of the output may be filled with a value, so only the inputs are read with their padding
+    if (!is_host_layout(output_layout) || output_layout.data_padding)
+        return false;
+    for (auto dep : node.get_dependencies())
+        if (!is_host_layout(dep->get_output_layout()))
+            return false;
+    return true;
+}
+
 void constants_propagator::handle_constant(program_node& node)
 {
     if (!node.is_type<data>())
@@ -73,6 +336,7 @@ void constants_propagator::add_constant(program_node& node)
         return;
 
     tpl.add(node.desc);
+    const_nodes.push_back(&node);
     has_non_trivial_constants = true;
 
     //if a node is either an endpoint or an output, always add it as an output
@@ -90,3 +354,60 @@ void constants_propagator::add_constant(program_node& node)
     }
 }
 
+//the key describes the computation of the constant from the data, it is empty if the computation may depend on
+//something else, e.g. the value of a primitive parameter not described by the key
+std::string constants_propagator::get_cache_key(program_node& node, std::map<program_node*, std::string>& keys) const
+{
+    auto cached_key = keys.find(&node);
+    if (cached_key != keys.end())
+        return cached_key->second;
+
+    const auto& output_layout = node.get_output_layout();
+    std::stringstream ss;
+    bool cacheable = !output_layout.format.is_image_2d();
+    if (node.is_type<data>())
+    {
+        auto& mem = node.as<data>().get_attached_memory();
+        ss << "data " << to_string(mem.get_layout()) << " " << hash_data(mem);
+    }
+    else if (node.is_type<generic_layer>())
+    {
+        const auto& params = node.as<generic_layer>().get_primitive()->generic_params;
+        ss << "generic_layer " << to_string(output_layout);
+        if (params.engine == kernel_selector::generic_kernel_params::Engine::GPU && params.clKernel && params.clKernel->kernelString)
+        {
+            const auto& kernel_string = *params.clKernel->kernelString;
+            ss << " " << std::hash<std::string>{}(kernel_string.str + remove_entry_point(kernel_string.jit, kernel_string.entry_point) + kernel_string.options);
+        }
+        else if (params.engine == kernel_selector::generic_kernel_params::Engine::CPU && params.cpuKernel)
+        {
+            ss << " " << typeid(*params.cpuKernel).name();
+        }
+        else
+        {
+            cacheable = false;
+        }
+    }
+    else if (node.is_type<reorder>())
+    {
+        const auto& prim = *node.as<reorder>().get_primitive();
+        ss << "reorder " << to_string(output_layout);
+        cacheable &= !node.as<reorder>().has_mean() && prim.subtract_per_feature.empty();
+    }
+    else
+    {
+        cacheable = false;
+    }
+
+    for (auto& dep : node.get_dependencies())
+    {
+        auto dep_key = cacheable ? get_cache_key(*dep, keys) : std::string();
+        cacheable &= !dep_key.empty();
+        ss << " (" << dep_key << ")";
+    }
+
+    auto key = cacheable ? ss.str() : std::string();
+    keys[&node] = key;
+    return key;
+}
+
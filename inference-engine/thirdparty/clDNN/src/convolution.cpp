@@ -126,6 +126,7 @@ std::string convolution_inst::to_string(convolution_node const& node)
     conv_info.add("dilation", dilation.to_string());
     conv_info.add("with activation", activation);
     conv_info.add("slope", desc->activation_negative_slope);
+    conv_info.add("fused eltwise", node.has_fused_eltwise() ? " true" : "false");
     if (desc->with_output_size)
     {
         json_composite ud_out_size_info;
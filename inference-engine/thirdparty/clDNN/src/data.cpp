@@ -34,6 +34,11 @@ namespace {
         if (mem.is_allocated_by(engine))
             return &mem;
 
+        // the engines running in the same OpenCL context (e.g. the streams of a network) read the constants in place
+        auto shared = engine.share_memory_of_context(mem);
+        if (shared != nullptr)
+            return shared;
+
         memory_impl::ptr result = engine.allocate_memory(mem.get_layout());
         mem_lock<char> src(mem);
         mem_lock<char> dst(result);
@@ -19,15 +19,19 @@
 #include "event_impl.h"
 #include "program_impl.h"
 #include "network_impl.h"
+#include "layout_tuner.h"
 #include "gpu/ocl_toolkit.h"
 #include "gpu/memory_gpu.h"
 #include "gpu/ocl_user_event.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace cldnn
 {
 using gpu_toolkit_config = gpu::configuration;
 
-gpu_toolkit_config convert_configuration(const engine_configuration conf)
+gpu_toolkit_config convert_configuration(const engine_configuration conf, uint32_t engine_num)
 {
     gpu_toolkit_config result;
     result.compiler_options = conf.compiler_options;
@@ -35,20 +39,28 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf)
     result.meaningful_kernels_names = conf.meaningful_kernels_names != 0;
     result.dump_custom_program = conf.dump_custom_program != 0;
     result.single_kernel_name = conf.single_kernel_name;
-    result.host_out_of_order = true; //TODO: enable when barriers in driver will be fixed
+    result.host_out_of_order = conf.enable_parallelisation != 0;
     result.log = conf.engine_log;
     result.ocl_sources_dumps_dir = conf.sources_dumps_dir;
+    result.kernels_cache_dir = conf.kernels_cache_dir;
+    result.user_context = static_cast<cl_context>(conf.context);
     result.priority_mode = static_cast<cldnn_priority_mode_type>(conf.priority_mode);
     result.throttle_mode = static_cast<cldnn_throttle_mode_type>(conf.throttle_mode);
+    result.device_index = engine_num;
     return result;
 }
 
-engine_impl::engine_impl(const engine_configuration& conf)
+engine_impl::engine_impl(const engine_configuration& conf, uint32_t engine_num)
     : _configuration(conf)
-    , _context(gpu_toolkit::create(convert_configuration(conf)))
+    , _context(gpu_toolkit::create(convert_configuration(conf, engine_num)))
     , _memory_pool(*this)
 { }
 
+uint32_t engine_impl::count()
+{
+    return gpu::get_gpu_device_count(gpu_toolkit_config());
+}
+
 memory_impl::ptr engine_impl::allocate_memory(layout layout)
 {
     return _memory_pool.get_memory(layout);
@@ -83,6 +95,86 @@ memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, layo
     }
 }
 
+memory_impl::ptr engine_impl::share_host_memory(layout layout, void* host_ptr)
+{
+    try {
+        return{ new gpu::gpu_buffer(this, layout, host_ptr), false };
+    }
+    catch (cl::Error const& err) {
+        throw gpu::ocl_error(err);
+    }
+}
+
+memory_impl::ptr engine_impl::allocate_staging_memory(layout layout)
+{
+    if (layout.format.is_image())
+        throw error("the staging memory of the image formats is not supported", CLDNN_ERROR);
+    try {
+        return{ new gpu::gpu_buffer(this, layout, gpu::gpu_buffer::staging_tag()), false };
+    }
+    catch (cl::Error const& err) {
+        throw gpu::ocl_error(err);
+    }
+}
+
+void engine_impl::upload_memory(memory_impl& staging, memory_impl& memory)
+{
+    if (!staging.is_staging() || !staging.is_allocated_by(*this) || !memory.is_allocated_by(*this) ||
+        memory.get_layout().format.is_image() || staging.size() != memory.size())
+        throw error("the upload needs the staging memory and the buffer of the same size and of the same engine", CLDNN_ERROR);
+    try {
+        dynamic_cast<gpu::gpu_buffer&>(staging).upload_to(dynamic_cast<const gpu::gpu_buffer&>(memory));
+    }
+    catch (cl::Error const& err) {
+        throw gpu::ocl_error(err);
+    }
+}
+
+void engine_impl::download_memory(memory_impl& staging, const memory_impl& memory)
+{
+    if (!staging.is_staging() || !staging.is_allocated_by(*this) || !memory.is_allocated_by(*this) ||
+        memory.get_layout().format.is_image() || staging.size() != memory.size())
+        throw error("the download needs the staging memory and the buffer of the same size and of the same engine", CLDNN_ERROR);
+    try {
+        dynamic_cast<gpu::gpu_buffer&>(staging).download_from(dynamic_cast<const gpu::gpu_buffer&>(memory));
+    }
+    catch (cl::Error const& err) {
+        throw gpu::ocl_error(err);
+    }
+}
+
+memory_impl::ptr engine_impl::attach_cl_buffer(layout layout, void* buffer)
+{
+    try {
+        cl::Buffer cl_buffer(static_cast<cl_mem>(buffer), true);
+        if (cl_buffer.getInfo<CL_MEM_CONTEXT>() != get_context()->context())
+            throw error("trying to attach a buffer of a different OpenCL context", CLDNN_ERROR);
+        if (cl_buffer.getInfo<CL_MEM_SIZE>() < layout.bytes_count())
+            throw error("the size of the attached buffer is smaller than the layout size", CLDNN_ERROR);
+        return{ new gpu::gpu_buffer(this, layout, cl_buffer), false };
+    }
+    catch (cl::Error const& err) {
+        throw gpu::ocl_error(err);
+    }
+}
+
+memory_impl::ptr engine_impl::share_memory_of_context(const memory_impl& memory)
+{
+    auto& other = memory.get_engine();
+    if (other == nullptr || other->get_context()->context()() != get_context()->context()())
+        return nullptr;
+
+    try {
+        if (memory.get_layout().format.is_image_2d())
+            return{ new gpu::gpu_image2d(this, memory.get_layout(), reinterpret_cast<const gpu::gpu_image2d&>(memory).get_buffer()), false };
+        else
+            return{ new gpu::gpu_buffer(this, memory.get_layout(), reinterpret_cast<const gpu::gpu_buffer&>(memory).get_buffer()), false };
+    }
+    catch (cl::Error const& err) {
+        throw gpu::ocl_error(err);
+    }
+}
+
 bool engine_impl::is_the_same_buffer(const memory_impl& mem1, const memory_impl& mem2)
 {
     if (mem1.get_engine() != this || mem2.get_engine() != this)
@@ -115,6 +207,10 @@ void engine_impl::release_pending_memory()
 
 program_impl::ptr engine_impl::build_program(const topology_impl& topology, const build_options& options, bool is_internal)
 {
+    // the layouts of the internal programs follow the program which builds them
+    if (!is_internal && options.get<build_option_type::tuning_config>()->config.mode != tuning_mode::tuning_disabled)
+        return layout_tuner(*this, topology, options).build_program();
+
     return{ new program_impl(*this, topology, options, is_internal), false };
 }
 
@@ -147,6 +243,119 @@ void engine_impl::compile_program(program_impl& program)
     _context->get_kernels_cache().build_all();
 }
 
+bool engine_impl::is_out_of_order_queue() const
+{
+    return get_context()->get_configuration().host_out_of_order;
+}
+
+cldnn_tuning_statistics engine_impl::get_tuning_statistics() const
+{
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    return _tuning_statistics;
+}
+
+void engine_impl::add_tuning_statistics(const cldnn_tuning_statistics& statistics)
+{
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    _tuning_statistics.online_cache_hits += statistics.online_cache_hits;
+    _tuning_statistics.offline_cache_hits += statistics.offline_cache_hits;
+    _tuning_statistics.cache_misses += statistics.cache_misses;
+}
+
+cldnn_build_statistics engine_impl::get_build_statistics() const
+{
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    return _build_statistics;
+}
+
+void engine_impl::add_build_statistics(const cldnn_build_statistics& statistics)
+{
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    _build_statistics.programs += statistics.programs;
+    _build_statistics.graph_optimization_time += statistics.graph_optimization_time;
+    _build_statistics.kernels_selection_time += statistics.kernels_selection_time;
+    _build_statistics.tuning_lookup_time += statistics.tuning_lookup_time;
+    _build_statistics.kernels_compilation_time += statistics.kernels_compilation_time;
+}
+
+memory_impl::ptr engine_impl::get_cached_constant(const std::string& key, const layout& layout)
+{
+    std::lock_guard<std::mutex> lock(_constants_mutex);
+    auto constant = _constants.find(key);
+    if (constant == _constants.end() || constant->second.size() != layout.bytes_count())
+        return nullptr;
+
+    auto memory = allocate_memory(layout);
+    mem_lock<char> ptr(memory);
+    std::copy(constant->second.begin(), constant->second.end(), ptr.begin());
+    return memory;
+}
+
+void engine_impl::store_constant(const std::string& key, memory_impl& memory)
+{
+    mem_lock<char> ptr(memory);
+    std::vector<char> data(ptr.begin(), ptr.end());
+
+    std::lock_guard<std::mutex> lock(_constants_mutex);
+    _constants[key] = std::move(data);
+}
+
+// The blob is the number of the constants followed by the key and the data of each constant,
+// the sizes precede the strings and the data, as in the blob of the programs binaries.
+std::vector<char> engine_impl::get_constants_data() const
+{
+    std::lock_guard<std::mutex> lock(_constants_mutex);
+
+    std::vector<char> blob;
+    auto write_size = [&](uint64_t size)
+    {
+        const auto* bytes = reinterpret_cast<const char*>(&size);
+        blob.insert(blob.end(), bytes, bytes + sizeof(size));
+    };
+
+    write_size(_constants.size());
+    for (const auto& constant : _constants)
+    {
+        write_size(constant.first.size());
+        blob.insert(blob.end(), constant.first.begin(), constant.first.end());
+        write_size(constant.second.size());
+        blob.insert(blob.end(), constant.second.begin(), constant.second.end());
+    }
+    return blob;
+}
+
+void engine_impl::set_constants_data(const char* data, size_t size)
+{
+    size_t offset = 0;
+    auto read_size = [&]()
+    {
+        uint64_t value;
+        if (size - offset < sizeof(value))
+            throw std::invalid_argument("the constants data are truncated");
+        std::memcpy(&value, data + offset, sizeof(value));
+        offset += sizeof(value);
+        if (value > size - offset)
+            throw std::invalid_argument("the constants data are truncated");
+        return static_cast<size_t>(value);
+    };
+
+    std::map<std::string, std::vector<char>> constants;
+    for (size_t count = read_size(), i = 0; i < count; i++)
+    {
+        auto key_size = read_size();
+        std::string key(data + offset, key_size);
+        offset += key_size;
+
+        auto data_size = read_size();
+        constants[key].assign(data + offset, data + offset + data_size);
+        offset += data_size;
+    }
+
+    std::lock_guard<std::mutex> lock(_constants_mutex);
+    for (auto& constant : constants)
+        _constants[constant.first] = std::move(constant.second);
+}
+
 bool engine_impl::use_memory_pool() const
 {
     if (configuration().enable_memory_pool && get_context()->is_neo_driver())
@@ -30,6 +30,9 @@ namespace cldnn {
             , host_out_of_order(false)
             , log("")
             , ocl_sources_dumps_dir("")
+            , kernels_cache_dir("")
+            , user_context(nullptr)
+            , device_index(0)
         {}
     }
 }
@@ -51,6 +51,8 @@ protected:
         args.bias                 = instance.bias_term() ? &instance.bias_memory(split) : nullptr;
         args.weights_quantization_factors = instance.weights_quantization_factors_term() ? &instance.weights_quantization_factors_memory(split) : nullptr;
         args.output_calibration_factors = instance.output_calibration_factors_term() ? &instance.output_calibration_factors_memory(split) : nullptr;
+        if (_outer.has_fused_eltwise())
+            args.inputs.push_back(&instance.fused_eltwise_memory());
         return args;
     }
 
@@ -97,6 +99,12 @@ public:
         conv_params.depthwiseSeparableOpt = depthwise_separable_opt;
         conv_params.transposed = transposed;
 
+        if (arg.has_fused_eltwise())
+        {
+            conv_params.inputs.push_back(convert_data_tensor(arg.fused_eltwise_input().get_output_layout()));
+            conv_params.fused_eltwise = true;
+        }
+
         conv_params.split = split;
         conv_params.filterSize = {
             (uint32_t)weights_size.spatial[0],
@@ -136,7 +144,8 @@ public:
 
         const auto& tuning_config = arg.get_program().get_options().get<build_option_type::tuning_config>();
 
-        if (tuning_config->config.mode == tuning_mode::tuning_tune_and_cache)
+        if (tuning_config->config.mode == tuning_mode::tuning_tune_and_cache ||
+            tuning_config->config.mode == tuning_mode::tuning_tune_network_and_cache)
         {
             conv_optional_params.tuningParams.runner = std::make_shared<gpu::kernel_runner>(arg.get_program().get_engine(), true);
         }
@@ -176,6 +176,7 @@ engine_info_internal::engine_info_internal(const gpu_toolkit& context)
     max_alloc_mem_size = static_cast<uint64_t>(context.device().getInfo<CL_DEVICE_MAX_MEM_ALLOC_SIZE>());
 
     supports_image = static_cast<uint8_t>(context.device().getInfo<CL_DEVICE_IMAGE_SUPPORT>());
+    supports_host_unified_memory = static_cast<uint8_t>(context.device().getInfo<CL_DEVICE_HOST_UNIFIED_MEMORY>());
     max_image2d_width = static_cast<uint64_t>(context.device().getInfo<CL_DEVICE_IMAGE2D_MAX_WIDTH>());
     max_image2d_height = static_cast<uint64_t>(context.device().getInfo<CL_DEVICE_IMAGE2D_MAX_HEIGHT>());
 
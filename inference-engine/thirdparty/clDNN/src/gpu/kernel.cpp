@@ -17,6 +17,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <iterator>
+#include <cstring>
 #include "kernel.h"
 #include "memory_gpu.h"
 
@@ -38,8 +39,64 @@ namespace {
         }
     }
 
+    // sets the arguments which differ from the ones set to the kernel by the previous execution
+    class arguments_setter
+    {
+    public:
+        arguments_setter(cl::Kernel& kernel, std::vector<kernel::argument_value>& values)
+            : _kernel(kernel), _values(values)
+        {}
+
+        cl_int set_buffer(uint32_t index, const memory_impl::cptr& mem)
+        {
+            if (is_set(index, mem))
+                return CL_SUCCESS;
+            return store(index, _kernel.setArg(index, dynamic_cast<const gpu::gpu_buffer&>(*mem).get_buffer()), mem, 0);
+        }
+
+        cl_int set_memory(uint32_t index, const memory_impl::cptr& mem)
+        {
+            if (!mem->get_layout().format.is_image_2d())
+                return set_buffer(index, mem);
+            if (is_set(index, mem))
+                return CL_SUCCESS;
+            return store(index, _kernel.setArg(index, dynamic_cast<const gpu::gpu_image2d&>(*mem).get_buffer()), mem, 0);
+        }
+
+        template <typename T>
+        cl_int set_value(uint32_t index, T value)
+        {
+            static_assert(sizeof(T) <= sizeof(uint64_t), "the scalar arguments are compared as 64-bit values");
+            uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(T));
+            const auto& stored = _values[index];
+            if (stored.is_set && !stored.memory && stored.value == bits)
+                return CL_SUCCESS;
+            return store(index, _kernel.setArg(index, value), {}, bits);
+        }
+
+    private:
+        bool is_set(uint32_t index, const memory_impl::cptr& mem) const
+        {
+            const auto& stored = _values[index];
+            return stored.is_set && stored.memory == mem;
+        }
+
+        cl_int store(uint32_t index, cl_int status, const memory_impl::cptr& mem, uint64_t bits)
+        {
+            auto& stored = _values[index];
+            stored.is_set = status == CL_SUCCESS;
+            stored.memory = mem;
+            stored.value = bits;
+            return status;
+        }
+
+        cl::Kernel& _kernel;
+        std::vector<kernel::argument_value>& _values;
+    };
+
     void set_arguments(
-        cl::Kernel& kernel,
+        arguments_setter& setter,
         const kernel_selector::kernel_arguments& args,
         const kernel::kernel_arguments_data& data)
     {
@@ -55,7 +112,7 @@ namespace {
                     const auto& input_mem = data.inputs[args[i].index];
                     if (input_mem)
                     {
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*input_mem).get_buffer());
+                        status = setter.set_buffer(i, input_mem);
                     }
                 }
                 break;
@@ -65,78 +122,69 @@ namespace {
                     const auto& input_mem = data.intermediates[args[i].index];
                     if (input_mem)
                     {
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*input_mem).get_buffer());
+                        status = setter.set_buffer(i, input_mem);
                     }
                 }
                 break;
             case kernel_selector::kernel_argument_types::OUTPUT:
                 if (data.output)
                 {
-                    if (data.output->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.output).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.output).get_buffer());
+                    status = setter.set_memory(i, data.output);
                 }
                 break;
             case kernel_selector::kernel_argument_types::WEIGHTS:
                 if (data.weights)
                 {
-                    if (data.weights->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.weights).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.weights).get_buffer());
+                    status = setter.set_memory(i, data.weights);
                 }
                 break;
             case kernel_selector::kernel_argument_types::BIAS:
                 if (data.bias)
                 {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.bias).get_buffer());
+                    status = setter.set_buffer(i, data.bias);
                 }
                 break;
             case kernel_selector::kernel_argument_types::PREV_WEIGHTS_GRADIENT:
                 if (data.prev_weights_grad)
                 {
-                    if (data.prev_weights_grad->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.prev_weights_grad).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.prev_weights_grad).get_buffer());
+                    status = setter.set_memory(i, data.prev_weights_grad);
                 }
                 break;
             case kernel_selector::kernel_argument_types::PREV_BIAS_GRADIENT:
                 if (data.prev_bias_grad)
                 {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.prev_bias_grad).get_buffer());
+                    status = setter.set_buffer(i, data.prev_bias_grad);
                 }
                 break;
             case kernel_selector::kernel_argument_types::WEIGHTS_QUANTIZATION_FACTORS:
                 if (data.weights_quantization_factors)
                 {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.weights_quantization_factors).get_buffer());
+                    status = setter.set_buffer(i, data.weights_quantization_factors);
                 }
                 break;
             case kernel_selector::kernel_argument_types::OUTPUT_CALIBRATION_FACTORS:
                 if (data.output_calibration_factors)
                 {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.output_calibration_factors).get_buffer());
+                    status = setter.set_buffer(i, data.output_calibration_factors);
                 }
                 break;
             case kernel_selector::kernel_argument_types::SCALE_TABLE:
                 if (data.scale_table)
                 {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.scale_table).get_buffer());
+                    status = setter.set_buffer(i, data.scale_table);
                 }
                 break;
             case kernel_selector::kernel_argument_types::SLOPE:
                 if (data.slope)
                 {
-                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.slope).get_buffer());
+                    status = setter.set_buffer(i, data.slope);
                 }
                 break;
             case kernel_selector::kernel_argument_types::SPLIT:
-                status = kernel.setArg(i, data.split);
+                status = setter.set_value(i, data.split);
                 break;
             case kernel_selector::kernel_argument_types::LEARNING_RATE:
-                status = kernel.setArg(i, data.lr);
+                status = setter.set_value(i, data.lr);
                 break;
             case kernel_selector::kernel_argument_types::SCALAR:
                 if (data.scalars && args[i].index < data.scalars->size())
@@ -145,34 +193,34 @@ namespace {
                     switch (scalar.t)
                     {
                     case kernel_selector::kernel_scalar_argument_types::UINT8:
-                        status = kernel.setArg(i, scalar.v.u8);
+                        status = setter.set_value(i, scalar.v.u8);
                         break;
                     case kernel_selector::kernel_scalar_argument_types::UINT16:
-                        status = kernel.setArg(i, scalar.v.u16);
+                        status = setter.set_value(i, scalar.v.u16);
                         break;
                     case kernel_selector::kernel_scalar_argument_types::UINT32:
-                        status = kernel.setArg(i, scalar.v.u32);
+                        status = setter.set_value(i, scalar.v.u32);
                         break;
                     case kernel_selector::kernel_scalar_argument_types::UINT64:
-                        status = kernel.setArg(i, scalar.v.u64);
+                        status = setter.set_value(i, scalar.v.u64);
                         break;
                     case kernel_selector::kernel_scalar_argument_types::INT8:
-                        status = kernel.setArg(i, scalar.v.s8);
+                        status = setter.set_value(i, scalar.v.s8);
                         break;
                     case kernel_selector::kernel_scalar_argument_types::INT16:
-                        status = kernel.setArg(i, scalar.v.s16);
+                        status = setter.set_value(i, scalar.v.s16);
                         break;
                     case kernel_selector::kernel_scalar_argument_types::INT32:
-                        status = kernel.setArg(i, scalar.v.s32);
+                        status = setter.set_value(i, scalar.v.s32);
                         break;
                     case kernel_selector::kernel_scalar_argument_types::INT64:
-                        status = kernel.setArg(i, scalar.v.s64);
+                        status = setter.set_value(i, scalar.v.s64);
                         break;
                     case kernel_selector::kernel_scalar_argument_types::FLOAT32:
-                        status = kernel.setArg(i, scalar.v.f32);
+                        status = setter.set_value(i, scalar.v.f32);
                         break;
                     case kernel_selector::kernel_scalar_argument_types::FLOAT64:
-                        status = kernel.setArg(i, scalar.v.f64);
+                        status = setter.set_value(i, scalar.v.f64);
                         break;
                     default:
                         break;
@@ -182,28 +230,19 @@ namespace {
             case kernel_selector::kernel_argument_types::RECURRENT: // RNN/LSTM/GRU layers
                 if (data.recurrent)
                 {
-                    if (data.recurrent->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.recurrent).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.recurrent).get_buffer());
+                    status = setter.set_memory(i, data.recurrent);
                 }
                 break;
             case kernel_selector::kernel_argument_types::HIDDEN: // RNN/LSTM/GRU layers
                 if (data.hidden)
                 {
-                    if (data.hidden->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.hidden).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.hidden).get_buffer());
+                    status = setter.set_memory(i, data.hidden);
                 }
                 break;
             case kernel_selector::kernel_argument_types::CELL: // LSTMlayers
                 if (data.cell)
                 {
-                    if (data.cell->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.cell).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.cell).get_buffer());
+                    status = setter.set_memory(i, data.cell);
                 }
                 break;
             default:
@@ -223,9 +262,24 @@ event_impl::ptr kernel::run(
     const std::vector<event_impl::ptr>& dependencies,
     const kernel_arguments_data& args) const
 {
-    auto clkernel = context()->get_kernels_cache().get_kernel(_kernel_id, _one_time_kernel);
+    // the one time kernels are not kept, their arguments are set for the single execution
+    std::vector<argument_value> one_time_arguments;
+    auto& arguments = _one_time_kernel ? one_time_arguments : _arguments;
+    kernels_cache::kernel_type one_time_kernel;
+    auto& clkernel = _one_time_kernel ? one_time_kernel : _compiled_kernel;
     try {
-        set_arguments(clkernel, kernel_data.arguments, args);
+        if (clkernel.get() == nullptr)
+        {
+            auto cached_kernel = context()->get_kernels_cache().get_kernel(_kernel_id, _one_time_kernel);
+            if (_one_time_kernel)
+                clkernel = cached_kernel;
+            else
+                clkernel = kernels_cache::kernel_type(cached_kernel.getInfo<CL_KERNEL_PROGRAM>(), cached_kernel.getInfo<CL_KERNEL_FUNCTION_NAME>().c_str());
+        }
+
+        arguments.resize(kernel_data.arguments.size());
+        arguments_setter setter(clkernel, arguments);
+        set_arguments(setter, kernel_data.arguments, args);
     }
     catch (cl::Error const& err) {
         throw ocl_error(err);
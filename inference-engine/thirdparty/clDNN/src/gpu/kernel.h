@@ -32,9 +32,24 @@ namespace cldnn { namespace gpu {
 
 class kernel : public context_holder 
 {
+public:
+    // the value of an argument set to the OpenCL kernel, the memory is held so that its buffer is not replaced by another one under the same handle
+    struct argument_value
+    {
+        memory_impl::cptr memory;
+        uint64_t value = 0;
+        bool is_set = false;
+    };
+
+private:
     kernels_cache::kernel_id _kernel_id;
     bool _one_time_kernel; //If this flag is true, the kernel is intended to be executed only once (can be removed later from the cache).
 
+    // the OpenCL kernel of this object only, the kernels of the cache are shared by the primitives with the same sources,
+    // so the arguments set to it stay valid between the executions and only the changed ones are set again
+    mutable kernels_cache::kernel_type _compiled_kernel;
+    mutable std::vector<argument_value> _arguments;
+
 public:
     explicit kernel(std::shared_ptr<gpu_toolkit> context, const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program = false, bool one_time_kernel = false)
         : context_holder(context)
@@ -42,6 +57,7 @@ public:
 		, _one_time_kernel(one_time_kernel)
     {}
 
+    // the copy creates its own OpenCL kernel, the arguments set to the one of the other object are not shared
     kernel(const kernel& other) : context_holder(other.context()), _kernel_id(other._kernel_id), _one_time_kernel(other._one_time_kernel) {}
 
     kernel& operator=(const kernel& other) 
@@ -53,6 +69,8 @@ public:
 
         _kernel_id = other._kernel_id;
         _one_time_kernel = other._one_time_kernel;
+        _compiled_kernel = kernels_cache::kernel_type();
+        _arguments.clear();
 
         return *this;
     }
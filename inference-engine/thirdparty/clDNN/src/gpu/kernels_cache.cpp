@@ -21,7 +21,13 @@
 #include <cassert>
 #include <sstream>
 #include <fstream>
+#include <functional>
+#include <iomanip>
+#include <random>
 #include <set>
+#include <thread>
+#include <cstdio>
+#include <cstring>
 
 #include "kernel_selector_helper.h"
 
@@ -110,6 +116,68 @@ namespace {
             options.find("-D") == std::string::npos &&
             options.find("-I") == std::string::npos;
     }
+
+    // The binary is valid only for the same sources and options built for the same device by the same driver,
+    // so all of them are hashed into the key of the program.
+    std::string get_program_key(const kernels_cache::source_code& sources, const std::string& options, const std::string& device_key)
+    {
+        std::string key = device_key + '\n' + options + '\n';
+        for (const auto& s : sources)
+            key += s;
+
+        std::stringstream name;
+        name << "clDNN_program_" << std::hex << std::setfill('0') << std::setw(16) << std::hash<std::string>()(key)
+             << std::dec << '_' << key.size();
+        return name.str();
+    }
+
+    std::string get_cached_program_path(const std::string& cache_dir, const std::string& program_key)
+    {
+        std::string path = cache_dir;
+        if (!path.empty() && path.back() != '/')
+            path += '/';
+        return path + program_key + ".bin";
+    }
+
+    bool load_program_binary(const std::string& path, std::vector<unsigned char>& binary)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.good())
+            return false;
+
+        auto size = file.tellg();
+        if (size <= 0)
+            return false;
+
+        binary.resize(static_cast<size_t>(size));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(binary.data()), size);
+        return file.good();
+    }
+
+    // The cache is best-effort: a file which cannot be written is skipped. The binary is written to a temporary file
+    // first, so a concurrently started process never reads a partially written binary.
+    void save_program_binary(const std::string& path, const std::vector<unsigned char>& binary)
+    {
+        if (binary.empty())
+            return;
+
+        const auto tmp_path = path + ".tmp" + std::to_string(std::random_device()());
+        {
+            std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+            if (!file.good())
+                return;
+            file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+            if (!file.good())
+            {
+                file.close();
+                std::remove(tmp_path.c_str());
+                return;
+            }
+        }
+        if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+            std::remove(tmp_path.c_str());
+    }
 }
 
 kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code& kernels_source_code) const 
@@ -199,9 +267,14 @@ kernels_cache::kernel_id kernels_cache::set_kernel_source(const std::shared_ptr<
 
     if (it == _kernels_code.end())
     {
-        // we need unique id in order to avoid conflict across topologies.
-        const auto kernel_num = _kernels.size() + _kernels_code.size(); 
-        id = kernel_string->entry_point + "_" + std::to_string(kernel_num);
+        // we need unique id in order to avoid conflict across topologies. It's derived from the sources, not from
+        // the number of the kernels, since the primitives selected in parallel add their kernels in any order.
+        id = kernel_string->entry_point + "_" + std::to_string(std::hash<std::string>()(key));
+
+        // the same sources were compiled already, the kernel is reused
+        if (!one_time_kernel && _kernels.find(id) != _kernels.end())
+            return id;
+
         _kernels_code[key] = { kernel_string, id, dump_custom_program, one_time_kernel };
     }
     else
@@ -209,98 +282,174 @@ kernels_cache::kernel_id kernels_cache::set_kernel_source(const std::shared_ptr<
         id = it->second.id;
     }
 
-    assert(_kernels.find(id) == _kernels.end());
     _pending_compilation = true;
     return id;
 }
 
-kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source) const
+struct kernels_cache::program_part
 {
-    static uint32_t current_file_index = 0;
+    program_code* program;
+    const source_code* sources;
+    std::string dump_file_name;                         // empty if the sources are not dumped
+    std::string key;
+    kernels_map kernels;
+    kernels_binaries_vector binaries;
+    std::string err_log;                                // build log of the part, only if it failed to compile
+    std::exception_ptr error;
+};
+
+void kernels_cache::build_program(program_part& part) const
+{
+    const auto& program_source = *part.program;
+    const auto& sources = *part.sources;
+    const auto& cache_dir = _context.get_configuration().kernels_cache_dir;
 
-    bool dump_sources = !_context.get_configuration().ocl_sources_dumps_dir.empty() || program_source.dump_custom_program;
+    bool dump_sources = !part.dump_file_name.empty();
+    boost::optional<std::ofstream> dump_file;
 
-    std::string dump_file_name = "";
     if (dump_sources)
     {
-        dump_file_name = _context.get_configuration().ocl_sources_dumps_dir;
-        if (!dump_file_name.empty() && dump_file_name.back() != '/')
-            dump_file_name += '/';
-
-        dump_file_name += "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
+        dump_file.emplace(part.dump_file_name);
+        for (auto& s : sources)
+            dump_file.get() << s;
     }
 
     try
     {
-        kernels_map kmap;
-        std::string err_log; //accumulated build log from all program's parts (only contains messages from parts which failed to compile)
+        cl::Program program;
+        bool built = false;
 
-        uint32_t part_idx = 0;
-        for (const auto& sources : program_source.source)
+        auto build_from_binary = [&](const std::vector<unsigned char>& binary)
         {
-            auto current_dump_file_name = dump_file_name + std::to_string(part_idx++) + ".cl";
-            boost::optional<std::ofstream> dump_file;
-
-            if (dump_sources)
-            {
-                dump_file.emplace(current_dump_file_name);
-                for (auto& s : sources)
-                    dump_file.get() << s;
-            }
-
             try
             {
-                cl::Program program(_context.context(), sources);
+                program = cl::Program(_context.context(), { _context.device() }, cl::Program::Binaries{ binary });
                 program.build({ _context.device() }, program_source.options.c_str());
-                ///Store kernels for serialization process.
-                _context.store_binaries(program.getInfo<CL_PROGRAM_BINARIES>());
+                built = true;
+            }
+            catch (const cl::Error&)
+            {
+                // the driver rejected the binary, the program is rebuilt from the sources below
+            }
+        };
 
-                if (dump_sources)
-                {
-                    dump_file.get() << "\n/* Build Log:\n";
-                    for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
-                        dump_file.get() << p.second << "\n";
+        // the binaries set by set_programs_binaries() take precedence over the cache directory
+        auto it = _programs_binaries.find(part.key);
+        if (it != _programs_binaries.end())
+            build_from_binary(it->second);
 
-                    dump_file.get() << "*/\n";
-                }
+        std::string cache_path;
+        if (!cache_dir.empty())
+        {
+            cache_path = get_cached_program_path(cache_dir, part.key);
 
-                cl::vector<cl::Kernel> kernels;
-                program.createKernels(&kernels);
+            std::vector<unsigned char> binary;
+            if (!built && load_program_binary(cache_path, binary))
+                build_from_binary(binary);
+        }
 
-                for (auto& k : kernels)
-                {
-                    auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
-                    kmap.emplace(kernel_name, k);
-                }
-            }
-            catch (const cl::BuildError& err)
-            {
-                if (dump_sources)
-                    dump_file.get() << "\n/* Build Log:\n";
+        if (!built)
+        {
+            program = cl::Program(_context.context(), sources);
+            program.build({ _context.device() }, program_source.options.c_str());
 
-                for (auto& p : err.getBuildLog())
-                {
-                    if (dump_sources)
-                        dump_file.get() << p.second << "\n";
-                
-                    err_log += p.second + '\n';
-                }
+            if (!cache_path.empty())
+                save_program_binary(cache_path, program.getInfo<CL_PROGRAM_BINARIES>().front());
+        }
+        ///Store kernels for serialization process.
+        part.binaries = program.getInfo<CL_PROGRAM_BINARIES>();
 
-                if (dump_sources)
-                    dump_file.get() << "*/\n";
-            }
-            
+        if (dump_sources)
+        {
+            dump_file.get() << "\n/* Build Log:\n";
+            for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
+                dump_file.get() << p.second << "\n";
+
+            dump_file.get() << "*/\n";
         }
 
-        if (!err_log.empty())
-            throw std::runtime_error("Program build failed:\n" + std::move(err_log));
+        cl::vector<cl::Kernel> kernels;
+        program.createKernels(&kernels);
 
-        return kmap;
+        for (auto& k : kernels)
+        {
+            auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
+            part.kernels.emplace(kernel_name, k);
+        }
     }
-    catch (const cl::Error& err)
+    catch (const cl::BuildError& err)
     {
-        throw ocl_error(err);
+        if (dump_sources)
+            dump_file.get() << "\n/* Build Log:\n";
+
+        for (auto& p : err.getBuildLog())
+        {
+            if (dump_sources)
+                dump_file.get() << p.second << "\n";
+
+            part.err_log += p.second + '\n';
+        }
+
+        if (dump_sources)
+            dump_file.get() << "*/\n";
+    }
+}
+
+// The blob is the number of the programs followed by the key and the binary of each program,
+// the sizes precede the strings and the binaries.
+std::vector<char> kernels_cache::get_programs_binaries()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::vector<char> blob;
+    auto write_size = [&](uint64_t size)
+    {
+        const auto* bytes = reinterpret_cast<const char*>(&size);
+        blob.insert(blob.end(), bytes, bytes + sizeof(size));
+    };
+
+    write_size(_programs_binaries.size());
+    for (const auto& program : _programs_binaries)
+    {
+        write_size(program.first.size());
+        blob.insert(blob.end(), program.first.begin(), program.first.end());
+        write_size(program.second.size());
+        blob.insert(blob.end(), program.second.begin(), program.second.end());
+    }
+    return blob;
+}
+
+void kernels_cache::set_programs_binaries(const char* data, size_t size)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    size_t offset = 0;
+    auto read_size = [&]()
+    {
+        uint64_t value;
+        if (size - offset < sizeof(value))
+            throw std::invalid_argument("the programs binaries are truncated");
+        std::memcpy(&value, data + offset, sizeof(value));
+        offset += sizeof(value);
+        if (value > size - offset)
+            throw std::invalid_argument("the programs binaries are truncated");
+        return static_cast<size_t>(value);
+    };
+
+    std::map<std::string, std::vector<unsigned char>> programs;
+    for (size_t count = read_size(), i = 0; i < count; i++)
+    {
+        auto key_size = read_size();
+        std::string key(data + offset, key_size);
+        offset += key_size;
+
+        auto binary_size = read_size();
+        programs[key].assign(data + offset, data + offset + binary_size);
+        offset += binary_size;
     }
+
+    for (auto& program : programs)
+        _programs_binaries[program.first] = std::move(program.second);
 }
 
 kernels_cache::kernel_type kernels_cache::get_kernel(kernel_id id, bool one_time_kernel) 
@@ -325,16 +474,106 @@ void kernels_cache::build_all()
 
     auto sorted_program_code = get_program_source(_kernels_code);
 
-    _one_time_kernels.clear();
+    static uint32_t current_file_index = 0;
+
+    // The parts of all the programs are independent, so they are compiled concurrently. The results are merged
+    // afterwards in the order of the parts, which keeps the stored binaries and the error messages deterministic.
+    std::vector<program_part> parts;
     for (auto& program : sorted_program_code)
     {
-        auto kernels = build_program(program.second);
+        bool dump_sources = !_context.get_configuration().ocl_sources_dumps_dir.empty() || program.second.dump_custom_program;
 
-        for (auto& k : kernels)
+        std::string dump_file_name = "";
+        if (dump_sources)
+        {
+            dump_file_name = _context.get_configuration().ocl_sources_dumps_dir;
+            if (!dump_file_name.empty() && dump_file_name.back() != '/')
+                dump_file_name += '/';
+
+            dump_file_name += "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
+        }
+
+        uint32_t part_idx = 0;
+        for (const auto& sources : program.second.source)
+        {
+            program_part part{ &program.second, &sources };
+            if (dump_sources)
+                part.dump_file_name = dump_file_name + std::to_string(part_idx) + ".cl";
+            part_idx++;
+            parts.push_back(std::move(part));
+        }
+    }
+
+    try
+    {
+        const auto info = _context.get_engine_info();
+        const auto device_key = _context.device().getInfo<CL_DEVICE_NAME>() + '\n' + info.dev_id + '\n' + info.driver_version;
+        for (auto& part : parts)
+            part.key = get_program_key(*part.sources, part.program->options, device_key);
+    }
+    catch (const cl::Error& err)
+    {
+        throw ocl_error(err);
+    }
+
+    std::atomic<size_t> next_part{ 0 };
+    auto build_parts = [&]()
+    {
+        for (size_t i = next_part++; i < parts.size(); i = next_part++)
+        {
+            try
+            {
+                build_program(parts[i]);
+            }
+            catch (...)
+            {
+                parts[i].error = std::current_exception();
+            }
+        }
+    };
+
+    const size_t threads_count = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), parts.size());
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads_count; t++)
+        workers.emplace_back(build_parts);
+    build_parts();
+    for (auto& worker : workers)
+        worker.join();
+
+    try
+    {
+        std::map<const program_code*, std::string> err_logs; //accumulated build log from all program's parts (only contains messages from parts which failed to compile)
+        for (auto& part : parts)
+        {
+            if (part.error)
+                std::rethrow_exception(part.error);
+            err_logs[part.program] += part.err_log;
+        }
+
+        for (auto& program : sorted_program_code)
+        {
+            const auto& err_log = err_logs[&program.second];
+            if (!err_log.empty())
+                throw std::runtime_error("Program build failed:\n" + err_log);
+        }
+    }
+    catch (const cl::Error& err)
+    {
+        throw ocl_error(err);
+    }
+
+    _one_time_kernels.clear();
+    for (auto& part : parts)
+    {
+        if (!part.binaries.empty() && !part.binaries.front().empty())
+            _programs_binaries[part.key] = part.binaries.front();
+        _context.store_binaries(std::move(part.binaries));
+
+        for (auto& k : part.kernels)
         {
             const auto& entry_point = k.first;
-            const auto& k_id = program.second.entry_point_to_id[entry_point];
-            if (program.second.one_time)
+            const auto& k_id = part.program->entry_point_to_id[entry_point];
+            if (part.program->one_time)
             {
                 _one_time_kernels[k_id] = k.second;
             }
@@ -350,4 +589,3 @@ void kernels_cache::build_all()
 }
 
 }}
- 
\ No newline at end of file
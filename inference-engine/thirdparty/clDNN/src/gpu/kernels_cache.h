@@ -81,7 +81,10 @@ private:
     sorted_code get_program_source(const kernels_code& kernels_source_code) const;
     friend class gpu_toolkit;
     explicit kernels_cache(gpu_toolkit& context);
-    kernels_map build_program(const program_code& pcode) const;
+    std::map<std::string, std::vector<unsigned char>> _programs_binaries; // binaries of the built programs by the keys of their sources
+
+    struct program_part;
+    void build_program(program_part& part) const;
 
 public:
     kernel_id set_kernel_source(const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program, bool one_time_kernel);
@@ -89,6 +92,10 @@ public:
     gpu_toolkit& get_context() { return _context; }
     //forces compilation of all pending kernels/programs
     void build_all();
+    //returns the binaries of all the programs built so far as one blob
+    std::vector<char> get_programs_binaries();
+    //adds the programs from the blob of get_programs_binaries(), they are used instead of compiling the same sources
+    void set_programs_binaries(const char* data, size_t size);
 };
 
 }}
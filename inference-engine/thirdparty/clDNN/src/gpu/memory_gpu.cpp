@@ -21,11 +21,23 @@
 
 namespace cldnn { namespace gpu {
 
+namespace {
+// the buffers of the devices which share the memory with the host are allocated in the host accessible memory,
+// so mapping them makes no copy
+cl_mem_flags get_buffer_flags(const gpu_toolkit& context)
+{
+    cl_mem_flags flags = CL_MEM_READ_WRITE;
+    if (context.get_engine_info().supports_host_unified_memory)
+        flags |= CL_MEM_ALLOC_HOST_PTR;
+    return flags;
+}
+}
+
 gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout)
     : memory_impl(engine, layout)
     , _context(engine->get_context())
     , _lock_count(0)
-    , _buffer(_context->context(), CL_MEM_READ_WRITE, size())
+    , _buffer(_context->context(), get_buffer_flags(*_context), size())
     , _mapped_ptr(nullptr)
 {
     void* ptr = gpu_buffer::lock();
@@ -34,7 +46,7 @@ gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layo
 }
 
 gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const cl::Buffer& buffer)
-    : memory_impl(engine, new_layout)
+    : memory_impl(engine, new_layout, true)
     , _context(engine->get_context())
     , _lock_count(0)
     , _buffer(buffer)
@@ -43,8 +55,74 @@ gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layo
 
 }
 
+gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout, void* host_ptr)
+    : memory_impl(engine, layout, true)
+    , _context(engine->get_context())
+    , _lock_count(0)
+    , _buffer(_context->context(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, size(), host_ptr)
+    , _mapped_ptr(nullptr)
+{
+
+}
+
+gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout, staging_tag)
+    : memory_impl(engine, layout, true)
+    , _context(engine->get_context())
+    , _lock_count(0)
+    , _buffer(_context->context(), CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, size())
+    , _mapped_ptr(nullptr)
+    , _staging(true)
+{
+    _mapped_ptr = _context->queue().enqueueMapBuffer(_buffer, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0, size());
+    memset(_mapped_ptr, 0, size());
+}
+
+gpu_buffer::~gpu_buffer()
+{
+    if (_staging && _mapped_ptr != nullptr) {
+        try {
+            if (_transfer())
+                _transfer.wait();
+            _context->queue().enqueueUnmapMemObject(_buffer, _mapped_ptr);
+        } catch (...) {
+        }
+    }
+}
+
+bool gpu_buffer::blocking_transfers() const {
+    return _context->get_configuration().host_out_of_order;
+}
+
+void gpu_buffer::upload_to(const gpu_buffer& dst) {
+    std::lock_guard<std::mutex> locker(_mutex);
+    assert(_staging);
+    auto& queue = _context->queue();
+    if (blocking_transfers())
+        queue.finish();
+    queue.enqueueWriteBuffer(dst._buffer, blocking_transfers() ? CL_TRUE : CL_FALSE, 0, size(), _mapped_ptr,
+                             nullptr, &_transfer);
+}
+
+void gpu_buffer::download_from(const gpu_buffer& src) {
+    std::lock_guard<std::mutex> locker(_mutex);
+    assert(_staging);
+    auto& queue = _context->queue();
+    if (blocking_transfers())
+        queue.finish();
+    queue.enqueueReadBuffer(src._buffer, blocking_transfers() ? CL_TRUE : CL_FALSE, 0, size(), _mapped_ptr,
+                            nullptr, &_transfer);
+}
+
 void* gpu_buffer::lock() {
     std::lock_guard<std::mutex> locker(_mutex);
+    if (_staging) {
+        // the pointer stays the same, the host writes the data only when the device has read the previous ones
+        if (_transfer()) {
+            _transfer.wait();
+            _transfer = cl::Event();
+        }
+        return _mapped_ptr;
+    }
     if (0 == _lock_count) {
         _mapped_ptr = _context->queue().enqueueMapBuffer(_buffer, CL_TRUE, CL_MAP_WRITE, 0, size());
     }
@@ -54,6 +132,8 @@ void* gpu_buffer::lock() {
 
 void gpu_buffer::unlock() {
     std::lock_guard<std::mutex> locker(_mutex);
+    if (_staging)
+        return;
     _lock_count--;
     if (0 == _lock_count) {
         _context->queue().enqueueUnmapMemObject(_buffer, _mapped_ptr);
@@ -110,7 +190,7 @@ gpu_image2d::gpu_image2d(const refcounted_obj_ptr<engine_impl>& engine, const la
 }
 
 gpu_image2d::gpu_image2d(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const cl::Image2D& buffer)
-    : memory_impl(engine, new_layout)
+    : memory_impl(engine, new_layout, true)
     , _context(engine->get_context())
     , _lock_count(0)
     , _buffer(buffer)
@@ -62,22 +62,42 @@ struct gpu_buffer : public memory_impl {
     friend cldnn::memory_pool;
 
     gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const cl::Buffer& buffer);
+    // the buffer uses the host memory allocated by the user as its storage
+    gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout, void* host_ptr);
+
+    struct staging_tag {};
+    // the pinned host buffer mapped for its whole life, its pointer is the source and the destination of
+    // the non-blocking transfers of the device buffers which run at the full speed of the bus
+    gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout, staging_tag);
+    ~gpu_buffer();
+
     void* lock() override;
     void unlock() override;
     void fill(unsigned char pattern, event_impl::ptr ev) override;
+    bool is_staging() const override { return _staging; }
     const cl::Buffer& get_buffer() const {
         assert(0 == _lock_count);
         return _buffer;
     }
 
+    // the staging buffer is written to the device buffer after the commands enqueued before
+    void upload_to(const gpu_buffer& dst);
+    // the device buffer is read to the staging buffer after the commands enqueued before, the lock waits for it
+    void download_from(const gpu_buffer& src);
+
 private:
     gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout);
+    // the transfers of the out of order queue wait for all the commands and block, the in order queue orders them
+    bool blocking_transfers() const;
     
     std::shared_ptr<gpu_toolkit> _context;
     std::mutex _mutex;
     unsigned _lock_count;
     cl::Buffer _buffer;
     void* _mapped_ptr;
+    bool _staging = false;
+    // the last transfer of the staging buffer, the host waits for it before it touches the data
+    cl::Event _transfer;
 };
 
 struct gpu_image2d : public memory_impl {
@@ -22,6 +22,7 @@
 #include <cassert>
 #include <iomanip>
 #include <ios>
+#include <vector>
 
 // NOTE: Due to buggy scope transition of warnings we need to disable warning in place of use/instantation
 //       of some types (even though we already disabled them in scope of definition of these types).
@@ -100,54 +101,96 @@ namespace {
             ok = false;
         }
 
-        if (config.host_out_of_order)
+        return ok;
+    }
+
+    bool does_device_support_out_of_order(cl::Device const& dev)
+    {
+        auto queue_properties = dev.getInfo<CL_DEVICE_QUEUE_PROPERTIES>();
+        using cmp_t = std::common_type_t<decltype(queue_properties), std::underlying_type_t<cl::QueueProperties>>;
+        return (static_cast<cmp_t>(queue_properties) & static_cast<cmp_t>(cl::QueueProperties::OutOfOrder)) != 0;
+    }
+
+    // the matching devices in the order of the platforms, the index of the engine is the index in this list
+    std::vector<std::pair<cl::Device, cl_platform_id>> get_matching_devices(const configuration& config, std::list<std::string>& reasons)
+    {
+        cl_uint n = 0;
+
+        // Get number of platforms availible
+        cl_int err = clGetPlatformIDs(0, NULL, &n);
+        if (err != CL_SUCCESS) {
+            throw std::runtime_error("clGetPlatformIDs error " + std::to_string(err));
+        }
+
+        // Get platform list
+        std::vector<cl_platform_id> platform_ids(n);
+        err = clGetPlatformIDs(n, platform_ids.data(), NULL);
+        if (err != CL_SUCCESS) {
+            throw std::runtime_error("clGetPlatformIDs error " + std::to_string(err));
+        }
+
+        std::vector<std::pair<cl::Device, cl_platform_id>> result;
+        for (auto& id : platform_ids)
         {
-            auto queue_properties = dev.getInfo<CL_DEVICE_QUEUE_PROPERTIES>();
-            using cmp_t = std::common_type_t<decltype(queue_properties), std::underlying_type_t<cl::QueueProperties>>;
-            if (!(static_cast<cmp_t>(queue_properties) & static_cast<cmp_t>(cl::QueueProperties::OutOfOrder)))
+            cl::Platform platform = cl::Platform(id);
+            std::vector<cl::Device> devices;
+            platform.getDevices(CL_DEVICE_TYPE_ALL, &devices);
+            for (auto& d : devices)
             {
-                reasons.push_back(dev_name + ": missing out of order support");
-                ok = false;
+                if (does_device_match_config(d, config, reasons))
+                    result.emplace_back(d, id);
             }
         }
-
-        return ok;
+        return result;
     }
 }
 
-cl::Device get_gpu_device(const configuration& config, cl_platform_id& platform_id)
+uint32_t get_gpu_device_count(const configuration& config)
 {
     std::list<std::string> reasons;
-    cl_uint n = 0;
-
-    // Get number of platforms availible
-    cl_int err = clGetPlatformIDs(0, NULL, &n);
-    if (err != CL_SUCCESS) {
-        throw std::runtime_error("clGetPlatformIDs error " + std::to_string(err));
+    try {
+        return static_cast<uint32_t>(get_matching_devices(config, reasons).size());
     }
-
-    // Get platform list
-    std::vector<cl_platform_id> platform_ids(n);
-    err = clGetPlatformIDs(n, platform_ids.data(), NULL);
-    if (err != CL_SUCCESS) {
-        throw std::runtime_error("clGetPlatformIDs error " + std::to_string(err));
+    catch (cl::Error const& err) {
+        throw ocl_error(err);
     }
+}
 
-    for (auto& id : platform_ids)
+cl::Device get_gpu_device(const configuration& config, cl_platform_id& platform_id)
+{
+    std::list<std::string> reasons;
+
+    // the engine which uses the context of the user runs on a device of the context
+    if (config.user_context != nullptr)
     {
-        cl::Platform platform = cl::Platform(id);
-        std::vector<cl::Device> devices;
-        platform.getDevices(CL_DEVICE_TYPE_ALL, &devices);
-        for (auto& d : devices)
+        cl::Context context(config.user_context, true);
+        for (auto& d : context.getInfo<CL_CONTEXT_DEVICES>())
         {
             if (does_device_match_config(d, config, reasons))
             {
-                platform_id = id;
+                platform_id = d.getInfo<CL_DEVICE_PLATFORM>();
                 return d;
             }
         }
+
+        std::string error_msg = "No OpenCL device of the user context would match provided configuration:";
+        for (const auto& reason : reasons)
+            error_msg += "\n    " + reason;
+
+        throw std::invalid_argument(std::move(error_msg));
     }
 
+    auto devices = get_matching_devices(config, reasons);
+    if (config.device_index < devices.size())
+    {
+        platform_id = devices[config.device_index].second;
+        return devices[config.device_index].first;
+    }
+
+    if (!devices.empty())
+        throw std::invalid_argument("There is no OpenCL device with the index " + std::to_string(config.device_index) +
+                                    ", the number of the matching devices is " + std::to_string(devices.size()));
+
     if (reasons.empty())
         throw std::runtime_error("Could not find any OpenCL device");
 
@@ -173,103 +216,92 @@ gpu_toolkit::gpu_toolkit(const configuration& config)
     : _configuration(config)
     , _device(get_gpu_device(config, _platform_id))
     , _neo_driver(strstr(get_device_version().c_str(), "NEO") ? true : false)
-    , _context(_device)
-    , _command_queue(_context,
-                     _device,
-                     (config.enable_profiling
-                        ? cl::QueueProperties::Profiling
-                        : cl::QueueProperties::None) | 
-                     (config.host_out_of_order && _neo_driver
-                        ? cl::QueueProperties::OutOfOrder
-                        : cl::QueueProperties::None))
+    , _context(config.user_context != nullptr ? cl::Context(config.user_context, true) : cl::Context(_device))
     , _engine_info(*this)
     , _kernels_cache(*this)
 {
     _device.getInfo(CL_DEVICE_EXTENSIONS, &_extensions);
 
+    // the old drivers and the devices without the support execute the kernels in order, the events of the queue
+    // are then synchronized without the barriers
+    if (_configuration.host_out_of_order && !(_neo_driver && does_device_support_out_of_order(_device)))
+        _configuration.host_out_of_order = false;
+
     cl_command_queue_properties queue_properties =
         ((config.enable_profiling) ?
             CL_QUEUE_PROFILING_ENABLE :
             0) |
-            ((config.host_out_of_order &&
-                _neo_driver) ?
+            ((_configuration.host_out_of_order) ?
                 CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE :
                 0);
 
+    // the hints are the properties of the queue created by the extension function, the priority lets the queue of
+    // a latency-critical network preempt the queues of the other networks on the same device
+    std::vector<cl_queue_properties> hints;
     if (_configuration.priority_mode != cldnn_priority_disabled)
     {
-        if (extension_supported("cl_khr_priority_hints") &&
-            extension_supported("cl_intelx_create_command_queue"))
-            // TODO add check when caps will be availible (instead of cl_intelx_create_command_queue)
-            //&& extension_supported("cl_khr_create_command_queue"))
-        {
-            // TODO: When cl_khr_create_command_queue will be availible the
-            // function name will change to clCreateCommandQueueWithPropertiesKHR
-            // in place of clCreateCommandQueueWithPropertiesINTEL.
-            pfn_clCreateCommandQueueWithPropertiesINTEL clCreateCommandQueueWithPropertiesINTEL =
-                (pfn_clCreateCommandQueueWithPropertiesINTEL)clGetExtensionFunctionAddressForPlatform(
-                    _platform_id,
-                    "clCreateCommandQueueWithPropertiesINTEL");
-
-            unsigned cl_queue_priority_value = CL_QUEUE_PRIORITY_MED_KHR;
-
-            switch (_configuration.priority_mode)
-            {
-            case cldnn_priority_high:
-                cl_queue_priority_value = CL_QUEUE_PRIORITY_HIGH_KHR;
-                break;
-            case cldnn_priority_low:
-                cl_queue_priority_value = CL_QUEUE_PRIORITY_LOW_KHR;
-                break;
-            default:
-                break;
-            }
-
-            cl_int error_code = CL_SUCCESS;
-            cl_queue_properties properties_low[] = {
-                CL_QUEUE_PRIORITY_KHR, cl_queue_priority_value,
-                CL_QUEUE_PROPERTIES, queue_properties,
-                0 };
-
-            _command_queue = clCreateCommandQueueWithPropertiesINTEL(
-                _context.get(),
-                _device.get(),
-                properties_low,
-                &error_code);
-
-            if (error_code != CL_SUCCESS) {
-                throw std::runtime_error("clCreateCommandQueueWithPropertiesINTEL error " + std::to_string(error_code));
-            }
-        }
-        else
-        {
+        if (!extension_supported("cl_khr_priority_hints"))
             throw std::invalid_argument(
                 "The param priority_mode is set in engine_configuration,\
-                 but cl_khr_priority_hints or cl_khr_create_command_queue\
-                 is not supported by current OpenCL implementation.");
-        }
-    }
-    else
-    {
-        _command_queue = cl::CommandQueue(_context, _device, queue_properties);
+                 but cl_khr_priority_hints is not supported by current OpenCL implementation.");
+
+        cl_queue_properties priority = CL_QUEUE_PRIORITY_MED_KHR;
+        if (_configuration.priority_mode == cldnn_priority_high)
+            priority = CL_QUEUE_PRIORITY_HIGH_KHR;
+        else if (_configuration.priority_mode == cldnn_priority_low)
+            priority = CL_QUEUE_PRIORITY_LOW_KHR;
+        hints.insert(hints.end(), { CL_QUEUE_PRIORITY_KHR, priority });
     }
 
     if (_configuration.throttle_mode != cldnn_throttle_disabled)
     {
-        if (extension_supported("cl_khr_throttle_hints"))
-        {
-            throw std::invalid_argument(
-                "The param throttle_mode is set in engine_configuration,\
-                 but it is placeholder for future use. It has no effect for now\
-                 and should be set to cldnn_throttle_disabled");
-        }
-        else
-        {
+        if (!extension_supported("cl_khr_throttle_hints"))
             throw std::invalid_argument(
                 "The param throttle_mode is set in engine_configuration,\
                  but cl_khr_throttle_hints is not supported by current OpenCL implementation.");
+
+        cl_queue_properties throttle = CL_QUEUE_THROTTLE_MED_KHR;
+        if (_configuration.throttle_mode == cldnn_throttle_high)
+            throttle = CL_QUEUE_THROTTLE_HIGH_KHR;
+        else if (_configuration.throttle_mode == cldnn_throttle_low)
+            throttle = CL_QUEUE_THROTTLE_LOW_KHR;
+        hints.insert(hints.end(), { CL_QUEUE_THROTTLE_KHR, throttle });
+    }
+
+    if (!hints.empty())
+    {
+        // the function of cl_khr_create_command_queue, or of its Intel predecessor on the older drivers
+        pfn_clCreateCommandQueueWithPropertiesINTEL create_queue = nullptr;
+        if (extension_supported("cl_khr_create_command_queue"))
+            create_queue = (pfn_clCreateCommandQueueWithPropertiesINTEL)clGetExtensionFunctionAddressForPlatform(
+                _platform_id,
+                "clCreateCommandQueueWithPropertiesKHR");
+        if (!create_queue && extension_supported("cl_intelx_create_command_queue"))
+            create_queue = (pfn_clCreateCommandQueueWithPropertiesINTEL)clGetExtensionFunctionAddressForPlatform(
+                _platform_id,
+                "clCreateCommandQueueWithPropertiesINTEL");
+        if (!create_queue)
+            throw std::invalid_argument(
+                "The param priority_mode or throttle_mode is set in engine_configuration,\
+                 but cl_khr_create_command_queue is not supported by current OpenCL implementation.");
+
+        hints.insert(hints.end(), { CL_QUEUE_PROPERTIES, queue_properties, 0 });
+
+        cl_int error_code = CL_SUCCESS;
+        _command_queue = cl::CommandQueue(create_queue(
+            _context.get(),
+            _device.get(),
+            hints.data(),
+            &error_code));
+
+        if (error_code != CL_SUCCESS) {
+            throw std::runtime_error("clCreateCommandQueueWithProperties error " + std::to_string(error_code));
         }
     }
+    else
+    {
+        _command_queue = cl::CommandQueue(_context, _device, queue_properties);
+    }
 
     if (logging_enabled())
     {
@@ -287,6 +319,8 @@ gpu_toolkit::gpu_toolkit(const configuration& config)
             << "    out-of-order: "        << std::boolalpha << _configuration.host_out_of_order << "\n"
             << "    engine log: "          << _configuration.log << "\n"
             << "    sources dumps: "       << _configuration.ocl_sources_dumps_dir << "\n"
+            << "    kernels cache: "       << _configuration.kernels_cache_dir << "\n"
+            << "    user context: "        << std::boolalpha << (_configuration.user_context != nullptr) << "\n"
             << "\nEngine info:\n"
             << "    configuration: "       << std::to_string(_engine_info.configuration) << "\n"
             << "    model: "               << std::to_string(_engine_info.model) << "\n"
@@ -304,23 +338,27 @@ gpu_toolkit::gpu_toolkit(const configuration& config)
 
 event_impl::ptr gpu_toolkit::enqueue_kernel(cl::Kernel const& kern, cl::NDRange const& global, cl::NDRange const& local, std::vector<event_impl::ptr> const & deps)
 {
+    // the kernels of the in-order queue are executed after all the commands enqueued to it before, so only the events
+    // of the other queues are passed as the dependencies
     std::vector<cl::Event> dep_events;
-    auto dep_events_ptr = &dep_events;
     if (!_configuration.host_out_of_order)
     {
         for (auto& dep : deps)
             if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
-                dep_events.push_back(ocl_ev->get());
+                if (ocl_ev->get_context().get() != this)
+                    dep_events.push_back(ocl_ev->get());
     }
     else
     {
-        dep_events_ptr = nullptr;
         sync_events(deps);
     }
+    auto dep_events_ptr = dep_events.empty() ? nullptr : &dep_events;
 
+    // the event of the kernel is created only when it's awaited outside of the queue or profiled: the kernels of
+    // a queue depend on each other by the order of the queue or by its barriers, so the other events are not used
     cl::Event ret_ev;
     try {
-        if (!_configuration.host_out_of_order || _output_event || _configuration.enable_profiling)
+        if (_output_event || _configuration.enable_profiling)
         {
             _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
         }
@@ -357,13 +395,16 @@ event_impl::ptr gpu_toolkit::enqueue_marker(std::vector<event_impl::ptr> const&
         cl::Event ret_ev;
         if (!enabled_single_kernel())
         {
+            // the marker of the in-order queue waits for all the commands enqueued before, so the kernels without
+            // the events are awaited as well
             std::vector<cl::Event> dep_events;
             for (auto& dep : deps)
                 if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
-                    dep_events.push_back(ocl_ev->get());
+                    if (ocl_ev->get()() != nullptr)
+                        dep_events.push_back(ocl_ev->get());
 
             try {
-                _command_queue.enqueueMarkerWithWaitList(&dep_events, &ret_ev);
+                _command_queue.enqueueMarkerWithWaitList(dep_events.empty() ? nullptr : &dep_events, &ret_ev);
             } 
             catch (cl::Error const& err) {
                 throw ocl_error(err);
@@ -426,7 +467,11 @@ void gpu_toolkit::wait_for_events(std::vector<event_impl::ptr> const & events)
     std::vector<cl::Event> clevents;
     for (auto& ev : events)
         if (auto ocl_ev = dynamic_cast<base_event*>(ev.get()))
-            clevents.push_back(ocl_ev->get());
+            if (ocl_ev->get()() != nullptr)
+                clevents.push_back(ocl_ev->get());
+
+    if (clevents.empty())
+        return;
 
     try {
         cl::WaitForEvents(clevents);
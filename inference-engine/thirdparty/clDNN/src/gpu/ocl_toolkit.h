@@ -67,10 +67,16 @@ struct configuration
     bool host_out_of_order;
     std::string log;
     std::string ocl_sources_dumps_dir;
+    std::string kernels_cache_dir;
+    cl_context user_context;
     cldnn_priority_mode_type priority_mode;
     cldnn_throttle_mode_type throttle_mode;
+    uint32_t device_index;
 };
 
+// the number of the OpenCL devices which match the type and the vendor of the configuration
+uint32_t get_gpu_device_count(const configuration& config);
+
 class gpu_toolkit;
 
 class context_holder
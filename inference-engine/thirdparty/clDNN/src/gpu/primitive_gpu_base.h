@@ -22,7 +22,6 @@
 #include "events_waiter.h"
 #include "error_handler.h"
 #include "kernel_selector_helper.h"
-#include "detection_output_inst.h"
 #include "proposal_inst.h"
 #include "prior_box_inst.h"
 
@@ -41,6 +40,7 @@ struct typed_primitive_gpu_impl : public typed_primitive_impl<PType>
     kernel_selector::kernel_data _kernel_data;
     std::vector<gpu::kernel> _kernels;
     std::vector<memory_impl::cptr> _intermediates_memory;
+    boost::optional<bool> _output_event; // whether the events of the kernels are awaited outside of the queue, set by the first execution
 
     typed_primitive_gpu_impl(const typed_program_node<PType>& arg, const kernel_selector::kernel_data& kd)
         : typed_primitive_impl<PType>(kd.weightsReorderParams, kd.kernelName)
@@ -119,6 +119,22 @@ protected:
 
         std::vector<event_impl::ptr> tmp_events(events);
 
+        //is any user of the prim a cpu implementation (prior box or proposal), set prim as a output event (event won't be nullptr)
+        if (!_output_event)
+        {
+            bool next_prim_is_cpu = false;
+            for (const auto& user : instance.node.get_users())
+            {
+                if (user->type() == prior_box::type_id() ||
+                    user->type() == proposal::type_id())
+                {
+                    next_prim_is_cpu = true;
+                    break;
+                }
+            }
+            _output_event = next_prim_is_cpu || instance.node.is_output();
+        }
+
         // TODO - split should be handle in kernel selector by providing multiple kernels.
         auto split = get_split();
 
@@ -126,6 +142,7 @@ protected:
         for (size_t k = 0; k < _kernels.size(); ++k)
         {
             std::vector<event_impl::ptr> new_events;
+            new_events.reserve(split);
             for (decltype(split) i = 0; i < split; i++)
             {
                 auto args = get_arguments(instance, i);
@@ -137,28 +154,8 @@ protected:
                     args.intermediates.push_back(m);
                 }
 
-                //is any user of the prim's users is an detecion output, set prim as a output event (event won't be nullptr)
-                auto users = instance.node.get_users();
-                bool next_prim_is_cpu = false;
-                for (const auto& user : users)
-                {
-                    if (user->type() == detection_output::type_id() ||
-                        user->type() == prior_box::type_id() ||
-                        user->type() == proposal::type_id())
-                    {
-                        next_prim_is_cpu = true;
-                        break;
-                    }
-                }
-                if (next_prim_is_cpu)
-                {
-                    _kernels[k].set_output_event(true);
-                }
-                else
-                {
-                    _kernels[k].set_output_event(instance.node.is_output());
-                }
-    
+                _kernels[k].set_output_event(_output_event.get());
+
                 auto event = _kernels[k].run(_kernel_data.kernels[k], tmp_events, args);
                 new_events.push_back(event);
             }
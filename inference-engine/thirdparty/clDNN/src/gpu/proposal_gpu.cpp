@@ -15,6 +15,7 @@
 */
 
 #include "proposal_inst.h"
+#include "primitive_gpu_base.h"
 #include "kernel.h"
 #include "kd_selector.h"
 #include "implementation_map.h"
@@ -22,6 +23,9 @@
 #include "engine_impl.h"
 #include "math_utils.h"
 #include "error_handler.h"
+#include "kernel_selector_helper.h"
+#include "proposal/proposal_kernel_selector.h"
+#include "proposal/proposal_kernel_ref.h"
 
 #include <algorithm>
 #include <string>
@@ -186,11 +190,12 @@ namespace {
 *                                                                          *
 ****************************************************************************/
 
-struct proposal_gpu : typed_primitive_impl<proposal>
+// The host implementation, used when the proposals cannot be computed by the kernels
+struct proposal_host : typed_primitive_impl<proposal>
 {
     const proposal_node& outer;
 
-    proposal_gpu(const proposal_node& arg)
+    proposal_host(const proposal_node& arg)
         : outer(arg)
     {}
     
@@ -334,6 +339,29 @@ struct proposal_gpu : typed_primitive_impl<proposal>
         dynamic_cast<cldnn::user_event*>(ev.get())->set(); // set as complete
         return ev;
     }
+};
+
+// The proposals are generated, sorted and suppressed on the device, without the sync of the queue
+struct proposal_gpu : typed_primitive_gpu_impl<proposal>
+{
+    using parent = typed_primitive_gpu_impl<proposal>;
+    using parent::parent;
+
+protected:
+
+    virtual kernel::kernel_arguments_data get_arguments(typed_primitive_inst<proposal>& instance, int32_t) const override
+    {
+        kernel::kernel_arguments_data args;
+
+        args.inputs = { &instance.dep_memory(proposal_inst::cls_scores_index),
+                        &instance.dep_memory(proposal_inst::bbox_pred_index),
+                        &instance.dep_memory(proposal_inst::image_info_index) };
+        args.output = &instance.output_memory();
+
+        return args;
+    }
+
+public:
 
     static primitive_impl* create(const proposal_node& arg) 
     {
@@ -350,7 +378,32 @@ struct proposal_gpu : typed_primitive_impl<proposal>
         CLDNN_ERROR_BOOL(arg.id(), "Batching", !hasSingleBatchOutput(arg.bbox_pred()), "Proposal doesn't support batching.");
         CLDNN_ERROR_BOOL(arg.id(), "Batching", !hasSingleBatchOutput(arg.cls_score()), "Proposal doesn't support batching.");
 
-        return new proposal_gpu(arg);
+        auto proposal_params = get_default_params<kernel_selector::proposal_params>(arg);
+        auto proposal_optional_params = get_default_optional_params<kernel_selector::proposal_optional_params>(arg.get_program());
+
+        proposal_params.inputs.push_back(convert_data_tensor(arg.bbox_pred().get_output_layout()));
+        proposal_params.inputs.push_back(convert_data_tensor(l));
+
+        const auto& primitive = arg.get_primitive();
+        for (const auto& anchor : proposal_inst::generate_anchors(arg))
+        {
+            proposal_params.anchors.insert(proposal_params.anchors.end(), { anchor.start_x, anchor.start_y, anchor.end_x, anchor.end_y });
+        }
+        proposal_params.iou_threshold = primitive->iou_threshold;
+        proposal_params.min_bbox_size = primitive->min_bbox_size;
+        proposal_params.feature_stride = primitive->feature_stride;
+        proposal_params.pre_nms_topn = primitive->pre_nms_topn;
+        proposal_params.post_nms_topn = primitive->post_nms_topn;
+
+        auto& kernel_selector = kernel_selector::proposal_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(proposal_params, proposal_optional_params);
+
+        if (best_kernels.empty())
+        {
+            return new proposal_host(arg);
+        }
+
+        return new proposal_gpu(arg, best_kernels[0]);
     }
 };
 
@@ -20,6 +20,9 @@
 #include "program_impl.h"
 #include "data_inst.h"
 
+#include <map>
+#include <string>
+
 namespace cldnn
 {
 
@@ -37,10 +40,14 @@ private:
     topology_impl tpl;
     std::list<typed_program_node<data>*> const_inputs;
     std::vector<primitive_id> const_outputs;
+    std::vector<program_node*> const_nodes;
     bool has_non_trivial_constants = false;
 
     void handle_constant(program_node& node);
     void add_constant(program_node& node);
+    std::string get_cache_key(program_node& node, std::map<program_node*, std::string>& keys) const;
+    bool calculate_on_host(std::list<std::pair<primitive_id, memory_impl::ptr>>& outputs) const;
+    bool can_calculate_on_host(program_node& node) const;
 };
 
 }
@@ -35,6 +35,7 @@ public:
         , split(this->get_primitive()->split())
         , depthwise_sep_opt(false)
         , transposed(false)
+        , fused_eltwise(false)
         , input_qf(this->get_primitive()->input_quantization_factor)
         , output_qf(this->get_primitive()->output_quantization_factor)
     {
@@ -49,6 +50,10 @@ public:
     void set_transposed(bool node_transposed) { transposed = node_transposed; }
     bool get_transposed() const { return transposed; }
 
+    //the eltwise sum fused into the convolution, its other input is the last dependency
+    void set_fused_eltwise(bool node_fused_eltwise) { fused_eltwise = node_fused_eltwise; }
+    bool has_fused_eltwise() const { return fused_eltwise; }
+
     decltype(auto) input() const { return get_dependency(0); }
 
     decltype(auto) weights(size_t idx = 0) const
@@ -83,6 +88,14 @@ public:
         return get_dependency(1 + 3 * this->get_split() + idx);
     }
 
+    decltype(auto) fused_eltwise_input() const
+    {
+        if (!fused_eltwise)
+            throw std::logic_error("the convolution has no fused eltwise");
+
+        return get_dependency(get_dependencies().size() - 1);
+    }
+
     bool bias_term() const
     {
         return get_primitive()->bias.size() > 0;
@@ -105,6 +118,7 @@ private:
     int32_t split;
     bool depthwise_sep_opt;
     bool transposed;
+    bool fused_eltwise;
     float input_qf;
     float output_qf;
 };
@@ -155,6 +169,11 @@ public:
         return dep_memory(1 + 3 * node.get_split() + index);
     }
 
+    decltype(auto) fused_eltwise_memory() const
+    {
+        return dep_memory(node.get_dependencies().size() - 1);
+    }
+
     bool bias_term() const
     {
         return node.bias_term();
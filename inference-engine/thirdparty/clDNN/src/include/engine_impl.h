@@ -25,8 +25,12 @@
 
 #include "gpu/engine_info.h"
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <string>
+#include <vector>
 
 namespace cldnn {
 namespace gpu { 
@@ -48,13 +52,24 @@ struct typed_program_node;
 struct engine_impl : public refcounted_obj<engine_impl>
 {
 public:
-    engine_impl(const engine_configuration& conf);
+    engine_impl(const engine_configuration& conf, uint32_t engine_num = 0);
+
+    // the number of the devices the engines can be created on, the engine_num is the index of the device
+    static uint32_t count();
 
     engine_types type() const { return engine_types::ocl; }
 
     refcounted_obj_ptr<memory_impl> allocate_memory(layout layout);
     refcounted_obj_ptr<memory_impl> allocate_memory(layout layout, primitive_id, uint32_t, std::set<primitive_id>, bool reusable = true);
     refcounted_obj_ptr<memory_impl> reinterpret_buffer(const memory_impl& memory, layout new_layout);
+    refcounted_obj_ptr<memory_impl> share_host_memory(layout layout, void* host_ptr);
+    refcounted_obj_ptr<memory_impl> allocate_staging_memory(layout layout);
+    // the non-blocking transfers between the staging memory and the device memory of the engine
+    void upload_memory(memory_impl& staging, memory_impl& memory);
+    void download_memory(memory_impl& staging, const memory_impl& memory);
+    refcounted_obj_ptr<memory_impl> attach_cl_buffer(layout layout, void* buffer);
+    // returns the memory of another engine of the same OpenCL context used in place by this engine, nullptr if the contexts differ
+    refcounted_obj_ptr<memory_impl> share_memory_of_context(const memory_impl& memory);
     bool is_the_same_buffer(const memory_impl& mem1, const memory_impl& mem2);
 
     refcounted_obj_ptr<event_impl> create_user_event(bool set = false);
@@ -89,11 +104,33 @@ public:
 
     void dump_memory_pool(const program_impl& program, std::string path, std::string dependencies) { _memory_pool.dump_memory_pool(program, path, dependencies); }
     bool use_memory_pool() const;
+    // the kernels are executed by the out-of-order queue, so the independent primitives may run concurrently
+    bool is_out_of_order_queue() const;
+
+    // the statistics of the kernels selected by the auto tuner in the programs built by the engine
+    cldnn_tuning_statistics get_tuning_statistics() const;
+    void add_tuning_statistics(const cldnn_tuning_statistics& statistics);
+
+    // the time of the phases of the build of the programs, the internal programs are counted by the program which builds them
+    cldnn_build_statistics get_build_statistics() const;
+    void add_build_statistics(const cldnn_build_statistics& statistics);
+
+    // the host copies of the constants computed by the programs, they are kept if the constants cache is enabled
+    // returns the memory filled with the constant of the key, nullptr if the constant is not kept or its size differs
+    refcounted_obj_ptr<memory_impl> get_cached_constant(const std::string& key, const layout& layout);
+    void store_constant(const std::string& key, memory_impl& memory);
+    std::vector<char> get_constants_data() const;
+    void set_constants_data(const char* data, size_t size);
 
 private:
     engine_configuration _configuration;
     std::shared_ptr<gpu_toolkit> _context;
 	memory_pool _memory_pool;
+    cldnn_tuning_statistics _tuning_statistics = { 0, 0, 0 };
+    mutable std::mutex _statistics_mutex;
+    cldnn_build_statistics _build_statistics = { 0, 0, 0, 0, 0 };
+    std::map<std::string, std::vector<char>> _constants;
+    mutable std::mutex _constants_mutex;
 };
 }
 
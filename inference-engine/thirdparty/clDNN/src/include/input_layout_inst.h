@@ -48,6 +48,10 @@ public:
     typed_primitive_inst(network_impl& network, input_layout_node const& node);
 
     void set_data(memory_impl& mem);
+
+private:
+    // the device memory of the input, the staging memory set as the input is uploaded to it
+    memory_impl::ptr _device_memory;
 };
 
 using input_layout_inst = typed_primitive_inst<input_layout>;
@@ -227,6 +227,7 @@ inline kernel_selector::tuning_mode to_tuning_mode(cldnn::tuning_mode mode)
     case cldnn::tuning_mode::tuning_disabled:         return kernel_selector::tuning_mode::TUNING_DISABLED;
     case cldnn::tuning_mode::tuning_use_cache:        return kernel_selector::tuning_mode::TUNING_USE_CACHE;
     case cldnn::tuning_mode::tuning_tune_and_cache:   return kernel_selector::tuning_mode::TUNING_TUNE_AND_CACHE;
+    case cldnn::tuning_mode::tuning_tune_network_and_cache: return kernel_selector::tuning_mode::TUNING_TUNE_AND_CACHE;
     default:
         return kernel_selector::tuning_mode::TUNING_DISABLED;
     }
@@ -78,6 +78,8 @@ private:
     optimization_attributes _optimization_attributes;
     // TODO: Remove once we will get full support for input/output padding in all primitive implementations.
     bool _output_size_handling_enabled;
+    // the format of the convolutions inputs forced by the network-level tuning, format::any means it is chosen per convolution
+    format::type _conv_input_format;
 
     struct cache_key
     {
@@ -126,7 +128,10 @@ private:
     create_reorder_from_given_source(const cldnn::primitive_id& memid, layout const& expected_layout, const kernel_selector::weights_reorder_params& reorder_params);
 
 public:
-    explicit layout_optimizer(bool output_size_handling_enabled = true);
+    explicit layout_optimizer(bool output_size_handling_enabled = true, format::type conv_input_format = format::any);
+
+    //tells if the convolutions of the given data type can take their input in the format forced by the network-level tuning
+    static bool is_conv_input_format_supported(format::type fmt, data_types dt);
 
     //this method creates reorder for data, which is currently in 'data_layout' format, to best format in context of 'user' primitive.
     //data is used by 'user' in a way described by 'type' (i.e. weights/bias/input).
@@ -0,0 +1,56 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "engine_impl.h"
+#include "program_impl.h"
+#include "topology_impl.h"
+
+#include <string>
+#include <vector>
+
+namespace cldnn
+{
+
+//this class does the network-level tuning of the layouts.
+//the kernels tuned per primitive may require the layouts which add expensive reorders around them, so the plans of
+//the layouts (the format of the inputs of all convolutions, or the per-convolution choice of layout_optimizer) are compared
+//by executing the whole program built with each of them.
+//the plan of the fastest program is stored in the tuning file with the key of the topology, the next builds of the
+//topology in any tuning mode take the plan from the file without executing the candidates.
+//the weights are reordered to the formats required by the kernels once, when the program is built, so they don't take part in the plans.
+class layout_tuner
+{
+public:
+    layout_tuner(engine_impl& engine, const topology_impl& topology, const build_options& options);
+
+    //builds the program with the plan of the tuning file, or with the fastest plan in tuning_tune_network_and_cache mode
+    refcounted_obj_ptr<program_impl> build_program();
+
+private:
+    engine_impl& _engine;
+    const topology_impl& _topology;
+    const build_options& _options;
+
+    std::string get_network_key() const;
+    std::vector<format::type> get_candidate_plans() const;
+    refcounted_obj_ptr<program_impl> build_program(format::type conv_input_format) const;
+    //returns the shortest of several executions of the program in microseconds
+    uint64_t measure_program(const program_impl& program) const;
+};
+}
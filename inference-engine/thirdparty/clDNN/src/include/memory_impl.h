@@ -27,10 +27,11 @@ namespace cldnn
 
 struct memory_impl : refcounted_obj<memory_impl>
 {
-    memory_impl(const engine_impl::ptr& engine, layout layout): _engine(engine), _layout(layout){}
+    // the memory of the buffers given to the engine or shared with another memory object is not counted by the pool
+    memory_impl(const engine_impl::ptr& engine, layout layout, bool reused = false): _engine(engine), _layout(layout), _reused(reused){}
     virtual ~memory_impl()
     {
-        if (_engine != nullptr)
+        if (_engine != nullptr && !_reused)
         {
             _engine->get_memory_pool().subtract_memory_used(_layout.bytes_count());
         }
@@ -40,11 +41,14 @@ struct memory_impl : refcounted_obj<memory_impl>
     virtual void fill(unsigned char pattern, event_impl::ptr ev) = 0;
     size_t size() const { return _layout.bytes_count(); }
     virtual bool is_allocated_by(const engine_impl& engine) const { return &engine == _engine.get(); }
+    // the pinned host buffer the data are transferred to and from the device memory through
+    virtual bool is_staging() const { return false; }
     const refcounted_obj_ptr<engine_impl>& get_engine() const { return _engine; }
     const layout& get_layout() const { return _layout; }
 protected:
     const engine_impl::ptr _engine;
     const layout _layout;
+    const bool _reused;
 };
 
 struct simple_attached_memory : memory_impl
@@ -25,6 +25,7 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <atomic>
 
 namespace cldnn
 {
@@ -112,14 +113,20 @@ class memory_pool
     memory_pool();
 
     refcounted_obj_ptr<memory_impl> alloc_memory(const layout& layout);
+    refcounted_obj_ptr<memory_impl> alloc_pool_memory(const layout& layout);
+    refcounted_obj_ptr<memory_impl> take_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions);
+    bool exceeds_limit(const layout& layout) const;
     static bool has_conflict(const memory_set&, const std::set<primitive_id>&, uint32_t);
 
     std::multimap<uint64_t, memory_record> _non_padded_pool;
     std::map<layout,std::list<memory_record>, padded_pool_comparer> _padded_pool;
     std::multimap<uint64_t, memory_record> _no_reusable_pool;
     refcounted_obj_ptr<engine_impl> _engine;
-    uint64_t _temp_memory_used;
-    uint64_t _max_peak_memory_used;
+    // the buffers allocated by the primitives selected in parallel (see program_impl::compile_graph) are counted concurrently
+    std::atomic<uint64_t> _temp_memory_used;
+    std::atomic<uint64_t> _max_peak_memory_used;
+    uint64_t _pool_memory_used;
+    uint64_t _pool_memory_requested;
 public:
     memory_pool(engine_impl& engine);
 
@@ -134,6 +141,7 @@ public:
 
     uint64_t get_temp_memory_used() const { return _temp_memory_used; };
     uint64_t get_max_peak_device_memory_used() const { return _max_peak_memory_used; };
+    cldnn_memory_statistics get_statistics() const;
     void add_memory_used(size_t value);
     void subtract_memory_used(size_t value);
 };
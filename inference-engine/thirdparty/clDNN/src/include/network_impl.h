@@ -60,7 +60,9 @@ public:
     std::vector<primitive_id> get_executed_primitive_ids() const;
     std::vector<primitive_id> get_all_primitive_ids() const;
     std::vector<primitive_id> get_all_primitive_org_ids() const;
-    void execute(const std::vector<event_impl::ptr>& events);
+    void execute(const std::vector<event_impl::ptr>& events, bool flush = true);
+    //executes the networks one after another, each network waits for the outputs of the previous one and the queues are flushed once after all of them
+    static void execute_sequence(const std::vector<network_impl*>& networks, const std::vector<event_impl::ptr>& events);
 
     // Implementation specific calls
     std::shared_ptr<primitive_inst> get_primitive(const primitive_id& id);
@@ -89,6 +91,7 @@ private:
     std::list<std::shared_ptr<primitive_inst>> _data_outputs;
 
     std::unordered_map<primitive_id, event_impl::ptr> _events;
+    event_impl::ptr _completed_event;
 
     void allocate_primitive_instance(program_node const& node);
 };
@@ -42,7 +42,8 @@ struct program_impl : public refcounted_obj<program_impl>
     friend struct program_node;
 
 public:
-    program_impl(engine_impl& engine_ref, topology_impl const& topology, build_options const& options, bool is_internal);
+    // conv_input_format - the format of the inputs of all convolutions chosen by the network-level tuning, format::any leaves the choice to layout_optimizer
+    program_impl(engine_impl& engine_ref, topology_impl const& topology, build_options const& options, bool is_internal, format::type conv_input_format = format::any);
 
     void dump_memory_pool() const;
 
@@ -99,6 +100,8 @@ private:
     // TODO: Remove once we will get full support for input/output padding in all primitive implementations.
     bool output_size_handling_enabled;
 
+    format::type conv_input_format;
+
     /*
     ** High-level functions, in order of usage
     */
@@ -133,6 +136,7 @@ private:
     */
     void trim_to_outputs();
     void remove_redundant_reorders();
+    void merge_consecutive_reorders();
     void reorder_nodes_for_parallel_execution();
     void reorder_inputs(layout_optimizer& lo);
     void pre_optimize_bias(layout_optimizer& lo);
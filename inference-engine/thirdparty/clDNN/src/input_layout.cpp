@@ -32,6 +32,7 @@ input_layout_inst::typed_primitive_inst(network_impl& network, input_layout_node
     : parent(network, node)
 {
     _has_valid_input = false; //by default input for 'input_layout' is invalid as long as user doesn't call set_data
+    _device_memory = _output;
 }
 
 void input_layout_inst::set_data(memory_impl& mem)
@@ -39,7 +40,14 @@ void input_layout_inst::set_data(memory_impl& mem)
 
     CLDNN_ERROR_LAYOUT_MISMATCH("input layout", "memory layout", mem.get_layout(), "output memory layout", node.get_output_layout(), "");
 
-    if (mem.is_allocated_by(get_network().get_engine()))
+    auto& engine = get_network().get_engine();
+    if (mem.is_staging() && mem.is_allocated_by(engine) && _device_memory != nullptr && !_device_memory->is_staging())
+    {
+        // the pinned memory is written to the device by the non-blocking transfer ordered before the primitives
+        engine.upload_memory(mem, *_device_memory);
+        _output = _device_memory;
+    }
+    else if (mem.is_allocated_by(engine))
     {
         _output = &mem;
     }
@@ -32,34 +32,66 @@
 using namespace cldnn;
 
 namespace {
-    bool should_use_winograd_2x3_s1(std::shared_ptr<const convolution> const& prim, layout const& input_layout, layout const& weights_layout, bool output_size_handling_enabled)
+    // The cost model of the fused winograd kernels (convolution_gpu_winograd_6x3_s1_fused, 2x3_s1_fused) in the MACs per
+    // output pixel. F(6,3) gives 6 outputs of a row by 8 multiplications instead of 18, the kernels reach about a half
+    // of the efficiency of the direct ones, and the input and output tiles are transformed for every pixel. The weights
+    // are transformed by the weights reorder once at the build, the constants propagation keeps them with the other
+    // reordered weights, so they cost nothing at the execution.
+    constexpr float winograd_saved_macs_ratio = (10.f / 18.f) * 0.5f;
+    constexpr float winograd_transform_cost = 16.f;  // per input and output feature
+    constexpr float winograd_reorder_cost = 48.f;    // per feature of the input reordered to byxf and of the output reordered back
+
+    //reorders_needed: the neighbours of the convolution are not in byxf, the winograd pays for the reorders as well
+    bool should_use_winograd_2x3_s1(std::shared_ptr<const convolution> const& prim, layout const& input_layout, layout const& weights_layout, bool output_size_handling_enabled, bool reorders_needed = false)
     {
         //cases when NOT to use winograd
-        if (input_layout.size.feature[0] % 64 != 0       //current algorithm is effective for ifm to be multiply of 64
+        if (input_layout.size.feature[0] % 32 != 0       //the kernels support ifm multiply of 32
             || weights_layout.size.spatial[0] != 3          //weights have to be 3x3 by definiton
             || weights_layout.size.spatial[1] != 3          //weights have to be 3x3 by definition
-            || weights_layout.size.batch[0] % 64 != 0       //current algorithm is effective for ofm to be multiply of 64
+            || weights_layout.size.batch[0] % 32 != 0       //the kernels support ofm multiply of 32
             || prim->stride != tensor{ 1 }                  //stride has to be 1x1 by definition
             || prim->dilation != tensor{ 1 }                //no support for dilation
             || prim->split() != 1                           //no support for splitted convolutions
             || (output_size_handling_enabled && prim->with_output_size) //no support for convolutions with user-specified output size
             || (input_layout.count() > 3000000)             //limit max input size as winograd consumes more memory
             || (input_layout.count() < 50000)               //limit min input size as winograd is not effective for small input
-            || (input_layout.size.spatial[0] < 8 && input_layout.size.spatial[0] < 8)) //disable winograd for small spatials as perf is poor
+            || (input_layout.size.spatial[0] < 8 || input_layout.size.spatial[1] < 8)) //disable winograd for small spatials as perf is poor
         {
             return false;
         }
 
-        return true;
+        //the convolution has enough channels when the saved MACs outweigh the transforms (and the reorders)
+        const float ifm = static_cast<float>(input_layout.size.feature[0]);
+        const float ofm = static_cast<float>(weights_layout.size.batch[0]);
+        const float saved = ifm * ofm * 9.f * winograd_saved_macs_ratio;
+        const float overhead = (ifm + ofm) * (winograd_transform_cost + (reorders_needed ? winograd_reorder_cost : 0.f));
+        return saved >= overhead;
     }
 }
 
-layout_optimizer::layout_optimizer(bool output_size_handling_enabled)
+layout_optimizer::layout_optimizer(bool output_size_handling_enabled, format::type conv_input_format)
     : _optimization_attributes()
     , _output_size_handling_enabled(output_size_handling_enabled)
+    , _conv_input_format(conv_input_format)
 {
 }
 
+bool layout_optimizer::is_conv_input_format_supported(format::type fmt, data_types dt)
+{
+    switch (fmt)
+    {
+    case format::bfyx:
+    case format::yxfb:
+        return dt == data_types::f32 || dt == data_types::f16;
+    case format::byxf:
+        return dt == data_types::f16;
+    case format::byxf_af32:
+        return dt == data_types::i8;
+    default:
+        return false;
+    }
+}
+
 bool layout_optimizer::convolution_bfyx_opt(layout const& output_layout, const layout& weights_layout, std::shared_ptr<const convolution> conv)
 {
     //A set of rules that define when bfyx mem format has better performance than yxfb
@@ -190,9 +222,20 @@ layout layout_optimizer::get_expected_layout(layout const& current_layout, data_
 
     case data_type::input: //convolution input
 
-        if (current_layout.data_type == data_types::f16 &&
-            layout_optimizer::convolution_byxf_opt(current_layout, output_or_weights_layout, prim) &&
-            (users_for_convolution_byxf_opt(node, 2) || deps_depth_in_same_format(node, cldnn::format::byxf, 2)) &&
+        //the format chosen by the network-level tuning, unless the convolution is restricted to bfyx
+        if (_conv_input_format != format::any &&
+            is_conv_input_format_supported(_conv_input_format, current_layout.data_type) &&
+            !(_output_size_handling_enabled && prim->with_output_size) &&
+            !node.get_transposed())
+        {
+            expected_tensor = current_layout.size;
+            expected_format = _conv_input_format;
+        }
+        else if (current_layout.data_type == data_types::f16 &&
+            ((layout_optimizer::convolution_byxf_opt(current_layout, output_or_weights_layout, prim) &&
+              (users_for_convolution_byxf_opt(node, 2) || deps_depth_in_same_format(node, cldnn::format::byxf, 2))) ||
+             //the winograd of the convolution with enough channels is worth the reorders to byxf and back
+             should_use_winograd_2x3_s1(prim, current_layout, output_or_weights_layout, _output_size_handling_enabled, true)) &&
             //TODO: remove this condition when yxfb optimizations will be disabled
             current_layout.format != cldnn::format::yxfb &&
             current_layout.size.batch[0] == 1 &&
@@ -0,0 +1,226 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "layout_tuner.h"
+#include "layout_optimizer.h"
+#include "network_impl.h"
+#include "kernel_selector_helper.h"
+#include "kernel_selector.h"
+
+#include "api/CPP/convolution.hpp"
+#include "api/CPP/data.hpp"
+#include "api/CPP/input_layout.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <set>
+#include <sstream>
+#include <typeinfo>
+
+namespace cldnn
+{
+namespace
+{
+    //the names of the plans in the tuning file, format::any is the per-convolution choice of layout_optimizer
+    const std::vector<std::pair<format::type, std::string>> plan_names
+    {
+        { format::any, "layout_optimizer" },
+        { format::bfyx, "bfyx" },
+        { format::yxfb, "yxfb" },
+        { format::byxf, "byxf" },
+        { format::byxf_af32, "byxf_af32" },
+    };
+
+    std::string get_plan_name(format::type plan)
+    {
+        for (auto& name : plan_names)
+        {
+            if (name.first == plan)
+                return name.second;
+        }
+        return plan_names.front().second;
+    }
+
+    format::type get_plan(const std::string& plan_name)
+    {
+        for (auto& name : plan_names)
+        {
+            if (name.second == plan_name)
+                return name.first;
+        }
+        //the plan of another version, the layouts are chosen by layout_optimizer
+        return format::any;
+    }
+
+    std::string to_string(const layout& l)
+    {
+        std::stringstream ss;
+        ss << static_cast<int>(l.data_type) << ":" << static_cast<int>(l.format.value) << ":" << l.size.to_string();
+        return ss.str();
+    }
+
+    const uint32_t measured_executions = 5;
+}
+
+layout_tuner::layout_tuner(engine_impl& engine, const topology_impl& topology, const build_options& options)
+    : _engine(engine), _topology(topology), _options(options)
+{
+}
+
+refcounted_obj_ptr<program_impl> layout_tuner::build_program()
+{
+    const auto& config = _options.get<build_option_type::tuning_config>()->config;
+    const auto candidates = get_candidate_plans();
+    if (config.mode == tuning_mode::tuning_disabled || candidates.size() == 1)
+        return build_program(format::any);
+
+    const auto engine_info = _engine.get_engine_info();
+    const auto host_version = to_host_version(cldnn::get_version());
+    const auto key = get_network_key();
+
+    auto& auto_tuner = kernel_selector::kernel_selector_base::GetAutoTuner();
+    const auto cached_plan = auto_tuner.LoadKernelOnline(to_tuning_mode(config.mode), config.cache_file_path, engine_info.dev_id, engine_info.driver_version, host_version, key);
+    if (!std::get<0>(cached_plan).empty())
+        return build_program(get_plan(std::get<0>(cached_plan)));
+
+    if (config.mode != tuning_mode::tuning_tune_network_and_cache)
+        return build_program(format::any);
+
+    refcounted_obj_ptr<program_impl> best_program;
+    auto best_plan = format::any;
+    auto best_time = std::numeric_limits<uint64_t>::max();
+    for (auto plan : candidates)
+    {
+        refcounted_obj_ptr<program_impl> program;
+        uint64_t time = 0;
+        try
+        {
+            program = build_program(plan);
+            time = measure_program(*program);
+        }
+        catch (std::exception&)
+        {
+            //the plan of layout_optimizer is the one built without the tuning, so its errors are reported
+            if (plan == format::any)
+                throw;
+            //some of the primitives have no implementation for the layouts of the plan
+            continue;
+        }
+
+        if (time < best_time)
+        {
+            best_program = program;
+            best_plan = plan;
+            best_time = time;
+        }
+    }
+
+    //the time of the plan is stored in place of the tuning index, it is not used when the plan is loaded
+    const auto stored_time = std::min<uint64_t>(best_time, static_cast<uint64_t>(std::numeric_limits<int>::max()));
+    auto_tuner.StoreKernel(config.cache_file_path, key, get_plan_name(best_plan), static_cast<int>(stored_time));
+    return best_program;
+}
+
+std::string layout_tuner::get_network_key() const
+{
+    //the key is built of the primitives, their dependencies and the layouts given by the user, so it doesn't depend on the plan
+    std::stringstream ss;
+    for (auto& p : _topology.get_primitives())
+    {
+        const auto& prim = *p.second;
+        ss << p.first << " " << typeid(prim).name();
+        for (auto& dep : prim.dependencies())
+            ss << " " << dep;
+
+        if (prim.type == input_layout::type_id())
+            ss << " " << to_string(static_cast<const input_layout&>(prim).layout);
+        else if (prim.type == data::type_id())
+            ss << " " << to_string(static_cast<const data&>(prim).mem.get_layout());
+        ss << ";";
+    }
+    return "network_" + std::to_string(std::hash<std::string>{}(ss.str()));
+}
+
+std::vector<format::type> layout_tuner::get_candidate_plans() const
+{
+    std::set<data_types> data_types;
+    bool has_convolution = false;
+    for (auto& p : _topology.get_primitives())
+    {
+        auto& prim = *p.second;
+        if (prim.type == convolution::type_id())
+            has_convolution = true;
+        else if (prim.type == input_layout::type_id())
+            data_types.insert(static_cast<const input_layout&>(prim).layout.data_type);
+        else if (prim.type == data::type_id())
+            data_types.insert(static_cast<const data&>(prim).mem.get_layout().data_type);
+    }
+
+    std::vector<format::type> candidates = { format::any };
+    if (!has_convolution)
+        return candidates;
+
+    for (auto& name : plan_names)
+    {
+        if (name.first == format::any)
+            continue;
+        if (std::any_of(data_types.begin(), data_types.end(), [&](cldnn::data_types dt) { return layout_optimizer::is_conv_input_format_supported(name.first, dt); }))
+            candidates.push_back(name.first);
+    }
+    return candidates;
+}
+
+refcounted_obj_ptr<program_impl> layout_tuner::build_program(format::type conv_input_format) const
+{
+    return{ new program_impl(_engine, _topology, _options, false, conv_input_format), false };
+}
+
+uint64_t layout_tuner::measure_program(const program_impl& program) const
+{
+    auto network = _engine.allocate_network(program);
+    for (auto& p : _topology.get_primitives())
+    {
+        if (p.second->type == input_layout::type_id())
+        {
+            auto input = _engine.allocate_memory(static_cast<const input_layout&>(*p.second).layout);
+            network->set_input_data(p.first, *input);
+        }
+    }
+
+    const auto execute = [&network]()
+    {
+        network->execute({});
+        for (auto& output : network->get_output_ids())
+            network->get_primitive_event(output)->wait();
+    };
+
+    //the first execution includes the allocation and the transfers of the kernels
+    execute();
+
+    auto best = std::numeric_limits<uint64_t>::max();
+    for (uint32_t i = 0; i < measured_executions; i++)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        execute();
+        const auto end = std::chrono::high_resolution_clock::now();
+        best = std::min(best, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+    }
+    return best;
+}
+
+}
@@ -70,6 +70,24 @@ namespace cldnn
         }
     }
 
+    memory_impl::ptr memory_pool::alloc_pool_memory(const layout& layout)
+    {
+        if (exceeds_limit(layout))
+        {
+            throw error("exceeded the memory pool limit", CLDNN_OUT_OF_RESOURCES);
+        }
+
+        auto mem = alloc_memory(layout);
+        _pool_memory_used += layout.bytes_count();
+        return mem;
+    }
+
+    bool memory_pool::exceeds_limit(const layout& layout) const
+    {
+        const auto limit = _engine->configuration().memory_pool_limit;
+        return limit != 0 && _pool_memory_used + layout.bytes_count() > limit;
+    }
+
     bool memory_pool::has_conflict(const memory_set& a, const std::set<primitive_id>& b, uint32_t b_network_id)
     {   
         std::set<primitive_id> a_same_network;
@@ -100,8 +118,15 @@ namespace cldnn
             else
                 ++it;
         }
+        // near the limit the padded buffers are reused as well
+        if (exceeds_limit(layout))
+        {
+            auto padded_mem = take_from_padded_pool(layout, id, network_id, restrictions);
+            if (padded_mem)
+                return padded_mem;
+        }
         // didn't find anything for you? create new resource
-        auto mem = alloc_memory(layout);
+        auto mem = alloc_pool_memory(layout);
         {
             _non_padded_pool.emplace(layout.bytes_count(), memory_record({ {id, network_id } }, mem, network_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
@@ -127,11 +152,11 @@ namespace cldnn
                     return ret_mem;
                 }
             }
-            auto mem = alloc_memory(layout);
+            auto mem = alloc_pool_memory(layout);
             first_level_cache->second.emplace_back(memory_record({ { id, network_id } }, mem, network_id));
             return mem;            
         }
-        auto mem = alloc_memory(layout);
+        auto mem = alloc_pool_memory(layout);
         std::list<memory_record> list = { memory_record({ { id, network_id } },mem, network_id) };
         _padded_pool.emplace(layout, std::move(list));
         return mem;
@@ -157,7 +182,7 @@ namespace cldnn
             }
             ++it;
         }
-        auto mem = alloc_memory(layout);
+        auto mem = alloc_pool_memory(layout);
         {
             _no_reusable_pool.emplace(layout.bytes_count(), memory_record({ { id, network_id } }, mem, network_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
@@ -166,6 +191,42 @@ namespace cldnn
         return mem;
     }
 
+    /*
+        The padded buffers are reused only by the buffers of the same padding, since the kernels expect the zeros in the padding.
+        The record which fits is moved to the non-padded pool, so its padding is not relied on by the padded buffers any more.
+    */
+    memory_impl::ptr memory_pool::take_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions)
+    {
+        auto best_list = _padded_pool.end();
+        std::list<memory_record>::iterator best_record;
+        for (auto list = _padded_pool.begin(); list != _padded_pool.end(); ++list)
+        {
+            for (auto record = list->second.begin(); record != list->second.end(); ++record)
+            {
+                if (record->_memory->size() < layout.bytes_count() ||
+                    has_conflict(record->_users, restrictions, network_id))
+                    continue;
+                // the smallest record which fits leaves the larger ones for the next buffers
+                if (best_list == _padded_pool.end() || record->_memory->size() < best_record->_memory->size())
+                {
+                    best_list = list;
+                    best_record = record;
+                }
+            }
+        }
+
+        if (best_list == _padded_pool.end())
+            return{};
+
+        best_record->_users.insert(memory_user(id, network_id));
+        auto ret_mem = _engine->reinterpret_buffer(*best_record->_memory, layout);
+        _non_padded_pool.emplace(best_record->_memory->size(), std::move(*best_record));
+        best_list->second.erase(best_record);
+        if (best_list->second.empty())
+            _padded_pool.erase(best_list);
+        return ret_mem;
+    }
+
     memory_impl::ptr memory_pool::get_memory(const layout& layout)
     {
         return alloc_memory(layout);
@@ -177,10 +238,12 @@ namespace cldnn
         {
             if (!layout.format.is_image() && layout.data_padding == padding{ { 0,0,0,0 }, 0 }) // non-padded buffers
             {
+                _pool_memory_requested += layout.bytes_count();
                 return get_from_non_padded_pool(layout, id, network_id, restrictions);
             }
             else if (!layout.format.is_image()) // padded buffers
             {
+                _pool_memory_requested += layout.bytes_count();
                 return get_from_padded_pool(layout, id, network_id, restrictions);
             }
             else  // images
@@ -191,12 +254,15 @@ namespace cldnn
         }
         else
         {
+            _pool_memory_requested += layout.bytes_count();
             return get_from_across_networks_pool(layout, id, network_id);
         }
     }
 
     void memory_pool::clear_pool()
     {
+        for (const auto& record : _non_padded_pool)
+            _pool_memory_used -= record.first;
         _non_padded_pool.clear();
     }
 
@@ -204,6 +270,8 @@ namespace cldnn
         : _engine(&engine)
         , _temp_memory_used(0)
         , _max_peak_memory_used(0)
+        , _pool_memory_used(0)
+        , _pool_memory_requested(0)
     {
         _engine->release(); // since engine is refcount object and there is circular dependency until context will be moved to memory pool we need 
                             // to detach engine while destroying memory pool
@@ -269,12 +337,23 @@ namespace cldnn
         }
     }
 
+    cldnn_memory_statistics memory_pool::get_statistics() const
+    {
+        return{
+            _temp_memory_used,
+            _max_peak_memory_used,
+            _pool_memory_used,
+            _pool_memory_requested,
+            _engine->configuration().memory_pool_limit
+        };
+    }
+
     void memory_pool::add_memory_used(size_t value)
     {
-        _temp_memory_used += value;
-        if (_temp_memory_used > _max_peak_memory_used)
+        const uint64_t used = _temp_memory_used += value;
+        uint64_t peak = _max_peak_memory_used;
+        while (used > peak && !_max_peak_memory_used.compare_exchange_weak(peak, used))
         {
-            _max_peak_memory_used = _temp_memory_used;
         }
     }
 
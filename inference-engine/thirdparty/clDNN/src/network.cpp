@@ -48,6 +48,10 @@ network_impl::network_impl(const program_impl& program, bool is_internal)
     build_insts_deps();
     build_exec_order();
 
+    // the events of the primitives which are not run are complete from the start, so they share the event created once
+    _completed_event = get_engine().create_user_event(true);
+    _events.reserve(_primitives.size());
+
     _program->dump_memory_pool();
 }
 
@@ -71,6 +75,10 @@ void network_impl::reset_execution(bool wait)
         }
 
         get_engine().wait_for_events(events);
+        // only the kernels awaited outside of the queue have the events, the in-order queue runs the others in the order
+        // they're enqueued, so the queue is finished to wait for the kernels enqueued after the last event
+        if (!get_engine().is_out_of_order_queue())
+            get_engine().get_context()->queue().finish();
     }
     _events.clear();
 }
@@ -169,7 +177,7 @@ void network_impl::build_insts_deps()
     }
 }
 
-void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& events)
+void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& events, bool flush)
 {
     //Wait for previous execution completion
     reset_execution(false);
@@ -181,7 +189,7 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
 
     for (auto& dout : _data_outputs) //data primitives are not executed so if they are marked as output we need to add them valid events manually
     {
-        _events[dout->id()] = get_engine().create_user_event(true);
+        _events[dout->id()] = _completed_event;
     }
 
     for (auto& prim : _primitives)
@@ -192,7 +200,33 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
     // Using output of previouse network as input to another one may cause hazard (in OOOQ mode) if user would not 
     // provide proper event to execution. Flushing pipeline should prevent this kind of issues. 
     // In scenarios with a big number of very small networks it can provide performance drop.
-    get_engine().flush_network();
+    if (flush)
+        get_engine().flush_network();
+}
+
+void network_impl::execute_sequence(const std::vector<network_impl*>& networks, const std::vector<event_impl::ptr>& events)
+{
+    //each network waits for the outputs of the previous one, so the hazard the flush of execute() prevents can't occur and
+    //the networks of one engine are submitted back to back. The queue is flushed when the next network runs on another
+    //engine, as the commands of the events awaited by other queues have to be submitted to the device
+    engine_impl* previous_engine = nullptr;
+    std::vector<event_impl::ptr> dependencies = events;
+    for (auto network : networks)
+    {
+        auto& engine = network->get_engine();
+        if (previous_engine && previous_engine != &engine)
+            previous_engine->flush_network();
+        previous_engine = &engine;
+
+        network->execute(dependencies, false);
+
+        dependencies = events;
+        for (auto& output : network->_outputs)
+            dependencies.push_back(network->get_primitive_event(output->id()));
+    }
+
+    if (previous_engine)
+        previous_engine->flush_network();
 }
 
 std::vector<primitive_id> network_impl::get_output_ids() const
@@ -269,7 +303,7 @@ refcounted_obj_ptr<event_impl> network_impl::execute_primitive(const std::shared
     if (!get_engine().get_context()->enabled_single_kernel() || get_engine().get_context()->single_kernel_name() == id)
         ev = primitive->execute(events);
     else
-        ev = get_engine().create_user_event(true);
+        ev = _completed_event;
 
     _events.insert({ id, ev });
     return ev;
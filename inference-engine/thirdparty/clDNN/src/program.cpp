@@ -63,6 +63,8 @@
 
 #include "network_impl.h"
 #include "kernel_selector_helper.h"
+#include "auto_tuner.h"
+#include "kernel_base.h"
 #include "sliding_window_utils.h"
 #include "error_handler.h"
 
@@ -72,6 +74,9 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <chrono>
+#include <atomic>
+#include <thread>
 
 namespace cldnn
 {
@@ -253,25 +258,57 @@ namespace {
     }
 }
 
-program_impl::program_impl(engine_impl& engine_ref, topology_impl const& topology, build_options const& options, bool is_internal)
-    : engine(&engine_ref), options(options), output_size_handling_enabled(true)
+program_impl::program_impl(engine_impl& engine_ref, topology_impl const& topology, build_options const& options, bool is_internal, format::type conv_input_format)
+    : engine(&engine_ref), options(options), output_size_handling_enabled(true), conv_input_format(conv_input_format)
 {
     static std::atomic<uint32_t> id_gen{ 0 };
     prog_id = ++id_gen;
     assert(prog_id != 0);
 
-    if ((options.get<build_option_type::tuning_config>()->config.mode == tuning_mode::tuning_tune_and_cache) &&
+    const auto mode = options.get<build_option_type::tuning_config>()->config.mode;
+    if ((mode == tuning_mode::tuning_tune_and_cache || mode == tuning_mode::tuning_tune_network_and_cache) &&
         !engine->configuration().enable_profiling)
     {
         throw std::invalid_argument("Engine must be created with profiling enabled in tune_and_cache mode!");
     }
 
+    // the kernels are selected on this thread, the internal programs are counted by the program which builds them
+    const auto tuning_statistics_before = kernel_selector::AutoTuner::GetStatistics();
+
+    using clock = std::chrono::steady_clock;
+    auto microseconds = [](clock::duration duration)
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+    };
+    const auto build_begin = clock::now();
     init_graph(topology);
     pre_optimize_graph();
+    const auto selection_begin = clock::now();
     compile_graph();
+    const auto selection_end = clock::now();
     post_optimize_graph();
+    const auto compilation_begin = clock::now();
+
+    const auto& tuning_statistics_after = kernel_selector::AutoTuner::GetStatistics();
+    if (!is_internal)
+    {
+        engine->add_tuning_statistics({
+            tuning_statistics_after.onlineCacheHits - tuning_statistics_before.onlineCacheHits,
+            tuning_statistics_after.offlineCacheHits - tuning_statistics_before.offlineCacheHits,
+            tuning_statistics_after.cacheMisses - tuning_statistics_before.cacheMisses });
+    }
 
     engine->compile_program(*this);
+
+    if (!is_internal)
+    {
+        engine->add_build_statistics({
+            1,
+            microseconds((selection_begin - build_begin) + (compilation_begin - selection_end)),
+            microseconds(selection_end - selection_begin),
+            (tuning_statistics_after.lookupTime - tuning_statistics_before.lookupTime) / 1000,
+            microseconds(clock::now() - compilation_begin) });
+    }
     this->dump_program("13_finished", true);
 
     //Makes serialization with given name.
@@ -420,9 +457,8 @@ void program_impl::pre_optimize_graph()
 {
     trim_to_outputs(); dump_program("3_trimmed", true);
 
-    // TODO: uncomment as soon as IE will enable OOOQ by default
-    //if (get_engine().configuration().enable_parallelisation)
-    reorder_nodes_for_parallel_execution();
+    if (get_engine().configuration().enable_parallelisation)
+        reorder_nodes_for_parallel_execution();
 
     analyze_output_size_handling_need();
 
@@ -434,7 +470,7 @@ void program_impl::pre_optimize_graph()
 
     if (options.get<build_option_type::optimize_data>()->enabled())
     {
-        layout_optimizer lo(output_size_handling_enabled);
+        layout_optimizer lo(output_size_handling_enabled, conv_input_format);
         reorder_inputs(lo);
         // this code should move to post compilation after kernel selector will support handling reorder bias
         pre_optimize_bias(lo);
@@ -442,6 +478,8 @@ void program_impl::pre_optimize_graph()
     }
 
     handle_reshape();
+    if (options.get<build_option_type::optimize_data>()->enabled())
+        merge_consecutive_reorders();
     remove_redundant_reorders(); dump_program("5_removed_redundant_reorders", true);
     prepare_padding();
     prepare_depthwise_sep_opt();
@@ -460,16 +498,77 @@ void program_impl::pre_optimize_graph()
 
 void program_impl::compile_graph()
 {
+    // the layouts are computed on this thread, the selection of a node reads the layouts of its dependencies only
+    std::vector<program_node*> nodes;
     for (auto& node : processing_order)
     {
         if (!node->is_type<internal_primitive>() && !node->is_type<data>())
         {
             node->get_output_layout();
-            if (!node->is_type<data>() && !(node->is_type<mutable_data>() && node->get_dependencies().empty()))
-                node->selected_impl = node->type()->choose_impl(*engine, *node);
+            if (!(node->is_type<mutable_data>() && node->get_dependencies().empty()))
+                nodes.push_back(node);
         }
     }
 
+    // The kernels of the nodes are selected and their sources are generated in parallel. Every node takes the IDs of
+    // its kernels from its own block, so the entry points and the sources don't depend on the order of the threads.
+    // The kernels tuned on-line are timed on the device, they are selected one by one.
+    const auto mode = options.get<build_option_type::tuning_config>()->config.mode;
+    const bool tuned_online = mode == tuning_mode::tuning_tune_and_cache || mode == tuning_mode::tuning_tune_network_and_cache;
+    const size_t threads_count = tuned_online ? 1 : std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), nodes.size());
+    const size_t first_id = kernel_selector::UniqueIDBlock::Reserve(nodes.size());
+
+    std::vector<std::exception_ptr> errors(nodes.size());
+    std::atomic<size_t> next_node{ 0 };
+    std::atomic<bool> failed{ false };
+    auto select_nodes = [&]()
+    {
+        // the nodes are taken in the order, so the nodes before the failed one are selected all
+        for (size_t i = next_node++; i < nodes.size() && !failed; i = next_node++)
+        {
+            kernel_selector::UniqueIDBlock ids(first_id + i * kernel_selector::UniqueIDBlock::size);
+            try
+            {
+                nodes[i]->selected_impl = nodes[i]->type()->choose_impl(*engine, *nodes[i]);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    // the tuning statistics are counted per thread, the ones of the workers are added to the statistics of this thread
+    std::vector<kernel_selector::tuning_statistics> workers_statistics(threads_count);
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads_count; t++)
+    {
+        workers.emplace_back([&, t]()
+        {
+            select_nodes();
+            workers_statistics[t] = kernel_selector::AutoTuner::GetStatistics();
+        });
+    }
+    select_nodes();
+    for (auto& worker : workers)
+        worker.join();
+
+    auto& statistics = kernel_selector::AutoTuner::GetStatistics();
+    for (size_t t = 1; t < threads_count; t++)
+    {
+        statistics.onlineCacheHits += workers_statistics[t].onlineCacheHits;
+        statistics.offlineCacheHits += workers_statistics[t].offlineCacheHits;
+        statistics.cacheMisses += workers_statistics[t].cacheMisses;
+        statistics.lookupTime += workers_statistics[t].lookupTime;
+    }
+
+    for (auto& error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
     dump_program("8_compiled", true);
 }
 
@@ -1512,7 +1611,9 @@ void program_impl::prepare_memory_dependencies()
 
     basic_memory_dependencies();
     skipped_branch_memory_dependencies();
-    oooq_memory_dependencies();
+    // the primitives of the in-order queue never run concurrently, so they don't restrict the memory reuse of each other
+    if (get_engine().is_out_of_order_queue())
+        oooq_memory_dependencies();
 }
 
 std::string program_impl::get_memory_dependencies_string() const
@@ -1600,6 +1701,52 @@ void program_impl::remove_redundant_reorders()
     }
 }
 
+//the reorder without mean which is the only user of another reorder is merged into it, so e.g. the conversion of the
+//output precision after the reorder of the output layout, or the reorder of the input layout after the mean subtraction
+//of the input, take a single pass
+void program_impl::merge_consecutive_reorders()
+{
+    auto itr = processing_order.begin(); //note we need to use iterators since currently processed element can be removed
+    while (itr != processing_order.end())
+    {
+        auto& node = (*itr++); //post-inc to avoid invalidation due to possible erase
+        if (!node->is_type<reorder>())
+            continue;
+
+        auto& r_node = node->as<reorder>();
+        auto r_prim = r_node.typed_desc();
+        if (r_node.has_mean() || !r_prim->subtract_per_feature.empty() || r_prim->output_padding ||
+            !r_node.get_dependency(0).is_type<reorder>())
+            continue;
+
+        auto& prev_node = r_node.get_dependency(0).as<reorder>();
+        auto prev_prim = prev_node.typed_desc();
+        if (prev_node.get_users().size() != 1 || prev_node.is_output() || prev_prim->output_padding ||
+            prev_node.get_output_layout().data_padding)
+            continue;
+
+        //the data are not rounded to the intermediate data type of lower precision
+        auto input_layout = prev_node.input().get_output_layout();
+        if (prev_prim->output_data_type != input_layout.data_type && prev_prim->output_data_type != r_prim->output_data_type)
+            continue;
+
+        //the special layouts are produced by their own kernels
+        auto input_format = input_layout.format;
+        if (input_format.is_winograd() || input_format.is_image() ||
+            prev_prim->output_format.is_winograd() || prev_prim->output_format.is_image() ||
+            r_prim->output_format.is_winograd() || r_prim->output_format.is_image() ||
+            input_format == format::bf8_xy16 || r_prim->output_format == format::bf8_xy16)
+            continue;
+
+        if (!extract_and_remove(r_node))
+            continue;
+
+        prev_prim->output_format = r_prim->output_format;
+        prev_prim->output_data_type = r_prim->output_data_type;
+        prev_node.recalc_output_layout();
+    }
+}
+
 void program_impl::reorder_nodes_for_parallel_execution()
 {
     if (processing_order.empty())
@@ -2633,13 +2780,16 @@ void program_impl::prepare_buffer_fusing()
                     break;
                 }
             }
-            auto same_data_type = input.get_output_layout().data_type == output_layout.data_type;
+            //the kernels of pooling and eltwise write the output in another data type, so the conversion of the precision
+            //is fused into them if the layer has no other users
+            auto output_data_type_supported = input.get_output_layout().data_type == output_layout.data_type ||
+                (input.get_users().size() == 1 && !input.is_output() && (input.is_type<pooling>() || input.is_type<eltwise>()));
             //Optimization only available in case of layers that support different input and output formats.
             //todo: new api needs to be created to read such caps
-            if (!(input.is_type<pooling>() && (output_layout.format == format::bfyx || output_layout.format == format::yxfb || output_layout.format == format::byxf) && all_users_same_format && same_data_type) &&
+            if (!(input.is_type<pooling>() && (output_layout.format == format::bfyx || output_layout.format == format::yxfb || output_layout.format == format::byxf) && all_users_same_format && output_data_type_supported) &&
                 !remove_bf8_xy_opt &&
                 !(input.is_type<convolution>() && input.get_output_layout().format == format::bf8_xy16) &&
-                !(input.is_type<eltwise>() && (output_layout.format == format::bfyx || output_layout.format == format::yxfb || output_layout.format == format::byxf) && all_users_same_format && same_data_type) &&
+                !(input.is_type<eltwise>() && (output_layout.format == format::bfyx || output_layout.format == format::yxfb || output_layout.format == format::byxf) && all_users_same_format && output_data_type_supported) &&
                 !(remove_byxf_opt && (node.get_users().front()->is_type<eltwise>() || node.get_users().front()->is_type<pooling>())))
                 return;
 
@@ -2752,6 +2902,93 @@ void program_impl::prepare_primitive_fusing()
             extract_and_remove(node);
         });
     }
+
+    //Third loop fuses the eltwise sums into the convolutions which compute one of their inputs
+    itr = processing_order.begin();
+    while (itr != processing_order.end())
+    {
+        auto node_itr = itr++;
+        auto& node = (*node_itr);
+
+        do_for_types<eltwise>(*node, [this, is_debug](eltwise_node& node)
+        {
+            auto prim = node.get_primitive();
+
+            //Restrictions:
+            // - plain sum of two inputs
+            // - inputs cannot be padded
+            // - the activation of the eltwise can be moved to the convolution
+            if (prim->mode != eltwise_mode::sum || node.get_dependencies().size() != 2 || !prim->coefficients.empty() ||
+                !prim->output_calibration_factors.empty() || prim->output_quantization_factor != 1.0f ||
+                node.has_padded_dependency() || (prim->with_activation && node.get_fused_activation_func() != activation_none))
+                return;
+
+            //the convolution is the first of the inputs which can take the sum
+            program_node* conv_input = nullptr;
+            for (size_t i = 0; i < 2 && !conv_input; i++)
+            {
+                auto& input = node.get_dependency(i);
+                auto& other = node.get_dependency(1 - i);
+                if (!input.is_type<convolution>() || &input == &other)
+                    continue;
+
+                auto& conv = input.as<convolution>();
+                auto conv_prim = conv.get_primitive();
+                const auto& conv_layout = conv.get_output_layout();
+                const auto& other_layout = other.get_output_layout();
+                const auto& node_layout = node.get_output_layout();
+                const auto& weights_size = conv.weights(0).get_output_layout().size;
+
+                // - primitives input cannot be output
+                // - no activation in the convolution, the activation is applied after the sum
+                // - the layouts and the parameters the fused kernel supports
+                if (conv.get_users().size() != 1 || (conv.is_output() && !is_debug) ||
+                    conv.get_fused_activation_func() != activation_none || conv_prim->with_activation ||
+                    conv.get_split() != 1 || conv.get_depthwise_sep_opt() || conv.get_transposed() ||
+                    conv.weights_quantization_term() || conv_prim->with_output_size || conv.is_constant())
+                    continue;
+
+                if ((conv_layout.data_type != data_types::f32 && conv_layout.data_type != data_types::f16) ||
+                    conv_layout.format != format::bfyx ||
+                    other_layout.data_type != conv_layout.data_type || other_layout.format != conv_layout.format || other_layout.size != conv_layout.size ||
+                    node_layout.data_type != conv_layout.data_type || node_layout.format != conv_layout.format || node_layout.size != conv_layout.size)
+                    continue;
+
+                if (weights_size.spatial[0] != 1 || weights_size.spatial[1] != 1 ||
+                    conv_prim->stride.spatial[0] != 1 || conv_prim->stride.spatial[1] != 1 ||
+                    conv_prim->input_offset != tensor(0) ||
+                    conv_prim->dilation.spatial[0] != 1 || conv_prim->dilation.spatial[1] != 1 ||
+                    !get_engine().get_context()->extension_supported("cl_intel_subgroups"))
+                    continue;
+
+                conv_input = &input;
+            }
+
+            if (!conv_input)
+                return;
+
+            auto& conv = conv_input->as<convolution>();
+            auto& other = (&node.get_dependency(0) == conv_input) ? node.get_dependency(1) : node.get_dependency(0);
+
+            //the other input of the sum becomes the last dependency of the convolution
+            remove_connection(other, node);
+            add_connection(other, conv);
+            conv.set_fused_eltwise(true);
+
+            if (node.get_fused_activation_func() != activation_none)
+                conv.set_fused_activation(node.get_fused_activation_func(), node.get_fused_activation_params());
+            else if (prim->with_activation)
+                conv.set_fused_activation(activation_relu_negative_slope, { prim->activation_negative_slope, 0.0f });
+            conv.set_output_padding(node.get_output_layout().data_padding);
+
+            //the convolution reads the other input, so it is executed where the sum was
+            processing_order.erase(conv.processing_itr);
+            conv.processing_itr = processing_order.insert(node.processing_itr, &conv);
+            conv.processing_num = node.processing_num;
+
+            extract_and_remove(node);
+        });
+    }
 }
 
 program_node& program_impl::get_or_create(std::shared_ptr<primitive> prim)
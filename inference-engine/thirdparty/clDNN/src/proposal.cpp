@@ -101,10 +101,18 @@ std::string proposal_inst::to_string(proposal_node const& node)
 
 proposal_inst::typed_primitive_inst(network_impl& network, proposal_node const& node)
     :parent(network, node)
+    , _anchors(generate_anchors(node))
+{
+}
+
+std::vector<proposal_inst::anchor> proposal_inst::generate_anchors(proposal_node const& node)
 {
 //    std::vector<float> default_ratios = { 0.5f, 1.0f, 2.0f };
     int default_size = 16;
-    generate_anchors(default_size, argument.ratios, argument.scales, _anchors);
+    auto desc = node.get_primitive();
+    std::vector<anchor> anchors;
+    cldnn::generate_anchors(default_size, desc->ratios, desc->scales, anchors);
+    return anchors;
 }
 
 static void calc_basic_params(
@@ -352,3 +352,78 @@ TEST(activation_f32_fw_gpu, relu_basic_output_padding_yxfb) {
         EXPECT_FLOAT_EQ(output_vec[i], output_ptr[i]);
     }
 }
+
+TEST(activation_f32_fw_gpu, relu_executed_with_swapped_inputs) {
+    //  The two activations have the same kernel, the arguments of their kernels follow the input memories
+    //  which are swapped between the executions of the network
+
+    engine engine;
+
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+    set_values(input1, { 1.0f, -2.0f, 3.0f, -4.0f });
+    set_values(input2, { -5.0f, 6.0f, -7.0f, 8.0f });
+    VF<float> output1_vec = { 1.0f, 0.0f, 3.0f, 0.0f };
+    VF<float> output2_vec = { 0.0f, 6.0f, 0.0f, 8.0f };
+
+    topology topology(
+        input_layout("input1", input1.get_layout()),
+        input_layout("input2", input2.get_layout()),
+        activation("relu1", "input1", activation_relu),
+        activation("relu2", "input2", activation_relu));
+    network network(engine, topology);
+
+    for (int execution = 0; execution < 3; ++execution) {
+        const bool swapped = execution % 2 == 1;
+        network.set_input_data("input1", swapped ? input2 : input1);
+        network.set_input_data("input2", swapped ? input1 : input2);
+        auto outputs = network.execute();
+        EXPECT_EQ(outputs.size(), size_t(2));
+
+        auto output1_ptr = outputs.at("relu1").get_memory().pointer<float>();
+        auto output2_ptr = outputs.at("relu2").get_memory().pointer<float>();
+        for (size_t i = 0; i < output1_vec.size(); ++i) {
+            EXPECT_FLOAT_EQ(swapped ? output2_vec[i] : output1_vec[i], output1_ptr[i]);
+            EXPECT_FLOAT_EQ(swapped ? output1_vec[i] : output2_vec[i], output2_ptr[i]);
+        }
+    }
+}
+
+TEST(activation_f32_fw_gpu, relu_networks_executed_in_sequence) {
+    //  The output of the first network is the input of the second one, the second network waits for it
+    //
+    //  Input:
+    //  1 -2  3 -4
+    //
+    //  Output of the first network (slope 0.5):
+    //  1 -1  3 -2
+    //
+    //  Output of the second network (abs):
+    //  1  1  3  2
+
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4, 1 } });
+    set_values(input, { 1.0f, -2.0f, 3.0f, -4.0f });
+    VF<float> output_vec = { 1.0f, 1.0f, 3.0f, 2.0f };
+
+    topology first_topology(
+        input_layout("input", input.get_layout()),
+        activation("relu", "input", activation_relu_negative_slope, { 0.5f, 0.f }));
+    topology second_topology(
+        input_layout("input", input.get_layout()),
+        activation("abs", "input", activation_abs));
+    network first_network(engine, first_topology);
+    network second_network(engine, second_topology);
+
+    first_network.set_input_data("input", input);
+    second_network.set_input_data("input", first_network.get_output_memory("relu"));
+    network::execute_sequence({ first_network, second_network });
+
+    auto output = second_network.get_output("abs");
+    output.get_event().wait();
+    auto output_ptr = output.get_memory().pointer<float>();
+    for (size_t i = 0; i < output_vec.size(); ++i) {
+        EXPECT_FLOAT_EQ(output_vec[i], output_ptr[i]);
+    }
+}
@@ -73,4 +73,39 @@ TEST(DISABLED_oooq_test, simple)
     EXPECT_TRUE(output.get_layout().size.spatial[1] == 2);
     EXPECT_TRUE(output.get_layout().size.feature[0] == 1);
     EXPECT_TRUE(output.get_layout().size.batch[0] == 1);
-}
\ No newline at end of file
+}
+TEST(inorder_queue_test, outputs_of_repeated_executions)
+{
+    // the kernels of the in-order queue have no events unless they're awaited outside of the queue, so the outputs
+    // of both the inner and the last primitive are checked after each of the executions reusing the network
+    engine_configuration cfg{ false, false, false, std::string(), std::string(), false };
+    engine eng{ cfg };
+
+    memory input_mem = memory::allocate(eng, layout{ data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+
+    topology tpl;
+    tpl.add(input_layout("in", input_mem.get_layout()));
+    tpl.add(reorder("r0", "in", input_mem.get_layout(), std::vector<float>{ 1 }));
+    tpl.add(reorder("r1", "r0", input_mem.get_layout(), std::vector<float>{ 2 }));
+    tpl.add(reorder("r2", "r1", input_mem.get_layout(), std::vector<float>{ 3 }));
+
+    build_options options;
+    options.set_option(build_option::outputs({ "r0", "r2" }));
+    network net{ eng, tpl, options };
+
+    for (int iteration = 0; iteration < 3; iteration++)
+    {
+        const float base = 10.f * iteration;
+        set_values(input_mem, { base, base + 1.f, base + 2.f, base + 3.f });
+        net.set_input_data("in", input_mem);
+        auto outputs = net.execute();
+
+        auto r0_ptr = outputs.at("r0").get_memory().pointer<float>();
+        auto r2_ptr = outputs.at("r2").get_memory().pointer<float>();
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_FLOAT_EQ(base + i - 1.f, r0_ptr[i]);
+            EXPECT_FLOAT_EQ(base + i - 6.f, r2_ptr[i]);
+        }
+    }
+}
@@ -28,11 +28,15 @@
 #include <api/CPP/data.hpp>
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 #include <thread>
 #include <fstream>
 #include <api/CPP/reorder.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/activation.hpp>
 
 using namespace cldnn;
 using namespace tests;
@@ -1555,6 +1559,197 @@ TEST(convolution_f32_fw_gpu, basic_wsiz2x2_wstr2x2_in4x4x2x2_nopad_split2_depthw
     }
 }
 
+TEST(convolution_f32_fw_gpu, depthwise_wsiz3x3_dilation2x2_in7x9x16x1_pad2_split16) {
+    //  Filter   : 3x3 per feature
+    //  Dilation : 2x2
+    //  Stride   : 1x1
+    //  Input    : 9x7, 16 features, each feature is a group of the convolution
+    //  Padding  : 2x2
+    //  Output   : 9x7, 16 features
+    //
+    //  The extent of the dilated filter is 5x5, so the outputs near the borders use the padding
+
+    const int features = 16, input_y = 7, input_x = 9, dilation = 2, padding = 2;
+
+    VVVVF<float> input_rnd = generate_random_4d<float>(1, features, input_y, input_x, -10, 10);
+    VF<float> input_rnd_vec = flatten_4d<float>(format::bfyx, input_rnd);
+
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, features, input_x, input_y } });
+    set_values(input, input_rnd_vec);
+
+    topology topology(input_layout("input", input.get_layout()));
+
+    std::vector<primitive_id> weights_vec;
+    std::vector<primitive_id> bias_vec;
+    VVVVF<float> output_rnd(1, VVVF<float>(features));
+    for (int f = 0; f < features; ++f)
+    {
+        VVVVF<float> filter_rnd = generate_random_4d<float>(1, 1, 3, 3, -10, 10);
+        VF<float> bias_rnd = generate_random_1d<float>(1, -10, 10);
+        output_rnd[0][f] = reference_convolve<float>(input_rnd[0], filter_rnd[0], 1, 1, bias_rnd[0], dilation, dilation, padding, padding, 0, 0, f);
+
+        auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 3, 3 } });
+        auto biases = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 1, 1 } });
+        set_values(weights, flatten_4d<float>(format::bfyx, filter_rnd));
+        set_values(biases, bias_rnd);
+
+        weights_vec.push_back("weights_" + std::to_string(f));
+        bias_vec.push_back("biases_" + std::to_string(f));
+        topology.add(
+            data(weights_vec.back(), weights),
+            data(bias_vec.back(), biases)
+        );
+    }
+    VF<float> output_rnd_vec = flatten_4d<float>(format::bfyx, output_rnd);
+
+    topology.add(
+        convolution(
+            "conv",
+            "input",
+            weights_vec,
+            bias_vec,
+            { 1, 1, 1, 1 },
+            { 0, 0, -padding, -padding },
+            { 1, 1, dilation, dilation })
+    );
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "conv");
+
+    auto output_prim = outputs.begin()->second.get_memory();
+    auto output_layout = output_prim.get_layout();
+    EXPECT_EQ(output_layout.size.spatial[0], input_x);
+    EXPECT_EQ(output_layout.size.spatial[1], input_y);
+    EXPECT_EQ(output_layout.size.feature[0], features);
+
+    auto output_ptr = output_prim.pointer<float>();
+    for (size_t i = 0; i < output_rnd_vec.size(); ++i) {
+        float x = float_round(output_rnd_vec[i]), y = float_round(output_ptr[i]);
+        EXPECT_FLOAT_EQ(x, y) << "random seed = " << random_seed << std::endl;
+    }
+}
+
+TEST(convolution_f32_fw_gpu, reordered_weights_are_taken_from_constants_data) {
+    //  Input  : 1x16x8x8
+    //  Filter : 16x16x3x3, reordered to the layout of the kernel by the constants propagation
+    //
+    //  The reordered weights kept by the first engine are given to the second one, its program takes them
+    //  instead of reordering the weights, so the change of the kept data changes the output
+    const engine_configuration eng_conf(false, false, false, "", "", true, "", "", priority_mode_types::disabled,
+                                        throttle_mode_types::disabled, true, "", nullptr, 0, true /*constants_cache*/);
+
+    const auto input_values = generate_random_1d<float>(1 * 16 * 8 * 8, -1, 1);
+    const auto weights_values = generate_random_1d<float>(16 * 16 * 3 * 3, -1, 1);
+
+    auto run = [&](const engine& engine) {
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 16, 8, 8 } });
+        auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 16, 16, 3, 3 } });
+        set_values(input, input_values);
+        set_values(weights, weights_values);
+
+        topology topology(
+            input_layout("input", input.get_layout()),
+            data("weights", weights),
+            convolution("conv", "input", { "weights" }, { 1, 1, 1, 1 }, { 0, 0, -1, -1 }));
+
+        build_options options;
+        options.set_option(build_option::optimize_data(true));
+        network network(engine, topology, options);
+        network.set_input_data("input", input);
+
+        auto output = network.execute().at("conv").get_memory();
+        auto output_ptr = output.pointer<float>();
+        return std::vector<float>(output_ptr.begin(), output_ptr.end());
+    };
+
+    engine first_engine{ eng_conf };
+    const auto expected = run(first_engine);
+    auto constants = first_engine.get_constants_data();
+    ASSERT_GT(constants.size(), sizeof(uint64_t));
+
+    engine second_engine{ eng_conf };
+    second_engine.set_constants_data(constants);
+    EXPECT_EQ(run(second_engine), expected);
+
+    // the data of the last constant end the blob
+    const float changed_weight = 100.f;
+    std::memcpy(constants.data() + constants.size() - sizeof(float), &changed_weight, sizeof(float));
+    engine changed_engine{ eng_conf };
+    changed_engine.set_constants_data(constants);
+    EXPECT_NE(run(changed_engine), expected);
+}
+
+TEST(convolution_f32_fw_gpu, wsiz1x1_wstr2x2_in9x5x8_out6_tuned) {
+    //  Filter : 1x1
+    //  Stride : 2x2
+    //  Input  : 9x5, 8 features
+    //  Output : 5x3, 6 features
+    //
+    //  The convolution is tuned, so all its kernels are run, the image weights one (convolution_gpu_bfyx_1x1_image)
+    //  included on the devices supporting the images, and the fastest one must give the right output
+
+    const int input_f = 8, output_f = 6, input_y = 5, input_x = 9, stride = 2;
+    const std::string tuning_file = "convolution_1x1_tuned.txt";
+    std::remove(tuning_file.c_str());
+
+    VVVVF<float> input_rnd = generate_random_4d<float>(1, input_f, input_y, input_x, -10, 10);
+    VVVVF<float> filter_rnd = generate_random_4d<float>(output_f, input_f, 1, 1, -10, 10);
+    VF<float> bias_rnd = generate_random_1d<float>(output_f, -10, 10);
+    VVVVF<float> output_rnd(1, VVVF<float>(output_f));
+    for (int of = 0; of < output_f; ++of) {
+        output_rnd[0][of] = reference_convolve<float>(input_rnd[0], filter_rnd[of], stride, stride, bias_rnd[of]);
+    }
+    VF<float> output_rnd_vec = flatten_4d<float>(format::bfyx, output_rnd);
+
+    engine engine{ engine_configuration{ true /*profiling*/ } };
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, input_f, input_x, input_y } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { output_f, input_f, 1, 1 } });
+    auto biases = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, output_f, 1 } });
+    set_values(input, flatten_4d<float>(format::bfyx, input_rnd));
+    set_values(weights, flatten_4d<float>(format::bfyx, filter_rnd));
+    set_values(biases, bias_rnd);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("biases", biases),
+        convolution("conv", "input", { "weights" }, { "biases" }, { 1, 1, stride, stride })
+    );
+
+    tuning_config_options tuning_config;
+    tuning_config.mode = tuning_mode::tuning_tune_and_cache;
+    tuning_config.cache_file_path = tuning_file;
+    build_options options;
+    options.set_option(build_option::tuning_config(tuning_config));
+
+    network network(engine, topology, options);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "conv");
+
+    auto output_prim = outputs.begin()->second.get_memory();
+    auto output_layout = output_prim.get_layout();
+    EXPECT_EQ(output_layout.size.spatial[0], 5);
+    EXPECT_EQ(output_layout.size.spatial[1], 3);
+    EXPECT_EQ(output_layout.size.feature[0], output_f);
+
+    auto output_ptr = output_prim.pointer<float>();
+    for (size_t i = 0; i < output_rnd_vec.size(); ++i) {
+        EXPECT_NEAR(output_rnd_vec[i], output_ptr[i], 1e-3f) << "random seed = " << random_seed << std::endl;
+    }
+
+    std::remove(tuning_file.c_str());
+}
+
 TEST(convolution_f32_fw_gpu, basic_wsiz1x1_wstr2x2_in1x1x4x1_nopad_split2) {
     //  Filter : 1x1
     //  Stride : 2x2
@@ -2965,6 +3160,67 @@ TEST(convolution_gpu, basic_yxfb_4_4_yxfb_2_2_b16_if2_of16_st2_2_p0_sp1_fp16)
 #undef USE_OLD_WEIGHTS_FORMAT
 }
 
+TEST(convolution_f32_fw_gpu, basic_1x1_with_fused_eltwise_and_relu) {
+    //  Input  : 1x16x8x8
+    //  Filter : 1x1, 32 output features, bias
+    //  Eltwise: sum with the other input 1x32x8x8 and relu
+    //
+    //  The sum is fused into the convolution when the data is optimized, the results are compared with the network
+    //  which executes the primitives one by one
+
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 16, 8, 8 } });
+    auto other = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 32, 8, 8 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 32, 16, 1, 1 } });
+    auto biases = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 32, 1 } });
+
+    set_values(input, generate_random_1d<float>(input.get_layout().count(), -1, 1));
+    set_values(other, generate_random_1d<float>(other.get_layout().count(), -1, 1));
+    set_values(weights, generate_random_1d<float>(weights.get_layout().count(), -1, 1));
+    set_values(biases, generate_random_1d<float>(biases.get_layout().count(), -1, 1));
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        input_layout("other", other.get_layout()),
+        data("weights", weights),
+        data("biases", biases),
+        convolution("conv", "input", { "weights" }, { "biases" }),
+        eltwise("sum", "conv", "other", eltwise_mode::sum),
+        activation("relu", "sum", activation_relu));
+
+    std::vector<float> results[2];
+    for (int optimize = 0; optimize < 2; optimize++)
+    {
+        build_options options;
+        options.set_option(build_option::optimize_data(optimize != 0));
+        network network(engine, topology, options);
+        network.set_input_data("input", input);
+        network.set_input_data("other", other);
+
+        auto outputs = network.execute();
+        EXPECT_EQ(outputs.size(), size_t(1));
+        EXPECT_EQ(outputs.begin()->first, "relu");
+
+        auto output_layout = outputs.begin()->second.get_memory().get_layout();
+        EXPECT_EQ(output_layout.format, format::bfyx);
+        EXPECT_EQ(output_layout.size, tensor(1, 32, 8, 8));
+
+        auto output_ptr = outputs.begin()->second.get_memory().pointer<float>();
+        results[optimize].assign(output_ptr.begin(), output_ptr.end());
+
+        if (optimize)
+            EXPECT_EQ(network.get_executed_primitives().count("sum"), size_t(0));
+    }
+
+    ASSERT_EQ(results[0].size(), results[1].size());
+    for (size_t i = 0; i < results[0].size(); i++)
+    {
+        EXPECT_GE(results[1][i], 0.0f);
+        EXPECT_NEAR(results[0][i], results[1][i], 1e-4f);
+    }
+}
+
 class convolution_test : public tests::generic_test
 {
 
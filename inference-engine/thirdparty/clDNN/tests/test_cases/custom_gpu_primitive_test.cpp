@@ -407,3 +407,50 @@ TEST(custom_gpu_primitive_f32, two_kernels_with_same_entry_point_basic_in2x2x2x2
         EXPECT_TRUE(are_equal(input_ptr[i] + 7, output_ptr[i]));
     }
 }
+
+TEST(custom_gpu_primitive_f32, identical_kernels_of_two_primitives_in2x2x2x2) {
+    //  The primitives have the same source, layouts and work sizes, so their kernel is compiled once
+    //  and each primitive runs it with its own arguments
+    //
+    //  Input  : 2x2x2x2
+    //  Output : 2x2x2x2, the input doubled twice
+
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 2, 2, 2 } });
+
+    std::string kernel_code =
+        R"__krnl(
+            __kernel void double_kernel(const __global float* input0, __global float* output)
+            {
+                const unsigned idx = get_global_id(0);
+                output[idx] = 2 * input0[idx];
+            }
+        )__krnl";
+    std::string entry_point = "double_kernel";
+    std::vector<cldnn_arg> parameters = { { arg_input, 0 }, { arg_output, 0 } };
+    layout output_layout = { data_types::f32, format::bfyx, { 2, 2, 2, 2 } };
+    std::vector<size_t> gws = { output_layout.count() };
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(custom_gpu_primitive("user_kernel1", { "input" }, { kernel_code }, entry_point, parameters, "", output_layout, gws));
+    topology.add(custom_gpu_primitive("user_kernel2", { "user_kernel1" }, { kernel_code }, entry_point, parameters, "", output_layout, gws));
+
+    std::vector<float> input_values = generate_random_1d<float>(output_layout.count(), -10, 10);
+    set_values(input, input_values);
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "user_kernel2");
+
+    auto output = outputs.at("user_kernel2").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    for (size_t i = 0; i < input_values.size(); i++)
+    {
+        EXPECT_TRUE(are_equal(4 * input_values[i], output_ptr[i]));
+    }
+}
@@ -24,6 +24,10 @@
 #include <api/CPP/engine.hpp>
 #include "test_utils/test_utils.h"
 
+#include <cmath>
+#include <tuple>
+#include <type_traits>
+
 namespace cldnn
 {
     template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
@@ -145,6 +149,180 @@ public:
             EXPECT_TRUE(floating_point_equal(data[num * output.get_layout().size.spatial[0] + i], (T)(float)atof(items[i].c_str())));
         }
     }
+
+    // Fills 16 priors (two sizes at each of 4x2 centers, so the pairs of a center overlap), small location offsets
+    // and the scores quantized to 1/8, so the equal scores of the different priors and classes are common.
+    void init_reference_buffers(cldnn::memory prior_memory, cldnn::memory confidence_memory, cldnn::memory location_memory,
+                                int images, int priors, int classes, int loc_classes,
+                                std::vector<float>& prior_values, std::vector<float>& confidence_values, std::vector<float>& location_values)
+    {
+        auto prior_ptr = prior_memory.pointer<T>();
+        auto confidence_ptr = confidence_memory.pointer<T>();
+        auto location_ptr = location_memory.pointer<T>();
+
+        const float variances[4] = { 0.1f, 0.1f, 0.2f, 0.2f };
+        prior_values.resize(priors * 4 * 2);
+        for (int p = 0; p < priors; ++p)
+        {
+            const int cell = p / 2;
+            const float center_x = (cell % 4 + 0.5f) * 0.25f;
+            const float center_y = (cell / 4 + 0.5f) * 0.5f;
+            const float half_size = p % 2 ? 0.12f : 0.15f;
+            prior_ptr[p * 4 + 0] = center_x - half_size;
+            prior_ptr[p * 4 + 1] = center_y - half_size;
+            prior_ptr[p * 4 + 2] = center_x + half_size;
+            prior_ptr[p * 4 + 3] = center_y + half_size;
+            for (int i = 0; i < 4; ++i)
+                prior_ptr[(priors + p) * 4 + i] = variances[i];
+        }
+        for (size_t i = 0; i < prior_values.size(); ++i)
+            prior_values[i] = (float)prior_ptr[i];
+
+        confidence_values.resize(images * priors * classes);
+        for (int i = 0; i < images; ++i)
+            for (int p = 0; p < priors; ++p)
+                for (int c = 0; c < classes; ++c)
+                {
+                    const int idx = (i * priors + p) * classes + c;
+                    confidence_ptr[idx] = ((i * 3 + p * 5 + c * 7) % 8) / 8.f;
+                    confidence_values[idx] = (float)confidence_ptr[idx];
+                }
+
+        location_values.resize(images * priors * loc_classes * 4);
+        for (int i = 0; i < images; ++i)
+            for (int p = 0; p < priors; ++p)
+                for (int c = 0; c < loc_classes; ++c)
+                    for (int k = 0; k < 4; ++k)
+                    {
+                        const int idx = ((i * priors + p) * loc_classes + c) * 4 + k;
+                        location_ptr[idx] = ((i * 5 + p * 3 + c * 2 + k) % 5 - 2) * 0.05f;
+                        location_values[idx] = (float)location_ptr[idx];
+                    }
+    }
+
+    // Host reference of the primitive: the candidates of a class above the threshold are sorted by the score (the
+    // lower prior first on the equal scores), cut to top_k and suppressed greedily; when an image has more than
+    // keep_top_k detections the best ones of all the classes are kept, the lower class first on the equal scores.
+    static std::vector<float> reference_output(const std::vector<float>& location, const std::vector<float>& confidence,
+                                               const std::vector<float>& prior, int images, int priors, int classes,
+                                               bool share_location, int background_label_id, float nms_threshold,
+                                               int top_k, int keep_top_k, prior_box_code_type code_type,
+                                               float confidence_threshold, bool decrease_label_id)
+    {
+        const int loc_classes = share_location ? 1 : classes;
+        std::vector<float> boxes(images * loc_classes * priors * 4);
+        for (int i = 0; i < images; ++i)
+            for (int c = 0; c < loc_classes; ++c)
+                for (int p = 0; p < priors; ++p)
+                {
+                    const float* pr = &prior[p * 4];
+                    const float* var = &prior[(priors + p) * 4];
+                    const float* loc = &location[((i * priors + p) * loc_classes + c) * 4];
+                    float* box = &boxes[((i * loc_classes + c) * priors + p) * 4];
+                    if (code_type == prior_box_code_type::center_size)
+                    {
+                        const float width = pr[2] - pr[0];
+                        const float height = pr[3] - pr[1];
+                        const float center_x = var[0] * loc[0] * width + (pr[0] + pr[2]) / 2.f;
+                        const float center_y = var[1] * loc[1] * height + (pr[1] + pr[3]) / 2.f;
+                        const float box_width = std::exp(var[2] * loc[2]) * width;
+                        const float box_height = std::exp(var[3] * loc[3]) * height;
+                        box[0] = center_x - box_width / 2.f;
+                        box[1] = center_y - box_height / 2.f;
+                        box[2] = center_x + box_width / 2.f;
+                        box[3] = center_y + box_height / 2.f;
+                    }
+                    else
+                    {
+                        for (int k = 0; k < 4; ++k)
+                            box[k] = pr[k] + var[k] * loc[k];
+                    }
+                }
+
+        auto overlap = [](const float* a, const float* b)
+        {
+            if (!(a[0] < b[2] && b[0] < a[2] && a[1] < b[3] && b[1] < a[3]))
+                return 0.f;
+            const float intersection = (std::min(a[2], b[2]) - std::max(a[0], b[0])) * (std::min(a[3], b[3]) - std::max(a[1], b[1]));
+            return intersection / ((a[2] - a[0]) * (a[3] - a[1]) + (b[2] - b[0]) * (b[3] - b[1]) - intersection);
+        };
+
+        std::vector<float> output(images * keep_top_k * 7, 0.f);
+        int row = 0;
+        for (int i = 0; i < images; ++i)
+        {
+            // (score, class, prior) of the kept detections
+            std::vector<std::tuple<float, int, int>> detections;
+            for (int c = 0; c < classes; ++c)
+            {
+                if (c == background_label_id)
+                    continue;
+                std::vector<std::pair<float, int>> candidates;
+                for (int p = 0; p < priors; ++p)
+                {
+                    const float score = confidence[(i * priors + p) * classes + c];
+                    if (score > confidence_threshold)
+                        candidates.emplace_back(score, p);
+                }
+                std::stable_sort(candidates.begin(), candidates.end(),
+                                 [](const std::pair<float, int>& a, const std::pair<float, int>& b) { return a.first > b.first; });
+                if (top_k != -1 && (int)candidates.size() > top_k)
+                    candidates.resize(top_k);
+
+                const float* class_boxes = &boxes[(i * loc_classes + (share_location ? 0 : c)) * priors * 4];
+                std::vector<int> kept;
+                for (const auto& candidate : candidates)
+                {
+                    bool keep = true;
+                    for (int k : kept)
+                        keep = keep && overlap(&class_boxes[candidate.second * 4], &class_boxes[k * 4]) <= nms_threshold;
+                    if (keep)
+                    {
+                        kept.push_back(candidate.second);
+                        detections.emplace_back(candidate.first, c, candidate.second);
+                    }
+                }
+            }
+
+            if ((int)detections.size() > keep_top_k)
+            {
+                std::stable_sort(detections.begin(), detections.end(),
+                                 [](const std::tuple<float, int, int>& a, const std::tuple<float, int, int>& b) { return std::get<0>(a) > std::get<0>(b); });
+                detections.resize(keep_top_k);
+                std::stable_sort(detections.begin(), detections.end(),
+                                 [](const std::tuple<float, int, int>& a, const std::tuple<float, int, int>& b) { return std::get<1>(a) < std::get<1>(b); });
+            }
+
+            for (const auto& detection : detections)
+            {
+                const int c = std::get<1>(detection);
+                const float* box = &boxes[((i * loc_classes + (share_location ? 0 : c)) * priors + std::get<2>(detection)) * 4];
+                float* out = &output[row++ * 7];
+                out[0] = (float)i;
+                out[1] = decrease_label_id ? c - 1.f : (float)c;
+                out[2] = std::get<0>(detection);
+                for (int k = 0; k < 4; ++k)
+                    out[3 + k] = box[k];
+            }
+        }
+        for (; row < images * keep_top_k; ++row)
+            output[row * 7] = -1.f;
+        return output;
+    }
+
+    void check_reference(const memory& output, const std::vector<float>& reference)
+    {
+        const float eps = std::is_same<T, FLOAT16>::value ? 1e-2f : 1e-4f;
+        auto out_ptr = output.pointer<T>();
+        ASSERT_EQ(out_ptr.size(), reference.size());
+        for (size_t row = 0; row < reference.size() / 7; ++row)
+        {
+            for (int i = 0; i < 2; ++i)
+                EXPECT_EQ(static_cast<int>((float)out_ptr[row * 7 + i]), static_cast<int>(reference[row * 7 + i])) << "row " << row;
+            for (int i = 2; i < 7; ++i)
+                EXPECT_NEAR((float)out_ptr[row * 7 + i], reference[row * 7 + i], eps) << "row " << row << " item " << i;
+        }
+    }
     static const int num_of_images = 2;
     static const int num_classes = 2;
     static const int num_priors = 4;
@@ -683,3 +861,95 @@ TYPED_TEST(detection_output_test, test_forward_no_share_location_top_k_faster_rc
     this->check_results(output_prim, 7, "-1 0 0 0 0 0 0");
 }
 
+
+TYPED_TEST(detection_output_test, test_forward_no_share_location_top_k_reference)
+{
+    const int num_of_images = 2;
+    const int num_priors = 16;
+    const int num_classes = 4;
+    const bool share_location = false;
+    const int num_loc_classes = share_location ? 1 : num_classes;
+    const int keep_top_k = 10;
+    const int background_label_id = 0;
+    const float nms_threshold = 0.45f;
+    const int top_k = 5;
+    const float confidence_threshold = 0.2f;
+
+    cldnn::engine engine;
+    cldnn::memory input_location = memory::allocate(engine, { type_to_data_type<TypeParam>::value, format::bfyx,{ num_of_images, num_priors * num_loc_classes * 4, 1, 1 } });
+    cldnn::memory input_confidence = memory::allocate(engine, { type_to_data_type<TypeParam>::value, format::bfyx,{ num_of_images, num_priors * num_classes, 1, 1 } });
+    cldnn::memory input_prior_box = memory::allocate(engine, { type_to_data_type<TypeParam>::value, format::bfyx,{ 1, 2, 1, num_priors * 4 } });
+
+    std::vector<float> prior_values, confidence_values, location_values;
+    this->init_reference_buffers(input_prior_box, input_confidence, input_location, num_of_images, num_priors, num_classes, num_loc_classes,
+                                 prior_values, confidence_values, location_values);
+
+    topology topology;
+    topology.add(input_layout("input_location", input_location.get_layout()));
+    topology.add(input_layout("input_confidence", input_confidence.get_layout()));
+    topology.add(input_layout("input_prior_box", input_prior_box.get_layout()));
+
+    topology.add(detection_output("detection_output", "input_location", "input_confidence", "input_prior_box", num_classes, keep_top_k,
+                                  share_location, background_label_id, nms_threshold, top_k, 1.f, prior_box_code_type::corner, false,
+                                  confidence_threshold));
+    network network(engine, topology);
+    network.set_input_data("input_location", input_location);
+    network.set_input_data("input_confidence", input_confidence);
+    network.set_input_data("input_prior_box", input_prior_box);
+
+    auto outputs = network.execute();
+
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->second.get_memory().get_layout().size.spatial[1], keep_top_k * num_of_images);
+
+    this->check_reference(outputs.begin()->second.get_memory(),
+                          this->reference_output(location_values, confidence_values, prior_values, num_of_images, num_priors, num_classes,
+                                                 share_location, background_label_id, nms_threshold, top_k, keep_top_k,
+                                                 prior_box_code_type::corner, confidence_threshold, false));
+}
+
+TYPED_TEST(detection_output_test, test_forward_share_location_center_size_reference)
+{
+    const int num_of_images = 2;
+    const int num_priors = 16;
+    const int num_classes = 3;
+    const bool share_location = true;
+    const int num_loc_classes = share_location ? 1 : num_classes;
+    const int keep_top_k = 12;
+    const int background_label_id = 0;
+    const float nms_threshold = 0.45f;
+    const int top_k = -1;
+    const float confidence_threshold = 0.3f;
+
+    cldnn::engine engine;
+    cldnn::memory input_location = memory::allocate(engine, { type_to_data_type<TypeParam>::value, format::bfyx,{ num_of_images, num_priors * num_loc_classes * 4, 1, 1 } });
+    cldnn::memory input_confidence = memory::allocate(engine, { type_to_data_type<TypeParam>::value, format::bfyx,{ num_of_images, num_priors * num_classes, 1, 1 } });
+    cldnn::memory input_prior_box = memory::allocate(engine, { type_to_data_type<TypeParam>::value, format::bfyx,{ 1, 2, 1, num_priors * 4 } });
+
+    std::vector<float> prior_values, confidence_values, location_values;
+    this->init_reference_buffers(input_prior_box, input_confidence, input_location, num_of_images, num_priors, num_classes, num_loc_classes,
+                                 prior_values, confidence_values, location_values);
+
+    topology topology;
+    topology.add(input_layout("input_location", input_location.get_layout()));
+    topology.add(input_layout("input_confidence", input_confidence.get_layout()));
+    topology.add(input_layout("input_prior_box", input_prior_box.get_layout()));
+
+    topology.add(detection_output("detection_output", "input_location", "input_confidence", "input_prior_box", num_classes, keep_top_k,
+                                  share_location, background_label_id, nms_threshold, top_k, 1.f, prior_box_code_type::center_size, false,
+                                  confidence_threshold, 4, 0, true, -1, -1, true));
+    network network(engine, topology);
+    network.set_input_data("input_location", input_location);
+    network.set_input_data("input_confidence", input_confidence);
+    network.set_input_data("input_prior_box", input_prior_box);
+
+    auto outputs = network.execute();
+
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->second.get_memory().get_layout().size.spatial[1], keep_top_k * num_of_images);
+
+    this->check_reference(outputs.begin()->second.get_memory(),
+                          this->reference_output(location_values, confidence_values, prior_values, num_of_images, num_priors, num_classes,
+                                                 share_location, background_label_id, nms_threshold, top_k, keep_top_k,
+                                                 prior_box_code_type::center_size, confidence_threshold, true));
+}
@@ -23,6 +23,7 @@
 #include <api/CPP/network.hpp>
 #include <api/CPP/engine.hpp>
 #include <api/CPP/reorder.hpp>
+#include <api/CPP/data.hpp>
 #include "test_utils/test_utils.h"
 
 namespace cldnn
@@ -228,6 +229,54 @@ TEST(eltwise_gpu_f32, add_basic_in4x4x2x2) {
     }
 }
 
+TEST(eltwise_gpu_f32, add_of_constants_in2x2x2x2) {
+    //  The product of the constants is reordered to yxfb with the values subtracted per feature, both of them
+    //  are computed while the network is built, and the result is added to the input:
+    //  const1 (bfyx): 0 .. 15, const2 (bfyx): 2, the subtracted values: f0: 1, f1: 2, input (yxfb): 0.5
+    //  Output: 0.5 + 2 * (b * 8 + f * 4 + y * 2 + x) - (f + 1)
+
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::yxfb, { 2, 2, 2, 2 } });
+    auto const1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 2, 2, 2 } });
+    auto const2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 2, 2, 2 } });
+
+    std::vector<float> const1_values(16), const2_values(16, 2.f);
+    for (int i = 0; i < 16; i++)
+        const1_values[i] = static_cast<float>(i);
+    set_values(const1, const1_values);
+    set_values(const2, const2_values);
+    set_values(input, std::vector<float>(16, 0.5f));
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("const1", const1));
+    topology.add(data("const2", const2));
+    topology.add(eltwise("const_prod", { "const1", "const2" }, eltwise_mode::prod));
+    topology.add(reorder("const_reorder", "const_prod", input.get_layout(), std::vector<float>{ 1.f, 2.f }));
+    topology.add(eltwise("eltwise", { "input", "const_reorder" }, eltwise_mode::sum));
+
+    network network(engine, topology);
+
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "eltwise");
+
+    auto output = outputs.at("eltwise").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    for (int y = 0; y < 2; y++)
+    for (int x = 0; x < 2; x++)
+    for (int f = 0; f < 2; f++)
+    for (int b = 0; b < 2; b++)
+    {
+        float answer = 0.5f + 2.f * (b * 8 + f * 4 + y * 2 + x) - (f + 1);
+        EXPECT_TRUE(are_equal(answer, output_ptr[((y * 2 + x) * 2 + f) * 2 + b]));
+    }
+}
+
 TEST(eltwise_gpu_f32, max_basic_in4x4x4x4) {
     //  Input2   : 2x2x2
     //  Input  : 2x2x2x2
@@ -0,0 +1,155 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/activation.hpp>
+#include "test_utils/test_utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace cldnn;
+using namespace tests;
+
+TEST(engine, networks_run_on_each_device)
+{
+    const auto count = engine::engine_count(engine_types::ocl);
+    ASSERT_GT(count, 0u);
+
+    for (uint32_t device = 0; device < count; device++)
+    {
+        engine eng(engine_types::ocl, device);
+        auto input = memory::allocate(eng, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+        set_values(input, { -1.f, 2.f, -3.f, 4.f });
+
+        topology topology(
+            input_layout("input", input.get_layout()),
+            activation("relu", "input", activation_relu));
+
+        network network(eng, topology);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        auto output = outputs.at("relu").get_memory();
+        auto output_ptr = output.pointer<float>();
+        EXPECT_EQ(output_ptr[0], 0.f);
+        EXPECT_EQ(output_ptr[1], 2.f);
+        EXPECT_EQ(output_ptr[2], 0.f);
+        EXPECT_EQ(output_ptr[3], 4.f);
+    }
+}
+
+TEST(engine, index_out_of_devices_is_rejected)
+{
+    const auto count = engine::engine_count(engine_types::ocl);
+    EXPECT_ANY_THROW(engine(engine_types::ocl, count));
+}
+
+namespace
+{
+    std::vector<float> run_relu(const engine& eng, const std::vector<float>& values)
+    {
+        auto input = memory::allocate(eng, { data_types::f32, format::bfyx, { 1, 2, 4, 4 } });
+        set_values(input, values);
+
+        topology topology(
+            input_layout("input", input.get_layout()),
+            activation("relu", "input", activation_relu));
+
+        network network(eng, topology);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        auto output_ptr = outputs.at("relu").get_memory().pointer<float>();
+        return std::vector<float>(output_ptr.begin(), output_ptr.end());
+    }
+
+    std::vector<float> relu_input()
+    {
+        std::vector<float> values(32);
+        for (size_t i = 0; i < values.size(); i++)
+            values[i] = (i % 3 ? 1.f : -1.f) * i;
+        return values;
+    }
+}
+
+TEST(engine, programs_binaries_are_imported_by_another_engine)
+{
+    const auto values = relu_input();
+
+    engine exporting;
+    const auto expected = run_relu(exporting, values);
+    const auto blob = exporting.get_programs_binaries();
+    ASSERT_FALSE(blob.empty());
+
+    engine importing;
+    importing.set_programs_binaries(blob);
+    EXPECT_EQ(run_relu(importing, values), expected);
+    EXPECT_FALSE(importing.get_programs_binaries().empty());
+}
+
+TEST(engine, rejected_programs_binaries_are_compiled_from_sources)
+{
+    const auto values = relu_input();
+
+    engine exporting;
+    const auto expected = run_relu(exporting, values);
+    auto blob = exporting.get_programs_binaries();
+
+    // the blob is the count of the programs, then the size and the bytes of the key and of the binary of each program;
+    // the binaries are overwritten, so the keys still match but the driver rejects the programs
+    size_t offset = 0;
+    auto read_size = [&]()
+    {
+        uint64_t value = 0;
+        std::memcpy(&value, blob.data() + offset, sizeof(value));
+        offset += sizeof(value);
+        return static_cast<size_t>(value);
+    };
+    for (size_t count = read_size(), i = 0; i < count; i++)
+    {
+        offset += read_size();
+        const auto binary_size = read_size();
+        std::fill(blob.begin() + offset, blob.begin() + offset + binary_size, 'x');
+        offset += binary_size;
+    }
+    ASSERT_EQ(offset, blob.size());
+
+    engine importing;
+    importing.set_programs_binaries(blob);
+    EXPECT_EQ(run_relu(importing, values), expected);
+}
+
+TEST(engine, truncated_programs_binaries_are_rejected)
+{
+    engine exporting;
+    run_relu(exporting, relu_input());
+    auto blob = exporting.get_programs_binaries();
+    ASSERT_GT(blob.size(), 1u);
+    blob.pop_back();
+
+    engine importing;
+    EXPECT_ANY_THROW(importing.set_programs_binaries(blob));
+}
@@ -29,6 +29,7 @@
 #include <boost/filesystem.hpp>
 
 #include <cmath>
+#include <tuple>
 
 namespace cldnn
 {
@@ -180,6 +181,34 @@ TEST(DISABLED_fully_connected_gpu, generic_random_short) {
     }  
 }
 
+TEST(fully_connected_gpu, fp16_batch_1_gemv) {
+    //  The batch 1 fp16 fully connected is computed by the GEMV kernel (fully_connected_gpu_bf_gemv_fp16) on the devices
+    //  supporting the subgroup block reads of shorts: the input features fill the steps of the subgroup or end with
+    //  a half (8) or a part of a step, the few outputs make the work group split the input features
+
+    engine engine;
+    if (!engine.get_info().supports_fp16) {
+        std::cout << "[ SKIPPED  ] float16 combinations are skipped (cl_khr_fp16 is not supported)." << std::endl;
+        EXPECT_EQ(1, 1);
+        return;
+    }
+
+    // features, y, x of the input and the outputs
+    std::vector<std::tuple<int, int, int, int>> sizes = {
+        std::make_tuple(64, 1, 1, 16),
+        std::make_tuple(24, 1, 1, 37),
+        std::make_tuple(75, 2, 2, 20),
+        std::make_tuple(4096, 1, 1, 10),
+        std::make_tuple(1000, 1, 1, 100),
+    };
+    for (const auto& size : sizes) {
+        for (bool relu : { false, true }) {
+            generic_fully_connected_test<FLOAT16>(format::bfyx, format::bfyx, 1, std::get<0>(size), std::get<1>(size),
+                                                  std::get<2>(size), std::get<3>(size), relu);
+        }
+    }
+}
+
 TEST(fully_connected_gpu, no_biases) {
     //  Input  : 3x1
     //  Output : 4x1
@@ -210,6 +210,58 @@ TEST(memory_pool, oooq) {
     EXPECT_EQ(engine.get_max_used_device_memory_size(), (uint64_t) 2816);
 }
 
+TEST(memory_pool, oooq_matches_in_order_queue) {
+    /*          -- relu1 - concat1- relu4 --
+        input<  -- relu2 |                   >-- concat2 -- relu6
+                -- relu3 --  relu5 ---------
+       the branches run concurrently by the out-of-order queue give the same results as the in-order queue. */
+
+    engine_configuration oooq_cfg{ false, false, false, std::string(), std::string(), true /*oooq*/, std::string(),std::string(), priority_mode_types::disabled, throttle_mode_types::disabled, true /*mem_pool*/ };
+    engine_configuration in_order_cfg{ false, false, false, std::string(), std::string(), false /*oooq*/, std::string(),std::string(), priority_mode_types::disabled, throttle_mode_types::disabled, true /*mem_pool*/ };
+    engine oooq_engine{ oooq_cfg };
+    engine in_order_engine{ in_order_cfg };
+    auto batch_num = 1;
+    auto feature_num = 4;
+    auto x_size = 4;
+    auto y_size = 4;
+
+    const layout input_layout_desc{ data_types::f32, format::bfyx,{ tensor(spatial(x_size, y_size), feature(feature_num), batch(batch_num)) } };
+    const auto input_vec = generate_random_1d<float>(input_layout_desc.count(), -10, 10);
+
+    topology topology;
+    topology.add(input_layout("input", input_layout_desc));
+    topology.add(activation("relu1", "input", activation_relu));
+    topology.add(activation("relu2", "input", activation_abs));
+    topology.add(activation("relu3", "input", activation_square));
+    topology.add(concatenation("concat1", { "relu1", "relu2" }, concatenation::along_f));
+    topology.add(activation("relu4", "concat1", activation_relu));
+    topology.add(activation("relu5", "relu3", activation_relu));
+    topology.add(concatenation("concat2", { "relu4", "relu5" }, concatenation::along_f));
+    topology.add(activation("relu6", "concat2", activation_linear, { 1.0f, 0.5f }));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    auto execute = [&](const engine& eng) {
+        auto input = memory::allocate(eng, input_layout_desc);
+        set_values(input, input_vec);
+        network network(eng, topology, bo);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+        auto output_ptr = outputs.at("relu6").get_memory().pointer<float>();
+        return std::vector<float>(output_ptr.begin(), output_ptr.end());
+    };
+
+    const auto oooq_output = execute(oooq_engine);
+    const auto in_order_output = execute(in_order_engine);
+
+    ASSERT_EQ(oooq_output.size(), in_order_output.size());
+    for (size_t i = 0; i < oooq_output.size(); ++i)
+    {
+        EXPECT_EQ(oooq_output[i], in_order_output[i]);
+    }
+}
+
 TEST(memory_pool, shared_mem_pool_same_topology_twice) {
     /*          -- relu1 - concat1- relu4 --
     input<  -- relu2 |                   >-- concat2 -- relu6
@@ -409,4 +461,107 @@ TEST(memory_pool, shared_mem_pool_diff_batches) {
     auto outputs_second = network_second.execute();
 
     EXPECT_EQ(engine.get_max_used_device_memory_size(), (uint64_t)3928);
-}
\ No newline at end of file
+}
+namespace {
+
+// the chain of 5 relu's of size 1x4x1x1, the intermediate ones share 2 buffers of the memory pool
+void run_relu_pipe(const engine& engine)
+{
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ tensor(spatial(1, 1), feature(4), batch(1)) } });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("relu", "input", activation_relu));
+    topology.add(activation("relu1", "relu", activation_relu));
+    topology.add(activation("relu2", "relu1", activation_relu));
+    topology.add(activation("relu3", "relu2", activation_relu));
+    topology.add(activation("relu4", "relu3", activation_relu));
+    topology.add(activation("relu5", "relu4", activation_relu));
+
+    set_values(input, { -1.f, 2.f, -3.f, 4.f });
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    network network(engine, topology, bo);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+}
+
+engine_configuration limited_pool_config(uint64_t limit)
+{
+    return{ false, false, false, std::string(), std::string(), true /*oooq*/, std::string(), std::string(), priority_mode_types::disabled, throttle_mode_types::disabled, true /*mem_pool*/, std::string(), nullptr, limit };
+}
+
+}
+
+TEST(memory_pool, statistics_of_relu_pipe) {
+    engine engine;
+    run_relu_pipe(engine);
+
+    const auto statistics = engine.get_memory_statistics();
+    EXPECT_GT(statistics.pool_used, 0u);
+    EXPECT_GT(statistics.pool_requested, statistics.pool_used);
+    EXPECT_LE(statistics.current_used, statistics.peak_used);
+    EXPECT_EQ(statistics.peak_used, engine.get_max_used_device_memory_size());
+    EXPECT_EQ(statistics.pool_limit, 0u);
+}
+
+TEST(memory_pool, limit_of_relu_pipe) {
+    engine unlimited_engine;
+    run_relu_pipe(unlimited_engine);
+    const auto pool_used = unlimited_engine.get_memory_statistics().pool_used;
+
+    engine limited_engine{ limited_pool_config(pool_used) };
+    EXPECT_NO_THROW(run_relu_pipe(limited_engine));
+    EXPECT_LE(limited_engine.get_memory_statistics().pool_used, pool_used);
+
+    // no intermediate buffer fits into the limit
+    engine too_limited_engine{ limited_pool_config(1) };
+    EXPECT_ANY_THROW(run_relu_pipe(too_limited_engine));
+}
+
+TEST(memory_pool, networks_of_one_engine_share_the_pool) {
+    // the networks executed one by one reuse the intermediate buffers of each other
+    engine engine;
+    run_relu_pipe(engine);
+    const auto first = engine.get_memory_statistics();
+    run_relu_pipe(engine);
+    const auto second = engine.get_memory_statistics();
+
+    EXPECT_EQ(second.pool_used, first.pool_used);
+    EXPECT_EQ(second.pool_requested, 2 * first.pool_requested);
+}
+
+TEST(memory_tests, staging_memory_round_trip)
+{
+    // the staging input is uploaded to the memory of the input layout, the output is downloaded to the staging memory
+    engine engine;
+    layout data_layout(data_types::f32, format::bfyx, { 1, 2, 4, 4 });
+
+    auto input = memory::allocate_staging(engine, data_layout);
+    auto output = memory::allocate_staging(engine, data_layout);
+    {
+        auto ptr = input.pointer<float>();
+        for (size_t i = 0; i < data_layout.count(); i++)
+            ptr[i] = static_cast<float>(i) - 10.f;
+    }
+
+    topology topology;
+    topology.add(input_layout("input", data_layout));
+    topology.add(activation("relu", "input", activation_relu));
+
+    network network(engine, topology);
+    for (int iteration = 0; iteration < 2; iteration++) {
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+        output.download(outputs.at("relu").get_memory());
+
+        auto in_ptr = input.pointer<float>();
+        auto out_ptr = output.pointer<float>();
+        for (size_t i = 0; i < data_layout.count(); i++) {
+            EXPECT_EQ(std::max(0.f, in_ptr[i]), out_ptr[i]) << "at " << i;
+            // the next iteration checks the data written to the same pointer
+            in_ptr[i] = -in_ptr[i];
+        }
+    }
+}
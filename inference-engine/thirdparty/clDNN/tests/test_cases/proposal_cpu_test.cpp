@@ -15,7 +15,10 @@
 */
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <tuple>
 
 #include <gtest/gtest.h>
 #include "api/CPP/memory.hpp"
@@ -172,3 +175,195 @@ TEST(proposal, fp16) {
     }
 }
 
+
+namespace
+{
+    struct proposal_roi { float x0, y0, x1, y1; };
+
+    // The anchors of the primitive: the ratio anchors of the base 16x16 box, each one scaled by all the scales
+    std::vector<proposal_roi> reference_anchors(const std::vector<float>& anchor_ratios, const std::vector<float>& anchor_scales)
+    {
+        const float base_center = 7.5f;
+        std::vector<proposal_roi> anchors;
+        for (float ratio : anchor_ratios)
+        {
+            const float ratio_w = std::round(std::sqrt(256.f / ratio));
+            const float ratio_h = std::round(ratio_w * ratio);
+            for (float scale : anchor_scales)
+            {
+                const float w = ratio_w * scale;
+                const float h = ratio_h * scale;
+                anchors.push_back({ base_center - 0.5f * (w - 1.f), base_center - 0.5f * (h - 1.f),
+                                    base_center + 0.5f * (w - 1.f), base_center + 0.5f * (h - 1.f) });
+            }
+        }
+        return anchors;
+    }
+
+    // Host reference of the primitive: the proposals of the valid boxes with a positive score are sorted by the score,
+    // the later proposal first on the equal scores, cut to pre_nms_topn and suppressed greedily; the rest is zeros.
+    std::vector<float> reference_proposals(const std::vector<float>& scores, const std::vector<float>& deltas,
+                                           const std::vector<float>& info, int fm_w, int fm_h,
+                                           const std::vector<float>& anchor_ratios, const std::vector<float>& anchor_scales,
+                                           float iou, int min_size, int stride, int pre_nms, int post_nms)
+    {
+        const std::vector<proposal_roi> anchors = reference_anchors(anchor_ratios, anchor_scales);
+        const int num_anchors = (int)anchors.size();
+        const int fm_size = fm_w * fm_h;
+        const int img_h = (int)(info[0] + 0.00001f);
+        const int img_w = (int)(info[1] + 0.00001f);
+        int min_x = min_size, min_y = min_size;
+        if (info.size() == 4)
+        {
+            min_x = (int)(min_size * info[3]);
+            min_y = (int)(min_size * info[2]);
+        }
+        else
+        {
+            min_x = min_y = min_size * (int)(info[2] + 0.00001f);
+        }
+
+        // (score, proposal index, box)
+        std::vector<std::tuple<float, int, proposal_roi>> proposals;
+        for (int y = 0; y < fm_h; ++y)
+            for (int x = 0; x < fm_w; ++x)
+                for (int a = 0; a < num_anchors; ++a)
+                {
+                    const int loc = y * fm_w + x;
+                    const float* d[4];
+                    for (int k = 0; k < 4; ++k)
+                        d[k] = &deltas[loc + fm_size * (a * 4 + k)];
+                    const proposal_roi& anchor = anchors[a];
+                    const float w = anchor.x1 - anchor.x0 + 1.f;
+                    const float h = anchor.y1 - anchor.y0 + 1.f;
+                    const float cx = *d[0] * w + anchor.x0 + 0.5f * w + x * stride;
+                    const float cy = *d[1] * h + anchor.y0 + 0.5f * h + y * stride;
+                    const float half_w = std::exp(*d[2]) * w * 0.5f;
+                    const float half_h = std::exp(*d[3]) * h * 0.5f;
+                    auto clip = [](float v, float hi) { return std::max(0.f, std::min(v, hi)); };
+                    const proposal_roi box = { clip(cx - half_w, img_w - 1.f), clip(cy - half_h, img_h - 1.f),
+                                               clip(cx + half_w, img_w - 1.f), clip(cy + half_h, img_h - 1.f) };
+                    const float score = scores[loc + fm_size * (num_anchors + a)];
+                    if ((int)box.x1 - (int)box.x0 + 1 >= min_x && (int)box.y1 - (int)box.y0 + 1 >= min_y && score > 0.f)
+                        proposals.emplace_back(score, (y * fm_w + x) * num_anchors + a, box);
+                }
+
+        std::sort(proposals.begin(), proposals.end(),
+                  [](const std::tuple<float, int, proposal_roi>& a, const std::tuple<float, int, proposal_roi>& b)
+                  {
+                      return std::get<0>(a) > std::get<0>(b) || (std::get<0>(a) == std::get<0>(b) && std::get<1>(a) > std::get<1>(b));
+                  });
+        if ((int)proposals.size() > pre_nms)
+            proposals.resize(pre_nms);
+
+        auto area = [](const proposal_roi& r) { return std::max(0.f, r.y1 - r.y0 + 1.f) * std::max(0.f, r.x1 - r.x0 + 1.f); };
+        std::vector<proposal_roi> kept;
+        for (const auto& proposal : proposals)
+        {
+            if ((int)kept.size() == post_nms)
+                break;
+            const proposal_roi& b = std::get<2>(proposal);
+            bool suppressed = false;
+            for (const proposal_roi& k : kept)
+            {
+                if (!(b.x0 < k.x1 && k.x0 < b.x1 && b.y0 < k.y1 && k.y0 < b.y1))
+                    continue;
+                const float intersection = (std::min(b.x1, k.x1) - std::max(b.x0, k.x0) + 1.f) *
+                                           (std::min(b.y1, k.y1) - std::max(b.y0, k.y0) + 1.f);
+                suppressed = suppressed || intersection / (area(b) + area(k) - intersection) > iou;
+            }
+            if (!suppressed)
+                kept.push_back(b);
+        }
+
+        std::vector<float> output(post_nms * 5, 0.f);
+        for (size_t i = 0; i < kept.size(); ++i)
+        {
+            output[i * 5 + 1] = kept[i].x0;
+            output[i * 5 + 2] = kept[i].y0;
+            output[i * 5 + 3] = kept[i].x1;
+            output[i * 5 + 4] = kept[i].y1;
+        }
+        return output;
+    }
+
+    // Runs the primitive on a 6x5 feature map with 6 anchors; the scores are quantized to 1/16, so the equal scores
+    // are common and some of them are zeros; pre_nms_topn cuts through the equal scores and the NMS leaves zero rows.
+    template <typename Dtype>
+    void test_proposal_reference(const std::vector<float>& info, float eps)
+    {
+        const int fm_w = 6, fm_h = 5;
+        const std::vector<float> test_ratios = { 0.5f, 1.0f, 2.0f };
+        const std::vector<float> test_scales = { 2.0f, 4.0f };
+        const int num_anchors = (int)(test_ratios.size() * test_scales.size());
+        const float test_iou = 0.5f;
+        const int test_min_size = 8;
+        const int test_stride = 16;
+        const int test_pre_nms = 40;
+        const int test_post_nms = 40;
+
+        engine engine;
+        memory cls_scores = memory::allocate(engine, { type_to_data_type<Dtype>::value, format::bfyx, { 1, 2 * num_anchors, fm_w, fm_h } });
+        memory bbox_pred = memory::allocate(engine, { type_to_data_type<Dtype>::value, format::bfyx, { 1, 4 * num_anchors, fm_w, fm_h } });
+        memory image_info = memory::allocate(engine, { type_to_data_type<Dtype>::value, format::bfyx, { 1, 1, (int)info.size(), 1 } });
+
+        std::vector<float> score_values(cls_scores.get_layout().count());
+        std::vector<float> delta_values(bbox_pred.get_layout().count());
+        std::vector<float> info_values(info.size());
+        {
+            auto scores_ptr = cls_scores.pointer<Dtype>();
+            for (size_t i = 0; i < score_values.size(); ++i)
+            {
+                scores_ptr[i] = (Dtype)(((i * 7) % 16) / 16.f);
+                score_values[i] = (float)scores_ptr[i];
+            }
+            auto deltas_ptr = bbox_pred.pointer<Dtype>();
+            for (size_t i = 0; i < delta_values.size(); ++i)
+            {
+                deltas_ptr[i] = (Dtype)(((int)((i * 5) % 9) - 4) * 0.05f);
+                delta_values[i] = (float)deltas_ptr[i];
+            }
+            auto info_ptr = image_info.pointer<Dtype>();
+            for (size_t i = 0; i < info.size(); ++i)
+            {
+                info_ptr[i] = (Dtype)info[i];
+                info_values[i] = (float)info_ptr[i];
+            }
+        }
+
+        topology topology;
+        topology.add(input_layout(cls_scores_name, cls_scores.get_layout()));
+        topology.add(input_layout(bbox_pred_name, bbox_pred.get_layout()));
+        topology.add(input_layout(image_info_name, image_info.get_layout()));
+        topology.add(proposal(layer_name, cls_scores_name, bbox_pred_name, image_info_name, test_post_nms, test_iou, test_min_size,
+                              test_stride, test_pre_nms, test_post_nms, test_ratios, test_scales));
+
+        network network(engine, topology);
+        network.set_input_data(cls_scores_name, cls_scores);
+        network.set_input_data(bbox_pred_name, bbox_pred);
+        network.set_input_data(image_info_name, image_info);
+
+        auto outputs = network.execute();
+        const std::vector<float> ref = reference_proposals(score_values, delta_values, info_values, fm_w, fm_h, test_ratios, test_scales,
+                                                           test_iou, test_min_size, test_stride, test_pre_nms, test_post_nms);
+
+        auto out_ptr = outputs.at(layer_name).get_memory().pointer<Dtype>();
+        ASSERT_EQ(out_ptr.size(), ref.size());
+        for (size_t i = 0; i < ref.size(); ++i)
+        {
+            EXPECT_NEAR((float)out_ptr[i], ref[i], eps) << "roi " << i / 5 << " item " << i % 5;
+        }
+    }
+}
+
+TEST(proposal, reference_equal_scores) {
+    test_proposal_reference<float>({ 90.f, 100.f, 1.f }, epsilon);
+}
+
+TEST(proposal, reference_equal_scores_fp16) {
+    test_proposal_reference<FLOAT16>({ 90.f, 100.f, 1.f }, epsilon_fp16);
+}
+
+TEST(proposal, reference_image_info_min_bbox_scales) {
+    test_proposal_reference<float>({ 90.f, 100.f, 1.5f, 0.5f }, epsilon);
+}
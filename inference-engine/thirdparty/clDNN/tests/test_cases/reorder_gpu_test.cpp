@@ -965,6 +965,42 @@ TEST(reorder_gpu_opt, basic_remove_redundant_output_due_to_implicit_reorders)
     EXPECT_TRUE(outputs.at("r1").get_memory().get_layout().format == format::bfyx);
 }
 
+TEST(reorder_gpu_opt, merge_reorder_after_mean_subtract)
+{
+    engine eng;
+
+    memory in = memory::allocate(eng, { data_types::f32, format::bfyx, tensor{ 1, 2, 2, 2 } });
+    topology tpl{
+        input_layout("in", in.get_layout()),
+        reorder("r1", "in", format::bfyx, data_types::f32, std::vector<float>{ 1.f, 2.f }),
+        reorder("r2", "r1", format::yxfb, data_types::f32)
+    };
+
+    set_values(in, { 1.f, 2.f, 3.f, 4.f,
+                     5.f, 6.f, 7.f, 8.f });
+
+    build_options opts;
+    opts.set_option(build_option::optimize_data(true));
+
+    network net(eng, tpl, opts);
+    net.set_input_data("in", in);
+    auto outputs = net.execute();
+    auto executed_primitives = net.get_executed_primitives();
+
+    //the mean is subtracted by the reorder to the output layout
+    EXPECT_TRUE(executed_primitives.count("r1") == 0);
+    ASSERT_TRUE(outputs.count("r2") == 1);
+    auto output = outputs.at("r2").get_memory();
+    EXPECT_TRUE(output.get_layout().format == format::yxfb);
+
+    float answers[8] = { 0.f, 3.f, 1.f, 4.f,
+                         2.f, 5.f, 3.f, 6.f };
+    auto output_ptr = output.pointer<float>();
+    for (int i = 0; i < 8; i++)
+    {
+        EXPECT_FLOAT_EQ(answers[i], output_ptr[i]);
+    }
+}
 TEST(reorder_gpu_opt, non_trivial_remove_redundant)
 {
     engine eng;
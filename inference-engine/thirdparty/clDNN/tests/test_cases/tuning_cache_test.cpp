@@ -0,0 +1,167 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/data.hpp>
+#include "test_utils/test_utils.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+
+// the section of a device the tests never run on
+const std::string other_device_section = "device 0xFFFF 1.0 1.0\n123456789 convolution_gpu_bfyx_os_iyx_osv16 0\n";
+
+void build_convolution(const engine& eng, tuning_mode mode, const std::string& tuning_file)
+{
+    auto input = memory::allocate(eng, { data_types::f32, format::bfyx, { 1, 16, 32, 32 } });
+    auto weights = memory::allocate(eng, { data_types::f32, format::bfyx, { 16, 16, 3, 3 } });
+    set_values(weights, generate_random_1d<float>(weights.get_layout().count(), -1, 1));
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        convolution("conv", "input", { "weights" }));
+
+    tuning_config_options tuning_config;
+    tuning_config.mode = mode;
+    tuning_config.cache_file_path = tuning_file;
+
+    build_options options;
+    options.set_option(build_option::tuning_config(tuning_config));
+    network network(eng, topology, options);
+}
+
+void write_file(const std::string& path, const std::string& content)
+{
+    std::ofstream file(path, std::ofstream::out | std::ofstream::trunc);
+    file << content;
+}
+
+std::string read_file(const std::string& path)
+{
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+}
+
+TEST(tuning_cache, sections_of_other_devices_are_skipped)
+{
+    const std::string tuning_file = "tuning_cache_test_other_device.txt";
+    write_file(tuning_file, other_device_section);
+
+    engine eng;
+    EXPECT_NO_THROW(build_convolution(eng, tuning_mode::tuning_use_cache, tuning_file));
+
+    const auto statistics = eng.get_tuning_statistics();
+    EXPECT_EQ(statistics.online_cache_hits, 0u);
+    EXPECT_GT(statistics.online_cache_hits + statistics.offline_cache_hits + statistics.cache_misses, 0u);
+
+    std::remove(tuning_file.c_str());
+}
+
+TEST(tuning_cache, tuned_kernels_are_found_in_merged_file)
+{
+    const std::string tuned_file = "tuning_cache_test_tuned.txt";
+    const std::string merged_file = "tuning_cache_test_merged.txt";
+    write_file(tuned_file, other_device_section);
+
+    // the kernels tuned here are appended in the section of this device
+    engine tuning_engine{ engine_configuration{ true /*profiling*/ } };
+    build_convolution(tuning_engine, tuning_mode::tuning_tune_and_cache, tuned_file);
+    EXPECT_EQ(tuning_engine.get_tuning_statistics().online_cache_hits, 0u);
+
+    const std::string tuned_content = read_file(tuned_file);
+    const std::string own_section = tuned_content.substr(other_device_section.size());
+    ASSERT_EQ(own_section.compare(0, 7, "device "), 0);
+    size_t tuned_kernels = 0;
+    std::istringstream lines(own_section);
+    for (std::string line; std::getline(lines, line);)
+    {
+        if (!line.empty() && line.compare(0, 7, "device ") != 0)
+            tuned_kernels++;
+    }
+
+    // the files are merged by concatenation
+    write_file(merged_file, other_device_section + tuned_content);
+
+    engine eng;
+    build_convolution(eng, tuning_mode::tuning_use_cache, merged_file);
+    EXPECT_EQ(eng.get_tuning_statistics().online_cache_hits, tuned_kernels);
+
+    std::remove(tuned_file.c_str());
+    std::remove(merged_file.c_str());
+}
+
+TEST(tuning_cache, network_plan_is_stored_and_reused)
+{
+    const std::string tuned_file = "tuning_cache_test_network.txt";
+    const std::string copied_file = "tuning_cache_test_network_copy.txt";
+    std::remove(tuned_file.c_str());
+
+    // the plans of the layouts are executed, the fastest one is stored with the key of the topology
+    engine tuning_engine{ engine_configuration{ true /*profiling*/ } };
+    build_convolution(tuning_engine, tuning_mode::tuning_tune_network_and_cache, tuned_file);
+
+    const std::string tuned_content = read_file(tuned_file);
+    EXPECT_NE(tuned_content.find("\nnetwork_"), std::string::npos);
+
+    // the plan is taken from the file without executing the candidates
+    write_file(copied_file, tuned_content);
+    engine eng;
+    EXPECT_NO_THROW(build_convolution(eng, tuning_mode::tuning_use_cache, copied_file));
+    EXPECT_GT(eng.get_tuning_statistics().online_cache_hits, 0u);
+
+    std::remove(tuned_file.c_str());
+    std::remove(copied_file.c_str());
+}
+
+TEST(tuning_cache, build_phases_are_timed)
+{
+    const std::string tuning_file = "tuning_cache_test_build_statistics.txt";
+    write_file(tuning_file, other_device_section);
+
+    engine eng;
+    build_convolution(eng, tuning_mode::tuning_use_cache, tuning_file);
+    const auto first = eng.get_build_statistics();
+    EXPECT_EQ(first.programs, 1u);
+    EXPECT_GT(first.graph_optimization_time + first.kernels_selection_time + first.kernels_compilation_time, 0u);
+
+    // the statistics are accumulated by the programs of the engine
+    build_convolution(eng, tuning_mode::tuning_use_cache, tuning_file);
+    const auto second = eng.get_build_statistics();
+    EXPECT_EQ(second.programs, 2u);
+    EXPECT_GE(second.kernels_compilation_time, first.kernels_compilation_time);
+    EXPECT_GE(second.tuning_lookup_time, first.tuning_lookup_time);
+
+    std::remove(tuning_file.c_str());
+}
@@ -61,10 +61,6 @@ void ref_roi_pooling_fwd_t<data_type>::execute_forward_generic() {
     int pooled_h = conf_.pooledH();
     int pooled_w = conf_.pooledW();
 
-    for (size_t i = 0; i < dst_d.size() / sizeof(data_t); i++) {
-        dst[i] = -FLT_MAX;
-    }
-
     int real_rois = 0;
     for (; real_rois < ROIS; real_rois++) {
         int roi_off;
@@ -81,30 +77,39 @@ void ref_roi_pooling_fwd_t<data_type>::execute_forward_generic() {
             break;
         }
     }
-    int n = 0;
-    for (; n < real_rois; ++n) {
-        int roi_off;
-        if(src_roi_d.ndims() == 4) {
-            roi_off = src_roi_d.off(n, 0, 0, 0);
-        }
-        else {
-            roi_off = src_roi_d.off(n, 0);
-        }
+    // the proposals are independent, so every (roi, channel) plane is computed by its own thread
+#   pragma omp parallel for collapse(2) schedule(static)
+    for (int n = 0; n < ROIS; ++n) {
+        for (int c = 0; c < C; ++c) {
+            if (n >= real_rois) {
+                for (int ph = 0; ph < pooled_h; ++ph) {
+                    for (int pw = 0; pw < pooled_w; ++pw) {
+                        dst[dst_d.off(n, c, ph, pw)] = 0;
+                    }
+                }
+                continue;
+            }
 
-        const data_t* src_roi_ptr = &src_roi[roi_off];
-        int roi_batch_ind = src_roi_ptr[0];
+            int roi_off;
+            if(src_roi_d.ndims() == 4) {
+                roi_off = src_roi_d.off(n, 0, 0, 0);
+            }
+            else {
+                roi_off = src_roi_d.off(n, 0);
+            }
 
-        if (conf_.desc()->alg_kind == mkldnn_roi_pooling_max) {
-            int roi_start_w = round(src_roi_ptr[1] * spatial_scale);
-            int roi_start_h = round(src_roi_ptr[2] * spatial_scale);
-            int roi_end_w = round(src_roi_ptr[3] * spatial_scale);
-            int roi_end_h = round(src_roi_ptr[4] * spatial_scale);
+            const data_t* src_roi_ptr = &src_roi[roi_off];
+            int roi_batch_ind = src_roi_ptr[0];
 
-            int roi_height = std::max(roi_end_h - roi_start_h + 1, 1);
-            int roi_width = std::max(roi_end_w - roi_start_w + 1, 1);
+            if (conf_.desc()->alg_kind == mkldnn_roi_pooling_max) {
+                int roi_start_w = round(src_roi_ptr[1] * spatial_scale);
+                int roi_start_h = round(src_roi_ptr[2] * spatial_scale);
+                int roi_end_w = round(src_roi_ptr[3] * spatial_scale);
+                int roi_end_h = round(src_roi_ptr[4] * spatial_scale);
 
+                int roi_height = std::max(roi_end_h - roi_start_h + 1, 1);
+                int roi_width = std::max(roi_end_w - roi_start_w + 1, 1);
 
-            for (int c = 0; c < C; ++c) {
                 for (int ph = 0; ph < pooled_h; ++ph) {
                     for (int pw = 0; pw < pooled_w; ++pw) {
                         int hstart = (ph * roi_height) / pooled_h;
@@ -134,34 +139,25 @@ void ref_roi_pooling_fwd_t<data_type>::execute_forward_generic() {
 
                         bool is_empty = (hend <= hstart) || (wend <= wstart);
 
-                        const int pool_index = dst_d.off(n, c, ph, pw);
-
-                        if (is_empty) {
-                            dst[pool_index] = 0;
-                        }
-
+                        data_t max_value = is_empty ? 0 : -FLT_MAX;
                         for (int h = hstart; h < hend; ++h) {
                             for (int w = wstart; w < wend; ++w) {
                                 data_t batch_data = src_data[src_data_d.off(roi_batch_ind, c, h, w)];
-
-                                if (batch_data > dst[pool_index]) {
-                                    dst[pool_index] = batch_data;
-                                }
+                                max_value = std::max(max_value, batch_data);
                             }
                         }
+                        dst[dst_d.off(n, c, ph, pw)] = max_value;
                     }
                 }
-            }
-        } else if (conf_.desc()->alg_kind == mkldnn_roi_pooling_bilinear) {
-            float roi_start_w_ = src_roi_ptr[1];
-            float roi_start_h_ = src_roi_ptr[2];
-            float roi_end_w_   = src_roi_ptr[3];
-            float roi_end_h_   = src_roi_ptr[4];
+            } else if (conf_.desc()->alg_kind == mkldnn_roi_pooling_bilinear) {
+                float roi_start_w_ = src_roi_ptr[1];
+                float roi_start_h_ = src_roi_ptr[2];
+                float roi_end_w_   = src_roi_ptr[3];
+                float roi_end_h_   = src_roi_ptr[4];
 
-            float height_scale = (roi_end_h_ - roi_start_h_) * (H - 1) / (pooled_h - 1);
-            float width_scale  = (roi_end_w_ - roi_start_w_) * (W - 1) / (pooled_w - 1);
+                float height_scale = (roi_end_h_ - roi_start_h_) * (H - 1) / (pooled_h - 1);
+                float width_scale  = (roi_end_w_ - roi_start_w_) * (W - 1) / (pooled_w - 1);
 
-            for (int c = 0; c < C; ++c) {
                 for (int ph = 0; ph < pooled_h; ++ph) {
                     for (int pw = 0; pw < pooled_w; ++pw) {
                         float in_y = (ph * height_scale + roi_start_h_ * (H - 1));
@@ -196,16 +192,6 @@ void ref_roi_pooling_fwd_t<data_type>::execute_forward_generic() {
             }
         }
     }
-
-    for (; n < ROIS; ++n) {
-        for (int c = 0; c < C; ++c) {
-            for (int ph = 0; ph < pooled_h; ++ph) {
-                for (int pw = 0; pw < pooled_w; ++pw) {
-                    dst[dst_d.off(n, c, ph, pw)] = 0;
-                }
-            }
-        }
-    }
 }
 
 template struct ref_roi_pooling_fwd_t<data_type::f32>;
@@ -17,7 +17,9 @@
 * \brief Implementation of custom TF subgraph call
 */
 #include "tensorflow/core/public/session.h"
+#include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/protobuf.h"
 #include "tensorflow/cc/ops/standard_ops.h"
 
 #include "tensorflow_layer.h"
@@ -27,7 +29,11 @@
 #include <string>
 #include <vector>
 #include <cstdio>
+#include <cstdint>
+#include <cstring>
 #include <cmath>
+#include <numeric>
+#include <thread>
 
 using namespace IECustomExtension;
 using namespace InferenceEngine;
@@ -52,27 +58,13 @@ vector<string> splitString(const string& s, char delimiter, bool allow_empty = f
 
 Status loadGraphDefFromString(const string& protobuf, Session* session)
 {
-    Status status;
-
-    // save the GraphDef to the file so we can use ReadTextProto to initialize GraphDef
-    auto default_env = Env::Default();
-    string graph_def_file_name = tmpnam(nullptr);
-    status = WriteStringToFile(default_env, graph_def_file_name, protobuf);
-    if (!status.ok())
-        return status;
-
     // create GraphDef with subgraph
     GraphDef graph_def;
-    status = ReadTextProto(Env::Default(), graph_def_file_name, &graph_def);
-    if (!status.ok())
-        return status;
-    remove(graph_def_file_name.c_str());
+    if (!tensorflow::protobuf::TextFormat::ParseFromString(protobuf, &graph_def))
+        return errors::InvalidArgument("Cannot parse the GraphDef of the subgraph");
 
     // Add the graph to the session
-    status = session->Create(graph_def);
-    if (!status.ok())
-      return status;
-    return status;
+    return session->Create(graph_def);
 }
 
 tensorflow::TensorShape SizeVectorToTensorShape(const SizeVector& size_vector)
@@ -83,71 +75,108 @@ tensorflow::TensorShape SizeVectorToTensorShape(const SizeVector& size_vector)
     return shape;
 }
 
-void TensorflowLayer::Execute() noexcept {
+TensorflowLayer::TensorflowLayer(const InferenceEngine::CNNLayerPtr& layer) : _layer(layer) {
     /* Stores layer params */
-    auto genLayer    = reinterpret_cast<GenericLayer*>(_layer.get());
-    auto data_params = genLayer->params;
-    string protobuf = genLayer->GetParamAsString("protobuf");
+    auto genLayer = reinterpret_cast<GenericLayer*>(_layer.get());
+    const string protobuf = genLayer->GetParamAsString("protobuf");
     const string output_tensors_names = genLayer->GetParamAsString("output_tensors_names");
     const string input_node_names = genLayer->GetParamAsString("input_nodes_names");
     const string real_input_dims = genLayer->GetParamAsString("real_input_dims");
 
-    // Initialize a tensorflow session
-    Session* session;
-    Status status = NewSession(SessionOptions(), &session);
-    if (!status.ok()) {
-        cerr << status.ToString() << "\n";
-        return;
-    }
-
-    // initialize input nodes with values provided by IE inputs
-    vector<pair<string, tensorflow::Tensor>> tf_placeholders;
     vector<string> input_names = splitString(input_node_names, ' ', false);
-    vector<string> output_tensors = splitString(output_tensors_names, ' ', false);
     vector<string> real_input_dims_str = splitString(real_input_dims, ';', false);
+    _output_tensors = splitString(output_tensors_names, ' ', false);
+    if (real_input_dims_str.size() < input_names.size())
+        THROW_IE_EXCEPTION << "The real dims are not specified for all inputs of the layer " << _layer->name;
+
+    // the operations of the subgraph use all cores like the IE layers do
+    SessionOptions options;
+    options.config.set_intra_op_parallelism_threads(static_cast<int>(std::thread::hardware_concurrency()));
+
+    // Initialize a tensorflow session
+    Session* session = nullptr;
+    Status status = NewSession(options, &session);
+    if (!status.ok())
+        THROW_IE_EXCEPTION << status.ToString();
+    _session.reset(session);
+
+    status = loadGraphDefFromString(protobuf, _session.get());
+    if (!status.ok())
+        THROW_IE_EXCEPTION << status.ToString();
 
+    // the input nodes are fed by the tensors of the real input shapes, they are bound to the IE inputs on execution
     for (size_t i = 0; i < input_names.size(); ++i)
     {
-        string& input_name = input_names[i];
-        size_t total_size = accumulate(inputs[i].dims.begin(), inputs[i].dims.end(), 1, multiplies<size_t>());
-        SizeVector in_tensor_size;
         vector<string> dims_str = splitString(real_input_dims_str[i], ' ', false);
         vector<size_t> dims_int = vector<size_t>(dims_str.size());
         for(size_t j = 0; j < dims_int.size(); ++j)
             dims_int[j] = stoi(dims_str[j]);
-        tensorflow::Tensor t = tensorflow::Tensor(tensorflow::DataType::DT_FLOAT, TensorShape(SizeVectorToTensorShape(dims_int)));
+        _input_shapes.push_back(SizeVectorToTensorShape(dims_int));
+        _allocators.emplace_back(new BlobAllocator());
+        _placeholders.emplace_back(input_names[i], tensorflow::Tensor());
+    }
+}
 
-        // copy data from an IE blob to a TF tensor as FP32
-        memcpy(t.flat<float>().data(), inputs[i].data, total_size * sizeof(float));
+TensorflowLayer::~TensorflowLayer() {
+    if (_session)
+        _session->Close();
+}
 
-        tf_placeholders.push_back(make_pair(input_name, t));
-    }
+void TensorflowLayer::Execute() noexcept {
+    // the outputs of the previous execution may refer to the memory of the inputs
+    _tf_outputs.clear();
 
-    status = loadGraphDefFromString(protobuf, session);
-    if (!status.ok()) {
-        cerr << status.ToString() << "\n";
-        return;
+    for (size_t i = 0; i < _placeholders.size() && i < inputs.size(); ++i)
+    {
+        size_t total_size = accumulate(inputs[i].dims.begin(), inputs[i].dims.end(), static_cast<size_t>(1),
+                                       multiplies<size_t>());
+        const TensorShape& shape = _input_shapes[i];
+        tensorflow::Tensor& t = _placeholders[i].second;
+        BlobAllocator& allocator = *_allocators[i];
+
+        // the blob memory is used by the TF tensor directly when it has the size and the alignment TF expects,
+        // the tensor is rebuilt only when the memory of the input is changed
+        const bool aligned = reinterpret_cast<uintptr_t>(inputs[i].data) % Allocator::kAllocatorAlignment == 0;
+        if (aligned && total_size == static_cast<size_t>(shape.num_elements())) {
+            if (allocator.data != inputs[i].data || !t.IsInitialized()) {
+                allocator.data = inputs[i].data;
+                t = tensorflow::Tensor(&allocator, DT_FLOAT, shape);
+            }
+            continue;
+        }
+
+        if (allocator.data != nullptr || !t.IsInitialized()) {
+            allocator.data = nullptr;
+            t = tensorflow::Tensor(DT_FLOAT, shape);
+        }
+        total_size = std::min(total_size, static_cast<size_t>(t.NumElements()));
+
+        // copy data from an IE blob to a TF tensor as FP32
+        memcpy(t.flat<float>().data(), inputs[i].data, total_size * sizeof(float));
     }
 
     // output tensors of the sub-graph
-    vector<tensorflow::Tensor> tf_outputs;
-
-    status = session->Run(tf_placeholders, output_tensors, {}, &tf_outputs);
+    Status status = _session->Run(_placeholders, _output_tensors, {}, &_tf_outputs);
     if (!status.ok()) {
         cerr << "session->Run() error: " << status.ToString() << "\n";
         return;
     }
+    if (_tf_outputs.empty())
+        return;
     for (size_t out_id = 0; out_id < outputs.size(); ++out_id)
     {
         size_t total_size = 1;
         for (size_t i = 0; i < outputs[out_id].dims.size(); ++i)
             total_size *= outputs[out_id].dims[i];
 
-        DataType output_data_type = tf_outputs[out_id % tf_outputs.size()].dtype();
-        if (output_data_type == DT_FLOAT)
-            memcpy(outputs[out_id].data, tf_outputs[out_id % tf_outputs.size()].flat<float>().data(), total_size * sizeof(float));
+        const tensorflow::Tensor& tf_output = _tf_outputs[out_id % _tf_outputs.size()];
+        // the subgraph may pass the input through, then the data is already in place
+        if (tf_output.tensor_data().data() == outputs[out_id].data)
+            continue;
+        if (tf_output.dtype() == DT_FLOAT)
+            memcpy(outputs[out_id].data, tf_output.flat<float>().data(), total_size * sizeof(float));
         else
-            memcpy(outputs[out_id].data, tf_outputs[out_id % tf_outputs.size()].flat<int64>().data(), total_size * sizeof(int64));
+            memcpy(outputs[out_id].data, tf_output.flat<int64>().data(), total_size * sizeof(int64));
     }
 }
 
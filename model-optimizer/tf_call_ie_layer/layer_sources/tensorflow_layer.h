@@ -18,21 +18,20 @@
 #include "inference_engine.hpp"
 #include "mkldnn/mkldnn_generic_primitive.hpp"
 #include "mkldnn/mkldnn_extension.hpp"
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/public/session.h"
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace IECustomExtension {
 
 class TensorflowLayer : public InferenceEngine::MKLDNNPlugin::IMKLDNNGenericPrimitive {
 public:
-    explicit TensorflowLayer(const InferenceEngine::CNNLayerPtr& layer) : _layer(layer) {
-        // try to check parameters availability in constructor
-        auto genLayer = reinterpret_cast<InferenceEngine::GenericLayer*>(_layer.get());
-        const std::string protobuf = genLayer->GetParamAsString("protobuf");
-        const std::string input_nodes_names = genLayer->GetParamAsString("input_nodes_names");
-        const std::string output_tensors_names = genLayer->GetParamAsString("output_tensors_names");
-    }
+    explicit TensorflowLayer(const InferenceEngine::CNNLayerPtr& layer);
 
-    ~TensorflowLayer() override {}
+    ~TensorflowLayer() override;
 
     std::vector<InferenceEngine::MKLDNNPlugin::MKLDNNGenericFormats> GetSupportedFormats() noexcept override;
 
@@ -40,6 +39,29 @@ public:
 
 private:
     InferenceEngine::CNNLayerPtr _layer;
+
+    /**
+     * @brief The allocator of the tensors wrapping the memory of the IE blobs, it gives out the memory
+     * which is set before the tensor is constructed and never frees it
+     */
+    class BlobAllocator : public tensorflow::Allocator {
+    public:
+        std::string Name() override { return "ie_blob"; }
+        void* AllocateRaw(size_t alignment, size_t num_bytes) override { return data; }
+        void DeallocateRaw(void* ptr) override {}
+
+        void* data = nullptr;
+    };
+
+    // the session with the subgraph is created once and run by every execution of the layer,
+    // the placeholder tensors wrap the memory of the IE inputs when they have the real input dims
+    // and are only refilled with the input data otherwise
+    std::unique_ptr<tensorflow::Session> _session;
+    std::vector<std::unique_ptr<BlobAllocator>> _allocators;
+    std::vector<tensorflow::TensorShape> _input_shapes;
+    std::vector<std::pair<std::string, tensorflow::Tensor>> _placeholders;
+    std::vector<std::string> _output_tensors;
+    std::vector<tensorflow::Tensor> _tf_outputs;
 };
 
 }  // namespace IECustomExtension